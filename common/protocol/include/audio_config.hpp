@@ -5,8 +5,10 @@ namespace protocol
 {
     constexpr const int LOOKUP_TABLE_SIZE = 1024;
     constexpr const int RECEIVER_ARRDESS = 0x28;
-    constexpr const int NUM_VOICES = 3;
-    constexpr const int NUM_SOUNDS = 6;
+    constexpr const int MAX_VOICES = 16;        // timbral voices the engine allocates for, one per MIDI channel
+    constexpr const int MAX_POLYPHONY = 32;     // oscillators the engine allocates for, shared by all voices
+    constexpr const int DEFAULT_VOICES = 3;     // voices playing until the Engine page says otherwise
+    constexpr const int DEFAULT_POLYPHONY = 6;  // oscillators playing until the Engine page says otherwise
     constexpr const int SAMPLE_RATE = 48000;
     constexpr const int AMPLITUDE = 24000;
     constexpr const int BUFFER_SIZE = 512;
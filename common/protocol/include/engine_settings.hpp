@@ -0,0 +1,39 @@
+#pragma once
+#include "field_type.hpp"
+#include "audio_config.hpp"
+
+namespace protocol
+{
+
+    // Global engine fields; the synth applies them at runtime without a restart
+    enum class EngineField : uint8_t
+    {
+        Voices,    ///< timbral voices playing (1..MAX_VOICES)
+        Polyphony, ///< oscillators shared by all voices (1..MAX_POLYPHONY)
+        _Count
+    };
+
+    static constexpr FieldInfo engineInfo[] = {
+        {
+            .label = "Voices",
+            .type = FieldType::Range,
+            .min = 1,
+            .max = MAX_VOICES,
+            .opts = nullptr,
+            .optCount = 0,
+            .defaultValue = DEFAULT_VOICES,
+            .increment = 1,
+        },
+        {
+            .label = "Poly",
+            .type = FieldType::Range,
+            .min = 1,
+            .max = MAX_POLYPHONY,
+            .opts = nullptr,
+            .optCount = 0,
+            .defaultValue = DEFAULT_POLYPHONY,
+            .increment = 1,
+        },
+    };
+
+}
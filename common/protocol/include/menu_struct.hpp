@@ -9,6 +9,7 @@
 #include "tuning_settings.hpp"
 #include "filter_settings.hpp"
 #include "bpm_settings.hpp"
+#include "engine_settings.hpp"
 #include "channel_settings.hpp"
 
 namespace protocol
@@ -32,7 +33,8 @@ namespace protocol
         PitchLFO,
         AmpLFO,
         VolChan,
-        Bpm, ///< Global BPM settings page
+        Bpm,    ///< Global BPM settings page
+        Engine, ///< Global voice count and polyphony
         _Count
     };
 
@@ -52,11 +54,12 @@ namespace protocol
         {"Amp LFO", lfoInfo, sizeof(lfoInfo) / sizeof(FieldInfo)},
         {"Vol/Channel", channelInfo, sizeof(channelInfo) / sizeof(FieldInfo)},
         {"BPM", bpmInfo, sizeof(bpmInfo) / sizeof(FieldInfo)},
+        {"Engine", engineInfo, sizeof(engineInfo) / sizeof(FieldInfo)},
     };
 
     static constexpr uint8_t MAX_FIELDS = 4;
     static constexpr size_t PAGE_COUNT = static_cast<size_t>(Page::_Count);
-    static constexpr size_t GLOBAL_PAGE_COUNT = 1;
+    static constexpr size_t GLOBAL_PAGE_COUNT = 2; ///< global pages follow the voice pages
     static constexpr size_t VOICE_PAGE_COUNT = PAGE_COUNT - GLOBAL_PAGE_COUNT;
 
 } // namespace menu
@@ -1,4 +1,5 @@
 #pragma once
+#include <algorithm>
 #include <cstdint>
 #include "esp_log.h"
 
@@ -75,8 +76,18 @@ namespace protocol
         }
         else if (e.type == EventType::FieldUpdate)
         {
-            auto fu = serializeFieldUpdates(e.fields);
-            buf.insert(buf.end(), fu.begin(), fu.end());
+            // The count prefix is one byte: longer lists (a full project
+            // at MAX_VOICES) go out as consecutive FieldUpdate packets
+            constexpr size_t MAX_PER_PACKET = UINT8_MAX;
+            for (size_t first = 0; first < e.fields.size() || first == 0; first += MAX_PER_PACKET)
+            {
+                if (first > 0)
+                    buf.push_back(static_cast<uint8_t>(EventType::FieldUpdate));
+                size_t last = std::min(e.fields.size(), first + MAX_PER_PACKET);
+                FieldUpdateList chunk(e.fields.begin() + first, e.fields.begin() + last);
+                auto fu = serializeFieldUpdates(chunk);
+                buf.insert(buf.end(), fu.begin(), fu.end());
+            }
         }
         else if (e.type == EventType::BpmFromMidi)
         {
@@ -132,9 +143,10 @@ namespace protocol
             case EventType::FieldUpdate:
             {
                 size_t remain = length - offset;
-                auto fields = deserializeFieldUpdates(buffer + offset, remain);
                 uint8_t count = buffer[offset];
                 size_t packetSize = 1 + size_t(count) * sizeof(FieldUpdate);
+                // Parse only this packet; the next event may follow it
+                auto fields = deserializeFieldUpdates(buffer + offset, std::min(packetSize, remain));
                 offset += (packetSize <= remain ? packetSize : remain);
                 e.fields = std::move(fields);
                 break;
@@ -29,8 +29,8 @@ namespace store
 
         bool isGlobal(Page page) const
         {
-            // only BPM is global for now
-            return page == Page::Bpm;
+            // global pages (BPM, Engine) follow the voice pages
+            return static_cast<size_t>(page) >= VOICE_PAGE_COUNT;
         }
 
         const std::vector<VoiceCache> &getVoiceData() const { return data; }
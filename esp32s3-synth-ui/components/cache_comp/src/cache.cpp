@@ -19,7 +19,7 @@ int16_t Cache::get(uint8_t voiceIndex, Page page, uint8_t field) const
 
     if (isGlobal(page))
     {
-        return globalData[VOICE_PAGE_COUNT - p][field];
+        return globalData[p - VOICE_PAGE_COUNT][field];
     }
     else
     {
@@ -41,7 +41,7 @@ void Cache::set(const FieldUpdateList &updates)
 
         if (isGlobal(page))
         {
-            globalData[VOICE_PAGE_COUNT - p][u.field] = u.value;
+            globalData[p - VOICE_PAGE_COUNT][u.field] = u.value;
         }
         else
         {
@@ -105,6 +105,15 @@ namespace menu
         return updates;
     }
 
+    /// A stored value the field cannot hold (e.g. a global field added after
+    /// the project was saved reads as 0) falls back to the field default
+    inline int16_t sanitizeFieldValue(const FieldInfo &fi, int16_t value)
+    {
+        if (fi.type == FieldType::Range)
+            return value < fi.min || value > fi.max ? fi.defaultValue : value;
+        return value < 0 || value >= fi.optCount ? fi.defaultValue : value;
+    }
+
     FieldUpdateList mapProjectEntryToUpdates(const ProjectStoreEntry &projectEntry)
     {
         FieldUpdateList updates;
@@ -135,7 +144,7 @@ namespace menu
                     if (idx >= flatGlobal.size())
                         break;
 
-                    int16_t value = flatGlobal[idx];
+                    int16_t value = sanitizeFieldValue(pi.fields[f], flatGlobal[idx]);
                     updates.push_back(FieldUpdate{
                         static_cast<uint8_t>(-1),
                         static_cast<uint8_t>(pageIndex),
@@ -71,7 +71,12 @@ namespace menu
         void initAutosaveTask();
         void updateVoiceUp();
 
-        uint8_t voiceCount;
+        /// Voices the Engine page has enabled; voiceUp/Down stay inside them
+        uint8_t activeVoiceCount() const;
+        /// Move the selected voice back into range after the count shrank
+        void clampVoiceIndex();
+
+        uint8_t voiceCount; ///< voices the cache holds (MAX_VOICES)
         Cache cache;
 
         DisplayCallback displayCallback;
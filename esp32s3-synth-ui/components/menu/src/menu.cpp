@@ -167,6 +167,8 @@ void Menu::changeValuePage(uint8_t knob, int16_t pos)
             .field = knob,
             .value = newVal}};
     cache.set(updates);
+    if (itemToPage(state.menuItemIndex) == Page::Engine)
+        clampVoiceIndex();
     // update snapshot
     state.fieldValues[knob] = cache.get(
         state.voiceIndex,
@@ -228,13 +230,28 @@ void Menu::voiceDown()
 {
     if (state.mode == AppMode::Popup)
         return;
-    if (state.voiceIndex < voiceCount - 1)
+    if (state.voiceIndex < activeVoiceCount() - 1)
     {
         state.voiceIndex++;
         updateVoiceUp();
     }
 }
 
+uint8_t Menu::activeVoiceCount() const
+{
+    int16_t count = cache.get(0, Page::Engine, static_cast<uint8_t>(EngineField::Voices));
+    return static_cast<uint8_t>(std::clamp<int16_t>(count, 1, voiceCount));
+}
+
+void Menu::clampVoiceIndex()
+{
+    if (state.voiceIndex < activeVoiceCount())
+        return;
+    state.voiceIndex = activeVoiceCount() - 1;
+    state.channel = cache.get(state.voiceIndex, Page::VolChan, 0);
+    state.volume = cache.get(state.voiceIndex, Page::VolChan, 1);
+}
+
 void Menu::updateVoiceUp()
 {
     // refresh dependent values
@@ -91,7 +91,14 @@ void Menu::saveVoice(uint8_t slotIndex, const std::string &name)
 void Menu::loadProject(int16_t slotIndex)
 {
     const ProjectStoreEntry projectEntry = paramStore.loadProject(slotIndex);
-    auto updates = projectEntry.voices.empty() ? presets.loadDefaultProject() : mapProjectEntryToUpdates(projectEntry);
+    auto updates = projectEntry.voices.empty() ? presets.loadDefaultProject(voiceCount) : mapProjectEntryToUpdates(projectEntry);
+
+    // Projects saved with fewer voices get defaults for the rest
+    for (size_t i = projectEntry.voices.size(); !projectEntry.voices.empty() && i < voiceCount; ++i)
+    {
+        auto voice = presets.loadDefaultVoice(static_cast<uint8_t>(i));
+        updates.insert(updates.end(), voice.begin(), voice.end());
+    }
     // todo Update channel/volume state
     if (auto channelPage = parseChannelPage(updates))
     {
@@ -102,6 +109,7 @@ void Menu::loadProject(int16_t slotIndex)
     }
     // Apply all updates at once
     cache.set(updates);
+    clampVoiceIndex();
 
     if (slotIndex != AUTOSAVE_SLOT)
     {
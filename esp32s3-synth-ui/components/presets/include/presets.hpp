@@ -18,7 +18,8 @@ namespace store
 
         /* data */
     public:
-        FieldUpdateList loadDefaultProject();
+        /// Defaults for `voiceCount` voices plus the global pages
+        FieldUpdateList loadDefaultProject(uint8_t voiceCount);
         FieldUpdateList loadDefaultVoice(uint8_t voiceIndex);
     };
 
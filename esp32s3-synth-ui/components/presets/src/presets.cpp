@@ -5,10 +5,10 @@
 
 using namespace store;
 
-FieldUpdateList Presets::loadDefaultProject()
+FieldUpdateList Presets::loadDefaultProject(uint8_t voiceCount)
 {
     FieldUpdateList result;
-    for (int voiceIndex = 0; voiceIndex < NUM_VOICES; voiceIndex++)
+    for (int voiceIndex = 0; voiceIndex < voiceCount; voiceIndex++)
     {
         auto voice = loadDefaultVoice(voiceIndex);
         result.insert(result.end(), voice.begin(), voice.end());
@@ -33,6 +33,8 @@ FieldUpdateList Presets::loadGlobalFields()
     FieldUpdateList result;
     auto fieldDefaults = loadFieldDefaults(AUTOSAVE_SLOT, Page::Bpm, bpmInfo);
     result.insert(result.end(), fieldDefaults.begin(), fieldDefaults.end());
+    auto engineDefaults = loadFieldDefaults(AUTOSAVE_SLOT, Page::Engine, engineInfo);
+    result.insert(result.end(), engineDefaults.begin(), engineDefaults.end());
     ESP_LOGI(TAG, "Load default global fields size of fields %d", result.size());
 
     return result;
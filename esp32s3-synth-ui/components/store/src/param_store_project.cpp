@@ -205,17 +205,24 @@ ProjectStoreEntry ParamStore::loadProject(int16_t index)
     // Load global params
     // First: probe
     err = nvs_get_blob(handle, key, nullptr, &globalBlobLen);
-    if (err == ESP_OK && globalBlobLen == globalExpectedSize * sizeof(int16_t))
+    if (err == ESP_OK && globalBlobLen > 0 && globalBlobLen % sizeof(int16_t) == 0)
     {
-        entry.globalParams.resize(globalExpectedSize);
+        // Projects saved before a global page was added hold a shorter blob:
+        // keep the pages they have, zero the rest (mapped to field defaults)
+        if (globalBlobLen != globalExpectedSize * sizeof(int16_t))
+            ESP_LOGW(TAG, "  globalParams has %zu bytes, expected %zu", globalBlobLen, globalExpectedSize * sizeof(int16_t));
+
+        std::vector<int16_t> stored(globalBlobLen / sizeof(int16_t));
 
         // Second: read data
-        err = nvs_get_blob(handle, key, entry.globalParams.data(), &globalBlobLen);
+        err = nvs_get_blob(handle, key, stored.data(), &globalBlobLen);
         if (err != ESP_OK)
         {
             ESP_LOGE(TAG, "  globalParams blob read failed (err=%d)", static_cast<int>(err));
-            entry.globalParams.clear(); // fallback
+            stored.clear(); // fallback
         }
+        stored.resize(globalExpectedSize, 0);
+        entry.globalParams = std::move(stored);
     }
     else
     {
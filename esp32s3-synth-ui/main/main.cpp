@@ -43,7 +43,7 @@ Button buttonRight;
 Button buttonLeft;
 Sender sender(senderConfig);
 
-Menu menuHolder(protocol::NUM_VOICES);
+Menu menuHolder(protocol::MAX_VOICES);
 
 auto midiReadCallback = [](const uint8_t packet[4])
 { midiParser.feed(packet); };
@@ -1,10 +1,17 @@
 #pragma once
-#include "phase.hpp"
-#include "attack.hpp"
-#include "decay.hpp"
-#include "sustain.hpp"
-#include "release.hpp"
+#include <cstdint>
+#include <cstddef>
+#include "protocol.hpp"
 
+using namespace protocol;
+
+/**
+ * Linear ADSR as a flat segment state machine.
+ *
+ * Each ramp segment keeps the number of samples it has left and a per-sample
+ * step, so renderBlock() can fill a whole span with one add per sample and
+ * only branches at segment boundaries.
+ */
 class Envelope
 {
 public:
@@ -16,6 +23,15 @@ public:
         uint8_t release;
     };
 
+    enum class Segment : uint8_t
+    {
+        Idle,
+        Attack,
+        Decay,
+        Sustain,
+        Release
+    };
+
     explicit Envelope(float sampleRate, uint16_t initialBpm);
 
     void setAttack(uint8_t value);
@@ -28,22 +44,46 @@ public:
     void gateOff();
     void setToIdle();
 
+    /// Gate on from the current level: the attack continues upwards from
+    /// wherever the envelope is, taking the matching share of its time
+    void retrigger();
+
+    /// Advance one sample and return its level
     float next();
+
+    /// Write the next n levels to out
+    void renderBlock(float *out, size_t n);
+
     bool is_idle() const;
 
+    /// Level the next sample starts from, 0–1
+    float getLevel() const { return level; }
+
 private:
     Params params{0, 0, 0, 0};
     float sustainLevel = 0.0f;
     float sampleRate;
     uint16_t bpm;
 
-    // ADSR phases
-    AttackPhase attack;
-    DecayPhase decay;
-    SustainPhase sustain;
-    ReleasePhase release;
+    // Segment lengths in samples, derived from params and bpm
+    float attackSamples = 1.0f;
+    float decaySamples = 1.0f;
+    float releaseSamples = 1.0f;
+
+    // Running state
+    Segment segment = Segment::Idle;
+    float level = 0.0f;      ///< level emitted by the next sample
+    float step = 0.0f;       ///< per-sample change inside a ramp
+    float startLevel = 0.0f; ///< level the current ramp began at
+    uint32_t remaining = 0;  ///< samples left in the current ramp
 
-    EnvelopePhase *active = nullptr;
+    void recalculate(); // update segment lengths and re-aim a running ramp
+    void enterRamp(Segment next, float from, float to, float totalSamples);
+    void retarget();
+    void finishSegment();
+    float segmentTarget() const;
+    float segmentSamples() const;
 
-    void recalculate(); // update all phases based on current params
+    float calcBeats(uint8_t param) const;
+    float beatsToSamples(float beats) const;
 };
@@ -1,55 +0,0 @@
-#include "attack.hpp"
-#include "esp_log.h"
-#include <cmath>
-#define TAG "Attack"
-
-AttackPhase::AttackPhase(float sampleRate) : EnvelopePhase(sampleRate)
-{
-}
-
-void AttackPhase::recalculate(uint8_t param, float bpm, float)
-{
-    float beats = calcBeats(param, bpm);
-    totalSamples = beatsToSamples(beats, bpm);
-    reciprocal = (totalSamples > 0.0f) ? (1.0f / totalSamples) : 0.0f;
-
-    if (!finished && totalSamples > 0.0f)
-    {
-        cursor = currentLevel * totalSamples;    // safer numerically
-        cursor = std::min(cursor, totalSamples); // clamp
-    }
-}
-
-void AttackPhase::enter(float /*startLevel*/)
-{
-    // ESP_LOGI(TAG, "enter");
-    cursor = 0.0f;
-    currentLevel = 0.0f;
-    finished = false;
-}
-
-float AttackPhase::next()
-{
-    if (finished)
-        return 1.0f;
-
-    currentLevel = cursor * reciprocal;
-    cursor += 1.0f;
-    if (cursor >= totalSamples || currentLevel >= 1.0f)
-    {
-        currentLevel = 1.0f;
-        finished = true;
-    }
-
-    return currentLevel;
-}
-
-float AttackPhase::currentValue() const
-{
-    return currentLevel;
-}
-
-bool AttackPhase::isFinished() const
-{
-    return cursor >= totalSamples;
-}
@@ -1,14 +1,14 @@
 #include "envelope.hpp"
-#include "esp_log.h" // for std::rand, RAND_MAX
-#define TAG  "Envelope"
+#include <algorithm>
+#include <cmath>
+#include "fastmath.hpp"
+#include "esp_attr.h"
+#include "esp_log.h"
+#define TAG "Envelope"
 
 Envelope::Envelope(float sampleRate, uint16_t initialBpm)
     : sampleRate(sampleRate),
-      bpm(initialBpm),
-      attack(sampleRate),
-      decay(sampleRate),
-      sustain(sampleRate),
-      release(sampleRate)
+      bpm(initialBpm)
 {
     recalculate();
 }
@@ -43,82 +43,178 @@ void Envelope::setBpm(uint16_t newBpm)
     recalculate();
 }
 
-void Envelope::recalculate()
+float Envelope::calcBeats(uint8_t param) const
 {
-    sustainLevel = static_cast<float>(params.sustain) / static_cast<float>(envelope::MAX);
+    float norm = float(param) / float(envelope::MAX);
+    return envelope::MIN_BEAT_LENGTH * sound_module::fastmath::pow(envelope::MAX_BEAT_LENGTH / envelope::MIN_BEAT_LENGTH, norm);
+}
 
-    attack.recalculate(params.attack, bpm, sustainLevel);
-    decay.recalculate(params.decay, bpm, sustainLevel);
-    sustain.recalculate(params.sustain, bpm, sustainLevel);
-    release.recalculate(params.release, bpm, sustainLevel);
+float Envelope::beatsToSamples(float beats) const
+{
+    return beats * (60.0f / bpm) * sampleRate;
 }
 
-void Envelope::gateOn()
+void Envelope::recalculate()
 {
-    attack.enter(0.0f);
-    active = &attack;
+    sustainLevel = static_cast<float>(params.sustain) / static_cast<float>(envelope::MAX);
+
+    attackSamples = beatsToSamples(calcBeats(params.attack));
+    decaySamples = beatsToSamples(calcBeats(params.decay));
+    releaseSamples = beatsToSamples(calcBeats(params.release));
+
+    if (segment == Segment::Sustain)
+        level = sustainLevel;
+    else if (segment != Segment::Idle)
+        retarget();
 }
 
-void Envelope::gateOff()
+float Envelope::segmentTarget() const
 {
-    if (active && active != &release)
+    switch (segment)
     {
-        float level = active->currentValue();
-        release.enter(level);
-        active = &release;
+    case Segment::Attack:
+        return 1.0f;
+    case Segment::Decay:
+    case Segment::Sustain:
+        return sustainLevel;
+    default:
+        return 0.0f;
     }
 }
 
-float Envelope::next()
+float Envelope::segmentSamples() const
 {
-    if (!active)
+    switch (segment)
     {
+    case Segment::Attack:
+        return attackSamples;
+    case Segment::Decay:
+        return decaySamples;
+    case Segment::Release:
+        return releaseSamples;
+    default:
         return 0.0f;
     }
+}
 
-    float value = active->next();
+void Envelope::enterRamp(Segment next, float from, float to, float totalSamples)
+{
+    segment = next;
+    startLevel = from;
+    level = from;
+    remaining = std::max<uint32_t>(1, static_cast<uint32_t>(totalSamples + 0.5f));
+    step = (to - from) / static_cast<float>(remaining);
+}
+
+// Keep the progress through a running ramp when its length or target
+// changes, and re-aim the remaining span at the new target
+void Envelope::retarget()
+{
+    const float target = segmentTarget();
+    float progressLeft = 0.0f;
+    if (startLevel != target)
+        progressLeft = std::clamp((level - target) / (startLevel - target), 0.0f, 1.0f);
+
+    remaining = std::max<uint32_t>(1, static_cast<uint32_t>(progressLeft * segmentSamples() + 0.5f));
+    step = (target - level) / static_cast<float>(remaining);
+}
 
-    if (active->isFinished())
+void Envelope::finishSegment()
+{
+    level = segmentTarget();
+    switch (segment)
     {
-        if (active == &attack)
+    case Segment::Attack:
+        if (level <= sustainLevel)
         {
-            float level = attack.currentValue();
-            if (level <= sustainLevel)
-            {
-                sustain.enter(level);
-                active = &sustain;
-            }
-            else
-            {
-                decay.enter(level);
-                active = &decay;
-            }
+            segment = Segment::Sustain;
+            level = sustainLevel;
         }
-        else if (active == &decay)
+        else
         {
-            sustain.enter(decay.currentValue());
-            active = &sustain;
+            enterRamp(Segment::Decay, level, sustainLevel, decaySamples);
         }
-        else if (active == &sustain)
+        break;
+    case Segment::Decay:
+        segment = Segment::Sustain;
+        level = sustainLevel;
+        break;
+    case Segment::Release:
+        segment = Segment::Idle;
+        level = 0.0f;
+        break;
+    default:
+        break;
+    }
+}
+
+void Envelope::gateOn()
+{
+    enterRamp(Segment::Attack, 0.0f, 1.0f, attackSamples);
+}
+
+void Envelope::retrigger()
+{
+    const float from = std::clamp(level, 0.0f, 1.0f);
+    enterRamp(Segment::Attack, from, 1.0f, attackSamples * (1.0f - from));
+}
+
+void Envelope::gateOff()
+{
+    if (segment == Segment::Idle || segment == Segment::Release)
+        return;
+
+    if (level <= 0.0f)
+    {
+        setToIdle();
+        return;
+    }
+    enterRamp(Segment::Release, level, 0.0f, releaseSamples);
+}
+
+float Envelope::next()
+{
+    float value = 0.0f;
+    renderBlock(&value, 1);
+    return value;
+}
+
+IRAM_ATTR void Envelope::renderBlock(float *out, size_t n)
+{
+    while (n > 0)
+    {
+        if (segment == Segment::Idle || segment == Segment::Sustain)
         {
-            // Should only transition via gateOff
+            // Flat segments last until the next gate change
+            std::fill(out, out + n, level);
+            return;
         }
-        else if (active == &release)
-        {
-            // ESP_LOGI(TAG, "set to idle");
 
-            active = nullptr;
+        const size_t span = std::min<size_t>(n, remaining);
+        const float s = step;
+        float l = level;
+        for (size_t i = 0; i < span; ++i)
+        {
+            out[i] = l;
+            l += s;
         }
-    }
+        level = l;
+        out += span;
+        n -= span;
+        remaining -= static_cast<uint32_t>(span);
 
-    return value;
+        if (remaining == 0)
+            finishSegment();
+    }
 }
 
 bool Envelope::is_idle() const
 {
-    return active == nullptr;
+    return segment == Segment::Idle;
 }
 
-void Envelope::setToIdle(){
-    active = nullptr;
+void Envelope::setToIdle()
+{
+    segment = Segment::Idle;
+    level = 0.0f;
 }
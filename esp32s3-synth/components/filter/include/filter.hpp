@@ -1,7 +1,7 @@
 #pragma once
 #include <cstdint>
+#include <cstddef>
 #include "lfo.hpp"
-#include "cached_lfo.hpp"
 #include "filter_settings.hpp"
 #include "esp_attr.h"
 
@@ -9,46 +9,80 @@ using namespace protocol;
 
 namespace sound_module
 {
-    /// Generic filter interface: supports dynamic modulation of cutoff and resonance
+    /**
+     * Topology-preserving-transform state-variable filter (Zavalishin).
+     *
+     * One SVF core yields low, band and high outputs at once; the selected
+     * FilterType is a fixed mix of those taps, so all four modes share the
+     * same state and switching type never needs a coefficient table.
+     * Cutoff and resonance are continuous: a change glides linearly across
+     * the next processed block so parameter moves do not zipper.
+     */
     class Filter
     {
     public:
-        /// Filter types corresponding to protocol::filtTypes
-
         /// Construct with a sample rate and default settings
         explicit Filter(uint32_t sampleRate, uint8_t init_bpm, uint8_t voiceIndex);
 
-        /// Set the filter type (LP12, HP12, BP12, Notch)
+        /// Set the filter type (LP12, HP12, BP12, Notch); also picks the
+        /// block kernel specialised for it
         void setType(FilterType type)
         {
             filterType = type;
+            blockKernel = blockKernelFor(type);
             resetState();
+            dirty = true;
         };
 
-        /// Set the base cutoff frequency (Hz) 0 - 127
-        void setCutoff(uint8_t cutoffHz) { baseCutoff = cutoffHz; };
+        /// Set the base cutoff 0 - MAX_CUTOFF_RAW (0 = fully open for LP/Notch)
+        void setCutoff(uint8_t cutoffRaw)
+        {
+            baseCutoff = cutoffRaw;
+            dirty = true;
+        };
+
+        /// Set the base resonance 0 - MAX_RESONANCE_RAW
+        void setResonance(uint8_t q)
+        {
+            baseResonance = q;
+            dirty = true;
+        };
 
-        /// Set the base resonance (Q factor)0 - 127
-        void setResonance(uint8_t q) { baseResonance = q; };
+        /// False while the settings bypass the filter (cutoff 0 with resonance set)
+        bool isActive() const { return !(baseCutoff == 0 && baseResonance); }
 
-        /// Process a single sample through the filter, applying any active LFO modulation
+        /// Process a single sample; parameter changes apply immediately
         float process(float input);
 
+        /// Filter a block in place, gliding g/k from their last values to the current targets
+        void processBlock(float *buffer, size_t n);
+
     private:
+        /// processBlock() body with the type's output mix compiled in
+        using BlockKernel = void (Filter::*)(float *buffer, size_t n);
+        template <FilterType TYPE>
+        void processBlockAs(float *buffer, size_t n);
+        static BlockKernel blockKernelFor(FilterType type);
+
         uint32_t sample_rate;
         FilterType filterType = FilterType::LP12;
         uint8_t baseCutoff = 0;
         uint8_t baseResonance = 0;
+        bool dirty = true;
+        BlockKernel blockKernel = blockKernelFor(FilterType::LP12);
+
+        // Integrator states
+        float ic1eq = 0.0f, ic2eq = 0.0f;
+
+        // Current and target prewarped cutoff (g) and damping (k = 1/Q)
+        float g = 0.0f, k = 2.0f;
+        float targetG = 0.0f, targetK = 2.0f;
 
-        // Internal filter state (poles, etc.)
-        float z1 = 0.0f, z2 = 0.0f;
-        int lastCutoffIndex = -1;
-        int lastResonanceIndex = -1;
-        FilterType lastFilterType = FilterType::LP12;
+        // Output mix: y = mixLow * low + mixBand * k * band + mixInput * input
+        float mixLow = 1.0f, mixBand = 0.0f, mixInput = 0.0f;
 
-        float lastB0 = 0.0f, lastB1 = 0.0f, lastB2 = 0.0f;
-        float lastA1 = 0.0f, lastA2 = 0.0f;
         void resetState();
+        bool updateTargets(); ///< false when the filter is bypassed
     };
 
 } // namespace sound_module
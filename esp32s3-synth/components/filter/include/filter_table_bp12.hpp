@@ -1,74 +0,0 @@
-#pragma once
-#include <cstdint>
-#include "protocol.hpp"
-using namespace protocol;
-namespace sound_module
-{
-  constexpr float filterTableBP12[CUTOFF_TABLE_SIZE][RESONANCE_TABLE_SIZE][5] = {
-  {{0.4974004f, -0.9947975f, 0.4974004f, -1.9895949f, 0.9896017f}, {0.4974205f, -0.9948375f, 0.4974205f, -1.9896751f, 0.9896819f}, {0.4974788f, -0.9949542f, 0.4974788f, -1.9899084f, 0.9899152f}, {0.4975703f, -0.9951373f, 0.4975703f, -1.9902745f, 0.9902814f}, {0.4976879f, -0.9953723f, 0.4976879f, -1.9907447f, 0.9907515f}, {0.4978233f, -0.9956431f, 0.4978233f, -1.9912862f, 0.991293f}, {0.4979686f, -0.9959339f, 0.4979686f, -1.9918677f, 0.9918746f}, {0.4981172f, -0.9962311f, 0.4981172f, -1.9924622f, 0.992469f}, {0.4982638f, -0.9965242f, 0.4982638f, -1.9930484f, 0.9930552f}, {0.4984046f, -0.9968057f, 0.4984046f, -1.9936114f, 0.9936182f}, {0.4985371f, -0.9970708f, 0.4985371f, -1.9941416f, 0.9941484f}, {0.4986601f, -0.9973168f, 0.4986601f, -1.9946337f, 0.9946405f}, {0.4987731f, -0.9975429f, 0.4987731f, -1.9950857f, 0.9950925f}, {0.4988762f, -0.9977489f, 0.4988762f, -1.9954978f, 0.9955047f}, {0.4989696f, -0.9979358f, 0.4989696f, -1.9958716f, 0.9958785f}, {0.4990541f, -0.9981048f, 0.4990541f, -1.9962095f, 0.9962164f}, {0.4991303f, -0.9982572f, 0.4991303f, -1.9965144f, 0.9965213f}, {0.499199f, -0.9983946f, 0.499199f, -1.9967893f, 0.9967961f}, {0.499261f, -0.9985185f, 0.499261f, -1.997037f, 0.9970438f}, {0.4993168f, -0.9986302f, 0.4993168f, -1.9972603f, 0.9972672f}, {0.4993672f, -0.998731f, 0.4993672f, -1.9974619f, 0.9974688f}, {0.4994127f, -0.998822f, 0.4994127f, -1.9976441f, 0.9976509f}, {0.4994539f, -0.9989045f, 0.4994539f, -1.9978089f, 0.9978158f}, {0.4994913f, -0.9989792f, 0.4994913f, -1.9979584f, 0.9979652f}, {0.4995252f, -0.999047f, 0.4995252f, -1.9980941f, 0.9981009f}, {0.4995561f, -0.9991088f, 0.4995561f, -1.9982176f, 0.9982244f}, {0.4995842f, -0.999165f, 0.4995842f, -1.9983301f, 0.9983369f}, {0.4996099f, -0.9992164f, 0.4996099f, -1.9984329f, 0.9984397f}, {0.4996334f, -0.9992634f, 0.4996334f, -1.9985269f, 0.9985337f}, {0.499655f, -0.9993065f, 0.499655f, -1.9986131f, 0.9986199f}, {0.4996748f, -0.9993461f, 0.4996748f, -1.9986922f, 0.9986991f}, {0.499693f, -0.9993825f, 0.499693f, -1.998765f, 0.9987719f}, {0.4997098f, -0.9994161f, 0.4997098f, -1.9988322f, 0.998839f}, {0.4997252f, -0.9994471f, 0.4997252f, -1.9988941f, 0.998901f}, {0.4997396f, -0.9994757f, 0.4997396f, -1.9989515f, 0.9989583f}, {0.4997528f, -0.9995023f, 0.4997528f, -1.9990045f, 0.9990114f}, {0.4997652f, -0.9995269f, 0.4997652f, -1.9990538f, 0.9990607f}, {0.4997766f, -0.9995498f, 0.4997766f, -1.9990996f, 0.9991065f}, {0.4997873f, -0.9995711f, 0.4997873f, -1.9991422f, 0.9991491f}, {0.4997972f, -0.999591f, 0.4997972f, -1.9991819f, 0.9991888f}, {0.4998065f, -0.9996095f, 0.4998065f, -1.999219f, 0.9992259f}, {0.4998151f, -0.9996268f, 0.4998151f, -1.9992537f, 0.9992605f}, {0.4998232f, -0.999643f, 0.4998232f, -1.9992861f, 0.9992929f}, {0.4998308f, -0.9996582f, 0.4998308f, -1.9993165f, 0.9993233f}, {0.499838f, -0.9996725f, 0.499838f, -1.999345f, 0.9993518f}, {0.4998448f, -0.9996862f, 0.4998448f, -1.9993724f, 0.9993793f}, {0.4998516f, -0.9996998f, 0.4998516f, -1.9993997f, 0.9994065f}, {0.4998584f, -0.9997133f, 0.4998584f, -1.9994267f, 0.9994335f}, {0.4998651f, -0.9997267f, 0.4998651f, -1.9994534f, 0.9994602f}, {0.4998716f, -0.9997398f, 0.4998716f, -1.9994797f, 0.9994865f}, {0.4998781f, -0.9997527f, 0.4998781f, -1.9995054f, 0.9995123f}, {0.4998844f, -0.9997653f, 0.4998844f, -1.9995306f, 0.9995375f}, {0.4998905f, -0.9997776f, 0.4998905f, -1.9995551f, 0.999562f}, {0.4998964f, -0.9997895f, 0.4998964f, -1.9995789f, 0.9995858f}, {0.4999022f, -0.999801f, 0.4999022f, -1.9996019f, 0.9996088f}, {0.4999077f, -0.999812f, 0.4999077f, -1.999624f, 0.9996309f}, {0.499913f, -0.9998226f, 0.499913f, -1.9996453f, 0.9996521f}, {0.4999181f, -0.9998328f, 0.4999181f, -1.9996656f, 0.9996724f}, {0.499923f, -0.9998425f, 0.499923f, -1.999685f, 0.9996918f}, {0.4999276f, -0.9998517f, 0.4999276f, -1.9997034f, 0.9997103f}, {0.4999319f, -0.9998605f, 0.4999319f, -1.9997209f, 0.9997278f}, {0.4999361f, -0.9998687f, 0.4999361f, -1.9997375f, 0.9997443f}, {0.49994f, -0.9998766f, 0.49994f, -1.9997531f, 0.99976f}, {0.4999437f, -0.999884f, 0.4999437f, -1.9997679f, 0.9997748f}},
-  {{0.497098f, -0.9941918f, 0.497098f, -1.9883836f, 0.9883921f}, {0.4971204f, -0.9942365f, 0.4971204f, -1.9884731f, 0.9884816f}, {0.4971855f, -0.9943667f, 0.4971855f, -1.9887333f, 0.9887418f}, {0.4972876f, -0.9945709f, 0.4972876f, -1.9891419f, 0.9891504f}, {0.4974187f, -0.9948332f, 0.4974187f, -1.9896664f, 0.989675f}, {0.4975698f, -0.9951354f, 0.4975698f, -1.9902707f, 0.9902792f}, {0.497732f, -0.9954598f, 0.497732f, -1.9909196f, 0.9909282f}, {0.4978979f, -0.9957915f, 0.4978979f, -1.991583f, 0.9915915f}, {0.4980614f, -0.9961186f, 0.4980614f, -1.9922373f, 0.9922458f}, {0.4982185f, -0.9964328f, 0.4982185f, -1.9928656f, 0.9928742f}, {0.4983665f, -0.9967287f, 0.4983665f, -1.9934574f, 0.993466f}, {0.4985038f, -0.9970034f, 0.4985038f, -1.9940068f, 0.9940153f}, {0.49863f, -0.9972557f, 0.49863f, -1.9945114f, 0.9945199f}, {0.498745f, -0.9974857f, 0.498745f, -1.9949715f, 0.99498f}, {0.4988493f, -0.9976944f, 0.4988493f, -1.9953888f, 0.9953973f}, {0.4989437f, -0.997883f, 0.4989437f, -1.9957661f, 0.9957746f}, {0.4990288f, -0.9980532f, 0.4990288f, -1.9961065f, 0.996115f}, {0.4991055f, -0.9982067f, 0.4991055f, -1.9964134f, 0.9964219f}, {0.4991746f, -0.998345f, 0.4991746f, -1.99669f, 0.9966985f}, {0.499237f, -0.9984697f, 0.499237f, -1.9969394f, 0.9969479f}, {0.4992933f, -0.9985822f, 0.4992933f, -1.9971645f, 0.997173f}, {0.4993441f, -0.9986839f, 0.4993441f, -1.9973679f, 0.9973764f}, {0.4993901f, -0.998776f, 0.4993901f, -1.997552f, 0.9975605f}, {0.4994319f, -0.9988594f, 0.4994319f, -1.9977189f, 0.9977274f}, {0.4994697f, -0.9989352f, 0.4994697f, -1.9978704f, 0.997879f}, {0.4995042f, -0.9990042f, 0.4995042f, -1.9980083f, 0.9980169f}, {0.4995356f, -0.999067f, 0.4995356f, -1.998134f, 0.9981425f}, {0.4995643f, -0.9991244f, 0.4995643f, -1.9982487f, 0.9982573f}, {0.4995906f, -0.9991769f, 0.4995906f, -1.9983538f, 0.9983623f}, {0.4996146f, -0.999225f, 0.4996146f, -1.99845f, 0.9984586f}, {0.4996367f, -0.9992692f, 0.4996367f, -1.9985384f, 0.998547f}, {0.4996571f, -0.9993099f, 0.4996571f, -1.9986197f, 0.9986283f}, {0.4996758f, -0.9993474f, 0.4996758f, -1.9986947f, 0.9987033f}, {0.4996931f, -0.999382f, 0.4996931f, -1.9987639f, 0.9987725f}, {0.4997091f, -0.999414f, 0.4997091f, -1.9988279f, 0.9988365f}, {0.4997239f, -0.9994436f, 0.4997239f, -1.9988872f, 0.9988958f}, {0.4997377f, -0.9994711f, 0.4997377f, -1.9989423f, 0.9989508f}, {0.4997505f, -0.9994967f, 0.4997505f, -1.9989934f, 0.999002f}, {0.4997624f, -0.9995205f, 0.4997624f, -1.999041f, 0.9990495f}, {0.4997735f, -0.9995427f, 0.4997735f, -1.9990854f, 0.9990939f}, {0.4997838f, -0.9995634f, 0.4997838f, -1.9991268f, 0.9991353f}, {0.4997935f, -0.9995827f, 0.4997935f, -1.9991655f, 0.999174f}, {0.4998026f, -0.9996008f, 0.4998026f, -1.9992017f, 0.9992102f}, {0.499811f, -0.9996178f, 0.499811f, -1.9992356f, 0.9992442f}, {0.499819f, -0.9996337f, 0.499819f, -1.9992675f, 0.999276f}, {0.4998267f, -0.999649f, 0.4998267f, -1.9992981f, 0.9993066f}, {0.4998343f, -0.9996643f, 0.4998343f, -1.9993285f, 0.9993371f}, {0.4998418f, -0.9996794f, 0.4998418f, -1.9993587f, 0.9993673f}, {0.4998493f, -0.9996943f, 0.4998493f, -1.9993885f, 0.9993971f}, {0.4998566f, -0.9997089f, 0.4998566f, -1.9994179f, 0.9994264f}, {0.4998638f, -0.9997233f, 0.4998638f, -1.9994467f, 0.9994552f}, {0.4998708f, -0.9997374f, 0.4998708f, -1.9994748f, 0.9994834f}, {0.4998777f, -0.9997511f, 0.4998777f, -1.9995022f, 0.9995108f}, {0.4998843f, -0.9997644f, 0.4998843f, -1.9995288f, 0.9995373f}, {0.4998907f, -0.9997772f, 0.4998907f, -1.9995544f, 0.999563f}, {0.4998969f, -0.9997896f, 0.4998969f, -1.9995792f, 0.9995877f}, {0.4999029f, -0.9998014f, 0.4999029f, -1.9996029f, 0.9996114f}, {0.4999085f, -0.9998128f, 0.4999085f, -1.9996256f, 0.9996341f}, {0.4999139f, -0.9998236f, 0.4999139f, -1.9996472f, 0.9996558f}, {0.4999191f, -0.9998339f, 0.4999191f, -1.9996678f, 0.9996764f}, {0.499924f, -0.9998437f, 0.499924f, -1.9996874f, 0.9996959f}, {0.4999286f, -0.9998529f, 0.4999286f, -1.9997059f, 0.9997144f}, {0.499933f, -0.9998617f, 0.499933f, -1.9997234f, 0.9997319f}, {0.4999371f, -0.9998699f, 0.4999371f, -1.9997398f, 0.9997484f}},
-  {{0.4967608f, -0.9935162f, 0.4967608f, -1.9870325f, 0.9870431f}, {0.4967857f, -0.9935661f, 0.4967857f, -1.9871322f, 0.9871429f}, {0.4968583f, -0.9937113f, 0.4968583f, -1.9874225f, 0.9874332f}, {0.4969722f, -0.9939392f, 0.4969722f, -1.9878783f, 0.9878889f}, {0.4971185f, -0.9942318f, 0.4971185f, -1.9884635f, 0.9884741f}, {0.4972871f, -0.9945688f, 0.4972871f, -1.9891377f, 0.9891483f}, {0.4974681f, -0.9949309f, 0.4974681f, -1.9898617f, 0.9898723f}, {0.4976531f, -0.995301f, 0.4976531f, -1.9906019f, 0.9906125f}, {0.4978357f, -0.995666f, 0.4978357f, -1.991332f, 0.9913426f}, {0.498011f, -0.9960166f, 0.498011f, -1.9920333f, 0.9920439f}, {0.4981761f, -0.9963469f, 0.4981761f, -1.9926938f, 0.9927044f}, {0.4983294f, -0.9966535f, 0.4983294f, -1.9933069f, 0.9933176f}, {0.4984702f, -0.9969351f, 0.4984702f, -1.9938702f, 0.9938808f}, {0.4985986f, -0.9971919f, 0.4985986f, -1.9943838f, 0.9943944f}, {0.4987151f, -0.9974248f, 0.4987151f, -1.9948496f, 0.9948603f}, {0.4988204f, -0.9976354f, 0.4988204f, -1.9952709f, 0.9952815f}, {0.4989154f, -0.9978255f, 0.4989154f, -1.9956509f, 0.9956616f}, {0.499001f, -0.9979968f, 0.499001f, -1.9959935f, 0.9960042f}, {0.4990783f, -0.9981512f, 0.4990783f, -1.9963023f, 0.996313f}, {0.4991479f, -0.9982904f, 0.4991479f, -1.9965808f, 0.9965915f}, {0.4992107f, -0.9984161f, 0.4992107f, -1.9968322f, 0.9968428f}, {0.4992675f, -0.9985297f, 0.4992675f, -1.9970593f, 0.99707f}, {0.4993189f, -0.9986324f, 0.4993189f, -1.9972649f, 0.9972756f}, {0.4993655f, -0.9987256f, 0.4993655f, -1.9974513f, 0.9974619f}, {0.4994078f, -0.9988102f, 0.4994078f, -1.9976205f, 0.9976312f}, {0.4994463f, -0.9988872f, 0.4994463f, -1.9977745f, 0.9977851f}, {0.4994814f, -0.9989574f, 0.4994814f, -1.9979148f, 0.9979255f}, {0.4995134f, -0.9990215f, 0.4995134f, -1.998043f, 0.9980536f}, {0.4995427f, -0.9990801f, 0.4995427f, -1.9981602f, 0.9981709f}, {0.4995696f, -0.9991339f, 0.4995696f, -1.9982677f, 0.9982784f}, {0.4995943f, -0.9991832f, 0.4995943f, -1.9983665f, 0.9983771f}, {0.499617f, -0.9992286f, 0.499617f, -1.9984573f, 0.998468f}, {0.4996379f, -0.9992705f, 0.4996379f, -1.998541f, 0.9985517f}, {0.4996572f, -0.9993092f, 0.4996572f, -1.9986183f, 0.998629f}, {0.4996751f, -0.9993449f, 0.4996751f, -1.9986898f, 0.9987005f}, {0.4996917f, -0.999378f, 0.4996917f, -1.998756f, 0.9987667f}, {0.499707f, -0.9994087f, 0.499707f, -1.9988175f, 0.9988282f}, {0.4997213f, -0.9994373f, 0.4997213f, -1.9988746f, 0.9988853f}, {0.4997346f, -0.9994639f, 0.4997346f, -1.9989277f, 0.9989384f}, {0.499747f, -0.9994886f, 0.499747f, -1.9989773f, 0.998988f}, {0.4997586f, -0.9995118f, 0.4997586f, -1.9990235f, 0.9990342f}, {0.4997694f, -0.9995334f, 0.4997694f, -1.9990668f, 0.9990774f}, {0.4997795f, -0.9995536f, 0.4997795f, -1.9991072f, 0.9991179f}, {0.4997889f, -0.9995726f, 0.4997889f, -1.9991451f, 0.9991558f}, {0.4997978f, -0.9995903f, 0.4997978f, -1.9991807f, 0.9991914f}, {0.4998064f, -0.9996074f, 0.4998064f, -1.9992149f, 0.9992256f}, {0.4998149f, -0.9996244f, 0.4998149f, -1.9992489f, 0.9992596f}, {0.4998233f, -0.9996413f, 0.4998233f, -1.9992826f, 0.9992933f}, {0.4998316f, -0.999658f, 0.4998316f, -1.9993159f, 0.9993266f}, {0.4998398f, -0.9996743f, 0.4998398f, -1.9993487f, 0.9993594f}, {0.4998479f, -0.9996904f, 0.4998479f, -1.9993809f, 0.9993915f}, {0.4998557f, -0.9997061f, 0.4998557f, -1.9994123f, 0.999423f}, {0.4998634f, -0.9997214f, 0.4998634f, -1.9994429f, 0.9994535f}, {0.4998708f, -0.9997363f, 0.4998708f, -1.9994725f, 0.9994832f}, {0.499878f, -0.9997506f, 0.499878f, -1.9995012f, 0.9995119f}, {0.4998849f, -0.9997644f, 0.4998849f, -1.9995288f, 0.9995395f}, {0.4998915f, -0.9997777f, 0.4998915f, -1.9995553f, 0.999566f}, {0.4998978f, -0.9997903f, 0.4998978f, -1.9995807f, 0.9995913f}, {0.4999039f, -0.9998024f, 0.4999039f, -1.9996048f, 0.9996155f}, {0.4999096f, -0.9998139f, 0.4999096f, -1.9996279f, 0.9996385f}, {0.4999151f, -0.9998248f, 0.4999151f, -1.9996497f, 0.9996604f}, {0.4999203f, -0.9998352f, 0.4999203f, -1.9996704f, 0.999681f}, {0.4999251f, -0.9998449f, 0.4999251f, -1.9996899f, 0.9997006f}, {0.4999297f, -0.9998541f, 0.4999297f, -1.9997083f, 0.999719f}},
-  {{0.4963847f, -0.9927628f, 0.4963847f, -1.9855256f, 0.9855388f}, {0.4964125f, -0.9928184f, 0.4964125f, -1.9856368f, 0.9856501f}, {0.4964935f, -0.9929803f, 0.4964935f, -1.9859606f, 0.9859738f}, {0.4966205f, -0.9932345f, 0.4966205f, -1.9864689f, 0.9864822f}, {0.4967837f, -0.9935608f, 0.4967837f, -1.9871217f, 0.9871349f}, {0.4969717f, -0.9939368f, 0.4969717f, -1.9878737f, 0.9878869f}, {0.4971737f, -0.9943407f, 0.4971737f, -1.9886814f, 0.9886946f}, {0.4973801f, -0.9947536f, 0.4973801f, -1.9895072f, 0.9895205f}, {0.4975838f, -0.9951609f, 0.4975838f, -1.9903218f, 0.9903351f}, {0.4977794f, -0.9955522f, 0.4977794f, -1.9911044f, 0.9911176f}, {0.4979637f, -0.9959207f, 0.4979637f, -1.9918414f, 0.9918547f}, {0.4981348f, -0.9962629f, 0.4981348f, -1.9925257f, 0.992539f}, {0.4982919f, -0.9965772f, 0.4982919f, -1.9931544f, 0.9931677f}, {0.4984352f, -0.9968638f, 0.4984352f, -1.9937276f, 0.9937409f}, {0.4985652f, -0.9971238f, 0.4985652f, -1.9942477f, 0.994261f}, {0.4986828f, -0.9973589f, 0.4986828f, -1.9947179f, 0.9947312f}, {0.4987889f, -0.9975711f, 0.4987889f, -1.9951421f, 0.9951554f}, {0.4988845f, -0.9977623f, 0.4988845f, -1.9955246f, 0.9955379f}, {0.4989707f, -0.9979347f, 0.4989707f, -1.9958694f, 0.9958827f}, {0.4990484f, -0.9980902f, 0.4990484f, -1.9961803f, 0.9961936f}, {0.4991186f, -0.9982305f, 0.4991186f, -1.996461f, 0.9964743f}, {0.499182f, -0.9983573f, 0.499182f, -1.9967146f, 0.9967279f}, {0.4992394f, -0.9984721f, 0.4992394f, -1.9969441f, 0.9969574f}, {0.4992914f, -0.9985761f, 0.4992914f, -1.9971522f, 0.9971655f}, {0.4993386f, -0.9986706f, 0.4993386f, -1.9973412f, 0.9973545f}, {0.4993816f, -0.9987566f, 0.4993816f, -1.9975131f, 0.9975264f}, {0.4994208f, -0.9988349f, 0.4994208f, -1.9976698f, 0.9976831f}, {0.4994566f, -0.9989065f, 0.4994566f, -1.997813f, 0.9978263f}, {0.4994893f, -0.998972f, 0.4994893f, -1.9979439f, 0.9979572f}, {0.4995193f, -0.999032f, 0.4995193f, -1.9980639f, 0.9980773f}, {0.4995469f, -0.9990871f, 0.4995469f, -1.9981742f, 0.9981875f}, {0.4995722f, -0.9991378f, 0.4995722f, -1.9982756f, 0.9982889f}, {0.4995956f, -0.9991846f, 0.4995956f, -1.9983691f, 0.9983824f}, {0.4996172f, -0.9992277f, 0.4996172f, -1.9984554f, 0.9984688f}, {0.4996372f, -0.9992676f, 0.4996372f, -1.9985353f, 0.9985486f}, {0.4996556f, -0.9993046f, 0.4996556f, -1.9986093f, 0.9986226f}, {0.4996728f, -0.9993389f, 0.4996728f, -1.9986779f, 0.9986912f}, {0.4996887f, -0.9993708f, 0.4996887f, -1.9987417f, 0.998755f}, {0.4997036f, -0.9994005f, 0.4997036f, -1.998801f, 0.9988143f}, {0.4997174f, -0.9994282f, 0.4997174f, -1.9988564f, 0.9988697f}, {0.4997303f, -0.999454f, 0.4997303f, -1.998908f, 0.9989213f}, {0.4997424f, -0.9994781f, 0.4997424f, -1.9989563f, 0.9989696f}, {0.4997537f, -0.9995007f, 0.4997537f, -1.9990015f, 0.9990148f}, {0.4997643f, -0.9995219f, 0.4997643f, -1.9990438f, 0.9990571f}, {0.4997742f, -0.9995418f, 0.4997742f, -1.9990835f, 0.9990968f}, {0.4997838f, -0.9995609f, 0.4997838f, -1.9991217f, 0.999135f}, {0.4997933f, -0.9995798f, 0.4997933f, -1.9991597f, 0.999173f}, {0.4998027f, -0.9995987f, 0.4998027f, -1.9991973f, 0.9992107f}, {0.499812f, -0.9996173f, 0.499812f, -1.9992345f, 0.9992479f}, {0.4998211f, -0.9996356f, 0.4998211f, -1.9992712f, 0.9992845f}, {0.4998301f, -0.9996535f, 0.4998301f, -1.9993071f, 0.9993204f}, {0.4998389f, -0.9996711f, 0.4998389f, -1.9993422f, 0.9993555f}, {0.4998474f, -0.9996882f, 0.4998474f, -1.9993763f, 0.9993897f}, {0.4998557f, -0.9997047f, 0.4998557f, -1.9994095f, 0.9994228f}, {0.4998637f, -0.9997207f, 0.4998637f, -1.9994415f, 0.9994548f}, {0.4998714f, -0.9997362f, 0.4998714f, -1.9994723f, 0.9994856f}, {0.4998788f, -0.999751f, 0.4998788f, -1.9995019f, 0.9995152f}, {0.4998859f, -0.9997651f, 0.4998859f, -1.9995302f, 0.9995436f}, {0.4998926f, -0.9997786f, 0.4998926f, -1.9995572f, 0.9995706f}, {0.4998991f, -0.9997915f, 0.4998991f, -1.9995829f, 0.9995963f}, {0.4999052f, -0.9998037f, 0.4999052f, -1.9996073f, 0.9996207f}, {0.4999109f, -0.9998152f, 0.4999109f, -1.9996304f, 0.9996437f}, {0.4999164f, -0.9998261f, 0.4999164f, -1.9996522f, 0.9996655f}, {0.4999215f, -0.9998364f, 0.4999215f, -1.9996728f, 0.9996861f}},
-  {{0.4959654f, -0.9919226f, 0.4959654f, -1.9838453f, 0.9838618f}, {0.4959965f, -0.9919847f, 0.4959965f, -1.9839693f, 0.9839858f}, {0.4960867f, -0.9921652f, 0.4960867f, -1.9843304f, 0.9843469f}, {0.4962284f, -0.9924486f, 0.4962284f, -1.9848972f, 0.9849137f}, {0.4964104f, -0.9928126f, 0.4964104f, -1.9856251f, 0.9856416f}, {0.4966201f, -0.9932319f, 0.4966201f, -1.9864638f, 0.9864804f}, {0.4968453f, -0.9936824f, 0.4968453f, -1.9873647f, 0.9873813f}, {0.4970756f, -0.994143f, 0.4970756f, -1.9882859f, 0.9883025f}, {0.4973028f, -0.9945974f, 0.4973028f, -1.9891947f, 0.9892113f}, {0.4975211f, -0.9950339f, 0.4975211f, -1.9900678f, 0.9900843f}, {0.4977267f, -0.9954451f, 0.4977267f, -1.9908902f, 0.9909068f}, {0.4979176f, -0.9958269f, 0.4979176f, -1.9916538f, 0.9916704f}, {0.498093f, -0.9961777f, 0.498093f, -1.9923554f, 0.9923719f}, {0.4982529f, -0.9964976f, 0.4982529f, -1.9929951f, 0.9930117f}, {0.498398f, -0.9967878f, 0.498398f, -1.9935756f, 0.9935922f}, {0.4985292f, -0.9970502f, 0.4985292f, -1.9941004f, 0.994117f}, {0.4986476f, -0.997287f, 0.4986476f, -1.994574f, 0.9945906f}, {0.4987544f, -0.9975005f, 0.4987544f, -1.995001f, 0.9950176f}, {0.4988506f, -0.9976929f, 0.4988506f, -1.9953859f, 0.9954025f}, {0.4989374f, -0.9978665f, 0.4989374f, -1.995733f, 0.9957496f}, {0.4990157f, -0.9980231f, 0.4990157f, -1.9960463f, 0.9960629f}, {0.4990865f, -0.9981647f, 0.4990865f, -1.9963294f, 0.996346f}, {0.4991506f, -0.9982929f, 0.4991506f, -1.9965857f, 0.9966023f}, {0.4992087f, -0.998409f, 0.4992087f, -1.9968181f, 0.9968347f}, {0.4992614f, -0.9985145f, 0.4992614f, -1.9970291f, 0.9970457f}, {0.4993094f, -0.9986105f, 0.4993094f, -1.997221f, 0.9972376f}, {0.4993532f, -0.998698f, 0.4993532f, -1.997396f, 0.9974126f}, {0.4993931f, -0.9987779f, 0.4993931f, -1.9975558f, 0.9975724f}, {0.4994297f, -0.998851f, 0.4994297f, -1.9977021f, 0.9977187f}, {0.4994632f, -0.998918f, 0.4994632f, -1.9978361f, 0.9978527f}, {0.499494f, -0.9989796f, 0.499494f, -1.9979592f, 0.9979758f}, {0.4995223f, -0.9990362f, 0.4995223f, -1.9980725f, 0.9980891f}, {0.4995484f, -0.9990884f, 0.4995484f, -1.9981769f, 0.9981935f}, {0.4995725f, -0.9991366f, 0.4995725f, -1.9982733f, 0.9982899f}, {0.4995948f, -0.9991812f, 0.4995948f, -1.9983624f, 0.9983791f}, {0.4996154f, -0.9992225f, 0.4996154f, -1.998445f, 0.9984617f}, {0.4996346f, -0.9992608f, 0.4996346f, -1.9985217f, 0.9985383f}, {0.4996524f, -0.9992965f, 0.4996524f, -1.9985929f, 0.9986095f}, {0.499669f, -0.9993296f, 0.499669f, -1.9986592f, 0.9986758f}, {0.4996844f, -0.9993605f, 0.4996844f, -1.998721f, 0.9987376f}, {0.4996988f, -0.9993893f, 0.4996988f, -1.9987787f, 0.9987953f}, {0.4997123f, -0.9994163f, 0.4997123f, -1.9988326f, 0.9988492f}, {0.4997249f, -0.9994415f, 0.4997249f, -1.998883f, 0.9988997f}, {0.4997367f, -0.9994652f, 0.4997367f, -1.9989303f, 0.9989469f}, {0.4997478f, -0.9994873f, 0.4997478f, -1.9989747f, 0.9989913f}, {0.4997585f, -0.9995087f, 0.4997585f, -1.9990173f, 0.999034f}, {0.4997691f, -0.9995299f, 0.4997691f, -1.9990597f, 0.9990764f}, {0.4997796f, -0.9995509f, 0.4997796f, -1.9991018f, 0.9991184f}, {0.49979f, -0.9995717f, 0.49979f, -1.9991433f, 0.99916f}, {0.4998002f, -0.9995921f, 0.4998002f, -1.9991842f, 0.9992009f}, {0.4998102f, -0.9996122f, 0.4998102f, -1.9992243f, 0.999241f}, {0.49982f, -0.9996318f, 0.49982f, -1.9992635f, 0.9992802f}, {0.4998296f, -0.9996508f, 0.4998296f, -1.9993017f, 0.9993183f}, {0.4998388f, -0.9996693f, 0.4998388f, -1.9993387f, 0.9993553f}, {0.4998478f, -0.9996872f, 0.4998478f, -1.9993745f, 0.9993911f}, {0.4998564f, -0.9997044f, 0.4998564f, -1.9994089f, 0.9994255f}, {0.4998646f, -0.999721f, 0.4998646f, -1.9994419f, 0.9994586f}, {0.4998726f, -0.9997368f, 0.4998726f, -1.9994736f, 0.9994902f}, {0.4998801f, -0.9997519f, 0.4998801f, -1.9995037f, 0.9995204f}, {0.4998873f, -0.9997662f, 0.4998873f, -1.9995324f, 0.9995491f}, {0.4998941f, -0.9997798f, 0.4998941f, -1.9995597f, 0.9995763f}, {0.4999005f, -0.9997927f, 0.4999005f, -1.9995855f, 0.9996021f}, {0.4999066f, -0.9998049f, 0.4999066f, -1.9996098f, 0.9996265f}, {0.4999124f, -0.9998164f, 0.4999124f, -1.9996328f, 0.9996494f}},
-  {{0.4954982f, -0.990986f, 0.4954982f, -1.9819721f, 0.9819927f}, {0.4955327f, -0.9910552f, 0.4955327f, -1.9821104f, 0.982131f}, {0.4956334f, -0.9912564f, 0.4956334f, -1.9825129f, 0.9825334f}, {0.4957914f, -0.9915724f, 0.4957914f, -1.9831448f, 0.9831654f}, {0.4959943f, -0.9919782f, 0.4959943f, -1.9839564f, 0.983977f}, {0.4962281f, -0.9924458f, 0.4962281f, -1.9848916f, 0.9849122f}, {0.4964792f, -0.9929481f, 0.4964792f, -1.9858963f, 0.9859169f}, {0.4967361f, -0.9934618f, 0.4967361f, -1.9869237f, 0.9869443f}, {0.4969895f, -0.9939687f, 0.4969895f, -1.9879373f, 0.987958f}, {0.497233f, -0.9944556f, 0.497233f, -1.9889112f, 0.9889319f}, {0.4974624f, -0.9949144f, 0.4974624f, -1.9898288f, 0.9898494f}, {0.4976754f, -0.9953404f, 0.4976754f, -1.9906807f, 0.9907014f}, {0.4978711f, -0.9957318f, 0.4978711f, -1.9914636f, 0.9914842f}, {0.4980495f, -0.9960887f, 0.4980495f, -1.9921775f, 0.9921982f}, {0.4982115f, -0.9964126f, 0.4982115f, -1.9928253f, 0.9928459f}, {0.4983579f, -0.9967055f, 0.4983579f, -1.993411f, 0.9934317f}, {0.4984901f, -0.9969698f, 0.4984901f, -1.9939396f, 0.9939603f}, {0.4986092f, -0.9972081f, 0.4986092f, -1.9944162f, 0.9944369f}, {0.4987166f, -0.9974229f, 0.4987166f, -1.9948458f, 0.9948665f}, {0.4988135f, -0.9976166f, 0.4988135f, -1.9952333f, 0.995254f}, {0.4989009f, -0.9977915f, 0.4989009f, -1.995583f, 0.9956038f}, {0.49898f, -0.9979496f, 0.49898f, -1.9958992f, 0.9959199f}, {0.4990515f, -0.9980926f, 0.4990515f, -1.9961853f, 0.996206f}, {0.4991163f, -0.9982223f, 0.4991163f, -1.9964447f, 0.9964654f}, {0.4991752f, -0.9983401f, 0.4991752f, -1.9966802f, 0.996701f}, {0.4992288f, -0.9984473f, 0.4992288f, -1.9968946f, 0.9969153f}, {0.4992777f, -0.998545f, 0.4992777f, -1.9970899f, 0.9971107f}, {0.4993223f, -0.9986342f, 0.4993223f, -1.9972684f, 0.9972891f}, {0.4993631f, -0.9987158f, 0.4993631f, -1.9974316f, 0.9974524f}, {0.4994005f, -0.9987907f, 0.4994005f, -1.9975813f, 0.9976021f}, {0.4994349f, -0.9988594f, 0.4994349f, -1.9977188f, 0.9977395f}, {0.4994665f, -0.9989226f, 0.4994665f, -1.9978453f, 0.997866f}, {0.4994956f, -0.9989809f, 0.4994956f, -1.9979618f, 0.9979826f}, {0.4995226f, -0.9990347f, 0.4995226f, -1.9980695f, 0.9980902f}, {0.4995474f, -0.9990845f, 0.4995474f, -1.998169f, 0.9981898f}, {0.4995705f, -0.9991306f, 0.4995705f, -1.9982613f, 0.998282f}, {0.4995919f, -0.9991734f, 0.4995919f, -1.9983469f, 0.9983676f}, {0.4996118f, -0.9992132f, 0.4996118f, -1.9984264f, 0.9984472f}, {0.4996303f, -0.9992502f, 0.4996303f, -1.9985004f, 0.9985212f}, {0.4996475f, -0.9992847f, 0.4996475f, -1.9985694f, 0.9985902f}, {0.4996636f, -0.9993169f, 0.4996636f, -1.9986338f, 0.9986546f}, {0.4996787f, -0.999347f, 0.4996787f, -1.998694f, 0.9987148f}, {0.4996928f, -0.9993752f, 0.4996928f, -1.9987504f, 0.9987711f}, {0.499706f, -0.9994016f, 0.499706f, -1.9988032f, 0.9988239f}, {0.4997184f, -0.9994264f, 0.4997184f, -1.9988527f, 0.9988735f}, {0.4997303f, -0.9994502f, 0.4997303f, -1.9989004f, 0.9989211f}, {0.4997421f, -0.9994739f, 0.4997421f, -1.9989477f, 0.9989685f}, {0.4997539f, -0.9994973f, 0.4997539f, -1.9989947f, 0.9990154f}, {0.4997655f, -0.9995205f, 0.4997655f, -1.9990411f, 0.9990618f}, {0.4997769f, -0.9995434f, 0.4997769f, -1.9990867f, 0.9991075f}, {0.4997881f, -0.9995658f, 0.4997881f, -1.9991315f, 0.9991523f}, {0.499799f, -0.9995877f, 0.499799f, -1.9991753f, 0.9991961f}, {0.4998097f, -0.999609f, 0.4998097f, -1.9992179f, 0.9992387f}, {0.49982f, -0.9996296f, 0.49982f, -1.9992593f, 0.99928f}, {0.49983f, -0.9996496f, 0.49983f, -1.9992992f, 0.99932f}, {0.4998396f, -0.9996688f, 0.4998396f, -1.9993377f, 0.9993584f}, {0.4998488f, -0.9996873f, 0.4998488f, -1.9993746f, 0.9993953f}, {0.4998577f, -0.9997049f, 0.4998577f, -1.9994099f, 0.9994306f}, {0.4998661f, -0.9997218f, 0.4998661f, -1.9994436f, 0.9994643f}, {0.4998741f, -0.9997378f, 0.4998741f, -1.9994756f, 0.9994964f}, {0.4998817f, -0.999753f, 0.4998817f, -1.999506f, 0.9995268f}, {0.4998889f, -0.9997674f, 0.4998889f, -1.9995348f, 0.9995556f}, {0.4998957f, -0.999781f, 0.4998957f, -1.999562f, 0.9995828f}, {0.4999021f, -0.9997938f, 0.4999021f, -1.9995877f, 0.9996085f}},
-  {{0.4949775f, -0.9899422f, 0.4949775f, -1.9798844f, 0.9799101f}, {0.4950161f, -0.9900193f, 0.4950161f, -1.9800386f, 0.9800642f}, {0.4951282f, -0.9902436f, 0.4951282f, -1.9804871f, 0.9805128f}, {0.4953043f, -0.9905957f, 0.4953043f, -1.9811915f, 0.9812171f}, {0.4955305f, -0.9910481f, 0.4955305f, -1.9820961f, 0.9821218f}, {0.4957911f, -0.9915694f, 0.4957911f, -1.9831387f, 0.9831644f}, {0.4960711f, -0.9921294f, 0.4960711f, -1.9842588f, 0.9842845f}, {0.4963575f, -0.9927022f, 0.4963575f, -1.9854044f, 0.9854302f}, {0.4966401f, -0.9932674f, 0.4966401f, -1.9865348f, 0.9865606f}, {0.4969117f, -0.9938105f, 0.4969117f, -1.9876211f, 0.9876468f}, {0.4971676f, -0.9943223f, 0.4971676f, -1.9886445f, 0.9886703f}, {0.4974052f, -0.9947975f, 0.4974052f, -1.9895949f, 0.9896207f}, {0.4976235f, -0.9952342f, 0.4976235f, -1.9904683f, 0.9904941f}, {0.4978227f, -0.9956324f, 0.4978227f, -1.9912649f, 0.9912907f}, {0.4980034f, -0.9959938f, 0.4980034f, -1.9919877f, 0.9920135f}, {0.4981668f, -0.9963207f, 0.4981668f, -1.9926413f, 0.9926672f}, {0.4983143f, -0.9966156f, 0.4983143f, -1.9932312f, 0.9932571f}, {0.4984472f, -0.9968816f, 0.4984472f, -1.9937632f, 0.993789f}, {0.4985671f, -0.9971213f, 0.4985671f, -1.9942427f, 0.9942685f}, {0.4986753f, -0.9973376f, 0.4986753f, -1.9946752f, 0.994701f}, {0.4987729f, -0.9975328f, 0.4987729f, -1.9950656f, 0.9950914f}, {0.4988611f, -0.9977092f, 0.4988611f, -1.9954184f, 0.9954443f}, {0.4989409f, -0.9978689f, 0.4989409f, -1.9957378f, 0.9957637f}, {0.4990133f, -0.9980137f, 0.4990133f, -1.9960274f, 0.9960533f}, {0.4990791f, -0.9981452f, 0.4990791f, -1.9962904f, 0.9963163f}, {0.4991389f, -0.9982648f, 0.4991389f, -1.9965297f, 0.9965555f}, {0.4991934f, -0.9983739f, 0.4991934f, -1.9967478f, 0.9967737f}, {0.4992432f, -0.9984735f, 0.4992432f, -1.996947f, 0.9969729f}, {0.4992888f, -0.9985646f, 0.4992888f, -1.9971293f, 0.9971552f}, {0.4993306f, -0.9986482f, 0.4993306f, -1.9972964f, 0.9973223f}, {0.4993689f, -0.9987249f, 0.4993689f, -1.9974499f, 0.9974758f}, {0.4994043f, -0.9987956f, 0.4994043f, -1.9975911f, 0.997617f}, {0.4994368f, -0.9988606f, 0.4994368f, -1.9977213f, 0.9977472f}, {0.4994668f, -0.9989207f, 0.4994668f, -1.9978415f, 0.9978674f}, {0.4994946f, -0.9989763f, 0.4994946f, -1.9979526f, 0.9979785f}, {0.4995204f, -0.9990278f, 0.4995204f, -1.9980556f, 0.9980815f}, {0.4995443f, -0.9990756f, 0.4995443f, -1.9981512f, 0.9981771f}, {0.4995665f, -0.99912f, 0.4995665f, -1.99824f, 0.9982659f}, {0.4995871f, -0.9991613f, 0.4995871f, -1.9983227f, 0.9983486f}, {0.4996064f, -0.9991999f, 0.4996064f, -1.9983997f, 0.9984256f}, {0.4996244f, -0.9992358f, 0.4996244f, -1.9984716f, 0.9984975f}, {0.4996412f, -0.9992694f, 0.4996412f, -1.9985389f, 0.9985648f}, {0.4996569f, -0.9993009f, 0.4996569f, -1.9986018f, 0.9986277f}, {0.4996717f, -0.9993304f, 0.4996717f, -1.9986607f, 0.9986866f}, {0.4996855f, -0.999358f, 0.4996855f, -1.9987161f, 0.998742f}, {0.4996988f, -0.9993846f, 0.4996988f, -1.9987693f, 0.9987952f}, {0.499712f, -0.9994111f, 0.499712f, -1.9988221f, 0.9988481f}, {0.4997251f, -0.9994373f, 0.4997251f, -1.9988746f, 0.9989005f}, {0.4997381f, -0.9994632f, 0.4997381f, -1.9989264f, 0.9989523f}, {0.4997508f, -0.9994887f, 0.4997508f, -1.9989774f, 0.9990033f}, {0.4997633f, -0.9995137f, 0.4997633f, -1.9990274f, 0.9990533f}, {0.4997755f, -0.9995381f, 0.4997755f, -1.9990763f, 0.9991022f}, {0.4997874f, -0.9995619f, 0.4997874f, -1.9991239f, 0.9991498f}, {0.499799f, -0.999585f, 0.499799f, -1.99917f, 0.9991959f}, {0.4998101f, -0.9996073f, 0.4998101f, -1.9992146f, 0.9992405f}, {0.4998209f, -0.9996288f, 0.4998209f, -1.9992576f, 0.9992835f}, {0.4998312f, -0.9996494f, 0.4998312f, -1.9992988f, 0.9993247f}, {0.499841f, -0.9996691f, 0.499841f, -1.9993382f, 0.9993642f}, {0.4998504f, -0.9996879f, 0.4998504f, -1.9993759f, 0.9994018f}, {0.4998594f, -0.9997058f, 0.4998594f, -1.9994117f, 0.9994376f}, {0.4998679f, -0.9997228f, 0.4998679f, -1.9994456f, 0.9994715f}, {0.4998759f, -0.9997389f, 0.4998759f, -1.9994778f, 0.9995037f}, {0.4998835f, -0.9997541f, 0.4998835f, -1.9995082f, 0.9995341f}, {0.4998907f, -0.9997684f, 0.4998907f, -1.9995368f, 0.9995627f}},
-  {{0.4943976f, -0.9887792f, 0.4943976f, -1.9775583f, 0.9775903f}, {0.4944405f, -0.988865f, 0.4944405f, -1.9777301f, 0.9777621f}, {0.4945655f, -0.9891149f, 0.4945655f, -1.9782298f, 0.9782619f}, {0.4947617f, -0.9895074f, 0.4947617f, -1.9790147f, 0.9790467f}, {0.4950137f, -0.9900114f, 0.4950137f, -1.9800229f, 0.9800549f}, {0.4953042f, -0.9905924f, 0.4953042f, -1.9811848f, 0.9812169f}, {0.4956164f, -0.9912167f, 0.4956164f, -1.9824334f, 0.9824654f}, {0.4959356f, -0.9918552f, 0.4959356f, -1.9837105f, 0.9837426f}, {0.4962507f, -0.9924854f, 0.4962507f, -1.9849708f, 0.985003f}, {0.4965536f, -0.993091f, 0.4965536f, -1.9861821f, 0.9862142f}, {0.4968389f, -0.9936617f, 0.4968389f, -1.9873234f, 0.9873556f}, {0.4971039f, -0.9941918f, 0.4971039f, -1.9883835f, 0.9884157f}, {0.4973475f, -0.9946789f, 0.4973475f, -1.9893577f, 0.9893899f}, {0.4975696f, -0.9951232f, 0.4975696f, -1.9902464f, 0.9902786f}, {0.4977713f, -0.9955264f, 0.4977713f, -1.9910528f, 0.991085f}, {0.4979536f, -0.9958911f, 0.4979536f, -1.9917821f, 0.9918144f}, {0.4981182f, -0.9962202f, 0.4981182f, -1.9924404f, 0.9924726f}, {0.4982666f, -0.996517f, 0.4982666f, -1.993034f, 0.9930662f}, {0.4984003f, -0.9967846f, 0.4984003f, -1.9935691f, 0.9936014f}, {0.498521f, -0.9970259f, 0.498521f, -1.9940518f, 0.994084f}, {0.4986299f, -0.9972438f, 0.4986299f, -1.9944875f, 0.9945198f}, {0.4987284f, -0.9974407f, 0.4987284f, -1.9948814f, 0.9949137f}, {0.4988175f, -0.9976189f, 0.4988175f, -1.9952379f, 0.9952702f}, {0.4988983f, -0.9977806f, 0.4988983f, -1.9955611f, 0.9955934f}, {0.4989717f, -0.9979273f, 0.4989717f, -1.9958547f, 0.995887f}, {0.4990385f, -0.9980609f, 0.4990385f, -1.9961218f, 0.9961541f}, {0.4990994f, -0.9981826f, 0.4990994f, -1.9963653f, 0.9963976f}, {0.499155f, -0.9982938f, 0.499155f, -1.9965877f, 0.99662f}, {0.4992059f, -0.9983956f, 0.4992059f, -1.9967912f, 0.9968235f}, {0.4992525f, -0.9984889f, 0.4992525f, -1.9969778f, 0.9970101f}, {0.4992954f, -0.9985746f, 0.4992954f, -1.9971491f, 0.9971814f}, {0.4993348f, -0.9986534f, 0.4993348f, -1.9973068f, 0.9973391f}, {0.4993711f, -0.9987261f, 0.4993711f, -1.9974521f, 0.9974844f}, {0.4994047f, -0.9987931f, 0.4994047f, -1.9975863f, 0.9976186f}, {0.4994357f, -0.9988552f, 0.4994357f, -1.9977104f, 0.9977427f}, {0.4994644f, -0.9989127f, 0.4994644f, -1.9978254f, 0.9978577f}, {0.4994911f, -0.998966f, 0.4994911f, -1.9979321f, 0.9979644f}, {0.4995159f, -0.9990156f, 0.4995159f, -1.9980313f, 0.9980636f}, {0.499539f, -0.9990618f, 0.499539f, -1.9981236f, 0.9981559f}, {0.4995605f, -0.9991048f, 0.4995605f, -1.9982096f, 0.9982419f}, {0.4995806f, -0.9991449f, 0.4995806f, -1.9982899f, 0.9983222f}, {0.4995993f, -0.9991825f, 0.4995993f, -1.998365f, 0.9983973f}, {0.4996169f, -0.9992176f, 0.4996169f, -1.9984352f, 0.9984675f}, {0.4996333f, -0.9992505f, 0.4996333f, -1.998501f, 0.9985334f}, {0.4996488f, -0.9992814f, 0.4996488f, -1.9985628f, 0.9985952f}, {0.4996636f, -0.9993111f, 0.4996636f, -1.9986222f, 0.9986546f}, {0.4996784f, -0.9993406f, 0.4996784f, -1.9986813f, 0.9987136f}, {0.499693f, -0.9993699f, 0.499693f, -1.9987398f, 0.9987722f}, {0.4997075f, -0.9993988f, 0.4997075f, -1.9987977f, 0.99883f}, {0.4997217f, -0.9994273f, 0.4997217f, -1.9988546f, 0.998887f}, {0.4997357f, -0.9994552f, 0.4997357f, -1.9989105f, 0.9989428f}, {0.4997494f, -0.9994825f, 0.4997494f, -1.9989651f, 0.9989974f}, {0.4997626f, -0.9995091f, 0.4997626f, -1.9990182f, 0.9990505f}, {0.4997755f, -0.9995349f, 0.4997755f, -1.9990697f, 0.9991021f}, {0.499788f, -0.9995598f, 0.499788f, -1.9991195f, 0.9991519f}, {0.4998f, -0.9995837f, 0.4998f, -1.9991675f, 0.9991998f}, {0.4998115f, -0.9996068f, 0.4998115f, -1.9992135f, 0.9992459f}, {0.4998225f, -0.9996288f, 0.4998225f, -1.9992576f, 0.9992899f}, {0.499833f, -0.9996498f, 0.499833f, -1.9992996f, 0.9993319f}, {0.499843f, -0.9996698f, 0.499843f, -1.9993396f, 0.9993719f}, {0.4998525f, -0.9996887f, 0.4998525f, -1.9993775f, 0.9994098f}, {0.4998614f, -0.9997067f, 0.4998614f, -1.9994134f, 0.9994458f}, {0.4998699f, -0.9997237f, 0.4998699f, -1.9994473f, 0.9994797f}, {0.4998779f, -0.9997397f, 0.4998779f, -1.9994793f, 0.9995117f}},
-  {{0.4937518f, -0.9874837f, 0.4937518f, -1.9749674f, 0.9750073f}, {0.4937997f, -0.9875794f, 0.4937997f, -1.9751587f, 0.9751986f}, {0.4939388f, -0.9878577f, 0.4939388f, -1.9757154f, 0.9757553f}, {0.4941574f, -0.9882948f, 0.4941574f, -1.9765897f, 0.9766296f}, {0.4944382f, -0.9888564f, 0.4944382f, -1.9777128f, 0.9777528f}, {0.4947619f, -0.9895037f, 0.4947619f, -1.9790075f, 0.9790475f}, {0.4951097f, -0.9901994f, 0.4951097f, -1.9803988f, 0.9804388f}, {0.4954655f, -0.9909111f, 0.4954655f, -1.9818222f, 0.9818622f}, {0.4958168f, -0.9916135f, 0.4958168f, -1.9832271f, 0.9832671f}, {0.4961544f, -0.9922887f, 0.4961544f, -1.9845774f, 0.9846175f}, {0.4964725f, -0.992925f, 0.4964725f, -1.98585f, 0.9858901f}, {0.4967681f, -0.9935161f, 0.4967681f, -1.9870322f, 0.9870723f}, {0.4970397f, -0.9940593f, 0.4970397f, -1.9881187f, 0.9881588f}, {0.4972875f, -0.9945549f, 0.4972875f, -1.9891099f, 0.9891501f}, {0.4975124f, -0.9950047f, 0.4975124f, -1.9900094f, 0.9900496f}, {0.4977158f, -0.9954115f, 0.4977158f, -1.9908231f, 0.9908633f}, {0.4978994f, -0.9957787f, 0.4978994f, -1.9915575f, 0.9915977f}, {0.498065f, -0.9961099f, 0.498065f, -1.9922198f, 0.99226f}, {0.4982143f, -0.9964085f, 0.4982143f, -1.9928169f, 0.9928572f}, {0.498349f, -0.9966778f, 0.498349f, -1.9933555f, 0.9933958f}, {0.4984705f, -0.9969209f, 0.4984705f, -1.9938418f, 0.9938821f}, {0.4985804f, -0.9971407f, 0.4985804f, -1.9942814f, 0.9943217f}, {0.4986799f, -0.9973396f, 0.4986799f, -1.9946793f, 0.9947195f}, {0.4987701f, -0.99752f, 0.4987701f, -1.99504f, 0.9950803f}, {0.498852f, -0.9976838f, 0.498852f, -1.9953677f, 0.995408f}, {0.4989265f, -0.9978329f, 0.4989265f, -1.9956658f, 0.9957062f}, {0.4989945f, -0.9979688f, 0.4989945f, -1.9959377f, 0.995978f}, {0.4990566f, -0.998093f, 0.4990566f, -1.9961859f, 0.9962262f}, {0.4991133f, -0.9982065f, 0.4991133f, -1.9964131f, 0.9964534f}, {0.4991654f, -0.9983107f, 0.4991654f, -1.9966213f, 0.9966617f}, {0.4992132f, -0.9984063f, 0.4992132f, -1.9968126f, 0.996853f}, {0.4992572f, -0.9984943f, 0.4992572f, -1.9969886f, 0.997029f}, {0.4992978f, -0.9985754f, 0.4992978f, -1.9971509f, 0.9971912f}, {0.4993353f, -0.9986503f, 0.4993353f, -1.9973007f, 0.997341f}, {0.4993699f, -0.9987196f, 0.4993699f, -1.9974393f, 0.9974796f}, {0.499402f, -0.9987838f, 0.499402f, -1.9975676f, 0.997608f}, {0.4994318f, -0.9988434f, 0.4994318f, -1.9976868f, 0.9977271f}, {0.4994595f, -0.9988987f, 0.4994595f, -1.9977975f, 0.9978378f}, {0.4994852f, -0.9989503f, 0.4994852f, -1.9979005f, 0.9979409f}, {0.4995092f, -0.9989983f, 0.4995092f, -1.9979966f, 0.9980369f}, {0.4995316f, -0.9990431f, 0.4995316f, -1.9980862f, 0.9981266f}, {0.4995526f, -0.999085f, 0.4995526f, -1.99817f, 0.9982104f}, {0.4995722f, -0.9991242f, 0.4995722f, -1.9982485f, 0.9982888f}, {0.4995906f, -0.999161f, 0.4995906f, -1.998322f, 0.9983623f}, {0.4996078f, -0.9991955f, 0.4996078f, -1.9983909f, 0.9984313f}, {0.4996244f, -0.9992286f, 0.4996244f, -1.9984573f, 0.9984976f}, {0.4996409f, -0.9992616f, 0.4996409f, -1.9985232f, 0.9985636f}, {0.4996572f, -0.9992943f, 0.4996572f, -1.9985886f, 0.9986289f}, {0.4996734f, -0.9993266f, 0.4996734f, -1.9986532f, 0.9986935f}, {0.4996893f, -0.9993584f, 0.4996893f, -1.9987168f, 0.9987571f}, {0.4997049f, -0.9993896f, 0.4997049f, -1.9987791f, 0.9988195f}, {0.4997201f, -0.99942f, 0.4997201f, -1.9988401f, 0.9988804f}, {0.4997349f, -0.9994497f, 0.4997349f, -1.9988994f, 0.9989398f}, {0.4997493f, -0.9994785f, 0.4997493f, -1.998957f, 0.9989973f}, {0.4997632f, -0.9995063f, 0.4997632f, -1.9990126f, 0.9990529f}, {0.4997766f, -0.9995331f, 0.4997766f, -1.9990661f, 0.9991065f}, {0.4997895f, -0.9995588f, 0.4997895f, -1.9991175f, 0.9991579f}, {0.4998018f, -0.9995833f, 0.4998018f, -1.9991667f, 0.9992071f}, {0.4998135f, -0.9996068f, 0.4998135f, -1.9992136f, 0.999254f}, {0.4998247f, -0.9996291f, 0.4998247f, -1.9992582f, 0.9992986f}, {0.4998352f, -0.9996503f, 0.4998352f, -1.9993006f, 0.999341f}, {0.4998453f, -0.9996704f, 0.4998453f, -1.9993407f, 0.9993811f}, {0.4998547f, -0.9996893f, 0.4998547f, -1.9993786f, 0.999419f}, {0.4998637f, -0.9997072f, 0.4998637f, -1.9994143f, 0.9994547f}},
-  {{0.4930331f, -0.9860413f, 0.4930331f, -1.9720826f, 0.9721323f}, {0.4930863f, -0.9861478f, 0.4930863f, -1.9722956f, 0.9723453f}, {0.4932413f, -0.9864577f, 0.4932413f, -1.9729154f, 0.9729651f}, {0.4934847f, -0.9869445f, 0.4934847f, -1.973889f, 0.9739387f}, {0.4937974f, -0.9875699f, 0.4937974f, -1.9751398f, 0.9751896f}, {0.4941579f, -0.9882909f, 0.4941579f, -1.9765818f, 0.9766317f}, {0.4945454f, -0.9890659f, 0.4945454f, -1.9781318f, 0.9781817f}, {0.4949419f, -0.9898589f, 0.4949419f, -1.9797177f, 0.9797676f}, {0.4953333f, -0.9906417f, 0.4953333f, -1.9812833f, 0.9813333f}, {0.4957096f, -0.9913942f, 0.4957096f, -1.9827884f, 0.9828384f}, {0.4960643f, -0.9921035f, 0.4960643f, -1.984207f, 0.984257f}, {0.4963938f, -0.9927625f, 0.4963938f, -1.985525f, 0.985575f}, {0.4966966f, -0.9933682f, 0.4966966f, -1.9867365f, 0.9867866f}, {0.496973f, -0.9939209f, 0.496973f, -1.9878418f, 0.987892f}, {0.4972238f, -0.9944226f, 0.4972238f, -1.9888451f, 0.9888953f}, {0.4974507f, -0.9948763f, 0.4974507f, -1.9897526f, 0.9898028f}, {0.4976555f, -0.995286f, 0.4976555f, -1.9905719f, 0.9906221f}, {0.4978402f, -0.9956554f, 0.4978402f, -1.9913108f, 0.991361f}, {0.4980068f, -0.9959885f, 0.4980068f, -1.991977f, 0.9920272f}, {0.4981571f, -0.996289f, 0.4981571f, -1.992578f, 0.9926282f}, {0.4982927f, -0.9965603f, 0.4982927f, -1.9931206f, 0.9931708f}, {0.4984153f, -0.9968055f, 0.4984153f, -1.9936111f, 0.9936613f}, {0.4985263f, -0.9970275f, 0.4985263f, -1.9940551f, 0.9941053f}, {0.498627f, -0.9972288f, 0.498627f, -1.9944577f, 0.994508f}, {0.4987184f, -0.9974117f, 0.4987184f, -1.9948234f, 0.9948737f}, {0.4988016f, -0.9975781f, 0.4988016f, -1.9951561f, 0.9952064f}, {0.4988775f, -0.9977297f, 0.4988775f, -1.9954595f, 0.9955098f}, {0.4989467f, -0.9978683f, 0.4989467f, -1.9957366f, 0.9957869f}, {0.4990101f, -0.9979951f, 0.4990101f, -1.9959901f, 0.9960405f}, {0.4990682f, -0.9981113f, 0.4990682f, -1.9962226f, 0.9962729f}, {0.4991216f, -0.9982181f, 0.4991216f, -1.9964361f, 0.9964865f}, {0.4991707f, -0.9983163f, 0.4991707f, -1.9966326f, 0.9966829f}, {0.499216f, -0.9984069f, 0.499216f, -1.9968137f, 0.9968641f}, {0.4992578f, -0.9984905f, 0.4992578f, -1.9969809f, 0.9970313f}, {0.4992965f, -0.9985678f, 0.4992965f, -1.9971356f, 0.997186f}, {0.4993323f, -0.9986395f, 0.4993323f, -1.9972789f, 0.9973293f}, {0.4993656f, -0.998706f, 0.4993656f, -1.9974119f, 0.9974623f}, {0.4993965f, -0.9987678f, 0.4993965f, -1.9975355f, 0.9975859f}, {0.4994252f, -0.9988253f, 0.4994252f, -1.9976506f, 0.9977009f}, {0.499452f, -0.9988789f, 0.499452f, -1.9977578f, 0.9978082f}, {0.4994771f, -0.9989289f, 0.4994771f, -1.9978579f, 0.9979083f}, {0.4995005f, -0.9989757f, 0.4995005f, -1.9979514f, 0.9980018f}, {0.4995223f, -0.9990195f, 0.4995223f, -1.998039f, 0.9980894f}, {0.4995429f, -0.9990605f, 0.4995429f, -1.9981211f, 0.9981715f}, {0.4995621f, -0.999099f, 0.4995621f, -1.9981981f, 0.9982485f}, {0.4995806f, -0.9991361f, 0.4995806f, -1.9982721f, 0.9983225f}, {0.499599f, -0.9991729f, 0.499599f, -1.9983458f, 0.9983961f}, {0.4996173f, -0.9992094f, 0.4996173f, -1.9984187f, 0.9984691f}, {0.4996353f, -0.9992454f, 0.4996353f, -1.9984908f, 0.9985412f}, {0.4996531f, -0.9992809f, 0.4996531f, -1.9985618f, 0.9986122f}, {0.4996705f, -0.9993157f, 0.4996705f, -1.9986315f, 0.9986819f}, {0.4996875f, -0.9993498f, 0.4996875f, -1.9986995f, 0.9987499f}, {0.499704f, -0.9993829f, 0.499704f, -1.9987658f, 0.9988162f}, {0.4997201f, -0.999415f, 0.4997201f, -1.99883f, 0.9988804f}, {0.4997356f, -0.9994461f, 0.4997356f, -1.9988921f, 0.9989425f}, {0.4997506f, -0.999476f, 0.4997506f, -1.9989519f, 0.9990023f}, {0.4997649f, -0.9995047f, 0.4997649f, -1.9990093f, 0.9990597f}, {0.4997787f, -0.9995321f, 0.4997787f, -1.9990642f, 0.9991146f}, {0.4997917f, -0.9995583f, 0.4997917f, -1.9991166f, 0.999167f}, {0.4998042f, -0.9995832f, 0.4998042f, -1.9991664f, 0.9992168f}, {0.499816f, -0.9996069f, 0.499816f, -1.9992137f, 0.9992641f}, {0.4998272f, -0.9996292f, 0.4998272f, -1.9992585f, 0.9993089f}, {0.4998378f, -0.9996504f, 0.4998378f, -1.9993008f, 0.9993512f}, {0.4998478f, -0.9996703f, 0.4998478f, -1.9993407f, 0.9993911f}},
-  {{0.4922334f, -0.9844358f, 0.4922334f, -1.9688717f, 0.9689336f}, {0.4922927f, -0.9845544f, 0.4922927f, -1.9691087f, 0.9691707f}, {0.4924652f, -0.9848993f, 0.4924652f, -1.9697986f, 0.9698606f}, {0.4927361f, -0.9854412f, 0.4927361f, -1.9708823f, 0.9709444f}, {0.4930842f, -0.9861374f, 0.4930842f, -1.9722749f, 0.9723369f}, {0.4934857f, -0.9869403f, 0.4934857f, -1.9738805f, 0.9739426f}, {0.4939172f, -0.9878033f, 0.4939172f, -1.9756066f, 0.9756688f}, {0.4943588f, -0.9886866f, 0.4943588f, -1.9773731f, 0.9774353f}, {0.4947949f, -0.9895586f, 0.4947949f, -1.9791173f, 0.9791796f}, {0.4952142f, -0.9903971f, 0.4952142f, -1.9807943f, 0.9808566f}, {0.4956094f, -0.9911876f, 0.4956094f, -1.9823753f, 0.9824377f}, {0.4959767f, -0.9919221f, 0.4959767f, -1.9838443f, 0.9839067f}, {0.4963143f, -0.9925974f, 0.4963143f, -1.9851949f, 0.9852574f}, {0.4966225f, -0.9932136f, 0.4966225f, -1.9864273f, 0.9864898f}, {0.4969021f, -0.993773f, 0.4969021f, -1.987546f, 0.9876086f}, {0.4971552f, -0.994279f, 0.4971552f, -1.9885581f, 0.9886207f}, {0.4973836f, -0.9947359f, 0.4973836f, -1.9894718f, 0.9895344f}, {0.4975896f, -0.995148f, 0.4975896f, -1.990296f, 0.9903586f}, {0.4977754f, -0.9955196f, 0.4977754f, -1.9910391f, 0.9911018f}, {0.4979431f, -0.9958548f, 0.4979431f, -1.9917096f, 0.9917722f}, {0.4980944f, -0.9961575f, 0.4980944f, -1.9923149f, 0.9923776f}, {0.4982312f, -0.9964311f, 0.4982312f, -1.9928622f, 0.9929249f}, {0.4983551f, -0.9966788f, 0.4983551f, -1.9933576f, 0.9934203f}, {0.4984674f, -0.9969034f, 0.4984674f, -1.9938069f, 0.9938696f}, {0.4985694f, -0.9971075f, 0.4985694f, -1.9942149f, 0.9942777f}, {0.4986623f, -0.9972931f, 0.4986623f, -1.9945863f, 0.994649f}, {0.4987469f, -0.9974624f, 0.4987469f, -1.9949248f, 0.9949876f}, {0.4988242f, -0.997617f, 0.4988242f, -1.9952341f, 0.9952968f}, {0.498895f, -0.9977585f, 0.498895f, -1.995517f, 0.9955798f}, {0.4989598f, -0.9978882f, 0.4989598f, -1.9957765f, 0.9958393f}, {0.4990194f, -0.9980074f, 0.4990194f, -1.9960148f, 0.9960776f}, {0.4990742f, -0.998117f, 0.4990742f, -1.9962341f, 0.9962969f}, {0.4991248f, -0.9982181f, 0.4991248f, -1.9964362f, 0.9964991f}, {0.4991714f, -0.9983115f, 0.4991714f, -1.9966229f, 0.9966857f}, {0.4992146f, -0.9983978f, 0.4992146f, -1.9967956f, 0.9968584f}, {0.4992546f, -0.9984778f, 0.4992546f, -1.9969555f, 0.9970184f}, {0.4992917f, -0.998552f, 0.4992917f, -1.997104f, 0.9971668f}, {0.4993262f, -0.998621f, 0.4993262f, -1.9972419f, 0.9973048f}, {0.4993583f, -0.9986852f, 0.4993583f, -1.9973704f, 0.9974332f}, {0.4993882f, -0.998745f, 0.4993882f, -1.9974901f, 0.9975529f}, {0.4994162f, -0.9988009f, 0.4994162f, -1.9976018f, 0.9976647f}, {0.4994423f, -0.9988531f, 0.4994423f, -1.9977062f, 0.9977691f}, {0.4994667f, -0.998902f, 0.4994667f, -1.997804f, 0.9978669f}, {0.4994896f, -0.9989478f, 0.4994896f, -1.9978956f, 0.9979585f}, {0.4995111f, -0.9989908f, 0.4995111f, -1.9979816f, 0.9980445f}, {0.4995318f, -0.9990321f, 0.4995318f, -1.9980642f, 0.9981271f}, {0.4995523f, -0.9990732f, 0.4995523f, -1.9981464f, 0.9982093f}, {0.4995727f, -0.999114f, 0.4995727f, -1.9982279f, 0.9982908f}, {0.4995928f, -0.9991542f, 0.4995928f, -1.9983084f, 0.9983713f}, {0.4996126f, -0.9991938f, 0.4996126f, -1.9983877f, 0.9984506f}, {0.4996321f, -0.9992327f, 0.4996321f, -1.9984654f, 0.9985283f}, {0.4996511f, -0.9992707f, 0.4996511f, -1.9985414f, 0.9986043f}, {0.4996696f, -0.9993077f, 0.4996696f, -1.9986153f, 0.9986782f}, {0.4996875f, -0.9993435f, 0.4996875f, -1.9986871f, 0.99875f}, {0.4997048f, -0.9993782f, 0.4997048f, -1.9987564f, 0.9988193f}, {0.4997215f, -0.9994116f, 0.4997215f, -1.9988231f, 0.9988861f}, {0.4997375f, -0.9994436f, 0.4997375f, -1.9988872f, 0.9989501f}, {0.4997529f, -0.9994743f, 0.4997529f, -1.9989485f, 0.9990114f}, {0.4997675f, -0.9995035f, 0.4997675f, -1.999007f, 0.9990699f}, {0.4997814f, -0.9995313f, 0.4997814f, -1.9990627f, 0.9991256f}, {0.4997946f, -0.9995577f, 0.4997946f, -1.9991155f, 0.9991784f}, {0.4998071f, -0.9995827f, 0.4998071f, -1.9991654f, 0.9992284f}, {0.4998189f, -0.9996063f, 0.4998189f, -1.9992127f, 0.9992756f}, {0.49983f, -0.9996286f, 0.49983f, -1.9992572f, 0.9993201f}},
-  {{0.4913442f, -0.9826497f, 0.4913442f, -1.9652994f, 0.9653766f}, {0.4914101f, -0.9827816f, 0.4914101f, -1.9655631f, 0.9656403f}, {0.491602f, -0.9831653f, 0.491602f, -1.9663307f, 0.9664079f}, {0.4919034f, -0.9837682f, 0.4919034f, -1.9675365f, 0.9676138f}, {0.4922909f, -0.9845431f, 0.4922909f, -1.9690861f, 0.9691635f}, {0.4927377f, -0.9854366f, 0.4927377f, -1.9708732f, 0.9709507f}, {0.4932181f, -0.9863974f, 0.4932181f, -1.9727948f, 0.9728723f}, {0.4937098f, -0.9873809f, 0.4937098f, -1.9747617f, 0.9748393f}, {0.4941955f, -0.9883521f, 0.4941955f, -1.9767042f, 0.9767818f}, {0.4946625f, -0.9892861f, 0.4946625f, -1.9785722f, 0.9786499f}, {0.4951029f, -0.9901668f, 0.4951029f, -1.9803336f, 0.9804114f}, {0.4955121f, -0.9909853f, 0.4955121f, -1.9819706f, 0.9820484f}, {0.4958884f, -0.9917379f, 0.4958884f, -1.9834758f, 0.9835537f}, {0.4962319f, -0.9924248f, 0.4962319f, -1.9848496f, 0.9849275f}, {0.4965437f, -0.9930484f, 0.4965437f, -1.9860967f, 0.9861748f}, {0.4968258f, -0.9936126f, 0.4968258f, -1.9872252f, 0.9873032f}, {0.4970805f, -0.994122f, 0.4970805f, -1.9882441f, 0.9883222f}, {0.4973103f, -0.9945816f, 0.4973103f, -1.9891631f, 0.9892413f}, {0.4975175f, -0.994996f, 0.4975175f, -1.989992f, 0.9900702f}, {0.4977045f, -0.9953699f, 0.4977045f, -1.9907398f, 0.990818f}, {0.4978733f, -0.9957075f, 0.4978733f, -1.9914151f, 0.9914933f}, {0.4980259f, -0.9960128f, 0.4980259f, -1.9920255f, 0.9921038f}, {0.4981641f, -0.9962891f, 0.4981641f, -1.9925783f, 0.9926565f}, {0.4982894f, -0.9965397f, 0.4982894f, -1.9930795f, 0.9931578f}, {0.4984033f, -0.9967674f, 0.4984033f, -1.9935348f, 0.9936131f}, {0.4985069f, -0.9969746f, 0.4985069f, -1.9939491f, 0.9940274f}, {0.4986013f, -0.9971634f, 0.4986013f, -1.9943269f, 0.9944052f}, {0.4986876f, -0.997336f, 0.4986876f, -1.9946719f, 0.9947503f}, {0.4987665f, -0.9974939f, 0.4987665f, -1.9949877f, 0.9950661f}, {0.4988389f, -0.9976386f, 0.4988389f, -1.9952773f, 0.9953556f}, {0.4989054f, -0.9977716f, 0.4989054f, -1.9955432f, 0.9956216f}, {0.4989666f, -0.997894f, 0.4989666f, -1.9957879f, 0.9958663f}, {0.499023f, -0.9980068f, 0.499023f, -1.9960135f, 0.996092f}, {0.4990751f, -0.9981109f, 0.4990751f, -1.9962219f, 0.9963003f}, {0.4991233f, -0.9982073f, 0.4991233f, -1.9964146f, 0.996493f}, {0.4991679f, -0.9982966f, 0.4991679f, -1.9965931f, 0.9966716f}, {0.4992093f, -0.9983794f, 0.4992093f, -1.9967588f, 0.9968372f}, {0.4992478f, -0.9984564f, 0.4992478f, -1.9969128f, 0.9969912f}, {0.4992836f, -0.9985281f, 0.4992836f, -1.9970561f, 0.9971346f}, {0.499317f, -0.9985949f, 0.499317f, -1.9971897f, 0.9972682f}, {0.4993482f, -0.9986572f, 0.4993482f, -1.9973145f, 0.9973929f}, {0.4993774f, -0.9987155f, 0.4993774f, -1.997431f, 0.9975095f}, {0.4994047f, -0.9987701f, 0.4994047f, -1.9975402f, 0.9976186f}, {0.4994302f, -0.9988212f, 0.4994302f, -1.9976424f, 0.9977209f}, {0.4994542f, -0.9988692f, 0.4994542f, -1.9977384f, 0.9978169f}, {0.4994773f, -0.9989153f, 0.4994773f, -1.9978307f, 0.9979091f}, {0.4995002f, -0.9989612f, 0.4995002f, -1.9979224f, 0.9980009f}, {0.499523f, -0.9990067f, 0.499523f, -1.9980133f, 0.9980918f}, {0.4995454f, -0.9990516f, 0.4995454f, -1.9981032f, 0.9981817f}, {0.4995675f, -0.9990958f, 0.4995675f, -1.9981917f, 0.9982702f}, {0.4995892f, -0.9991392f, 0.4995892f, -1.9982785f, 0.998357f}, {0.4996104f, -0.9991816f, 0.4996104f, -1.9983633f, 0.9984418f}, {0.4996311f, -0.9992229f, 0.4996311f, -1.9984458f, 0.9985243f}, {0.4996511f, -0.999263f, 0.4996511f, -1.9985259f, 0.9986044f}, {0.4996705f, -0.9993017f, 0.4996705f, -1.9986033f, 0.9986818f}, {0.4996891f, -0.9993389f, 0.4996891f, -1.9986778f, 0.9987563f}, {0.499707f, -0.9993747f, 0.499707f, -1.9987494f, 0.9988279f}, {0.4997241f, -0.9994089f, 0.4997241f, -1.9988178f, 0.9988963f}, {0.4997404f, -0.9994415f, 0.4997404f, -1.9988831f, 0.9989616f}, {0.4997559f, -0.9994726f, 0.4997559f, -1.9989452f, 0.9990237f}, {0.4997707f, -0.9995021f, 0.4997707f, -1.9990042f, 0.9990827f}, {0.4997846f, -0.99953f, 0.4997846f, -1.99906f, 0.9991385f}, {0.4997978f, -0.9995563f, 0.4997978f, -1.9991127f, 0.9991912f}, {0.4998102f, -0.9995812f, 0.4998102f, -1.9991624f, 0.9992409f}},
-  {{0.4903558f, -0.9806635f, 0.4903558f, -1.961327f, 0.9614232f}, {0.4904291f, -0.9808101f, 0.4904291f, -1.9616203f, 0.9617164f}, {0.4906425f, -0.9812369f, 0.4906425f, -1.9624738f, 0.96257f}, {0.4909778f, -0.9819074f, 0.4909778f, -1.9638148f, 0.9639111f}, {0.4914087f, -0.9827693f, 0.4914087f, -1.9655385f, 0.9656349f}, {0.4919058f, -0.9837634f, 0.4919058f, -1.9675268f, 0.9676232f}, {0.4924404f, -0.9848325f, 0.4924404f, -1.969665f, 0.9697616f}, {0.4929877f, -0.9859271f, 0.4929877f, -1.9718543f, 0.971951f}, {0.4935284f, -0.9870084f, 0.4935284f, -1.9740168f, 0.9741136f}, {0.4940484f, -0.9880484f, 0.4940484f, -1.9760969f, 0.9761938f}, {0.4945389f, -0.9890293f, 0.4945389f, -1.9780587f, 0.9781557f}, {0.4949948f, -0.9899411f, 0.4949948f, -1.9798822f, 0.9799793f}, {0.4954141f, -0.9907797f, 0.4954141f, -1.9815593f, 0.9816565f}, {0.4957969f, -0.9915451f, 0.4957969f, -1.9830902f, 0.9831874f}, {0.4961444f, -0.9922401f, 0.4961444f, -1.9844802f, 0.9845775f}, {0.4964589f, -0.992869f, 0.4964589f, -1.9857381f, 0.9858354f}, {0.4967428f, -0.993437f, 0.4967428f, -1.986874f, 0.9869714f}, {0.496999f, -0.9939493f, 0.496999f, -1.9878987f, 0.9879962f}, {0.4972301f, -0.9944115f, 0.4972301f, -1.9888229f, 0.9889204f}, {0.4974386f, -0.9948284f, 0.4974386f, -1.9896569f, 0.9897544f}, {0.4976269f, -0.995205f, 0.4976269f, -1.99041f, 0.9905076f}, {0.4977971f, -0.9955454f, 0.4977971f, -1.9910909f, 0.9911885f}, {0.4979513f, -0.9958537f, 0.4979513f, -1.9917074f, 0.991805f}, {0.498091f, -0.9961332f, 0.498091f, -1.9922665f, 0.9923642f}, {0.498218f, -0.9963872f, 0.498218f, -1.9927744f, 0.9928721f}, {0.4983336f, -0.9966183f, 0.4983336f, -1.9932366f, 0.9933344f}, {0.498439f, -0.996829f, 0.498439f, -1.9936581f, 0.9937559f}, {0.4985352f, -0.9970215f, 0.4985352f, -1.9940431f, 0.9941409f}, {0.4986233f, -0.9971977f, 0.4986233f, -1.9943954f, 0.9944932f}, {0.4987041f, -0.9973592f, 0.4987041f, -1.9947185f, 0.9948163f}, {0.4987783f, -0.9975076f, 0.4987783f, -1.9950153f, 0.9951131f}, {0.4988465f, -0.9976442f, 0.4988465f, -1.9952883f, 0.9953862f}, {0.4989095f, -0.99777f, 0.4989095f, -1.9955401f, 0.9956379f}, {0.4989676f, -0.9978863f, 0.4989676f, -1.9957726f, 0.9958704f}, {0.4990214f, -0.9979938f, 0.4990214f, -1.9959876f, 0.9960855f}, {0.4990712f, -0.9980934f, 0.4990712f, -1.9961869f, 0.9962847f}, {0.4991174f, -0.9981859f, 0.4991174f, -1.9963718f, 0.9964697f}, {0.4991604f, -0.9982718f, 0.4991604f, -1.9965436f, 0.9966415f}, {0.4992004f, -0.9983518f, 0.4992004f, -1.9967036f, 0.9968015f}, {0.4992377f, -0.9984263f, 0.4992377f, -1.9968527f, 0.9969506f}, {0.4992725f, -0.9984959f, 0.4992725f, -1.9969919f, 0.9970898f}, {0.499305f, -0.998561f, 0.499305f, -1.997122f, 0.9972199f}, {0.4993354f, -0.9986219f, 0.4993354f, -1.9972438f, 0.9973417f}, {0.499364f, -0.998679f, 0.499364f, -1.9973579f, 0.9974559f}, {0.4993907f, -0.9987325f, 0.4993907f, -1.997465f, 0.997563f}, {0.4994165f, -0.998784f, 0.4994165f, -1.997568f, 0.997666f}, {0.4994421f, -0.9988352f, 0.4994421f, -1.9976704f, 0.9977684f}, {0.4994675f, -0.998886f, 0.4994675f, -1.9977719f, 0.9978699f}, {0.4994926f, -0.9989361f, 0.4994926f, -1.9978722f, 0.9979702f}, {0.4995172f, -0.9989855f, 0.4995172f, -1.997971f, 0.998069f}, {0.4995415f, -0.9990339f, 0.4995415f, -1.9980679f, 0.9981658f}, {0.4995651f, -0.9990813f, 0.4995651f, -1.9981625f, 0.9982605f}, {0.4995882f, -0.9991273f, 0.4995882f, -1.9982547f, 0.9983527f}, {0.4996105f, -0.999172f, 0.4996105f, -1.9983441f, 0.9984421f}, {0.4996321f, -0.9992152f, 0.4996321f, -1.9984305f, 0.9985285f}, {0.4996529f, -0.9992568f, 0.4996529f, -1.9985136f, 0.9986116f}, {0.4996729f, -0.9992967f, 0.4996729f, -1.9985935f, 0.9986915f}, {0.499692f, -0.9993349f, 0.499692f, -1.9986699f, 0.9987679f}, {0.4997102f, -0.9993714f, 0.4997102f, -1.9987428f, 0.9988408f}, {0.4997275f, -0.9994061f, 0.4997275f, -1.9988121f, 0.9989101f}, {0.499744f, -0.999439f, 0.499744f, -1.9988779f, 0.9989759f}, {0.4997596f, -0.9994701f, 0.4997596f, -1.9989402f, 0.9990382f}, {0.4997743f, -0.9994995f, 0.4997743f, -1.9989991f, 0.9990971f}, {0.4997882f, -0.9995273f, 0.4997882f, -1.9990546f, 0.9991526f}},
-  {{0.489258f, -0.978456f, 0.489258f, -1.9569121f, 0.9570319f}, {0.4893394f, -0.978619f, 0.4893394f, -1.957238f, 0.9573578f}, {0.4895766f, -0.9790933f, 0.4895766f, -1.9581866f, 0.9583065f}, {0.4899493f, -0.9798386f, 0.4899493f, -1.9596772f, 0.9597972f}, {0.4904284f, -0.9807968f, 0.4904284f, -1.9615936f, 0.9617137f}, {0.4909812f, -0.9819022f, 0.4909812f, -1.9638045f, 0.9639247f}, {0.4915758f, -0.9830914f, 0.4915758f, -1.9661828f, 0.9663031f}, {0.4921847f, -0.9843092f, 0.4921847f, -1.9686184f, 0.9687389f}, {0.4927864f, -0.9855125f, 0.4927864f, -1.9710249f, 0.9711456f}, {0.4933653f, -0.9866701f, 0.4933653f, -1.9733403f, 0.9734611f}, {0.4939114f, -0.9877622f, 0.4939114f, -1.9755245f, 0.9756454f}, {0.4944191f, -0.9887776f, 0.4944191f, -1.9775552f, 0.9776762f}, {0.4948861f, -0.9897116f, 0.4948861f, -1.9794232f, 0.9795444f}, {0.4953125f, -0.9905643f, 0.4953125f, -1.9811286f, 0.9812499f}, {0.4956997f, -0.9913387f, 0.4956997f, -1.9826775f, 0.9827988f}, {0.4960502f, -0.9920396f, 0.4960502f, -1.9840792f, 0.9842006f}, {0.4963667f, -0.9926726f, 0.4963667f, -1.9853452f, 0.9854667f}, {0.4966523f, -0.9932437f, 0.4966523f, -1.9864875f, 0.9866091f}, {0.4969099f, -0.9937589f, 0.4969099f, -1.9875178f, 0.9876395f}, {0.4971423f, -0.9942238f, 0.4971423f, -1.9884476f, 0.9885693f}, {0.4973523f, -0.9946437f, 0.4973523f, -1.9892874f, 0.9894091f}, {0.4975421f, -0.9950233f, 0.4975421f, -1.9900467f, 0.9901685f}, {0.497714f, -0.9953671f, 0.497714f, -1.9907342f, 0.9908561f}, {0.4978699f, -0.9956789f, 0.4978699f, -1.9913578f, 0.9914797f}, {0.4980115f, -0.9959621f, 0.4980115f, -1.9919243f, 0.9920462f}, {0.4981405f, -0.9962199f, 0.4981405f, -1.9924399f, 0.9925618f}, {0.498258f, -0.996455f, 0.498258f, -1.99291f, 0.993032f}, {0.4983654f, -0.9966697f, 0.4983654f, -1.9933395f, 0.9934615f}, {0.4984636f, -0.9968663f, 0.4984636f, -1.9937325f, 0.9938546f}, {0.4985538f, -0.9970465f, 0.4985538f, -1.994093f, 0.994215f}, {0.4986365f, -0.997212f, 0.4986365f, -1.994424f, 0.9945461f}, {0.4987127f, -0.9973644f, 0.4987127f, -1.9947287f, 0.9948508f}, {0.4987829f, -0.9975048f, 0.4987829f, -1.9950096f, 0.9951317f}, {0.4988478f, -0.9976345f, 0.4988478f, -1.995269f, 0.9953911f}, {0.4989078f, -0.9977545f, 0.4989078f, -1.995509f, 0.9956311f}, {0.4989634f, -0.9978656f, 0.4989634f, -1.9957313f, 0.9958534f}, {0.4990149f, -0.9979688f, 0.4990149f, -1.9959376f, 0.9960598f}, {0.4990629f, -0.9980647f, 0.4990629f, -1.9961294f, 0.9962515f}, {0.4991075f, -0.9981539f, 0.4991075f, -1.9963079f, 0.9964301f}, {0.4991491f, -0.9982371f, 0.4991491f, -1.9964743f, 0.9965965f}, {0.499188f, -0.9983148f, 0.499188f, -1.9966296f, 0.9967518f}, {0.4992243f, -0.9983874f, 0.4992243f, -1.9967748f, 0.996897f}, {0.4992582f, -0.9984554f, 0.4992582f, -1.9969107f, 0.997033f}, {0.4992901f, -0.998519f, 0.4992901f, -1.9970381f, 0.9971603f}, {0.49932f, -0.9985788f, 0.49932f, -1.9971576f, 0.9972799f}, {0.4993487f, -0.9986363f, 0.4993487f, -1.9972726f, 0.9973948f}, {0.4993773f, -0.9986934f, 0.4993773f, -1.9973868f, 0.9975091f}, {0.4994056f, -0.9987501f, 0.4994056f, -1.9975001f, 0.9976224f}, {0.4994336f, -0.998806f, 0.4994336f, -1.9976121f, 0.9977343f}, {0.4994611f, -0.9988611f, 0.4994611f, -1.9977223f, 0.9978446f}, {0.4994882f, -0.9989152f, 0.4994882f, -1.9978304f, 0.9979527f}, {0.4995146f, -0.998968f, 0.4995146f, -1.9979361f, 0.9980583f}, {0.4995403f, -0.9990195f, 0.4995403f, -1.9980389f, 0.9981612f}, {0.4995652f, -0.9990693f, 0.4995652f, -1.9981387f, 0.998261f}, {0.4995894f, -0.9991175f, 0.4995894f, -1.9982351f, 0.9983574f}, {0.4996126f, -0.999164f, 0.4996126f, -1.9983279f, 0.9984503f}, {0.4996348f, -0.9992085f, 0.4996348f, -1.9984171f, 0.9985394f}, {0.4996562f, -0.9992512f, 0.4996562f, -1.9985023f, 0.9986247f}, {0.4996765f, -0.9992918f, 0.4996765f, -1.9985837f, 0.998706f}, {0.4996959f, -0.9993305f, 0.4996959f, -1.9986611f, 0.9987834f}, {0.4997142f, -0.9993673f, 0.4997142f, -1.9987345f, 0.9988569f}, {0.4997316f, -0.999402f, 0.4997316f, -1.9988041f, 0.9989264f}, {0.499748f, -0.9994349f, 0.499748f, -1.9988698f, 0.9989921f}, {0.4997635f, -0.9994659f, 0.4997635f, -1.9989317f, 0.9990541f}},
-  {{0.4880393f, -0.9760041f, 0.4880393f, -1.9520082f, 0.9521573f}, {0.4881298f, -0.9761851f, 0.4881298f, -1.9523701f, 0.9525193f}, {0.4883933f, -0.9767119f, 0.4883933f, -1.9534238f, 0.9535731f}, {0.4888073f, -0.9775399f, 0.4888073f, -1.9550798f, 0.9552292f}, {0.4893397f, -0.9786046f, 0.4893397f, -1.9572091f, 0.9573587f}, {0.489954f, -0.9798332f, 0.489954f, -1.9596663f, 0.9598161f}, {0.4906151f, -0.9811551f, 0.4906151f, -1.9623103f, 0.9624602f}, {0.4912922f, -0.9825094f, 0.4912922f, -1.9650187f, 0.9651689f}, {0.4919615f, -0.9838477f, 0.4919615f, -1.9676955f, 0.9678458f}, {0.4926055f, -0.9851358f, 0.4926055f, -1.9702716f, 0.9704222f}, {0.4932133f, -0.9863512f, 0.4932133f, -1.9727025f, 0.9728532f}, {0.4937785f, -0.9874815f, 0.4937785f, -1.974963f, 0.9751139f}, {0.4942985f, -0.9885215f, 0.4942985f, -1.9770429f, 0.977194f}, {0.4947734f, -0.9894711f, 0.4947734f, -1.9789422f, 0.9790934f}, {0.4952047f, -0.9903337f, 0.4952047f, -1.9806674f, 0.9808188f}, {0.4955951f, -0.9911145f, 0.4955951f, -1.9822291f, 0.9823805f}, {0.4959478f, -0.9918199f, 0.4959478f, -1.9836397f, 0.9837913f}, {0.4962661f, -0.9924563f, 0.4962661f, -1.9849127f, 0.9850643f}, {0.4965532f, -0.9930305f, 0.4965532f, -1.986061f, 0.9862128f}, {0.4968123f, -0.9935487f, 0.4968123f, -1.9870974f, 0.9872493f}, {0.4970464f, -0.9940168f, 0.4970464f, -1.9880336f, 0.9881855f}, {0.497258f, -0.99444f, 0.497258f, -1.9888801f, 0.9890321f}, {0.4974497f, -0.9948233f, 0.4974497f, -1.9896467f, 0.9897987f}, {0.4976235f, -0.995171f, 0.4976235f, -1.990342f, 0.9904941f}, {0.4977815f, -0.9954869f, 0.4977815f, -1.9909737f, 0.9911259f}, {0.4979252f, -0.9957744f, 0.4979252f, -1.9915487f, 0.9917009f}, {0.4980563f, -0.9960365f, 0.4980563f, -1.9920731f, 0.9922253f}, {0.4981761f, -0.996276f, 0.4981761f, -1.9925521f, 0.9927043f}, {0.4982857f, -0.9964952f, 0.4982857f, -1.9929905f, 0.9931428f}, {0.4983862f, -0.9966963f, 0.4983862f, -1.9933925f, 0.9935448f}, {0.4984785f, -0.9968809f, 0.4984785f, -1.9937618f, 0.9939142f}, {0.4985635f, -0.9970509f, 0.4985635f, -1.9941017f, 0.9942541f}, {0.4986419f, -0.9972075f, 0.4986419f, -1.9944151f, 0.9945674f}, {0.4987142f, -0.9973522f, 0.4987142f, -1.9947044f, 0.9948568f}, {0.4987811f, -0.9974861f, 0.4987811f, -1.9949721f, 0.9951246f}, {0.4988432f, -0.9976101f, 0.4988432f, -1.9952202f, 0.9953726f}, {0.4989007f, -0.9977252f, 0.4989007f, -1.9954504f, 0.9956028f}, {0.4989542f, -0.9978322f, 0.4989542f, -1.9956643f, 0.9958168f}, {0.499004f, -0.9979317f, 0.499004f, -1.9958635f, 0.996016f}, {0.4990504f, -0.9980246f, 0.4990504f, -1.9960491f, 0.9962016f}, {0.4990937f, -0.9981112f, 0.4990937f, -1.9962225f, 0.996375f}, {0.4991343f, -0.9981922f, 0.4991343f, -1.9963845f, 0.996537f}, {0.4991722f, -0.9982681f, 0.4991722f, -1.9965361f, 0.9966887f}, {0.4992077f, -0.9983391f, 0.4992077f, -1.9966783f, 0.9968308f}, {0.499241f, -0.9984058f, 0.499241f, -1.9968116f, 0.9969642f}, {0.4992731f, -0.9984699f, 0.4992731f, -1.9969399f, 0.9970925f}, {0.499305f, -0.9985337f, 0.499305f, -1.9970674f, 0.99722f}, {0.4993366f, -0.9985969f, 0.4993366f, -1.9971938f, 0.9973464f}, {0.4993678f, -0.9986594f, 0.4993678f, -1.9973187f, 0.9974714f}, {0.4993986f, -0.9987209f, 0.4993986f, -1.9974417f, 0.9975944f}, {0.4994288f, -0.9987812f, 0.4994288f, -1.9975624f, 0.997715f}, {0.4994582f, -0.9988401f, 0.4994582f, -1.9976803f, 0.9978329f}, {0.4994869f, -0.9988975f, 0.4994869f, -1.9977951f, 0.9979477f}, {0.4995148f, -0.9989532f, 0.4995148f, -1.9979064f, 0.9980591f}, {0.4995417f, -0.999007f, 0.4995417f, -1.998014f, 0.9981667f}, {0.4995676f, -0.9990588f, 0.4995676f, -1.9981176f, 0.9982703f}, {0.4995924f, -0.9991085f, 0.4995924f, -1.9982171f, 0.9983698f}, {0.4996162f, -0.9991561f, 0.4996162f, -1.9983123f, 0.9984649f}, {0.4996389f, -0.9992015f, 0.4996389f, -1.998403f, 0.9985557f}, {0.4996605f, -0.9992447f, 0.4996605f, -1.9984894f, 0.9986421f}, {0.499681f, -0.9992857f, 0.499681f, -1.9985714f, 0.9987241f}, {0.4997004f, -0.9993245f, 0.4997004f, -1.998649f, 0.9988017f}, {0.4997188f, -0.9993612f, 0.4997188f, -1.9987223f, 0.998875f}, {0.499736f, -0.9993957f, 0.499736f, -1.9987915f, 0.9989442f}},
-  {{0.4866876f, -0.9732823f, 0.4866876f, -1.9465647f, 0.9467503f}, {0.486788f, -0.9734832f, 0.486788f, -1.9469664f, 0.9471521f}, {0.4870805f, -0.974068f, 0.4870805f, -1.9481361f, 0.9483219f}, {0.4875401f, -0.9749873f, 0.4875401f, -1.9499745f, 0.9501605f}, {0.4881313f, -0.9761695f, 0.4881313f, -1.952339f, 0.9525252f}, {0.4888137f, -0.9775342f, 0.4888137f, -1.9550684f, 0.9552548f}, {0.4895482f, -0.979003f, 0.4895482f, -1.958006f, 0.9581927f}, {0.4903008f, -0.9805081f, 0.4903008f, -1.9610162f, 0.9612032f}, {0.4910448f, -0.981996f, 0.4910448f, -1.9639921f, 0.9641794f}, {0.4917611f, -0.9834285f, 0.4917611f, -1.966857f, 0.9670446f}, {0.4924372f, -0.9847806f, 0.4924372f, -1.9695611f, 0.9697489f}, {0.4930661f, -0.9860382f, 0.4930661f, -1.9720764f, 0.9722645f}, {0.4936449f, -0.9871957f, 0.4936449f, -1.9743914f, 0.9745797f}, {0.4941736f, -0.9882529f, 0.4941736f, -1.9765058f, 0.9766943f}, {0.4946539f, -0.9892134f, 0.4946539f, -1.9784268f, 0.9786155f}, {0.4950887f, -0.990083f, 0.4950887f, -1.980166f, 0.9803549f}, {0.4954816f, -0.9908687f, 0.4954816f, -1.9817373f, 0.9819264f}, {0.4958362f, -0.9915777f, 0.4958362f, -1.9831555f, 0.9833446f}, {0.4961561f, -0.9922175f, 0.4961561f, -1.984435f, 0.9846243f}, {0.4964448f, -0.992795f, 0.4964448f, -1.98559f, 0.9857794f}, {0.4967057f, -0.9933166f, 0.4967057f, -1.9866333f, 0.9868228f}, {0.4969416f, -0.9937884f, 0.4969416f, -1.9875768f, 0.9877664f}, {0.4971553f, -0.9942157f, 0.4971553f, -1.9884314f, 0.988621f}, {0.4973491f, -0.9946033f, 0.4973491f, -1.9892065f, 0.9893962f}, {0.4975252f, -0.9949554f, 0.4975252f, -1.9899108f, 0.9901006f}, {0.4976854f, -0.995276f, 0.4976854f, -1.9905519f, 0.9907418f}, {0.4978316f, -0.9955683f, 0.4978316f, -1.9911366f, 0.9913265f}, {0.4979652f, -0.9958354f, 0.4979652f, -1.9916707f, 0.9918607f}, {0.4980874f, -0.9960798f, 0.4980874f, -1.9921597f, 0.9923497f}, {0.4981995f, -0.996304f, 0.4981995f, -1.992608f, 0.992798f}, {0.4983025f, -0.9965099f, 0.4983025f, -1.9930199f, 0.99321f}, {0.4983973f, -0.9966995f, 0.4983973f, -1.993399f, 0.9935891f}, {0.4984846f, -0.9968742f, 0.4984846f, -1.9937484f, 0.9939386f}, {0.4985654f, -0.9970356f, 0.4985654f, -1.9940712f, 0.9942614f}, {0.49864f, -0.9971849f, 0.49864f, -1.9943698f, 0.99456f}, {0.4987092f, -0.9973232f, 0.4987092f, -1.9946465f, 0.9948367f}, {0.4987734f, -0.9974516f, 0.4987734f, -1.9949033f, 0.9950935f}, {0.4988331f, -0.997571f, 0.4988331f, -1.9951419f, 0.9953322f}, {0.4988886f, -0.9976821f, 0.4988886f, -1.9953641f, 0.9955544f}, {0.4989404f, -0.9977856f, 0.4989404f, -1.9955712f, 0.9957616f}, {0.4989887f, -0.9978823f, 0.4989887f, -1.9957646f, 0.9959549f}, {0.4990339f, -0.9979727f, 0.4990339f, -1.9959453f, 0.9961357f}, {0.4990762f, -0.9980573f, 0.4990762f, -1.9961145f, 0.9963049f}, {0.4991159f, -0.9981366f, 0.4991159f, -1.9962731f, 0.9964635f}, {0.4991531f, -0.998211f, 0.4991531f, -1.9964219f, 0.9966123f}, {0.4991889f, -0.9982825f, 0.4991889f, -1.996565f, 0.9967554f}, {0.4992244f, -0.9983536f, 0.4992244f, -1.9967073f, 0.9968977f}, {0.4992597f, -0.9984242f, 0.4992597f, -1.9968483f, 0.9970388f}, {0.4992945f, -0.9984939f, 0.4992945f, -1.9969877f, 0.9971782f}, {0.4993289f, -0.9985625f, 0.4993289f, -1.9971249f, 0.9973154f}, {0.4993625f, -0.9986298f, 0.4993625f, -1.9972596f, 0.99745f}, {0.4993954f, -0.9986956f, 0.4993954f, -1.9973911f, 0.9975816f}, {0.4994274f, -0.9987596f, 0.4994274f, -1.9975192f, 0.9977097f}, {0.4994585f, -0.9988217f, 0.4994585f, -1.9976434f, 0.9978339f}, {0.4994885f, -0.9988817f, 0.4994885f, -1.9977635f, 0.997954f}, {0.4995174f, -0.9989396f, 0.4995174f, -1.9978791f, 0.9980697f}, {0.4995452f, -0.998995f, 0.4995452f, -1.9979901f, 0.9981807f}, {0.4995717f, -0.9990481f, 0.4995717f, -1.9980963f, 0.9982869f}, {0.499597f, -0.9990988f, 0.499597f, -1.9981976f, 0.9983882f}, {0.4996211f, -0.999147f, 0.4996211f, -1.998294f, 0.9984846f}, {0.499644f, -0.9991927f, 0.499644f, -1.9983855f, 0.9985761f}, {0.4996657f, -0.999236f, 0.4996657f, -1.9984721f, 0.9986627f}, {0.4996861f, -0.9992769f, 0.4996861f, -1.9985539f, 0.9987445f}, {0.4997054f, -0.9993155f, 0.4997054f, -1.9986311f, 0.9988217f}},
-  {{0.4851894f, -0.9702634f, 0.4851894f, -1.9405267f, 0.9407577f}, {0.4853008f, -0.9704861f, 0.4853008f, -1.9409723f, 0.9412034f}, {0.4856252f, -0.9711348f, 0.4856252f, -1.9422697f, 0.9425009f}, {0.4861352f, -0.9721546f, 0.4861352f, -1.9443093f, 0.9445408f}, {0.4867912f, -0.9734665f, 0.4867912f, -1.9469331f, 0.9471649f}, {0.4875487f, -0.9749813f, 0.4875487f, -1.9499626f, 0.9501948f}, {0.4883643f, -0.9766122f, 0.4883643f, -1.9532245f, 0.953457f}, {0.4892002f, -0.978284f, 0.4892002f, -1.956568f, 0.956801f}, {0.490027f, -0.9799373f, 0.490027f, -1.9598747f, 0.960108f}, {0.4908232f, -0.9815295f, 0.4908232f, -1.9630591f, 0.9632928f}, {0.4915749f, -0.9830328f, 0.4915749f, -1.9660657f, 0.9662997f}, {0.4922744f, -0.9844316f, 0.4922744f, -1.9688633f, 0.9690977f}, {0.4929184f, -0.9857194f, 0.4929184f, -1.9714387f, 0.9716734f}, {0.4935066f, -0.9868958f, 0.4935066f, -1.9737916f, 0.9740266f}, {0.4940413f, -0.9879649f, 0.4940413f, -1.9759298f, 0.976165f}, {0.4945254f, -0.988933f, 0.4945254f, -1.9778661f, 0.9781015f}, {0.4949629f, -0.9898079f, 0.4949629f, -1.9796157f, 0.9798514f}, {0.4953577f, -0.9905976f, 0.4953577f, -1.9811951f, 0.981431f}, {0.4957141f, -0.9913102f, 0.4957141f, -1.9826204f, 0.9828564f}, {0.4960358f, -0.9919535f, 0.4960358f, -1.983907f, 0.9841432f}, {0.4963264f, -0.9925347f, 0.4963264f, -1.9850694f, 0.9853058f}, {0.4965893f, -0.9930604f, 0.4965893f, -1.9861209f, 0.9863573f}, {0.4968274f, -0.9935366f, 0.4968274f, -1.9870732f, 0.9873097f}, {0.4970434f, -0.9939685f, 0.4970434f, -1.9879371f, 0.9881737f}, {0.4972397f, -0.9943611f, 0.4972397f, -1.9887221f, 0.9889589f}, {0.4974184f, -0.9947184f, 0.4974184f, -1.9894368f, 0.9896736f}, {0.4975814f, -0.9950443f, 0.4975814f, -1.9900885f, 0.9903255f}, {0.4977303f, -0.995342f, 0.4977303f, -1.990684f, 0.990921f}, {0.4978665f, -0.9956146f, 0.4978665f, -1.9912291f, 0.9914662f}, {0.4979915f, -0.9958645f, 0.4979915f, -1.991729f, 0.9919662f}, {0.4981064f, -0.9960942f, 0.4981064f, -1.9921883f, 0.9924255f}, {0.4982121f, -0.9963055f, 0.4982121f, -1.992611f, 0.9928482f}, {0.4983095f, -0.9965004f, 0.4983095f, -1.9930007f, 0.993238f}, {0.4983995f, -0.9966803f, 0.4983995f, -1.9933607f, 0.993598f}, {0.4984828f, -0.9968468f, 0.4984828f, -1.9936937f, 0.993931f}, {0.4985599f, -0.9970011f, 0.4985599f, -1.9940023f, 0.9942396f}, {0.4986315f, -0.9971443f, 0.4986315f, -1.9942886f, 0.9945261f}, {0.4986981f, -0.9972774f, 0.4986981f, -1.9945548f, 0.9947923f}, {0.49876f, -0.9974013f, 0.49876f, -1.9948026f, 0.9950401f}, {0.4988178f, -0.9975168f, 0.4988178f, -1.9950337f, 0.9952712f}, {0.4988717f, -0.9976247f, 0.4988717f, -1.9952493f, 0.9954869f}, {0.4989221f, -0.9977255f, 0.4989221f, -1.995451f, 0.9956885f}, {0.4989693f, -0.9978198f, 0.4989693f, -1.9956397f, 0.9958773f}, {0.4990135f, -0.9979083f, 0.4990135f, -1.9958166f, 0.9960542f}, {0.499055f, -0.9979913f, 0.499055f, -1.9959825f, 0.9962202f}, {0.499095f, -0.9980711f, 0.499095f, -1.9961422f, 0.9963798f}, {0.4991346f, -0.9981504f, 0.4991346f, -1.9963009f, 0.9965386f}, {0.499174f, -0.9982291f, 0.499174f, -1.9964582f, 0.9966959f}, {0.4992129f, -0.9983069f, 0.4992129f, -1.9966137f, 0.9968514f}, {0.4992511f, -0.9983834f, 0.4992511f, -1.9967668f, 0.9970045f}, {0.4992887f, -0.9984585f, 0.4992887f, -1.996917f, 0.9971547f}, {0.4993254f, -0.9985319f, 0.4993254f, -1.9970638f, 0.9973015f}, {0.4993611f, -0.9986033f, 0.4993611f, -1.9972067f, 0.9974444f}, {0.4993958f, -0.9986726f, 0.4993958f, -1.9973453f, 0.997583f}, {0.4994293f, -0.9987396f, 0.4994293f, -1.9974792f, 0.997717f}, {0.4994615f, -0.9988041f, 0.4994615f, -1.9976082f, 0.997846f}, {0.4994925f, -0.998866f, 0.4994925f, -1.997732f, 0.9979699f}, {0.4995221f, -0.9989253f, 0.4995221f, -1.9978505f, 0.9980884f}, {0.4995504f, -0.9989818f, 0.4995504f, -1.9979636f, 0.9982014f}, {0.4995772f, -0.9990355f, 0.4995772f, -1.9980711f, 0.998309f}, {0.4996028f, -0.9990866f, 0.4996028f, -1.9981732f, 0.998411f}, {0.4996269f, -0.9991349f, 0.4996269f, -1.9982698f, 0.9985077f}, {0.4996498f, -0.9991805f, 0.4996498f, -1.9983611f, 0.998599f}, {0.4996713f, -0.9992236f, 0.4996713f, -1.9984472f, 0.9986851f}},
-  {{0.4835305f, -0.9669173f, 0.4835305f, -1.9338347f, 0.934122f}, {0.483654f, -0.9671642f, 0.483654f, -1.9343284f, 0.9346159f}, {0.4840135f, -0.9678832f, 0.4840135f, -1.9357664f, 0.936054f}, {0.4845788f, -0.9690137f, 0.4845788f, -1.9380273f, 0.9383153f}, {0.4853063f, -0.9704683f, 0.4853063f, -1.9409367f, 0.9412251f}, {0.4861465f, -0.9721485f, 0.4861465f, -1.944297f, 0.944586f}, {0.4870514f, -0.9739582f, 0.4870514f, -1.9479163f, 0.9482058f}, {0.4879794f, -0.9758139f, 0.4879794f, -1.9516277f, 0.9519178f}, {0.4888975f, -0.9776498f, 0.4888975f, -1.9552996f, 0.9555902f}, {0.489782f, -0.9794185f, 0.489782f, -1.958837f, 0.9591281f}, {0.4906174f, -0.981089f, 0.4906174f, -1.9621781f, 0.9624697f}, {0.491395f, -0.982644f, 0.491395f, -1.9652879f, 0.96558f}, {0.4921111f, -0.9840759f, 0.4921111f, -1.9681518f, 0.9684443f}, {0.4927654f, -0.9853844f, 0.4927654f, -1.9707689f, 0.9710618f}, {0.4933603f, -0.9865739f, 0.4933603f, -1.9731478f, 0.973441f}, {0.493899f, -0.9876513f, 0.493899f, -1.9753025f, 0.9755961f}, {0.494386f, -0.988625f, 0.494386f, -1.9772501f, 0.9775439f}, {0.4948256f, -0.9895042f, 0.4948256f, -1.9790084f, 0.9793025f}, {0.4952224f, -0.9902977f, 0.4952224f, -1.9805954f, 0.9808897f}, {0.4955807f, -0.9910141f, 0.4955807f, -1.9820283f, 0.9823228f}, {0.4959044f, -0.9916615f, 0.4959044f, -1.983323f, 0.9836178f}, {0.4961973f, -0.9922471f, 0.4961973f, -1.9844942f, 0.9847892f}, {0.4964626f, -0.9927776f, 0.4964626f, -1.9855552f, 0.9858503f}, {0.4967033f, -0.9932589f, 0.4967033f, -1.9865178f, 0.986813f}, {0.496922f, -0.9936963f, 0.496922f, -1.9873926f, 0.9876879f}, {0.4971211f, -0.9940945f, 0.4971211f, -1.988189f, 0.9884845f}, {0.4973027f, -0.9944577f, 0.4973027f, -1.9889154f, 0.989211f}, {0.4974687f, -0.9947896f, 0.4974687f, -1.9895791f, 0.9898748f}, {0.4976206f, -0.9950934f, 0.4976206f, -1.9901867f, 0.9904825f}, {0.49776f, -0.995372f, 0.49776f, -1.990744f, 0.9910398f}, {0.497888f, -0.995628f, 0.497888f, -1.991256f, 0.9915519f}, {0.4980058f, -0.9958636f, 0.4980058f, -1.9917272f, 0.9920232f}, {0.4981144f, -0.9960809f, 0.4981144f, -1.9921617f, 0.9924578f}, {0.4982148f, -0.9962815f, 0.4982148f, -1.992563f, 0.9928591f}, {0.4983076f, -0.9964672f, 0.4983076f, -1.9929343f, 0.9932305f}, {0.4983937f, -0.9966392f, 0.4983937f, -1.9932784f, 0.9935746f}, {0.4984735f, -0.9967989f, 0.4984735f, -1.9935977f, 0.993894f}, {0.4985477f, -0.9969473f, 0.4985477f, -1.9938946f, 0.9941909f}, {0.4986168f, -0.9970854f, 0.4986168f, -1.9941709f, 0.9944672f}, {0.4986812f, -0.9972143f, 0.4986812f, -1.9944285f, 0.9947249f}, {0.4987414f, -0.9973345f, 0.4987414f, -1.994669f, 0.9949655f}, {0.4987976f, -0.9974469f, 0.4987976f, -1.9948939f, 0.9951903f}, {0.4988502f, -0.9975522f, 0.4988502f, -1.9951044f, 0.9954009f}, {0.4988995f, -0.9976508f, 0.4988995f, -1.9953016f, 0.9955982f}, {0.4989458f, -0.9977434f, 0.4989458f, -1.9954868f, 0.9957833f}, {0.4989903f, -0.9978324f, 0.4989903f, -1.9956648f, 0.9959614f}, {0.4990346f, -0.9979209f, 0.4990346f, -1.9958418f, 0.9961384f}, {0.4990785f, -0.9980087f, 0.4990785f, -1.9960173f, 0.9963139f}, {0.4991218f, -0.9980954f, 0.4991218f, -1.9961907f, 0.9964874f}, {0.4991645f, -0.9981807f, 0.4991645f, -1.9963615f, 0.9966582f}, {0.4992064f, -0.9982645f, 0.4992064f, -1.996529f, 0.9968257f}, {0.4992474f, -0.9983464f, 0.4992474f, -1.9966927f, 0.9969894f}, {0.4992872f, -0.9984261f, 0.4992872f, -1.9968521f, 0.9971489f}, {0.4993259f, -0.9985034f, 0.4993259f, -1.9970067f, 0.9973035f}, {0.4993632f, -0.9985781f, 0.4993632f, -1.9971561f, 0.9974529f}, {0.4993992f, -0.99865f, 0.4993992f, -1.9973f, 0.9975968f}, {0.4994338f, -0.9987191f, 0.4994338f, -1.9974382f, 0.997735f}, {0.4994668f, -0.9987852f, 0.4994668f, -1.9975703f, 0.9978672f}, {0.4994983f, -0.9988482f, 0.4994983f, -1.9976964f, 0.9979933f}, {0.4995283f, -0.9989082f, 0.4995283f, -1.9978164f, 0.9981133f}, {0.4995568f, -0.9989651f, 0.4995568f, -1.9979303f, 0.9982272f}, {0.4995837f, -0.999019f, 0.4995837f, -1.9980381f, 0.998335f}, {0.4996092f, -0.99907f, 0.4996092f, -1.9981399f, 0.9984369f}, {0.4996332f, -0.999118f, 0.4996332f, -1.998236f, 0.9985329f}},
-  {{0.4816954f, -0.9632121f, 0.4816954f, -1.9264243f, 0.9267816f}, {0.4818321f, -0.9634855f, 0.4818321f, -1.926971f, 0.9273285f}, {0.4822303f, -0.9642816f, 0.4822303f, -1.9285632f, 0.928921f}, {0.4828564f, -0.9655337f, 0.4828564f, -1.9310674f, 0.9314256f}, {0.4836624f, -0.9671453f, 0.4836624f, -1.9342906f, 0.9346494f}, {0.4845936f, -0.9690074f, 0.4845936f, -1.9380148f, 0.9383743f}, {0.485597f, -0.9710138f, 0.485597f, -1.9420277f, 0.9423879f}, {0.4866263f, -0.9730722f, 0.4866263f, -1.9461444f, 0.9465054f}, {0.4876452f, -0.9751095f, 0.4876452f, -1.9502189f, 0.9505807f}, {0.4886271f, -0.977073f, 0.4886271f, -1.9541459f, 0.9545084f}, {0.4895549f, -0.9789282f, 0.4895549f, -1.9578565f, 0.9582197f}, {0.4904188f, -0.9806557f, 0.4904188f, -1.9613115f, 0.9616753f}, {0.4912147f, -0.9822471f, 0.4912147f, -1.9644943f, 0.9648587f}, {0.4919422f, -0.9837019f, 0.4919422f, -1.9674038f, 0.9677687f}, {0.4926037f, -0.9850246f, 0.4926037f, -1.9700492f, 0.9704147f}, {0.493203f, -0.986223f, 0.493203f, -1.972446f, 0.9728119f}, {0.4937448f, -0.9873064f, 0.4937448f, -1.9746129f, 0.9749792f}, {0.4942341f, -0.9882848f, 0.4942341f, -1.9765696f, 0.9769363f}, {0.4946758f, -0.989168f, 0.4946758f, -1.978336f, 0.978703f}, {0.4950746f, -0.9899656f, 0.4950746f, -1.9799312f, 0.9802985f}, {0.4954351f, -0.9906864f, 0.4954351f, -1.9813728f, 0.9817403f}, {0.4957612f, -0.9913385f, 0.4957612f, -1.982677f, 0.9830448f}, {0.4960567f, -0.9919293f, 0.4960567f, -1.9838586f, 0.9842267f}, {0.4963248f, -0.9924654f, 0.4963248f, -1.9849308f, 0.985299f}, {0.4965684f, -0.9929527f, 0.4965684f, -1.9859053f, 0.9862737f}, {0.4967903f, -0.9933963f, 0.4967903f, -1.9867926f, 0.9871611f}, {0.4969927f, -0.993801f, 0.4969927f, -1.9876019f, 0.9879706f}, {0.4971776f, -0.9941707f, 0.4971776f, -1.9883415f, 0.9887103f}, {0.4973469f, -0.9945093f, 0.4973469f, -1.9890186f, 0.9893875f}, {0.4975022f, -0.9948198f, 0.4975022f, -1.9896396f, 0.9900087f}, {0.4976448f, -0.9951051f, 0.4976448f, -1.9902102f, 0.9905794f}, {0.4977762f, -0.9953677f, 0.4977762f, -1.9907354f, 0.9911047f}, {0.4978973f, -0.9956099f, 0.4978973f, -1.9912197f, 0.9915891f}, {0.4980091f, -0.9958335f, 0.4980091f, -1.9916671f, 0.9920365f}, {0.4981126f, -0.9960405f, 0.4981126f, -1.992081f, 0.9924505f}, {0.4982085f, -0.9962322f, 0.4982085f, -1.9924645f, 0.9928341f}, {0.4982975f, -0.9964102f, 0.4982975f, -1.9928205f, 0.9931902f}, {0.4983803f, -0.9965757f, 0.4983803f, -1.9931514f, 0.9935212f}, {0.4984573f, -0.9967298f, 0.4984573f, -1.9934595f, 0.9938293f}, {0.4985292f, -0.9968734f, 0.4985292f, -1.9937467f, 0.9941166f}, {0.4985962f, -0.9970075f, 0.4985962f, -1.9940149f, 0.9943848f}, {0.4986589f, -0.9971328f, 0.4986589f, -1.9942656f, 0.9946356f}, {0.4987176f, -0.9972501f, 0.4987176f, -1.9945003f, 0.9948703f}, {0.4987726f, -0.9973601f, 0.4987726f, -1.9947203f, 0.9950903f}, {0.4988242f, -0.9974633f, 0.4988242f, -1.9949267f, 0.9952968f}, {0.4988738f, -0.9975626f, 0.4988738f, -1.9951252f, 0.9954953f}, {0.4989232f, -0.9976613f, 0.4989232f, -1.9953226f, 0.9956927f}, {0.4989721f, -0.9977592f, 0.4989721f, -1.9955183f, 0.9958885f}, {0.4990205f, -0.9978559f, 0.4990205f, -1.9957117f, 0.9960819f}, {0.4990681f, -0.9979511f, 0.4990681f, -1.9959021f, 0.9962724f}, {0.4991148f, -0.9980445f, 0.4991148f, -1.9960889f, 0.9964592f}, {0.4991605f, -0.9981358f, 0.4991605f, -1.9962715f, 0.9966418f}, {0.4992049f, -0.9982246f, 0.4992049f, -1.9964493f, 0.9968196f}, {0.499248f, -0.9983108f, 0.499248f, -1.9966217f, 0.9969921f}, {0.4992897f, -0.9983942f, 0.4992897f, -1.9967883f, 0.9971588f}, {0.4993298f, -0.9984744f, 0.4993298f, -1.9969488f, 0.9973193f}, {0.4993683f, -0.9985514f, 0.4993683f, -1.9971029f, 0.9974734f}, {0.4994052f, -0.9986252f, 0.4994052f, -1.9972503f, 0.9976208f}, {0.4994404f, -0.9986955f, 0.4994404f, -1.9973909f, 0.9977615f}, {0.4994738f, -0.9987624f, 0.4994738f, -1.9975248f, 0.9978953f}, {0.4995056f, -0.9988259f, 0.4995056f, -1.9976518f, 0.9980223f}, {0.4995356f, -0.998886f, 0.4995356f, -1.997772f, 0.9981426f}, {0.4995641f, -0.9989428f, 0.4995641f, -1.9978856f, 0.9982562f}, {0.4995908f, -0.9989964f, 0.4995908f, -1.9979928f, 0.9983634f}},
-  {{0.4796677f, -0.9591133f, 0.4796677f, -1.9182265f, 0.9186707f}, {0.4798189f, -0.9594156f, 0.4798189f, -1.9188312f, 0.9192756f}, {0.4802593f, -0.9602963f, 0.4802593f, -1.9205926f, 0.9210374f}, {0.4809522f, -0.9616817f, 0.4809522f, -1.9233634f, 0.9238088f}, {0.4818443f, -0.9634655f, 0.4818443f, -1.926931f, 0.9273772f}, {0.4828755f, -0.9655274f, 0.4828755f, -1.9310548f, 0.931502f}, {0.4839871f, -0.9677501f, 0.4839871f, -1.9355001f, 0.9359483f}, {0.485128f, -0.9700313f, 0.485128f, -1.9400627f, 0.9405119f}, {0.4862577f, -0.9722903f, 0.4862577f, -1.9445806f, 0.9450309f}, {0.4873471f, -0.9744685f, 0.4873471f, -1.948937f, 0.9493883f}, {0.4883768f, -0.9765275f, 0.4883768f, -1.953055f, 0.9535073f}, {0.4893361f, -0.9784456f, 0.4893361f, -1.9568911f, 0.9573443f}, {0.4902201f, -0.9802131f, 0.4902201f, -1.9604262f, 0.9608802f}, {0.4910284f, -0.9818295f, 0.4910284f, -1.963659f, 0.9641137f}, {0.4917637f, -0.9832996f, 0.4917637f, -1.9665993f, 0.9670547f}, {0.49243f, -0.984632f, 0.49243f, -1.969264f, 0.96972f}, {0.4930326f, -0.9858368f, 0.4930326f, -1.9716736f, 0.9721302f}, {0.4935768f, -0.9869251f, 0.4935768f, -1.9738501f, 0.9743072f}, {0.4940682f, -0.9879077f, 0.4940682f, -1.9758154f, 0.976273f}, {0.4945121f, -0.9887952f, 0.4945121f, -1.9775905f, 0.9780484f}, {0.4949133f, -0.9895975f, 0.4949133f, -1.979195f, 0.9796533f}, {0.4952764f, -0.9903234f, 0.4952764f, -1.9806468f, 0.9811054f}, {0.4956053f, -0.9909812f, 0.4956053f, -1.9819623f, 0.9824213f}, {0.4959038f, -0.9915781f, 0.4959038f, -1.9831561f, 0.9836154f}, {0.4961752f, -0.9921207f, 0.4961752f, -1.9842413f, 0.9847008f}, {0.4964223f, -0.9926147f, 0.4964223f, -1.9852295f, 0.9856892f}, {0.4966477f, -0.9930655f, 0.4966477f, -1.9861309f, 0.9865909f}, {0.4968537f, -0.9934774f, 0.4968537f, -1.9869548f, 0.9874149f}, {0.4970423f, -0.9938545f, 0.4970423f, -1.9877091f, 0.9881693f}, {0.4972153f, -0.9942005f, 0.4972153f, -1.9884009f, 0.9888614f}, {0.4973743f, -0.9945183f, 0.4973743f, -1.9890367f, 0.9894973f}, {0.4975207f, -0.994811f, 0.4975207f, -1.9896219f, 0.9900826f}, {0.4976556f, -0.9950808f, 0.4976556f, -1.9901616f, 0.9906224f}, {0.4977803f, -0.99533f, 0.4977803f, -1.9906601f, 0.9911211f}, {0.4978956f, -0.9955607f, 0.4978956f, -1.9911213f, 0.9915824f}, {0.4980025f, -0.9957744f, 0.4980025f, -1.9915488f, 0.99201f}, {0.4981017f, -0.9959728f, 0.4981017f, -1.9919455f, 0.9924068f}, {0.4981939f, -0.9961572f, 0.4981939f, -1.9923144f, 0.9927757f}, {0.4982798f, -0.9963289f, 0.4982798f, -1.9926578f, 0.9931192f}, {0.4983599f, -0.996489f, 0.4983599f, -1.992978f, 0.9934395f}, {0.4984346f, -0.9966384f, 0.4984346f, -1.9932769f, 0.9937384f}, {0.4985045f, -0.9967782f, 0.4985045f, -1.9935563f, 0.994018f}, {0.4985699f, -0.996909f, 0.4985699f, -1.9938179f, 0.9942796f}, {0.4986312f, -0.9970316f, 0.4986312f, -1.9940631f, 0.9945249f}, {0.4986888f, -0.9971466f, 0.4986888f, -1.9942933f, 0.9947551f}, {0.4987441f, -0.9972573f, 0.4987441f, -1.9945146f, 0.9949765f}, {0.4987991f, -0.9973673f, 0.4987991f, -1.9947347f, 0.9951966f}, {0.4988537f, -0.9974764f, 0.4988537f, -1.9949528f, 0.9954148f}, {0.4989076f, -0.9975842f, 0.4989076f, -1.9951685f, 0.9956305f}, {0.4989607f, -0.9976904f, 0.4989607f, -1.9953808f, 0.9958428f}, {0.4990128f, -0.9977945f, 0.4990128f, -1.9955891f, 0.9960512f}, {0.4990637f, -0.9978963f, 0.4990637f, -1.9957926f, 0.9962548f}, {0.4991133f, -0.9979954f, 0.4991133f, -1.9959908f, 0.996453f}, {0.4991613f, -0.9980915f, 0.4991613f, -1.9961831f, 0.9966453f}, {0.4992078f, -0.9981844f, 0.4992078f, -1.9963689f, 0.9968312f}, {0.4992525f, -0.9982739f, 0.4992525f, -1.9965479f, 0.9970102f}, {0.4992955f, -0.9983598f, 0.4992955f, -1.9967196f, 0.997182f}, {0.4993366f, -0.998442f, 0.4993366f, -1.996884f, 0.9973464f}, {0.4993758f, -0.9985204f, 0.4993758f, -1.9970409f, 0.9975033f}, {0.4994131f, -0.998595f, 0.4994131f, -1.9971901f, 0.9976526f}, {0.4994486f, -0.9986659f, 0.4994486f, -1.9973317f, 0.9977942f}, {0.4994821f, -0.9987329f, 0.4994821f, -1.9974658f, 0.9979283f}, {0.4995138f, -0.9987962f, 0.4995138f, -1.9975925f, 0.9980551f}, {0.4995436f, -0.998856f, 0.4995436f, -1.997712f, 0.9981746f}},
-  {{0.4774298f, -0.9545838f, 0.4774298f, -1.9091675f, 0.9097194f}, {0.4775969f, -0.9549178f, 0.4775969f, -1.9098356f, 0.9103877f}, {0.4780836f, -0.955891f, 0.4780836f, -1.911782f, 0.9123346f}, {0.4788495f, -0.9574222f, 0.4788495f, -1.9148445f, 0.915398f}, {0.479836f, -0.9593946f, 0.479836f, -1.9187892f, 0.9193439f}, {0.4809767f, -0.9616754f, 0.4809767f, -1.9233509f, 0.9239069f}, {0.482207f, -0.9641353f, 0.482207f, -1.9282707f, 0.9288281f}, {0.4834704f, -0.9666614f, 0.4834704f, -1.9333228f, 0.9338817f}, {0.4847221f, -0.9691641f, 0.4847221f, -1.9383282f, 0.9388885f}, {0.4859297f, -0.9715785f, 0.4859297f, -1.943157f, 0.9437187f}, {0.4870717f, -0.9738619f, 0.4870717f, -1.9477238f, 0.9482868f}, {0.488136f, -0.97599f, 0.488136f, -1.9519799f, 0.9525442f}, {0.4891173f, -0.9779519f, 0.4891173f, -1.9559038f, 0.9564692f}, {0.490015f, -0.9797467f, 0.490015f, -1.9594934f, 0.9600598f}, {0.4908317f, -0.9813797f, 0.4908317f, -1.9627594f, 0.9633268f}, {0.4915721f, -0.9828602f, 0.4915721f, -1.9657203f, 0.9662886f}, {0.4922419f, -0.9841993f, 0.4922419f, -1.9683986f, 0.9689676f}, {0.492847f, -0.9854092f, 0.492847f, -1.9708184f, 0.9713881f}, {0.4933935f, -0.9865019f, 0.4933935f, -1.9730039f, 0.9735742f}, {0.4938873f, -0.9874891f, 0.4938873f, -1.9749782f, 0.9755491f}, {0.4943336f, -0.9883816f, 0.4943336f, -1.9767631f, 0.9773346f}, {0.4947376f, -0.9891893f, 0.4947376f, -1.9783786f, 0.9789505f}, {0.4951037f, -0.9899213f, 0.4951037f, -1.9798426f, 0.9804149f}, {0.495436f, -0.9905857f, 0.495436f, -1.9811713f, 0.981744f}, {0.4957381f, -0.9911897f, 0.4957381f, -1.9823793f, 0.9829524f}, {0.4960132f, -0.9917397f, 0.4960132f, -1.9834795f, 0.9840528f}, {0.4962642f, -0.9922416f, 0.4962642f, -1.9844831f, 0.9850568f}, {0.4964936f, -0.9927003f, 0.4964936f, -1.9854005f, 0.9859744f}, {0.4967037f, -0.9931203f, 0.4967037f, -1.9862405f, 0.9868147f}, {0.4968964f, -0.9935055f, 0.4968964f, -1.987011f, 0.9875854f}, {0.4970734f, -0.9938596f, 0.4970734f, -1.9877192f, 0.9882937f}, {0.4972365f, -0.9941855f, 0.4972365f, -1.988371f, 0.9889458f}, {0.4973868f, -0.9944861f, 0.4973868f, -1.9889722f, 0.9895472f}, {0.4975257f, -0.9947638f, 0.4975257f, -1.9895276f, 0.9901027f}, {0.4976542f, -0.9950207f, 0.4976542f, -1.9900414f, 0.9906167f}, {0.4977733f, -0.9952588f, 0.4977733f, -1.9905177f, 0.9910931f}, {0.4978838f, -0.9954799f, 0.4978838f, -1.9909598f, 0.9915353f}, {0.4979866f, -0.9956854f, 0.4979866f, -1.9913707f, 0.9919464f}, {0.4980823f, -0.9958767f, 0.4980823f, -1.9917534f, 0.9923291f}, {0.4981715f, -0.9960551f, 0.4981715f, -1.9921102f, 0.992686f}, {0.4982548f, -0.9962216f, 0.4982548f, -1.9924433f, 0.9930192f}, {0.4983327f, -0.9963774f, 0.4983327f, -1.9927547f, 0.9933307f}, {0.4984056f, -0.9965231f, 0.4984056f, -1.9930463f, 0.9936224f}, {0.4984739f, -0.9966598f, 0.4984739f, -1.9933195f, 0.9938957f}, {0.4985381f, -0.996788f, 0.4985381f, -1.993576f, 0.9941523f}, {0.4985998f, -0.9969113f, 0.4985998f, -1.9938227f, 0.994399f}, {0.4986611f, -0.997034f, 0.4986611f, -1.994068f, 0.9946444f}, {0.4987219f, -0.9971556f, 0.4987219f, -1.9943112f, 0.9948876f}, {0.498782f, -0.9972757f, 0.498782f, -1.9945515f, 0.995128f}, {0.4988412f, -0.9973941f, 0.4988412f, -1.9947881f, 0.9953648f}, {0.4988993f, -0.9975102f, 0.4988993f, -1.9950203f, 0.995597f}, {0.498956f, -0.9976236f, 0.498956f, -1.9952472f, 0.995824f}, {0.4990112f, -0.9977341f, 0.4990112f, -1.9954682f, 0.996045f}, {0.4990648f, -0.9978412f, 0.4990648f, -1.9956825f, 0.9962594f}, {0.4991166f, -0.9979448f, 0.4991166f, -1.9958896f, 0.9964666f}, {0.4991665f, -0.9980446f, 0.4991665f, -1.9960891f, 0.9966661f}, {0.4992144f, -0.9981403f, 0.4992144f, -1.9962807f, 0.9968577f}, {0.4992603f, -0.998232f, 0.4992603f, -1.9964639f, 0.997041f}, {0.499304f, -0.9983194f, 0.499304f, -1.9966388f, 0.9972159f}, {0.4993456f, -0.9984026f, 0.4993456f, -1.9968051f, 0.9973823f}, {0.4993851f, -0.9984815f, 0.4993851f, -1.996963f, 0.9975403f}, {0.4994225f, -0.9985563f, 0.4994225f, -1.9971125f, 0.9976898f}, {0.4994578f, -0.9986269f, 0.4994578f, -1.9972538f, 0.9978311f}, {0.4994911f, -0.9986935f, 0.4994911f, -1.997387f, 0.9979644f}},
-  {{0.4749635f, -0.9495843f, 0.4749635f, -1.8991687f, 0.899854f}, {0.4751479f, -0.949953f, 0.4751479f, -1.8999059f, 0.9005915f}, {0.4756851f, -0.951027f, 0.4756851f, -1.9020541f, 0.9027404f}, {0.4765307f, -0.9527175f, 0.4765307f, -1.905435f, 0.9061226f}, {0.4776202f, -0.9548959f, 0.4776202f, -1.9097917f, 0.9104809f}, {0.4788808f, -0.9574161f, 0.4788808f, -1.9148323f, 0.9155232f}, {0.4802411f, -0.9601357f, 0.4802411f, -1.9202714f, 0.9209644f}, {0.4816388f, -0.9629301f, 0.4816388f, -1.9258601f, 0.926555f}, {0.4830243f, -0.9657001f, 0.4830243f, -1.9314003f, 0.9320972f}, {0.4843617f, -0.968374f, 0.4843617f, -1.9367479f, 0.9374468f}, {0.4856273f, -0.9709042f, 0.4856273f, -1.9418083f, 0.942509f}, {0.4868073f, -0.9732634f, 0.4868073f, -1.9465267f, 0.9472291f}, {0.4878957f, -0.9754394f, 0.4878957f, -1.9508788f, 0.9515828f}, {0.4888918f, -0.977431f, 0.4888918f, -1.954862f, 0.9555674f}, {0.4897985f, -0.9792437f, 0.4897985f, -1.9584875f, 0.9591942f}, {0.4906208f, -0.9808877f, 0.4906208f, -1.9617754f, 0.9624833f}, {0.4913649f, -0.9823752f, 0.4913649f, -1.9647505f, 0.9654594f}, {0.4920373f, -0.9837196f, 0.4920373f, -1.9674392f, 0.9681491f}, {0.4926448f, -0.9849341f, 0.4926448f, -1.9698682f, 0.970579f}, {0.4931937f, -0.9860315f, 0.4931937f, -1.9720631f, 0.9727747f}, {0.49369f, -0.9870239f, 0.49369f, -1.9740478f, 0.9747601f}, {0.4941394f, -0.9879222f, 0.4941394f, -1.9758444f, 0.9765574f}, {0.4945466f, -0.9887365f, 0.4945466f, -1.9774729f, 0.9781865f}, {0.4949163f, -0.9894756f, 0.4949163f, -1.9789512f, 0.9796653f}, {0.4952525f, -0.9901477f, 0.4952525f, -1.9802953f, 0.9810099f}, {0.4955587f, -0.9907598f, 0.4955587f, -1.9815196f, 0.9822346f}, {0.495838f, -0.9913183f, 0.495838f, -1.9826367f, 0.9833521f}, {0.4960934f, -0.9918289f, 0.4960934f, -1.9836578f, 0.9843736f}, {0.4963273f, -0.9922964f, 0.4963273f, -1.9845929f, 0.985309f}, {0.4965418f, -0.9927254f, 0.4965418f, -1.9854507f, 0.9861672f}, {0.496739f, -0.9931196f, 0.496739f, -1.9862392f, 0.9869559f}, {0.4969205f, -0.9934825f, 0.4969205f, -1.986965f, 0.987682f}, {0.4970879f, -0.9938172f, 0.4970879f, -1.9876345f, 0.9883517f}, {0.4972426f, -0.9941265f, 0.4972426f, -1.988253f, 0.9889704f}, {0.4973857f, -0.9944126f, 0.4973857f, -1.9888253f, 0.9895429f}, {0.4975184f, -0.9946779f, 0.4975184f, -1.9893557f, 0.9900735f}, {0.4976415f, -0.9949241f, 0.4976415f, -1.9898481f, 0.9905661f}, {0.497756f, -0.995153f, 0.497756f, -1.9903059f, 0.9910241f}, {0.4978626f, -0.9953661f, 0.4978626f, -1.9907321f, 0.9914505f}, {0.497962f, -0.9955648f, 0.497962f, -1.9911296f, 0.9918481f}, {0.4980548f, -0.9957503f, 0.4980548f, -1.9915007f, 0.9922193f}, {0.4981416f, -0.9959238f, 0.4981416f, -1.9918476f, 0.9925664f}, {0.4982228f, -0.9960862f, 0.4982228f, -1.9921725f, 0.9928913f}, {0.498299f, -0.9962385f, 0.498299f, -1.9924769f, 0.9931959f}, {0.4983704f, -0.9963814f, 0.4983704f, -1.9927627f, 0.9934818f}, {0.4984392f, -0.9965188f, 0.4984392f, -1.9930376f, 0.9937567f}, {0.4985075f, -0.9966554f, 0.4985075f, -1.9933109f, 0.9940301f}, {0.4985753f, -0.9967909f, 0.4985753f, -1.9935818f, 0.9943012f}, {0.4986423f, -0.9969248f, 0.4986423f, -1.9938497f, 0.9945691f}, {0.4987082f, -0.9970567f, 0.4987082f, -1.9941134f, 0.9948329f}, {0.4987729f, -0.997186f, 0.4987729f, -1.9943721f, 0.9950918f}, {0.4988362f, -0.9973125f, 0.4988362f, -1.994625f, 0.9953447f}, {0.4988978f, -0.9974356f, 0.4988978f, -1.9948712f, 0.995591f}, {0.4989575f, -0.997555f, 0.4989575f, -1.99511f, 0.99583f}, {0.4990152f, -0.9976704f, 0.4990152f, -1.9953409f, 0.9960609f}, {0.4990708f, -0.9977816f, 0.4990708f, -1.9955633f, 0.9962833f}, {0.4991242f, -0.9978884f, 0.4991242f, -1.9957767f, 0.9964969f}, {0.4991753f, -0.9979905f, 0.4991753f, -1.995981f, 0.9967012f}, {0.499224f, -0.9980879f, 0.499224f, -1.9961758f, 0.9968962f}, {0.4992704f, -0.9981806f, 0.4992704f, -1.9963613f, 0.9970817f}, {0.4993144f, -0.9982686f, 0.4993144f, -1.9965373f, 0.9972577f}, {0.4993561f, -0.998352f, 0.4993561f, -1.9967039f, 0.9974244f}, {0.4993955f, -0.9984307f, 0.4993955f, -1.9968614f, 0.9975819f}, {0.4994326f, -0.9985049f, 0.4994326f, -1.9970099f, 0.9977305f}},
-  {{0.4722493f, -0.9440734f, 0.4722493f, -1.8881469f, 0.8889974f}, {0.4724526f, -0.9444797f, 0.4724526f, -1.8889594f, 0.8898103f}, {0.4730447f, -0.9456635f, 0.4730447f, -1.891327f, 0.892179f}, {0.4739771f, -0.9475274f, 0.4739771f, -1.8950547f, 0.8959084f}, {0.475179f, -0.9499302f, 0.475179f, -1.8998603f, 0.9007161f}, {0.4765704f, -0.9527116f, 0.4765704f, -1.9054232f, 0.9062815f}, {0.4780727f, -0.9557148f, 0.4780727f, -1.9114296f, 0.9122907f}, {0.4796172f, -0.9588025f, 0.4796172f, -1.9176051f, 0.9184689f}, {0.4811493f, -0.9618654f, 0.4811493f, -1.9237307f, 0.9245973f}, {0.4826291f, -0.9648237f, 0.4826291f, -1.9296473f, 0.9305165f}, {0.4840303f, -0.9676247f, 0.4840303f, -1.9352494f, 0.9361211f}, {0.4853375f, -0.9702379f, 0.4853375f, -1.9404757f, 0.9413498f}, {0.4865438f, -0.9726494f, 0.4865438f, -1.9452989f, 0.9461752f}, {0.4876484f, -0.9748576f, 0.4876484f, -1.9497152f, 0.9505935f}, {0.4886542f, -0.9768684f, 0.4886542f, -1.9537368f, 0.9546169f}, {0.4895668f, -0.9786927f, 0.4895668f, -1.9573854f, 0.9582671f}, {0.4903928f, -0.980344f, 0.4903928f, -1.9606879f, 0.9615711f}, {0.4911395f, -0.9818368f, 0.4911395f, -1.9636736f, 0.9645581f}, {0.4918144f, -0.9831858f, 0.4918144f, -1.9663717f, 0.9672574f}, {0.4924243f, -0.9844052f, 0.4924243f, -1.9688103f, 0.9696972f}, {0.492976f, -0.985508f, 0.492976f, -1.971016f, 0.9719039f}, {0.4934755f, -0.9865065f, 0.4934755f, -1.9730131f, 0.9739018f}, {0.4939283f, -0.9874118f, 0.4939283f, -1.9748236f, 0.9757132f}, {0.4943394f, -0.9882337f, 0.4943394f, -1.9764674f, 0.9773577f}, {0.4947133f, -0.9889812f, 0.4947133f, -1.9779623f, 0.9788533f}, {0.4950539f, -0.9896621f, 0.4950539f, -1.9793241f, 0.9802157f}, {0.4953648f, -0.9902834f, 0.4953648f, -1.9805669f, 0.981459f}, {0.4956489f, -0.9908515f, 0.4956489f, -1.981703f, 0.9825956f}, {0.4959092f, -0.9913717f, 0.4959092f, -1.9827435f, 0.9836366f}, {0.4961479f, -0.9918491f, 0.4961479f, -1.9836982f, 0.9845917f}, {0.4963674f, -0.9922878f, 0.4963674f, -1.9845756f, 0.9854696f}, {0.4965695f, -0.9926918f, 0.4965695f, -1.9853836f, 0.9862779f}, {0.4967559f, -0.9930644f, 0.4967559f, -1.9861288f, 0.9870234f}, {0.4969281f, -0.9934086f, 0.4969281f, -1.9868173f, 0.9877122f}, {0.4970874f, -0.9937272f, 0.4970874f, -1.9874544f, 0.9883497f}, {0.4972351f, -0.9940225f, 0.4972351f, -1.988045f, 0.9889405f}, {0.4973723f, -0.9942966f, 0.4973723f, -1.9885933f, 0.989489f}, {0.4974998f, -0.9945515f, 0.4974998f, -1.989103f, 0.989999f}, {0.4976185f, -0.9947888f, 0.4976185f, -1.9895777f, 0.9904739f}, {0.4977292f, -0.9950101f, 0.4977292f, -1.9900203f, 0.9909167f}, {0.4978325f, -0.9952168f, 0.4978325f, -1.9904335f, 0.9913301f}, {0.4979292f, -0.99541f, 0.4979292f, -1.9908199f, 0.9917167f}, {0.4980197f, -0.9955909f, 0.4980197f, -1.9911817f, 0.9920787f}, {0.4981045f, -0.9957604f, 0.4981045f, -1.9915208f, 0.9924179f}, {0.4981841f, -0.9959196f, 0.4981841f, -1.9918391f, 0.9927364f}, {0.4982607f, -0.9960726f, 0.4982607f, -1.9921453f, 0.9930426f}, {0.4983368f, -0.9962248f, 0.4983368f, -1.9924497f, 0.9933472f}, {0.4984123f, -0.9963758f, 0.4984123f, -1.9927516f, 0.9936492f}, {0.4984869f, -0.9965249f, 0.4984869f, -1.9930499f, 0.9939477f}, {0.4985604f, -0.9966718f, 0.4985604f, -1.9933437f, 0.9942416f}, {0.4986325f, -0.9968159f, 0.4986325f, -1.9936319f, 0.9945299f}, {0.4987029f, -0.9969568f, 0.4987029f, -1.9939136f, 0.9948118f}, {0.4987716f, -0.997094f, 0.4987716f, -1.9941879f, 0.9950862f}, {0.4988381f, -0.997227f, 0.4988381f, -1.994454f, 0.9953525f}, {0.4989024f, -0.9973556f, 0.4989024f, -1.9947113f, 0.9956098f}, {0.4989644f, -0.9974795f, 0.4989644f, -1.994959f, 0.9958576f}, {0.4990239f, -0.9975984f, 0.4990239f, -1.9951968f, 0.9960956f}, {0.4990808f, -0.9977122f, 0.4990808f, -1.9954244f, 0.9963233f}, {0.4991351f, -0.9978208f, 0.4991351f, -1.9956416f, 0.9965405f}, {0.4991868f, -0.9979241f, 0.4991868f, -1.9958482f, 0.9967472f}, {0.4992359f, -0.9980222f, 0.4992359f, -1.9960443f, 0.9969434f}, {0.4992823f, -0.998115f, 0.4992823f, -1.99623f, 0.9971292f}, {0.4993262f, -0.9982027f, 0.4993262f, -1.9964055f, 0.9973048f}, {0.4993676f, -0.9982855f, 0.4993676f, -1.996571f, 0.9974703f}},
-  {{0.4692675f, -0.9380074f, 0.4692675f, -1.8760149f, 0.8770698f}, {0.4694911f, -0.9384545f, 0.4694911f, -1.876909f, 0.8779644f}, {0.4701429f, -0.9397574f, 0.4701429f, -1.8795148f, 0.8805717f}, {0.4711695f, -0.9418094f, 0.4711695f, -1.8836189f, 0.8846781f}, {0.4724936f, -0.9444561f, 0.4724936f, -1.8889122f, 0.8899744f}, {0.4740273f, -0.9475217f, 0.4740273f, -1.8950434f, 0.896109f}, {0.4756843f, -0.9508339f, 0.4756843f, -1.9016678f, 0.9027371f}, {0.4773891f, -0.9542416f, 0.4773891f, -1.9084833f, 0.9095565f}, {0.4790814f, -0.9576243f, 0.4790814f, -1.9152486f, 0.9163256f}, {0.480717f, -0.9608937f, 0.480717f, -1.9217875f, 0.9228682f}, {0.4822667f, -0.9639914f, 0.4822667f, -1.9279828f, 0.929067f}, {0.4837134f, -0.9668831f, 0.4837134f, -1.9337663f, 0.9348537f}, {0.4850493f, -0.9695533f, 0.4850493f, -1.9391066f, 0.940197f}, {0.4862731f, -0.9719995f, 0.4862731f, -1.943999f, 0.9450922f}, {0.487388f, -0.9742282f, 0.487388f, -1.9484563f, 0.949552f}, {0.4884f, -0.976251f, 0.4884f, -1.952502f, 0.9535999f}, {0.4893164f, -0.9780827f, 0.4893164f, -1.9561654f, 0.9572654f}, {0.4901451f, -0.9797393f, 0.4901451f, -1.9594785f, 0.9605804f}, {0.4908942f, -0.9812367f, 0.4908942f, -1.9624734f, 0.963577f}, {0.4915716f, -0.9825906f, 0.4915716f, -1.9651812f, 0.9662863f}, {0.4921844f, -0.9838155f, 0.4921844f, -1.967631f, 0.9687374f}, {0.4927393f, -0.9849248f, 0.4927393f, -1.9698495f, 0.9709572f}, {0.4932425f, -0.9859307f, 0.4932425f, -1.9718613f, 0.9729701f}, {0.4936995f, -0.9868441f, 0.4936995f, -1.9736882f, 0.9747981f}, {0.4941152f, -0.987675f, 0.4941152f, -1.9753499f, 0.9764607f}, {0.4944939f, -0.988432f, 0.4944939f, -1.9768639f, 0.9779756f}, {0.4948395f, -0.9891229f, 0.4948395f, -1.9782457f, 0.9793582f}, {0.4951556f, -0.9897546f, 0.4951556f, -1.9795092f, 0.9806223f}, {0.4954451f, -0.9903332f, 0.4954451f, -1.9806664f, 0.9817802f}, {0.4957107f, -0.9908642f, 0.4957107f, -1.9817284f, 0.9828428f}, {0.4959549f, -0.9913523f, 0.4959549f, -1.9827045f, 0.9838195f}, {0.4961797f, -0.9918017f, 0.4961797f, -1.9836034f, 0.9847189f}, {0.4963871f, -0.9922163f, 0.4963871f, -1.9844326f, 0.9855485f}, {0.4965788f, -0.9925994f, 0.4965788f, -1.9851987f, 0.986315f}, {0.4967561f, -0.9929539f, 0.4967561f, -1.9859077f, 0.9870245f}, {0.4969205f, -0.9932825f, 0.4969205f, -1.986565f, 0.9876821f}, {0.4970732f, -0.9935876f, 0.4970732f, -1.9871752f, 0.9882927f}, {0.4972151f, -0.9938713f, 0.4972151f, -1.9877426f, 0.9888604f}, {0.4973473f, -0.9941355f, 0.4973473f, -1.9882709f, 0.989389f}, {0.4974705f, -0.9943818f, 0.4974705f, -1.9887636f, 0.989882f}, {0.4975856f, -0.9946119f, 0.4975856f, -1.9892237f, 0.9903423f}, {0.4976932f, -0.9948269f, 0.4976932f, -1.9896539f, 0.9907727f}, {0.4977939f, -0.9950283f, 0.4977939f, -1.9900567f, 0.9911757f}, {0.4978884f, -0.9952171f, 0.4978884f, -1.9904342f, 0.9915535f}, {0.497977f, -0.9953943f, 0.497977f, -1.9907886f, 0.9919081f}, {0.4980623f, -0.9955648f, 0.4980623f, -1.9911295f, 0.9922492f}, {0.4981471f, -0.9957342f, 0.4981471f, -1.9914685f, 0.9925883f}, {0.4982312f, -0.9959023f, 0.4982312f, -1.9918046f, 0.9929247f}, {0.4983143f, -0.9960684f, 0.4983143f, -1.9921368f, 0.9932571f}, {0.4983961f, -0.996232f, 0.4983961f, -1.992464f, 0.9935844f}, {0.4984764f, -0.9963925f, 0.4984764f, -1.992785f, 0.9939056f}, {0.4985549f, -0.9965494f, 0.4985549f, -1.9930987f, 0.9942195f}, {0.4986313f, -0.9967021f, 0.4986313f, -1.9934042f, 0.9945252f}, {0.4987054f, -0.9968503f, 0.4987054f, -1.9937006f, 0.9948217f}, {0.4987771f, -0.9969935f, 0.4987771f, -1.9939871f, 0.9951084f}, {0.4988461f, -0.9971315f, 0.4988461f, -1.994263f, 0.9953845f}, {0.4989124f, -0.997264f, 0.4989124f, -1.9945279f, 0.9956495f}, {0.4989758f, -0.9973907f, 0.4989758f, -1.9947815f, 0.9959032f}, {0.4990363f, -0.9975117f, 0.4990363f, -1.9950233f, 0.9961452f}, {0.4990939f, -0.9976268f, 0.4990939f, -1.9952535f, 0.9963755f}, {0.4991485f, -0.997736f, 0.4991485f, -1.995472f, 0.9965941f}, {0.4992003f, -0.9978394f, 0.4992003f, -1.9956788f, 0.9968011f}, {0.4992492f, -0.9979372f, 0.4992492f, -1.9958743f, 0.9969966f}, {0.4992953f, -0.9980293f, 0.4992953f, -1.9960587f, 0.9971811f}},
-  {{0.4659973f, -0.9313409f, 0.4659973f, -1.8626818f, 0.8639894f}, {0.4662431f, -0.931832f, 0.4662431f, -1.863664f, 0.8649723f}, {0.4669594f, -0.9332637f, 0.4669594f, -1.8665273f, 0.8678376f}, {0.468088f, -0.9355193f, 0.468088f, -1.8710387f, 0.8723521f}, {0.4695445f, -0.9384302f, 0.4695445f, -1.8768604f, 0.878178f}, {0.4712326f, -0.941804f, 0.4712326f, -1.883608f, 0.8849303f}, {0.4730578f, -0.9454518f, 0.4730578f, -1.8909036f, 0.892231f}, {0.474937f, -0.9492077f, 0.474937f, -1.8984154f, 0.8997481f}, {0.4768039f, -0.9529389f, 0.4768039f, -1.9058778f, 0.9072157f}, {0.4786097f, -0.9565479f, 0.4786097f, -1.9130958f, 0.9144388f}, {0.4803218f, -0.9599697f, 0.4803218f, -1.9199395f, 0.9212873f}, {0.4819212f, -0.9631663f, 0.4819212f, -1.9263326f, 0.9276849f}, {0.483399f, -0.9661198f, 0.483399f, -1.9322396f, 0.933596f}, {0.4847536f, -0.9688272f, 0.4847536f, -1.9376543f, 0.9390145f}, {0.4859884f, -0.971295f, 0.4859884f, -1.9425901f, 0.9439538f}, {0.4871098f, -0.9735361f, 0.4871098f, -1.9470722f, 0.948439f}, {0.4881256f, -0.9755663f, 0.4881256f, -1.9511326f, 0.9525023f}, {0.4890446f, -0.9774031f, 0.4890446f, -1.9548062f, 0.9561785f}, {0.4898757f, -0.9790641f, 0.4898757f, -1.9581282f, 0.9595028f}, {0.4906273f, -0.9805663f, 0.4906273f, -1.9611326f, 0.9625093f}, {0.4913076f, -0.9819258f, 0.4913076f, -1.9638516f, 0.9652302f}, {0.4919238f, -0.9831573f, 0.4919238f, -1.9663146f, 0.967695f}, {0.4924826f, -0.9842743f, 0.4924826f, -1.9685486f, 0.9699306f}, {0.4929903f, -0.9852889f, 0.4929903f, -1.9705778f, 0.9719611f}, {0.4934521f, -0.9862119f, 0.4934521f, -1.9724238f, 0.9738084f}, {0.493873f, -0.987053f, 0.493873f, -1.974106f, 0.9754919f}, {0.4942571f, -0.9878208f, 0.4942571f, -1.9756416f, 0.9770286f}, {0.4946085f, -0.988523f, 0.4946085f, -1.9770459f, 0.9784338f}, {0.4949303f, -0.9891662f, 0.4949303f, -1.9783324f, 0.9797212f}, {0.4952257f, -0.9897565f, 0.4952257f, -1.979513f, 0.9809026f}, {0.4954972f, -0.9902992f, 0.4954972f, -1.9805984f, 0.9819888f}, {0.4957473f, -0.990799f, 0.4957473f, -1.981598f, 0.9829891f}, {0.495978f, -0.99126f, 0.495978f, -1.9825201f, 0.9839118f}, {0.4961911f, -0.9916861f, 0.4961911f, -1.9833722f, 0.9847645f}, {0.4963884f, -0.9920804f, 0.4963884f, -1.9841609f, 0.9855538f}, {0.4965714f, -0.992446f, 0.4965714f, -1.984892f, 0.9862854f}, {0.4967412f, -0.9927854f, 0.4967412f, -1.9855709f, 0.9869648f}, {0.4968991f, -0.9931011f, 0.4968991f, -1.9862021f, 0.9875965f}, {0.4970462f, -0.993395f, 0.4970462f, -1.98679f, 0.9881847f}, {0.4971833f, -0.9936691f, 0.4971833f, -1.9873382f, 0.9887333f}, {0.4973114f, -0.9939251f, 0.4973114f, -1.9878501f, 0.9892456f}, {0.4974312f, -0.9941644f, 0.4974312f, -1.9883289f, 0.9897247f}, {0.4975433f, -0.9943885f, 0.4975433f, -1.9887771f, 0.9901732f}, {0.4976484f, -0.9945986f, 0.4976484f, -1.9891973f, 0.9905937f}, {0.4977471f, -0.9947959f, 0.4977471f, -1.9895917f, 0.9909884f}, {0.497842f, -0.9949856f, 0.497842f, -1.9899711f, 0.9913681f}, {0.4979364f, -0.9951742f, 0.4979364f, -1.9903484f, 0.9917456f}, {0.49803f, -0.9953613f, 0.49803f, -1.9907226f, 0.9921201f}, {0.4981225f, -0.9955462f, 0.4981225f, -1.9910924f, 0.9924901f}, {0.4982136f, -0.9957283f, 0.4982136f, -1.9914565f, 0.9928546f}, {0.498303f, -0.9959069f, 0.498303f, -1.9918139f, 0.9932121f}, {0.4983904f, -0.9960816f, 0.4983904f, -1.9921632f, 0.9935617f}, {0.4984755f, -0.9962516f, 0.4984755f, -1.9925033f, 0.993902f}, {0.4985581f, -0.9964166f, 0.4985581f, -1.9928333f, 0.9942322f}, {0.4986379f, -0.9965761f, 0.4986379f, -1.9931522f, 0.9945514f}, {0.4987147f, -0.9967297f, 0.4987147f, -1.9934595f, 0.9948589f}, {0.4987885f, -0.9968772f, 0.4987885f, -1.9937544f, 0.995154f}, {0.4988591f, -0.9970183f, 0.4988591f, -1.9940367f, 0.9954365f}, {0.4989265f, -0.997153f, 0.4989265f, -1.994306f, 0.9957061f}, {0.4989906f, -0.9972812f, 0.4989906f, -1.9945623f, 0.9959625f}, {0.4990515f, -0.9974028f, 0.4990515f, -1.9948056f, 0.996206f}, {0.4991091f, -0.997518f, 0.4991091f, -1.995036f, 0.9964365f}, {0.4991636f, -0.9976268f, 0.4991636f, -1.9952536f, 0.9966543f}, {0.4992149f, -0.9977295f, 0.4992149f, -1.995459f, 0.9968598f}},
-  {{0.4624183f, -0.9240268f, 0.4624183f, -1.8480536f, 0.8496732f}, {0.4626878f, -0.9245654f, 0.4626878f, -1.8491307f, 0.8507513f}, {0.4634737f, -0.9261357f, 0.4634737f, -1.8522714f, 0.8538948f}, {0.4647124f, -0.928611f, 0.4647124f, -1.8572219f, 0.8588496f}, {0.4663118f, -0.931807f, 0.4663118f, -1.8636141f, 0.8652473f}, {0.4681669f, -0.935514f, 0.4681669f, -1.871028f, 0.8726677f}, {0.4701743f, -0.9395252f, 0.4701743f, -1.8790505f, 0.8806973f}, {0.4722429f, -0.9436588f, 0.4722429f, -1.8873176f, 0.8889717f}, {0.4742996f, -0.9477686f, 0.4742996f, -1.8955373f, 0.8971985f}, {0.4762907f, -0.9517472f, 0.4762907f, -1.9034944f, 0.9051626f}, {0.4781799f, -0.9555225f, 0.4781799f, -1.9110449f, 0.9127198f}, {0.4799462f, -0.9590518f, 0.4799462f, -1.9181036f, 0.9197846f}, {0.4815792f, -0.9623151f, 0.4815792f, -1.9246301f, 0.9263169f}, {0.4830771f, -0.9653083f, 0.4830771f, -1.9306166f, 0.9323086f}, {0.4844434f, -0.9680384f, 0.4844434f, -1.9360767f, 0.9377735f}, {0.4856847f, -0.9705188f, 0.4856847f, -1.9410376f, 0.9427388f}, {0.4868098f, -0.972767f, 0.4868098f, -1.945534f, 0.9472391f}, {0.4878281f, -0.9748019f, 0.4878281f, -1.9496038f, 0.9513125f}, {0.4887494f, -0.9766428f, 0.4887494f, -1.9532855f, 0.9549974f}, {0.4895828f, -0.9783083f, 0.4895828f, -1.9566166f, 0.9583314f}, {0.4903374f, -0.979816f, 0.4903374f, -1.9596321f, 0.9613495f}, {0.4910211f, -0.9811823f, 0.4910211f, -1.9623645f, 0.9640843f}, {0.4916414f, -0.9824218f, 0.4916414f, -1.9648435f, 0.9665655f}, {0.4922049f, -0.9835479f, 0.4922049f, -1.9670958f, 0.9688197f}, {0.4927177f, -0.9845726f, 0.4927177f, -1.9691452f, 0.9708709f}, {0.4931851f, -0.9855066f, 0.4931851f, -1.9710131f, 0.9727405f}, {0.4936119f, -0.9863593f, 0.4936119f, -1.9727186f, 0.9744475f}, {0.4940022f, -0.9871393f, 0.4940022f, -1.9742785f, 0.9760088f}, {0.4943598f, -0.9878539f, 0.4943598f, -1.9757077f, 0.9774392f}, {0.4946881f, -0.9885098f, 0.4946881f, -1.9770195f, 0.9787522f}, {0.4949899f, -0.9891128f, 0.4949899f, -1.9782257f, 0.9799594f}, {0.4952678f, -0.9896683f, 0.4952678f, -1.9793366f, 0.9810713f}, {0.4955243f, -0.9901808f, 0.4955243f, -1.9803616f, 0.9820972f}, {0.4957613f, -0.9906544f, 0.4957613f, -1.9813088f, 0.9830453f}, {0.4959807f, -0.9910928f, 0.4959807f, -1.9821856f, 0.9839228f}, {0.4961841f, -0.9914993f, 0.4961841f, -1.9829985f, 0.9847365f}, {0.496373f, -0.9918767f, 0.496373f, -1.9837534f, 0.985492f}, {0.4965486f, -0.9922277f, 0.4965486f, -1.9844553f, 0.9861945f}, {0.4967122f, -0.9925545f, 0.4967122f, -1.9851091f, 0.9868488f}, {0.4968648f, -0.9928594f, 0.4968648f, -1.9857188f, 0.9874591f}, {0.4970072f, -0.9931441f, 0.4970072f, -1.9862882f, 0.988029f}, {0.4971405f, -0.9934103f, 0.4971405f, -1.9868207f, 0.9885619f}, {0.4972652f, -0.9936596f, 0.4972652f, -1.9873192f, 0.9890609f}, {0.4973822f, -0.9938933f, 0.4973822f, -1.9877867f, 0.9895288f}, {0.497492f, -0.9941127f, 0.497492f, -1.9882254f, 0.9899679f}, {0.4975976f, -0.9943238f, 0.4975976f, -1.9886475f, 0.9903904f}, {0.4977026f, -0.9945336f, 0.4977026f, -1.9890673f, 0.9908105f}, {0.4978068f, -0.9947418f, 0.4978068f, -1.9894836f, 0.9912272f}, {0.4979097f, -0.9949475f, 0.4979097f, -1.989895f, 0.991639f}, {0.4980111f, -0.9951501f, 0.4980111f, -1.9903003f, 0.9920446f}, {0.4981106f, -0.9953489f, 0.4981106f, -1.9906979f, 0.9924425f}, {0.4982079f, -0.9955433f, 0.4982079f, -1.9910865f, 0.9928315f}, {0.4983026f, -0.9957325f, 0.4983026f, -1.991465f, 0.9932104f}, {0.4983945f, -0.9959161f, 0.4983945f, -1.9918323f, 0.9935779f}, {0.4984833f, -0.9960936f, 0.4984833f, -1.9921872f, 0.9939332f}, {0.4985689f, -0.9962646f, 0.4985689f, -1.9925292f, 0.9942754f}, {0.498651f, -0.9964287f, 0.498651f, -1.9928575f, 0.994604f}, {0.4987296f, -0.9965858f, 0.4987296f, -1.9931716f, 0.9949185f}, {0.4988046f, -0.9967357f, 0.4988046f, -1.9934714f, 0.9952185f}, {0.498876f, -0.9968784f, 0.498876f, -1.9937567f, 0.9955041f}, {0.4989438f, -0.9970138f, 0.4989438f, -1.9940275f, 0.9957751f}, {0.4990079f, -0.997142f, 0.4990079f, -1.9942839f, 0.9960317f}, {0.4990686f, -0.9972631f, 0.4990686f, -1.9945263f, 0.9962743f}, {0.4991258f, -0.9973774f, 0.4991258f, -1.9947548f, 0.996503f}},
-  {{0.4585097f, -0.9160172f, 0.4585097f, -1.8320343f, 0.8340389f}, {0.4588048f, -0.9166066f, 0.4588048f, -1.8332133f, 0.8352191f}, {0.4596653f, -0.9183258f, 0.4596653f, -1.8366516f, 0.8386612f}, {0.4610223f, -0.9210368f, 0.4610223f, -1.8420736f, 0.8440892f}, {0.4627756f, -0.9245396f, 0.4627756f, -1.8490791f, 0.8511023f}, {0.4648107f, -0.9286054f, 0.4648107f, -1.8572108f, 0.8592429f}, {0.4670148f, -0.9330088f, 0.4670148f, -1.8660176f, 0.8680593f}, {0.4692883f, -0.9375507f, 0.4692883f, -1.8751014f, 0.877153f}, {0.4715507f, -0.9420706f, 0.4715507f, -1.8841413f, 0.8862028f}, {0.4737429f, -0.9464502f, 0.4737429f, -1.8929005f, 0.8949716f}, {0.4758249f, -0.9506097f, 0.4758249f, -1.9012194f, 0.9032996f}, {0.4777729f, -0.9545014f, 0.4777729f, -1.9090028f, 0.9110915f}, {0.4795754f, -0.9581025f, 0.4795754f, -1.9162049f, 0.9183016f}, {0.4812299f, -0.9614079f, 0.4812299f, -1.9228158f, 0.9249197f}, {0.4827399f, -0.9644247f, 0.4827399f, -1.9288493f, 0.9309598f}, {0.4841127f, -0.9671672f, 0.4841127f, -1.9343344f, 0.9364509f}, {0.4853576f, -0.9696543f, 0.4853576f, -1.9393086f, 0.9414305f}, {0.486485f, -0.9719065f, 0.486485f, -1.943813f, 0.9459399f}, {0.4875053f, -0.9739449f, 0.4875053f, -1.9478897f, 0.9500211f}, {0.4884287f, -0.9757898f, 0.4884287f, -1.9515796f, 0.9537149f}, {0.489265f, -0.9774606f, 0.489265f, -1.9549211f, 0.9570601f}, {0.4900231f, -0.978975f, 0.4900231f, -1.95795f, 0.9600923f}, {0.490711f, -0.9803494f, 0.490711f, -1.9606987f, 0.962844f}, {0.4913362f, -0.9815983f, 0.4913362f, -1.9631967f, 0.9653447f}, {0.4919052f, -0.9827351f, 0.4919052f, -1.9654703f, 0.9676208f}, {0.492424f, -0.9837715f, 0.492424f, -1.967543f, 0.9696958f}, {0.4928977f, -0.9847179f, 0.4928977f, -1.9694358f, 0.9715907f}, {0.493331f, -0.9855837f, 0.493331f, -1.9711674f, 0.9733241f}, {0.4937282f, -0.9863771f, 0.4937282f, -1.9727541f, 0.9749126f}, {0.4940927f, -0.9871054f, 0.4940927f, -1.9742108f, 0.9763709f}, {0.494428f, -0.9877752f, 0.494428f, -1.9755503f, 0.9777119f}, {0.4947368f, -0.9883921f, 0.4947368f, -1.9767842f, 0.9789472f}, {0.4950217f, -0.9889614f, 0.4950217f, -1.9779228f, 0.980087f}, {0.4952851f, -0.9894876f, 0.4952851f, -1.9789752f, 0.9811405f}, {0.4955289f, -0.9899747f, 0.4955289f, -1.9799494f, 0.9821158f}, {0.495755f, -0.9904263f, 0.495755f, -1.9808527f, 0.9830201f}, {0.495965f, -0.9908458f, 0.495965f, -1.9816915f, 0.9838598f}, {0.4961602f, -0.9912358f, 0.4961602f, -1.9824717f, 0.9846408f}, {0.4963421f, -0.9915991f, 0.4963421f, -1.9831983f, 0.9853682f}, {0.4965117f, -0.991938f, 0.4965117f, -1.983876f, 0.9860467f}, {0.4966701f, -0.9922545f, 0.4966701f, -1.984509f, 0.9866803f}, {0.4968182f, -0.9925505f, 0.4968182f, -1.9851009f, 0.9872729f}, {0.496957f, -0.9928276f, 0.496957f, -1.9856552f, 0.9878278f}, {0.497087f, -0.9930875f, 0.497087f, -1.9861749f, 0.9883481f}, {0.4972091f, -0.9933314f, 0.4972091f, -1.9866628f, 0.9888365f}, {0.4973266f, -0.9935661f, 0.4973266f, -1.9871321f, 0.9893064f}, {0.4974434f, -0.9937994f, 0.4974434f, -1.9875989f, 0.9897736f}, {0.4975593f, -0.9940309f, 0.4975593f, -1.9880618f, 0.9902371f}, {0.4976738f, -0.9942597f, 0.4976738f, -1.9885194f, 0.9906951f}, {0.4977866f, -0.994485f, 0.4977866f, -1.98897f, 0.9911463f}, {0.4978973f, -0.9947061f, 0.4978973f, -1.9894123f, 0.991589f}, {0.4980054f, -0.9949223f, 0.4980054f, -1.9898446f, 0.9920218f}, {0.4981108f, -0.9951328f, 0.4981108f, -1.9902656f, 0.9924432f}, {0.498213f, -0.995337f, 0.498213f, -1.990674f, 0.9928521f}, {0.4983119f, -0.9955344f, 0.4983119f, -1.9910689f, 0.9932474f}, {0.4984071f, -0.9957246f, 0.4984071f, -1.9914493f, 0.9936282f}, {0.4984985f, -0.9959072f, 0.4984985f, -1.9918145f, 0.9939939f}, {0.4985859f, -0.996082f, 0.4985859f, -1.992164f, 0.9943438f}, {0.4986694f, -0.9962488f, 0.4986694f, -1.9924976f, 0.9946777f}, {0.4987489f, -0.9964075f, 0.4987489f, -1.992815f, 0.9949954f}, {0.4988243f, -0.9965581f, 0.4988243f, -1.9931162f, 0.995297f}, {0.4988957f, -0.9967008f, 0.4988957f, -1.9934016f, 0.9955827f}, {0.4989631f, -0.9968356f, 0.4989631f, -1.9936712f, 0.9958526f}, {0.4990268f, -0.9969628f, 0.4990268f, -1.9939255f, 0.9961072f}},
-  {{0.4542515f, -0.9072635f, 0.4542515f, -1.814527f, 0.8170058f}, {0.4545738f, -0.9079073f, 0.4545738f, -1.8158146f, 0.8182952f}, {0.4555141f, -0.9097854f, 0.4555141f, -1.8195708f, 0.8220565f}, {0.4569977f, -0.9127485f, 0.4569977f, -1.8254971f, 0.8279909f}, {0.4589159f, -0.9165797f, 0.4589159f, -1.8331594f, 0.8356636f}, {0.4611443f, -0.9210305f, 0.4611443f, -1.842061f, 0.8445774f}, {0.4635601f, -0.9258554f, 0.4635601f, -1.8517108f, 0.8542404f}, {0.4660543f, -0.930837f, 0.4660543f, -1.8616741f, 0.8642173f}, {0.468539f, -0.9357997f, 0.468539f, -1.8715994f, 0.8741562f}, {0.470949f, -0.9406131f, 0.470949f, -1.8812261f, 0.8837961f}, {0.47324f, -0.9451889f, 0.47324f, -1.8903777f, 0.8929601f}, {0.4753855f, -0.949474f, 0.4753855f, -1.8989479f, 0.9015421f}, {0.4773725f, -0.9534424f, 0.4773725f, -1.9068849f, 0.9094899f}, {0.4791977f, -0.9570879f, 0.4791977f, -1.9141759f, 0.9167908f}, {0.4808647f, -0.9604174f, 0.4808647f, -1.9208348f, 0.9234589f}, {0.4823812f, -0.9634462f, 0.4823812f, -1.9268925f, 0.9295248f}, {0.4837572f, -0.9661946f, 0.4837572f, -1.9323891f, 0.9350289f}, {0.485004f, -0.9686847f, 0.485004f, -1.9373693f, 0.9400159f}, {0.4861329f, -0.9709394f, 0.4861329f, -1.9418788f, 0.9445316f}, {0.4871551f, -0.9729811f, 0.4871551f, -1.9459621f, 0.9486205f}, {0.4880812f, -0.9748307f, 0.4880812f, -1.9496615f, 0.9523249f}, {0.488921f, -0.9765079f, 0.488921f, -1.9530159f, 0.9556838f}, {0.4896833f, -0.9780305f, 0.4896833f, -1.956061f, 0.9587332f}, {0.4903763f, -0.9794146f, 0.4903763f, -1.9588292f, 0.9615051f}, {0.4910072f, -0.9806747f, 0.4910072f, -1.9613494f, 0.9640287f}, {0.4915825f, -0.9818237f, 0.4915825f, -1.9636475f, 0.96633f}, {0.492108f, -0.9828733f, 0.492108f, -1.9657466f, 0.968432f}, {0.4925888f, -0.9838336f, 0.4925888f, -1.9676672f, 0.9703553f}, {0.4930295f, -0.9847138f, 0.4930295f, -1.9694276f, 0.9721181f}, {0.4934341f, -0.985522f, 0.4934341f, -1.971044f, 0.9737366f}, {0.4938063f, -0.9862653f, 0.4938063f, -1.9725305f, 0.9752252f}, {0.4941492f, -0.9869501f, 0.4941492f, -1.9739001f, 0.9765967f}, {0.4944656f, -0.987582f, 0.4944656f, -1.9751641f, 0.9778623f}, {0.4947581f, -0.9881662f, 0.4947581f, -1.9763324f, 0.9790323f}, {0.4950289f, -0.9887071f, 0.4950289f, -1.9774142f, 0.9801155f}, {0.49528f, -0.9892086f, 0.49528f, -1.9784173f, 0.98112f}, {0.4955132f, -0.9896744f, 0.4955132f, -1.9793489f, 0.9820528f}, {0.4957301f, -0.9901077f, 0.4957301f, -1.9802154f, 0.9829205f}, {0.4959322f, -0.9905112f, 0.4959322f, -1.9810225f, 0.9837287f}, {0.4961207f, -0.9908877f, 0.4961207f, -1.9817753f, 0.9844826f}, {0.4962967f, -0.9912393f, 0.4962967f, -1.9824785f, 0.9851868f}, {0.4964613f, -0.9915681f, 0.4964613f, -1.9831362f, 0.9858453f}, {0.4966155f, -0.991876f, 0.4966155f, -1.9837521f, 0.9864621f}, {0.4967601f, -0.9921648f, 0.4967601f, -1.9843296f, 0.9870404f}, {0.4968958f, -0.9924359f, 0.4968958f, -1.9848717f, 0.9875832f}, {0.4970264f, -0.9926966f, 0.4970264f, -1.9853933f, 0.9881055f}, {0.4971562f, -0.992956f, 0.4971562f, -1.985912f, 0.9886249f}, {0.497285f, -0.9932133f, 0.497285f, -1.9864265f, 0.9891401f}, {0.4974124f, -0.9934675f, 0.4974124f, -1.9869351f, 0.9896494f}, {0.4975378f, -0.993718f, 0.4975378f, -1.987436f, 0.990151f}, {0.4976608f, -0.9939638f, 0.4976608f, -1.9879276f, 0.9906433f}, {0.4977811f, -0.9942041f, 0.4977811f, -1.9884081f, 0.9911245f}, {0.4978983f, -0.9944381f, 0.4978983f, -1.9888762f, 0.9915931f}, {0.498012f, -0.9946651f, 0.498012f, -1.9893303f, 0.9920479f}, {0.4981219f, -0.9948846f, 0.4981219f, -1.9897693f, 0.9924875f}, {0.4982277f, -0.9950961f, 0.4982277f, -1.9901922f, 0.992911f}, {0.4983294f, -0.9952991f, 0.4983294f, -1.9905983f, 0.9933176f}, {0.4984267f, -0.9954935f, 0.4984267f, -1.9909869f, 0.9937068f}, {0.4985195f, -0.9956789f, 0.4985195f, -1.9913578f, 0.9940782f}, {0.4986079f, -0.9958554f, 0.4986079f, -1.9917108f, 0.9944316f}, {0.4986918f, -0.9960229f, 0.4986918f, -1.9920458f, 0.9947671f}, {0.4987712f, -0.9961816f, 0.4987712f, -1.9923631f, 0.9950849f}, {0.4988463f, -0.9963315f, 0.4988463f, -1.992663f, 0.9953851f}, {0.4989171f, -0.9964729f, 0.4989171f, -1.9929458f, 0.9956684f}},
-  {{0.4496244f, -0.8977175f, 0.4496244f, -1.795435f, 0.7984975f}, {0.4499757f, -0.898419f, 0.4499757f, -1.796838f, 0.7999029f}, {0.451001f, -0.900466f, 0.451001f, -1.800932f, 0.8040039f}, {0.4526194f, -0.9036974f, 0.4526194f, -1.8073948f, 0.8104777f}, {0.4547136f, -0.9078786f, 0.4547136f, -1.8157571f, 0.8188542f}, {0.4571486f, -0.9127404f, 0.4571486f, -1.8254809f, 0.8285946f}, {0.4597912f, -0.9180165f, 0.4597912f, -1.836033f, 0.8391647f}, {0.4625225f, -0.9234699f, 0.4625225f, -1.8469397f, 0.85009f}, {0.4652465f, -0.9289085f, 0.4652465f, -1.857817f, 0.8609859f}, {0.4678914f, -0.9341893f, 0.4678914f, -1.8683786f, 0.8715655f}, {0.4704084f, -0.9392147f, 0.4704084f, -1.8784295f, 0.8816335f}, {0.4727678f, -0.9439256f, 0.4727678f, -1.8878512f, 0.8910713f}, {0.4749549f, -0.9482924f, 0.4749549f, -1.8965848f, 0.8998198f}, {0.4769658f, -0.9523072f, 0.4769658f, -1.9046144f, 0.9078631f}, {0.4788037f, -0.9559769f, 0.4788037f, -1.9119537f, 0.9152149f}, {0.4804769f, -0.9593176f, 0.4804769f, -1.9186351f, 0.9219077f}, {0.4819961f, -0.9623508f, 0.4819961f, -1.9247016f, 0.9279845f}, {0.4833734f, -0.9651007f, 0.4833734f, -1.9302013f, 0.9334936f}, {0.4846212f, -0.9675919f, 0.4846212f, -1.9351839f, 0.9384847f}, {0.4857516f, -0.9698489f, 0.4857516f, -1.9396978f, 0.9430063f}, {0.4867761f, -0.9718945f, 0.4867761f, -1.943789f, 0.9471045f}, {0.4877055f, -0.9737501f, 0.4877055f, -1.9475002f, 0.950822f}, {0.4885495f, -0.9754352f, 0.4885495f, -1.9508704f, 0.954198f}, {0.489317f, -0.9769676f, 0.489317f, -1.9539351f, 0.957268f}, {0.4900159f, -0.9783631f, 0.4900159f, -1.9567261f, 0.9600637f}, {0.4906534f, -0.9796359f, 0.4906534f, -1.9592719f, 0.9626138f}, {0.4912359f, -0.9807989f, 0.4912359f, -1.9615978f, 0.9649437f}, {0.491769f, -0.9818632f, 0.491769f, -1.9637264f, 0.9670759f}, {0.4922577f, -0.9828389f, 0.4922577f, -1.9656778f, 0.9690306f}, {0.4927064f, -0.9837349f, 0.4927064f, -1.9674698f, 0.9708257f}, {0.4931193f, -0.9845592f, 0.4931193f, -1.9691183f, 0.972477f}, {0.4934997f, -0.9853187f, 0.4934997f, -1.9706373f, 0.9739986f}, {0.4938508f, -0.9860197f, 0.4938508f, -1.9720394f, 0.9754031f}, {0.4941754f, -0.9866678f, 0.4941754f, -1.9733355f, 0.9767014f}, {0.4944759f, -0.9872679f, 0.4944759f, -1.9745358f, 0.9779037f}, {0.4947547f, -0.9878244f, 0.4947547f, -1.9756489f, 0.9790187f}, {0.4950136f, -0.9883414f, 0.4950136f, -1.9766828f, 0.9800544f}, {0.4952544f, -0.9888223f, 0.4952544f, -1.9776445f, 0.9810178f}, {0.4954788f, -0.9892702f, 0.4954788f, -1.9785404f, 0.9819152f}, {0.4956881f, -0.9896881f, 0.4956881f, -1.9793762f, 0.9827524f}, {0.4958836f, -0.9900784f, 0.4958836f, -1.9801568f, 0.9835344f}, {0.4960665f, -0.9904435f, 0.4960665f, -1.9808871f, 0.9842658f}, {0.4962377f, -0.9907855f, 0.4962377f, -1.9815709f, 0.9849509f}, {0.4963983f, -0.9911061f, 0.4963983f, -1.9822122f, 0.9855932f}, {0.4965491f, -0.9914071f, 0.4965491f, -1.9828142f, 0.9861963f}, {0.4966941f, -0.9916967f, 0.4966941f, -1.9833935f, 0.9867765f}, {0.4968384f, -0.9919848f, 0.4968384f, -1.9839696f, 0.9873536f}, {0.4969815f, -0.9922705f, 0.4969815f, -1.9845411f, 0.9879261f}, {0.497123f, -0.992553f, 0.497123f, -1.985106f, 0.9884919f}, {0.4972623f, -0.9928312f, 0.4972623f, -1.9856624f, 0.9890493f}, {0.4973991f, -0.9931042f, 0.4973991f, -1.9862085f, 0.9895964f}, {0.4975328f, -0.9933712f, 0.4975328f, -1.9867424f, 0.9901312f}, {0.497663f, -0.9936312f, 0.497663f, -1.9872624f, 0.990652f}, {0.4977894f, -0.9938835f, 0.4977894f, -1.9877669f, 0.9911574f}, {0.4979115f, -0.9941274f, 0.4979115f, -1.9882547f, 0.9916461f}, {0.4980292f, -0.9943623f, 0.4980292f, -1.9887247f, 0.9921168f}, {0.4981422f, -0.9945879f, 0.4981422f, -1.9891759f, 0.9925688f}, {0.4982504f, -0.9948039f, 0.4982504f, -1.9896078f, 0.9930015f}, {0.4983536f, -0.99501f, 0.4983536f, -1.99002f, 0.9934143f}, {0.4984518f, -0.9952061f, 0.4984518f, -1.9904123f, 0.9938073f}, {0.4985451f, -0.9953923f, 0.4985451f, -1.9907846f, 0.9941803f}, {0.4986334f, -0.9955686f, 0.4986334f, -1.9911373f, 0.9945336f}, {0.4987169f, -0.9957353f, 0.4987169f, -1.9914706f, 0.9948674f}, {0.4987956f, -0.9958925f, 0.4987956f, -1.991785f, 0.9951823f}},
-  {{0.4446108f, -0.8873318f, 0.4446108f, -1.7746635f, 0.7784433f}, {0.4449929f, -0.8880942f, 0.4449929f, -1.7761884f, 0.7799715f}, {0.446108f, -0.8903198f, 0.446108f, -1.7806395f, 0.7844321f}, {0.4478694f, -0.893835f, 0.4478694f, -1.7876701f, 0.7914776f}, {0.4501504f, -0.8983873f, 0.4501504f, -1.7967745f, 0.8006014f}, {0.4528054f, -0.903686f, 0.4528054f, -1.8073719f, 0.8112214f}, {0.4556898f, -0.9094425f, 0.4556898f, -1.818885f, 0.822759f}, {0.4586747f, -0.9153996f, 0.4586747f, -1.8307992f, 0.8346986f}, {0.4616551f, -0.9213478f, 0.4616551f, -1.8426957f, 0.8466204f}, {0.4645525f, -0.9271303f, 0.4645525f, -1.8542606f, 0.85821f}, {0.467313f, -0.9326395f, 0.467313f, -1.865279f, 0.8692518f}, {0.4699034f, -0.9378094f, 0.4699034f, -1.8756188f, 0.8796137f}, {0.4723071f, -0.9426066f, 0.4723071f, -1.8852132f, 0.8892284f}, {0.4745191f, -0.9470212f, 0.4745191f, -1.8940424f, 0.8980765f}, {0.4765427f, -0.9510598f, 0.4765427f, -1.9021196f, 0.9061709f}, {0.4783863f, -0.9547392f, 0.4783863f, -1.9094784f, 0.9135453f}, {0.4800615f, -0.9580823f, 0.4800615f, -1.9161647f, 0.9202458f}, {0.4815811f, -0.9611151f, 0.4815811f, -1.9222303f, 0.9263244f}, {0.4829586f, -0.9638643f, 0.4829586f, -1.9277287f, 0.9318345f}, {0.4842072f, -0.9663563f, 0.4842072f, -1.9327125f, 0.936829f}, {0.4853395f, -0.9686159f, 0.4853395f, -1.9372319f, 0.9413579f}, {0.486367f, -0.9706666f, 0.486367f, -1.9413332f, 0.945468f}, {0.4873005f, -0.9725296f, 0.4873005f, -1.9450593f, 0.949202f}, {0.4881497f, -0.9742244f, 0.4881497f, -1.9484487f, 0.9525987f}, {0.4889233f, -0.9757682f, 0.4889233f, -1.9515365f, 0.955693f}, {0.4896291f, -0.9771769f, 0.4896291f, -1.9543537f, 0.9585163f}, {0.4902741f, -0.9784642f, 0.4902741f, -1.9569284f, 0.9610964f}, {0.4908646f, -0.9796426f, 0.4908646f, -1.9592853f, 0.9634583f}, {0.491406f, -0.9807232f, 0.491406f, -1.9614464f, 0.9656241f}, {0.4919033f, -0.9817158f, 0.4919033f, -1.9634315f, 0.9676134f}, {0.4923609f, -0.982629f, 0.4923609f, -1.9652579f, 0.9694437f}, {0.4927826f, -0.9834706f, 0.4927826f, -1.9669412f, 0.9711305f}, {0.4931719f, -0.9842475f, 0.4931719f, -1.9684951f, 0.9726877f}, {0.4935319f, -0.9849659f, 0.4935319f, -1.9699319f, 0.9741276f}, {0.4938653f, -0.9856312f, 0.4938653f, -1.9712625f, 0.975461f}, {0.4941745f, -0.9862483f, 0.4941745f, -1.9724967f, 0.9766978f}, {0.4944617f, -0.9868216f, 0.4944617f, -1.9736432f, 0.9778468f}, {0.4947289f, -0.9873549f, 0.4947289f, -1.9747098f, 0.9789156f}, {0.4949779f, -0.9878517f, 0.4949779f, -1.9757035f, 0.9799115f}, {0.4952101f, -0.9883153f, 0.4952101f, -1.9766305f, 0.9808405f}, {0.4954271f, -0.9887483f, 0.4954271f, -1.9774966f, 0.9817084f}, {0.4956301f, -0.9891534f, 0.4956301f, -1.9783067f, 0.9825202f}, {0.4958202f, -0.9895327f, 0.4958202f, -1.9790655f, 0.9832806f}, {0.4959984f, -0.9898885f, 0.4959984f, -1.979777f, 0.9839937f}, {0.4961658f, -0.9902226f, 0.4961658f, -1.9804451f, 0.9846632f}, {0.4963269f, -0.990544f, 0.4963269f, -1.9810879f, 0.9853074f}, {0.496487f, -0.9908637f, 0.496487f, -1.9817274f, 0.9859482f}, {0.496646f, -0.9911808f, 0.496646f, -1.9823616f, 0.9865838f}, {0.496803f, -0.9914943f, 0.496803f, -1.9829887f, 0.9872122f}, {0.4969578f, -0.9918032f, 0.4969578f, -1.9836064f, 0.9878312f}, {0.4971097f, -0.9921063f, 0.4971097f, -1.9842126f, 0.9884387f}, {0.4972582f, -0.9924026f, 0.4972582f, -1.9848053f, 0.9890327f}, {0.4974028f, -0.9926913f, 0.4974028f, -1.9853826f, 0.9896112f}, {0.4975432f, -0.9929714f, 0.4975432f, -1.9859428f, 0.9901726f}, {0.4976789f, -0.9932422f, 0.4976789f, -1.9864845f, 0.9907154f}, {0.4978096f, -0.9935032f, 0.4978096f, -1.9870063f, 0.9912384f}, {0.4979351f, -0.9937537f, 0.4979351f, -1.9875074f, 0.9917405f}, {0.4980553f, -0.9939935f, 0.4980553f, -1.9879871f, 0.9922212f}, {0.49817f, -0.9942224f, 0.49817f, -1.9884448f, 0.99268f}, {0.4982791f, -0.9944403f, 0.4982791f, -1.9888805f, 0.9931166f}, {0.4983828f, -0.9946471f, 0.4983828f, -1.9892941f, 0.9935311f}, {0.4984809f, -0.9948429f, 0.4984809f, -1.9896858f, 0.9939236f}, {0.4985737f, -0.995028f, 0.4985737f, -1.9900561f, 0.9942946f}, {0.4986611f, -0.9952026f, 0.4986611f, -1.9904053f, 0.9946446f}},
-  {{0.4391954f, -0.8760607f, 0.4391954f, -1.7521214f, 0.7567816f}, {0.4396097f, -0.8768871f, 0.4396097f, -1.7537743f, 0.7584389f}, {0.4408195f, -0.8793002f, 0.4408195f, -1.7586005f, 0.763278f}, {0.4427315f, -0.8831142f, 0.4427315f, -1.7662284f, 0.7709261f}, {0.4452098f, -0.8880576f, 0.4452098f, -1.7761151f, 0.7808392f}, {0.4480976f, -0.8938178f, 0.4480976f, -1.7876356f, 0.7923903f}, {0.4512387f, -0.9000834f, 0.4512387f, -1.8001669f, 0.8049549f}, {0.4544935f, -0.9065758f, 0.4544935f, -1.8131515f, 0.8179741f}, {0.4577477f, -0.9130669f, 0.4577477f, -1.8261339f, 0.8309909f}, {0.4609154f, -0.9193854f, 0.4609154f, -1.8387708f, 0.8436615f}, {0.4639371f, -0.9254128f, 0.4639371f, -1.8508256f, 0.8557484f}, {0.4667761f, -0.9310757f, 0.4667761f, -1.8621514f, 0.8671043f}, {0.4694133f, -0.9363361f, 0.4694133f, -1.8726722f, 0.8776531f}, {0.4718427f, -0.941182f, 0.4718427f, -1.882364f, 0.8873707f}, {0.4740672f, -0.9456192f, 0.4740672f, -1.8912385f, 0.8962688f}, {0.4760956f, -0.9496653f, 0.4760956f, -1.8993306f, 0.9043824f}, {0.4779401f, -0.9533445f, 0.4779401f, -1.906689f, 0.9117604f}, {0.4796145f, -0.9566845f, 0.4796145f, -1.913369f, 0.9184581f}, {0.4811334f, -0.9597142f, 0.4811334f, -1.9194283f, 0.9245335f}, {0.4825109f, -0.9624619f, 0.4825109f, -1.9249237f, 0.9300436f}, {0.4837607f, -0.9649548f, 0.4837607f, -1.9299096f, 0.9350427f}, {0.4848954f, -0.9672182f, 0.4848954f, -1.9344365f, 0.9395816f}, {0.4859267f, -0.9692754f, 0.4859267f, -1.9385509f, 0.943707f}, {0.4868653f, -0.9711476f, 0.4868653f, -1.9422952f, 0.9474612f}, {0.4877206f, -0.9728537f, 0.4877206f, -1.9457073f, 0.9508825f}, {0.4885013f, -0.9744108f, 0.4885013f, -1.9488216f, 0.9540051f}, {0.4892149f, -0.9758343f, 0.4892149f, -1.9516686f, 0.9568596f}, {0.4898684f, -0.9771377f, 0.4898684f, -1.9542755f, 0.9594734f}, {0.4904677f, -0.9783332f, 0.4904677f, -1.9566665f, 0.9618708f}, {0.4910183f, -0.9794316f, 0.4910183f, -1.9588632f, 0.9640733f}, {0.4915251f, -0.9804424f, 0.4915251f, -1.9608847f, 0.9661002f}, {0.4919922f, -0.9813741f, 0.4919922f, -1.9627482f, 0.9679686f}, {0.4924234f, -0.9822344f, 0.4924234f, -1.9644687f, 0.9696938f}, {0.4928223f, -0.9830299f, 0.4928223f, -1.9660599f, 0.9712891f}, {0.4931917f, -0.9837668f, 0.4931917f, -1.9675337f, 0.9727669f}, {0.4935344f, -0.9844504f, 0.4935344f, -1.9689009f, 0.9741377f}, {0.4938528f, -0.9850855f, 0.4938528f, -1.9701711f, 0.9754113f}, {0.4941491f, -0.9856765f, 0.4941491f, -1.9713529f, 0.9765963f}, {0.4944251f, -0.9862271f, 0.4944251f, -1.9724541f, 0.9777004f}, {0.4946826f, -0.9867408f, 0.4946826f, -1.9734816f, 0.9787306f}, {0.4949233f, -0.9872208f, 0.4949233f, -1.9744415f, 0.9796931f}, {0.4951484f, -0.9876698f, 0.4951484f, -1.9753396f, 0.9805935f}, {0.4953592f, -0.9880904f, 0.4953592f, -1.9761808f, 0.9814369f}, {0.495557f, -0.9884848f, 0.495557f, -1.9769697f, 0.9822279f}, {0.4957427f, -0.9888552f, 0.4957427f, -1.9777104f, 0.9829707f}, {0.4959213f, -0.9892116f, 0.4959213f, -1.9784232f, 0.9836854f}, {0.4960991f, -0.9895661f, 0.4960991f, -1.9791323f, 0.9843963f}, {0.4962754f, -0.9899179f, 0.4962754f, -1.9798357f, 0.9851016f}, {0.4964497f, -0.9902656f, 0.4964497f, -1.9805312f, 0.9857989f}, {0.4966215f, -0.9906082f, 0.4966215f, -1.9812163f, 0.9864859f}, {0.49679f, -0.9909444f, 0.49679f, -1.9818888f, 0.9871601f}, {0.4969548f, -0.9912731f, 0.4969548f, -1.9825463f, 0.9878194f}, {0.4971154f, -0.9915934f, 0.4971154f, -1.9831867f, 0.9884615f}, {0.4972712f, -0.9919041f, 0.4972712f, -1.9838083f, 0.9890847f}, {0.4974218f, -0.9922046f, 0.4974218f, -1.9844092f, 0.9896873f}, {0.497567f, -0.9924941f, 0.497567f, -1.9849883f, 0.9902679f}, {0.4977064f, -0.9927722f, 0.4977064f, -1.9855443f, 0.9908254f}, {0.4978398f, -0.9930383f, 0.4978398f, -1.9860766f, 0.9913591f}, {0.4979671f, -0.9932923f, 0.4979671f, -1.9865847f, 0.9918685f}, {0.4980883f, -0.9935341f, 0.4980883f, -1.9870682f, 0.9923533f}, {0.4982034f, -0.9937636f, 0.4982034f, -1.9875272f, 0.9928136f}, {0.4983124f, -0.993981f, 0.4983124f, -1.987962f, 0.9932495f}, {0.4984154f, -0.9941865f, 0.4984154f, -1.988373f, 0.9936616f}, {0.4985126f, -0.9943803f, 0.4985126f, -1.9887606f, 0.9940503f}},
-  {{0.4333656f, -0.8638615f, 0.4333656f, -1.727723f, 0.7334622f}, {0.4338136f, -0.8647546f, 0.4338136f, -1.7295093f, 0.7352545f}, {0.4351224f, -0.8673634f, 0.4351224f, -1.7347269f, 0.7404894f}, {0.4371922f, -0.8714895f, 0.4371922f, -1.742979f, 0.7487689f}, {0.4398777f, -0.8768426f, 0.4398777f, -1.7536851f, 0.7595106f}, {0.4430105f, -0.8830875f, 0.4430105f, -1.766175f, 0.772042f}, {0.4464227f, -0.8898893f, 0.4464227f, -1.7797786f, 0.7856908f}, {0.4499633f, -0.8969471f, 0.4499633f, -1.7938942f, 0.7998533f}, {0.4535084f, -0.9040137f, 0.4535084f, -1.8080274f, 0.8140334f}, {0.456964f, -0.910902f, 0.456964f, -1.821804f, 0.8278558f}, {0.4602648f, -0.9174819f, 0.4602648f, -1.8349638f, 0.8410593f}, {0.4633701f, -0.9236718f, 0.4633701f, -1.8473436f, 0.8534803f}, {0.4662581f, -0.9294287f, 0.4662581f, -1.8588575f, 0.8650323f}, {0.4689215f, -0.9347379f, 0.4689215f, -1.8694758f, 0.8756859f}, {0.4713628f, -0.9396043f, 0.4713628f, -1.8792087f, 0.8854511f}, {0.473591f, -0.9440459f, 0.473591f, -1.8880918f, 0.8943638f}, {0.4756188f, -0.9480882f, 0.4756188f, -1.8961764f, 0.9024752f}, {0.4774611f, -0.9517606f, 0.4774611f, -1.9035213f, 0.9098445f}, {0.4791334f, -0.9550942f, 0.4791334f, -1.9101884f, 0.9165338f}, {0.4806511f, -0.9581195f, 0.4806511f, -1.9162389f, 0.9226044f}, {0.4820288f, -0.9608658f, 0.4820288f, -1.9217316f, 0.9281153f}, {0.4832804f, -0.9633606f, 0.4832804f, -1.9267213f, 0.9331216f}, {0.4844185f, -0.9656292f, 0.4844185f, -1.9312585f, 0.9376739f}, {0.4854546f, -0.9676946f, 0.4854546f, -1.9353893f, 0.9418184f}, {0.4863992f, -0.9695776f, 0.4863992f, -1.9391552f, 0.9455968f}, {0.4872617f, -0.9712968f, 0.4872617f, -1.9425937f, 0.9490467f}, {0.4880504f, -0.972869f, 0.4880504f, -1.945738f, 0.9522014f}, {0.4887727f, -0.974309f, 0.4887727f, -1.9486179f, 0.955091f}, {0.4894355f, -0.9756301f, 0.4894355f, -1.9512602f, 0.957742f}, {0.4900445f, -0.9768441f, 0.4900445f, -1.9536883f, 0.9601782f}, {0.4906052f, -0.9779617f, 0.4906052f, -1.9559233f, 0.9624207f}, {0.4911221f, -0.978992f, 0.4911221f, -1.9579841f, 0.9644882f}, {0.4915994f, -0.9799436f, 0.4915994f, -1.9598871f, 0.9663976f}, {0.4920409f, -0.9808237f, 0.4920409f, -1.9616474f, 0.9681637f}, {0.4924499f, -0.981639f, 0.4924499f, -1.963278f, 0.9697998f}, {0.4928295f, -0.9823955f, 0.4928295f, -1.964791f, 0.9713178f}, {0.4931821f, -0.9830985f, 0.4931821f, -1.9661969f, 0.9727284f}, {0.4935102f, -0.9837526f, 0.4935102f, -1.9675052f, 0.974041f}, {0.493816f, -0.9843621f, 0.493816f, -1.9687243f, 0.9752641f}, {0.4941014f, -0.9849309f, 0.4941014f, -1.9698619f, 0.9764055f}, {0.494368f, -0.9854624f, 0.494368f, -1.9709249f, 0.977472f}, {0.4946175f, -0.9859597f, 0.4946175f, -1.9719194f, 0.9784699f}, {0.4948512f, -0.9864255f, 0.4948512f, -1.9728511f, 0.9794046f}, {0.4950703f, -0.9868625f, 0.4950703f, -1.9737249f, 0.9802814f}, {0.4952762f, -0.9872727f, 0.4952762f, -1.9745455f, 0.9811047f}, {0.4954742f, -0.9876676f, 0.4954742f, -1.9753352f, 0.981897f}, {0.4956713f, -0.9880604f, 0.4956713f, -1.9761208f, 0.9826852f}, {0.4958668f, -0.9884501f, 0.4958668f, -1.9769002f, 0.9834672f}, {0.4960601f, -0.9888354f, 0.4960601f, -1.9776708f, 0.9842404f}, {0.4962505f, -0.989215f, 0.4962505f, -1.9784301f, 0.9850021f}, {0.4964375f, -0.9895877f, 0.4964375f, -1.9791753f, 0.9857499f}, {0.4966203f, -0.989952f, 0.4966203f, -1.9799041f, 0.9864811f}, {0.4967983f, -0.990307f, 0.4967983f, -1.980614f, 0.9871933f}, {0.4969711f, -0.9906515f, 0.4969711f, -1.981303f, 0.9878846f}, {0.4971383f, -0.9909846f, 0.4971383f, -1.9819692f, 0.988553f}, {0.4972993f, -0.9913056f, 0.4972993f, -1.9826112f, 0.9891971f}, {0.4974539f, -0.9916138f, 0.4974539f, -1.9832277f, 0.9898157f}, {0.497602f, -0.9919089f, 0.497602f, -1.9838179f, 0.9904079f}, {0.4977433f, -0.9921906f, 0.4977433f, -1.9843812f, 0.9909731f}, {0.4978778f, -0.9924587f, 0.4978778f, -1.9849174f, 0.991511f}, {0.4980055f, -0.9927132f, 0.4980055f, -1.9854265f, 0.9920218f}, {0.4981264f, -0.9929543f, 0.4981264f, -1.9859087f, 0.9925056f}, {0.4982407f, -0.9931822f, 0.4982407f, -1.9863645f, 0.9929629f}, {0.4983486f, -0.9933972f, 0.4983486f, -1.9867944f, 0.9933943f}},
-  {{0.4271124f, -0.850695f, 0.4271124f, -1.70139f, 0.7084496f}, {0.4275955f, -0.8516571f, 0.4275955f, -1.7033143f, 0.7103819f}, {0.429007f, -0.8544686f, 0.429007f, -1.7089372f, 0.7160282f}, {0.4312412f, -0.8589184f, 0.4312412f, -1.7178369f, 0.7249648f}, {0.4341427f, -0.8646976f, 0.4341427f, -1.7293951f, 0.736571f}, {0.437532f, -0.871448f, 0.437532f, -1.7428961f, 0.7501279f}, {0.4412287f, -0.8788109f, 0.4412287f, -1.7576218f, 0.7649148f}, {0.4450703f, -0.8864624f, 0.4450703f, -1.7729248f, 0.7802813f}, {0.4489227f, -0.8941353f, 0.4489227f, -1.7882705f, 0.7956907f}, {0.4526835f, -0.9016259f, 0.4526835f, -1.8032518f, 0.8107342f}, {0.4562813f, -0.9087917f, 0.4562813f, -1.8175834f, 0.8251252f}, {0.4596706f, -0.9155423f, 0.4596706f, -1.8310845f, 0.8386823f}, {0.4628269f, -0.9218288f, 0.4628269f, -1.8436575f, 0.8513075f}, {0.4657412f, -0.9276334f, 0.4657412f, -1.8552667f, 0.8629649f}, {0.4684155f, -0.9329598f, 0.4684155f, -1.8659197f, 0.873662f}, {0.4708588f, -0.9378263f, 0.4708588f, -1.8756525f, 0.8834353f}, {0.4730845f, -0.9422593f, 0.4730845f, -1.8845186f, 0.8923381f}, {0.4751083f, -0.9462902f, 0.4751083f, -1.8925804f, 0.9004334f}, {0.4769468f, -0.9499519f, 0.4769468f, -1.8999038f, 0.9077872f}, {0.4786164f, -0.9532773f, 0.4786164f, -1.9065546f, 0.9144656f}, {0.480133f, -0.956298f, 0.480133f, -1.912596f, 0.9205321f}, {0.4815115f, -0.9590437f, 0.4815115f, -1.9180874f, 0.9260462f}, {0.4827657f, -0.9615417f, 0.4827657f, -1.9230834f, 0.9310629f}, {0.4839081f, -0.963817f, 0.4839081f, -1.927634f, 0.9356324f}, {0.48495f, -0.9658923f, 0.48495f, -1.9317845f, 0.9398002f}, {0.4859017f, -0.9677878f, 0.4859017f, -1.9355756f, 0.9436069f}, {0.4867723f, -0.9695218f, 0.4867723f, -1.9390436f, 0.9470893f}, {0.48757f, -0.9711106f, 0.48757f, -1.9422211f, 0.9502801f}, {0.4883021f, -0.9725686f, 0.4883021f, -1.9451372f, 0.9532083f}, {0.488975f, -0.9739089f, 0.488975f, -1.9478178f, 0.9558999f}, {0.4895946f, -0.9751429f, 0.4895946f, -1.9502858f, 0.9583782f}, {0.4901659f, -0.9762809f, 0.4901659f, -1.9525619f, 0.9606637f}, {0.4906937f, -0.9773321f, 0.4906937f, -1.9546643f, 0.9627748f}, {0.491182f, -0.9783046f, 0.491182f, -1.9566093f, 0.9647279f}, {0.4916344f, -0.9792057f, 0.4916344f, -1.9584115f, 0.9665376f}, {0.4920542f, -0.9800419f, 0.4920542f, -1.9600839f, 0.9682169f}, {0.4924444f, -0.9808191f, 0.4924444f, -1.9616381f, 0.9697776f}, {0.4928075f, -0.9815423f, 0.4928075f, -1.9630847f, 0.9712302f}, {0.493146f, -0.9822164f, 0.493146f, -1.9644328f, 0.9725839f}, {0.4934618f, -0.9828455f, 0.4934618f, -1.965691f, 0.9738474f}, {0.493757f, -0.9834334f, 0.493757f, -1.9668668f, 0.9750281f}, {0.4940332f, -0.9839835f, 0.4940332f, -1.9679671f, 0.9761328f}, {0.494292f, -0.9844989f, 0.494292f, -1.9689978f, 0.9771679f}, {0.4945347f, -0.9849824f, 0.4945347f, -1.9699647f, 0.9781388f}, {0.4947627f, -0.9854364f, 0.4947627f, -1.9708728f, 0.9790506f}, {0.494982f, -0.9858734f, 0.494982f, -1.9717467f, 0.9799282f}, {0.4952003f, -0.9863081f, 0.4952003f, -1.9726162f, 0.9808013f}, {0.4954169f, -0.9867395f, 0.4954169f, -1.9734789f, 0.9816676f}, {0.495631f, -0.987166f, 0.495631f, -1.974332f, 0.9825242f}, {0.4958421f, -0.9875863f, 0.4958421f, -1.9751726f, 0.9833682f}, {0.4960492f, -0.9879988f, 0.4960492f, -1.9759977f, 0.9841968f}, {0.4962518f, -0.9884023f, 0.4962518f, -1.9768046f, 0.985007f}, {0.4964491f, -0.9887954f, 0.4964491f, -1.9775907f, 0.9857964f}, {0.4966406f, -0.9891768f, 0.4966406f, -1.9783537f, 0.9865626f}, {0.4968259f, -0.9895458f, 0.4968259f, -1.9790915f, 0.9873035f}, {0.4970044f, -0.9899013f, 0.4970044f, -1.9798026f, 0.9880175f}, {0.4971758f, -0.9902427f, 0.4971758f, -1.9804855f, 0.9887032f}, {0.4973399f, -0.9905696f, 0.4973399f, -1.9811393f, 0.9893597f}, {0.4974966f, -0.9908817f, 0.4974966f, -1.9817633f, 0.9899864f}, {0.4976457f, -0.9911787f, 0.4976457f, -1.9823574f, 0.9905829f}, {0.4977873f, -0.9914607f, 0.4977873f, -1.9829214f, 0.9911492f}, {0.4979214f, -0.9917278f, 0.4979214f, -1.9834557f, 0.9916857f}, {0.4980482f, -0.9919803f, 0.4980482f, -1.9839607f, 0.9921928f}, {0.4981678f, -0.9922186f, 0.4981678f, -1.9844371f, 0.9926713f}},
-  {{0.4204315f, -0.8365267f, 0.4204315f, -1.6730533f, 0.6817262f}, {0.4209507f, -0.8375596f, 0.4209507f, -1.6751193f, 0.6838028f}, {0.4224683f, -0.8405792f, 0.4224683f, -1.6811585f, 0.6898733f}, {0.4248722f, -0.8453622f, 0.4248722f, -1.6907244f, 0.6994889f}, {0.4279977f, -0.8515808f, 0.4279977f, -1.7031617f, 0.7119906f}, {0.4316534f, -0.8588546f, 0.4316534f, -1.7177091f, 0.7266134f}, {0.4356468f, -0.8668002f, 0.4356468f, -1.7336004f, 0.7425871f}, {0.4398035f, -0.8750708f, 0.4398035f, -1.7501415f, 0.759214f}, {0.4439787f, -0.8833782f, 0.4439787f, -1.7667563f, 0.7759149f}, {0.4480615f, -0.8915016f, 0.4480615f, -1.7830032f, 0.792246f}, {0.4519734f, -0.8992851f, 0.4519734f, -1.7985702f, 0.8078937f}, {0.4556642f, -0.9066286f, 0.4556642f, -1.8132572f, 0.8226569f}, {0.4591062f, -0.913477f, 0.4591062f, -1.826954f, 0.8364247f}, {0.4622884f, -0.9198087f, 0.4622884f, -1.8396175f, 0.8491538f}, {0.4652121f, -0.925626f, 0.4652121f, -1.8512519f, 0.8608485f}, {0.4678863f, -0.9309466f, 0.4678863f, -1.8618933f, 0.871545f}, {0.4703247f, -0.9357984f, 0.4703247f, -1.8715967f, 0.8812988f}, {0.472544f, -0.940214f, 0.472544f, -1.8804281f, 0.8901759f}, {0.4745617f, -0.9442286f, 0.4745617f, -1.8884573f, 0.8982468f}, {0.4763955f, -0.9478773f, 0.4763955f, -1.8957546f, 0.9055819f}, {0.4780624f, -0.951194f, 0.4780624f, -1.9023879f, 0.9122496f}, {0.4795785f, -0.9542105f, 0.4795785f, -1.908421f, 0.918314f}, {0.4809586f, -0.9569565f, 0.4809586f, -1.9139131f, 0.9238345f}, {0.4822164f, -0.9594591f, 0.4822164f, -1.9189181f, 0.9288655f}, {0.4833641f, -0.9617426f, 0.4833641f, -1.9234853f, 0.9334563f}, {0.4844128f, -0.9638293f, 0.4844128f, -1.9276587f, 0.9376513f}, {0.4853726f, -0.965739f, 0.4853726f, -1.931478f, 0.9414904f}, {0.4862523f, -0.9674893f, 0.4862523f, -1.9349786f, 0.9450093f}, {0.4870599f, -0.9690962f, 0.4870599f, -1.9381924f, 0.9482396f}, {0.4878025f, -0.9705737f, 0.4878025f, -1.9411474f, 0.95121f}, {0.4884864f, -0.9719345f, 0.4884864f, -1.9438689f, 0.9539456f}, {0.4891173f, -0.9731897f, 0.4891173f, -1.9463794f, 0.9564691f}, {0.4897002f, -0.9743494f, 0.4897002f, -1.9486989f, 0.9588006f}, {0.4902395f, -0.9754226f, 0.4902395f, -1.9508452f, 0.9609581f}, {0.4907394f, -0.9764172f, 0.4907394f, -1.9528343f, 0.9629575f}, {0.4912033f, -0.9773403f, 0.4912033f, -1.9546806f, 0.9648133f}, {0.4916346f, -0.9781983f, 0.4916346f, -1.9563967f, 0.9665383f}, {0.492036f, -0.9789971f, 0.492036f, -1.9579941f, 0.968144f}, {0.4924102f, -0.9797416f, 0.4924102f, -1.9594831f, 0.9696408f}, {0.4927595f, -0.9804365f, 0.4927595f, -1.960873f, 0.9710378f}, {0.4930859f, -0.981086f, 0.4930859f, -1.962172f, 0.9723436f}, {0.4933914f, -0.9816938f, 0.4933914f, -1.9633877f, 0.9735655f}, {0.4936776f, -0.9822634f, 0.4936776f, -1.9645267f, 0.9747105f}, {0.4939462f, -0.9827977f, 0.4939462f, -1.9655953f, 0.9757846f}, {0.4941984f, -0.9832995f, 0.4941984f, -1.966599f, 0.9767935f}, {0.4944411f, -0.9837825f, 0.4944411f, -1.967565f, 0.9777645f}, {0.4946827f, -0.9842631f, 0.4946827f, -1.9685262f, 0.9787308f}, {0.4949224f, -0.98474f, 0.4949224f, -1.96948f, 0.9796895f}, {0.4951594f, -0.9852116f, 0.4951594f, -1.9704233f, 0.9806377f}, {0.495393f, -0.9856764f, 0.495393f, -1.9713528f, 0.981572f}, {0.4956223f, -0.9861326f, 0.4956223f, -1.9722653f, 0.9824892f}, {0.4958466f, -0.9865789f, 0.4958466f, -1.9731577f, 0.9833863f}, {0.4960651f, -0.9870136f, 0.4960651f, -1.9740273f, 0.9842603f}, {0.4962772f, -0.9874356f, 0.4962772f, -1.9748713f, 0.9851087f}, {0.4964823f, -0.9878438f, 0.4964823f, -1.9756876f, 0.9859292f}, {0.49668f, -0.9882371f, 0.49668f, -1.9764742f, 0.98672f}, {0.4968699f, -0.9886149f, 0.4968699f, -1.9772298f, 0.9874795f}, {0.4970517f, -0.9889766f, 0.4970517f, -1.9779533f, 0.9882067f}, {0.4972252f, -0.9893219f, 0.4972252f, -1.9786439f, 0.9889009f}, {0.4973904f, -0.9896507f, 0.4973904f, -1.9793013f, 0.9895617f}, {0.4975473f, -0.9899628f, 0.4975473f, -1.9799255f, 0.9901892f}, {0.4976959f, -0.9902584f, 0.4976959f, -1.9805169f, 0.9907836f}, {0.4978364f, -0.9905379f, 0.4978364f, -1.9810759f, 0.9913455f}, {0.4979689f, -0.9908017f, 0.4979689f, -1.9816033f, 0.9918756f}},
-  {{0.4133239f, -0.8213276f, 0.4133239f, -1.6426552f, 0.6532957f}, {0.41388f, -0.8224325f, 0.41388f, -1.644865f, 0.6555198f}, {0.4155061f, -0.8256638f, 0.4155061f, -1.6513276f, 0.6620243f}, {0.418084f, -0.8307864f, 0.418084f, -1.6615729f, 0.6723359f}, {0.4214396f, -0.8374545f, 0.4214396f, -1.6749089f, 0.6857584f}, {0.4253702f, -0.8452651f, 0.4253702f, -1.6905302f, 0.7014808f}, {0.4296709f, -0.8538112f, 0.4296709f, -1.7076224f, 0.7186837f}, {0.4341553f, -0.8627222f, 0.4341553f, -1.7254444f, 0.7366212f}, {0.4386677f, -0.8716888f, 0.4386677f, -1.7433777f, 0.7546706f}, {0.4430879f, -0.8804724f, 0.4430879f, -1.7609448f, 0.7723516f}, {0.4473304f, -0.8889028f, 0.4473304f, -1.7778055f, 0.7893215f}, {0.4513396f, -0.8968695f, 0.4513396f, -1.7937391f, 0.8053583f}, {0.4550842f, -0.9043105f, 0.4550842f, -1.8086211f, 0.8203367f}, {0.4585512f, -0.9111999f, 0.4585512f, -1.8223998f, 0.8342047f}, {0.4617406f, -0.9175378f, 0.4617406f, -1.8350755f, 0.8469625f}, {0.4646613f, -0.9233416f, 0.4646613f, -1.8466832f, 0.8586453f}, {0.4673275f, -0.9286397f, 0.4673275f, -1.8572794f, 0.8693102f}, {0.4697566f, -0.9334664f, 0.4697566f, -1.8669329f, 0.8790262f}, {0.471967f, -0.9378588f, 0.471967f, -1.8757176f, 0.8878678f}, {0.4739775f, -0.9418541f, 0.4739775f, -1.8837082f, 0.8959102f}, {0.4758065f, -0.9454885f, 0.4758065f, -1.8909771f, 0.9032261f}, {0.4774712f, -0.9487964f, 0.4774712f, -1.8975928f, 0.9098847f}, {0.4789875f, -0.9518095f, 0.4789875f, -1.903619f, 0.9159499f}, {0.4803701f, -0.954557f, 0.4803701f, -1.909114f, 0.9214805f}, {0.4816324f, -0.9570654f, 0.4816324f, -1.9141307f, 0.9265298f}, {0.4827865f, -0.9593586f, 0.4827865f, -1.9187172f, 0.9311459f}, {0.4838431f, -0.9614581f, 0.4838431f, -1.9229163f, 0.9353722f}, {0.4848119f, -0.9633833f, 0.4848119f, -1.9267666f, 0.9392475f}, {0.4857016f, -0.9651513f, 0.4857016f, -1.9303026f, 0.9428064f}, {0.48652f, -0.9667775f, 0.48652f, -1.933555f, 0.9460799f}, {0.4872739f, -0.9682757f, 0.4872739f, -1.9365514f, 0.9490957f}, {0.4879696f, -0.9696581f, 0.4879696f, -1.9393162f, 0.9518784f}, {0.4886125f, -0.9709356f, 0.4886125f, -1.9418713f, 0.95445f}, {0.4892076f, -0.9721181f, 0.4892076f, -1.9442362f, 0.9568303f}, {0.4897592f, -0.9732142f, 0.4897592f, -1.9464285f, 0.9590367f}, {0.4902713f, -0.9742318f, 0.4902713f, -1.9484636f, 0.9610851f}, {0.4907473f, -0.9751778f, 0.4907473f, -1.9503557f, 0.9629894f}, {0.4911906f, -0.9760586f, 0.4911906f, -1.9521172f, 0.9647623f}, {0.4916038f, -0.9768798f, 0.4916038f, -1.9537595f, 0.9664153f}, {0.4919896f, -0.9776463f, 0.4919896f, -1.9552927f, 0.9679583f}, {0.4923502f, -0.9783629f, 0.4923502f, -1.9567258f, 0.9694008f}, {0.4926877f, -0.9790336f, 0.4926877f, -1.9580672f, 0.9707508f}, {0.493004f, -0.9796621f, 0.493004f, -1.9593242f, 0.972016f}, {0.4933008f, -0.9802518f, 0.4933008f, -1.9605036f, 0.973203f}, {0.4935795f, -0.9808057f, 0.4935795f, -1.9616114f, 0.974318f}, {0.4938478f, -0.9813389f, 0.4938478f, -1.9626778f, 0.9753913f}, {0.4941149f, -0.9818695f, 0.4941149f, -1.9637391f, 0.9764595f}, {0.4943799f, -0.9823961f, 0.4943799f, -1.9647922f, 0.9775194f}, {0.4946419f, -0.9829169f, 0.4946419f, -1.9658338f, 0.9785678f}, {0.4949002f, -0.9834302f, 0.4949002f, -1.9668603f, 0.9796009f}, {0.4951538f, -0.9839341f, 0.4951538f, -1.9678682f, 0.9806153f}, {0.4954019f, -0.984427f, 0.4954019f, -1.968854f, 0.9816075f}, {0.4956436f, -0.9849073f, 0.4956436f, -1.9698146f, 0.9825743f}, {0.4958782f, -0.9853735f, 0.4958782f, -1.970747f, 0.9835128f}, {0.4961051f, -0.9858245f, 0.4961051f, -1.9716489f, 0.9844206f}, {0.4963239f, -0.9862591f, 0.4963239f, -1.9725182f, 0.9852955f}, {0.496534f, -0.9866766f, 0.496534f, -1.9733532f, 0.9861359f}, {0.4967352f, -0.9870764f, 0.4967352f, -1.9741528f, 0.9869406f}, {0.4969272f, -0.987458f, 0.4969272f, -1.9749161f, 0.9877089f}, {0.4971101f, -0.9878214f, 0.4971101f, -1.9756427f, 0.9884402f}, {0.4972837f, -0.9881664f, 0.4972837f, -1.9763328f, 0.9891348f}, {0.4974482f, -0.9884933f, 0.4974482f, -1.9769865f, 0.9897927f}, {0.4976037f, -0.9888023f, 0.4976037f, -1.9776046f, 0.9904148f}, {0.4977504f, -0.9890938f, 0.4977504f, -1.9781877f, 0.9910017f}},
-  {{0.4057966f, -0.8050749f, 0.4057966f, -1.6101498f, 0.6231864f}, {0.40639f, -0.8062522f, 0.40639f, -1.6125043f, 0.62556f}, {0.4081261f, -0.8096966f, 0.4081261f, -1.6193931f, 0.6325046f}, {0.4108809f, -0.8151619f, 0.4108809f, -1.6303237f, 0.6435236f}, {0.4144712f, -0.8222848f, 0.4144712f, -1.6445697f, 0.6578849f}, {0.4186832f, -0.8306411f, 0.4186832f, -1.6612823f, 0.6747329f}, {0.4232998f, -0.8398002f, 0.4232998f, -1.6796004f, 0.6931993f}, {0.4281225f, -0.849368f, 0.4281225f, -1.698736f, 0.7124899f}, {0.4329844f, -0.8590139f, 0.4329844f, -1.7180277f, 0.7319377f}, {0.4377561f, -0.8684806f, 0.4377561f, -1.7369612f, 0.7510246f}, {0.4423444f, -0.8775834f, 0.4423444f, -1.7551667f, 0.7693774f}, {0.4466879f, -0.8862006f, 0.4466879f, -1.7724012f, 0.7867514f}, {0.4507514f, -0.8942623f, 0.4507514f, -1.7885246f, 0.8030054f}, {0.4545194f, -0.9017378f, 0.4545194f, -1.8034757f, 0.8180775f}, {0.4579907f, -0.9086246f, 0.4579907f, -1.8172492f, 0.8319626f}, {0.4611736f, -0.9149393f, 0.4611736f, -1.8298786f, 0.8446942f}, {0.4640826f, -0.9207106f, 0.4640826f, -1.8414212f, 0.8563303f}, {0.4667357f, -0.9259742f, 0.4667357f, -1.8519483f, 0.8669426f}, {0.4691524f, -0.9307687f, 0.4691524f, -1.8615374f, 0.8766094f}, {0.4713526f, -0.9351338f, 0.4713526f, -1.8702676f, 0.8854102f}, {0.4733557f, -0.9391079f, 0.4733557f, -1.8782157f, 0.8934227f}, {0.4751802f, -0.9427275f, 0.4751802f, -1.885455f, 0.9007206f}, {0.4768432f, -0.9460268f, 0.4768432f, -1.8920537f, 0.9073727f}, {0.4783605f, -0.9490372f, 0.4783605f, -1.8980744f, 0.9134422f}, {0.4797466f, -0.9517871f, 0.4797466f, -1.9035743f, 0.9189866f}, {0.4810145f, -0.9543025f, 0.4810145f, -1.9086049f, 0.924058f}, {0.4821758f, -0.9566065f, 0.4821758f, -1.9132129f, 0.9287033f}, {0.4832411f, -0.95872f, 0.4832411f, -1.91744f, 0.9329646f}, {0.4842199f, -0.9606618f, 0.4842199f, -1.9213235f, 0.9368796f}, {0.4851205f, -0.9624485f, 0.4851205f, -1.924897f, 0.9404819f}, {0.4859504f, -0.9640951f, 0.4859504f, -1.9281901f, 0.9438017f}, {0.4867165f, -0.9656149f, 0.4867165f, -1.9312297f, 0.946866f}, {0.4874246f, -0.9670198f, 0.4874246f, -1.9340396f, 0.9496986f}, {0.4880803f, -0.9683205f, 0.4880803f, -1.936641f, 0.952321f}, {0.4886882f, -0.9695265f, 0.4886882f, -1.9390531f, 0.9547526f}, {0.4892526f, -0.9706464f, 0.4892526f, -1.9412928f, 0.9570105f}, {0.4897775f, -0.9716877f, 0.4897775f, -1.9433755f, 0.95911f}, {0.4902663f, -0.9726574f, 0.4902663f, -1.9453149f, 0.9610652f}, {0.4907221f, -0.9735617f, 0.4907221f, -1.9471233f, 0.9628882f}, {0.4911476f, -0.9744059f, 0.4911476f, -1.9488119f, 0.9645904f}, {0.4915455f, -0.9751953f, 0.4915455f, -1.9503905f, 0.9661819f}, {0.4919179f, -0.9759341f, 0.4919179f, -1.9518683f, 0.9676716f}, {0.492267f, -0.9766267f, 0.492267f, -1.9532533f, 0.9690679f}, {0.4925945f, -0.9772765f, 0.4925945f, -1.954553f, 0.9703781f}, {0.4929022f, -0.977887f, 0.4929022f, -1.955774f, 0.9716089f}, {0.4931985f, -0.9784747f, 0.4931985f, -1.9569495f, 0.9727939f}, {0.4934933f, -0.9790597f, 0.4934933f, -1.9581194f, 0.9739733f}, {0.493786f, -0.9796402f, 0.493786f, -1.9592805f, 0.9751438f}, {0.4940754f, -0.9802145f, 0.4940754f, -1.960429f, 0.9763016f}, {0.4943607f, -0.9807805f, 0.4943607f, -1.961561f, 0.9774428f}, {0.4946408f, -0.9813363f, 0.4946408f, -1.9626725f, 0.9785633f}, {0.4949149f, -0.9818799f, 0.4949149f, -1.9637598f, 0.9796594f}, {0.4951819f, -0.9824097f, 0.4951819f, -1.9648195f, 0.9807276f}, {0.4954412f, -0.9829241f, 0.4954412f, -1.9658482f, 0.9817647f}, {0.495692f, -0.9834216f, 0.495692f, -1.9668433f, 0.9827679f}, {0.4959337f, -0.9839012f, 0.4959337f, -1.9678025f, 0.9837348f}, {0.4961659f, -0.984362f, 0.4961659f, -1.968724f, 0.9846638f}, {0.4963883f, -0.9848032f, 0.4963883f, -1.9696064f, 0.9855533f}, {0.4966006f, -0.9852244f, 0.4966006f, -1.9704488f, 0.9864026f}, {0.4968028f, -0.9856255f, 0.4968028f, -1.971251f, 0.9872112f}, {0.4969948f, -0.9860064f, 0.4969948f, -1.9720127f, 0.9879791f}, {0.4971767f, -0.9863672f, 0.4971767f, -1.9727344f, 0.9887067f}, {0.4973486f, -0.9867084f, 0.4973486f, -1.9734167f, 0.9893945f}, {0.4975109f, -0.9870303f, 0.4975109f, -1.9740606f, 0.9900436f}},
-  {{0.3978636f, -0.7877524f, 0.3978636f, -1.5755049f, 0.5914543f}, {0.3984944f, -0.7890015f, 0.3984944f, -1.578003f, 0.5939777f}, {0.4003411f, -0.7926579f, 0.4003411f, -1.5853157f, 0.6013644f}, {0.403274f, -0.7984648f, 0.403274f, -1.5969296f, 0.6130959f}, {0.4071015f, -0.8060431f, 0.4071015f, -1.6120862f, 0.6284059f}, {0.411599f, -0.814948f, 0.411599f, -1.6298959f, 0.646396f}, {0.4165376f, -0.8247262f, 0.4165376f, -1.6494524f, 0.6661504f}, {0.4217068f, -0.834961f, 0.4217068f, -1.6699219f, 0.6868272f}, {0.4269287f, -0.8453f, 0.4269287f, -1.6906001f, 0.7077147f}, {0.4320639f, -0.8554676f, 0.4320639f, -1.7109352f, 0.7282556f}, {0.4370113f, -0.8652633f, 0.4370113f, -1.7305266f, 0.7480454f}, {0.4417037f, -0.8745539f, 0.4417037f, -1.7491078f, 0.7668146f}, {0.4461012f, -0.8832609f, 0.4461012f, -1.7665217f, 0.7844049f}, {0.4501857f, -0.891348f, 0.4501857f, -1.7826959f, 0.8007428f}, {0.4539542f, -0.8988095f, 0.4539542f, -1.797619f, 0.8158169f}, {0.4574145f, -0.9056607f, 0.4574145f, -1.8113214f, 0.8296581f}, {0.4605811f, -0.9119304f, 0.4605811f, -1.8238608f, 0.8423245f}, {0.4634725f, -0.9176552f, 0.4634725f, -1.8353104f, 0.8538899f}, {0.466109f, -0.9228755f, 0.466109f, -1.8457509f, 0.8644361f}, {0.4685117f, -0.9276327f, 0.4685117f, -1.8552654f, 0.8740469f}, {0.4707011f, -0.9319676f, 0.4707011f, -1.8639353f, 0.8828046f}, {0.4726969f, -0.9359192f, 0.4726969f, -1.8718383f, 0.8907876f}, {0.4745174f, -0.9395237f, 0.4745174f, -1.8790473f, 0.8980696f}, {0.4761795f, -0.9428146f, 0.4761795f, -1.8856293f, 0.9047182f}, {0.4776988f, -0.9458228f, 0.4776988f, -1.8916455f, 0.9107953f}, {0.4790893f, -0.9485758f, 0.4790893f, -1.8971516f, 0.9163572f}, {0.4803636f, -0.9510988f, 0.4803636f, -1.9021976f, 0.9214543f}, {0.4815331f, -0.9534144f, 0.4815331f, -1.9068287f, 0.9261323f}, {0.482608f, -0.9555426f, 0.482608f, -1.9110853f, 0.9304319f}, {0.4835974f, -0.9575017f, 0.4835974f, -1.9150035f, 0.9343898f}, {0.4845096f, -0.9593078f, 0.4845096f, -1.9186157f, 0.9380385f}, {0.4853519f, -0.9609755f, 0.4853519f, -1.9219509f, 0.9414075f}, {0.4861307f, -0.9625175f, 0.4861307f, -1.925035f, 0.9445228f}, {0.486852f, -0.9639456f, 0.486852f, -1.9278911f, 0.9474079f}, {0.4875209f, -0.96527f, 0.4875209f, -1.93054f, 0.9500836f}, {0.4881422f, -0.9665002f, 0.4881422f, -1.9330003f, 0.9525688f}, {0.4887201f, -0.9676443f, 0.4887201f, -1.9352887f, 0.9548803f}, {0.4892583f, -0.96871f, 0.4892583f, -1.93742f, 0.9570332f}, {0.4897603f, -0.9697039f, 0.4897603f, -1.9394078f, 0.9590411f}, {0.4902291f, -0.9706321f, 0.4902291f, -1.9412642f, 0.9609163f}, {0.4906674f, -0.9715f, 0.4906674f, -1.943f, 0.9626697f}, {0.4910778f, -0.9723126f, 0.4910778f, -1.9446252f, 0.9643114f}, {0.4914626f, -0.9730743f, 0.4914626f, -1.9461487f, 0.9658502f}, {0.4918236f, -0.9737892f, 0.4918236f, -1.9475784f, 0.9672944f}, {0.4921628f, -0.9744609f, 0.4921628f, -1.9489217f, 0.9686514f}, {0.4924895f, -0.9751076f, 0.4924895f, -1.9502152f, 0.969958f}, {0.4928146f, -0.9757513f, 0.4928146f, -1.9515027f, 0.9712585f}, {0.4931373f, -0.9763903f, 0.4931373f, -1.9527807f, 0.9725494f}, {0.4934566f, -0.9770225f, 0.4934566f, -1.9540449f, 0.9738264f}, {0.4937713f, -0.9776456f, 0.4937713f, -1.9552911f, 0.9750853f}, {0.4940804f, -0.9782575f, 0.4940804f, -1.956515f, 0.9763215f}, {0.4943827f, -0.9788562f, 0.4943827f, -1.9577123f, 0.977531f}, {0.4946774f, -0.9794397f, 0.4946774f, -1.9588793f, 0.9787098f}, {0.4949636f, -0.9800062f, 0.4949636f, -1.9600124f, 0.9798543f}, {0.4952404f, -0.9805543f, 0.4952404f, -1.9611085f, 0.9809616f}, {0.4955072f, -0.9810826f, 0.4955072f, -1.9621652f, 0.982029f}, {0.4957636f, -0.9815902f, 0.4957636f, -1.9631805f, 0.9830545f}, {0.4960092f, -0.9820764f, 0.4960092f, -1.9641528f, 0.9840366f}, {0.4962436f, -0.9825406f, 0.4962436f, -1.9650812f, 0.9849744f}, {0.4964668f, -0.9829826f, 0.4964668f, -1.9659652f, 0.9858673f}, {0.4966789f, -0.9834024f, 0.4966789f, -1.9668047f, 0.9867154f}, {0.4968797f, -0.9838001f, 0.4968797f, -1.9676002f, 0.987519f}, {0.4970697f, -0.9841762f, 0.4970697f, -1.9683524f, 0.9882787f}, {0.4972489f, -0.9845311f, 0.4972489f, -1.9690622f, 0.9889957f}},
-  {{0.3895464f, -0.7693506f, 0.3895464f, -1.5387011f, 0.5581856f}, {0.3902145f, -0.77067f, 0.3902145f, -1.54134f, 0.5608578f}, {0.392171f, -0.7745342f, 0.392171f, -1.5490683f, 0.5686841f}, {0.3952814f, -0.7806772f, 0.3952814f, -1.5613544f, 0.5811257f}, {0.3993463f, -0.7887052f, 0.3993463f, -1.5774104f, 0.597385f}, {0.4041308f, -0.7981546f, 0.4041308f, -1.5963093f, 0.6165232f}, {0.4093948f, -0.808551f, 0.4093948f, -1.6171019f, 0.6375792f}, {0.414916f, -0.8194553f, 0.414916f, -1.6389106f, 0.659664f}, {0.4205054f, -0.8304944f, 0.4205054f, -1.6609887f, 0.6820217f}, {0.4260138f, -0.8413734f, 0.4260138f, -1.6827469f, 0.7040554f}, {0.4313319f, -0.8518765f, 0.4313319f, -1.7037529f, 0.7253274f}, {0.4363857f, -0.8618577f, 0.4363857f, -1.7237154f, 0.7455427f}, {0.4411309f, -0.8712295f, 0.4411309f, -1.7424591f, 0.7645237f}, {0.4455461f, -0.8799494f, 0.4455461f, -1.7598989f, 0.7821843f}, {0.4496263f, -0.8880079f, 0.4496263f, -1.7760158f, 0.7985053f}, {0.4533785f, -0.8954183f, 0.4533785f, -1.7908366f, 0.8135139f}, {0.4568168f, -0.9022091f, 0.4568168f, -1.8044181f, 0.8272673f}, {0.4599603f, -0.9084174f, 0.4599603f, -1.8168348f, 0.8398412f}, {0.46283f, -0.9140851f, 0.46283f, -1.8281701f, 0.8513201f}, {0.465448f, -0.9192555f, 0.465448f, -1.8385109f, 0.8617918f}, {0.4678358f, -0.9239714f, 0.4678358f, -1.8479427f, 0.8713431f}, {0.4700143f, -0.9282739f, 0.4700143f, -1.8565479f, 0.8800572f}, {0.4720031f, -0.9322017f, 0.4720031f, -1.8644034f, 0.8880122f}, {0.4738202f, -0.9357905f, 0.4738202f, -1.871581f, 0.8952807f}, {0.4754822f, -0.939073f, 0.4754822f, -1.8781459f, 0.9019287f}, {0.4770042f, -0.9420789f, 0.4770042f, -1.8841578f, 0.9080168f}, {0.4783998f, -0.9448352f, 0.4783998f, -1.8896705f, 0.9135992f}, {0.4796813f, -0.9473662f, 0.4796813f, -1.8947324f, 0.9187252f}, {0.4808597f, -0.9496935f, 0.4808597f, -1.8993871f, 0.9234389f}, {0.4819449f, -0.9518368f, 0.4819449f, -1.9036736f, 0.9277797f}, {0.4829458f, -0.9538135f, 0.4829458f, -1.907627f, 0.9317831f}, {0.4838702f, -0.9556393f, 0.4838702f, -1.9112785f, 0.9354809f}, {0.4847254f, -0.9573281f, 0.4847254f, -1.9146563f, 0.9389014f}, {0.4855175f, -0.9588927f, 0.4855175f, -1.9177853f, 0.9420701f}, {0.4862524f, -0.9603441f, 0.4862524f, -1.9206882f, 0.9450097f}, {0.4869352f, -0.9616925f, 0.4869352f, -1.9233851f, 0.9477408f}, {0.4875704f, -0.962947f, 0.4875704f, -1.9258941f, 0.9502816f}, {0.4881621f, -0.9641158f, 0.4881621f, -1.9282315f, 0.9526486f}, {0.4887142f, -0.965206f, 0.4887142f, -1.930412f, 0.9548567f}, {0.4892298f, -0.9662244f, 0.4892298f, -1.9324487f, 0.9569192f}, {0.489712f, -0.9671768f, 0.489712f, -1.9343536f, 0.9588482f}, {0.4901636f, -0.9680687f, 0.4901636f, -1.9361374f, 0.9606545f}, {0.490587f, -0.9689048f, 0.490587f, -1.9378097f, 0.962348f}, {0.4909844f, -0.9696897f, 0.4909844f, -1.9393794f, 0.9639377f}, {0.4913579f, -0.9704273f, 0.4913579f, -1.9408545f, 0.9654314f}, {0.4917175f, -0.9711375f, 0.4917175f, -1.942275f, 0.9668699f}, {0.4920755f, -0.9718446f, 0.4920755f, -1.9436892f, 0.968302f}, {0.4924309f, -0.9725465f, 0.4924309f, -1.9450931f, 0.9697236f}, {0.4927826f, -0.973241f, 0.4927826f, -1.9464821f, 0.9711302f}, {0.4931292f, -0.9739257f, 0.4931292f, -1.9478514f, 0.9725169f}, {0.4934697f, -0.9745982f, 0.4934697f, -1.9491964f, 0.9738789f}, {0.4938029f, -0.9752562f, 0.4938029f, -1.9505124f, 0.9752116f}, {0.4941277f, -0.9758976f, 0.4941277f, -1.9517952f, 0.9765106f}, {0.494443f, -0.9765204f, 0.494443f, -1.9530408f, 0.977772f}, {0.4947481f, -0.977123f, 0.4947481f, -1.9542461f, 0.9789925f}, {0.4950423f, -0.977704f, 0.4950423f, -1.955408f, 0.9801692f}, {0.495325f, -0.9782623f, 0.495325f, -1.9565245f, 0.9812999f}, {0.4955957f, -0.978797f, 0.4955957f, -1.9575939f, 0.9823828f}, {0.4958542f, -0.9793076f, 0.4958542f, -1.9586151f, 0.9834169f}, {0.4961004f, -0.9797938f, 0.4961004f, -1.9595876f, 0.9844017f}, {0.4963343f, -0.9802556f, 0.4963343f, -1.9605113f, 0.9853371f}, {0.4965559f, -0.9806933f, 0.4965559f, -1.9613865f, 0.9862234f}, {0.4967654f, -0.9811071f, 0.4967654f, -1.9622142f, 0.9870615f}, {0.4969631f, -0.9814976f, 0.4969631f, -1.9629952f, 0.9878525f}},
-  {{0.3808748f, -0.7498658f, 0.3808748f, -1.4997317f, 0.5234993f}, {0.3815794f, -0.751253f, 0.3815794f, -1.502506f, 0.5263175f}, {0.3836439f, -0.7553177f, 0.3836439f, -1.5106354f, 0.5345758f}, {0.3869294f, -0.7617861f, 0.3869294f, -1.5235722f, 0.5477177f}, {0.3912292f, -0.7702516f, 0.3912292f, -1.5405032f, 0.5649169f}, {0.3962994f, -0.7802338f, 0.3962994f, -1.5604676f, 0.5851977f}, {0.401889f, -0.7912386f, 0.401889f, -1.5824772f, 0.6075561f}, {0.4077646f, -0.8028063f, 0.4077646f, -1.6056127f, 0.6310583f}, {0.4137261f, -0.8145434f, 0.4137261f, -1.6290868f, 0.6549044f}, {0.4196145f, -0.8261364f, 0.4196145f, -1.6522728f, 0.6784579f}, {0.4253118f, -0.8373533f, 0.4253118f, -1.6747067f, 0.7012473f}, {0.4307376f, -0.8480355f, 0.4307376f, -1.696071f, 0.7229502f}, {0.4358422f, -0.8580855f, 0.4358422f, -1.716171f, 0.7433687f}, {0.4406006f, -0.8674538f, 0.4406006f, -1.7349077f, 0.7624023f}, {0.4450057f, -0.8761266f, 0.4450057f, -1.7522531f, 0.7800226f}, {0.449063f, -0.8841146f, 0.449063f, -1.7682292f, 0.7962519f}, {0.4527865f, -0.8914454f, 0.4527865f, -1.7828908f, 0.8111459f}, {0.4561952f, -0.8981565f, 0.4561952f, -1.796313f, 0.8247808f}, {0.4593109f, -0.9042907f, 0.4593109f, -1.8085814f, 0.8372436f}, {0.4621564f, -0.9098929f, 0.4621564f, -1.8197859f, 0.8486257f}, {0.4647545f, -0.915008f, 0.4647545f, -1.830016f, 0.8590179f}, {0.467127f, -0.9196791f, 0.467127f, -1.8393582f, 0.8685082f}, {0.4692948f, -0.923947f, 0.4692948f, -1.8478939f, 0.8771791f}, {0.471277f, -0.9278495f, 0.471277f, -1.8556989f, 0.8851079f}, {0.4730913f, -0.9314215f, 0.4730913f, -1.862843f, 0.8923651f}, {0.4747538f, -0.9346947f, 0.4747538f, -1.8693894f, 0.8990153f}, {0.4762792f, -0.9376979f, 0.4762792f, -1.8753958f, 0.9051169f}, {0.4776807f, -0.9404571f, 0.4776807f, -1.8809141f, 0.9107227f}, {0.47897f, -0.9429955f, 0.47897f, -1.8859911f, 0.9158801f}, {0.4801579f, -0.9453343f, 0.4801579f, -1.8906687f, 0.9206318f}, {0.481254f, -0.9474923f, 0.481254f, -1.8949845f, 0.9250161f}, {0.4822668f, -0.9494862f, 0.4822668f, -1.8989724f, 0.9290672f}, {0.483204f, -0.9513313f, 0.483204f, -1.9026627f, 0.9328159f}, {0.4840724f, -0.9530412f, 0.4840724f, -1.9060824f, 0.9362898f}, {0.4848784f, -0.954628f, 0.4848784f, -1.9092559f, 0.9395136f}, {0.4856274f, -0.9561026f, 0.4856274f, -1.9122051f, 0.9425095f}, {0.4863244f, -0.9574748f, 0.4863244f, -1.9149496f, 0.9452975f}, {0.4869739f, -0.9587535f, 0.4869739f, -1.917507f, 0.9478955f}, {0.4875799f, -0.9599467f, 0.4875799f, -1.9198933f, 0.9503196f}, {0.4881461f, -0.9610614f, 0.4881461f, -1.9221228f, 0.9525844f}, {0.4886757f, -0.9621042f, 0.4886757f, -1.9242083f, 0.954703f}, {0.4891718f, -0.9630808f, 0.4891718f, -1.9261616f, 0.9566872f}, {0.489637f, -0.9639966f, 0.489637f, -1.9279933f, 0.9585479f}, {0.4900737f, -0.9648564f, 0.4900737f, -1.9297128f, 0.9602947f}, {0.4904841f, -0.9656645f, 0.4904841f, -1.9313289f, 0.9619365f}, {0.4908794f, -0.9664428f, 0.4908794f, -1.9328855f, 0.9635177f}, {0.491273f, -0.9672177f, 0.491273f, -1.9344353f, 0.9650921f}, {0.4916638f, -0.9679871f, 0.4916638f, -1.9359741f, 0.9666553f}, {0.4920505f, -0.9687484f, 0.4920505f, -1.9374968f, 0.9682021f}, {0.4924318f, -0.9694991f, 0.4924318f, -1.9389982f, 0.9697273f}, {0.4928064f, -0.9702366f, 0.4928064f, -1.9404731f, 0.9712255f}, {0.4931729f, -0.9709582f, 0.4931729f, -1.9419164f, 0.9726917f}, {0.4935303f, -0.9716617f, 0.4935303f, -1.9433234f, 0.974121f}, {0.4938773f, -0.972345f, 0.4938773f, -1.9446899f, 0.9755092f}, {0.4942131f, -0.9730061f, 0.4942131f, -1.9460123f, 0.9768525f}, {0.4945369f, -0.9736436f, 0.4945369f, -1.9472873f, 0.9781477f}, {0.4948481f, -0.9742563f, 0.4948481f, -1.9485126f, 0.9793924f}, {0.4951462f, -0.9748431f, 0.4951462f, -1.9496863f, 0.9805847f}, {0.4954309f, -0.9754036f, 0.4954309f, -1.9508072f, 0.9817234f}, {0.495702f, -0.9759374f, 0.495702f, -1.9518748f, 0.9828079f}, {0.4959595f, -0.9764444f, 0.4959595f, -1.9528889f, 0.9838381f}, {0.4962036f, -0.976925f, 0.4962036f, -1.9538499f, 0.9848143f}, {0.4964344f, -0.9773794f, 0.4964344f, -1.9547587f, 0.9857376f}, {0.4966522f, -0.9778082f, 0.4966522f, -1.9556165f, 0.9866089f}},
-  {{0.3718871f, -0.7292997f, 0.3718871f, -1.4585994f, 0.4875483f}, {0.372627f, -0.7307508f, 0.372627f, -1.4615016f, 0.4905081f}, {0.3747964f, -0.7350052f, 0.3747964f, -1.4700104f, 0.4991858f}, {0.3782525f, -0.7417827f, 0.3782525f, -1.4835654f, 0.5130098f}, {0.3827823f, -0.750666f, 0.3827823f, -1.5013321f, 0.5311291f}, {0.3881336f, -0.7611605f, 0.3881336f, -1.5223209f, 0.5525345f}, {0.3940457f, -0.7727545f, 0.3940457f, -1.545509f, 0.5761828f}, {0.4002744f, -0.7849695f, 0.4002744f, -1.5699389f, 0.6010976f}, {0.4066092f, -0.7973924f, 0.4066092f, -1.5947849f, 0.6264367f}, {0.412881f, -0.809692f, 0.412881f, -1.619384f, 0.651524f}, {0.4189634f, -0.8216201f, 0.4189634f, -1.6432402f, 0.6758537f}, {0.4247688f, -0.8330048f, 0.4247688f, -1.6660097f, 0.699075f}, {0.4302421f, -0.8437384f, 0.4302421f, -1.6874768f, 0.7209682f}, {0.4353542f, -0.8537637f, 0.4353542f, -1.7075274f, 0.7414168f}, {0.4400954f, -0.8630616f, 0.4400954f, -1.7261233f, 0.7603818f}, {0.4444698f, -0.8716401f, 0.4444698f, -1.7432803f, 0.7778793f}, {0.4484906f, -0.8795251f, 0.4484906f, -1.7590503f, 0.7939622f}, {0.4521767f, -0.8867539f, 0.4521767f, -1.7735078f, 0.8087067f}, {0.4555504f, -0.89337f, 0.4555504f, -1.7867399f, 0.8222015f}, {0.4586352f, -0.8994195f, 0.4586352f, -1.7988391f, 0.8345407f}, {0.4614548f, -0.9049491f, 0.4614548f, -1.8098982f, 0.8458193f}, {0.4640323f, -0.9100037f, 0.4640323f, -1.8200074f, 0.8561292f}, {0.4663894f, -0.9146263f, 0.4663894f, -1.8292525f, 0.8655578f}, {0.4685466f, -0.9188566f, 0.4685466f, -1.8377133f, 0.8741865f}, {0.4705226f, -0.9227317f, 0.4705226f, -1.8454634f, 0.8820904f}, {0.4723346f, -0.9262851f, 0.4723346f, -1.8525702f, 0.8893383f}, {0.4739981f, -0.9295475f, 0.4739981f, -1.859095f, 0.8959926f}, {0.4755274f, -0.9325465f, 0.4755274f, -1.8650931f, 0.9021097f}, {0.4769352f, -0.9353072f, 0.4769352f, -1.8706145f, 0.9077407f}, {0.4782328f, -0.937852f, 0.4782328f, -1.875704f, 0.9129312f}, {0.4794307f, -0.9402011f, 0.4794307f, -1.8804022f, 0.9177226f}, {0.480538f, -0.9423726f, 0.480538f, -1.8847452f, 0.9221519f}, {0.481563f, -0.9443828f, 0.481563f, -1.8887656f, 0.9262521f}, {0.4825133f, -0.9462463f, 0.4825133f, -1.8924927f, 0.9300531f}, {0.4833954f, -0.9479763f, 0.4833954f, -1.8959526f, 0.9335817f}, {0.4842155f, -0.9495845f, 0.4842155f, -1.8991689f, 0.9368619f}, {0.4849788f, -0.9510815f, 0.4849788f, -1.9021629f, 0.9399153f}, {0.4856903f, -0.9524768f, 0.4856903f, -1.9049536f, 0.9427613f}, {0.4863544f, -0.9537791f, 0.4863544f, -1.9075582f, 0.9454176f}, {0.486975f, -0.9549961f, 0.486975f, -1.9099922f, 0.9478999f}, {0.4875556f, -0.9561348f, 0.4875556f, -1.9122695f, 0.9502224f}, {0.4880996f, -0.9572015f, 0.4880996f, -1.9144029f, 0.9523982f}, {0.4886097f, -0.9582019f, 0.4886097f, -1.9164039f, 0.9544388f}, {0.4890887f, -0.9591413f, 0.4890887f, -1.9182827f, 0.9563549f}, {0.489539f, -0.9600244f, 0.489539f, -1.9200488f, 0.9581561f}, {0.4899728f, -0.9608751f, 0.4899728f, -1.9217501f, 0.9598912f}, {0.4904048f, -0.9617221f, 0.4904048f, -1.9234443f, 0.961619f}, {0.4908337f, -0.9625634f, 0.4908337f, -1.9251267f, 0.9633348f}, {0.4912582f, -0.9633959f, 0.4912582f, -1.9267918f, 0.965033f}, {0.4916769f, -0.9642169f, 0.4916769f, -1.9284338f, 0.9667076f}, {0.4920882f, -0.9650236f, 0.4920882f, -1.9300471f, 0.9683529f}, {0.4924908f, -0.965813f, 0.4924908f, -1.9316261f, 0.9699632f}, {0.4928833f, -0.9665828f, 0.4928833f, -1.9331656f, 0.9715332f}, {0.4932646f, -0.9673305f, 0.4932646f, -1.934661f, 0.9730583f}, {0.4936336f, -0.9680541f, 0.4936336f, -1.9361083f, 0.9745343f}, {0.4939894f, -0.968752f, 0.4939894f, -1.9375039f, 0.9759577f}, {0.4943314f, -0.9694227f, 0.4943314f, -1.9388453f, 0.9773257f}, {0.4946591f, -0.9700652f, 0.4946591f, -1.9401304f, 0.9786363f}, {0.494972f, -0.9706789f, 0.494972f, -1.9413579f, 0.9798881f}, {0.4952701f, -0.9712635f, 0.4952701f, -1.942527f, 0.9810804f}, {0.4955533f, -0.9718188f, 0.4955533f, -1.9436377f, 0.9822132f}, {0.4958217f, -0.9723452f, 0.4958217f, -1.9446904f, 0.9832868f}, {0.4960755f, -0.972843f, 0.4960755f, -1.945686f, 0.9843021f}, {0.4963151f, -0.9733129f, 0.4963151f, -1.9466258f, 0.9852605f}},
-  {{0.3626301f, -0.7076566f, 0.3626301f, -1.4153133f, 0.4505206f}, {0.3634039f, -0.7091666f, 0.3634039f, -1.4183332f, 0.4536157f}, {0.3656738f, -0.7135962f, 0.3656738f, -1.4271924f, 0.4626952f}, {0.3692938f, -0.7206605f, 0.3692938f, -1.4413209f, 0.4771752f}, {0.374046f, -0.7299341f, 0.374046f, -1.4598681f, 0.4961838f}, {0.3796708f, -0.7409107f, 0.3796708f, -1.4818213f, 0.5186831f}, {0.3858986f, -0.753064f, 0.3858986f, -1.506128f, 0.5435945f}, {0.3924756f, -0.7658986f, 0.3924756f, -1.5317973f, 0.5699023f}, {0.399181f, -0.7789839f, 0.399181f, -1.5579678f, 0.5967238f}, {0.4058361f, -0.7919712f, 0.4058361f, -1.5839424f, 0.6233445f}, {0.4123059f, -0.8045967f, 0.4123059f, -1.6091934f, 0.6492237f}, {0.4184954f, -0.8166752f, 0.4184954f, -1.6333504f, 0.6739817f}, {0.4243438f, -0.8280881f, 0.4243438f, -1.6561762f, 0.6973753f}, {0.4298177f, -0.8387702f, 0.4298177f, -1.6775403f, 0.7192708f}, {0.4349043f, -0.8486964f, 0.4349043f, -1.6973928f, 0.7396172f}, {0.4396057f, -0.857871f, 0.4396057f, -1.7157421f, 0.7584228f}, {0.4439342f, -0.8663179f, 0.4439342f, -1.7326358f, 0.7757369f}, {0.4479085f, -0.8740736f, 0.4479085f, -1.7481472f, 0.7916341f}, {0.4515511f, -0.8811818f, 0.4515511f, -1.7623636f, 0.8062042f}, {0.4548859f, -0.8876897f, 0.4548859f, -1.7753794f, 0.8195437f}, {0.4579377f, -0.8936451f, 0.4579377f, -1.7872902f, 0.8317508f}, {0.4607304f, -0.8990948f, 0.4607304f, -1.7981897f, 0.8429215f}, {0.4632868f, -0.9040836f, 0.4632868f, -1.8081671f, 0.8531471f}, {0.4656284f, -0.9086532f, 0.4656284f, -1.8173063f, 0.8625136f}, {0.4677751f, -0.9128424f, 0.4677751f, -1.8256847f, 0.8711004f}, {0.4697451f, -0.9166867f, 0.4697451f, -1.8333734f, 0.8789804f}, {0.471555f, -0.9202187f, 0.471555f, -1.8404373f, 0.88622f}, {0.4732199f, -0.9234676f, 0.4732199f, -1.8469351f, 0.8928795f}, {0.4747533f, -0.92646f, 0.4747533f, -1.8529199f, 0.8990132f}, {0.4761676f, -0.9292198f, 0.4761676f, -1.8584397f, 0.9046702f}, {0.4774737f, -0.9317687f, 0.4774737f, -1.8635375f, 0.9098948f}, {0.4786817f, -0.934126f, 0.4786817f, -1.8682521f, 0.9147267f}, {0.4798004f, -0.9363092f, 0.4798004f, -1.8726183f, 0.9192016f}, {0.4808379f, -0.9383338f, 0.4808379f, -1.8766675f, 0.9233515f}, {0.4818014f, -0.940214f, 0.4818014f, -1.8804279f, 0.9272054f}, {0.4826973f, -0.9419624f, 0.4826973f, -1.8839247f, 0.9307892f}, {0.4835316f, -0.9435904f, 0.4835316f, -1.8871808f, 0.9341263f}, {0.4843094f, -0.9451083f, 0.4843094f, -1.8902167f, 0.9372377f}, {0.4850356f, -0.9465254f, 0.4850356f, -1.8930509f, 0.9401424f}, {0.4857144f, -0.9478501f, 0.4857144f, -1.8957001f, 0.9428576f}, {0.4863497f, -0.9490898f, 0.4863497f, -1.8981795f, 0.9453986f}, {0.4869449f, -0.9502513f, 0.4869449f, -1.9005027f, 0.9477796f}, {0.4875033f, -0.951341f, 0.4875033f, -1.902682f, 0.9500131f}, {0.4880277f, -0.9523644f, 0.4880277f, -1.9047288f, 0.9521108f}, {0.4885208f, -0.9533266f, 0.4885208f, -1.9066531f, 0.954083f}, {0.4889958f, -0.9542536f, 0.4889958f, -1.9085072f, 0.9559832f}, {0.4894689f, -0.9551769f, 0.4894689f, -1.9103538f, 0.9578757f}, {0.4899389f, -0.9560939f, 0.4899389f, -1.9121879f, 0.9597554f}, {0.490404f, -0.9570017f, 0.490404f, -1.9140034f, 0.9616161f}, {0.4908628f, -0.957897f, 0.4908628f, -1.9157941f, 0.9634513f}, {0.4913137f, -0.9587768f, 0.4913137f, -1.9175536f, 0.9652547f}, {0.491755f, -0.9596381f, 0.491755f, -1.9192761f, 0.96702f}, {0.4921854f, -0.9604779f, 0.4921854f, -1.9209558f, 0.9687415f}, {0.4926035f, -0.9612938f, 0.4926035f, -1.9225876f, 0.9704139f}, {0.4930082f, -0.9620836f, 0.4930082f, -1.9241671f, 0.9720327f}, {0.4933985f, -0.9628453f, 0.4933985f, -1.9256906f, 0.973594f}, {0.4937737f, -0.9635775f, 0.4937737f, -1.9271549f, 0.9750948f}, {0.4941332f, -0.964279f, 0.4941332f, -1.928558f, 0.9765328f}, {0.4944766f, -0.9649492f, 0.4944766f, -1.9298984f, 0.9779065f}, {0.4948038f, -0.9655876f, 0.4948038f, -1.9311752f, 0.9792151f}, {0.4951146f, -0.9661942f, 0.4951146f, -1.9323884f, 0.9804584f}, {0.4954092f, -0.9667691f, 0.4954092f, -1.9335383f, 0.981637f}, {0.4956879f, -0.967313f, 0.4956879f, -1.9346259f, 0.9827517f}, {0.495951f, -0.9678263f, 0.495951f, -1.9356527f, 0.983804f}},
-  {{0.3531597f, -0.6849412f, 0.3531597f, -1.3698825f, 0.4126389f}, {0.3539654f, -0.6865037f, 0.3539654f, -1.3730075f, 0.4158614f}, {0.3563301f, -0.69109f, 0.3563301f, -1.3821801f, 0.4253203f}, {0.3601056f, -0.6984125f, 0.3601056f, -1.3968249f, 0.4404222f}, {0.3650697f, -0.7080403f, 0.3650697f, -1.4160805f, 0.4602788f}, {0.3709571f, -0.7194586f, 0.3709571f, -1.4389173f, 0.4838284f}, {0.3774904f, -0.7321298f, 0.3774904f, -1.4642596f, 0.5099616f}, {0.3844068f, -0.745544f, 0.3844068f, -1.4910879f, 0.5376274f}, {0.3914763f, -0.7592549f, 0.3914763f, -1.5185098f, 0.5659051f}, {0.3985107f, -0.772898f, 0.3985107f, -1.5457959f, 0.5940429f}, {0.4053665f, -0.7861945f, 0.4053665f, -1.5723889f, 0.6214659f}, {0.4119412f, -0.7989458f, 0.4119412f, -1.5978916f, 0.6477646f}, {0.4181679f, -0.8110224f, 0.4181679f, -1.6220448f, 0.6726716f}, {0.4240086f, -0.8223502f, 0.4240086f, -1.6447004f, 0.6960344f}, {0.4294471f, -0.832898f, 0.4294471f, -1.665796f, 0.7177884f}, {0.4344833f, -0.8426655f, 0.4344833f, -1.685331f, 0.7379331f}, {0.4391281f, -0.851674f, 0.4391281f, -1.7033479f, 0.7565124f}, {0.4433996f, -0.8599585f, 0.4433996f, -1.719917f, 0.7735986f}, {0.4473204f, -0.8675626f, 0.4473204f, -1.7351252f, 0.7892815f}, {0.4509148f, -0.8745339f, 0.4509148f, -1.7490678f, 0.8036593f}, {0.4542082f, -0.8809213f, 0.4542082f, -1.7618426f, 0.8168327f}, {0.4572253f, -0.8867729f, 0.4572253f, -1.7735458f, 0.8289013f}, {0.4599901f, -0.8921351f, 0.4599901f, -1.7842702f, 0.8399604f}, {0.462525f, -0.8970514f, 0.462525f, -1.7941028f, 0.8500999f}, {0.4648509f, -0.9015624f, 0.4648509f, -1.8031248f, 0.8594035f}, {0.466987f, -0.9057054f, 0.466987f, -1.8114108f, 0.8679481f}, {0.468951f, -0.9095145f, 0.468951f, -1.819029f, 0.8758041f}, {0.4707588f, -0.9130207f, 0.4707588f, -1.8260414f, 0.8830353f}, {0.472425f, -0.9162521f, 0.472425f, -1.8325042f, 0.8896999f}, {0.4739625f, -0.9192341f, 0.4739625f, -1.8384682f, 0.89585f}, {0.4753833f, -0.9219896f, 0.4753833f, -1.8439792f, 0.901533f}, {0.4766979f, -0.9245392f, 0.4766979f, -1.8490785f, 0.9067914f}, {0.4779159f, -0.9269015f, 0.4779159f, -1.8538031f, 0.9116635f}, {0.4790459f, -0.9290932f, 0.4790459f, -1.8581865f, 0.9161837f}, {0.4800958f, -0.9311294f, 0.4800958f, -1.8622588f, 0.9203831f}, {0.4810724f, -0.9330235f, 0.4810724f, -1.866047f, 0.9242896f}, {0.4819821f, -0.9347878f, 0.4819821f, -1.8695756f, 0.9279283f}, {0.4828305f, -0.9364333f, 0.4828305f, -1.8728667f, 0.9313221f}, {0.4836228f, -0.93797f, 0.4836228f, -1.87594f, 0.9344913f}, {0.4843636f, -0.9394068f, 0.4843636f, -1.8788135f, 0.9374545f}, {0.4850571f, -0.9407517f, 0.4850571f, -1.8815035f, 0.9402285f}, {0.4857071f, -0.9420123f, 0.4857071f, -1.8840246f, 0.9428282f}, {0.4863169f, -0.9431951f, 0.4863169f, -1.8863901f, 0.9452676f}, {0.4868898f, -0.9443061f, 0.4868898f, -1.8886122f, 0.9475591f}, {0.4874285f, -0.9453509f, 0.4874285f, -1.8907018f, 0.9497139f}, {0.4879476f, -0.9463578f, 0.4879476f, -1.8927155f, 0.9517904f}, {0.4884648f, -0.9473607f, 0.4884648f, -1.8947215f, 0.953859f}, {0.4889785f, -0.9483571f, 0.4889785f, -1.8967142f, 0.9559139f}, {0.4894871f, -0.9493435f, 0.4894871f, -1.8986871f, 0.9579484f}, {0.4899889f, -0.9503167f, 0.4899889f, -1.9006333f, 0.9599554f}, {0.490482f, -0.9512731f, 0.490482f, -1.9025461f, 0.9619279f}, {0.4909648f, -0.9522095f, 0.4909648f, -1.9044189f, 0.9638591f}, {0.4914357f, -0.9531228f, 0.4914357f, -1.9062455f, 0.9657427f}, {0.4918932f, -0.9540102f, 0.4918932f, -1.9080203f, 0.967573f}, {0.4923362f, -0.9548693f, 0.4923362f, -1.9097385f, 0.9693448f}, {0.4927635f, -0.955698f, 0.4927635f, -1.911396f, 0.9710539f}, {0.4931743f, -0.9564947f, 0.4931743f, -1.9129894f, 0.9726971f}, {0.4935679f, -0.9572582f, 0.4935679f, -1.9145164f, 0.9742718f}, {0.493944f, -0.9579876f, 0.493944f, -1.9159753f, 0.9757762f}, {0.4943024f, -0.9586826f, 0.4943024f, -1.9173652f, 0.9772095f}, {0.4946429f, -0.959343f, 0.4946429f, -1.918686f, 0.9785715f}, {0.4949657f, -0.959969f, 0.4949657f, -1.9199381f, 0.9798627f}, {0.495271f, -0.9605613f, 0.495271f, -1.9211225f, 0.9810841f}, {0.4955593f, -0.9611204f, 0.4955593f, -1.9222407f, 0.9822372f}},
-  {{0.34354f, -0.6611544f, 0.34354f, -1.3223088f, 0.3741601f}, {0.3443752f, -0.6627617f, 0.3443752f, -1.3255234f, 0.3775007f}, {0.346828f, -0.6674822f, 0.346828f, -1.3349644f, 0.387312f}, {0.3507486f, -0.6750276f, 0.3507486f, -1.3500551f, 0.4029944f}, {0.3559119f, -0.6849645f, 0.3559119f, -1.3699291f, 0.4236477f}, {0.3620479f, -0.6967734f, 0.3620479f, -1.3935469f, 0.4481916f}, {0.3688728f, -0.7099082f, 0.3688728f, -1.4198165f, 0.4754913f}, {0.3761161f, -0.7238482f, 0.3761161f, -1.4476964f, 0.5044644f}, {0.383539f, -0.7381337f, 0.383539f, -1.4762675f, 0.5341559f}, {0.3909446f, -0.7523861f, 0.3909446f, -1.5047722f, 0.5637784f}, {0.3981809f, -0.7663126f, 0.3981809f, -1.5326251f, 0.5927234f}, {0.4051379f, -0.7797017f, 0.4051379f, -1.5594033f, 0.6205517f}, {0.4117427f, -0.7924127f, 0.4117427f, -1.5848254f, 0.6469707f}, {0.417952f, -0.8043628f, 0.417952f, -1.6087255f, 0.6718079f}, {0.423746f, -0.8155135f, 0.423746f, -1.631027f, 0.694984f}, {0.429122f, -0.8258598f, 0.429122f, -1.6517195f, 0.7164879f}, {0.4340892f, -0.8354194f, 0.4340892f, -1.6708387f, 0.7363568f}, {0.438665f, -0.8442256f, 0.438665f, -1.6884512f, 0.7546599f}, {0.4428714f, -0.852321f, 0.4428714f, -1.7046421f, 0.7714856f}, {0.4467333f, -0.8597533f, 0.4467333f, -1.7195066f, 0.786933f}, {0.4502762f, -0.8665719f, 0.4502762f, -1.7331438f, 0.801105f}, {0.4535259f, -0.8728261f, 0.4535259f, -1.7456521f, 0.8141038f}, {0.4565071f, -0.8785634f, 0.4565071f, -1.7571267f, 0.8260283f}, {0.4592431f, -0.8838289f, 0.4592431f, -1.7676578f, 0.8369724f}, {0.4617558f, -0.8886648f, 0.4617558f, -1.7773295f, 0.8470233f}, {0.4640655f, -0.8931099f, 0.4640655f, -1.7862197f, 0.8562622f}, {0.4661908f, -0.8971999f, 0.4661908f, -1.7943998f, 0.864763f}, {0.4681484f, -0.9009674f, 0.4681484f, -1.8019348f, 0.8725935f}, {0.4699538f, -0.9044419f, 0.4699538f, -1.8088838f, 0.879815f}, {0.4716208f, -0.9076502f, 0.4716208f, -1.8153005f, 0.8864832f}, {0.4731621f, -0.9106165f, 0.4731621f, -1.821233f, 0.8926484f}, {0.474589f, -0.9133626f, 0.474589f, -1.8267251f, 0.8983559f}, {0.4759117f, -0.9159081f, 0.4759117f, -1.8318162f, 0.9036466f}, {0.4771394f, -0.9182709f, 0.4771394f, -1.8365417f, 0.9085574f}, {0.4782804f, -0.9204668f, 0.4782804f, -1.8409337f, 0.9131216f}, {0.4793423f, -0.9225104f, 0.4793423f, -1.8450208f, 0.917369f}, {0.4803317f, -0.9244146f, 0.4803317f, -1.8488293f, 0.9213268f}, {0.4812548f, -0.9261912f, 0.4812548f, -1.8523825f, 0.9250193f}, {0.4821172f, -0.9278508f, 0.4821172f, -1.8557016f, 0.9284686f}, {0.4829237f, -0.929403f, 0.4829237f, -1.8588059f, 0.9316947f}, {0.4836789f, -0.9308564f, 0.4836789f, -1.8617127f, 0.9347154f}, {0.4843868f, -0.9322189f, 0.4843868f, -1.8644377f, 0.9375473f}, {0.4850513f, -0.9334976f, 0.4850513f, -1.8669952f, 0.9402051f}, {0.4856756f, -0.9346991f, 0.4856756f, -1.8693981f, 0.9427022f}, {0.4862627f, -0.9358291f, 0.4862627f, -1.8716583f, 0.945051f}, {0.4868287f, -0.9369184f, 0.4868287f, -1.8738367f, 0.9473149f}, {0.4873926f, -0.9380036f, 0.4873926f, -1.8760073f, 0.9495705f}, {0.4879529f, -0.9390819f, 0.4879529f, -1.8781639f, 0.9518117f}, {0.4885078f, -0.9401497f, 0.4885078f, -1.8802995f, 0.954031f}, {0.4890552f, -0.9412033f, 0.4890552f, -1.8824066f, 0.9562208f}, {0.4895933f, -0.942239f, 0.4895933f, -1.884478f, 0.9583734f}, {0.4901203f, -0.9432532f, 0.4901203f, -1.8865063f, 0.9604813f}, {0.4906344f, -0.9442425f, 0.4906344f, -1.888485f, 0.9625376f}, {0.491134f, -0.945204f, 0.491134f, -1.890408f, 0.9645359f}, {0.4916177f, -0.946135f, 0.4916177f, -1.8922699f, 0.9664709f}, {0.4920844f, -0.9470332f, 0.4920844f, -1.8940663f, 0.9683377f}, {0.4925332f, -0.9478968f, 0.4925332f, -1.8957936f, 0.9701327f}, {0.4929633f, -0.9487246f, 0.4929633f, -1.8974491f, 0.9718532f}, {0.4933743f, -0.9495155f, 0.4933743f, -1.899031f, 0.9734971f}, {0.4937659f, -0.9502692f, 0.4937659f, -1.9005384f, 0.9750636f}, {0.4941381f, -0.9509855f, 0.4941381f, -1.9019709f, 0.9765523f}, {0.4944909f, -0.9516646f, 0.4944909f, -1.9033292f, 0.9779638f}, {0.4948248f, -0.9523071f, 0.4948248f, -1.9046142f, 0.9792992f}, {0.49514f, -0.9529137f, 0.49514f, -1.9058274f, 0.98056f}},
-  {{0.3338434f, -0.6362882f, 0.3338434f, -1.2725765f, 0.3353737f}, {0.3347054f, -0.6379312f, 0.3347054f, -1.2758624f, 0.3388218f}, {0.3372386f, -0.6427593f, 0.3372386f, -1.2855186f, 0.3489545f}, {0.3412924f, -0.6504855f, 0.3412924f, -1.300971f, 0.3651694f}, {0.3466398f, -0.6606774f, 0.3466398f, -1.3213548f, 0.3865591f}, {0.3530075f, -0.672814f, 0.3530075f, -1.345628f, 0.4120301f}, {0.3601069f, -0.6863451f, 0.3601069f, -1.3726901f, 0.4404276f}, {0.3676607f, -0.7007422f, 0.3676607f, -1.4014843f, 0.4706428f}, {0.3754224f, -0.7155355f, 0.3754224f, -1.4310711f, 0.5016895f}, {0.3831869f, -0.7303344f, 0.3831869f, -1.4606687f, 0.5327477f}, {0.3907942f, -0.7448334f, 0.3907942f, -1.4896667f, 0.5631766f}, {0.3981268f, -0.758809f, 0.3981268f, -1.517618f, 0.5925072f}, {0.4051054f, -0.7721098f, 0.4051054f, -1.5442195f, 0.6204215f}, {0.4116815f, -0.7846435f, 0.4116815f, -1.569287f, 0.6467259f}, {0.4178312f, -0.7963646f, 0.4178312f, -1.5927293f, 0.671325f}, {0.423549f, -0.8072623f, 0.423549f, -1.6145247f, 0.6941959f}, {0.428842f, -0.8173506f, 0.428842f, -1.6347012f, 0.715368f}, {0.4337264f, -0.8266601f, 0.4337264f, -1.6533201f, 0.7349057f}, {0.4382239f, -0.8352319f, 0.4382239f, -1.6704639f, 0.7528955f}, {0.442359f, -0.8431133f, 0.442359f, -1.6862266f, 0.769436f}, {0.4461579f, -0.8503537f, 0.4461579f, -1.7007075f, 0.7846315f}, {0.4496466f, -0.8570031f, 0.4496466f, -1.7140062f, 0.7985865f}, {0.4528507f, -0.86311f, 0.4528507f, -1.72622f, 0.811403f}, {0.4557945f, -0.8687206f, 0.4557945f, -1.7374412f, 0.8231779f}, {0.4585006f, -0.8738784f, 0.4585006f, -1.7477568f, 0.8340025f}, {0.4609903f, -0.8786236f, 0.4609903f, -1.7572472f, 0.8439613f}, {0.463283f, -0.8829934f, 0.463283f, -1.7659867f, 0.8531321f}, {0.4653965f, -0.8870215f, 0.4653965f, -1.7740431f, 0.861586f}, {0.467347f, -0.8907391f, 0.467347f, -1.7814781f, 0.8693879f}, {0.4691492f, -0.8941739f, 0.4691492f, -1.7883479f, 0.8765967f}, {0.4708164f, -0.8973516f, 0.4708164f, -1.7947032f, 0.8832656f}, {0.4723607f, -0.9002949f, 0.4723607f, -1.8005899f, 0.8894428f}, {0.473793f, -0.9030248f, 0.473793f, -1.8060495f, 0.8951718f}, {0.475123f, -0.9055597f, 0.475123f, -1.8111195f, 0.900492f}, {0.4763597f, -0.9079168f, 0.4763597f, -1.8158336f, 0.9054388f}, {0.477511f, -0.9101112f, 0.477511f, -1.8202225f, 0.9100442f}, {0.4785843f, -0.9121568f, 0.4785843f, -1.8243135f, 0.9143371f}, {0.4795859f, -0.9140659f, 0.4795859f, -1.8281318f, 0.9183438f}, {0.4805219f, -0.9158498f, 0.4805219f, -1.8316997f, 0.9220877f}, {0.4813976f, -0.9175188f, 0.4813976f, -1.8350376f, 0.9255904f}, {0.4822178f, -0.9190821f, 0.4822178f, -1.8381641f, 0.9288712f}, {0.4829869f, -0.920548f, 0.4829869f, -1.8410959f, 0.9319477f}, {0.4837089f, -0.9219241f, 0.4837089f, -1.8438482f, 0.9348357f}, {0.4843875f, -0.9232174f, 0.4843875f, -1.8464347f, 0.9375499f}, {0.4850258f, -0.924434f, 0.4850258f, -1.8488681f, 0.9401034f}, {0.4856413f, -0.925607f, 0.4856413f, -1.851214f, 0.9425651f}, {0.4862546f, -0.926776f, 0.4862546f, -1.8535519f, 0.9450183f}, {0.4868641f, -0.9279377f, 0.4868641f, -1.8558753f, 0.9474564f}, {0.4874678f, -0.9290883f, 0.4874678f, -1.8581765f, 0.9498711f}, {0.4880636f, -0.9302238f, 0.4880636f, -1.8604476f, 0.9522542f}, {0.4886493f, -0.9313402f, 0.4886493f, -1.8626805f, 0.9545973f}, {0.4892231f, -0.9324337f, 0.4892231f, -1.8648674f, 0.9568922f}, {0.4897828f, -0.9335006f, 0.4897828f, -1.8670013f, 0.9591314f}, {0.490327f, -0.9345377f, 0.490327f, -1.8690754f, 0.9613078f}, {0.4908539f, -0.935542f, 0.4908539f, -1.8710841f, 0.9634156f}, {0.4913624f, -0.9365112f, 0.4913624f, -1.8730224f, 0.9654496f}, {0.4918514f, -0.9374432f, 0.4918514f, -1.8748865f, 0.9674056f}, {0.4923202f, -0.9383367f, 0.4923202f, -1.8766733f, 0.9692807f}, {0.4927682f, -0.9391905f, 0.4927682f, -1.8783811f, 0.9710727f}, {0.4931951f, -0.9400043f, 0.4931951f, -1.8800085f, 0.9727805f}, {0.4936009f, -0.9407777f, 0.4936009f, -1.8815555f, 0.9744037f}, {0.4939857f, -0.9415112f, 0.4939857f, -1.8830223f, 0.975943f}, {0.4943499f, -0.9422051f, 0.4943499f, -1.8844103f, 0.9773994f}, {0.4946937f, -0.9428605f, 0.4946937f, -1.8857209f, 0.9787747f}},
-  {{0.32415f, -0.6103196f, 0.32415f, -1.2206393f, 0.2966001f}, {0.325036f, -0.6119877f, 0.325036f, -1.2239754f, 0.3001439f}, {0.327641f, -0.6168926f, 0.327641f, -1.2337852f, 0.3105641f}, {0.3318146f, -0.6247507f, 0.3318146f, -1.2495014f, 0.3272584f}, {0.3373291f, -0.6351337f, 0.3373291f, -1.2702674f, 0.3493166f}, {0.3439094f, -0.6475232f, 0.3439094f, -1.2950464f, 0.3756377f}, {0.3512631f, -0.6613689f, 0.3512631f, -1.3227377f, 0.4050522f}, {0.3591075f, -0.6761387f, 0.3591075f, -1.3522774f, 0.4364302f}, {0.3671897f, -0.691356f, 0.3671897f, -1.3827119f, 0.4687586f}, {0.3752969f, -0.7066205f, 0.3752969f, -1.413241f, 0.5011876f}, {0.3832614f, -0.7216164f, 0.3832614f, -1.4432327f, 0.5330456f}, {0.3909587f, -0.7361091f, 0.3909587f, -1.4722182f, 0.5638349f}, {0.3983029f, -0.7499369f, 0.3983029f, -1.4998738f, 0.5932115f}, {0.4052401f, -0.7629986f, 0.4052401f, -1.5259971f, 0.6209605f}, {0.4117423f, -0.775241f, 0.4117423f, -1.5504819f, 0.646969f}, {0.4178003f, -0.7866473f, 0.4178003f, -1.5732946f, 0.6712014f}, {0.4234194f, -0.7972271f, 0.4234194f, -1.5944541f, 0.6936776f}, {0.4286141f, -0.8070078f, 0.4286141f, -1.6140156f, 0.7144564f}, {0.4334052f, -0.8160286f, 0.4334052f, -1.6320572f, 0.7336208f}, {0.4378171f, -0.8243355f, 0.4378171f, -1.648671f, 0.7512685f}, {0.441876f, -0.8319777f, 0.441876f, -1.6639554f, 0.767504f}, {0.4456084f, -0.8390051f, 0.4456084f, -1.6780102f, 0.7824335f}, {0.4490403f, -0.8454669f, 0.4490403f, -1.6909338f, 0.7961613f}, {0.4521969f, -0.8514101f, 0.4521969f, -1.7028202f, 0.8087874f}, {0.4551015f, -0.8568792f, 0.4551015f, -1.7137583f, 0.8204062f}, {0.4577764f, -0.8619154f, 0.4577764f, -1.7238309f, 0.8311055f}, {0.4602417f, -0.8665572f, 0.4602417f, -1.7331143f, 0.8409667f}, {0.4625161f, -0.8708394f, 0.4625161f, -1.7416789f, 0.8500642f}, {0.4646166f, -0.8747943f, 0.4646166f, -1.7495886f, 0.8584662f}, {0.4665587f, -0.878451f, 0.4665587f, -1.7569019f, 0.8662346f}, {0.4683564f, -0.8818359f, 0.4683564f, -1.7636718f, 0.8734257f}, {0.4700226f, -0.884973f, 0.4700226f, -1.7699461f, 0.8800905f}, {0.4715687f, -0.8878841f, 0.4715687f, -1.7757682f, 0.886275f}, {0.4730052f, -0.8905888f, 0.4730052f, -1.7811776f, 0.892021f}, {0.4743415f, -0.8931048f, 0.4743415f, -1.7862096f, 0.8973661f}, {0.4755861f, -0.8954482f, 0.4755861f, -1.7908963f, 0.9023445f}, {0.4767468f, -0.8976334f, 0.4767468f, -1.7952669f, 0.906987f}, {0.4778304f, -0.8996737f, 0.4778304f, -1.7993474f, 0.9113215f}, {0.4788433f, -0.9015809f, 0.4788433f, -1.8031618f, 0.9153733f}, {0.4797913f, -0.9033658f, 0.4797913f, -1.8067315f, 0.9191651f}, {0.4806795f, -0.905038f, 0.4806795f, -1.8100761f, 0.9227178f}, {0.4815126f, -0.9066066f, 0.4815126f, -1.8132132f, 0.9260502f}, {0.4822948f, -0.9080795f, 0.4822948f, -1.8161591f, 0.9291794f}, {0.4830302f, -0.9094641f, 0.4830302f, -1.8189283f, 0.9321209f}, {0.4837222f, -0.910767f, 0.4837222f, -1.8215341f, 0.9348889f}, {0.4843895f, -0.9120234f, 0.4843895f, -1.8240468f, 0.937558f}, {0.4850546f, -0.9132758f, 0.4850546f, -1.8265515f, 0.9402185f}, {0.4857158f, -0.9145206f, 0.4857158f, -1.8290412f, 0.9428632f}, {0.4863708f, -0.9157538f, 0.4863708f, -1.8315077f, 0.9454831f}, {0.4870173f, -0.9169712f, 0.4870173f, -1.8339423f, 0.9480693f}, {0.4876531f, -0.9181683f, 0.4876531f, -1.8363366f, 0.9506125f}, {0.488276f, -0.919341f, 0.488276f, -1.8386821f, 0.953104f}, {0.4888839f, -0.9204855f, 0.4888839f, -1.8409711f, 0.9555354f}, {0.4894748f, -0.9215982f, 0.4894748f, -1.8431965f, 0.9578993f}, {0.4900472f, -0.922676f, 0.4900472f, -1.845352f, 0.960189f}, {0.4905997f, -0.9237162f, 0.4905997f, -1.8474325f, 0.9623989f}, {0.4911311f, -0.9247168f, 0.4911311f, -1.8494336f, 0.9645246f}, {0.4916406f, -0.9256761f, 0.4916406f, -1.8513522f, 0.9665626f}, {0.4921276f, -0.926593f, 0.4921276f, -1.8531861f, 0.9685106f}, {0.4925918f, -0.927467f, 0.4925918f, -1.8549341f, 0.9703673f}, {0.4930331f, -0.9282979f, 0.4930331f, -1.8565958f, 0.9721325f}, {0.4934516f, -0.9290859f, 0.4934516f, -1.8581718f, 0.9738065f}, {0.4938477f, -0.9298316f, 0.4938477f, -1.8596631f, 0.9753907f}, {0.4942217f, -0.9305358f, 0.4942217f, -1.8610716f, 0.9768868f}},
-  {{0.3145472f, -0.5832027f, 0.3145472f, -1.1664054f, 0.2581886f}, {0.3154539f, -0.584884f, 0.3154539f, -1.1697679f, 0.2618157f}, {0.3181218f, -0.5898305f, 0.3181218f, -1.179661f, 0.2724873f}, {0.3224009f, -0.5977644f, 0.3224009f, -1.1955289f, 0.2896038f}, {0.3280642f, -0.6082647f, 0.3280642f, -1.2165295f, 0.3122569f}, {0.3348358f, -0.6208199f, 0.3348358f, -1.2416397f, 0.3393431f}, {0.342421f, -0.6348837f, 0.342421f, -1.2697674f, 0.3696841f}, {0.3505334f, -0.6499249f, 0.3505334f, -1.2998498f, 0.4021336f}, {0.3589141f, -0.6654636f, 0.3589141f, -1.3309273f, 0.4356565f}, {0.367344f, -0.6810935f, 0.367344f, -1.362187f, 0.4693761f}, {0.3756482f, -0.6964903f, 0.3756482f, -1.3929805f, 0.5025927f}, {0.3836951f, -0.7114102f, 0.3836951f, -1.4228203f, 0.5347806f}, {0.3913926f, -0.7256821f, 0.3913926f, -1.4513641f, 0.5655705f}, {0.3986813f, -0.7391961f, 0.3986813f, -1.4783922f, 0.5947254f}, {0.4055286f, -0.7518916f, 0.4055286f, -1.5037833f, 0.6221144f}, {0.4119219f, -0.7637456f, 0.4119219f, -1.5274911f, 0.6476878f}, {0.4178639f, -0.7747625f, 0.4178639f, -1.549525f, 0.6714555f}, {0.4233672f, -0.7849662f, 0.4233672f, -1.5699325f, 0.6934688f}, {0.4284517f, -0.7943933f, 0.4284517f, -1.5887867f, 0.7138066f}, {0.4331411f, -0.8030881f, 0.4331411f, -1.6061762f, 0.7325645f}, {0.4374616f, -0.8110987f, 0.4374616f, -1.6221975f, 0.7498465f}, {0.4414399f, -0.8184749f, 0.4414399f, -1.6369497f, 0.7657596f}, {0.4451025f, -0.8252656f, 0.4451025f, -1.6505313f, 0.7804099f}, {0.4484749f, -0.8315185f, 0.4484749f, -1.6630371f, 0.7938997f}, {0.4515816f, -0.8372786f, 0.4515816f, -1.6745571f, 0.8063262f}, {0.4544451f, -0.8425879f, 0.4544451f, -1.6851757f, 0.8177804f}, {0.4570867f, -0.8474856f, 0.4570867f, -1.6949712f, 0.8283467f}, {0.4595257f, -0.8520077f, 0.4595257f, -1.7040155f, 0.8381026f}, {0.4617799f, -0.8561873f, 0.4617799f, -1.7123746f, 0.8471195f}, {0.4638656f, -0.8600544f, 0.4638656f, -1.7201088f, 0.8554623f}, {0.4657975f, -0.8636364f, 0.4657975f, -1.7272728f, 0.8631901f}, {0.4675891f, -0.8669582f, 0.4675891f, -1.7339164f, 0.8703565f}, {0.4692525f, -0.8700424f, 0.4692525f, -1.7400848f, 0.8770102f}, {0.4707988f, -0.8729093f, 0.4707988f, -1.7458186f, 0.8831953f}, {0.4722379f, -0.8755776f, 0.4722379f, -1.7511551f, 0.8889517f}, {0.4735789f, -0.8780638f, 0.4735789f, -1.7561277f, 0.8943155f}, {0.4748299f, -0.8803833f, 0.4748299f, -1.7607666f, 0.8993195f}, {0.4759983f, -0.8825498f, 0.4759983f, -1.7650995f, 0.9039933f}, {0.477091f, -0.8845756f, 0.477091f, -1.7691512f, 0.9083638f}, {0.4781139f, -0.8864721f, 0.4781139f, -1.7729443f, 0.9124554f}, {0.4790725f, -0.8882496f, 0.4790725f, -1.7764993f, 0.9162901f}, {0.479972f, -0.8899174f, 0.479972f, -1.7798348f, 0.9198881f}, {0.4808169f, -0.8914839f, 0.4808169f, -1.7829678f, 0.9232677f}, {0.4816113f, -0.8929568f, 0.4816113f, -1.7859137f, 0.9264454f}, {0.4823591f, -0.8943432f, 0.4823591f, -1.7886865f, 0.9294363f}, {0.4830803f, -0.8956804f, 0.4830803f, -1.7913609f, 0.9323211f}, {0.4837993f, -0.8970136f, 0.4837993f, -1.7940272f, 0.9351974f}, {0.4845143f, -0.8983392f, 0.4845143f, -1.7966783f, 0.938057f}, {0.4852227f, -0.8996526f, 0.4852227f, -1.7993052f, 0.9408907f}, {0.4859221f, -0.9009494f, 0.4859221f, -1.8018989f, 0.9436884f}, {0.4866101f, -0.902225f, 0.4866101f, -1.80445f, 0.9464403f}, {0.4872842f, -0.9034749f, 0.4872842f, -1.8069498f, 0.9491367f}, {0.4879422f, -0.9046949f, 0.4879422f, -1.8093898f, 0.9517688f}, {0.4885821f, -0.9058813f, 0.4885821f, -1.8117626f, 0.9543282f}, {0.489202f, -0.9070306f, 0.489202f, -1.8140613f, 0.9568078f}, {0.4898004f, -0.9081402f, 0.4898004f, -1.8162804f, 0.9592015f}, {0.4903761f, -0.9092076f, 0.4903761f, -1.8184152f, 0.9615044f}, {0.4909282f, -0.9102312f, 0.4909282f, -1.8204624f, 0.9637127f}, {0.491456f, -0.9112098f, 0.491456f, -1.8224196f, 0.9658239f}, {0.4919591f, -0.9121427f, 0.4919591f, -1.8242854f, 0.9678364f}, {0.4924375f, -0.9130297f, 0.4924375f, -1.8260594f, 0.96975f}, {0.4928913f, -0.913871f, 0.4928913f, -1.827742f, 0.9715651f}, {0.4933207f, -0.9146673f, 0.4933207f, -1.8293346f, 0.973283f}, {0.4937264f, -0.9154194f, 0.4937264f, -1.8308389f, 0.9749056f}},
-  {{0.3051291f, -0.5548594f, 0.3051291f, -1.1097188f, 0.2205162f}, {0.3060535f, -0.5565404f, 0.3060535f, -1.1130809f, 0.2242139f}, {0.3087749f, -0.5614892f, 0.3087749f, -1.1229784f, 0.2350996f}, {0.3131448f, -0.5694355f, 0.3131448f, -1.138871f, 0.252579f}, {0.3189374f, -0.5799692f, 0.3189374f, -1.1599383f, 0.2757497f}, {0.3258776f, -0.5925895f, 0.3258776f, -1.185179f, 0.3035106f}, {0.3336699f, -0.6067593f, 0.3336699f, -1.2135187f, 0.3346797f}, {0.342025f, -0.6219525f, 0.342025f, -1.2439051f, 0.3681f}, {0.3506796f, -0.6376904f, 0.3506796f, -1.2753808f, 0.4027183f}, {0.3594088f, -0.6535639f, 0.3594088f, -1.3071278f, 0.437635f}, {0.3680312f, -0.6692433f, 0.3680312f, -1.3384866f, 0.4721248f}, {0.3764089f, -0.6844777f, 0.3764089f, -1.3689553f, 0.5056356f}, {0.3844434f, -0.6990879f, 0.3844434f, -1.3981757f, 0.5377734f}, {0.3920699f, -0.7129562f, 0.3920699f, -1.4259124f, 0.5682794f}, {0.399251f, -0.7260147f, 0.399251f, -1.4520294f, 0.597004f}, {0.4059707f, -0.7382341f, 0.4059707f, -1.4764681f, 0.6238828f}, {0.4122285f, -0.7496136f, 0.4122285f, -1.4992272f, 0.6489142f}, {0.4180354f, -0.760173f, 0.4180354f, -1.520346f, 0.6721416f}, {0.4234096f, -0.7699457f, 0.4234096f, -1.5398915f, 0.6936385f}, {0.4283743f, -0.7789737f, 0.4283743f, -1.5579475f, 0.7134972f}, {0.4329552f, -0.7873037f, 0.4329552f, -1.5746075f, 0.7318206f}, {0.4371789f, -0.7949844f, 0.4371789f, -1.5899689f, 0.7487157f}, {0.4410724f, -0.8020645f, 0.4410724f, -1.6041291f, 0.7642897f}, {0.4446617f, -0.8085914f, 0.4446617f, -1.6171828f, 0.7786467f}, {0.4479716f, -0.8146102f, 0.4479716f, -1.6292204f, 0.7918862f}, {0.4510255f, -0.8201635f, 0.4510255f, -1.6403271f, 0.8041018f}, {0.4538452f, -0.825291f, 0.4538452f, -1.650582f, 0.8153807f}, {0.4564508f, -0.8300293f, 0.4564508f, -1.6600585f, 0.8258034f}, {0.458861f, -0.834412f, 0.458861f, -1.668824f, 0.8354439f}, {0.4610925f, -0.8384699f, 0.4610925f, -1.6769399f, 0.8443702f}, {0.463161f, -0.8422313f, 0.463161f, -1.6844625f, 0.8526439f}, {0.4650803f, -0.8457215f, 0.4650803f, -1.691443f, 0.8603213f}, {0.4668634f, -0.8489639f, 0.4668634f, -1.6979278f, 0.8674535f}, {0.4685217f, -0.8519795f, 0.4685217f, -1.703959f, 0.874087f}, {0.4700659f, -0.8547875f, 0.4700659f, -1.709575f, 0.8802637f}, {0.4715055f, -0.8574052f, 0.4715055f, -1.7148105f, 0.8860219f}, {0.472849f, -0.8598484f, 0.472849f, -1.7196968f, 0.8913961f}, {0.4741044f, -0.8621313f, 0.4741044f, -1.7242625f, 0.8964176f}, {0.4752788f, -0.8642668f, 0.4752788f, -1.7285336f, 0.9011151f}, {0.4763786f, -0.8662667f, 0.4763786f, -1.7325334f, 0.9055143f}, {0.4774097f, -0.8681417f, 0.4774097f, -1.7362834f, 0.9096387f}, {0.4783774f, -0.8699015f, 0.4783774f, -1.739803f, 0.9135097f}, {0.4792867f, -0.8715549f, 0.4792867f, -1.7431098f, 0.9171467f}, {0.4801419f, -0.87311f, 0.4801419f, -1.74622f, 0.9205674f}, {0.480947f, -0.8745741f, 0.480947f, -1.7491482f, 0.9237879f}, {0.4817237f, -0.8759866f, 0.4817237f, -1.7519731f, 0.9268949f}, {0.4824983f, -0.8773951f, 0.4824983f, -1.7547903f, 0.9299934f}, {0.4832687f, -0.878796f, 0.4832687f, -1.7575919f, 0.9330748f}, {0.4840322f, -0.8801844f, 0.4840322f, -1.7603687f, 0.9361288f}, {0.4847862f, -0.8815555f, 0.4847862f, -1.763111f, 0.9391448f}, {0.485528f, -0.8829045f, 0.485528f, -1.7658089f, 0.9421121f}, {0.4862551f, -0.8842266f, 0.4862551f, -1.7684531f, 0.9450204f}, {0.4869649f, -0.8855174f, 0.4869649f, -1.7710348f, 0.9478597f}, {0.4876553f, -0.8867728f, 0.4876553f, -1.7735457f, 0.9506214f}, {0.4883244f, -0.8879894f, 0.4883244f, -1.7759788f, 0.9532974f}, {0.4889703f, -0.8891641f, 0.4889703f, -1.7783281f, 0.9558813f}, {0.4895919f, -0.8902943f, 0.4895919f, -1.7805887f, 0.9583676f}, {0.4901881f, -0.8913784f, 0.4901881f, -1.7827569f, 0.9607522f}, {0.4907581f, -0.892415f, 0.4907581f, -1.78483f, 0.9630324f}, {0.4913016f, -0.8934034f, 0.4913016f, -1.7868067f, 0.9652064f}, {0.4918185f, -0.8943433f, 0.4918185f, -1.7886865f, 0.9672739f}, {0.4923088f, -0.8952349f, 0.4923088f, -1.7904698f, 0.9692352f}, {0.4927729f, -0.8960789f, 0.4927729f, -1.7921578f, 0.9710918f}, {0.4932114f, -0.8968763f, 0.4932114f, -1.7937525f, 0.9728457f}},
-  {{0.2959968f, -0.5251685f, 0.2959968f, -1.0503371f, 0.1839874f}, {0.2969358f, -0.5268344f, 0.2969358f, -1.0536688f, 0.1877431f}, {0.2997014f, -0.5317413f, 0.2997014f, -1.0634826f, 0.1988056f}, {0.3041471f, -0.539629f, 0.3041471f, -1.079258f, 0.2165883f}, {0.3100495f, -0.5501013f, 0.3100495f, -1.1002025f, 0.240198f}, {0.3171351f, -0.5626727f, 0.3171351f, -1.1253455f, 0.2685402f}, {0.3251086f, -0.5768197f, 0.3251086f, -1.1536394f, 0.3004345f}, {0.3336794f, -0.5920263f, 0.3336794f, -1.1840525f, 0.3347175f}, {0.3425807f, -0.6078194f, 0.3425807f, -1.2156387f, 0.3703229f}, {0.351583f, -0.6237915f, 0.351583f, -1.247583f, 0.4063319f}, {0.3604991f, -0.6396108f, 0.3604991f, -1.2792216f, 0.4419963f}, {0.369185f, -0.6550216f, 0.369185f, -1.3100433f, 0.4767399f}, {0.3775363f, -0.6698388f, 0.3775363f, -1.3396776f, 0.5101451f}, {0.3854828f, -0.6839379f, 0.3854828f, -1.3678757f, 0.5419313f}, {0.3929826f, -0.6972443f, 0.3929826f, -1.3944886f, 0.5719305f}, {0.4000157f, -0.7097226f, 0.4000157f, -1.4194452f, 0.6000628f}, {0.4065787f, -0.7213669f, 0.4065787f, -1.4427338f, 0.6263147f}, {0.4126801f, -0.7321923f, 0.4126801f, -1.4643846f, 0.6507205f}, {0.4183369f, -0.7422288f, 0.4183369f, -1.4844575f, 0.6733476f}, {0.423571f, -0.7515154f, 0.423571f, -1.5030308f, 0.6942842f}, {0.4284077f, -0.7600968f, 0.4284077f, -1.5201937f, 0.713631f}, {0.4328736f, -0.7680203f, 0.4328736f, -1.5360406f, 0.7314944f}, {0.4369955f, -0.7753335f, 0.4369955f, -1.550667f, 0.7479819f}, {0.4407997f, -0.7820831f, 0.4407997f, -1.5641663f, 0.7631989f}, {0.4443117f, -0.7883141f, 0.4443117f, -1.5766283f, 0.7772466f}, {0.4475552f, -0.794069f, 0.4475552f, -1.588138f, 0.7902209f}, {0.4505528f, -0.7993875f, 0.4505528f, -1.5987749f, 0.8022113f}, {0.4533253f, -0.8043064f, 0.4533253f, -1.6086128f, 0.813301f}, {0.4558917f, -0.8088598f, 0.4558917f, -1.6177197f, 0.8235667f}, {0.4582696f, -0.8130789f, 0.4582696f, -1.6261579f, 0.8330786f}, {0.4604753f, -0.8169923f, 0.4604753f, -1.6339845f, 0.8419011f}, {0.4625232f, -0.8206258f, 0.4625232f, -1.6412516f, 0.850093f}, {0.4644269f, -0.8240033f, 0.4644269f, -1.6480067f, 0.8577075f}, {0.4661984f, -0.8271463f, 0.4661984f, -1.6542927f, 0.8647934f}, {0.4678487f, -0.8300744f, 0.4678487f, -1.6601488f, 0.8713948f}, {0.4693879f, -0.8328054f, 0.4693879f, -1.6656107f, 0.8775517f}, {0.4708251f, -0.8353553f, 0.4708251f, -1.6707107f, 0.8833005f}, {0.4721686f, -0.837739f, 0.4721686f, -1.6754779f, 0.8886744f}, {0.4734258f, -0.8399696f, 0.4734258f, -1.6799392f, 0.8937033f}, {0.4746037f, -0.8420593f, 0.4746037f, -1.6841187f, 0.8984146f}, {0.4757083f, -0.8440192f, 0.4757083f, -1.6880384f, 0.9028332f}, {0.4767454f, -0.8458592f, 0.4767454f, -1.6917185f, 0.9069815f}, {0.4777201f, -0.8475886f, 0.4777201f, -1.6951771f, 0.9108802f}, {0.478637f, -0.8492155f, 0.478637f, -1.698431f, 0.9145481f}, {0.4795006f, -0.8507476f, 0.4795006f, -1.7014952f, 0.9180023f}, {0.4803339f, -0.8522261f, 0.4803339f, -1.7044522f, 0.9213355f}, {0.4811651f, -0.8537009f, 0.4811651f, -1.7074017f, 0.9246603f}, {0.4819919f, -0.8551679f, 0.4819919f, -1.7103357f, 0.9279677f}, {0.4828116f, -0.8566222f, 0.4828116f, -1.7132444f, 0.9312465f}, {0.4836213f, -0.8580588f, 0.4836213f, -1.7161176f, 0.9344853f}, {0.4844181f, -0.8594725f, 0.4844181f, -1.718945f, 0.9376725f}, {0.4851992f, -0.8608584f, 0.4851992f, -1.7217168f, 0.940797f}, {0.485962f, -0.8622118f, 0.485962f, -1.7244236f, 0.9438481f}, {0.4867041f, -0.8635284f, 0.4867041f, -1.7270568f, 0.9468164f}, {0.4874233f, -0.8648045f, 0.4874233f, -1.729609f, 0.9496934f}, {0.4881179f, -0.8660369f, 0.4881179f, -1.7320738f, 0.9524718f}, {0.4887865f, -0.867223f, 0.4887865f, -1.734446f, 0.9551458f}, {0.4894277f, -0.8683608f, 0.4894277f, -1.7367216f, 0.957711f}, {0.4900411f, -0.869449f, 0.4900411f, -1.7388979f, 0.9601643f}, {0.4906259f, -0.8704867f, 0.4906259f, -1.7409733f, 0.9625038f}, {0.4911822f, -0.8714737f, 0.4911822f, -1.7429473f, 0.964729f}, {0.4917101f, -0.8724101f, 0.4917101f, -1.7448203f, 0.9668402f}, {0.4922098f, -0.8732967f, 0.4922098f, -1.7465935f, 0.9688391f}, {0.4926819f, -0.8741344f, 0.4926819f, -1.7482688f, 0.9707276f}},
-  {{0.287259f, -0.4939525f, 0.287259f, -0.9879051f, 0.1490361f}, {0.2882094f, -0.4955867f, 0.2882094f, -0.9911735f, 0.1528375f}, {0.2910102f, -0.5004028f, 0.2910102f, -1.0008057f, 0.1640408f}, {0.2955172f, -0.5081528f, 0.2955172f, -1.0163055f, 0.1820687f}, {0.3015099f, -0.5184575f, 0.3015099f, -1.0369151f, 0.2060398f}, {0.3087175f, -0.5308512f, 0.3087175f, -1.0617025f, 0.2348701f}, {0.3168461f, -0.5448287f, 0.3168461f, -1.0896574f, 0.2673846f}, {0.3256046f, -0.5598892f, 0.3256046f, -1.1197784f, 0.3024184f}, {0.3347241f, -0.5755704f, 0.3347241f, -1.1511409f, 0.3388962f}, {0.343971f, -0.5914709f, 0.343971f, -1.1829417f, 0.3758839f}, {0.3531534f, -0.6072603f, 0.3531534f, -1.2145207f, 0.4126135f}, {0.3621217f, -0.6226817f, 0.3621217f, -1.2453635f, 0.4484869f}, {0.3707661f, -0.637546f, 0.3707661f, -1.2750921f, 0.4830644f}, {0.3790112f, -0.6517238f, 0.3790112f, -1.3034475f, 0.5160447f}, {0.3868103f, -0.6651347f, 0.3868103f, -1.3302695f, 0.5472414f}, {0.3941398f, -0.677738f, 0.3941398f, -1.355476f, 0.5765591f}, {0.400993f, -0.6895223f, 0.400993f, -1.3790446f, 0.6039719f}, {0.4073761f, -0.7004984f, 0.4073761f, -1.4009968f, 0.6295046f}, {0.4133043f, -0.7106921f, 0.4133043f, -1.4213842f, 0.6532173f}, {0.4187984f, -0.7201394f, 0.4187984f, -1.4402789f, 0.6751937f}, {0.4238829f, -0.7288823f, 0.4238829f, -1.4577647f, 0.6955315f}, {0.4285839f, -0.736966f, 0.4285839f, -1.473932f, 0.7143358f}, {0.4329284f, -0.7444364f, 0.4329284f, -1.4888729f, 0.7317136f}, {0.4369428f, -0.7513393f, 0.4369428f, -1.5026787f, 0.7477711f}, {0.4406527f, -0.7577187f, 0.4406527f, -1.5154374f, 0.7626109f}, {0.4440826f, -0.7636165f, 0.4440826f, -1.527233f, 0.7763304f}, {0.4472553f, -0.7690721f, 0.4472553f, -1.5381441f, 0.7890212f}, {0.4501922f, -0.7741221f, 0.4501922f, -1.5482443f, 0.8007687f}, {0.452913f, -0.7788006f, 0.452913f, -1.5576012f, 0.8116518f}, {0.4554358f, -0.7831388f, 0.4554358f, -1.5662776f, 0.8217433f}, {0.4577774f, -0.7871653f, 0.4577774f, -1.5743306f, 0.8311098f}, {0.459953f, -0.7909063f, 0.459953f, -1.5818126f, 0.8398121f}, {0.4619765f, -0.7943857f, 0.4619765f, -1.5887714f, 0.847906f}, {0.4638605f, -0.7976253f, 0.4638605f, -1.5952507f, 0.855442f}, {0.4656166f, -0.8006449f, 0.4656166f, -1.6012899f, 0.8624662f}, {0.4672552f, -0.8034626f, 0.4672552f, -1.6069252f, 0.8690206f}, {0.4687858f, -0.8060946f, 0.4687858f, -1.6121893f, 0.8751434f}, {0.4702173f, -0.8085561f, 0.4702173f, -1.6171121f, 0.8808691f}, {0.4715574f, -0.8108604f, 0.4715574f, -1.6217207f, 0.8862294f}, {0.4728132f, -0.8130199f, 0.4728132f, -1.6260398f, 0.891253f}, {0.4739915f, -0.8150459f, 0.4739915f, -1.6300919f, 0.8959659f}, {0.475098f, -0.8169487f, 0.475098f, -1.6338973f, 0.9003921f}, {0.4761383f, -0.8187375f, 0.4761383f, -1.6374749f, 0.9045532f}, {0.4771172f, -0.8204208f, 0.4771172f, -1.6408416f, 0.908469f}, {0.4780394f, -0.8220065f, 0.4780394f, -1.644013f, 0.9121576f}, {0.4789295f, -0.823537f, 0.4789295f, -1.647074f, 0.915718f}, {0.4798176f, -0.8250641f, 0.4798176f, -1.6501282f, 0.9192703f}, {0.4807012f, -0.8265835f, 0.4807012f, -1.6531671f, 0.9228048f}, {0.4815774f, -0.8280902f, 0.4815774f, -1.6561804f, 0.9263096f}, {0.4824431f, -0.8295788f, 0.4824431f, -1.6591577f, 0.9297725f}, {0.4832953f, -0.8310441f, 0.4832953f, -1.6620883f, 0.933181f}, {0.4841308f, -0.8324809f, 0.4841308f, -1.6649618f, 0.9365233f}, {0.484947f, -0.8338843f, 0.484947f, -1.6677686f, 0.9397879f}, {0.4857411f, -0.8352499f, 0.4857411f, -1.6704998f, 0.9429645f}, {0.486511f, -0.8365737f, 0.486511f, -1.6731475f, 0.9460441f}, {0.4872547f, -0.8378525f, 0.4872547f, -1.675705f, 0.9490188f}, {0.4879706f, -0.8390835f, 0.4879706f, -1.678167f, 0.9518823f}, {0.4886574f, -0.8402646f, 0.4886574f, -1.6805292f, 0.9546298f}, {0.4893145f, -0.8413944f, 0.4893145f, -1.6827887f, 0.9572579f}, {0.4899411f, -0.842472f, 0.4899411f, -1.6849439f, 0.9597646f}, {0.4905373f, -0.8434971f, 0.4905373f, -1.6869941f, 0.9621492f}, {0.491103f, -0.8444699f, 0.491103f, -1.6889397f, 0.9644121f}, {0.4916387f, -0.845391f, 0.4916387f, -1.6907819f, 0.9665548f}, {0.4921449f, -0.8462614f, 0.4921449f, -1.6925228f, 0.9685795f}},
-  {{0.2790326f, -0.4609618f, 0.2790326f, -0.9219236f, 0.1161305f}, {0.2799916f, -0.462546f, 0.2799916f, -0.925092f, 0.1199663f}, {0.2828192f, -0.4672172f, 0.2828192f, -0.9344344f, 0.1312768f}, {0.2873737f, -0.4747413f, 0.2873737f, -0.9494827f, 0.149495f}, {0.2934383f, -0.48476f, 0.2934383f, -0.9695201f, 0.1737534f}, {0.3007453f, -0.4968312f, 0.3007453f, -0.9936624f, 0.2029813f}, {0.3090031f, -0.5104731f, 0.3090031f, -1.0209461f, 0.2360125f}, {0.3179211f, -0.5252056f, 0.3179211f, -1.0504112f, 0.2716845f}, {0.3272292f, -0.5405825f, 0.3272292f, -1.0811649f, 0.3089167f}, {0.3366908f, -0.5562131f, 0.3366908f, -1.1124263f, 0.3467633f}, {0.34611f, -0.5717736f, 0.34611f, -1.1435471f, 0.3844399f}, {0.3553323f, -0.5870088f, 0.3553323f, -1.1740176f, 0.4213291f}, {0.3642427f, -0.6017289f, 0.3642427f, -1.2034577f, 0.4569709f}, {0.3727612f, -0.6158013f, 0.3727612f, -1.2316027f, 0.4910447f}, {0.3808366f, -0.6291419f, 0.3808366f, -1.2582838f, 0.5233463f}, {0.3884413f, -0.6417048f, 0.3884413f, -1.2834097f, 0.5537651f}, {0.3955656f, -0.6534743f, 0.3955656f, -1.3069486f, 0.5822625f}, {0.4022134f, -0.6644564f, 0.4022134f, -1.3289127f, 0.6088535f}, {0.4083977f, -0.6746728f, 0.4083977f, -1.3493457f, 0.6335907f}, {0.4141381f, -0.6841561f, 0.4141381f, -1.3683121f, 0.6565525f}, {0.4194583f, -0.6929449f, 0.4194583f, -1.3858899f, 0.6778331f}, {0.4243838f, -0.701082f, 0.4243838f, -1.4021639f, 0.6975354f}, {0.4289415f, -0.7086111f, 0.4289415f, -1.4172223f, 0.7157658f}, {0.4331576f, -0.7155762f, 0.4331576f, -1.4311525f, 0.7326305f}, {0.4370582f, -0.72202f, 0.4370582f, -1.4440399f, 0.7482327f}, {0.4406678f, -0.7279831f, 0.4406678f, -1.4559661f, 0.7626712f}, {0.4440098f, -0.7335041f, 0.4440098f, -1.4670082f, 0.7760393f}, {0.4471061f, -0.738619f, 0.4471061f, -1.4772381f, 0.7884242f}, {0.4499767f, -0.7433613f, 0.4499767f, -1.4867227f, 0.7999068f}, {0.4526404f, -0.7477618f, 0.4526404f, -1.4955237f, 0.8105617f}, {0.4551145f, -0.7518489f, 0.4551145f, -1.5036978f, 0.8204578f}, {0.4574145f, -0.7556486f, 0.4574145f, -1.5112972f, 0.829658f}, {0.4595549f, -0.7591846f, 0.4595549f, -1.5183692f, 0.8382198f}, {0.4615489f, -0.7624787f, 0.4615489f, -1.5249574f, 0.8461958f}, {0.4634085f, -0.7655506f, 0.4634085f, -1.5311012f, 0.8536339f}, {0.4651444f, -0.7684184f, 0.4651444f, -1.5368369f, 0.8605777f}, {0.4667668f, -0.7710985f, 0.4667668f, -1.542197f, 0.867067f}, {0.4682845f, -0.7736059f, 0.4682845f, -1.5472117f, 0.8731381f}, {0.469706f, -0.7759541f, 0.469706f, -1.5519082f, 0.8788238f}, {0.4710386f, -0.7781556f, 0.4710386f, -1.5563111f, 0.8841543f}, {0.4722892f, -0.7802216f, 0.4722892f, -1.5604432f, 0.8891569f}, {0.4734641f, -0.7821626f, 0.4734641f, -1.5643251f, 0.8938565f}, {0.474569f, -0.7839878f, 0.474569f, -1.5679756f, 0.898276f}, {0.475609f, -0.785706f, 0.475609f, -1.5714119f, 0.9024361f}, {0.476589f, -0.7873248f, 0.476589f, -1.5746497f, 0.906356f}, {0.4775351f, -0.7888878f, 0.4775351f, -1.5777756f, 0.9101404f}, {0.4784793f, -0.7904477f, 0.4784793f, -1.5808953f, 0.9139173f}, {0.479419f, -0.792f, 0.479419f, -1.5840001f, 0.9176761f}, {0.4803511f, -0.7935398f, 0.4803511f, -1.5870796f, 0.9214042f}, {0.4812722f, -0.7950614f, 0.4812722f, -1.5901229f, 0.9250886f}, {0.482179f, -0.7965596f, 0.482179f, -1.5931192f, 0.9287161f}, {0.4830685f, -0.798029f, 0.4830685f, -1.5960579f, 0.9322739f}, {0.4839375f, -0.7994645f, 0.4839375f, -1.598929f, 0.9357498f}, {0.4847832f, -0.8008617f, 0.4847832f, -1.6017234f, 0.9391328f}, {0.4856033f, -0.8022164f, 0.4856033f, -1.6044329f, 0.9424131f}, {0.4863956f, -0.8035253f, 0.4863956f, -1.6070507f, 0.9455824f}, {0.4871584f, -0.8047856f, 0.4871584f, -1.6095712f, 0.9486338f}, {0.4878905f, -0.805995f, 0.4878905f, -1.61199f, 0.9515622f}, {0.488591f, -0.8071521f, 0.488591f, -1.6143042f, 0.9543638f}, {0.4892591f, -0.8082559f, 0.4892591f, -1.6165118f, 0.9570365f}, {0.4898949f, -0.8093062f, 0.4898949f, -1.6186123f, 0.9595795f}, {0.4904983f, -0.810303f, 0.4904983f, -1.6206059f, 0.961993f}, {0.4910697f, -0.8112469f, 0.4910697f, -1.6224939f, 0.9642787f}, {0.4916097f, -0.8121391f, 0.4916097f, -1.6242782f, 0.9664389f}},
-  {{0.2714456f, -0.4258556f, 0.2714456f, -0.8517112f, 0.0857826f}, {0.2724107f, -0.4273696f, 0.2724107f, -0.8547392f, 0.0896427f}, {0.2752575f, -0.4318359f, 0.2752575f, -0.8636717f, 0.1010301f}, {0.2798472f, -0.4390364f, 0.2798472f, -0.8780727f, 0.1193888f}, {0.2859666f, -0.4486367f, 0.2859666f, -0.8972734f, 0.1438664f}, {0.2933518f, -0.4602229f, 0.2933518f, -0.9204457f, 0.173407f}, {0.301714f, -0.4733418f, 0.301714f, -0.9466837f, 0.2068558f}, {0.3107638f, -0.4875397f, 0.3107638f, -0.9750794f, 0.2430554f}, {0.3202309f, -0.502392f, 0.3202309f, -1.004784f, 0.2809236f}, {0.3298766f, -0.5175246f, 0.3298766f, -1.0350491f, 0.3195062f}, {0.3395014f, -0.5326244f, 0.3395014f, -1.0652488f, 0.3580055f}, {0.3489469f, -0.5474429f, 0.3489469f, -1.0948858f, 0.3957875f}, {0.3580936f, -0.5617926f, 0.3580936f, -1.1235852f, 0.4323742f}, {0.3668568f, -0.5755408f, 0.3668568f, -1.1510815f, 0.4674272f}, {0.3751814f, -0.5886008f, 0.3751814f, -1.1772016f, 0.5007258f}, {0.3830362f, -0.6009237f, 0.3830362f, -1.2018474f, 0.5321448f}, {0.3904084f, -0.6124895f, 0.3904084f, -1.2249789f, 0.5616334f}, {0.3972992f, -0.6233f, 0.3972992f, -1.2466001f, 0.5891966f}, {0.4037199f, -0.6333731f, 0.4037199f, -1.2667462f, 0.6148794f}, {0.4096886f, -0.6427372f, 0.4096886f, -1.2854744f, 0.6387545f}, {0.415228f, -0.6514276f, 0.415228f, -1.3028553f, 0.6609121f}, {0.4203632f, -0.6594839f, 0.4203632f, -1.3189678f, 0.6814528f}, {0.4251204f, -0.6669472f, 0.4251204f, -1.3338943f, 0.7004815f}, {0.429526f, -0.6738589f, 0.429526f, -1.3477179f, 0.7181041f}, {0.433606f, -0.6802598f, 0.433606f, -1.3605196f, 0.734424f}, {0.4373853f, -0.6861888f, 0.4373853f, -1.3723777f, 0.749541f}, {0.4408874f, -0.6916831f, 0.4408874f, -1.3833662f, 0.7635495f}, {0.4441345f, -0.6967774f, 0.4441345f, -1.3935548f, 0.7765381f}, {0.4471474f, -0.7015041f, 0.4471474f, -1.4030082f, 0.7885895f}, {0.449945f, -0.7058931f, 0.449945f, -1.4117863f, 0.7997801f}, {0.4525451f, -0.7099722f, 0.4525451f, -1.4199445f, 0.8101804f}, {0.4549638f, -0.7137668f, 0.4549638f, -1.4275335f, 0.8198551f}, {0.4572159f, -0.7173f, 0.4572159f, -1.4345999f, 0.8288635f}, {0.459315f, -0.7205931f, 0.459315f, -1.4411863f, 0.8372599f}, {0.4612735f, -0.7236657f, 0.4612735f, -1.4473314f, 0.8450939f}, {0.4631027f, -0.7265354f, 0.4631027f, -1.4530708f, 0.8524106f}, {0.4648128f, -0.7292184f, 0.4648128f, -1.4584368f, 0.8592513f}, {0.4664134f, -0.7317295f, 0.4664134f, -1.4634589f, 0.8656536f}, {0.467913f, -0.734082f, 0.467913f, -1.468164f, 0.8716518f}, {0.4693193f, -0.7362883f, 0.4693193f, -1.4725767f, 0.8772772f}, {0.4706396f, -0.7383596f, 0.4706396f, -1.4767192f, 0.8825582f}, {0.4718802f, -0.7403061f, 0.4718802f, -1.4806121f, 0.887521f}, {0.4730473f, -0.742137f, 0.4730473f, -1.484274f, 0.8921893f}, {0.4741462f, -0.743861f, 0.4741462f, -1.487722f, 0.8965848f}, {0.4751819f, -0.7454858f, 0.4751819f, -1.4909715f, 0.9007274f}, {0.476182f, -0.7470548f, 0.476182f, -1.4941096f, 0.9047279f}, {0.4771804f, -0.7486211f, 0.4771804f, -1.4972422f, 0.9087214f}, {0.4781742f, -0.7501803f, 0.4781742f, -1.5003605f, 0.9126967f}, {0.4791601f, -0.7517271f, 0.4791601f, -1.5034542f, 0.9166406f}, {0.4801348f, -0.7532561f, 0.4801348f, -1.5065122f, 0.9205391f}, {0.4810946f, -0.7547619f, 0.4810946f, -1.5095238f, 0.9243783f}, {0.4820361f, -0.756239f, 0.4820361f, -1.512478f, 0.9281444f}, {0.4829562f, -0.7576825f, 0.4829562f, -1.515365f, 0.9318248f}, {0.4838519f, -0.7590877f, 0.4838519f, -1.5181754f, 0.9354076f}, {0.4847206f, -0.7604505f, 0.4847206f, -1.5209011f, 0.9388823f}, {0.48556f, -0.7617675f, 0.48556f, -1.523535f, 0.9422401f}, {0.4863684f, -0.7630357f, 0.4863684f, -1.5260715f, 0.9454737f}, {0.4871444f, -0.7642531f, 0.4871444f, -1.5285062f, 0.9485775f}, {0.4878869f, -0.7654179f, 0.4878869f, -1.5308359f, 0.9515475f}, {0.4885953f, -0.7665294f, 0.4885953f, -1.5330588f, 0.9543813f}, {0.4892695f, -0.767587f, 0.4892695f, -1.5351741f, 0.9570779f}, {0.4899094f, -0.7685911f, 0.4899094f, -1.5371821f, 0.9596378f}, {0.4905156f, -0.769542f, 0.4905156f, -1.539084f, 0.9620624f}, {0.4910885f, -0.7704409f, 0.4910885f, -1.5408818f, 0.9643542f}},
-  {{0.264641f, -0.3881791f, 0.264641f, -0.7763581f, 0.0585641f}, {0.26561f, -0.3896004f, 0.26561f, -0.7792007f, 0.0624399f}, {0.2684696f, -0.3937949f, 0.2684696f, -0.7875897f, 0.0738783f}, {0.2730836f, -0.4005628f, 0.2730836f, -0.8011256f, 0.0923345f}, {0.2792427f, -0.409597f, 0.2792427f, -0.819194f, 0.1169708f}, {0.2866868f, -0.4205161f, 0.2866868f, -0.8410323f, 0.1467472f}, {0.2951304f, -0.4329012f, 0.2951304f, -0.8658025f, 0.1805214f}, {0.3042858f, -0.4463306f, 0.3042858f, -0.8926612f, 0.2171433f}, {0.3138828f, -0.4604077f, 0.3138828f, -0.9208153f, 0.2555314f}, {0.3236816f, -0.4747806f, 0.3236816f, -0.9495611f, 0.2947263f}, {0.33348f, -0.489153f, 0.33348f, -0.978306f, 0.3339199f}, {0.3431161f, -0.5032873f, 0.3431161f, -1.0065747f, 0.3724643f}, {0.3524665f, -0.5170028f, 0.3524665f, -1.0340055f, 0.4098662f}, {0.3614428f, -0.5301693f, 0.3614428f, -1.0603386f, 0.4457713f}, {0.369986f, -0.5427006f, 0.369986f, -1.0854011f, 0.4799441f}, {0.3780615f, -0.5545457f, 0.3780615f, -1.1090914f, 0.5122458f}, {0.3856536f, -0.5656819f, 0.3856536f, -1.1313638f, 0.5426142f}, {0.3927612f, -0.5761075f, 0.3927612f, -1.152215f, 0.5710448f}, {0.3993938f, -0.5858363f, 0.3993938f, -1.1716725f, 0.5975751f}, {0.405568f, -0.5948927f, 0.405568f, -1.1897854f, 0.622272f}, {0.4113054f, -0.6033084f, 0.4113054f, -1.2066169f, 0.6452217f}, {0.4166305f, -0.6111193f, 0.4166305f, -1.2222386f, 0.666522f}, {0.4215691f, -0.6183633f, 0.4215691f, -1.2367265f, 0.6862762f}, {0.4261473f, -0.6250788f, 0.4261473f, -1.2501575f, 0.7045894f}, {0.4303912f, -0.6313038f, 0.4303912f, -1.2626075f, 0.721565f}, {0.4343258f, -0.637075f, 0.4343258f, -1.27415f, 0.7373031f}, {0.4379747f, -0.6424273f, 0.4379747f, -1.2848547f, 0.751899f}, {0.4413606f, -0.6473938f, 0.4413606f, -1.2947876f, 0.7654425f}, {0.4445044f, -0.6520051f, 0.4445044f, -1.3040102f, 0.7780175f}, {0.4474255f, -0.6562898f, 0.4474255f, -1.3125796f, 0.7897018f}, {0.4501419f, -0.6602743f, 0.4501419f, -1.3205486f, 0.8005676f}, {0.4526702f, -0.6639829f, 0.4526702f, -1.3279658f, 0.810681f}, {0.4550257f, -0.6674379f, 0.4550257f, -1.3348759f, 0.8201028f}, {0.4572222f, -0.6706598f, 0.4572222f, -1.3413196f, 0.8288889f}, {0.4592725f, -0.6736672f, 0.4592725f, -1.3473344f, 0.8370901f}, {0.4611883f, -0.6764773f, 0.4611883f, -1.3529545f, 0.844753f}, {0.4629801f, -0.6791055f, 0.4629801f, -1.358211f, 0.8519203f}, {0.4646577f, -0.6815663f, 0.4646577f, -1.3631325f, 0.8586307f}, {0.4662299f, -0.6838725f, 0.4662299f, -1.3677449f, 0.8649198f}, {0.467705f, -0.686036f, 0.467705f, -1.3720721f, 0.8708198f}, {0.4690901f, -0.6880678f, 0.4690901f, -1.3761356f, 0.8763604f}, {0.4703922f, -0.6899777f, 0.4703922f, -1.3799553f, 0.8815686f}, {0.4716173f, -0.6917747f, 0.4716173f, -1.3835493f, 0.8864691f}, {0.4727711f, -0.6934671f, 0.4727711f, -1.3869342f, 0.8910844f}, {0.4738588f, -0.6950626f, 0.4738588f, -1.3901252f, 0.8954352f}, {0.4749094f, -0.6966037f, 0.4749094f, -1.3932073f, 0.8996378f}, {0.4759585f, -0.6981424f, 0.4759585f, -1.3962848f, 0.9038338f}, {0.4770029f, -0.6996744f, 0.4770029f, -1.3993489f, 0.9080117f}, {0.4780394f, -0.7011947f, 0.4780394f, -1.4023894f, 0.9121575f}, {0.4790641f, -0.7026978f, 0.4790641f, -1.4053957f, 0.9162565f}, {0.4800735f, -0.7041784f, 0.4800735f, -1.4083568f, 0.920294f}, {0.4810639f, -0.7056311f, 0.4810639f, -1.4112622f, 0.9242556f}, {0.4820319f, -0.707051f, 0.4820319f, -1.4141021f, 0.9281277f}, {0.4829745f, -0.7084336f, 0.4829745f, -1.4168672f, 0.9318979f}, {0.4838888f, -0.7097747f, 0.4838888f, -1.4195494f, 0.9355552f}, {0.4847725f, -0.7110709f, 0.4847725f, -1.4221419f, 0.93909f}, {0.4856237f, -0.7123195f, 0.4856237f, -1.4246389f, 0.9424947f}, {0.4864408f, -0.7135181f, 0.4864408f, -1.4270362f, 0.9457634f}, {0.4872229f, -0.7146652f, 0.4872229f, -1.4293305f, 0.9488916f}, {0.4879692f, -0.7157599f, 0.4879692f, -1.4315199f, 0.9518769f}, {0.4886795f, -0.7168019f, 0.4886795f, -1.4336037f, 0.9547182f}, {0.4893539f, -0.717791f, 0.4893539f, -1.4355821f, 0.9574157f}, {0.4899928f, -0.7187281f, 0.4899928f, -1.4374562f, 0.9599711f}, {0.4905967f, -0.719614f, 0.4905967f, -1.4392279f, 0.9623868f}},
-  {{0.2587828f, -0.3473339f, 0.2587828f, -0.6946677f, 0.0351312f}, {0.259754f, -0.3486374f, 0.259754f, -0.6972747f, 0.0390159f}, {0.2626212f, -0.3524857f, 0.2626212f, -0.7049713f, 0.0504847f}, {0.2672507f, -0.3586994f, 0.2672507f, -0.7173987f, 0.0690029f}, {0.2734368f, -0.3670022f, 0.2734368f, -0.7340043f, 0.0937471f}, {0.2809231f, -0.3770501f, 0.2809231f, -0.7541003f, 0.1236922f}, {0.2894272f, -0.3884642f, 0.2894272f, -0.7769284f, 0.1577087f}, {0.2986636f, -0.4008612f, 0.2986636f, -0.8017225f, 0.1946546f}, {0.3083627f, -0.4138792f, 0.3083627f, -0.8277584f, 0.2334509f}, {0.3182838f, -0.4271951f, 0.3182838f, -0.8543903f, 0.2731354f}, {0.328223f, -0.4405353f, 0.328223f, -0.8810706f, 0.312892f}, {0.3380155f, -0.4536787f, 0.3380155f, -0.9073574f, 0.3520622f}, {0.3475349f, -0.4664555f, 0.3475349f, -0.9329109f, 0.3901398f}, {0.3566893f, -0.4787422f, 0.3566893f, -0.9574845f, 0.4267571f}, {0.3654164f, -0.4904557f, 0.3654164f, -0.9809114f, 0.4616657f}, {0.3736788f, -0.5015453f, 0.3736788f, -1.0030906f, 0.4947151f}, {0.3814582f, -0.5119867f, 0.3814582f, -1.0239734f, 0.5258328f}, {0.3887514f, -0.5217755f, 0.3887514f, -1.043551f, 0.5550056f}, {0.395566f, -0.530922f, 0.395566f, -1.0618439f, 0.5822641f}, {0.4019175f, -0.5394468f, 0.4019175f, -1.0788935f, 0.6076699f}, {0.4078263f, -0.5473775f, 0.4078263f, -1.094755f, 0.6313052f}, {0.4133162f, -0.554746f, 0.4133162f, -1.1094919f, 0.6532649f}, {0.4184127f, -0.5615863f, 0.4184127f, -1.1231727f, 0.6736506f}, {0.4231416f, -0.5679334f, 0.4231416f, -1.1358669f, 0.6925664f}, {0.4275289f, -0.5738219f, 0.4275289f, -1.1476438f, 0.7101154f}, {0.4315995f, -0.5792854f, 0.4315995f, -1.1585708f, 0.7263978f}, {0.4353774f, -0.5843561f, 0.4353774f, -1.1687121f, 0.7415095f}, {0.4388852f, -0.5890643f, 0.4388852f, -1.1781286f, 0.755541f}, {0.4421443f, -0.5934385f, 0.4421443f, -1.1868771f, 0.7685772f}, {0.4451743f, -0.5975054f, 0.4451743f, -1.1950107f, 0.7806972f}, {0.4479935f, -0.6012893f, 0.4479935f, -1.2025786f, 0.7919742f}, {0.4506189f, -0.604813f, 0.4506189f, -1.2096259f, 0.8024755f}, {0.4530659f, -0.6080972f, 0.4530659f, -1.2161945f, 0.8122634f}, {0.4553487f, -0.6111612f, 0.4553487f, -1.2223225f, 0.8213947f}, {0.4574804f, -0.6140224f, 0.4574804f, -1.2280448f, 0.8299217f}, {0.459473f, -0.6166969f, 0.459473f, -1.2333937f, 0.8378921f}, {0.4613374f, -0.6191992f, 0.4613374f, -1.2383983f, 0.8453496f}, {0.4630835f, -0.6215428f, 0.4630835f, -1.2430855f, 0.852334f}, {0.4647205f, -0.6237399f, 0.4647205f, -1.2474798f, 0.8588819f}, {0.4662567f, -0.6258017f, 0.4662567f, -1.2516034f, 0.8650266f}, {0.4676996f, -0.6277385f, 0.4676996f, -1.2554769f, 0.8707985f}, {0.4690564f, -0.6295595f, 0.4690564f, -1.2591189f, 0.8762256f}, {0.4703333f, -0.6312733f, 0.4703333f, -1.2625466f, 0.8813331f}, {0.4715362f, -0.6328878f, 0.4715362f, -1.2657756f, 0.8861446f}, {0.4726703f, -0.6344101f, 0.4726703f, -1.2688201f, 0.8906814f}, {0.4737661f, -0.6358808f, 0.4737661f, -1.2717615f, 0.8950644f}, {0.4748604f, -0.6373495f, 0.4748604f, -1.274699f, 0.8994416f}, {0.4759502f, -0.6388122f, 0.4759502f, -1.2776244f, 0.9038007f}, {0.4770318f, -0.6402639f, 0.4770318f, -1.2805278f, 0.9081271f}, {0.4781014f, -0.6416995f, 0.4781014f, -1.283399f, 0.9124056f}, {0.4791552f, -0.6431139f, 0.4791552f, -1.2862277f, 0.9166206f}, {0.4801893f, -0.6445019f, 0.4801893f, -1.2890038f, 0.9207573f}, {0.4812003f, -0.6458588f, 0.4812003f, -1.2917177f, 0.9248012f}, {0.4821849f, -0.6471803f, 0.4821849f, -1.2943606f, 0.9287395f}, {0.4831401f, -0.6484624f, 0.4831401f, -1.2969248f, 0.9325604f}, {0.4840635f, -0.6497018f, 0.4840635f, -1.2994036f, 0.9362541f}, {0.4849531f, -0.6508958f, 0.4849531f, -1.3017916f, 0.9398125f}, {0.4858073f, -0.6520422f, 0.4858073f, -1.3040844f, 0.9432291f}, {0.4866249f, -0.6531396f, 0.4866249f, -1.3062792f, 0.9464995f}, {0.4874052f, -0.654187f, 0.4874052f, -1.3083739f, 0.9496209f}, {0.488148f, -0.655184f, 0.488148f, -1.3103679f, 0.9525921f}, {0.4888534f, -0.6561306f, 0.4888534f, -1.3122613f, 0.9554134f}, {0.4895216f, -0.6570275f, 0.4895216f, -1.314055f, 0.9580864f}, {0.4901534f, -0.6578755f, 0.4901534f, -1.315751f, 0.9606135f}},
-  {{0.2540656f, -0.3025417f, 0.2540656f, -0.6050835f, 0.0162626f}, {0.2550378f, -0.3036994f, 0.2550378f, -0.6073989f, 0.0201514f}, {0.2579089f, -0.3071182f, 0.2579089f, -0.6142365f, 0.0316355f}, {0.2625472f, -0.3126416f, 0.2625472f, -0.6252832f, 0.0501889f}, {0.2687501f, -0.320028f, 0.2687501f, -0.640056f, 0.0750004f}, {0.2762645f, -0.3289762f, 0.2762645f, -0.6579524f, 0.1050582f}, {0.284811f, -0.3391533f, 0.284811f, -0.6783066f, 0.1392439f}, {0.2941059f, -0.3502217f, 0.2941059f, -0.7004434f, 0.1764235f}, {0.3038804f, -0.3618612f, 0.3038804f, -0.7237223f, 0.2155214f}, {0.3138935f, -0.3737848f, 0.3138935f, -0.7475696f, 0.2555739f}, {0.3239399f, -0.3857481f, 0.3239399f, -0.7714963f, 0.2957597f}, {0.333853f, -0.3975527f, 0.333853f, -0.7951054f, 0.3354122f}, {0.3435038f, -0.4090448f, 0.3435038f, -0.8180896f, 0.3740152f}, {0.3527977f, -0.420112f, 0.3527977f, -0.8402239f, 0.4111906f}, {0.3616699f, -0.430677f, 0.3616699f, -0.861354f, 0.4466795f}, {0.3700805f, -0.4406924f, 0.3700805f, -0.8813847f, 0.4803219f}, {0.3780092f, -0.4501338f, 0.3780092f, -0.9002677f, 0.5120366f}, {0.3854508f, -0.4589954f, 0.3854508f, -0.9179908f, 0.5418033f}, {0.3924117f, -0.4672844f, 0.3924117f, -0.9345688f, 0.5696467f}, {0.3989059f, -0.4750178f, 0.3989059f, -0.9500355f, 0.5956238f}, {0.4049533f, -0.4822189f, 0.4049533f, -0.9644379f, 0.6198131f}, {0.4105768f, -0.4889154f, 0.4105768f, -0.9778309f, 0.6423072f}, {0.4158015f, -0.495137f, 0.4158015f, -0.990274f, 0.663206f}, {0.4206531f, -0.5009143f, 0.4206531f, -1.0018286f, 0.6826123f}, {0.4251573f, -0.5062779f, 0.4251573f, -1.0125557f, 0.700629f}, {0.4293391f, -0.5112576f, 0.4293391f, -1.0225151f, 0.7173562f}, {0.4332225f, -0.515882f, 0.4332225f, -1.0317639f, 0.73289f}, {0.4368304f, -0.5201782f, 0.4368304f, -1.0403565f, 0.7473215f}, {0.4401841f, -0.5241718f, 0.4401841f, -1.0483437f, 0.7607363f}, {0.4433036f, -0.5278865f, 0.4433036f, -1.0557731f, 0.7732143f}, {0.4462074f, -0.5313444f, 0.4462074f, -1.0626888f, 0.7848295f}, {0.4489126f, -0.5345658f, 0.4489126f, -1.0691316f, 0.7956504f}, {0.451435f, -0.5375695f, 0.451435f, -1.0751389f, 0.8057401f}, {0.4537891f, -0.5403727f, 0.4537891f, -1.0807454f, 0.8151563f}, {0.4559881f, -0.5429913f, 0.4559881f, -1.0859825f, 0.8239524f}, {0.4580442f, -0.5454397f, 0.4580442f, -1.0908794f, 0.8321768f}, {0.4599686f, -0.5477312f, 0.4599686f, -1.0954625f, 0.8398743f}, {0.4617714f, -0.549878f, 0.4617714f, -1.0997561f, 0.8470856f}, {0.463462f, -0.5518912f, 0.463462f, -1.1037823f, 0.8538478f}, {0.4650488f, -0.5537808f, 0.4650488f, -1.1075616f, 0.8601952f}, {0.4665397f, -0.5555562f, 0.4665397f, -1.1111123f, 0.8661589f}, {0.4679419f, -0.5572258f, 0.4679419f, -1.1144517f, 0.8717675f}, {0.4692617f, -0.5587975f, 0.4692617f, -1.1175951f, 0.877047f}, {0.4705053f, -0.5602784f, 0.4705053f, -1.1205568f, 0.8820213f}, {0.4716781f, -0.561675f, 0.4716781f, -1.12335f, 0.8867125f}, {0.4728114f, -0.5630245f, 0.4728114f, -1.1260489f, 0.8912455f}, {0.4739433f, -0.5643724f, 0.4739433f, -1.1287447f, 0.8957732f}, {0.4750707f, -0.5657149f, 0.4750707f, -1.1314298f, 0.900283f}, {0.4761899f, -0.5670476f, 0.4761899f, -1.1340953f, 0.9047597f}, {0.4772969f, -0.5683658f, 0.4772969f, -1.1367316f, 0.9091875f}, {0.4783876f, -0.5696646f, 0.4783876f, -1.1393293f, 0.9135504f}, {0.4794582f, -0.5709395f, 0.4794582f, -1.141879f, 0.9178329f}, {0.480505f, -0.572186f, 0.480505f, -1.1443721f, 0.92202f}, {0.4815246f, -0.5734002f, 0.4815246f, -1.1468003f, 0.9260983f}, {0.4825139f, -0.5745783f, 0.4825139f, -1.1491566f, 0.9300558f}, {0.4834705f, -0.5757173f, 0.4834705f, -1.1514347f, 0.9338819f}, {0.4843921f, -0.5768148f, 0.4843921f, -1.1536296f, 0.9375684f}, {0.4852771f, -0.5778687f, 0.4852771f, -1.1557374f, 0.9411086f}, {0.4861244f, -0.5788776f, 0.4861244f, -1.1577553f, 0.9444977f}, {0.4869332f, -0.5798407f, 0.4869332f, -1.1596814f, 0.9477327f}, {0.4877031f, -0.5807576f, 0.4877031f, -1.1615152f, 0.9508125f}, {0.4884343f, -0.5816283f, 0.4884343f, -1.1632565f, 0.9537372f}, {0.4891271f, -0.5824532f, 0.4891271f, -1.1649065f, 0.9565084f}, {0.4897822f, -0.5832333f, 0.4897822f, -1.1664666f, 0.9591287f}},
-  {{0.2507292f, -0.2527976f, 0.2507292f, -0.5055951f, 0.0029167f}, {0.2517017f, -0.2537781f, 0.2517017f, -0.5075562f, 0.0068067f}, {0.2545742f, -0.2566743f, 0.2545742f, -0.5133485f, 0.0182967f}, {0.2592168f, -0.2613552f, 0.2592168f, -0.5227103f, 0.0368671f}, {0.2654289f, -0.2676186f, 0.2654289f, -0.5352371f, 0.0617157f}, {0.2729601f, -0.2752119f, 0.2729601f, -0.5504238f, 0.0918404f}, {0.281533f, -0.2838554f, 0.281533f, -0.5677109f, 0.1261318f}, {0.2908655f, -0.293265f, 0.2908655f, -0.5865299f, 0.1634619f}, {0.3006895f, -0.3031701f, 0.3006895f, -0.6063401f, 0.2027582f}, {0.3107641f, -0.3133277f, 0.3107641f, -0.6266555f, 0.2430564f}, {0.3208831f, -0.3235302f, 0.3208831f, -0.6470604f, 0.2835324f}, {0.3308785f, -0.333608f, 0.3308785f, -0.6672161f, 0.3235139f}, {0.3406195f, -0.3434294f, 0.3406195f, -0.6868589f, 0.3624781f}, {0.3500099f, -0.3528973f, 0.3500099f, -0.7057945f, 0.4000395f}, {0.358983f, -0.3619444f, 0.358983f, -0.7238888f, 0.4359319f}, {0.3674971f, -0.3705287f, 0.3674971f, -0.7410574f, 0.4699883f}, {0.3755304f, -0.3786283f, 0.3755304f, -0.7572566f, 0.5021215f}, {0.3830765f, -0.3862367f, 0.3830765f, -0.7724733f, 0.532306f}, {0.3901405f, -0.3933589f, 0.3901405f, -0.7867179f, 0.560562f}, {0.3967358f, -0.4000086f, 0.3967358f, -0.8000173f, 0.5869432f}, {0.4028813f, -0.4062049f, 0.4028813f, -0.8124098f, 0.6115254f}, {0.4085998f, -0.4119705f, 0.4085998f, -0.823941f, 0.6343991f}, {0.4139158f, -0.4173303f, 0.4139158f, -0.8346607f, 0.6556631f}, {0.4188548f, -0.4223101f, 0.4188548f, -0.8446203f, 0.6754192f}, {0.4234425f, -0.4269356f, 0.4234425f, -0.8538713f, 0.6937699f}, {0.4277038f, -0.4312321f, 0.4277038f, -0.8624642f, 0.7108152f}, {0.4316628f, -0.4352238f, 0.4316628f, -0.8704476f, 0.7266512f}, {0.4353424f, -0.4389337f, 0.4353424f, -0.8778674f, 0.7413695f}, {0.438764f, -0.4423836f, 0.438764f, -0.8847671f, 0.755056f}, {0.4419478f, -0.4455936f, 0.4419478f, -0.8911872f, 0.7677912f}, {0.4449124f, -0.4485827f, 0.4449124f, -0.8971654f, 0.7796497f}, {0.4476751f, -0.4513682f, 0.4476751f, -0.9027364f, 0.7907005f}, {0.4502519f, -0.4539662f, 0.4502519f, -0.9079324f, 0.8010074f}, {0.4526573f, -0.4563914f, 0.4526573f, -0.9127829f, 0.810629f}, {0.4549048f, -0.4586575f, 0.4549048f, -0.917315f, 0.8196191f}, {0.4570067f, -0.4607768f, 0.4570067f, -0.9215536f, 0.8280269f}, {0.4589744f, -0.4627607f, 0.4589744f, -0.9255214f, 0.8358977f}, {0.4608182f, -0.4646197f, 0.4608182f, -0.9292394f, 0.8432728f}, {0.4625475f, -0.4663633f, 0.4625475f, -0.9327265f, 0.85019f}, {0.464171f, -0.4680001f, 0.464171f, -0.9360003f, 0.856684f}, {0.4656966f, -0.4695383f, 0.4656966f, -0.9390767f, 0.8627864f}, {0.4671316f, -0.4709851f, 0.4671316f, -0.9419703f, 0.8685263f}, {0.4684826f, -0.4723473f, 0.4684826f, -0.9446946f, 0.8739303f}, {0.4697557f, -0.4736309f, 0.4697557f, -0.9472617f, 0.8790226f}, {0.4709564f, -0.4748415f, 0.4709564f, -0.9496831f, 0.8838257f}, {0.4721168f, -0.4760115f, 0.4721168f, -0.9520231f, 0.8884674f}, {0.473276f, -0.4771803f, 0.473276f, -0.9543606f, 0.8931042f}, {0.4744308f, -0.4783446f, 0.4744308f, -0.9566892f, 0.8977232f}, {0.4755772f, -0.4795005f, 0.4755772f, -0.959001f, 0.9023089f}, {0.4767113f, -0.4806439f, 0.4767113f, -0.9612878f, 0.9068451f}, {0.4778288f, -0.4817707f, 0.4778288f, -0.9635413f, 0.9113153f}, {0.4789259f, -0.4828768f, 0.4789259f, -0.9657535f, 0.9157036f}, {0.4799987f, -0.4839584f, 0.4799987f, -0.9679168f, 0.9199947f}, {0.4810437f, -0.485012f, 0.4810437f, -0.9700241f, 0.9241748f}, {0.4820578f, -0.4860346f, 0.4820578f, -0.9720691f, 0.9282314f}, {0.4830385f, -0.4870233f, 0.4830385f, -0.9740465f, 0.9321539f}, {0.4839834f, -0.487976f, 0.4839834f, -0.9759519f, 0.9359335f}, {0.4848909f, -0.4888909f, 0.4848909f, -0.9777819f, 0.9395635f}, {0.4857597f, -0.489767f, 0.4857597f, -0.9795339f, 0.9430389f}, {0.4865892f, -0.4906032f, 0.4865892f, -0.9812065f, 0.9463566f}, {0.4873788f, -0.4913994f, 0.4873788f, -0.9827989f, 0.9495154f}, {0.4881288f, -0.4921556f, 0.4881288f, -0.9843112f, 0.9525153f}, {0.4888395f, -0.4928722f, 0.4888395f, -0.9857443f, 0.955358f}, {0.4895115f, -0.4935497f, 0.4895115f, -0.9870995f, 0.9580462f}},
-  {{0.2490796f, -0.1968084f, 0.2490796f, -0.3936169f, -0.0036816f}, {0.2500521f, -0.1975769f, 0.2500521f, -0.3951537f, 0.0002084f}, {0.252925f, -0.1998468f, 0.252925f, -0.3996937f, 0.0116998f}, {0.257569f, -0.2035163f, 0.257569f, -0.4070326f, 0.0302761f}, {0.263785f, -0.2084278f, 0.263785f, -0.4168556f, 0.0551399f}, {0.2713235f, -0.2143843f, 0.2713235f, -0.4287685f, 0.0852938f}, {0.2799083f, -0.2211675f, 0.2799083f, -0.442335f, 0.1196331f}, {0.2892582f, -0.2285553f, 0.2892582f, -0.4571106f, 0.157033f}, {0.2991057f, -0.2363362f, 0.2991057f, -0.4726724f, 0.1964226f}, {0.3092095f, -0.2443197f, 0.3092095f, -0.4886393f, 0.236838f}, {0.3193633f, -0.2523426f, 0.3193633f, -0.5046852f, 0.2774532f}, {0.3293984f, -0.2602718f, 0.3293984f, -0.5205435f, 0.3175936f}, {0.3391833f, -0.2680032f, 0.3391833f, -0.5360064f, 0.356733f}, {0.3486206f, -0.2754601f, 0.3486206f, -0.5509201f, 0.3944825f}, {0.357643f, -0.2825891f, 0.357643f, -0.5651781f, 0.4305721f}, {0.3662079f, -0.2893565f, 0.3662079f, -0.578713f, 0.4648315f}, {0.3742926f, -0.2957446f, 0.3742926f, -0.5914892f, 0.4971704f}, {0.3818902f, -0.3017478f, 0.3818902f, -0.6034955f, 0.5275606f}, {0.3890051f, -0.3073696f, 0.3890051f, -0.6147391f, 0.5560203f}, {0.3956503f, -0.3126202f, 0.3956503f, -0.6252404f, 0.5826012f}, {0.4018445f, -0.3175145f, 0.4018445f, -0.635029f, 0.6073779f}, {0.40761f, -0.3220701f, 0.40761f, -0.6441401f, 0.6304398f}, {0.4129712f, -0.3263063f, 0.4129712f, -0.6526125f, 0.651885f}, {0.4179537f, -0.3302431f, 0.4179537f, -0.6604863f, 0.671815f}, {0.4225829f, -0.3339009f, 0.4225829f, -0.6678017f, 0.6903318f}, {0.4268838f, -0.3372992f, 0.4268838f, -0.6745984f, 0.7075354f}, {0.4308805f, -0.3404571f, 0.4308805f, -0.6809142f, 0.723522f}, {0.4345958f, -0.3433927f, 0.4345958f, -0.6867855f, 0.7383832f}, {0.4380513f, -0.3461231f, 0.4380513f, -0.6922462f, 0.7522053f}, {0.4412672f, -0.3486641f, 0.4412672f, -0.6973282f, 0.7650688f}, {0.4442622f, -0.3510306f, 0.4442622f, -0.7020611f, 0.7770488f}, {0.4470536f, -0.3532362f, 0.4470536f, -0.7064724f, 0.7882145f}, {0.4496575f, -0.3552937f, 0.4496575f, -0.7105873f, 0.7986301f}, {0.4520886f, -0.3572146f, 0.4520886f, -0.7144291f, 0.8083545f}, {0.4543604f, -0.3590096f, 0.4543604f, -0.7180192f, 0.8174416f}, {0.4564853f, -0.3606886f, 0.4564853f, -0.7213771f, 0.8259412f}, {0.4584747f, -0.3622605f, 0.4584747f, -0.724521f, 0.8338988f}, {0.460339f, -0.3637335f, 0.460339f, -0.7274671f, 0.8413559f}, {0.4620877f, -0.3651153f, 0.4620877f, -0.7302305f, 0.8483508f}, {0.4637296f, -0.3664126f, 0.4637296f, -0.7328251f, 0.8549182f}, {0.4652726f, -0.3676318f, 0.4652726f, -0.7352635f, 0.8610902f}, {0.466724f, -0.3687786f, 0.466724f, -0.7375572f, 0.866896f}, {0.4680906f, -0.3698584f, 0.4680906f, -0.7397168f, 0.8723624f}, {0.4693785f, -0.370876f, 0.4693785f, -0.741752f, 0.8775139f}, {0.4705933f, -0.3718359f, 0.4705933f, -0.7436718f, 0.8823731f}, {0.4717673f, -0.3727636f, 0.4717673f, -0.7455271f, 0.8870694f}, {0.4729402f, -0.3736903f, 0.4729402f, -0.7473806f, 0.891761f}, {0.4741087f, -0.3746136f, 0.4741087f, -0.7492272f, 0.8964349f}, {0.4752688f, -0.3755302f, 0.4752688f, -0.7510605f, 0.9010754f}, {0.4764165f, -0.3764371f, 0.4764165f, -0.7528741f, 0.905666f}, {0.4775475f, -0.3773307f, 0.4775475f, -0.7546615f, 0.9101901f}, {0.4786579f, -0.3782081f, 0.4786579f, -0.7564162f, 0.9146316f}, {0.4797437f, -0.3790661f, 0.4797437f, -0.7581321f, 0.918975f}, {0.4808015f, -0.3799019f, 0.4808015f, -0.7598037f, 0.9232062f}, {0.4818282f, -0.380713f, 0.4818282f, -0.7614261f, 0.9273126f}, {0.4828209f, -0.3814974f, 0.4828209f, -0.7629949f, 0.9312835f}, {0.4837775f, -0.3822533f, 0.4837775f, -0.7645066f, 0.93511f}, {0.4846963f, -0.3829793f, 0.4846963f, -0.7659586f, 0.9387852f}, {0.485576f, -0.3836744f, 0.485576f, -0.7673487f, 0.942304f}, {0.4864158f, -0.384338f, 0.4864158f, -0.7686759f, 0.9456634f}, {0.4872155f, -0.3849698f, 0.4872155f, -0.7699396f, 0.9488619f}, {0.4879749f, -0.3855699f, 0.4879749f, -0.7711397f, 0.9518997f}, {0.4886946f, -0.3861385f, 0.4886946f, -0.772277f, 0.9547784f}, {0.4893752f, -0.3866763f, 0.4893752f, -0.7733525f, 0.9575007f}},
-  {{0.2495228f, -0.1329152f, 0.2495228f, -0.2658304f, -0.0019089f}, {0.2504953f, -0.1334332f, 0.2504953f, -0.2668665f, 0.0019812f}, {0.2533681f, -0.1349635f, 0.2533681f, -0.269927f, 0.0134723f}, {0.2580118f, -0.1374371f, 0.2580118f, -0.2748742f, 0.0320472f}, {0.2642268f, -0.1407477f, 0.2642268f, -0.2814953f, 0.0569071f}, {0.2717634f, -0.1447622f, 0.2717634f, -0.2895245f, 0.0870535f}, {0.280345f, -0.1493335f, 0.280345f, -0.298667f, 0.1213801f}, {0.2896904f, -0.1543116f, 0.2896904f, -0.3086231f, 0.1587616f}, {0.2995316f, -0.1595538f, 0.2995316f, -0.3191075f, 0.1981265f}, {0.3096277f, -0.1649317f, 0.3096277f, -0.3298634f, 0.2385106f}, {0.3197722f, -0.1703355f, 0.3197722f, -0.3406709f, 0.2790887f}, {0.3297967f, -0.1756753f, 0.3297967f, -0.3513506f, 0.3191867f}, {0.3395698f, -0.1808812f, 0.3395698f, -0.3617624f, 0.3582793f}, {0.3489946f, -0.1859016f, 0.3489946f, -0.3718032f, 0.3959784f}, {0.3580038f, -0.1907006f, 0.3580038f, -0.3814012f, 0.4320151f}, {0.366555f, -0.1952556f, 0.366555f, -0.3905113f, 0.4662201f}, {0.374626f, -0.1995548f, 0.374626f, -0.3991097f, 0.4985039f}, {0.3822097f, -0.2035945f, 0.3822097f, -0.4071891f, 0.5288388f}, {0.389311f, -0.2073772f, 0.389311f, -0.4147544f, 0.5572438f}, {0.3959428f, -0.2109098f, 0.3959428f, -0.4218196f, 0.583771f}, {0.4021239f, -0.2142024f, 0.4021239f, -0.4284047f, 0.6084955f}, {0.4078767f, -0.2172668f, 0.4078767f, -0.4345335f, 0.6315068f}, {0.4132258f, -0.2201161f, 0.4132258f, -0.4402322f, 0.6529033f}, {0.4181966f, -0.222764f, 0.4181966f, -0.4455279f, 0.6727865f}, {0.4228146f, -0.2252239f, 0.4228146f, -0.4504477f, 0.6912586f}, {0.4271049f, -0.2275092f, 0.4271049f, -0.4550184f, 0.7084196f}, {0.4310914f, -0.2296327f, 0.4310914f, -0.4592654f, 0.7243657f}, {0.4347971f, -0.2316067f, 0.4347971f, -0.4632133f, 0.7391884f}, {0.4382435f, -0.2334425f, 0.4382435f, -0.4668849f, 0.752974f}, {0.4414507f, -0.2351509f, 0.4414507f, -0.4703018f, 0.7658029f}, {0.4444375f, -0.2367419f, 0.4444375f, -0.4734838f, 0.7777502f}, {0.4472212f, -0.2382247f, 0.4472212f, -0.4764494f, 0.788885f}, {0.4498178f, -0.2396079f, 0.4498178f, -0.4792157f, 0.7992713f}, {0.452242f, -0.2408992f, 0.452242f, -0.4817983f, 0.808968f}, {0.4545072f, -0.2421058f, 0.4545072f, -0.4842116f, 0.818029f}, {0.456626f, -0.2432344f, 0.456626f, -0.4864688f, 0.8265038f}, {0.4586095f, -0.244291f, 0.4586095f, -0.488582f, 0.834438f}, {0.4604683f, -0.2452811f, 0.4604683f, -0.4905622f, 0.841873f}, {0.4622117f, -0.2462098f, 0.4622117f, -0.4924196f, 0.8488469f}, {0.4638486f, -0.2470818f, 0.4638486f, -0.4941635f, 0.8553946f}, {0.465387f, -0.2479012f, 0.465387f, -0.4958024f, 0.8615478f}, {0.466834f, -0.248672f, 0.466834f, -0.4973439f, 0.8673359f}, {0.4681964f, -0.2493977f, 0.4681964f, -0.4987954f, 0.8727854f}, {0.4694802f, -0.2500816f, 0.4694802f, -0.5001632f, 0.877921f}, {0.4706913f, -0.2507267f, 0.4706913f, -0.5014533f, 0.8827651f}, {0.4718616f, -0.2513501f, 0.4718616f, -0.5027002f, 0.8874466f}, {0.4730309f, -0.2519729f, 0.4730309f, -0.5039458f, 0.8921234f}, {0.4741956f, -0.2525934f, 0.4741956f, -0.5051867f, 0.8967825f}, {0.4753521f, -0.2532094f, 0.4753521f, -0.5064187f, 0.9014082f}, {0.476496f, -0.2538187f, 0.476496f, -0.5076375f, 0.9059842f}, {0.4776234f, -0.2544193f, 0.4776234f, -0.5088386f, 0.9104938f}, {0.4787302f, -0.2550088f, 0.4787302f, -0.5100177f, 0.9149209f}, {0.4798125f, -0.2555854f, 0.4798125f, -0.5111707f, 0.9192502f}, {0.4808669f, -0.256147f, 0.4808669f, -0.512294f, 0.9234676f}, {0.4818901f, -0.2566921f, 0.4818901f, -0.5133841f, 0.9275606f}, {0.4828796f, -0.2572191f, 0.4828796f, -0.5144383f, 0.9315184f}, {0.4838331f, -0.257727f, 0.4838331f, -0.515454f, 0.9353323f}, {0.4847488f, -0.2582148f, 0.4847488f, -0.5164296f, 0.9389952f}, {0.4856256f, -0.2586818f, 0.4856256f, -0.5173637f, 0.9425023f}, {0.4864626f, -0.2591277f, 0.4864626f, -0.5182554f, 0.9458505f}, {0.4872596f, -0.2595522f, 0.4872596f, -0.5191045f, 0.9490382f}, {0.4880165f, -0.2599554f, 0.4880165f, -0.5199108f, 0.9520659f}, {0.4887337f, -0.2603375f, 0.4887337f, -0.5206749f, 0.9549348f}, {0.489412f, -0.2606988f, 0.489412f, -0.5213976f, 0.9576479f}},
-  {{0.2490747f, -0.058165f, 0.2490747f, -0.1163299f, -0.0037013f}, {0.2500472f, -0.0583921f, 0.2500472f, -0.1167842f, 0.0001888f}, {0.25292f, -0.059063f, 0.25292f, -0.1181259f, 0.0116801f}, {0.2575641f, -0.0601475f, 0.2575641f, -0.1202949f, 0.0302565f}, {0.2637801f, -0.061599f, 0.2637801f, -0.1231981f, 0.0551203f}, {0.2713186f, -0.0633595f, 0.2713186f, -0.1267189f, 0.0852743f}, {0.2799034f, -0.0653642f, 0.2799034f, -0.1307285f, 0.1196137f}, {0.2892534f, -0.0675477f, 0.2892534f, -0.1350954f, 0.1570138f}, {0.2991009f, -0.0698473f, 0.2991009f, -0.1396946f, 0.1964037f}, {0.3092048f, -0.0722068f, 0.3092048f, -0.1444137f, 0.2368194f}, {0.3193588f, -0.074578f, 0.3193588f, -0.149156f, 0.2774351f}, {0.329394f, -0.0769215f, 0.329394f, -0.153843f, 0.3175759f}, {0.339179f, -0.0792065f, 0.339179f, -0.158413f, 0.3567159f}, {0.3486165f, -0.0814104f, 0.3486165f, -0.1628208f, 0.3944659f}, {0.357639f, -0.0835174f, 0.357639f, -0.1670348f, 0.4305561f}, {0.366204f, -0.0855175f, 0.366204f, -0.171035f, 0.4648161f}, {0.3742889f, -0.0874055f, 0.3742889f, -0.1748111f, 0.4971556f}, {0.3818866f, -0.0891798f, 0.3818866f, -0.1783596f, 0.5275464f}, {0.3890017f, -0.0908413f, 0.3890017f, -0.1816826f, 0.5560067f}, {0.395647f, -0.0923932f, 0.395647f, -0.1847864f, 0.5825882f}, {0.4018414f, -0.0938397f, 0.4018414f, -0.1876794f, 0.6073654f}, {0.407607f, -0.0951861f, 0.407607f, -0.1903722f, 0.630428f}, {0.4129684f, -0.0964381f, 0.4129684f, -0.1928763f, 0.6518737f}, {0.417951f, -0.0976017f, 0.417951f, -0.1952034f, 0.6718042f}, {0.4225804f, -0.0986828f, 0.4225804f, -0.1973655f, 0.6903215f}, {0.4268814f, -0.0996872f, 0.4268814f, -0.1993743f, 0.7075255f}, {0.4308782f, -0.1006205f, 0.4308782f, -0.201241f, 0.7235126f}, {0.4345936f, -0.1014881f, 0.4345936f, -0.2029763f, 0.7383743f}, {0.4380492f, -0.1022951f, 0.4380492f, -0.2045902f, 0.7521967f}, {0.4412652f, -0.1030461f, 0.4412652f, -0.2060922f, 0.7650607f}, {0.4442602f, -0.1037455f, 0.4442602f, -0.2074911f, 0.777041f}, {0.4470518f, -0.1043974f, 0.4470518f, -0.2087949f, 0.7882071f}, {0.4496558f, -0.1050055f, 0.4496558f, -0.210011f, 0.798623f}, {0.4520869f, -0.1055733f, 0.4520869f, -0.2111465f, 0.8083476f}, {0.4543588f, -0.1061038f, 0.4543588f, -0.2122076f, 0.8174351f}, {0.4564837f, -0.1066f, 0.4564837f, -0.2132f, 0.825935f}, {0.4584732f, -0.1070646f, 0.4584732f, -0.2141292f, 0.8338928f}, {0.4603375f, -0.1075f, 0.4603375f, -0.215f, 0.8413502f}, {0.4620863f, -0.1079084f, 0.4620863f, -0.2158167f, 0.8483453f}, {0.4637282f, -0.1082918f, 0.4637282f, -0.2165836f, 0.8549129f}, {0.4652713f, -0.1086521f, 0.4652713f, -0.2173043f, 0.8610851f}, {0.4667228f, -0.1089911f, 0.4667228f, -0.2179822f, 0.8668911f}, {0.4680894f, -0.1093102f, 0.4680894f, -0.2186205f, 0.8723577f}, {0.4693774f, -0.109611f, 0.4693774f, -0.219222f, 0.8775094f}, {0.4705922f, -0.1098947f, 0.4705922f, -0.2197894f, 0.8823688f}, {0.4717663f, -0.1101689f, 0.4717663f, -0.2203377f, 0.8870652f}, {0.4729392f, -0.1104428f, 0.4729392f, -0.2208856f, 0.891757f}, {0.4741078f, -0.1107157f, 0.4741078f, -0.2214313f, 0.896431f}, {0.4752679f, -0.1109866f, 0.4752679f, -0.2219732f, 0.9010717f}, {0.4764156f, -0.1112546f, 0.4764156f, -0.2225092f, 0.9056624f}, {0.4775467f, -0.1115187f, 0.4775467f, -0.2230375f, 0.9101868f}, {0.4786571f, -0.111778f, 0.4786571f, -0.2235561f, 0.9146284f}, {0.479743f, -0.1120316f, 0.479743f, -0.2240632f, 0.9189719f}, {0.4808008f, -0.1122786f, 0.4808008f, -0.2245573f, 0.9232033f}, {0.4818275f, -0.1125184f, 0.4818275f, -0.2250368f, 0.9273099f}, {0.4828202f, -0.1127502f, 0.4828202f, -0.2255005f, 0.9312809f}, {0.4837769f, -0.1129736f, 0.4837769f, -0.2259473f, 0.9351076f}, {0.4846957f, -0.1131882f, 0.4846957f, -0.2263764f, 0.9387828f}, {0.4855754f, -0.1133936f, 0.4855754f, -0.2267873f, 0.9423018f}, {0.4864153f, -0.1135898f, 0.4864153f, -0.2271795f, 0.9456613f}, {0.487215f, -0.1137765f, 0.487215f, -0.227553f, 0.9488599f}, {0.4879745f, -0.1139539f, 0.4879745f, -0.2279077f, 0.9518978f}, {0.4886942f, -0.1141219f, 0.4886942f, -0.2282439f, 0.9547766f}, {0.4893748f, -0.1142809f, 0.4893748f, -0.2285617f, 0.9574991f}},
-  {{0.2405122f, 0.0256852f, 0.2405122f, 0.0513703f, -0.0379514f}, {0.2414834f, 0.0257889f, 0.2414834f, 0.0515778f, -0.0340663f}, {0.2443541f, 0.0260955f, 0.2443541f, 0.0521909f, -0.0225838f}, {0.2489994f, 0.0265915f, 0.2489994f, 0.0531831f, -0.0040026f}, {0.2552262f, 0.0272565f, 0.2552262f, 0.0545131f, 0.0209048f}, {0.2627922f, 0.0280645f, 0.2627922f, 0.0561291f, 0.0511689f}, {0.2714275f, 0.0289867f, 0.2714275f, 0.0579735f, 0.08571f}, {0.2808557f, 0.0299936f, 0.2808557f, 0.0599872f, 0.1234227f}, {0.2908118f, 0.0310568f, 0.2908118f, 0.0621137f, 0.1632471f}, {0.3010553f, 0.0321508f, 0.3010553f, 0.0643016f, 0.2042212f}, {0.3113784f, 0.0332532f, 0.3113784f, 0.0665064f, 0.2455134f}, {0.3216092f, 0.0343458f, 0.3216092f, 0.0686916f, 0.286437f}, {0.3316125f, 0.0354141f, 0.3316125f, 0.0708282f, 0.32645f}, {0.3412862f, 0.0364472f, 0.3412862f, 0.0728944f, 0.365145f}, {0.3505584f, 0.0374374f, 0.3505584f, 0.0748748f, 0.4022336f}, {0.3593819f, 0.0383797f, 0.3593819f, 0.0767594f, 0.4375276f}, {0.3677301f, 0.0392712f, 0.3677301f, 0.0785425f, 0.4709205f}, {0.3755925f, 0.0401109f, 0.3755925f, 0.0802218f, 0.5023699f}, {0.3829705f, 0.0408988f, 0.3829705f, 0.0817976f, 0.531882f}, {0.3898747f, 0.0416361f, 0.3898747f, 0.0832723f, 0.5594989f}, {0.3963219f, 0.0423247f, 0.3963219f, 0.0846493f, 0.5852876f}, {0.4023329f, 0.0429666f, 0.4023329f, 0.0859332f, 0.6093318f}, {0.4079313f, 0.0435645f, 0.4079313f, 0.0871289f, 0.6317251f}, {0.4131416f, 0.0441209f, 0.4131416f, 0.0882418f, 0.6525665f}, {0.4179891f, 0.0446386f, 0.4179891f, 0.0892771f, 0.6719563f}, {0.4224984f, 0.0451201f, 0.4224984f, 0.0902403f, 0.6899935f}, {0.4266936f, 0.0455682f, 0.4266936f, 0.0911363f, 0.7067743f}, {0.4305977f, 0.0459851f, 0.4305977f, 0.0919702f, 0.7223908f}, {0.4342325f, 0.0463733f, 0.4342325f, 0.0927465f, 0.7369299f}, {0.4376184f, 0.0467349f, 0.4376184f, 0.0934697f, 0.7504735f}, {0.4407745f, 0.0470719f, 0.4407745f, 0.0941438f, 0.7630978f}, {0.4437184f, 0.0473863f, 0.4437184f, 0.0947726f, 0.7748738f}, {0.4464667f, 0.0476798f, 0.4464667f, 0.0953596f, 0.7858669f}, {0.4490344f, 0.047954f, 0.4490344f, 0.095908f, 0.7961377f}, {0.4514355f, 0.0482104f, 0.4514355f, 0.0964209f, 0.8057419f}, {0.4536827f, 0.0484504f, 0.4536827f, 0.0969008f, 0.8147307f}, {0.4557878f, 0.0486752f, 0.4557878f, 0.0973505f, 0.8231511f}, {0.4577616f, 0.048886f, 0.4577616f, 0.097772f, 0.8310463f}, {0.459614f, 0.0490838f, 0.459614f, 0.0981677f, 0.8384559f}, {0.461354f, 0.0492697f, 0.461354f, 0.0985393f, 0.845416f}, {0.46299f, 0.0494444f, 0.46299f, 0.0988888f, 0.85196f}, {0.4645296f, 0.0496088f, 0.4645296f, 0.0992176f, 0.8581183f}, {0.4659797f, 0.0497637f, 0.4659797f, 0.0995273f, 0.8639189f}, {0.4673469f, 0.0499097f, 0.4673469f, 0.0998193f, 0.8693874f}, {0.4686369f, 0.0500474f, 0.4686369f, 0.1000949f, 0.8745475f}, {0.469884f, 0.0501806f, 0.469884f, 0.1003612f, 0.8795362f}, {0.4711304f, 0.0503137f, 0.4711304f, 0.1006274f, 0.8845216f}, {0.4723725f, 0.0504464f, 0.4723725f, 0.1008927f, 0.8894898f}, {0.473606f, 0.0505781f, 0.473606f, 0.1011562f, 0.8944242f}, {0.4748268f, 0.0507085f, 0.4748268f, 0.1014169f, 0.8993071f}, {0.4760302f, 0.050837f, 0.4760302f, 0.101674f, 0.9041209f}, {0.477212f, 0.0509632f, 0.477212f, 0.1019264f, 0.9088481f}, {0.4783681f, 0.0510867f, 0.4783681f, 0.1021733f, 0.9134725f}, {0.4794947f, 0.051207f, 0.4794947f, 0.102414f, 0.9179788f}, {0.4805884f, 0.0513238f, 0.4805884f, 0.1026475f, 0.9223535f}, {0.4816462f, 0.0514367f, 0.4816462f, 0.1028735f, 0.926585f}, {0.4826659f, 0.0515456f, 0.4826659f, 0.1030913f, 0.9306637f}, {0.4836455f, 0.0516503f, 0.4836455f, 0.1033005f, 0.9345822f}, {0.4845837f, 0.0517505f, 0.4845837f, 0.1035009f, 0.9383349f}, {0.4854796f, 0.0518461f, 0.4854796f, 0.1036923f, 0.9419184f}, {0.4863328f, 0.0519372f, 0.4863328f, 0.1038745f, 0.9453312f}, {0.4871433f, 0.0520238f, 0.4871433f, 0.1040476f, 0.9485732f}, {0.4879115f, 0.0521058f, 0.4879115f, 0.1042117f, 0.9516461f}, {0.4886381f, 0.0521834f, 0.4886381f, 0.1043669f, 0.9545526f}},
-  {{0.2346582f, 0.1133159f, 0.2346582f, 0.2266318f, -0.061367f}, {0.2356273f, 0.1137839f, 0.2356273f, 0.2275678f, -0.0574907f}, {0.2384926f, 0.1151675f, 0.2384926f, 0.230335f, -0.0460297f}, {0.2431324f, 0.1174081f, 0.2431324f, 0.2348162f, -0.0274703f}, {0.2493583f, 0.1204146f, 0.2493583f, 0.2408291f, -0.0025667f}, {0.256933f, 0.1240723f, 0.256933f, 0.2481447f, 0.0277319f}, {0.2655913f, 0.1282534f, 0.2655913f, 0.2565068f, 0.0623651f}, {0.2750607f, 0.1328262f, 0.2750607f, 0.2656523f, 0.1002428f}, {0.2850786f, 0.1376638f, 0.2850786f, 0.2753276f, 0.1403144f}, {0.2954054f, 0.1426506f, 0.2954054f, 0.2853011f, 0.1816214f}, {0.3058325f, 0.1476858f, 0.3058325f, 0.2953716f, 0.22333f}, {0.3161866f, 0.1526858f, 0.3161866f, 0.3053716f, 0.2647465f}, {0.3263297f, 0.1575839f, 0.3263297f, 0.3151677f, 0.305319f}, {0.336157f, 0.1623295f, 0.336157f, 0.3246589f, 0.3446281f}, {0.3455933f, 0.1668862f, 0.3455933f, 0.3337724f, 0.3823731f}, {0.3545883f, 0.1712299f, 0.3545883f, 0.3424598f, 0.4183533f}, {0.3631127f, 0.1753463f, 0.3631127f, 0.3506926f, 0.452451f}, {0.3711534f, 0.1792291f, 0.3711534f, 0.3584582f, 0.4846136f}, {0.3787097f, 0.182878f, 0.3787097f, 0.365756f, 0.5148387f}, {0.3857903f, 0.1862972f, 0.3857903f, 0.3725945f, 0.5431612f}, {0.3924106f, 0.1894942f, 0.3924106f, 0.3789883f, 0.5696424f}, {0.3985904f, 0.1924784f, 0.3985904f, 0.3849567f, 0.5943615f}, {0.4043522f, 0.1952608f, 0.4043522f, 0.3905215f, 0.617409f}, {0.4097203f, 0.197853f, 0.4097203f, 0.395706f, 0.6388813f}, {0.4147193f, 0.200267f, 0.4147193f, 0.4005339f, 0.6588771f}, {0.4193737f, 0.2025146f, 0.4193737f, 0.4050292f, 0.6774947f}, {0.4237075f, 0.2046074f, 0.4237075f, 0.4092147f, 0.69483f}, {0.4277437f, 0.2065564f, 0.4277437f, 0.4131129f, 0.7109748f}, {0.4315042f, 0.2083724f, 0.4315042f, 0.4167447f, 0.7260167f}, {0.4350095f, 0.2100651f, 0.4350095f, 0.4201302f, 0.7400381f}, {0.438279f, 0.2116439f, 0.438279f, 0.4232878f, 0.7531159f}, {0.4413305f, 0.2131175f, 0.4413305f, 0.4262349f, 0.765322f}, {0.4441807f, 0.2144938f, 0.4441807f, 0.4289877f, 0.7767229f}, {0.446845f, 0.2157804f, 0.446845f, 0.4315608f, 0.78738f}, {0.4493376f, 0.2169841f, 0.4493376f, 0.4339681f, 0.7973503f}, {0.4516715f, 0.2181111f, 0.4516715f, 0.4362222f, 0.8066858f}, {0.4538587f, 0.2191673f, 0.4538587f, 0.4383346f, 0.8154347f}, {0.4559103f, 0.220158f, 0.4559103f, 0.440316f, 0.8236411f}, {0.4578364f, 0.2210881f, 0.4578364f, 0.4421762f, 0.8313455f}, {0.4596463f, 0.2219621f, 0.4596463f, 0.4439242f, 0.838585f}, {0.4613485f, 0.2227841f, 0.4613485f, 0.4455682f, 0.845394f}, {0.4629509f, 0.2235579f, 0.4629509f, 0.4471158f, 0.8518035f}, {0.4644606f, 0.224287f, 0.4644606f, 0.4485739f, 0.8578426f}, {0.4658844f, 0.2249745f, 0.4658844f, 0.4499489f, 0.8635374f}, {0.4672281f, 0.2256234f, 0.4672281f, 0.4512467f, 0.8689124f}, {0.4685275f, 0.2262509f, 0.4685275f, 0.4525017f, 0.8741101f}, {0.4698264f, 0.2268781f, 0.4698264f, 0.4537562f, 0.8793056f}, {0.4711211f, 0.2275033f, 0.4711211f, 0.4550066f, 0.8844845f}, {0.4724073f, 0.2281244f, 0.4724073f, 0.4562488f, 0.8896293f}, {0.4736804f, 0.2287392f, 0.4736804f, 0.4574783f, 0.8947217f}, {0.4749358f, 0.2293454f, 0.4749358f, 0.4586908f, 0.8997431f}, {0.4761689f, 0.2299408f, 0.4761689f, 0.4598817f, 0.9046754f}, {0.4773754f, 0.2305234f, 0.4773754f, 0.4610469f, 0.9095014f}, {0.4785513f, 0.2310913f, 0.4785513f, 0.4621826f, 0.9142052f}, {0.4796932f, 0.2316427f, 0.4796932f, 0.4632854f, 0.9187727f}, {0.4807979f, 0.2321762f, 0.4807979f, 0.4643524f, 0.9231915f}, {0.4818629f, 0.2326905f, 0.4818629f, 0.465381f, 0.9274517f}, {0.4828863f, 0.2331847f, 0.4828863f, 0.4663693f, 0.9315452f}, {0.4838666f, 0.2336581f, 0.4838666f, 0.4673161f, 0.9354664f}, {0.4848028f, 0.2341102f, 0.4848028f, 0.4682203f, 0.9392114f}, {0.4856946f, 0.2345408f, 0.4856946f, 0.4690816f, 0.9427785f}, {0.4865419f, 0.23495f, 0.4865419f, 0.4698999f, 0.9461677f}, {0.4873451f, 0.2353378f, 0.4873451f, 0.4706757f, 0.9493806f}, {0.488105f, 0.2357048f, 0.488105f, 0.4714095f, 0.9524199f}},
-  {{0.2329515f, 0.2054259f, 0.2329515f, 0.4108518f, -0.0681939f}, {0.2339198f, 0.2062797f, 0.2339198f, 0.4125594f, -0.0643209f}, {0.2367829f, 0.2088045f, 0.2367829f, 0.417609f, -0.0528686f}, {0.2414201f, 0.2128939f, 0.2414201f, 0.4257877f, -0.0343194f}, {0.2476445f, 0.2183827f, 0.2476445f, 0.4367654f, -0.0094222f}, {0.2552201f, 0.2250632f, 0.2552201f, 0.4501263f, 0.0208803f}, {0.2638833f, 0.2327028f, 0.2638833f, 0.4654055f, 0.0555333f}, {0.2733629f, 0.2410622f, 0.2733629f, 0.4821244f, 0.0934514f}, {0.2833968f, 0.2499106f, 0.2833968f, 0.4998211f, 0.1335873f}, {0.2937459f, 0.2590368f, 0.2937459f, 0.5180736f, 0.1749837f}, {0.3042016f, 0.268257f, 0.3042016f, 0.536514f, 0.2168063f}, {0.31459f, 0.2774179f, 0.31459f, 0.5548358f, 0.2583598f}, {0.3247724f, 0.2863971f, 0.3247724f, 0.5727943f, 0.2990894f}, {0.3346431f, 0.2951016f, 0.3346431f, 0.5902031f, 0.3385725f}, {0.3441261f, 0.303464f, 0.3441261f, 0.6069281f, 0.3765044f}, {0.3531703f, 0.3114396f, 0.3531703f, 0.6228792f, 0.4126813f}, {0.3617455f, 0.3190015f, 0.3617455f, 0.638003f, 0.4469819f}, {0.3698376f, 0.3261375f, 0.3698376f, 0.652275f, 0.4793505f}, {0.3774456f, 0.3328465f, 0.3774456f, 0.665693f, 0.5097824f}, {0.3845775f, 0.3391357f, 0.3845775f, 0.6782714f, 0.5383101f}, {0.3912483f, 0.3450183f, 0.3912483f, 0.6900365f, 0.5649932f}, {0.3974774f, 0.3505113f, 0.3974774f, 0.7010227f, 0.5899097f}, {0.4032872f, 0.3556346f, 0.4032872f, 0.7112692f, 0.6131487f}, {0.4087015f, 0.3604092f, 0.4087015f, 0.7208184f, 0.6348061f}, {0.413745f, 0.3648568f, 0.413745f, 0.7297135f, 0.6549801f}, {0.4184421f, 0.3689989f, 0.4184421f, 0.7379977f, 0.6737686f}, {0.4228168f, 0.3728566f, 0.4228168f, 0.7457132f, 0.6912672f}, {0.426892f, 0.3764503f, 0.426892f, 0.7529006f, 0.707568f}, {0.4306896f, 0.3797992f, 0.4306896f, 0.7595984f, 0.7227585f}, {0.4342303f, 0.3829215f, 0.4342303f, 0.765843f, 0.7369212f}, {0.4375333f, 0.3858342f, 0.4375333f, 0.7716685f, 0.7501333f}, {0.4406167f, 0.3885533f, 0.4406167f, 0.7771066f, 0.7624669f}, {0.4434972f, 0.3910934f, 0.4434972f, 0.7821868f, 0.7739887f}, {0.4461901f, 0.3934682f, 0.4461901f, 0.7869363f, 0.7847606f}, {0.4487099f, 0.3956902f, 0.4487099f, 0.7913803f, 0.7948395f}, {0.4510695f, 0.397771f, 0.4510695f, 0.795542f, 0.8042781f}, {0.4532812f, 0.3997213f, 0.4532812f, 0.7994426f, 0.8131247f}, {0.4553559f, 0.4015509f, 0.4553559f, 0.8031018f, 0.8214237f}, {0.457304f, 0.4032688f, 0.457304f, 0.8065375f, 0.8292159f}, {0.4591347f, 0.4048832f, 0.4591347f, 0.8097663f, 0.8365387f}, {0.4608566f, 0.4064017f, 0.4608566f, 0.8128033f, 0.8434266f}, {0.4624778f, 0.4078312f, 0.4624778f, 0.8156625f, 0.8499111f}, {0.4640053f, 0.4091783f, 0.4640053f, 0.8183566f, 0.8560213f}, {0.4654459f, 0.4104487f, 0.4654459f, 0.8208973f, 0.8617836f}, {0.4668057f, 0.4116478f, 0.4668057f, 0.8232955f, 0.8672228f}, {0.4681207f, 0.4128074f, 0.4681207f, 0.8256148f, 0.8724829f}, {0.4694353f, 0.4139667f, 0.4694353f, 0.8279333f, 0.8777412f}, {0.4707458f, 0.4151223f, 0.4707458f, 0.8302446f, 0.8829831f}, {0.4720477f, 0.4162704f, 0.4720477f, 0.8325407f, 0.8881908f}, {0.4733364f, 0.4174068f, 0.4733364f, 0.8348137f, 0.8933457f}, {0.4746073f, 0.4185275f, 0.4746073f, 0.8370551f, 0.8984293f}, {0.4758557f, 0.4196284f, 0.4758557f, 0.8392569f, 0.9034229f}, {0.4770773f, 0.4207057f, 0.4770773f, 0.8414114f, 0.9083093f}, {0.4782681f, 0.4217557f, 0.4782681f, 0.8435115f, 0.9130722f}, {0.4794243f, 0.4227754f, 0.4794243f, 0.8455508f, 0.9176974f}, {0.4805431f, 0.4237619f, 0.4805431f, 0.8475239f, 0.9221724f}, {0.4816217f, 0.4247131f, 0.4816217f, 0.8494263f, 0.9264869f}, {0.4826582f, 0.4256272f, 0.4826582f, 0.8512543f, 0.9306329f}, {0.4836511f, 0.4265027f, 0.4836511f, 0.8530055f, 0.9346046f}, {0.4845995f, 0.427339f, 0.4845995f, 0.8546781f, 0.938398f}, {0.4855029f, 0.4281357f, 0.4855029f, 0.8562713f, 0.9420114f}, {0.4863612f, 0.4288926f, 0.4863612f, 0.8577852f, 0.9454448f}, {0.4871749f, 0.4296102f, 0.4871749f, 0.8592203f, 0.9486997f}, {0.4879447f, 0.430289f, 0.4879447f, 0.860578f, 0.9517789f}},
-  {{0.2381409f, 0.3047603f, 0.2381409f, 0.6095206f, -0.0474364f}, {0.2391114f, 0.3060023f, 0.2391114f, 0.6120046f, -0.0435544f}, {0.2419803f, 0.3096737f, 0.2419803f, 0.6193473f, -0.032079f}, {0.246624f, 0.3156165f, 0.246624f, 0.6312329f, -0.0135041f}, {0.2528513f, 0.3235858f, 0.2528513f, 0.6471716f, 0.011405f}, {0.2604218f, 0.3332742f, 0.2604218f, 0.6665483f, 0.0416871f}, {0.2690675f, 0.3443385f, 0.2690675f, 0.688677f, 0.07627f}, {0.2785136f, 0.3564271f, 0.2785136f, 0.7128543f, 0.1140544f}, {0.288496f, 0.3692021f, 0.288496f, 0.7384041f, 0.1539839f}, {0.2987744f, 0.3823559f, 0.2987744f, 0.7647118f, 0.1950977f}, {0.3091408f, 0.3956222f, 0.3091408f, 0.7912445f, 0.2365632f}, {0.3194227f, 0.4087804f, 0.3194227f, 0.8175609f, 0.2776907f}, {0.3294835f, 0.4216558f, 0.3294835f, 0.8433116f, 0.3179341f}, {0.3392203f, 0.4341164f, 0.3392203f, 0.8682328f, 0.3568811f}, {0.3485596f, 0.4460683f, 0.3485596f, 0.8921366f, 0.3942383f}, {0.3574531f, 0.4574498f, 0.3574531f, 0.9148996f, 0.4298124f}, {0.3658731f, 0.4682253f, 0.3658731f, 0.9364505f, 0.4634924f}, {0.373808f, 0.4783799f, 0.373808f, 0.9567598f, 0.4952318f}, {0.3812584f, 0.4879145f, 0.3812584f, 0.975829f, 0.5250335f}, {0.3882341f, 0.4968417f, 0.3882341f, 0.9936834f, 0.5529365f}, {0.3947514f, 0.5051822f, 0.3947514f, 1.0103644f, 0.5790056f}, {0.4008307f, 0.5129622f, 0.4008307f, 1.0259244f, 0.6033229f}, {0.4064952f, 0.5202112f, 0.4064952f, 1.0404225f, 0.6259806f}, {0.4117692f, 0.5269607f, 0.4117692f, 1.0539214f, 0.6470768f}, {0.4166778f, 0.5332424f, 0.4166778f, 1.0664849f, 0.6667111f}, {0.4212456f, 0.5390881f, 0.4212456f, 1.0781762f, 0.6849824f}, {0.4254967f, 0.5445284f, 0.4254967f, 1.0890567f, 0.7019866f}, {0.429454f, 0.5495927f, 0.429454f, 1.0991855f, 0.7178159f}, {0.4331394f, 0.5543091f, 0.4331394f, 1.1086182f, 0.7325574f}, {0.4365733f, 0.5587037f, 0.4365733f, 1.1174074f, 0.7462933f}, {0.439775f, 0.562801f, 0.439775f, 1.1256021f, 0.7591f}, {0.4427622f, 0.5666239f, 0.4427622f, 1.1332478f, 0.7710488f}, {0.4455515f, 0.5701935f, 0.4455515f, 1.1403869f, 0.7822058f}, {0.448158f, 0.5735291f, 0.448158f, 1.1470582f, 0.7926318f}, {0.4505958f, 0.5766489f, 0.4505958f, 1.1532978f, 0.802383f}, {0.4528778f, 0.5795693f, 0.4528778f, 1.1591386f, 0.811511f}, {0.4550158f, 0.5823055f, 0.4550158f, 1.1646109f, 0.8200633f}, {0.4570208f, 0.5848714f, 0.4570208f, 1.1697427f, 0.8280834f}, {0.4589028f, 0.5872798f, 0.4589028f, 1.1745596f, 0.8356112f}, {0.4606708f, 0.5895425f, 0.4606708f, 1.1790849f, 0.8426834f}, {0.4623334f, 0.5916701f, 0.4623334f, 1.1833402f, 0.8493336f}, {0.4638982f, 0.5936726f, 0.4638982f, 1.1873452f, 0.8555926f}, {0.4653722f, 0.595559f, 0.4653722f, 1.191118f, 0.8614888f}, {0.466762f, 0.5973376f, 0.466762f, 1.1946752f, 0.867048f}, {0.4680735f, 0.599016f, 0.4680735f, 1.1980321f, 0.8722942f}, {0.4693417f, 0.6006389f, 0.4693417f, 1.2012778f, 0.8773666f}, {0.470609f, 0.6022609f, 0.470609f, 1.2045217f, 0.8824362f}, {0.4718722f, 0.6038774f, 0.4718722f, 1.2077547f, 0.8874888f}, {0.4731269f, 0.605483f, 0.4731269f, 1.210966f, 0.8925074f}, {0.4743685f, 0.6070721f, 0.4743685f, 1.2141441f, 0.8974742f}, {0.4755928f, 0.6086388f, 0.4755928f, 1.2172775f, 0.9023711f}, {0.4767951f, 0.6101774f, 0.4767951f, 1.2203549f, 0.9071804f}, {0.4779714f, 0.6116828f, 0.4779714f, 1.2233655f, 0.9118855f}, {0.4791177f, 0.6131498f, 0.4791177f, 1.2262995f, 0.9164708f}, {0.4802306f, 0.6145741f, 0.4802306f, 1.2291481f, 0.9209226f}, {0.4813073f, 0.6159519f, 0.4813073f, 1.2319037f, 0.925229f}, {0.4823451f, 0.61728f, 0.4823451f, 1.23456f, 0.9293803f}, {0.4833422f, 0.6185561f, 0.4833422f, 1.2371122f, 0.9333688f}, {0.4842972f, 0.6197783f, 0.4842972f, 1.2395565f, 0.9371889f}, {0.4852093f, 0.6209454f, 0.4852093f, 1.2418909f, 0.940837f}, {0.4860779f, 0.6220571f, 0.4860779f, 1.2441141f, 0.9443115f}, {0.4869031f, 0.6231131f, 0.4869031f, 1.2462262f, 0.9476124f}, {0.4876853f, 0.6241141f, 0.4876853f, 1.2482283f, 0.9507412f}, {0.4884252f, 0.625061f, 0.4884252f, 1.250122f, 0.9537008f}},
-  {{0.2566513f, 0.4204684f, 0.2566513f, 0.8409368f, 0.026605f}, {0.257623f, 0.4220604f, 0.257623f, 0.8441207f, 0.0304919f}, {0.2604922f, 0.4267609f, 0.2604922f, 0.8535218f, 0.0419686f}, {0.2651261f, 0.4343526f, 0.2651261f, 0.8687052f, 0.0605043f}, {0.2713203f, 0.4445005f, 0.2713203f, 0.889001f, 0.0852812f}, {0.2788199f, 0.4567871f, 0.2788199f, 0.9135741f, 0.1152798f}, {0.2873439f, 0.4707517f, 0.2873439f, 0.9415035f, 0.1493756f}, {0.2966075f, 0.4859282f, 0.2966075f, 0.9718564f, 0.1864301f}, {0.3063414f, 0.5018752f, 0.3063414f, 1.0037503f, 0.2253658f}, {0.3163049f, 0.5181981f, 0.3163049f, 1.0363962f, 0.2652194f}, {0.3262932f, 0.5345619f, 0.3262932f, 1.0691237f, 0.3051727f}, {0.3361408f, 0.5506951f, 0.3361408f, 1.1013902f, 0.3445633f}, {0.3457201f, 0.5663887f, 0.3457201f, 1.1327774f, 0.3828804f}, {0.3549379f, 0.5814901f, 0.3549379f, 1.1629803f, 0.4197517f}, {0.363731f, 0.5958957f, 0.363731f, 1.1917914f, 0.4549239f}, {0.3720606f, 0.609542f, 0.3720606f, 1.2190839f, 0.4882423f}, {0.3799076f, 0.6223977f, 0.3799076f, 1.2447954f, 0.5196305f}, {0.387268f, 0.6344561f, 0.387268f, 1.2689123f, 0.5490721f}, {0.3941488f, 0.6457288f, 0.3941488f, 1.2914576f, 0.5765951f}, {0.4005648f, 0.65624f, 0.4005648f, 1.31248f, 0.602259f}, {0.4065361f, 0.6660228f, 0.4065361f, 1.3320456f, 0.6261445f}, {0.4120863f, 0.6751156f, 0.4120863f, 1.3502312f, 0.6483453f}, {0.4172406f, 0.6835598f, 0.4172406f, 1.3671196f, 0.6689624f}, {0.4220248f, 0.6913977f, 0.4220248f, 1.3827954f, 0.6880993f}, {0.4264647f, 0.6986716f, 0.4264647f, 1.3973432f, 0.7058589f}, {0.4305854f, 0.7054224f, 0.4305854f, 1.4108448f, 0.7223416f}, {0.4344108f, 0.7116895f, 0.4344108f, 1.4233791f, 0.7376432f}, {0.4379637f, 0.7175102f, 0.4379637f, 1.4350203f, 0.7518547f}, {0.4412653f, 0.7229192f, 0.4412653f, 1.4458383f, 0.7650612f}, {0.4443355f, 0.7279491f, 0.4443355f, 1.4558982f, 0.7773422f}, {0.4471928f, 0.7326301f, 0.4471928f, 1.4652602f, 0.7887712f}, {0.449854f, 0.73699f, 0.449854f, 1.4739799f, 0.7994161f}, {0.4523349f, 0.7410543f, 0.4523349f, 1.4821087f, 0.8093396f}, {0.4546497f, 0.7448467f, 0.4546497f, 1.4896934f, 0.8185989f}, {0.4568117f, 0.7483886f, 0.4568117f, 1.4967772f, 0.8272467f}, {0.4588328f, 0.7516998f, 0.4588328f, 1.5033995f, 0.8353312f}, {0.4607241f, 0.7547982f, 0.4607241f, 1.5095965f, 0.8428964f}, {0.4624957f, 0.7577006f, 0.4624957f, 1.5154011f, 0.8499826f}, {0.4641567f, 0.7604218f, 0.4641567f, 1.5208436f, 0.8566267f}, {0.4657156f, 0.7629757f, 0.4657156f, 1.5259515f, 0.8628623f}, {0.4671801f, 0.765375f, 0.4671801f, 1.53075f, 0.8687203f}, {0.4685572f, 0.7676311f, 0.4685572f, 1.5352622f, 0.8742287f}, {0.4698534f, 0.7697546f, 0.4698534f, 1.5395092f, 0.8794134f}, {0.4710745f, 0.7717552f, 0.4710745f, 1.5435103f, 0.884298f}, {0.472226f, 0.7736417f, 0.472226f, 1.5472833f, 0.888904f}, {0.4733386f, 0.7754644f, 0.4733386f, 1.5509287f, 0.8933543f}, {0.4744497f, 0.7772848f, 0.4744497f, 1.5545695f, 0.8977989f}, {0.4755564f, 0.7790978f, 0.4755564f, 1.5581956f, 0.9022255f}, {0.4766548f, 0.7808974f, 0.4766548f, 1.5617947f, 0.9066193f}, {0.4777412f, 0.7826771f, 0.4777412f, 1.5653542f, 0.9109647f}, {0.4788115f, 0.7844306f, 0.4788115f, 1.5688613f, 0.9152461f}, {0.479862f, 0.7861516f, 0.479862f, 1.5723033f, 0.919448f}, {0.480889f, 0.7878342f, 0.480889f, 1.5756684f, 0.9235561f}, {0.4818893f, 0.7894729f, 0.4818893f, 1.5789458f, 0.9275571f}, {0.4828598f, 0.7910629f, 0.4828598f, 1.5821258f, 0.9314392f}, {0.4837981f, 0.7926f, 0.4837981f, 1.5852001f, 0.9351923f}, {0.484702f, 0.7940809f, 0.484702f, 1.5881619f, 0.938808f}, {0.48557f, 0.795503f, 0.48557f, 1.5910059f, 0.94228f}, {0.4864009f, 0.7968642f, 0.4864009f, 1.5937284f, 0.9456035f}, {0.487194f, 0.7981635f, 0.487194f, 1.596327f, 0.9487758f}, {0.4879489f, 0.7994003f, 0.4879489f, 1.5988006f, 0.9517957f}, {0.4886658f, 0.8005748f, 0.4886658f, 1.6011496f, 0.9546633f}, {0.489345f, 0.8016876f, 0.489345f, 1.6033752f, 0.9573802f}, {0.4899873f, 0.8027397f, 0.4899873f, 1.6054794f, 0.9599491f}},
-  {{0.2922457f, 0.5542426f, 0.2922457f, 1.1371341f, 0.2074191f}, {0.293177f, 0.5560154f, 0.293177f, 1.140633f, 0.2111357f}, {0.2959202f, 0.5612376f, 0.2959202f, 1.1509354f, 0.2220789f}, {0.3003305f, 0.5696339f, 0.3003305f, 1.1674848f, 0.2396578f}, {0.3061869f, 0.5807846f, 0.3061869f, 1.1894351f, 0.262974f}, {0.3132186f, 0.5941753f, 0.3132186f, 1.2157525f, 0.2909294f}, {0.3211335f, 0.6092504f, 0.3211335f, 1.2453256f, 0.3223436f}, {0.3296434f, 0.625462f, 0.3296434f, 1.2770634f, 0.3560582f}, {0.338484f, 0.6423069f, 0.338484f, 1.309971f, 0.391016f}, {0.3474275f, 0.6593512f, 0.3474275f, 1.3431955f, 0.4263112f}, {0.3562879f, 0.6762407f, 0.3562879f, 1.3760466f, 0.4612105f}, {0.364922f, 0.6927021f, 0.364922f, 1.407997f, 0.4951536f}, {0.3732258f, 0.7085366f, 0.3732258f, 1.4386679f, 0.5277381f}, {0.3811292f, 0.7236105f, 0.3811292f, 1.4678083f, 0.5586972f}, {0.3885901f, 0.7378429f, 0.3885901f, 1.4952713f, 0.5878747f}, {0.3955885f, 0.7511949f, 0.3955885f, 1.5209909f, 0.6152005f}, {0.4021204f, 0.7636591f, 0.4021204f, 1.5449615f, 0.6406684f}, {0.4081943f, 0.7752508f, 0.4081943f, 1.5672207f, 0.6643184f}, {0.4138266f, 0.786001f, 0.4138266f, 1.5878356f, 0.6862216f}, {0.4190391f, 0.7959511f, 0.4190391f, 1.6068915f, 0.7064687f}, {0.4238565f, 0.8051482f, 0.4238565f, 1.6244844f, 0.7251616f}, {0.4283053f, 0.8136422f, 0.4283053f, 1.6407148f, 0.7424069f}, {0.4324119f, 0.8214837f, 0.4324119f, 1.6556835f, 0.7583118f}, {0.4362026f, 0.8287226f, 0.4362026f, 1.6694889f, 0.7729808f}, {0.4397025f, 0.8354066f, 0.4397025f, 1.6822251f, 0.7865139f}, {0.4429353f, 0.841581f, 0.4429353f, 1.6939811f, 0.7990054f}, {0.4459232f, 0.8472881f, 0.4459232f, 1.7048395f, 0.8105433f}, {0.448687f, 0.8525673f, 0.448687f, 1.7148771f, 0.8212091f}, {0.4512456f, 0.857455f, 0.4512456f, 1.7241643f, 0.8310777f}, {0.4536165f, 0.8619844f, 0.4536165f, 1.7327659f, 0.8402177f}, {0.4558158f, 0.866186f, 0.4558158f, 1.7407409f, 0.848692f}, {0.4578579f, 0.8700877f, 0.4578579f, 1.748143f, 0.8565575f}, {0.4597564f, 0.8737149f, 0.4597564f, 1.755021f, 0.8638662f}, {0.4615231f, 0.8770905f, 0.4615231f, 1.7614194f, 0.8706652f}, {0.463169f, 0.8802357f, 0.463169f, 1.7673785f, 0.8769975f}, {0.4647043f, 0.8831693f, 0.4647043f, 1.7729348f, 0.8829018f}, {0.4661379f, 0.8859087f, 0.4661379f, 1.7781215f, 0.8884133f}, {0.467478f, 0.8884696f, 0.467478f, 1.7829687f, 0.8935641f}, {0.4687322f, 0.8908663f, 0.4687322f, 1.7875038f, 0.8983833f}, {0.4699072f, 0.8931118f, 0.4699072f, 1.7917515f, 0.902897f}, {0.4710092f, 0.8952179f, 0.4710092f, 1.7957344f, 0.9071295f}, {0.4720438f, 0.8971953f, 0.4720438f, 1.7994731f, 0.9111023f}, {0.4730163f, 0.8990538f, 0.4730163f, 1.8029861f, 0.9148355f}, {0.4739312f, 0.9008024f, 0.4739312f, 1.8062907f, 0.9183471f}, {0.4747928f, 0.9024491f, 0.4747928f, 1.8094022f, 0.9216535f}, {0.4756242f, 0.9040383f, 0.4756242f, 1.8124043f, 0.9248437f}, {0.4764537f, 0.9056236f, 0.4764537f, 1.8153984f, 0.9280255f}, {0.4772787f, 0.9072006f, 0.4772787f, 1.8183763f, 0.93119f}, {0.4780967f, 0.908764f, 0.4780967f, 1.8213282f, 0.9343268f}, {0.4789047f, 0.9103084f, 0.4789047f, 1.8242435f, 0.9374248f}, {0.4796998f, 0.9118283f, 0.4796998f, 1.827112f, 0.9404731f}, {0.4804793f, 0.9133184f, 0.4804793f, 1.8299237f, 0.943461f}, {0.4812406f, 0.9147735f, 0.4812406f, 1.8326691f, 0.9463784f}, {0.4819812f, 0.9161892f, 0.4819812f, 1.8353395f, 0.9492162f}, {0.482699f, 0.9175614f, 0.482699f, 1.8379274f, 0.9519663f}, {0.4833923f, 0.9188866f, 0.4833923f, 1.8404264f, 0.9546219f}, {0.4840595f, 0.9201621f, 0.4840595f, 1.8428312f, 0.9571774f}, {0.4846995f, 0.9213857f, 0.4846995f, 1.8451378f, 0.9596286f}, {0.4853117f, 0.9225559f, 0.4853117f, 1.8473436f, 0.9619726f}, {0.4858955f, 0.9236719f, 0.4858955f, 1.8494469f, 0.9642077f}, {0.4864508f, 0.9247335f, 0.4864508f, 1.8514472f, 0.9663334f}, {0.4869776f, 0.9257407f, 0.4869776f, 1.8533449f, 0.9683501f}, {0.4874764f, 0.9266943f, 0.4874764f, 1.8551414f, 0.9702592f}, {0.4879477f, 0.9275953f, 0.4879477f, 1.8568386f, 0.9720628f}}
-};
-
-}
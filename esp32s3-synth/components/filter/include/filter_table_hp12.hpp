@@ -1,73 +0,0 @@
-#pragma once
-#include <cstdint>
-#include "protocol.hpp"
-using namespace protocol;
-namespace sound_module
-{
-  constexpr float filterTableHP12[CUTOFF_TABLE_SIZE][RESONANCE_TABLE_SIZE][5] = {
-      {{0.9973859f, -1.9947719f, 0.9973859f, -1.9947684f, 0.9947753f}, {0.9974061f, -1.9948122f, 0.9974061f, -1.9948088f, 0.9948157f}, {0.9974649f, -1.9949297f, 0.9974649f, -1.9949263f, 0.9949332f}, {0.9975571f, -1.9951142f, 0.9975571f, -1.9951108f, 0.9951176f}, {0.9976755f, -1.9953509f, 0.9976755f, -1.9953475f, 0.9953543f}, {0.9978118f, -1.9956235f, 0.9978118f, -1.9956201f, 0.9956269f}, {0.9979581f, -1.9959162f, 0.9979581f, -1.9959128f, 0.9959196f}, {0.9981076f, -1.9962153f, 0.9981076f, -1.9962118f, 0.9962187f}, {0.9982551f, -1.9965101f, 0.9982551f, -1.9965067f, 0.9965135f}, {0.9983966f, -1.9967932f, 0.9983966f, -1.9967898f, 0.9967966f}, {0.9985299f, -1.9970597f, 0.9985299f, -1.9970563f, 0.9970631f}, {0.9986535f, -1.997307f, 0.9986535f, -1.9973036f, 0.9973105f}, {0.9987671f, -1.9975342f, 0.9987671f, -1.9975307f, 0.9975376f}, {0.9988706f, -1.9977412f, 0.9988706f, -1.9977377f, 0.9977446f}, {0.9989645f, -1.9979289f, 0.9989645f, -1.9979255f, 0.9979323f}, {0.9990493f, -1.9980986f, 0.9990493f, -1.9980952f, 0.998102f}, {0.9991258f, -1.9982517f, 0.9991258f, -1.9982482f, 0.9982551f}, {0.9991948f, -1.9983896f, 0.9991948f, -1.9983862f, 0.9983931f}, {0.999257f, -1.998514f, 0.999257f, -1.9985105f, 0.9985174f}, {0.999313f, -1.9986261f, 0.999313f, -1.9986226f, 0.9986295f}, {0.9993636f, -1.9987272f, 0.9993636f, -1.9987238f, 0.9987306f}, {0.9994093f, -1.9988186f, 0.9994093f, -1.9988152f, 0.9988221f}, {0.9994507f, -1.9989013f, 0.9994507f, -1.9988979f, 0.9989048f}, {0.9994882f, -1.9989763f, 0.9994882f, -1.9989729f, 0.9989797f}, {0.9995222f, -1.9990444f, 0.9995222f, -1.999041f, 0.9990478f}, {0.9995532f, -1.9991063f, 0.9995532f, -1.9991029f, 0.9991098f}, {0.9995814f, -1.9991628f, 0.9995814f, -1.9991593f, 0.9991662f}, {0.9996072f, -1.9992143f, 0.9996072f, -1.9992109f, 0.9992177f}, {0.9996307f, -1.9992615f, 0.9996307f, -1.999258f, 0.9992649f}, {0.9996523f, -1.9993047f, 0.9996523f, -1.9993013f, 0.9993081f}, {0.9996722f, -1.9993444f, 0.9996722f, -1.999341f, 0.9993478f}, {0.9996905f, -1.9993809f, 0.9996905f, -1.9993775f, 0.9993843f}, {0.9997073f, -1.9994146f, 0.9997073f, -1.9994111f, 0.999418f}, {0.9997228f, -1.9994456f, 0.9997228f, -1.9994422f, 0.9994491f}, {0.9997372f, -1.9994744f, 0.9997372f, -1.999471f, 0.9994778f}, {0.9997505f, -1.999501f, 0.9997505f, -1.9994976f, 0.9995044f}, {0.9997629f, -1.9995257f, 0.9997629f, -1.9995223f, 0.9995291f}, {0.9997743f, -1.9995487f, 0.9997743f, -1.9995452f, 0.9995521f}, {0.999785f, -1.99957f, 0.999785f, -1.9995666f, 0.9995735f}, {0.999795f, -1.9995899f, 0.999795f, -1.9995865f, 0.9995934f}, {0.9998043f, -1.9996085f, 0.9998043f, -1.9996051f, 0.999612f}, {0.9998129f, -1.9996259f, 0.9998129f, -1.9996225f, 0.9996293f}, {0.9998211f, -1.9996422f, 0.9998211f, -1.9996387f, 0.9996456f}, {0.9998287f, -1.9996574f, 0.9998287f, -1.999654f, 0.9996608f}, {0.9998358f, -1.9996717f, 0.9998358f, -1.9996683f, 0.9996751f}, {0.9998427f, -1.9996854f, 0.9998427f, -1.999682f, 0.9996889f}, {0.9998495f, -1.9996991f, 0.9998495f, -1.9996957f, 0.9997025f}, {0.9998563f, -1.9997126f, 0.9998563f, -1.9997092f, 0.9997161f}, {0.999863f, -1.999726f, 0.999863f, -1.9997226f, 0.9997294f}, {0.9998696f, -1.9997392f, 0.9998696f, -1.9997358f, 0.9997426f}, {0.9998761f, -1.9997521f, 0.9998761f, -1.9997487f, 0.9997555f}, {0.9998824f, -1.9997647f, 0.9998824f, -1.9997613f, 0.9997682f}, {0.9998885f, -1.999777f, 0.9998885f, -1.9997736f, 0.9997805f}, {0.9998945f, -1.999789f, 0.9998945f, -1.9997855f, 0.9997924f}, {0.9999002f, -1.9998005f, 0.9999002f, -1.9997971f, 0.9998039f}, {0.9999058f, -1.9998116f, 0.9999058f, -1.9998081f, 0.999815f}, {0.9999111f, -1.9998222f, 0.9999111f, -1.9998188f, 0.9998256f}, {0.9999162f, -1.9998324f, 0.9999162f, -1.999829f, 0.9998358f}, {0.9999211f, -1.9998421f, 0.9999211f, -1.9998387f, 0.9998455f}, {0.9999257f, -1.9998514f, 0.9999257f, -1.9998479f, 0.9998548f}, {0.9999301f, -1.9998601f, 0.9999301f, -1.9998567f, 0.9998636f}, {0.9999342f, -1.9998684f, 0.9999342f, -1.999865f, 0.9998719f}, {0.9999381f, -1.9998763f, 0.9999381f, -1.9998729f, 0.9998797f}, {0.9999418f, -1.9998837f, 0.9999418f, -1.9998803f, 0.9998871f}},
-      {{0.9970799f, -1.9941599f, 0.9970799f, -1.9941556f, 0.9941642f}, {0.9971025f, -1.994205f, 0.9971025f, -1.9942007f, 0.9942093f}, {0.9971681f, -1.9943362f, 0.9971681f, -1.9943319f, 0.9943405f}, {0.9972711f, -1.9945421f, 0.9972711f, -1.9945379f, 0.9945464f}, {0.9974032f, -1.9948065f, 0.9974032f, -1.9948022f, 0.9948108f}, {0.9975555f, -1.9951109f, 0.9975555f, -1.9951067f, 0.9951152f}, {0.9977189f, -1.9954378f, 0.9977189f, -1.9954335f, 0.995442f}, {0.9978859f, -1.9957718f, 0.9978859f, -1.9957675f, 0.995776f}, {0.9980505f, -1.9961011f, 0.9980505f, -1.9960968f, 0.9961053f}, {0.9982086f, -1.9964172f, 0.9982086f, -1.996413f, 0.9964215f}, {0.9983575f, -1.9967149f, 0.9983575f, -1.9967106f, 0.9967192f}, {0.9984956f, -1.9969912f, 0.9984956f, -1.9969869f, 0.9969954f}, {0.9986224f, -1.9972448f, 0.9986224f, -1.9972406f, 0.9972491f}, {0.998738f, -1.9974761f, 0.998738f, -1.9974718f, 0.9974803f}, {0.9988429f, -1.9976858f, 0.9988429f, -1.9976815f, 0.9976901f}, {0.9989377f, -1.9978753f, 0.9989377f, -1.9978711f, 0.9978796f}, {0.9990232f, -1.9980463f, 0.9990232f, -1.9980421f, 0.9980506f}, {0.9991002f, -1.9982004f, 0.9991002f, -1.9981962f, 0.9982047f}, {0.9991697f, -1.9983393f, 0.9991697f, -1.9983351f, 0.9983436f}, {0.9992323f, -1.9984646f, 0.9992323f, -1.9984603f, 0.9984688f}, {0.9992888f, -1.9985776f, 0.9992888f, -1.9985733f, 0.9985818f}, {0.9993398f, -1.9986797f, 0.9993398f, -1.9986754f, 0.998684f}, {0.999386f, -1.9987721f, 0.999386f, -1.9987678f, 0.9987764f}, {0.9994279f, -1.9988558f, 0.9994279f, -1.9988516f, 0.9988601f}, {0.999466f, -1.9989319f, 0.999466f, -1.9989276f, 0.9989362f}, {0.9995005f, -1.9990011f, 0.9995005f, -1.9989968f, 0.9990054f}, {0.9995321f, -1.9990642f, 0.9995321f, -1.9990599f, 0.9990684f}, {0.9995609f, -1.9991217f, 0.9995609f, -1.9991175f, 0.999126f}, {0.9995872f, -1.9991744f, 0.9995872f, -1.9991701f, 0.9991787f}, {0.9996114f, -1.9992227f, 0.9996114f, -1.9992184f, 0.999227f}, {0.9996335f, -1.9992671f, 0.9996335f, -1.9992628f, 0.9992713f}, {0.9996539f, -1.9993079f, 0.9996539f, -1.9993036f, 0.9993121f}, {0.9996727f, -1.9993455f, 0.9996727f, -1.9993412f, 0.9993497f}, {0.9996901f, -1.9993802f, 0.9996901f, -1.9993759f, 0.9993845f}, {0.9997061f, -1.9994123f, 0.9997061f, -1.999408f, 0.9994166f}, {0.999721f, -1.999442f, 0.999721f, -1.9994378f, 0.9994463f}, {0.9997348f, -1.9994696f, 0.9997348f, -1.9994654f, 0.9994739f}, {0.9997476f, -1.9994953f, 0.9997476f, -1.999491f, 0.9994996f}, {0.9997596f, -1.9995192f, 0.9997596f, -1.9995149f, 0.9995234f}, {0.9997707f, -1.9995414f, 0.9997707f, -1.9995371f, 0.9995457f}, {0.9997811f, -1.9995622f, 0.9997811f, -1.9995579f, 0.9995664f}, {0.9997908f, -1.9995816f, 0.9997908f, -1.9995773f, 0.9995859f}, {0.9997999f, -1.9995997f, 0.9997999f, -1.9995955f, 0.999604f}, {0.9998084f, -1.9996168f, 0.9998084f, -1.9996125f, 0.999621f}, {0.9998164f, -1.9996327f, 0.9998164f, -1.9996285f, 0.999637f}, {0.999824f, -1.9996481f, 0.999824f, -1.9996438f, 0.9996524f}, {0.9998317f, -1.9996634f, 0.9998317f, -1.9996591f, 0.9996676f}, {0.9998392f, -1.9996785f, 0.9998392f, -1.9996742f, 0.9996828f}, {0.9998467f, -1.9996934f, 0.9998467f, -1.9996892f, 0.9996977f}, {0.9998541f, -1.9997082f, 0.9998541f, -1.9997039f, 0.9997124f}, {0.9998613f, -1.9997226f, 0.9998613f, -1.9997183f, 0.9997269f}, {0.9998684f, -1.9997367f, 0.9998684f, -1.9997324f, 0.999741f}, {0.9998752f, -1.9997504f, 0.9998752f, -1.9997462f, 0.9997547f}, {0.9998819f, -1.9997638f, 0.9998819f, -1.9997595f, 0.999768f}, {0.9998883f, -1.9997766f, 0.9998883f, -1.9997724f, 0.9997809f}, {0.9998945f, -1.999789f, 0.9998945f, -1.9997847f, 0.9997933f}, {0.9999005f, -1.9998009f, 0.9999005f, -1.9997966f, 0.9998052f}, {0.9999061f, -1.9998123f, 0.9999061f, -1.999808f, 0.9998166f}, {0.9999116f, -1.9998232f, 0.9999116f, -1.9998189f, 0.9998274f}, {0.9999167f, -1.9998335f, 0.9999167f, -1.9998292f, 0.9998378f}, {0.9999216f, -1.9998433f, 0.9999216f, -1.999839f, 0.9998476f}, {0.9999263f, -1.9998526f, 0.9999263f, -1.9998483f, 0.9998568f}, {0.9999307f, -1.9998613f, 0.9999307f, -1.999857f, 0.9998656f}, {0.9999348f, -1.9998696f, 0.9999348f, -1.9998653f, 0.9998739f}},
-      {{0.9967382f, -1.9934764f, 0.9967382f, -1.9934711f, 0.9934818f}, {0.9967634f, -1.9935268f, 0.9967634f, -1.9935215f, 0.9935321f}, {0.9968366f, -1.9936733f, 0.9968366f, -1.993668f, 0.9936786f}, {0.9969516f, -1.9939032f, 0.9969516f, -1.9938979f, 0.9939086f}, {0.9970992f, -1.9941984f, 0.9970992f, -1.9941931f, 0.9942037f}, {0.9972692f, -1.9945384f, 0.9972692f, -1.9945331f, 0.9945437f}, {0.9974517f, -1.9949033f, 0.9974517f, -1.994898f, 0.9949087f}, {0.9976382f, -1.9952763f, 0.9976382f, -1.995271f, 0.9952817f}, {0.997822f, -1.9956441f, 0.997822f, -1.9956388f, 0.9956494f}, {0.9979986f, -1.9959972f, 0.9979986f, -1.9959919f, 0.9960025f}, {0.9981648f, -1.9963297f, 0.9981648f, -1.9963243f, 0.996335f}, {0.9983191f, -1.9966382f, 0.9983191f, -1.9966329f, 0.9966435f}, {0.9984608f, -1.9969216f, 0.9984608f, -1.9969162f, 0.9969269f}, {0.9985899f, -1.9971798f, 0.9985899f, -1.9971745f, 0.9971852f}, {0.998707f, -1.9974141f, 0.998707f, -1.9974087f, 0.9974194f}, {0.9988129f, -1.9976258f, 0.9988129f, -1.9976205f, 0.9976311f}, {0.9989084f, -1.9978168f, 0.9989084f, -1.9978115f, 0.9978222f}, {0.9989945f, -1.997989f, 0.9989945f, -1.9979836f, 0.9979943f}, {0.9990721f, -1.9981441f, 0.9990721f, -1.9981388f, 0.9981495f}, {0.999142f, -1.998284f, 0.999142f, -1.9982787f, 0.9982894f}, {0.9992051f, -1.9984103f, 0.9992051f, -1.9984049f, 0.9984156f}, {0.9992622f, -1.9985243f, 0.9992622f, -1.998519f, 0.9985297f}, {0.9993138f, -1.9986276f, 0.9993138f, -1.9986222f, 0.9986329f}, {0.9993606f, -1.9987211f, 0.9993606f, -1.9987158f, 0.9987265f}, {0.9994031f, -1.9988061f, 0.9994031f, -1.9988008f, 0.9988115f}, {0.9994417f, -1.9988834f, 0.9994417f, -1.9988781f, 0.9988887f}, {0.9994769f, -1.9989539f, 0.9994769f, -1.9989485f, 0.9989592f}, {0.9995091f, -1.9990182f, 0.9995091f, -1.9990129f, 0.9990235f}, {0.9995385f, -1.9990771f, 0.9995385f, -1.9990717f, 0.9990824f}, {0.9995655f, -1.999131f, 0.9995655f, -1.9991257f, 0.9991363f}, {0.9995903f, -1.9991806f, 0.9995903f, -1.9991752f, 0.9991859f}, {0.9996131f, -1.9992261f, 0.9996131f, -1.9992208f, 0.9992315f}, {0.9996341f, -1.9992681f, 0.9996341f, -1.9992628f, 0.9992735f}, {0.9996535f, -1.9993069f, 0.9996535f, -1.9993016f, 0.9993123f}, {0.9996714f, -1.9993428f, 0.9996714f, -1.9993375f, 0.9993481f}, {0.999688f, -1.999376f, 0.999688f, -1.9993707f, 0.9993814f}, {0.9997034f, -1.9994069f, 0.9997034f, -1.9994015f, 0.9994122f}, {0.9997178f, -1.9994355f, 0.9997178f, -1.9994302f, 0.9994409f}, {0.9997311f, -1.9994622f, 0.9997311f, -1.9994569f, 0.9994675f}, {0.9997435f, -1.9994871f, 0.9997435f, -1.9994817f, 0.9994924f}, {0.9997551f, -1.9995103f, 0.9997551f, -1.9995049f, 0.9995156f}, {0.999766f, -1.9995319f, 0.999766f, -1.9995266f, 0.9995373f}, {0.9997761f, -1.9995522f, 0.9997761f, -1.9995469f, 0.9995576f}, {0.9997856f, -1.9995713f, 0.9997856f, -1.9995659f, 0.9995766f}, {0.9997945f, -1.9995891f, 0.9997945f, -1.9995838f, 0.9995944f}, {0.9998031f, -1.9996063f, 0.9998031f, -1.9996009f, 0.9996116f}, {0.9998117f, -1.9996233f, 0.9998117f, -1.999618f, 0.9996286f}, {0.9998201f, -1.9996402f, 0.9998201f, -1.9996349f, 0.9996456f}, {0.9998285f, -1.9996569f, 0.9998285f, -1.9996516f, 0.9996623f}, {0.9998367f, -1.9996734f, 0.9998367f, -1.999668f, 0.9996787f}, {0.9998447f, -1.9996895f, 0.9998447f, -1.9996842f, 0.9996948f}, {0.9998526f, -1.9997053f, 0.9998526f, -1.9996999f, 0.9997106f}, {0.9998603f, -1.9997206f, 0.9998603f, -1.9997153f, 0.9997259f}, {0.9998677f, -1.9997355f, 0.9998677f, -1.9997301f, 0.9997408f}, {0.9998749f, -1.9997499f, 0.9998749f, -1.9997445f, 0.9997552f}, {0.9998819f, -1.9997637f, 0.9998819f, -1.9997584f, 0.9997691f}, {0.9998885f, -1.999777f, 0.9998885f, -1.9997717f, 0.9997823f}, {0.9998949f, -1.9997897f, 0.9998949f, -1.9997844f, 0.9997951f}, {0.9999009f, -1.9998018f, 0.9999009f, -1.9997965f, 0.9998072f}, {0.9999067f, -1.9998134f, 0.9999067f, -1.999808f, 0.9998187f}, {0.9999122f, -1.9998243f, 0.9999122f, -1.999819f, 0.9998297f}, {0.9999174f, -1.9998347f, 0.9999174f, -1.9998294f, 0.99984f}, {0.9999222f, -1.9998445f, 0.9999222f, -1.9998392f, 0.9998498f}, {0.9999269f, -1.9998537f, 0.9999269f, -1.9998484f, 0.9998591f}},
-      {{0.9963566f, -1.9927132f, 0.9963566f, -1.9927065f, 0.9927198f}, {0.9963847f, -1.9927694f, 0.9963847f, -1.9927627f, 0.992776f}, {0.9964665f, -1.9929329f, 0.9964665f, -1.9929263f, 0.9929396f}, {0.9965948f, -1.9931897f, 0.9965948f, -1.993183f, 0.9931963f}, {0.9967596f, -1.9935193f, 0.9967596f, -1.9935126f, 0.9935259f}, {0.9969494f, -1.9938989f, 0.9969494f, -1.9938922f, 0.9939055f}, {0.9971532f, -1.9943064f, 0.9971532f, -1.9942997f, 0.994313f}, {0.9973614f, -1.9947229f, 0.9973614f, -1.9947163f, 0.9947295f}, {0.9975668f, -1.9951336f, 0.9975668f, -1.9951269f, 0.9951402f}, {0.997764f, -1.9955279f, 0.997764f, -1.9955213f, 0.9955346f}, {0.9979496f, -1.9958992f, 0.9979496f, -1.9958926f, 0.9959059f}, {0.9981219f, -1.9962438f, 0.9981219f, -1.9962372f, 0.9962505f}, {0.9982801f, -1.9965603f, 0.9982801f, -1.9965536f, 0.996567f}, {0.9984244f, -1.9968488f, 0.9984244f, -1.9968421f, 0.9968554f}, {0.9985552f, -1.9971104f, 0.9985552f, -1.9971038f, 0.9971171f}, {0.9986735f, -1.9973469f, 0.9986735f, -1.9973403f, 0.9973536f}, {0.9987801f, -1.9975603f, 0.9987801f, -1.9975536f, 0.997567f}, {0.9988763f, -1.9977526f, 0.9988763f, -1.997746f, 0.9977593f}, {0.998963f, -1.9979259f, 0.998963f, -1.9979193f, 0.9979326f}, {0.9990411f, -1.9980822f, 0.9990411f, -1.9980755f, 0.9980889f}, {0.9991116f, -1.9982232f, 0.9991116f, -1.9982166f, 0.9982299f}, {0.9991753f, -1.9983507f, 0.9991753f, -1.998344f, 0.9983573f}, {0.999233f, -1.998466f, 0.999233f, -1.9984593f, 0.9984726f}, {0.9992853f, -1.9985705f, 0.9992853f, -1.9985639f, 0.9985772f}, {0.9993327f, -1.9986654f, 0.9993327f, -1.9986588f, 0.9986721f}, {0.9993759f, -1.9987518f, 0.9993759f, -1.9987451f, 0.9987585f}, {0.9994152f, -1.9988305f, 0.9994152f, -1.9988238f, 0.9988372f}, {0.9994512f, -1.9989024f, 0.9994512f, -1.9988957f, 0.998909f}, {0.9994841f, -1.9989681f, 0.9994841f, -1.9989615f, 0.9989748f}, {0.9995142f, -1.9990284f, 0.9995142f, -1.9990217f, 0.9990351f}, {0.9995419f, -1.9990838f, 0.9995419f, -1.9990771f, 0.9990904f}, {0.9995673f, -1.9991347f, 0.9995673f, -1.999128f, 0.9991413f}, {0.9995908f, -1.9991816f, 0.9995908f, -1.999175f, 0.9991883f}, {0.9996125f, -1.999225f, 0.9996125f, -1.9992183f, 0.9992316f}, {0.9996325f, -1.999265f, 0.9996325f, -1.9992584f, 0.9992717f}, {0.9996511f, -1.9993022f, 0.9996511f, -1.9992955f, 0.9993088f}, {0.9996683f, -1.9993366f, 0.9996683f, -1.9993299f, 0.9993433f}, {0.9996843f, -1.9993686f, 0.9996843f, -1.999362f, 0.9993753f}, {0.9996992f, -1.9993984f, 0.9996992f, -1.9993918f, 0.9994051f}, {0.9997131f, -1.9994262f, 0.9997131f, -1.9994195f, 0.9994329f}, {0.9997261f, -1.9994521f, 0.9997261f, -1.9994454f, 0.9994588f}, {0.9997382f, -1.9994763f, 0.9997382f, -1.9994697f, 0.999483f}, {0.9997495f, -1.999499f, 0.9997495f, -1.9994924f, 0.9995057f}, {0.9997601f, -1.9995203f, 0.9997601f, -1.9995136f, 0.9995269f}, {0.9997701f, -1.9995402f, 0.9997701f, -1.9995335f, 0.9995469f}, {0.9997797f, -1.9995594f, 0.9997797f, -1.9995527f, 0.999566f}, {0.9997892f, -1.9995784f, 0.9997892f, -1.9995718f, 0.9995851f}, {0.9997987f, -1.9995973f, 0.9997987f, -1.9995907f, 0.999604f}, {0.999808f, -1.999616f, 0.999808f, -1.9996093f, 0.9996226f}, {0.9998172f, -1.9996344f, 0.9998172f, -1.9996277f, 0.999641f}, {0.9998262f, -1.9996524f, 0.9998262f, -1.9996457f, 0.999659f}, {0.999835f, -1.99967f, 0.999835f, -1.9996633f, 0.9996767f}, {0.9998436f, -1.9996871f, 0.9998436f, -1.9996805f, 0.9996938f}, {0.9998519f, -1.9997038f, 0.9998519f, -1.9996971f, 0.9997104f}, {0.9998599f, -1.9997198f, 0.9998599f, -1.9997132f, 0.9997265f}, {0.9998676f, -1.9997353f, 0.9998676f, -1.9997286f, 0.999742f}, {0.9998751f, -1.9997501f, 0.9998751f, -1.9997435f, 0.9997568f}, {0.9998822f, -1.9997644f, 0.9998822f, -1.9997577f, 0.999771f}, {0.999889f, -1.9997779f, 0.999889f, -1.9997712f, 0.9997846f}, {0.9998954f, -1.9997908f, 0.9998954f, -1.9997841f, 0.9997975f}, {0.9999015f, -1.999803f, 0.9999015f, -1.9997964f, 0.9998097f}, {0.9999073f, -1.9998146f, 0.9999073f, -1.9998079f, 0.9998213f}, {0.9999128f, -1.9998256f, 0.9999128f, -1.9998189f, 0.9998322f}, {0.9999179f, -1.9998359f, 0.9999179f, -1.9998292f, 0.9998425f}},
-      {{0.9959304f, -1.9918608f, 0.9959304f, -1.9918525f, 0.9918691f}, {0.9959618f, -1.9919235f, 0.9959618f, -1.9919153f, 0.9919318f}, {0.9960531f, -1.9921061f, 0.9960531f, -1.9920979f, 0.9921144f}, {0.9961964f, -1.9923928f, 0.9961964f, -1.9923845f, 0.9924011f}, {0.9963804f, -1.9927608f, 0.9963804f, -1.9927525f, 0.992769f}, {0.9965923f, -1.9931846f, 0.9965923f, -1.9931763f, 0.9931929f}, {0.9968198f, -1.9936396f, 0.9968198f, -1.9936313f, 0.9936479f}, {0.9970523f, -1.9941047f, 0.9970523f, -1.9940964f, 0.994113f}, {0.9972816f, -1.9945633f, 0.9972816f, -1.994555f, 0.9945716f}, {0.9975018f, -1.9950037f, 0.9975018f, -1.9949954f, 0.995012f}, {0.9977092f, -1.9954183f, 0.9977092f, -1.99541f, 0.9954266f}, {0.9979016f, -1.9958032f, 0.9979016f, -1.9957949f, 0.9958115f}, {0.9980783f, -1.9961566f, 0.9980783f, -1.9961483f, 0.9961649f}, {0.9982394f, -1.9964788f, 0.9982394f, -1.9964705f, 0.9964871f}, {0.9983855f, -1.9967711f, 0.9983855f, -1.9967628f, 0.9967794f}, {0.9985176f, -1.9970352f, 0.9985176f, -1.9970269f, 0.9970435f}, {0.9986368f, -1.9972736f, 0.9986368f, -1.9972653f, 0.9972819f}, {0.9987442f, -1.9974884f, 0.9987442f, -1.9974801f, 0.9974967f}, {0.998841f, -1.997682f, 0.998841f, -1.9976737f, 0.9976903f}, {0.9989283f, -1.9978565f, 0.9989283f, -1.9978482f, 0.9978649f}, {0.999007f, -1.9980141f, 0.999007f, -1.9980058f, 0.9980224f}, {0.9990782f, -1.9981564f, 0.9990782f, -1.9981481f, 0.9981648f}, {0.9991426f, -1.9982853f, 0.9991426f, -1.998277f, 0.9982936f}, {0.999201f, -1.9984021f, 0.999201f, -1.9983937f, 0.9984104f}, {0.999254f, -1.9985081f, 0.999254f, -1.9984998f, 0.9985164f}, {0.9993023f, -1.9986046f, 0.9993023f, -1.9985963f, 0.9986129f}, {0.9993462f, -1.9986925f, 0.9993462f, -1.9986842f, 0.9987008f}, {0.9993864f, -1.9987728f, 0.9993864f, -1.9987645f, 0.9987811f}, {0.9994231f, -1.9988463f, 0.9994231f, -1.9988379f, 0.9988546f}, {0.9994568f, -1.9989136f, 0.9994568f, -1.9989053f, 0.9989219f}, {0.9994877f, -1.9989754f, 0.9994877f, -1.9989671f, 0.9989837f}, {0.9995162f, -1.9990323f, 0.9995162f, -1.999024f, 0.9990406f}, {0.9995424f, -1.9990848f, 0.9995424f, -1.9990765f, 0.9990931f}, {0.9995666f, -1.9991332f, 0.9995666f, -1.9991249f, 0.9991415f}, {0.999589f, -1.999178f, 0.999589f, -1.9991696f, 0.9991863f}, {0.9996097f, -1.9992194f, 0.9996097f, -1.9992111f, 0.9992278f}, {0.999629f, -1.9992579f, 0.999629f, -1.9992496f, 0.9992662f}, {0.9996468f, -1.9992937f, 0.9996468f, -1.9992854f, 0.999302f}, {0.9996635f, -1.999327f, 0.9996635f, -1.9993187f, 0.9993353f}, {0.999679f, -1.999358f, 0.999679f, -1.9993497f, 0.9993663f}, {0.9996935f, -1.999387f, 0.9996935f, -1.9993787f, 0.9993953f}, {0.999707f, -1.999414f, 0.999707f, -1.9994057f, 0.9994224f}, {0.9997197f, -1.9994394f, 0.9997197f, -1.9994311f, 0.9994477f}, {0.9997316f, -1.9994631f, 0.9997316f, -1.9994548f, 0.9994714f}, {0.9997427f, -1.9994854f, 0.9997427f, -1.9994771f, 0.9994937f}, {0.9997534f, -1.9995068f, 0.9997534f, -1.9994985f, 0.9995151f}, {0.999764f, -1.9995281f, 0.999764f, -1.9995198f, 0.9995364f}, {0.9997746f, -1.9995492f, 0.9997746f, -1.9995409f, 0.9995575f}, {0.999785f, -1.9995701f, 0.999785f, -1.9995617f, 0.9995784f}, {0.9997953f, -1.9995906f, 0.9997953f, -1.9995823f, 0.9995989f}, {0.9998054f, -1.9996107f, 0.9998054f, -1.9996024f, 0.999619f}, {0.9998152f, -1.9996304f, 0.9998152f, -1.9996221f, 0.9996387f}, {0.9998248f, -1.9996496f, 0.9998248f, -1.9996412f, 0.9996579f}, {0.9998341f, -1.9996681f, 0.9998341f, -1.9996598f, 0.9996764f}, {0.999843f, -1.9996861f, 0.999843f, -1.9996778f, 0.9996944f}, {0.9998517f, -1.9997034f, 0.9998517f, -1.9996951f, 0.9997117f}, {0.99986f, -1.99972f, 0.99986f, -1.9997116f, 0.9997283f}, {0.9998679f, -1.9997358f, 0.9998679f, -1.9997275f, 0.9997442f}, {0.9998755f, -1.999751f, 0.9998755f, -1.9997427f, 0.9997593f}, {0.9998827f, -1.9997654f, 0.9998827f, -1.9997571f, 0.9997737f}, {0.9998895f, -1.999779f, 0.9998895f, -1.9997707f, 0.9997874f}, {0.999896f, -1.999792f, 0.999896f, -1.9997837f, 0.9998003f}, {0.9999021f, -1.9998042f, 0.9999021f, -1.9997959f, 0.9998125f}, {0.9999079f, -1.9998157f, 0.9999079f, -1.9998074f, 0.9998241f}},
-      {{0.9954545f, -1.990909f, 0.9954545f, -1.9908986f, 0.9909193f}, {0.9954895f, -1.990979f, 0.9954895f, -1.9909687f, 0.9909894f}, {0.9955914f, -1.9911829f, 0.9955914f, -1.9911725f, 0.9911932f}, {0.9957514f, -1.9915028f, 0.9957514f, -1.9914925f, 0.9915132f}, {0.9959568f, -1.9919136f, 0.9959568f, -1.9919033f, 0.991924f}, {0.9961934f, -1.9923868f, 0.9961934f, -1.9923764f, 0.9923971f}, {0.9964474f, -1.9928948f, 0.9964474f, -1.9928845f, 0.9929052f}, {0.9967071f, -1.9934141f, 0.9967071f, -1.9934038f, 0.9934245f}, {0.9969631f, -1.9939262f, 0.9969631f, -1.9939158f, 0.9939365f}, {0.997209f, -1.9944179f, 0.997209f, -1.9944076f, 0.9944283f}, {0.9974405f, -1.994881f, 0.9974405f, -1.9948706f, 0.9948913f}, {0.9976554f, -1.9953108f, 0.9976554f, -1.9953004f, 0.9953211f}, {0.9978528f, -1.9957055f, 0.9978528f, -1.9956951f, 0.9957159f}, {0.9980327f, -1.9960654f, 0.9980327f, -1.996055f, 0.9960757f}, {0.9981959f, -1.9963918f, 0.9981959f, -1.9963814f, 0.9964021f}, {0.9983434f, -1.9966868f, 0.9983434f, -1.9966765f, 0.9966972f}, {0.9984765f, -1.996953f, 0.9984765f, -1.9969427f, 0.9969634f}, {0.9985965f, -1.997193f, 0.9985965f, -1.9971826f, 0.9972034f}, {0.9987046f, -1.9974092f, 0.9987046f, -1.9973989f, 0.9974196f}, {0.9988021f, -1.9976042f, 0.9988021f, -1.9975939f, 0.9976146f}, {0.9988901f, -1.9977802f, 0.9988901f, -1.9977699f, 0.9977906f}, {0.9989696f, -1.9979393f, 0.9989696f, -1.9979289f, 0.9979496f}, {0.9990416f, -1.9980832f, 0.9990416f, -1.9980728f, 0.9980935f}, {0.9991068f, -1.9982136f, 0.9991068f, -1.9982033f, 0.998224f}, {0.999166f, -1.9983321f, 0.999166f, -1.9983217f, 0.9983425f}, {0.9992199f, -1.9984399f, 0.9992199f, -1.9984295f, 0.9984502f}, {0.999269f, -1.9985381f, 0.999269f, -1.9985277f, 0.9985485f}, {0.9993139f, -1.9986278f, 0.9993139f, -1.9986174f, 0.9986382f}, {0.9993549f, -1.9987099f, 0.9993549f, -1.9986995f, 0.9987202f}, {0.9993925f, -1.9987851f, 0.9993925f, -1.9987747f, 0.9987955f}, {0.9994271f, -1.9988542f, 0.9994271f, -1.9988438f, 0.9988646f}, {0.9994589f, -1.9989178f, 0.9994589f, -1.9989074f, 0.9989281f}, {0.9994882f, -1.9989763f, 0.9994882f, -1.998966f, 0.9989867f}, {0.9995152f, -1.9990304f, 0.9995152f, -1.9990201f, 0.9990408f}, {0.9995402f, -1.9990805f, 0.9995402f, -1.9990701f, 0.9990908f}, {0.9995634f, -1.9991268f, 0.9995634f, -1.9991164f, 0.9991372f}, {0.9995849f, -1.9991698f, 0.9995849f, -1.9991594f, 0.9991802f}, {0.9996049f, -1.9992098f, 0.9996049f, -1.9991994f, 0.9992201f}, {0.9996235f, -1.999247f, 0.9996235f, -1.9992366f, 0.9992573f}, {0.9996408f, -1.9992816f, 0.9996408f, -1.9992712f, 0.999292f}, {0.999657f, -1.999314f, 0.999657f, -1.9993036f, 0.9993244f}, {0.9996721f, -1.9993442f, 0.9996721f, -1.9993338f, 0.9993546f}, {0.9996863f, -1.9993725f, 0.9996863f, -1.9993621f, 0.9993829f}, {0.9996995f, -1.999399f, 0.9996995f, -1.9993887f, 0.9994094f}, {0.999712f, -1.9994239f, 0.999712f, -1.9994136f, 0.9994343f}, {0.9997239f, -1.9994479f, 0.9997239f, -1.9994375f, 0.9994582f}, {0.9997358f, -1.9994717f, 0.9997358f, -1.9994613f, 0.999482f}, {0.9997476f, -1.9994952f, 0.9997476f, -1.9994849f, 0.9995056f}, {0.9997593f, -1.9995185f, 0.9997593f, -1.9995081f, 0.9995289f}, {0.9997707f, -1.9995415f, 0.9997707f, -1.9995311f, 0.9995519f}, {0.999782f, -1.999564f, 0.999782f, -1.9995536f, 0.9995744f}, {0.999793f, -1.999586f, 0.999793f, -1.9995756f, 0.9995963f}, {0.9998037f, -1.9996074f, 0.9998037f, -1.999597f, 0.9996177f}, {0.9998141f, -1.9996281f, 0.9998141f, -1.9996177f, 0.9996385f}, {0.9998241f, -1.9996482f, 0.9998241f, -1.9996378f, 0.9996585f}, {0.9998337f, -1.9996675f, 0.9998337f, -1.9996571f, 0.9996779f}, {0.999843f, -1.999686f, 0.999843f, -1.9996756f, 0.9996964f}, {0.9998519f, -1.9997038f, 0.9998519f, -1.9996934f, 0.9997141f}, {0.9998603f, -1.9997207f, 0.9998603f, -1.9997103f, 0.9997311f}, {0.9998684f, -1.9997368f, 0.9998684f, -1.9997264f, 0.9997471f}, {0.999876f, -1.999752f, 0.999876f, -1.9997417f, 0.9997624f}, {0.9998832f, -1.9997665f, 0.9998832f, -1.9997561f, 0.9997769f}, {0.9998901f, -1.9997802f, 0.9998901f, -1.9997698f, 0.9997905f}, {0.9998965f, -1.999793f, 0.9998965f, -1.9997827f, 0.9998034f}},
-      {{0.9949231f, -1.9898462f, 0.9949231f, -1.9898333f, 0.9898591f}, {0.9949622f, -1.9899244f, 0.9949622f, -1.9899115f, 0.9899373f}, {0.9950759f, -1.9901519f, 0.9950759f, -1.990139f, 0.9901648f}, {0.9952545f, -1.990509f, 0.9952545f, -1.9904961f, 0.9905219f}, {0.9954838f, -1.9909676f, 0.9954838f, -1.9909547f, 0.9909805f}, {0.9957479f, -1.9914958f, 0.9957479f, -1.9914829f, 0.9915087f}, {0.9960315f, -1.992063f, 0.9960315f, -1.99205f, 0.9920759f}, {0.9963214f, -1.9926427f, 0.9963214f, -1.9926298f, 0.9926556f}, {0.9966072f, -1.9932144f, 0.9966072f, -1.9932015f, 0.9932274f}, {0.9968818f, -1.9937635f, 0.9968818f, -1.9937506f, 0.9937765f}, {0.9971403f, -1.9942806f, 0.9971403f, -1.9942677f, 0.9942935f}, {0.9973803f, -1.9947605f, 0.9973803f, -1.9947476f, 0.9947735f}, {0.9976007f, -1.9952014f, 0.9976007f, -1.9951885f, 0.9952143f}, {0.9978016f, -1.9956033f, 0.9978016f, -1.9955904f, 0.9956162f}, {0.9979839f, -1.9959678f, 0.9979839f, -1.9959549f, 0.9959808f}, {0.9981487f, -1.9962974f, 0.9981487f, -1.9962844f, 0.9963103f}, {0.9982974f, -1.9965947f, 0.9982974f, -1.9965818f, 0.9966077f}, {0.9984314f, -1.9968627f, 0.9984314f, -1.9968498f, 0.9968757f}, {0.9985521f, -1.9971043f, 0.9985521f, -1.9970913f, 0.9971172f}, {0.9986611f, -1.9973221f, 0.9986611f, -1.9973092f, 0.9973351f}, {0.9987593f, -1.9975187f, 0.9987593f, -1.9975057f, 0.9975316f}, {0.9988482f, -1.9976963f, 0.9988482f, -1.9976834f, 0.9977093f}, {0.9989286f, -1.9978571f, 0.9989286f, -1.9978442f, 0.9978701f}, {0.9990014f, -1.9980028f, 0.9990014f, -1.9979899f, 0.9980158f}, {0.9990676f, -1.9981352f, 0.9990676f, -1.9981222f, 0.9981481f}, {0.9991278f, -1.9982556f, 0.9991278f, -1.9982426f, 0.9982685f}, {0.9991827f, -1.9983653f, 0.9991827f, -1.9983524f, 0.9983783f}, {0.9992328f, -1.9984655f, 0.9992328f, -1.9984526f, 0.9984785f}, {0.9992786f, -1.9985572f, 0.9992786f, -1.9985443f, 0.9985702f}, {0.9993206f, -1.9986413f, 0.9993206f, -1.9986283f, 0.9986542f}, {0.9993592f, -1.9987185f, 0.9993592f, -1.9987055f, 0.9987314f}, {0.9993947f, -1.9987895f, 0.9993947f, -1.9987765f, 0.9988024f}, {0.9994275f, -1.9988549f, 0.9994275f, -1.998842f, 0.9988679f}, {0.9994577f, -1.9989154f, 0.9994577f, -1.9989024f, 0.9989283f}, {0.9994856f, -1.9989712f, 0.9994856f, -1.9989583f, 0.9989842f}, {0.9995115f, -1.999023f, 0.9995115f, -1.9990101f, 0.999036f}, {0.9995355f, -1.9990711f, 0.9995355f, -1.9990581f, 0.999084f}, {0.9995579f, -1.9991157f, 0.9995579f, -1.9991028f, 0.9991287f}, {0.9995786f, -1.9991573f, 0.9995786f, -1.9991443f, 0.9991702f}, {0.999598f, -1.999196f, 0.999598f, -1.999183f, 0.999209f}, {0.9996161f, -1.9992321f, 0.9996161f, -1.9992192f, 0.9992451f}, {0.999633f, -1.9992659f, 0.999633f, -1.999253f, 0.9992789f}, {0.9996488f, -1.9992976f, 0.9996488f, -1.9992846f, 0.9993105f}, {0.9996636f, -1.9993272f, 0.9996636f, -1.9993142f, 0.9993401f}, {0.9996775f, -1.999355f, 0.9996775f, -1.999342f, 0.999368f}, {0.9996909f, -1.9993817f, 0.9996909f, -1.9993688f, 0.9993947f}, {0.9997042f, -1.9994083f, 0.9997042f, -1.9993953f, 0.9994213f}, {0.9997173f, -1.9994347f, 0.9997173f, -1.9994217f, 0.9994476f}, {0.9997303f, -1.9994607f, 0.9997303f, -1.9994477f, 0.9994736f}, {0.9997432f, -1.9994863f, 0.9997432f, -1.9994734f, 0.9994993f}, {0.9997557f, -1.9995115f, 0.9997557f, -1.9994985f, 0.9995244f}, {0.999768f, -1.999536f, 0.999768f, -1.9995231f, 0.999549f}, {0.99978f, -1.9995599f, 0.99978f, -1.999547f, 0.9995729f}, {0.9997916f, -1.9995831f, 0.9997916f, -1.9995702f, 0.9995961f}, {0.9998028f, -1.9996055f, 0.9998028f, -1.9995926f, 0.9996185f}, {0.9998136f, -1.9996271f, 0.9998136f, -1.9996141f, 0.9996401f}, {0.9998239f, -1.9996478f, 0.9998239f, -1.9996349f, 0.9996608f}, {0.9998338f, -1.9996676f, 0.9998338f, -1.9996547f, 0.9996806f}, {0.9998433f, -1.9996865f, 0.9998433f, -1.9996736f, 0.9996995f}, {0.9998523f, -1.9997045f, 0.9998523f, -1.9996916f, 0.9997175f}, {0.9998608f, -1.9997216f, 0.9998608f, -1.9997086f, 0.9997345f}, {0.9998689f, -1.9997377f, 0.9998689f, -1.9997248f, 0.9997507f}, {0.9998765f, -1.999753f, 0.9998765f, -1.99974f, 0.999766f}, {0.9998837f, -1.9997674f, 0.9998837f, -1.9997544f, 0.9997804f}},
-      {{0.9943298f, -1.9886595f, 0.9943298f, -1.9886434f, 0.9886756f}, {0.9943734f, -1.9887468f, 0.9943734f, -1.9887307f, 0.9887629f}, {0.9945004f, -1.9890007f, 0.9945004f, -1.9889846f, 0.9890168f}, {0.9946997f, -1.9893994f, 0.9946997f, -1.9893833f, 0.9894154f}, {0.9949556f, -1.9899112f, 0.9949556f, -1.9898951f, 0.9899273f}, {0.9952504f, -1.9905007f, 0.9952504f, -1.9904846f, 0.9905168f}, {0.9955669f, -1.9911339f, 0.9955669f, -1.9911178f, 0.99115f}, {0.9958905f, -1.9917811f, 0.9958905f, -1.991765f, 0.9917972f}, {0.9962097f, -1.9924194f, 0.9962097f, -1.9924033f, 0.9924355f}, {0.9965162f, -1.9930324f, 0.9965162f, -1.9930163f, 0.9930486f}, {0.9968049f, -1.9936098f, 0.9968049f, -1.9935937f, 0.9936259f}, {0.9970729f, -1.9941457f, 0.9970729f, -1.9941296f, 0.9941619f}, {0.997319f, -1.994638f, 0.997319f, -1.9946219f, 0.9946541f}, {0.9975434f, -1.9950868f, 0.9975434f, -1.9950707f, 0.995103f}, {0.997747f, -1.995494f, 0.997747f, -1.9954778f, 0.9955101f}, {0.997931f, -1.995862f, 0.997931f, -1.9958459f, 0.9958782f}, {0.9980971f, -1.9961941f, 0.9980971f, -1.996178f, 0.9962103f}, {0.9982467f, -1.9964935f, 0.9982467f, -1.9964773f, 0.9965096f}, {0.9983816f, -1.9967633f, 0.9983816f, -1.9967471f, 0.9967794f}, {0.9985033f, -1.9970066f, 0.9985033f, -1.9969904f, 0.9970227f}, {0.9986131f, -1.9972262f, 0.9986131f, -1.99721f, 0.9972423f}, {0.9987123f, -1.9974246f, 0.9987123f, -1.9974085f, 0.9974408f}, {0.9988021f, -1.9976042f, 0.9988021f, -1.9975881f, 0.9976204f}, {0.9988835f, -1.997767f, 0.9988835f, -1.9977508f, 0.9977832f}, {0.9989574f, -1.9979148f, 0.9989574f, -1.9978987f, 0.997931f}, {0.9990247f, -1.9980493f, 0.9990247f, -1.9980332f, 0.9980655f}, {0.999086f, -1.9981719f, 0.999086f, -1.9981558f, 0.9981881f}, {0.9991419f, -1.9982839f, 0.9991419f, -1.9982677f, 0.9983001f}, {0.9991932f, -1.9983863f, 0.9991932f, -1.9983702f, 0.9984025f}, {0.9992401f, -1.9984802f, 0.9992401f, -1.9984641f, 0.9984964f}, {0.9992832f, -1.9985665f, 0.9992832f, -1.9985503f, 0.9985826f}, {0.9993229f, -1.9986458f, 0.9993229f, -1.9986296f, 0.998662f}, {0.9993595f, -1.9987189f, 0.9993595f, -1.9987027f, 0.9987351f}, {0.9993932f, -1.9987864f, 0.9993932f, -1.9987703f, 0.9988026f}, {0.9994244f, -1.9988489f, 0.9994244f, -1.9988327f, 0.998865f}, {0.9994534f, -1.9989067f, 0.9994534f, -1.9988906f, 0.9989229f}, {0.9994802f, -1.9989604f, 0.9994802f, -1.9989442f, 0.9989766f}, {0.9995051f, -1.9990103f, 0.9995051f, -1.9989941f, 0.9990265f}, {0.9995284f, -1.9990567f, 0.9995284f, -1.9990405f, 0.9990729f}, {0.99955f, -1.9991f, 0.99955f, -1.9990838f, 0.9991161f}, {0.9995702f, -1.9991404f, 0.9995702f, -1.9991242f, 0.9991565f}, {0.9995891f, -1.9991781f, 0.9995891f, -1.9991619f, 0.9991943f}, {0.9996067f, -1.9992134f, 0.9996067f, -1.9991973f, 0.9992296f}, {0.9996233f, -1.9992466f, 0.9996233f, -1.9992304f, 0.9992627f}, {0.9996388f, -1.9992776f, 0.9996388f, -1.9992614f, 0.9992938f}, {0.9996537f, -1.9993075f, 0.9996537f, -1.9992913f, 0.9993237f}, {0.9996686f, -1.9993372f, 0.9996686f, -1.999321f, 0.9993534f}, {0.9996833f, -1.9993666f, 0.9996833f, -1.9993505f, 0.9993828f}, {0.9996979f, -1.9993957f, 0.9996979f, -1.9993795f, 0.9994119f}, {0.9997122f, -1.9994243f, 0.9997122f, -1.9994082f, 0.9994405f}, {0.9997262f, -1.9994524f, 0.9997262f, -1.9994363f, 0.9994686f}, {0.9997399f, -1.9994799f, 0.9997399f, -1.9994637f, 0.9994961f}, {0.9997533f, -1.9995066f, 0.9997533f, -1.9994904f, 0.9995228f}, {0.9997663f, -1.9995325f, 0.9997663f, -1.9995163f, 0.9995487f}, {0.9997788f, -1.9995575f, 0.9997788f, -1.9995414f, 0.9995737f}, {0.9997908f, -1.9995817f, 0.9997908f, -1.9995655f, 0.9995978f}, {0.9998024f, -1.9996048f, 0.9998024f, -1.9995886f, 0.999621f}, {0.9998135f, -1.9996269f, 0.9998135f, -1.9996108f, 0.9996431f}, {0.999824f, -1.9996481f, 0.999824f, -1.9996319f, 0.9996642f}, {0.9998341f, -1.9996681f, 0.9998341f, -1.999652f, 0.9996843f}, {0.9998436f, -1.9996872f, 0.9998436f, -1.999671f, 0.9997034f}, {0.9998526f, -1.9997053f, 0.9998526f, -1.9996891f, 0.9997214f}, {0.9998612f, -1.9997223f, 0.9998612f, -1.9997061f, 0.9997385f}, {0.9998692f, -1.9997384f, 0.9998692f, -1.9997222f, 0.9997546f}},
-      {{0.9936674f, -1.9873347f, 0.9936674f, -1.9873146f, 0.9873548f}, {0.9937161f, -1.9874321f, 0.9937161f, -1.987412f, 0.9874522f}, {0.9938577f, -1.9877155f, 0.9938577f, -1.9876954f, 0.9877355f}, {0.9940802f, -1.9881603f, 0.9940802f, -1.9881402f, 0.9881804f}, {0.9943658f, -1.9887315f, 0.9943658f, -1.9887114f, 0.9887516f}, {0.9946948f, -1.9893895f, 0.9946948f, -1.9893694f, 0.9894096f}, {0.9950481f, -1.9900962f, 0.9950481f, -1.9900761f, 0.9901163f}, {0.9954093f, -1.9908187f, 0.9954093f, -1.9907986f, 0.9908388f}, {0.9957656f, -1.9915312f, 0.9957656f, -1.9915111f, 0.9915513f}, {0.9961078f, -1.9922157f, 0.9961078f, -1.9921955f, 0.9922358f}, {0.9964301f, -1.9928603f, 0.9964301f, -1.9928402f, 0.9928804f}, {0.9967293f, -1.9934587f, 0.9967293f, -1.9934386f, 0.9934788f}, {0.9970042f, -1.9940084f, 0.9970042f, -1.9939883f, 0.9940285f}, {0.9972548f, -1.9945096f, 0.9972548f, -1.9944895f, 0.9945298f}, {0.9974821f, -1.9949643f, 0.9974821f, -1.9949441f, 0.9949844f}, {0.9976877f, -1.9953753f, 0.9976877f, -1.9953552f, 0.9953955f}, {0.9978731f, -1.9957462f, 0.9978731f, -1.9957261f, 0.9957664f}, {0.9980403f, -1.9960806f, 0.9980403f, -1.9960604f, 0.9961007f}, {0.998191f, -1.9963819f, 0.998191f, -1.9963618f, 0.9964021f}, {0.9983269f, -1.9966537f, 0.9983269f, -1.9966335f, 0.9966739f}, {0.9984495f, -1.996899f, 0.9984495f, -1.9968788f, 0.9969192f}, {0.9985603f, -1.9971206f, 0.9985603f, -1.9971005f, 0.9971408f}, {0.9986606f, -1.9973213f, 0.9986606f, -1.9973011f, 0.9973414f}, {0.9987516f, -1.9975031f, 0.9987516f, -1.9974829f, 0.9975233f}, {0.9988341f, -1.9976683f, 0.9988341f, -1.9976481f, 0.9976884f}, {0.9989093f, -1.9978185f, 0.9989093f, -1.9977983f, 0.9978387f}, {0.9989777f, -1.9979555f, 0.9989777f, -1.9979353f, 0.9979756f}, {0.9990403f, -1.9980805f, 0.9990403f, -1.9980604f, 0.9981007f}, {0.9990975f, -1.998195f, 0.9990975f, -1.9981748f, 0.9982151f}, {0.9991499f, -1.9982999f, 0.9991499f, -1.9982797f, 0.99832f}, {0.9991981f, -1.9983962f, 0.9991981f, -1.998376f, 0.9984164f}, {0.9992424f, -1.9984848f, 0.9992424f, -1.9984647f, 0.998505f}, {0.9992833f, -1.9985665f, 0.9992833f, -1.9985464f, 0.9985867f}, {0.999321f, -1.998642f, 0.999321f, -1.9986218f, 0.9986621f}, {0.9993559f, -1.9987117f, 0.9993559f, -1.9986915f, 0.9987319f}, {0.9993882f, -1.9987764f, 0.9993882f, -1.9987562f, 0.9987965f}, {0.9994182f, -1.9988363f, 0.9994182f, -1.9988161f, 0.9988565f}, {0.999446f, -1.9988921f, 0.999446f, -1.9988719f, 0.9989122f}, {0.999472f, -1.9989439f, 0.999472f, -1.9989237f, 0.9989641f}, {0.9994961f, -1.9989923f, 0.9994961f, -1.9989721f, 0.9990125f}, {0.9995187f, -1.9990374f, 0.9995187f, -1.9990172f, 0.9990576f}, {0.9995398f, -1.9990796f, 0.9995398f, -1.9990594f, 0.9990998f}, {0.9995595f, -1.999119f, 0.9995595f, -1.9990989f, 0.9991392f}, {0.999578f, -1.999156f, 0.999578f, -1.9991358f, 0.9991762f}, {0.9995954f, -1.9991907f, 0.9995954f, -1.9991706f, 0.9992109f}, {0.9996121f, -1.9992241f, 0.9996121f, -1.9992039f, 0.9992443f}, {0.9996287f, -1.9992573f, 0.9996287f, -1.9992371f, 0.9992775f}, {0.9996451f, -1.9992902f, 0.9996451f, -1.99927f, 0.9993104f}, {0.9996613f, -1.9993227f, 0.9996613f, -1.9993025f, 0.9993429f}, {0.9996773f, -1.9993547f, 0.9996773f, -1.9993345f, 0.9993749f}, {0.999693f, -1.9993861f, 0.999693f, -1.9993659f, 0.9994063f}, {0.9997084f, -1.9994167f, 0.9997084f, -1.9993965f, 0.9994369f}, {0.9997233f, -1.9994466f, 0.9997233f, -1.9994264f, 0.9994668f}, {0.9997378f, -1.9994755f, 0.9997378f, -1.9994553f, 0.9994957f}, {0.9997518f, -1.9995035f, 0.9997518f, -1.9994833f, 0.9995237f}, {0.9997652f, -1.9995304f, 0.9997652f, -1.9995102f, 0.9995506f}, {0.9997781f, -1.9995563f, 0.9997781f, -1.9995361f, 0.9995765f}, {0.9997905f, -1.999581f, 0.9997905f, -1.9995608f, 0.9996012f}, {0.9998023f, -1.9996046f, 0.9998023f, -1.9995844f, 0.9996248f}, {0.9998135f, -1.9996271f, 0.9998135f, -1.9996069f, 0.9996473f}, {0.9998242f, -1.9996484f, 0.9998242f, -1.9996282f, 0.9996686f}, {0.9998343f, -1.9996686f, 0.9998343f, -1.9996484f, 0.9996888f}, {0.9998438f, -1.9996876f, 0.9998438f, -1.9996674f, 0.9997078f}, {0.9998528f, -1.9997056f, 0.9998528f, -1.9996854f, 0.9997258f}},
-      {{0.9929279f, -1.9858558f, 0.9929279f, -1.9858307f, 0.9858808f}, {0.9929822f, -1.9859644f, 0.9929822f, -1.9859394f, 0.9859895f}, {0.9931403f, -1.9862806f, 0.9931403f, -1.9862555f, 0.9863056f}, {0.9933885f, -1.986777f, 0.9933885f, -1.9867519f, 0.986802f}, {0.9937072f, -1.9874143f, 0.9937072f, -1.9873893f, 0.9874394f}, {0.9940743f, -1.9881487f, 0.9940743f, -1.9881236f, 0.9881737f}, {0.9944687f, -1.9889374f, 0.9944687f, -1.9889123f, 0.9889624f}, {0.9948719f, -1.9897437f, 0.9948719f, -1.9897186f, 0.9897688f}, {0.9952696f, -1.9905391f, 0.9952696f, -1.990514f, 0.9905642f}, {0.9956516f, -1.9913032f, 0.9956516f, -1.9912781f, 0.9913283f}, {0.9960114f, -1.9920228f, 0.9960114f, -1.9919977f, 0.9920479f}, {0.9963455f, -1.9926909f, 0.9963455f, -1.9926658f, 0.9927161f}, {0.9966524f, -1.9933047f, 0.9966524f, -1.9932796f, 0.9933299f}, {0.9969322f, -1.9938644f, 0.9969322f, -1.9938393f, 0.9938895f}, {0.9971861f, -1.9943721f, 0.9971861f, -1.994347f, 0.9943973f}, {0.9974156f, -1.9948312f, 0.9974156f, -1.994806f, 0.9948563f}, {0.9976227f, -1.9952454f, 0.9976227f, -1.9952202f, 0.9952706f}, {0.9978094f, -1.9956188f, 0.9978094f, -1.9955937f, 0.995644f}, {0.9979777f, -1.9959554f, 0.9979777f, -1.9959303f, 0.9959806f}, {0.9981295f, -1.996259f, 0.9981295f, -1.9962338f, 0.9962841f}, {0.9982665f, -1.9965329f, 0.9982665f, -1.9965078f, 0.9965581f}, {0.9983903f, -1.9967805f, 0.9983903f, -1.9967554f, 0.9968057f}, {0.9985023f, -1.9970046f, 0.9985023f, -1.9969794f, 0.9970298f}, {0.9986039f, -1.9972078f, 0.9986039f, -1.9971826f, 0.9972329f}, {0.9986961f, -1.9973922f, 0.9986961f, -1.9973671f, 0.9974174f}, {0.99878f, -1.9975601f, 0.99878f, -1.9975349f, 0.9975853f}, {0.9988565f, -1.9977131f, 0.9988565f, -1.9976879f, 0.9977383f}, {0.9989264f, -1.9978528f, 0.9989264f, -1.9978276f, 0.997878f}, {0.9989903f, -1.9979806f, 0.9989903f, -1.9979555f, 0.9980058f}, {0.9990489f, -1.9980978f, 0.9990489f, -1.9980726f, 0.998123f}, {0.9991027f, -1.9982055f, 0.9991027f, -1.9981803f, 0.9982306f}, {0.9991522f, -1.9983045f, 0.9991522f, -1.9982793f, 0.9983297f}, {0.9991979f, -1.9983957f, 0.9991979f, -1.9983706f, 0.9984209f}, {0.99924f, -1.99848f, 0.99924f, -1.9984548f, 0.9985052f}, {0.999279f, -1.998558f, 0.999279f, -1.9985328f, 0.9985832f}, {0.9993151f, -1.9986302f, 0.9993151f, -1.998605f, 0.9986554f}, {0.9993486f, -1.9986972f, 0.9993486f, -1.998672f, 0.9987224f}, {0.9993797f, -1.9987594f, 0.9993797f, -1.9987342f, 0.9987846f}, {0.9994087f, -1.9988174f, 0.9994087f, -1.9987922f, 0.9988426f}, {0.9994357f, -1.9988714f, 0.9994357f, -1.9988462f, 0.9988966f}, {0.9994609f, -1.9989218f, 0.9994609f, -1.9988966f, 0.998947f}, {0.9994845f, -1.9989689f, 0.9994845f, -1.9989437f, 0.9989941f}, {0.9995065f, -1.999013f, 0.9995065f, -1.9989878f, 0.9990382f}, {0.9995272f, -1.9990544f, 0.9995272f, -1.9990292f, 0.9990796f}, {0.9995466f, -1.9990931f, 0.9995466f, -1.9990679f, 0.9991183f}, {0.9995652f, -1.9991304f, 0.9995652f, -1.9991052f, 0.9991556f}, {0.9995838f, -1.9991675f, 0.9995838f, -1.9991423f, 0.9991927f}, {0.9996021f, -1.9992043f, 0.9996021f, -1.9991791f, 0.9992295f}, {0.9996203f, -1.9992406f, 0.9996203f, -1.9992154f, 0.9992658f}, {0.9996382f, -1.9992763f, 0.9996382f, -1.9992511f, 0.9993015f}, {0.9996557f, -1.9993114f, 0.9996557f, -1.9992862f, 0.9993366f}, {0.9996728f, -1.9993456f, 0.9996728f, -1.9993204f, 0.9993708f}, {0.9996895f, -1.999379f, 0.9996895f, -1.9993538f, 0.9994042f}, {0.9997057f, -1.9994113f, 0.9997057f, -1.9993861f, 0.9994365f}, {0.9997213f, -1.9994426f, 0.9997213f, -1.9994174f, 0.9994678f}, {0.9997363f, -1.9994727f, 0.9997363f, -1.9994475f, 0.9994979f}, {0.9997508f, -1.9995016f, 0.9997508f, -1.9994764f, 0.9995268f}, {0.9997646f, -1.9995292f, 0.9997646f, -1.999504f, 0.9995544f}, {0.9997778f, -1.9995556f, 0.9997778f, -1.9995304f, 0.9995808f}, {0.9997903f, -1.9995807f, 0.9997903f, -1.9995555f, 0.9996059f}, {0.9998022f, -1.9996045f, 0.9998022f, -1.9995793f, 0.9996297f}, {0.9998135f, -1.999627f, 0.9998135f, -1.9996018f, 0.9996522f}, {0.9998242f, -1.9996483f, 0.9998242f, -1.9996231f, 0.9996735f}, {0.9998342f, -1.9996684f, 0.9998342f, -1.9996432f, 0.9996936f}},
-      {{0.9921025f, -1.9842049f, 0.9921025f, -1.9841737f, 0.9842361f}, {0.9921631f, -1.9843261f, 0.9921631f, -1.9842949f, 0.9843573f}, {0.9923394f, -1.9846788f, 0.9923394f, -1.9846476f, 0.9847101f}, {0.9926163f, -1.9852326f, 0.9926163f, -1.9852014f, 0.9852638f}, {0.9929719f, -1.9859437f, 0.9929719f, -1.9859125f, 0.985975f}, {0.9933816f, -1.9867631f, 0.9933816f, -1.9867319f, 0.9867944f}, {0.9938216f, -1.9876432f, 0.9938216f, -1.9876119f, 0.9876745f}, {0.9942716f, -1.9885431f, 0.9942716f, -1.9885118f, 0.9885744f}, {0.9947154f, -1.9894309f, 0.9947154f, -1.9893996f, 0.9894622f}, {0.9951419f, -1.9902837f, 0.9951419f, -1.9902524f, 0.990315f}, {0.9955435f, -1.9910871f, 0.9955435f, -1.9910558f, 0.9911184f}, {0.9959165f, -1.991833f, 0.9959165f, -1.9918016f, 0.9918643f}, {0.9962591f, -1.9925183f, 0.9962591f, -1.9924869f, 0.9925496f}, {0.9965716f, -1.9931432f, 0.9965716f, -1.9931118f, 0.9931746f}, {0.9968551f, -1.9937101f, 0.9968551f, -1.9936788f, 0.9937415f}, {0.9971114f, -1.9942228f, 0.9971114f, -1.9941914f, 0.9942541f}, {0.9973427f, -1.9946853f, 0.9973427f, -1.994654f, 0.9947167f}, {0.9975512f, -1.9951024f, 0.9975512f, -1.995071f, 0.9951338f}, {0.9977392f, -1.9954783f, 0.9977392f, -1.9954469f, 0.9955097f}, {0.9979087f, -1.9958173f, 0.9979087f, -1.9957859f, 0.9958487f}, {0.9980617f, -1.9961234f, 0.9980617f, -1.9960919f, 0.9961548f}, {0.9982f, -1.9963999f, 0.9982f, -1.9963685f, 0.9964313f}, {0.9983251f, -1.9966502f, 0.9983251f, -1.9966188f, 0.9966816f}, {0.9984386f, -1.9968771f, 0.9984386f, -1.9968457f, 0.9969086f}, {0.9985416f, -1.9970832f, 0.9985416f, -1.9970518f, 0.9971146f}, {0.9986354f, -1.9972707f, 0.9986354f, -1.9972393f, 0.9973021f}, {0.9987208f, -1.9974416f, 0.9987208f, -1.9974102f, 0.9974731f}, {0.9987989f, -1.9975977f, 0.9987989f, -1.9975663f, 0.9976291f}, {0.9988703f, -1.9977405f, 0.9988703f, -1.9977091f, 0.997772f}, {0.9989357f, -1.9978714f, 0.9989357f, -1.99784f, 0.9979029f}, {0.9989958f, -1.9979917f, 0.9989958f, -1.9979602f, 0.9980231f}, {0.9990511f, -1.9981023f, 0.9990511f, -1.9980709f, 0.9981337f}, {0.9991021f, -1.9982043f, 0.9991021f, -1.9981728f, 0.9982357f}, {0.9991492f, -1.9982984f, 0.9991492f, -1.998267f, 0.9983299f}, {0.9991927f, -1.9983855f, 0.9991927f, -1.998354f, 0.9984169f}, {0.9992331f, -1.9984662f, 0.9992331f, -1.9984347f, 0.9984976f}, {0.9992705f, -1.998541f, 0.9992705f, -1.9985096f, 0.9985725f}, {0.9993053f, -1.9986106f, 0.9993053f, -1.9985791f, 0.998642f}, {0.9993377f, -1.9986753f, 0.9993377f, -1.9986439f, 0.9987068f}, {0.9993678f, -1.9987357f, 0.9993678f, -1.9987042f, 0.9987671f}, {0.999396f, -1.998792f, 0.999396f, -1.9987605f, 0.9988234f}, {0.9994223f, -1.9988446f, 0.9994223f, -1.9988132f, 0.9988761f}, {0.999447f, -1.9988939f, 0.999447f, -1.9988625f, 0.9989254f}, {0.99947f, -1.9989401f, 0.99947f, -1.9989086f, 0.9989716f}, {0.9994917f, -1.9989834f, 0.9994917f, -1.998952f, 0.9990149f}, {0.9995125f, -1.9990251f, 0.9995125f, -1.9989936f, 0.9990565f}, {0.9995333f, -1.9990665f, 0.9995333f, -1.9990351f, 0.999098f}, {0.9995538f, -1.9991076f, 0.9995538f, -1.9990761f, 0.999139f}, {0.9995741f, -1.9991481f, 0.9995741f, -1.9991167f, 0.9991796f}, {0.999594f, -1.9991881f, 0.999594f, -1.9991566f, 0.9992195f}, {0.9996136f, -1.9992273f, 0.9996136f, -1.9991958f, 0.9992587f}, {0.9996328f, -1.9992655f, 0.9996328f, -1.9992341f, 0.999297f}, {0.9996514f, -1.9993028f, 0.9996514f, -1.9992713f, 0.9993343f}, {0.9996695f, -1.9993389f, 0.9996695f, -1.9993075f, 0.9993704f}, {0.9996869f, -1.9993739f, 0.9996869f, -1.9993424f, 0.9994053f}, {0.9997037f, -1.9994075f, 0.9997037f, -1.999376f, 0.999439f}, {0.9997199f, -1.9994398f, 0.9997199f, -1.9994083f, 0.9994712f}, {0.9997353f, -1.9994707f, 0.9997353f, -1.9994392f, 0.9995021f}, {0.9997501f, -1.9995001f, 0.9997501f, -1.9994687f, 0.9995316f}, {0.9997641f, -1.9995282f, 0.9997641f, -1.9994967f, 0.9995596f}, {0.9997774f, -1.9995548f, 0.9997774f, -1.9995233f, 0.9995862f}, {0.99979f, -1.9995799f, 0.99979f, -1.9995485f, 0.9996114f}, {0.9998019f, -1.9996037f, 0.9998019f, -1.9995723f, 0.9996352f}, {0.9998131f, -1.9996262f, 0.9998131f, -1.9995947f, 0.9996576f}},
-      {{0.9911812f, -1.9823623f, 0.9911812f, -1.9823234f, 0.9824013f}, {0.9912488f, -1.9824975f, 0.9912488f, -1.9824586f, 0.9825365f}, {0.9914455f, -1.9828909f, 0.9914455f, -1.982852f, 0.9829299f}, {0.9917543f, -1.9835087f, 0.9917543f, -1.9834697f, 0.9835476f}, {0.992151f, -1.984302f, 0.992151f, -1.984263f, 0.9843409f}, {0.992608f, -1.9852161f, 0.992608f, -1.9851771f, 0.9852551f}, {0.993099f, -1.9861981f, 0.993099f, -1.986159f, 0.9862371f}, {0.9936011f, -1.9872022f, 0.9936011f, -1.9871632f, 0.9872413f}, {0.9940965f, -1.988193f, 0.9940965f, -1.9881539f, 0.988232f}, {0.9945724f, -1.9891448f, 0.9945724f, -1.9891058f, 0.9891839f}, {0.9950208f, -1.9900416f, 0.9950208f, -1.9900025f, 0.9900806f}, {0.9954371f, -1.9908742f, 0.9954371f, -1.9908351f, 0.9909133f}, {0.9958196f, -1.9916393f, 0.9958196f, -1.9916001f, 0.9916784f}, {0.9961685f, -1.992337f, 0.9961685f, -1.9922978f, 0.9923761f}, {0.996485f, -1.99297f, 0.996485f, -1.9929309f, 0.9930091f}, {0.9967712f, -1.9935424f, 0.9967712f, -1.9935033f, 0.9935816f}, {0.9970295f, -1.994059f, 0.9970295f, -1.9940198f, 0.9940982f}, {0.9972624f, -1.9945247f, 0.9972624f, -1.9944856f, 0.9945639f}, {0.9974723f, -1.9949446f, 0.9974723f, -1.9949054f, 0.9949838f}, {0.9976616f, -1.9953232f, 0.9976616f, -1.995284f, 0.9953624f}, {0.9978325f, -1.995665f, 0.9978325f, -1.9956258f, 0.9957042f}, {0.9979869f, -1.9959739f, 0.9979869f, -1.9959347f, 0.9960131f}, {0.9981267f, -1.9962535f, 0.9981267f, -1.9962143f, 0.9962927f}, {0.9982535f, -1.9965069f, 0.9982535f, -1.9964677f, 0.9965462f}, {0.9983686f, -1.9967371f, 0.9983686f, -1.9966979f, 0.9967764f}, {0.9984733f, -1.9969466f, 0.9984733f, -1.9969074f, 0.9969858f}, {0.9985688f, -1.9971375f, 0.9985688f, -1.9970983f, 0.9971767f}, {0.9986559f, -1.9973119f, 0.9986559f, -1.9972726f, 0.9973511f}, {0.9987357f, -1.9974714f, 0.9987357f, -1.9974322f, 0.9975106f}, {0.9988088f, -1.9976177f, 0.9988088f, -1.9975784f, 0.9976569f}, {0.998876f, -1.997752f, 0.998876f, -1.9977127f, 0.9977912f}, {0.9989378f, -1.9978756f, 0.9989378f, -1.9978363f, 0.9979148f}, {0.9989947f, -1.9979895f, 0.9989947f, -1.9979502f, 0.9980287f}, {0.9990473f, -1.9980947f, 0.9990473f, -1.9980554f, 0.9981339f}, {0.999096f, -1.998192f, 0.999096f, -1.9981527f, 0.9982312f}, {0.999141f, -1.9982821f, 0.999141f, -1.9982428f, 0.9983213f}, {0.9991829f, -1.9983657f, 0.9991829f, -1.9983265f, 0.998405f}, {0.9992217f, -1.9984434f, 0.9992217f, -1.9984042f, 0.9984827f}, {0.9992579f, -1.9985158f, 0.9992579f, -1.9984765f, 0.998555f}, {0.9992916f, -1.9985832f, 0.9992916f, -1.9985439f, 0.9986224f}, {0.9993231f, -1.9986461f, 0.9993231f, -1.9986069f, 0.9986854f}, {0.9993525f, -1.9987049f, 0.9993525f, -1.9986657f, 0.9987442f}, {0.99938f, -1.99876f, 0.99938f, -1.9987207f, 0.9987993f}, {0.9994058f, -1.9988116f, 0.9994058f, -1.9987723f, 0.9988509f}, {0.99943f, -1.99886f, 0.99943f, -1.9988207f, 0.9988993f}, {0.9994533f, -1.9989066f, 0.9994533f, -1.9988673f, 0.9989458f}, {0.9994764f, -1.9989528f, 0.9994764f, -1.9989136f, 0.9989921f}, {0.9994994f, -1.9989987f, 0.9994994f, -1.9989594f, 0.999038f}, {0.999522f, -1.999044f, 0.999522f, -1.9990048f, 0.9990833f}, {0.9995443f, -1.9990887f, 0.9995443f, -1.9990494f, 0.9991279f}, {0.9995662f, -1.9991324f, 0.9995662f, -1.9990932f, 0.9991717f}, {0.9995876f, -1.9991752f, 0.9995876f, -1.9991359f, 0.9992145f}, {0.9996084f, -1.9992168f, 0.9996084f, -1.9991776f, 0.9992561f}, {0.9996286f, -1.9992572f, 0.9996286f, -1.999218f, 0.9992965f}, {0.9996481f, -1.9992962f, 0.9996481f, -1.999257f, 0.9993355f}, {0.9996669f, -1.9993338f, 0.9996669f, -1.9992946f, 0.9993731f}, {0.9996849f, -1.9993699f, 0.9996849f, -1.9993306f, 0.9994092f}, {0.9997022f, -1.9994044f, 0.9997022f, -1.9993651f, 0.9994437f}, {0.9997187f, -1.9994373f, 0.9997187f, -1.9993981f, 0.9994766f}, {0.9997343f, -1.9994686f, 0.9997343f, -1.9994294f, 0.9995079f}, {0.9997492f, -1.9994984f, 0.9997492f, -1.9994591f, 0.9995376f}, {0.9997632f, -1.9995265f, 0.9997632f, -1.9994872f, 0.9995658f}, {0.9997765f, -1.9995531f, 0.9997765f, -1.9995138f, 0.9995924f}, {0.9997891f, -1.9995781f, 0.9997891f, -1.9995389f, 0.9996174f}},
-      {{0.990153f, -1.9803061f, 0.990153f, -1.9802575f, 0.9803546f}, {0.9902284f, -1.9804568f, 0.9902284f, -1.9804083f, 0.9805054f}, {0.9904478f, -1.9808955f, 0.9904478f, -1.980847f, 0.9809441f}, {0.9907922f, -1.9815844f, 0.9907922f, -1.9815359f, 0.981633f}, {0.9912346f, -1.9824693f, 0.9912346f, -1.9824207f, 0.9825179f}, {0.9917445f, -1.9834889f, 0.9917445f, -1.9834403f, 0.9835375f}, {0.9922922f, -1.9845844f, 0.9922922f, -1.9845357f, 0.984633f}, {0.9928524f, -1.9857048f, 0.9928524f, -1.9856561f, 0.9857534f}, {0.9934051f, -1.9868102f, 0.9934051f, -1.9867615f, 0.986859f}, {0.9939362f, -1.9878725f, 0.9939362f, -1.9878237f, 0.9879212f}, {0.9944367f, -1.9888733f, 0.9944367f, -1.9888245f, 0.9889221f}, {0.9949014f, -1.9898027f, 0.9949014f, -1.9897539f, 0.9898515f}, {0.9953284f, -1.9906567f, 0.9953284f, -1.9906079f, 0.9907055f}, {0.9957178f, -1.9914357f, 0.9957178f, -1.9913868f, 0.9914845f}, {0.9960712f, -1.9921424f, 0.9960712f, -1.9920936f, 0.9921913f}, {0.9963908f, -1.9927816f, 0.9963908f, -1.9927327f, 0.9928304f}, {0.9966792f, -1.9933584f, 0.9966792f, -1.9933095f, 0.9934073f}, {0.9969392f, -1.9938785f, 0.9969392f, -1.9938296f, 0.9939274f}, {0.9971737f, -1.9943473f, 0.9971737f, -1.9942985f, 0.9943962f}, {0.9973851f, -1.9947702f, 0.9973851f, -1.9947213f, 0.9948191f}, {0.997576f, -1.9951519f, 0.997576f, -1.995103f, 0.9952009f}, {0.9977485f, -1.995497f, 0.9977485f, -1.995448f, 0.9955459f}, {0.9979046f, -1.9958092f, 0.9979046f, -1.9957603f, 0.9958582f}, {0.9980462f, -1.9960924f, 0.9980462f, -1.9960434f, 0.9961413f}, {0.9981747f, -1.9963495f, 0.9981747f, -1.9963005f, 0.9963984f}, {0.9982917f, -1.9965834f, 0.9982917f, -1.9965345f, 0.9966324f}, {0.9983984f, -1.9967967f, 0.9983984f, -1.9967477f, 0.9968457f}, {0.9984957f, -1.9969915f, 0.9984957f, -1.9969425f, 0.9970404f}, {0.9985849f, -1.9971697f, 0.9985849f, -1.9971207f, 0.9972187f}, {0.9986665f, -1.9973331f, 0.9986665f, -1.9972841f, 0.9973821f}, {0.9987416f, -1.9974831f, 0.9987416f, -1.9974342f, 0.9975321f}, {0.9988106f, -1.9976212f, 0.9988106f, -1.9975722f, 0.9976702f}, {0.9988742f, -1.9977485f, 0.9988742f, -1.9976995f, 0.9977975f}, {0.998933f, -1.997866f, 0.998933f, -1.997817f, 0.997915f}, {0.9989873f, -1.9979747f, 0.9989873f, -1.9979257f, 0.9980237f}, {0.9990377f, -1.9980754f, 0.9990377f, -1.9980264f, 0.9981244f}, {0.9990844f, -1.9981688f, 0.9990844f, -1.9981198f, 0.9982178f}, {0.9991278f, -1.9982556f, 0.9991278f, -1.9982066f, 0.9983046f}, {0.9991682f, -1.9983364f, 0.9991682f, -1.9982874f, 0.9983854f}, {0.9992059f, -1.9984118f, 0.9992059f, -1.9983628f, 0.9984608f}, {0.999241f, -1.9984821f, 0.999241f, -1.9984331f, 0.9985311f}, {0.9992739f, -1.9985478f, 0.9992739f, -1.9984988f, 0.9985968f}, {0.9993047f, -1.9986093f, 0.9993047f, -1.9985603f, 0.9986583f}, {0.9993335f, -1.998667f, 0.9993335f, -1.998618f, 0.998716f}, {0.9993605f, -1.9987211f, 0.9993605f, -1.9986721f, 0.9987701f}, {0.9993865f, -1.9987731f, 0.9993865f, -1.9987241f, 0.9988221f}, {0.9994124f, -1.9988248f, 0.9994124f, -1.9987758f, 0.9988738f}, {0.999438f, -1.998876f, 0.999438f, -1.998827f, 0.998925f}, {0.9994633f, -1.9989267f, 0.9994633f, -1.9988777f, 0.9989757f}, {0.9994883f, -1.9989765f, 0.9994883f, -1.9989275f, 0.9990255f}, {0.9995127f, -1.9990254f, 0.9995127f, -1.9989764f, 0.9990745f}, {0.9995366f, -1.9990732f, 0.9995366f, -1.9990242f, 0.9991222f}, {0.9995599f, -1.9991198f, 0.9995599f, -1.9990707f, 0.9991688f}, {0.9995824f, -1.9991649f, 0.9995824f, -1.9991159f, 0.9992139f}, {0.9996042f, -1.9992085f, 0.9996042f, -1.9991595f, 0.9992575f}, {0.9996252f, -1.9992505f, 0.9996252f, -1.9992015f, 0.9992995f}, {0.9996454f, -1.9992908f, 0.9996454f, -1.9992418f, 0.9993398f}, {0.9996647f, -1.9993293f, 0.9996647f, -1.9992803f, 0.9993784f}, {0.9996831f, -1.9993661f, 0.9996831f, -1.9993171f, 0.9994151f}, {0.9997006f, -1.9994011f, 0.9997006f, -1.9993521f, 0.9994501f}, {0.9997172f, -1.9994343f, 0.9997172f, -1.9993853f, 0.9994833f}, {0.9997329f, -1.9994658f, 0.9997329f, -1.9994167f, 0.9995148f}, {0.9997477f, -1.9994955f, 0.9997477f, -1.9994464f, 0.9995445f}, {0.9997617f, -1.9995235f, 0.9997617f, -1.9994745f, 0.9995725f}},
-      {{0.9890058f, -1.9780116f, 0.9890058f, -1.977951f, 0.9780721f}, {0.9890898f, -1.9781797f, 0.9890898f, -1.9781191f, 0.9782402f}, {0.9893344f, -1.9786688f, 0.9893344f, -1.9786082f, 0.9787294f}, {0.9897185f, -1.9794369f, 0.9897185f, -1.9793764f, 0.9794975f}, {0.9902118f, -1.9804236f, 0.9902118f, -1.980363f, 0.9804842f}, {0.9907804f, -1.9815608f, 0.9907804f, -1.9815001f, 0.9816214f}, {0.9913913f, -1.9827826f, 0.9913913f, -1.982722f, 0.9828433f}, {0.9920162f, -1.9840324f, 0.9920162f, -1.9839717f, 0.9840932f}, {0.9926329f, -1.9852658f, 0.9926329f, -1.985205f, 0.9853266f}, {0.9932255f, -1.9864511f, 0.9932255f, -1.9863903f, 0.9865119f}, {0.993784f, -1.9875679f, 0.993784f, -1.9875071f, 0.9876288f}, {0.9943026f, -1.9886052f, 0.9943026f, -1.9885444f, 0.9886661f}, {0.9947792f, -1.9895585f, 0.9947792f, -1.9894976f, 0.9896194f}, {0.995214f, -1.990428f, 0.995214f, -1.9903671f, 0.9904889f}, {0.9956085f, -1.991217f, 0.9956085f, -1.9911561f, 0.991278f}, {0.9959653f, -1.9919306f, 0.9959653f, -1.9918696f, 0.9919916f}, {0.9962873f, -1.9925747f, 0.9962873f, -1.9925137f, 0.9926356f}, {0.9965777f, -1.9931554f, 0.9965777f, -1.9930944f, 0.9932164f}, {0.9968395f, -1.993679f, 0.9968395f, -1.993618f, 0.99374f}, {0.9970756f, -1.9941512f, 0.9970756f, -1.9940902f, 0.9942123f}, {0.9972888f, -1.9945776f, 0.9972888f, -1.9945165f, 0.9946386f}, {0.9974814f, -1.9949629f, 0.9974814f, -1.9949018f, 0.9950239f}, {0.9976558f, -1.9953117f, 0.9976558f, -1.9952506f, 0.9953727f}, {0.997814f, -1.9956279f, 0.997814f, -1.9955668f, 0.995689f}, {0.9979576f, -1.9959151f, 0.9979576f, -1.995854f, 0.9959762f}, {0.9980882f, -1.9961764f, 0.9980882f, -1.9961153f, 0.9962375f}, {0.9982073f, -1.9964147f, 0.9982073f, -1.9963536f, 0.9964758f}, {0.9983161f, -1.9966322f, 0.9983161f, -1.9965711f, 0.9966933f}, {0.9984157f, -1.9968313f, 0.9984157f, -1.9967702f, 0.9968924f}, {0.9985069f, -1.9970139f, 0.9985069f, -1.9969527f, 0.997075f}, {0.9985907f, -1.9971815f, 0.9985907f, -1.9971204f, 0.9972426f}, {0.9986679f, -1.9973357f, 0.9986679f, -1.9972746f, 0.9973969f}, {0.998739f, -1.9974779f, 0.998739f, -1.9974168f, 0.997539f}, {0.9988046f, -1.9976092f, 0.9988046f, -1.9975481f, 0.9976703f}, {0.9988653f, -1.9977306f, 0.9988653f, -1.9976695f, 0.9977917f}, {0.9989216f, -1.9978431f, 0.9989216f, -1.997782f, 0.9979042f}, {0.9989737f, -1.9979475f, 0.9989737f, -1.9978863f, 0.9980086f}, {0.9990222f, -1.9980445f, 0.9990222f, -1.9979833f, 0.9981056f}, {0.9990674f, -1.9981348f, 0.9990674f, -1.9980736f, 0.9981959f}, {0.9991095f, -1.998219f, 0.9991095f, -1.9981578f, 0.9982801f}, {0.9991488f, -1.9982975f, 0.9991488f, -1.9982364f, 0.9983587f}, {0.9991855f, -1.9983709f, 0.9991855f, -1.9983098f, 0.9984321f}, {0.9992198f, -1.9984397f, 0.9992198f, -1.9983785f, 0.9985008f}, {0.999252f, -1.9985041f, 0.999252f, -1.9984429f, 0.9985652f}, {0.9992823f, -1.9985645f, 0.9992823f, -1.9985033f, 0.9986257f}, {0.9993113f, -1.9986226f, 0.9993113f, -1.9985615f, 0.9986838f}, {0.9993402f, -1.9986804f, 0.9993402f, -1.9986192f, 0.9987416f}, {0.9993688f, -1.9987377f, 0.9993688f, -1.9986765f, 0.9987988f}, {0.9993971f, -1.9987943f, 0.9993971f, -1.9987331f, 0.9988554f}, {0.999425f, -1.99885f, 0.999425f, -1.9987888f, 0.9989111f}, {0.9994523f, -1.9989046f, 0.9994523f, -1.9988434f, 0.9989658f}, {0.999479f, -1.998958f, 0.999479f, -1.9988968f, 0.9990192f}, {0.999505f, -1.99901f, 0.999505f, -1.9989488f, 0.9990712f}, {0.9995302f, -1.9990604f, 0.9995302f, -1.9989992f, 0.9991216f}, {0.9995546f, -1.9991091f, 0.9995546f, -1.999048f, 0.9991703f}, {0.999578f, -1.9991561f, 0.999578f, -1.9990949f, 0.9992172f}, {0.9996005f, -1.9992011f, 0.9996005f, -1.9991399f, 0.9992623f}, {0.9996221f, -1.9992442f, 0.9996221f, -1.999183f, 0.9993054f}, {0.9996426f, -1.9992853f, 0.9996426f, -1.9992241f, 0.9993465f}, {0.9996622f, -1.9993244f, 0.9996622f, -1.9992632f, 0.9993856f}, {0.9996807f, -1.9993615f, 0.9996807f, -1.9993003f, 0.9994227f}, {0.9996983f, -1.9993966f, 0.9996983f, -1.9993354f, 0.9994578f}, {0.9997149f, -1.9994298f, 0.9997149f, -1.9993686f, 0.999491f}, {0.9997306f, -1.9994611f, 0.9997306f, -1.9993999f, 0.9995223f}},
-      {{0.9877258f, -1.9754517f, 0.9877258f, -1.9753762f, 0.9755271f}, {0.9878195f, -1.975639f, 0.9878195f, -1.9755635f, 0.9757145f}, {0.9880921f, -1.9761842f, 0.9880921f, -1.9761088f, 0.9762597f}, {0.9885203f, -1.9770405f, 0.9885203f, -1.976965f, 0.9771161f}, {0.9890703f, -1.9781405f, 0.9890703f, -1.978065f, 0.9782161f}, {0.9897042f, -1.9794085f, 0.9897042f, -1.9793329f, 0.9794841f}, {0.9903855f, -1.9807711f, 0.9903855f, -1.9806954f, 0.9808467f}, {0.9910825f, -1.982165f, 0.9910825f, -1.9820893f, 0.9822407f}, {0.9917704f, -1.9835408f, 0.9917704f, -1.983465f, 0.9836166f}, {0.9924316f, -1.9848631f, 0.9924316f, -1.9847873f, 0.9849389f}, {0.9930547f, -1.9861093f, 0.9930547f, -1.9860334f, 0.9861852f}, {0.9936334f, -1.9872669f, 0.9936334f, -1.9871909f, 0.9873428f}, {0.9941654f, -1.9883308f, 0.9941654f, -1.9882548f, 0.9884067f}, {0.9946507f, -1.9893013f, 0.9946507f, -1.9892253f, 0.9893773f}, {0.995091f, -1.9901821f, 0.995091f, -1.9901061f, 0.9902581f}, {0.9954894f, -1.9909787f, 0.9954894f, -1.9909027f, 0.9910548f}, {0.9958489f, -1.9916978f, 0.9958489f, -1.9916217f, 0.9917739f}, {0.9961731f, -1.9923463f, 0.9961731f, -1.9922702f, 0.9924224f}, {0.9964655f, -1.9929309f, 0.9964655f, -1.9928548f, 0.993007f}, {0.9967291f, -1.9934583f, 0.9967291f, -1.9933821f, 0.9935344f}, {0.9969672f, -1.9939344f, 0.9969672f, -1.9938582f, 0.9940105f}, {0.9971823f, -1.9943647f, 0.9971823f, -1.9942885f, 0.9944409f}, {0.9973771f, -1.9947542f, 0.9973771f, -1.994678f, 0.9948304f}, {0.9975537f, -1.9951074f, 0.9975537f, -1.9950312f, 0.9951837f}, {0.9977141f, -1.9954282f, 0.9977141f, -1.995352f, 0.9955045f}, {0.9978601f, -1.9957201f, 0.9978601f, -1.9956439f, 0.9957964f}, {0.9979931f, -1.9959862f, 0.9979931f, -1.99591f, 0.9960625f}, {0.9981146f, -1.9962293f, 0.9981146f, -1.996153f, 0.9963055f}, {0.9982258f, -1.9964517f, 0.9982258f, -1.9963754f, 0.9965279f}, {0.9983278f, -1.9966556f, 0.9983278f, -1.9965793f, 0.9967318f}, {0.9984214f, -1.9968428f, 0.9984214f, -1.9967666f, 0.9969191f}, {0.9985076f, -1.9970151f, 0.9985076f, -1.9969389f, 0.9970914f}, {0.998587f, -1.997174f, 0.998587f, -1.9970977f, 0.9972503f}, {0.9986603f, -1.9973206f, 0.9986603f, -1.9972443f, 0.9973969f}, {0.9987281f, -1.9974563f, 0.9987281f, -1.99738f, 0.9975326f}, {0.998791f, -1.997582f, 0.998791f, -1.9975057f, 0.9976583f}, {0.9988493f, -1.9976986f, 0.9988493f, -1.9976223f, 0.9977749f}, {0.9989035f, -1.997807f, 0.9989035f, -1.9977307f, 0.9978833f}, {0.9989539f, -1.9979079f, 0.9989539f, -1.9978315f, 0.9979842f}, {0.9990009f, -1.9980019f, 0.9990009f, -1.9979256f, 0.9980782f}, {0.9990448f, -1.9980897f, 0.9990448f, -1.9980133f, 0.998166f}, {0.9990859f, -1.9981717f, 0.9990859f, -1.9980954f, 0.998248f}, {0.9991242f, -1.9982485f, 0.9991242f, -1.9981722f, 0.9983248f}, {0.9991602f, -1.9983205f, 0.9991602f, -1.9982441f, 0.9983968f}, {0.999194f, -1.998388f, 0.999194f, -1.9983116f, 0.9984643f}, {0.9992265f, -1.9984529f, 0.9992265f, -1.9983766f, 0.9985293f}, {0.9992587f, -1.9985175f, 0.9992587f, -1.9984411f, 0.9985938f}, {0.9992907f, -1.9985814f, 0.9992907f, -1.9985051f, 0.9986578f}, {0.9993223f, -1.9986447f, 0.9993223f, -1.9985683f, 0.998721f}, {0.9993535f, -1.9987069f, 0.9993535f, -1.9986306f, 0.9987833f}, {0.999384f, -1.998768f, 0.999384f, -1.9986916f, 0.9988443f}, {0.9994138f, -1.9988276f, 0.9994138f, -1.9987513f, 0.998904f}, {0.9994429f, -1.9988857f, 0.9994429f, -1.9988094f, 0.9989621f}, {0.999471f, -1.9989421f, 0.999471f, -1.9988657f, 0.9990184f}, {0.9994983f, -1.9989965f, 0.9994983f, -1.9989201f, 0.9990729f}, {0.9995245f, -1.9990489f, 0.9995245f, -1.9989726f, 0.9991253f}, {0.9995496f, -1.9990993f, 0.9995496f, -1.9990229f, 0.9991756f}, {0.9995737f, -1.9991474f, 0.9995737f, -1.999071f, 0.9992238f}, {0.9995967f, -1.9991933f, 0.9995967f, -1.999117f, 0.9992697f}, {0.9996185f, -1.999237f, 0.9996185f, -1.9991606f, 0.9993134f}, {0.9996392f, -1.9992785f, 0.9996392f, -1.9992021f, 0.9993549f}, {0.9996589f, -1.9993177f, 0.9996589f, -1.9992414f, 0.9993941f}, {0.9996774f, -1.9993548f, 0.9996774f, -1.9992784f, 0.9994312f}, {0.9996949f, -1.9993898f, 0.9996949f, -1.9993134f, 0.9994662f}},
-      {{0.986298f, -1.9725961f, 0.986298f, -1.972502f, 0.9726901f}, {0.9864024f, -1.9728049f, 0.9864024f, -1.9727108f, 0.9728989f}, {0.9867062f, -1.9734125f, 0.9867062f, -1.9733184f, 0.9735066f}, {0.9871834f, -1.9743667f, 0.9871834f, -1.9742726f, 0.9744609f}, {0.9877964f, -1.9755928f, 0.9877964f, -1.9754986f, 0.975687f}, {0.9885031f, -1.9770062f, 0.9885031f, -1.976912f, 0.9771005f}, {0.9892627f, -1.9785254f, 0.9892627f, -1.978431f, 0.9786197f}, {0.9900399f, -1.9800798f, 0.9900399f, -1.9799854f, 0.9801742f}, {0.9908071f, -1.9816142f, 0.9908071f, -1.9815197f, 0.9817087f}, {0.9915446f, -1.9830892f, 0.9915446f, -1.9829946f, 0.9831837f}, {0.9922397f, -1.9844795f, 0.9922397f, -1.9843848f, 0.9845741f}, {0.9928855f, -1.985771f, 0.9928855f, -1.9856763f, 0.9858657f}, {0.9934791f, -1.9869583f, 0.9934791f, -1.9868635f, 0.987053f}, {0.9940207f, -1.9880414f, 0.9940207f, -1.9879466f, 0.9881362f}, {0.9945123f, -1.9890246f, 0.9945123f, -1.9889297f, 0.9891194f}, {0.9949569f, -1.9899138f, 0.9949569f, -1.989819f, 0.9900087f}, {0.9953583f, -1.9907166f, 0.9953583f, -1.9906217f, 0.9908115f}, {0.9957203f, -1.9914406f, 0.9957203f, -1.9913456f, 0.9915356f}, {0.9960467f, -1.9920934f, 0.9960467f, -1.9919984f, 0.9921884f}, {0.9963411f, -1.9926823f, 0.9963411f, -1.9925872f, 0.9927773f}, {0.996607f, -1.9932139f, 0.996607f, -1.9931189f, 0.993309f}, {0.9968472f, -1.9936945f, 0.9968472f, -1.9935994f, 0.9937896f}, {0.9970648f, -1.9941295f, 0.9970648f, -1.9940345f, 0.9942246f}, {0.997262f, -1.994524f, 0.997262f, -1.9944289f, 0.9946191f}, {0.9974412f, -1.9948823f, 0.9974412f, -1.9947872f, 0.9949774f}, {0.9976042f, -1.9952083f, 0.9976042f, -1.9951132f, 0.9953035f}, {0.9977528f, -1.9955056f, 0.9977528f, -1.9954104f, 0.9956007f}, {0.9978885f, -1.9957771f, 0.9978885f, -1.9956819f, 0.9958722f}, {0.9980127f, -1.9960255f, 0.9980127f, -1.9959303f, 0.9961207f}, {0.9981266f, -1.9962533f, 0.9981266f, -1.9961581f, 0.9963484f}, {0.9982312f, -1.9964624f, 0.9982312f, -1.9963672f, 0.9965576f}, {0.9983275f, -1.9966549f, 0.9983275f, -1.9965597f, 0.9967502f}, {0.9984162f, -1.9968324f, 0.9984162f, -1.9967372f, 0.9969276f}, {0.9984981f, -1.9969962f, 0.9984981f, -1.996901f, 0.9970915f}, {0.9985739f, -1.9971478f, 0.9985739f, -1.9970525f, 0.997243f}, {0.9986441f, -1.9972882f, 0.9986441f, -1.9971929f, 0.9973834f}, {0.9987092f, -1.9974185f, 0.9987092f, -1.9973232f, 0.9975137f}, {0.9987698f, -1.9975396f, 0.9987698f, -1.9974443f, 0.9976348f}, {0.9988261f, -1.9976523f, 0.9988261f, -1.997557f, 0.9977475f}, {0.9988787f, -1.9977573f, 0.9988787f, -1.9976621f, 0.9978526f}, {0.9989277f, -1.9978554f, 0.9989277f, -1.9977601f, 0.9979507f}, {0.9989735f, -1.9979471f, 0.9989735f, -1.9978518f, 0.9980423f}, {0.9990164f, -1.9980329f, 0.9990164f, -1.9979376f, 0.9981281f}, {0.9990566f, -1.9981133f, 0.9990566f, -1.998018f, 0.9982085f}, {0.9990944f, -1.9981887f, 0.9990944f, -1.9980934f, 0.998284f}, {0.9991306f, -1.9982613f, 0.9991306f, -1.998166f, 0.9983565f}, {0.9991667f, -1.9983334f, 0.9991667f, -1.9982381f, 0.9984287f}, {0.9992024f, -1.9984049f, 0.9992024f, -1.9983096f, 0.9985002f}, {0.9992378f, -1.9984755f, 0.9992378f, -1.9983802f, 0.9985708f}, {0.9992725f, -1.9985451f, 0.9992725f, -1.9984498f, 0.9986404f}, {0.9993067f, -1.9986133f, 0.9993067f, -1.998518f, 0.9987086f}, {0.99934f, -1.99868f, 0.99934f, -1.9985847f, 0.9987753f}, {0.9993724f, -1.9987449f, 0.9993724f, -1.9986496f, 0.9988402f}, {0.9994039f, -1.9988078f, 0.9994039f, -1.9987125f, 0.9989031f}, {0.9994343f, -1.9988686f, 0.9994343f, -1.9987733f, 0.998964f}, {0.9994636f, -1.9989272f, 0.9994636f, -1.9988319f, 0.9990225f}, {0.9994917f, -1.9989835f, 0.9994917f, -1.9988881f, 0.9990788f}, {0.9995186f, -1.9990373f, 0.9995186f, -1.9989419f, 0.9991326f}, {0.9995443f, -1.9990886f, 0.9995443f, -1.9989932f, 0.9991839f}, {0.9995687f, -1.9991374f, 0.9995687f, -1.9990421f, 0.9992327f}, {0.9995919f, -1.9991837f, 0.9995919f, -1.9990884f, 0.9992791f}, {0.9996138f, -1.9992276f, 0.9996138f, -1.9991323f, 0.9993229f}, {0.9996345f, -1.999269f, 0.9996345f, -1.9991737f, 0.9993644f}, {0.9996541f, -1.9993081f, 0.9996541f, -1.9992128f, 0.9994035f}},
-      {{0.9847056f, -1.9694113f, 0.9847056f, -1.9692941f, 0.9695285f}, {0.9848219f, -1.9696439f, 0.9848219f, -1.9695266f, 0.9697611f}, {0.9851604f, -1.9703207f, 0.9851604f, -1.9702035f, 0.970438f}, {0.985692f, -1.971384f, 0.985692f, -1.9712666f, 0.9715013f}, {0.9863751f, -1.9727501f, 0.9863751f, -1.9726327f, 0.9728676f}, {0.9871627f, -1.9743253f, 0.9871627f, -1.9742078f, 0.9744429f}, {0.9880093f, -1.9760186f, 0.9880093f, -1.975901f, 0.9761363f}, {0.9888758f, -1.9777515f, 0.9888758f, -1.9776338f, 0.9778693f}, {0.9897312f, -1.9794625f, 0.9897312f, -1.9793446f, 0.9795803f}, {0.9905537f, -1.9811075f, 0.9905537f, -1.9809895f, 0.9812254f}, {0.9913291f, -1.9826582f, 0.9913291f, -1.9825402f, 0.9827762f}, {0.9920495f, -1.9840991f, 0.9920495f, -1.983981f, 0.9842172f}, {0.9927119f, -1.9854238f, 0.9927119f, -1.9853056f, 0.985542f}, {0.9933163f, -1.9866325f, 0.9933163f, -1.9865143f, 0.9867508f}, {0.9938649f, -1.9877297f, 0.9938649f, -1.9876114f, 0.9878481f}, {0.9943612f, -1.9887223f, 0.9943612f, -1.988604f, 0.9888407f}, {0.9948092f, -1.9896185f, 0.9948092f, -1.9895f, 0.9897369f}, {0.9952134f, -1.9904267f, 0.9952134f, -1.9903082f, 0.9905452f}, {0.9955778f, -1.9911555f, 0.9955778f, -1.991037f, 0.9912741f}, {0.9959065f, -1.991813f, 0.9959065f, -1.9916945f, 0.9919316f}, {0.9962034f, -1.9924067f, 0.9962034f, -1.9922881f, 0.9925253f}, {0.9964717f, -1.9929434f, 0.9964717f, -1.9928247f, 0.993062f}, {0.9967146f, -1.9934292f, 0.9967146f, -1.9933106f, 0.9935479f}, {0.9969349f, -1.9938698f, 0.9969349f, -1.9937511f, 0.9939884f}, {0.997135f, -1.9942699f, 0.997135f, -1.9941512f, 0.9943886f}, {0.997317f, -1.9946341f, 0.997317f, -1.9945154f, 0.9947528f}, {0.997483f, -1.9949661f, 0.997483f, -1.9948473f, 0.9950848f}, {0.9976347f, -1.9952693f, 0.9976347f, -1.9951506f, 0.9953881f}, {0.9977734f, -1.9955468f, 0.9977734f, -1.995428f, 0.9956656f}, {0.9979006f, -1.9958012f, 0.9979006f, -1.9956825f, 0.99592f}, {0.9980175f, -1.9960349f, 0.9980175f, -1.9959161f, 0.9961537f}, {0.998125f, -1.99625f, 0.998125f, -1.9961312f, 0.9963688f}, {0.9982241f, -1.9964482f, 0.9982241f, -1.9963294f, 0.996567f}, {0.9983156f, -1.9966312f, 0.9983156f, -1.9965124f, 0.9967501f}, {0.9984003f, -1.9968005f, 0.9984003f, -1.9966817f, 0.9969194f}, {0.9984787f, -1.9969574f, 0.9984787f, -1.9968385f, 0.9970763f}, {0.9985515f, -1.997103f, 0.9985515f, -1.9969841f, 0.9972218f}, {0.9986191f, -1.9972383f, 0.9986191f, -1.9971194f, 0.9973571f}, {0.9986821f, -1.9973642f, 0.9986821f, -1.9972453f, 0.9974831f}, {0.9987408f, -1.9974816f, 0.9987408f, -1.9973627f, 0.9976004f}, {0.9987956f, -1.9975911f, 0.9987956f, -1.9974722f, 0.99771f}, {0.9988468f, -1.9976935f, 0.9988468f, -1.9975746f, 0.9978124f}, {0.9988947f, -1.9977894f, 0.9988947f, -1.9976705f, 0.9979083f}, {0.9989396f, -1.9978792f, 0.9989396f, -1.9977603f, 0.9979981f}, {0.9989818f, -1.9979635f, 0.9989818f, -1.9978446f, 0.9980824f}, {0.9990223f, -1.9980446f, 0.9990223f, -1.9979257f, 0.9981635f}, {0.9990626f, -1.9981252f, 0.9990626f, -1.9980062f, 0.9982441f}, {0.9991025f, -1.9982051f, 0.9991025f, -1.9980861f, 0.998324f}, {0.999142f, -1.998284f, 0.999142f, -1.9981651f, 0.9984029f}, {0.9991809f, -1.9983617f, 0.9991809f, -1.9982428f, 0.9984807f}, {0.999219f, -1.9984379f, 0.999219f, -1.998319f, 0.9985569f}, {0.9992562f, -1.9985124f, 0.9992562f, -1.9983935f, 0.9986314f}, {0.9992925f, -1.998585f, 0.9992925f, -1.998466f, 0.9987039f}, {0.9993276f, -1.9986553f, 0.9993276f, -1.9985363f, 0.9987743f}, {0.9993616f, -1.9987233f, 0.9993616f, -1.9986043f, 0.9988422f}, {0.9993944f, -1.9987887f, 0.9993944f, -1.9986698f, 0.9989077f}, {0.9994258f, -1.9988516f, 0.9994258f, -1.9987326f, 0.9989705f}, {0.9994558f, -1.9989117f, 0.9994558f, -1.9987927f, 0.9990307f}, {0.9994845f, -1.998969f, 0.9994845f, -1.99885f, 0.999088f}, {0.9995118f, -1.9990236f, 0.9995118f, -1.9989046f, 0.9991426f}, {0.9995377f, -1.9990753f, 0.9995377f, -1.9989564f, 0.9991943f}, {0.9995622f, -1.9991244f, 0.9995622f, -1.9990054f, 0.9992434f}, {0.9995853f, -1.9991707f, 0.9995853f, -1.9990517f, 0.9992897f}, {0.9996072f, -1.9992144f, 0.9996072f, -1.9990954f, 0.9993333f}},
-      {{0.98293f, -1.96586f, 0.98293f, -1.965714f, 0.9660061f}, {0.9830595f, -1.966119f, 0.9830595f, -1.965973f, 0.9662651f}, {0.9834364f, -1.9668729f, 0.9834364f, -1.9667267f, 0.967019f}, {0.9840285f, -1.968057f, 0.9840285f, -1.9679108f, 0.9682033f}, {0.9847894f, -1.9695789f, 0.9847894f, -1.9694325f, 0.9697252f}, {0.9856669f, -1.9713338f, 0.9856669f, -1.9711874f, 0.9714803f}, {0.9866104f, -1.9732208f, 0.9866104f, -1.9730741f, 0.9733674f}, {0.9875761f, -1.9751522f, 0.9875761f, -1.9750054f, 0.9752989f}, {0.9885297f, -1.9770595f, 0.9885297f, -1.9769126f, 0.9772064f}, {0.9894468f, -1.9788937f, 0.9894468f, -1.9787466f, 0.9790407f}, {0.9903116f, -1.9806231f, 0.9903116f, -1.9804759f, 0.9807703f}, {0.9911151f, -1.9822303f, 0.9911151f, -1.982083f, 0.9823776f}, {0.991854f, -1.9837081f, 0.991854f, -1.9835607f, 0.9838555f}, {0.9925284f, -1.9850568f, 0.9925284f, -1.9849093f, 0.9852042f}, {0.9931406f, -1.9862812f, 0.9931406f, -1.9861336f, 0.9864287f}, {0.9936945f, -1.9873889f, 0.9936945f, -1.9872413f, 0.9875366f}, {0.9941946f, -1.9883892f, 0.9941946f, -1.9882414f, 0.9885369f}, {0.9946457f, -1.9892914f, 0.9946457f, -1.9891436f, 0.9894392f}, {0.9950525f, -1.9901051f, 0.9950525f, -1.9899572f, 0.9902529f}, {0.9954196f, -1.9908391f, 0.9954196f, -1.9906912f, 0.9909871f}, {0.995751f, -1.991502f, 0.995751f, -1.991354f, 0.99165f}, {0.9960506f, -1.9921013f, 0.9960506f, -1.9919533f, 0.9922493f}, {0.9963219f, -1.9926438f, 0.9963219f, -1.9924958f, 0.9927919f}, {0.9965679f, -1.9931358f, 0.9965679f, -1.9929877f, 0.9932839f}, {0.9967914f, -1.9935827f, 0.9967914f, -1.9934346f, 0.9937308f}, {0.9969947f, -1.9939894f, 0.9969947f, -1.9938413f, 0.9941376f}, {0.9971801f, -1.9943602f, 0.9971801f, -1.9942121f, 0.9945084f}, {0.9973495f, -1.9946989f, 0.9973495f, -1.9945507f, 0.9948471f}, {0.9975045f, -1.9950089f, 0.9975045f, -1.9948607f, 0.9951571f}, {0.9976466f, -1.9952931f, 0.9976466f, -1.9951449f, 0.9954414f}, {0.9977771f, -1.9955541f, 0.9977771f, -1.9954059f, 0.9957024f}, {0.9978972f, -1.9957944f, 0.9978972f, -1.9956461f, 0.9959426f}, {0.9980079f, -1.9960158f, 0.9980079f, -1.9958675f, 0.9961641f}, {0.9981101f, -1.9962203f, 0.9981101f, -1.996072f, 0.9963686f}, {0.9982047f, -1.9964094f, 0.9982047f, -1.9962611f, 0.9965578f}, {0.9982923f, -1.9965847f, 0.9982923f, -1.9964363f, 0.996733f}, {0.9983736f, -1.9967473f, 0.9983736f, -1.9965989f, 0.9968956f}, {0.9984492f, -1.9968984f, 0.9984492f, -1.9967501f, 0.9970468f}, {0.9985196f, -1.9970391f, 0.9985196f, -1.9968907f, 0.9971875f}, {0.9985851f, -1.9971703f, 0.9985851f, -1.9970219f, 0.9973186f}, {0.9986463f, -1.9972927f, 0.9986463f, -1.9971443f, 0.9974411f}, {0.9987036f, -1.9974071f, 0.9987036f, -1.9972587f, 0.9975555f}, {0.9987571f, -1.9975142f, 0.9987571f, -1.9973658f, 0.9976626f}, {0.9988073f, -1.9976146f, 0.9988073f, -1.9974662f, 0.997763f}, {0.9988544f, -1.9977088f, 0.9988544f, -1.9975603f, 0.9978572f}, {0.9988997f, -1.9977993f, 0.9988997f, -1.9976509f, 0.9979478f}, {0.9989447f, -1.9978894f, 0.9989447f, -1.9977409f, 0.9980378f}, {0.9989893f, -1.9979786f, 0.9989893f, -1.9978302f, 0.9981271f}, {0.9990334f, -1.9980668f, 0.9990334f, -1.9979184f, 0.9982153f}, {0.9990768f, -1.9981537f, 0.9990768f, -1.9980052f, 0.9983021f}, {0.9991194f, -1.9982389f, 0.9991194f, -1.9980904f, 0.9983873f}, {0.9991611f, -1.9983221f, 0.9991611f, -1.9981736f, 0.9984706f}, {0.9992016f, -1.9984031f, 0.9992016f, -1.9982547f, 0.9985516f}, {0.9992409f, -1.9984817f, 0.9992409f, -1.9983332f, 0.9986302f}, {0.9992788f, -1.9985577f, 0.9992788f, -1.9984092f, 0.9987062f}, {0.9993154f, -1.9986308f, 0.9993154f, -1.9984823f, 0.9987793f}, {0.9993505f, -1.998701f, 0.9993505f, -1.9985525f, 0.9988495f}, {0.9993841f, -1.9987682f, 0.9993841f, -1.9986197f, 0.9989167f}, {0.9994161f, -1.9988323f, 0.9994161f, -1.9986838f, 0.9989808f}, {0.9994466f, -1.9988933f, 0.9994466f, -1.9987447f, 0.9990418f}, {0.9994756f, -1.9989511f, 0.9994756f, -1.9988026f, 0.9990996f}, {0.9995029f, -1.9990059f, 0.9995029f, -1.9988574f, 0.9991544f}, {0.9995288f, -1.9990576f, 0.9995288f, -1.9989091f, 0.9992062f}, {0.9995532f, -1.9991065f, 0.9995532f, -1.9989579f, 0.999255f}},
-      {{0.9809505f, -1.9619011f, 0.9809505f, -1.9617191f, 0.9620831f}, {0.9810947f, -1.9621894f, 0.9810947f, -1.9620074f, 0.9623714f}, {0.9815143f, -1.9630286f, 0.9815143f, -1.9628465f, 0.9632106f}, {0.9821735f, -1.964347f, 0.9821735f, -1.9641648f, 0.9645292f}, {0.9830208f, -1.9660416f, 0.9830208f, -1.9658593f, 0.966224f}, {0.9839981f, -1.9679962f, 0.9839981f, -1.9678137f, 0.9681788f}, {0.9850491f, -1.9700983f, 0.9850491f, -1.9699156f, 0.970281f}, {0.9861252f, -1.9722504f, 0.9861252f, -1.9720674f, 0.9724333f}, {0.987188f, -1.9743761f, 0.987188f, -1.9741929f, 0.9745592f}, {0.9882103f, -1.9764207f, 0.9882103f, -1.9762374f, 0.976604f}, {0.9891745f, -1.978349f, 0.9891745f, -1.9781655f, 0.9785325f}, {0.9900706f, -1.9801413f, 0.9900706f, -1.9799576f, 0.9803249f}, {0.9908948f, -1.9817896f, 0.9908948f, -1.9816058f, 0.9819734f}, {0.9916471f, -1.9832942f, 0.9916471f, -1.9831103f, 0.9834781f}, {0.9923302f, -1.9846603f, 0.9923302f, -1.9844762f, 0.9848444f}, {0.9929483f, -1.9858965f, 0.9929483f, -1.9857123f, 0.9860807f}, {0.9935064f, -1.9870128f, 0.9935064f, -1.9868285f, 0.9871971f}, {0.9940099f, -1.9880198f, 0.9940099f, -1.9878355f, 0.9882042f}, {0.9944641f, -1.9889281f, 0.9944641f, -1.9887436f, 0.9891126f}, {0.9948738f, -1.9897476f, 0.9948738f, -1.9895631f, 0.9899322f}, {0.9952438f, -1.9904877f, 0.9952438f, -1.9903031f, 0.9906723f}, {0.9955784f, -1.9911568f, 0.9955784f, -1.9909721f, 0.9913415f}, {0.9958813f, -1.9917626f, 0.9958813f, -1.9915779f, 0.9919473f}, {0.996156f, -1.992312f, 0.996156f, -1.9921273f, 0.9924968f}, {0.9964056f, -1.9928111f, 0.9964056f, -1.9926263f, 0.9929959f}, {0.9966327f, -1.9932653f, 0.9966327f, -1.9930805f, 0.9934502f}, {0.9968397f, -1.9936795f, 0.9968397f, -1.9934946f, 0.9938644f}, {0.9970289f, -1.9940578f, 0.9970289f, -1.9938729f, 0.9942427f}, {0.997202f, -1.994404f, 0.997202f, -1.994219f, 0.994589f}, {0.9973607f, -1.9947215f, 0.9973607f, -1.9945365f, 0.9949065f}, {0.9975065f, -1.9950131f, 0.9975065f, -1.994828f, 0.9951981f}, {0.9976407f, -1.9952814f, 0.9976407f, -1.9950963f, 0.9954664f}, {0.9977644f, -1.9955288f, 0.9977644f, -1.9953437f, 0.9957138f}, {0.9978786f, -1.9957572f, 0.9978786f, -1.9955721f, 0.9959423f}, {0.9979842f, -1.9959685f, 0.9979842f, -1.9957834f, 0.9961536f}, {0.9980821f, -1.9961643f, 0.9980821f, -1.9959791f, 0.9963494f}, {0.998173f, -1.996346f, 0.998173f, -1.9961608f, 0.9965311f}, {0.9982574f, -1.9965148f, 0.9982574f, -1.9963296f, 0.9967f}, {0.998336f, -1.996672f, 0.998336f, -1.9964868f, 0.9968572f}, {0.9984093f, -1.9968185f, 0.9984093f, -1.9966333f, 0.9970037f}, {0.9984776f, -1.9969553f, 0.9984776f, -1.9967701f, 0.9971405f}, {0.9985416f, -1.9970831f, 0.9985416f, -1.9968979f, 0.9972683f}, {0.9986014f, -1.9972028f, 0.9986014f, -1.9970176f, 0.997388f}, {0.9986575f, -1.9973149f, 0.9986575f, -1.9971297f, 0.9975002f}, {0.9987101f, -1.9974202f, 0.9987101f, -1.9972349f, 0.9976054f}, {0.9987607f, -1.9975214f, 0.9987607f, -1.9973361f, 0.9977066f}, {0.998811f, -1.997622f, 0.998811f, -1.9974367f, 0.9978072f}, {0.9988609f, -1.9977217f, 0.9988609f, -1.9975364f, 0.997907f}, {0.9989101f, -1.9978203f, 0.9989101f, -1.997635f, 0.9980056f}, {0.9989587f, -1.9979173f, 0.9989587f, -1.997732f, 0.9981026f}, {0.9990062f, -1.9980125f, 0.9990062f, -1.9978272f, 0.9981978f}, {0.9990528f, -1.9981055f, 0.9990528f, -1.9979202f, 0.9982908f}, {0.999098f, -1.9981961f, 0.999098f, -1.9980107f, 0.9983814f}, {0.9991419f, -1.9982839f, 0.9991419f, -1.9980985f, 0.9984692f}, {0.9991844f, -1.9983688f, 0.9991844f, -1.9981834f, 0.9985541f}, {0.9992252f, -1.9984505f, 0.9992252f, -1.9982651f, 0.9986358f}, {0.9992645f, -1.9985289f, 0.9992645f, -1.9983436f, 0.9987143f}, {0.999302f, -1.998604f, 0.999302f, -1.9984186f, 0.9987894f}, {0.9993378f, -1.9986756f, 0.9993378f, -1.9984903f, 0.998861f}, {0.9993719f, -1.9987437f, 0.9993719f, -1.9985584f, 0.9989291f}, {0.9994042f, -1.9988084f, 0.9994042f, -1.998623f, 0.9989938f}, {0.9994348f, -1.9988696f, 0.9994348f, -1.9986842f, 0.999055f}, {0.9994637f, -1.9989274f, 0.9994637f, -1.9987421f, 0.9991128f}, {0.999491f, -1.998982f, 0.999491f, -1.9987966f, 0.9991674f}},
-      {{0.9787444f, -1.9574888f, 0.9787444f, -1.9572621f, 0.9577154f}, {0.9789048f, -1.9578095f, 0.9789048f, -1.9575829f, 0.9580362f}, {0.9793717f, -1.9587434f, 0.9793717f, -1.9585166f, 0.9589701f}, {0.9801053f, -1.9602107f, 0.9801053f, -1.9599837f, 0.9604376f}, {0.9810485f, -1.962097f, 0.9810485f, -1.9618698f, 0.9623241f}, {0.9821366f, -1.9642732f, 0.9821366f, -1.9640458f, 0.9645006f}, {0.983307f, -1.966614f, 0.983307f, -1.9663863f, 0.9668417f}, {0.9845056f, -1.9690112f, 0.9845056f, -1.9687832f, 0.9692391f}, {0.9856898f, -1.9713796f, 0.9856898f, -1.9711514f, 0.9716078f}, {0.9868291f, -1.9736582f, 0.9868291f, -1.9734297f, 0.9738867f}, {0.9879039f, -1.9758077f, 0.9879039f, -1.975579f, 0.9760365f}, {0.988903f, -1.9778061f, 0.988903f, -1.9775771f, 0.978035f}, {0.9898221f, -1.9796443f, 0.9898221f, -1.9794151f, 0.9798734f}, {0.9906612f, -1.9813224f, 0.9906612f, -1.981093f, 0.9815518f}, {0.9914232f, -1.9828464f, 0.9914232f, -1.9826169f, 0.983076f}, {0.9921128f, -1.9842257f, 0.9921128f, -1.983996f, 0.9844554f}, {0.9927357f, -1.9854714f, 0.9927357f, -1.9852415f, 0.9857012f}, {0.9932976f, -1.9865953f, 0.9932976f, -1.9863653f, 0.9868252f}, {0.9938045f, -1.987609f, 0.9938045f, -1.9873789f, 0.9878391f}, {0.9942619f, -1.9885238f, 0.9942619f, -1.9882936f, 0.9887541f}, {0.994675f, -1.98935f, 0.994675f, -1.9891197f, 0.9895803f}, {0.9950485f, -1.9900971f, 0.9950485f, -1.9898667f, 0.9903275f}, {0.9953868f, -1.9907735f, 0.9953868f, -1.990543f, 0.991004f}, {0.9956935f, -1.991387f, 0.9956935f, -1.9911565f, 0.9916175f}, {0.9959722f, -1.9919443f, 0.9959722f, -1.9917137f, 0.9921749f}, {0.9962258f, -1.9924516f, 0.9962258f, -1.9922209f, 0.9926823f}, {0.9964571f, -1.9929141f, 0.9964571f, -1.9926834f, 0.9931448f}, {0.9966683f, -1.9933366f, 0.9966683f, -1.9931059f, 0.9935674f}, {0.9968617f, -1.9937233f, 0.9968617f, -1.9934925f, 0.9939542f}, {0.997039f, -1.9940779f, 0.997039f, -1.9938471f, 0.9943088f}, {0.9972018f, -1.9944036f, 0.9972018f, -1.9941727f, 0.9946345f}, {0.9973517f, -1.9947034f, 0.9973517f, -1.9944724f, 0.9949343f}, {0.9974898f, -1.9949797f, 0.9974898f, -1.9947487f, 0.9952107f}, {0.9976174f, -1.9952349f, 0.9976174f, -1.9950039f, 0.9954659f}, {0.9977355f, -1.9954709f, 0.9977355f, -1.9952399f, 0.9957019f}, {0.9978448f, -1.9956896f, 0.9978448f, -1.9954586f, 0.9959207f}, {0.9979463f, -1.9958926f, 0.9979463f, -1.9956615f, 0.9961237f}, {0.9980406f, -1.9960813f, 0.9980406f, -1.9958502f, 0.9963123f}, {0.9981284f, -1.9962569f, 0.9981284f, -1.9960258f, 0.996488f}, {0.9982103f, -1.9964206f, 0.9982103f, -1.9961894f, 0.9966517f}, {0.9982867f, -1.9965734f, 0.9982867f, -1.9963422f, 0.9968045f}, {0.9983581f, -1.9967162f, 0.9983581f, -1.9964851f, 0.9969474f}, {0.998425f, -1.9968499f, 0.998425f, -1.9966187f, 0.9970811f}, {0.9984876f, -1.9969752f, 0.9984876f, -1.996744f, 0.9972064f}, {0.9985464f, -1.9970928f, 0.9985464f, -1.9968616f, 0.997324f}, {0.9986029f, -1.9972059f, 0.9986029f, -1.9969747f, 0.9974371f}, {0.9986591f, -1.9973183f, 0.9986591f, -1.9970871f, 0.9975495f}, {0.9987149f, -1.9974297f, 0.9987149f, -1.9971985f, 0.997661f}, {0.9987699f, -1.9975399f, 0.9987699f, -1.9973086f, 0.9977711f}, {0.9988241f, -1.9976483f, 0.9988241f, -1.997417f, 0.9978796f}, {0.9988773f, -1.9977546f, 0.9988773f, -1.9975234f, 0.9979859f}, {0.9989293f, -1.9978586f, 0.9989293f, -1.9976273f, 0.9980899f}, {0.9989799f, -1.9979598f, 0.9989799f, -1.9977285f, 0.9981911f}, {0.999029f, -1.9980579f, 0.999029f, -1.9978266f, 0.9982892f}, {0.9990764f, -1.9981528f, 0.9990764f, -1.9979214f, 0.9983841f}, {0.999122f, -1.9982441f, 0.999122f, -1.9980128f, 0.9984754f}, {0.9991659f, -1.9983318f, 0.9991659f, -1.9981004f, 0.9985631f}, {0.9992078f, -1.9984156f, 0.9992078f, -1.9981843f, 0.998647f}, {0.9992478f, -1.9984957f, 0.9992478f, -1.9982643f, 0.998727f}, {0.9992859f, -1.9985718f, 0.9992859f, -1.9983404f, 0.9988032f}, {0.999322f, -1.9986441f, 0.999322f, -1.9984127f, 0.9988754f}, {0.9993562f, -1.9987125f, 0.9993562f, -1.9984811f, 0.9989438f}, {0.9993885f, -1.9987771f, 0.9993885f, -1.9985457f, 0.9990085f}, {0.999419f, -1.998838f, 0.999419f, -1.9986066f, 0.9990694f}},
-      {{0.9762862f, -1.9525725f, 0.9762862f, -1.9522903f, 0.9528547f}, {0.9764646f, -1.9529293f, 0.9764646f, -1.9526471f, 0.9532115f}, {0.976984f, -1.9539679f, 0.976984f, -1.9536856f, 0.9542503f}, {0.9778001f, -1.9556002f, 0.9778001f, -1.9553176f, 0.9558828f}, {0.9788495f, -1.9576989f, 0.9788495f, -1.957416f, 0.9579818f}, {0.9800604f, -1.9601208f, 0.9800604f, -1.9598375f, 0.960404f}, {0.9813633f, -1.9627266f, 0.9813633f, -1.962443f, 0.9630102f}, {0.9826979f, -1.9653959f, 0.9826979f, -1.9651119f, 0.9656799f}, {0.9840169f, -1.9680338f, 0.9840169f, -1.9677494f, 0.9683182f}, {0.9852863f, -1.9705725f, 0.9852863f, -1.9702877f, 0.9708573f}, {0.986484f, -1.9729679f, 0.986484f, -1.9726828f, 0.973253f}, {0.9875977f, -1.9751954f, 0.9875977f, -1.97491f, 0.9754809f}, {0.9886224f, -1.9772449f, 0.9886224f, -1.9769592f, 0.9775306f}, {0.9895581f, -1.9791163f, 0.9895581f, -1.9788303f, 0.9794023f}, {0.9904081f, -1.9808161f, 0.9904081f, -1.9805299f, 0.9811024f}, {0.9911774f, -1.9823548f, 0.9911774f, -1.9820683f, 0.9826413f}, {0.9918723f, -1.9837446f, 0.9918723f, -1.983458f, 0.9840313f}, {0.9924994f, -1.9849988f, 0.9924994f, -1.9847119f, 0.9852856f}, {0.9930651f, -1.9861302f, 0.9930651f, -1.9858432f, 0.9864172f}, {0.9935756f, -1.9871513f, 0.9935756f, -1.9868641f, 0.9874384f}, {0.9940368f, -1.9880735f, 0.9940368f, -1.9877862f, 0.9883608f}, {0.9944537f, -1.9889075f, 0.9944537f, -1.9886201f, 0.9891949f}, {0.9948314f, -1.9896627f, 0.9948314f, -1.9893752f, 0.9899502f}, {0.9951738f, -1.9903477f, 0.9951738f, -1.9900601f, 0.9906353f}, {0.995485f, -1.99097f, 0.995485f, -1.9906823f, 0.9912578f}, {0.9957682f, -1.9915365f, 0.9957682f, -1.9912487f, 0.9918243f}, {0.9960265f, -1.992053f, 0.9960265f, -1.9917651f, 0.9923409f}, {0.9962624f, -1.9925249f, 0.9962624f, -1.992237f, 0.9928128f}, {0.9964784f, -1.9929568f, 0.9964784f, -1.9926688f, 0.9932448f}, {0.9966764f, -1.9933528f, 0.9966764f, -1.9930648f, 0.9936409f}, {0.9968583f, -1.9937166f, 0.9968583f, -1.9934285f, 0.9940047f}, {0.9970257f, -1.9940514f, 0.9970257f, -1.9937633f, 0.9943396f}, {0.9971801f, -1.9943601f, 0.9971801f, -1.9940719f, 0.9946483f}, {0.9973226f, -1.9946452f, 0.9973226f, -1.9943569f, 0.9949334f}, {0.9974544f, -1.9949089f, 0.9974544f, -1.9946206f, 0.9951972f}, {0.9975766f, -1.9951532f, 0.9975766f, -1.9948649f, 0.9954415f}, {0.99769f, -1.99538f, 0.99769f, -1.9950916f, 0.9956683f}, {0.9977954f, -1.9955907f, 0.9977954f, -1.9953023f, 0.9958791f}, {0.9978935f, -1.9957869f, 0.9978935f, -1.9954985f, 0.9960753f}, {0.9979849f, -1.9959698f, 0.9979849f, -1.9956814f, 0.9962582f}, {0.9980703f, -1.9961405f, 0.9980703f, -1.9958521f, 0.996429f}, {0.9981501f, -1.9963001f, 0.9981501f, -1.9960116f, 0.9965886f}, {0.9982248f, -1.9964495f, 0.9982248f, -1.996161f, 0.996738f}, {0.9982948f, -1.9965895f, 0.9982948f, -1.996301f, 0.996878f}, {0.9983604f, -1.9967209f, 0.9983604f, -1.9964323f, 0.9970094f}, {0.9984236f, -1.9968472f, 0.9984236f, -1.9965587f, 0.9971358f}, {0.9984864f, -1.9969728f, 0.9984864f, -1.9966843f, 0.9972614f}, {0.9985487f, -1.9970974f, 0.9985487f, -1.9968088f, 0.997386f}, {0.9986102f, -1.9972204f, 0.9986102f, -1.9969318f, 0.9975091f}, {0.9986708f, -1.9973416f, 0.9986708f, -1.9970529f, 0.9976302f}, {0.9987302f, -1.9974604f, 0.9987302f, -1.9971718f, 0.9977491f}, {0.9987883f, -1.9975766f, 0.9987883f, -1.9972879f, 0.9978652f}, {0.9988448f, -1.9976896f, 0.9988448f, -1.9974009f, 0.9979783f}, {0.9988997f, -1.9977993f, 0.9988997f, -1.9975106f, 0.998088f}, {0.9989526f, -1.9979053f, 0.9989526f, -1.9976166f, 0.998194f}, {0.9990037f, -1.9980074f, 0.9990037f, -1.9977186f, 0.9982961f}, {0.9990527f, -1.9981053f, 0.9990527f, -1.9978166f, 0.9983941f}, {0.9990995f, -1.9981991f, 0.9990995f, -1.9979103f, 0.9984878f}, {0.9991443f, -1.9982885f, 0.9991443f, -1.9979997f, 0.9985773f}, {0.9991868f, -1.9983736f, 0.9991868f, -1.9980848f, 0.9986624f}, {0.9992272f, -1.9984543f, 0.9992272f, -1.9981655f, 0.9987431f}, {0.9992654f, -1.9985308f, 0.9992654f, -1.998242f, 0.9988196f}, {0.9993015f, -1.998603f, 0.9993015f, -1.9983142f, 0.9988918f}, {0.9993356f, -1.9986711f, 0.9993356f, -1.9983823f, 0.9989599f}},
-      {{0.9735483f, -1.9470965f, 0.9735483f, -1.9467453f, 0.9474478f}, {0.9737466f, -1.9474931f, 0.9737466f, -1.9471418f, 0.9478444f}, {0.9743239f, -1.9486477f, 0.9743239f, -1.9482962f, 0.9489993f}, {0.9752313f, -1.9504626f, 0.9752313f, -1.9501107f, 0.9508144f}, {0.9763983f, -1.9527966f, 0.9763983f, -1.9524443f, 0.9531488f}, {0.9777453f, -1.9554906f, 0.9777453f, -1.9551379f, 0.9558434f}, {0.9791951f, -1.9583902f, 0.9791951f, -1.9580369f, 0.9587434f}, {0.9806806f, -1.9613612f, 0.9806806f, -1.9610074f, 0.961715f}, {0.9821492f, -1.9642983f, 0.9821492f, -1.963944f, 0.9646527f}, {0.9835629f, -1.9671258f, 0.9835629f, -1.9667709f, 0.9674806f}, {0.9848972f, -1.9697944f, 0.9848972f, -1.9694391f, 0.9701498f}, {0.9861384f, -1.9722767f, 0.9861384f, -1.9719209f, 0.9726325f}, {0.9872806f, -1.9745612f, 0.9872806f, -1.974205f, 0.9749174f}, {0.9883238f, -1.9766476f, 0.9883238f, -1.9762911f, 0.9770042f}, {0.9892716f, -1.9785432f, 0.9892716f, -1.9781863f, 0.9789001f}, {0.9901297f, -1.9802593f, 0.9901297f, -1.9799021f, 0.9806166f}, {0.9909049f, -1.9818098f, 0.9909049f, -1.9814523f, 0.9821673f}, {0.9916045f, -1.9832091f, 0.9916045f, -1.9828513f, 0.9835668f}, {0.9922358f, -1.9844716f, 0.9922358f, -1.9841136f, 0.9848295f}, {0.9928055f, -1.9856111f, 0.9928055f, -1.9852529f, 0.9859693f}, {0.9933202f, -1.9866405f, 0.9933202f, -1.9862821f, 0.9869988f}, {0.9937857f, -1.9875714f, 0.9937857f, -1.9872129f, 0.98793f}, {0.9942073f, -1.9884145f, 0.9942073f, -1.9880558f, 0.9887732f}, {0.9945896f, -1.9891793f, 0.9945896f, -1.9888204f, 0.9895381f}, {0.9949371f, -1.9898742f, 0.9949371f, -1.9895152f, 0.9902331f}, {0.9952533f, -1.9905067f, 0.9952533f, -1.9901476f, 0.9908657f}, {0.9955417f, -1.9910835f, 0.9955417f, -1.9907243f, 0.9914427f}, {0.9958052f, -1.9916105f, 0.9958052f, -1.9912512f, 0.9919697f}, {0.9960464f, -1.9920928f, 0.9960464f, -1.9917335f, 0.9924522f}, {0.9962676f, -1.9925351f, 0.9962676f, -1.9921757f, 0.9928946f}, {0.9964707f, -1.9929415f, 0.9964707f, -1.992582f, 0.993301f}, {0.9966577f, -1.9933155f, 0.9966577f, -1.9929559f, 0.993675f}, {0.9968301f, -1.9936602f, 0.9968301f, -1.9933006f, 0.9940199f}, {0.9969893f, -1.9939787f, 0.9969893f, -1.993619f, 0.9943384f}, {0.9971366f, -1.9942732f, 0.9971366f, -1.9939135f, 0.994633f}, {0.9972731f, -1.9945462f, 0.9972731f, -1.9941864f, 0.994906f}, {0.9973998f, -1.9947995f, 0.9973998f, -1.9944397f, 0.9951594f}, {0.9975175f, -1.995035f, 0.9975175f, -1.9946751f, 0.9953949f}, {0.9976271f, -1.9952542f, 0.9976271f, -1.9948942f, 0.9956141f}, {0.9977292f, -1.9954585f, 0.9977292f, -1.9950985f, 0.9958185f}, {0.9978246f, -1.9956492f, 0.9978246f, -1.9952893f, 0.9960092f}, {0.9979138f, -1.9958276f, 0.9979138f, -1.9954675f, 0.9961876f}, {0.9979972f, -1.9959945f, 0.9979972f, -1.9956344f, 0.9963545f}, {0.9980755f, -1.9961509f, 0.9980755f, -1.9957908f, 0.996511f}, {0.9981488f, -1.9962977f, 0.9981488f, -1.9959376f, 0.9966578f}, {0.9982194f, -1.9964389f, 0.9982194f, -1.9960787f, 0.996799f}, {0.9982896f, -1.9965792f, 0.9982896f, -1.9962191f, 0.9969394f}, {0.9983592f, -1.9967184f, 0.9983592f, -1.9963582f, 0.9970786f}, {0.9984279f, -1.9968559f, 0.9984279f, -1.9964956f, 0.9972161f}, {0.9984956f, -1.9969912f, 0.9984956f, -1.996631f, 0.9973515f}, {0.998562f, -1.997124f, 0.998562f, -1.9967638f, 0.9974843f}, {0.9986269f, -1.9972538f, 0.9986269f, -1.9968935f, 0.9976141f}, {0.9986901f, -1.9973802f, 0.9986901f, -1.9970199f, 0.9977405f}, {0.9987514f, -1.9975027f, 0.9987514f, -1.9971424f, 0.9978631f}, {0.9988106f, -1.9976212f, 0.9988106f, -1.9972608f, 0.9979815f}, {0.9988676f, -1.9977352f, 0.9988676f, -1.9973749f, 0.9980956f}, {0.9989224f, -1.9978447f, 0.9989224f, -1.9974843f, 0.9982051f}, {0.9989747f, -1.9979495f, 0.9989747f, -1.9975891f, 0.9983099f}, {0.9990247f, -1.9980494f, 0.9990247f, -1.997689f, 0.9984098f}, {0.9990722f, -1.9981445f, 0.9990722f, -1.9977841f, 0.9985049f}, {0.9991174f, -1.9982347f, 0.9991174f, -1.9978743f, 0.9985952f}, {0.9991601f, -1.9983202f, 0.9991601f, -1.9979597f, 0.9986806f}, {0.9992004f, -1.9984009f, 0.9992004f, -1.9980404f, 0.9987614f}, {0.9992385f, -1.998477f, 0.9992385f, -1.9981165f, 0.9988375f}},
-      {{0.9704996f, -1.9409993f, 0.9704996f, -1.9405622f, 0.9414363f}, {0.9707199f, -1.9414398f, 0.9707199f, -1.9410027f, 0.941877f}, {0.9713613f, -1.9427227f, 0.9713613f, -1.9422852f, 0.9431601f}, {0.9723697f, -1.9447393f, 0.9723697f, -1.9443014f, 0.9451772f}, {0.9736668f, -1.9473336f, 0.9736668f, -1.9468951f, 0.9477721f}, {0.9751644f, -1.9503289f, 0.9751644f, -1.9498897f, 0.950768f}, {0.9767768f, -1.9535537f, 0.9767768f, -1.9531138f, 0.9539936f}, {0.9784296f, -1.9568592f, 0.9784296f, -1.9564186f, 0.9572998f}, {0.980064f, -1.9601281f, 0.980064f, -1.9596867f, 0.9605695f}, {0.981638f, -1.963276f, 0.981638f, -1.9628339f, 0.9637181f}, {0.983124f, -1.966248f, 0.983124f, -1.9658053f, 0.9666908f}, {0.9845067f, -1.9690134f, 0.9845067f, -1.96857f, 0.9694567f}, {0.9857795f, -1.971559f, 0.9857795f, -1.9711151f, 0.972003f}, {0.9869423f, -1.9738847f, 0.9869423f, -1.9734402f, 0.9743291f}, {0.987999f, -1.975998f, 0.987999f, -1.9755531f, 0.976443f}, {0.9889559f, -1.9779117f, 0.9889559f, -1.9774664f, 0.9783571f}, {0.9898205f, -1.979641f, 0.9898205f, -1.9791953f, 0.9800868f}, {0.990601f, -1.981202f, 0.990601f, -1.9807558f, 0.9816481f}, {0.9913053f, -1.9826106f, 0.9913053f, -1.9821641f, 0.983057f}, {0.9919411f, -1.9838821f, 0.9919411f, -1.9834354f, 0.9843289f}, {0.9925155f, -1.9850309f, 0.9925155f, -1.9845839f, 0.9854779f}, {0.993035f, -1.98607f, 0.993035f, -1.9856228f, 0.9865172f}, {0.9935056f, -1.9870111f, 0.9935056f, -1.9865637f, 0.9874585f}, {0.9939324f, -1.9878649f, 0.9939324f, -1.9874172f, 0.9883125f}, {0.9943203f, -1.9886407f, 0.9943203f, -1.9881929f, 0.9890885f}, {0.9946734f, -1.9893469f, 0.9946734f, -1.9888989f, 0.9897949f}, {0.9949955f, -1.989991f, 0.9949955f, -1.9895429f, 0.9904391f}, {0.9952897f, -1.9905794f, 0.9952897f, -1.9901312f, 0.9910277f}, {0.9955591f, -1.9911181f, 0.9955591f, -1.9906698f, 0.9915665f}, {0.9958061f, -1.9916121f, 0.9958061f, -1.9911636f, 0.9920606f}, {0.996033f, -1.992066f, 0.996033f, -1.9916174f, 0.9925145f}, {0.9962418f, -1.9924837f, 0.9962418f, -1.992035f, 0.9929323f}, {0.9964344f, -1.9928688f, 0.9964344f, -1.99242f, 0.9933175f}, {0.9966122f, -1.9932245f, 0.9966122f, -1.9927757f, 0.9936733f}, {0.9967768f, -1.9935535f, 0.9967768f, -1.9931046f, 0.9940024f}, {0.9969292f, -1.9938585f, 0.9969292f, -1.9934095f, 0.9943074f}, {0.9970707f, -1.9941414f, 0.9970707f, -1.9936924f, 0.9945905f}, {0.9972022f, -1.9944045f, 0.9972022f, -1.9939554f, 0.9948536f}, {0.9973247f, -1.9946494f, 0.9973247f, -1.9942002f, 0.9950985f}, {0.9974388f, -1.9948777f, 0.9974388f, -1.9944285f, 0.9953269f}, {0.9975454f, -1.9950908f, 0.9975454f, -1.9946415f, 0.99554f}, {0.997645f, -1.99529f, 0.997645f, -1.9948407f, 0.9957393f}, {0.9977382f, -1.9954765f, 0.9977382f, -1.9950271f, 0.9959258f}, {0.9978256f, -1.9956513f, 0.9978256f, -1.9952019f, 0.9961006f}, {0.9979076f, -1.9958153f, 0.9979076f, -1.9953659f, 0.9962647f}, {0.9979865f, -1.995973f, 0.9979865f, -1.9955236f, 0.9964225f}, {0.9980649f, -1.9961298f, 0.9980649f, -1.9956804f, 0.9965793f}, {0.9981427f, -1.9962853f, 0.9981427f, -1.9958358f, 0.9967348f}, {0.9982195f, -1.996439f, 0.9982195f, -1.9959894f, 0.9968885f}, {0.9982951f, -1.9965903f, 0.9982951f, -1.9961407f, 0.9970398f}, {0.9983693f, -1.9967386f, 0.9983693f, -1.996289f, 0.9971883f}, {0.9984418f, -1.9968837f, 0.9984418f, -1.996434f, 0.9973333f}, {0.9985124f, -1.9970249f, 0.9985124f, -1.9965752f, 0.9974746f}, {0.9985809f, -1.9971618f, 0.9985809f, -1.9967121f, 0.9976115f}, {0.9986471f, -1.9972942f, 0.9986471f, -1.9968444f, 0.9977439f}, {0.9987108f, -1.9974216f, 0.9987108f, -1.9969719f, 0.9978714f}, {0.998772f, -1.997544f, 0.998772f, -1.9970942f, 0.9979938f}, {0.9988305f, -1.9976611f, 0.9988305f, -1.9972113f, 0.9981109f}, {0.9988864f, -1.9977728f, 0.9988864f, -1.9973229f, 0.9982226f}, {0.9989395f, -1.997879f, 0.9989395f, -1.9974292f, 0.9983289f}, {0.9989899f, -1.9979799f, 0.9989899f, -1.99753f, 0.9984298f}, {0.9990377f, -1.9980754f, 0.9990377f, -1.9976254f, 0.9985253f}, {0.9990828f, -1.9981656f, 0.9990828f, -1.9977156f, 0.9986155f}, {0.9991253f, -1.9982507f, 0.9991253f, -1.9978007f, 0.9987006f}},
-      {{0.9671065f, -1.9342129f, 0.9671065f, -1.9336692f, 0.9347566f}, {0.967351f, -1.934702f, 0.967351f, -1.9341582f, 0.9352459f}, {0.9680632f, -1.9361264f, 0.9680632f, -1.9355822f, 0.9366706f}, {0.969183f, -1.9383659f, 0.969183f, -1.9378211f, 0.9389108f}, {0.9706238f, -1.9412476f, 0.9706238f, -1.940702f, 0.9417933f}, {0.972288f, -1.944576f, 0.972288f, -1.9440294f, 0.9451226f}, {0.9740803f, -1.9481607f, 0.9740803f, -1.9476131f, 0.9487083f}, {0.9759182f, -1.9518365f, 0.9759182f, -1.9512878f, 0.9523851f}, {0.9777365f, -1.955473f, 0.9777365f, -1.9549233f, 0.9560226f}, {0.9794881f, -1.9589762f, 0.9794881f, -1.9584255f, 0.9595268f}, {0.9811424f, -1.9622849f, 0.9811424f, -1.9617333f, 0.9628364f}, {0.9826822f, -1.9653645f, 0.9826822f, -1.964812f, 0.9659169f}, {0.9841002f, -1.9682003f, 0.9841002f, -1.9676471f, 0.9687536f}, {0.9853959f, -1.9707918f, 0.9853959f, -1.9702378f, 0.9713458f}, {0.9865737f, -1.9731474f, 0.9865737f, -1.9725927f, 0.973702f}, {0.9876405f, -1.9752809f, 0.9876405f, -1.9747257f, 0.9758361f}, {0.9886046f, -1.9772093f, 0.9886046f, -1.9766535f, 0.977765f}, {0.9894751f, -1.9789502f, 0.9894751f, -1.9783939f, 0.9795065f}, {0.9902608f, -1.9805215f, 0.9902608f, -1.9799648f, 0.9810782f}, {0.9909701f, -1.9819402f, 0.9909701f, -1.9813831f, 0.9824973f}, {0.9916111f, -1.9832221f, 0.9916111f, -1.9826646f, 0.9837796f}, {0.9921908f, -1.9843817f, 0.9921908f, -1.9838239f, 0.9849395f}, {0.9927161f, -1.9854321f, 0.9927161f, -1.984874f, 0.9859902f}, {0.9931926f, -1.9863851f, 0.9931926f, -1.9858268f, 0.9869434f}, {0.9936256f, -1.9872512f, 0.9936256f, -1.9866926f, 0.9878098f}, {0.9940198f, -1.9880397f, 0.9940198f, -1.9874808f, 0.9885985f}, {0.9943794f, -1.9887588f, 0.9943794f, -1.9881998f, 0.9893178f}, {0.9947079f, -1.9894159f, 0.9947079f, -1.9888567f, 0.9899751f}, {0.9950087f, -1.9900174f, 0.9950087f, -1.9894581f, 0.9905768f}, {0.9952846f, -1.9905691f, 0.9952846f, -1.9900096f, 0.9911286f}, {0.995538f, -1.991076f, 0.995538f, -1.9905163f, 0.9916356f}, {0.9957713f, -1.9915425f, 0.9957713f, -1.9909827f, 0.9921023f}, {0.9959863f, -1.9919727f, 0.9959863f, -1.9914127f, 0.9925326f}, {0.996185f, -1.99237f, 0.996185f, -1.9918099f, 0.99293f}, {0.9963688f, -1.9927375f, 0.9963688f, -1.9921774f, 0.9932977f}, {0.9965391f, -1.9930782f, 0.9965391f, -1.9925179f, 0.9936384f}, {0.9966971f, -1.9933943f, 0.9966971f, -1.992834f, 0.9939546f}, {0.9968441f, -1.9936881f, 0.9968441f, -1.9931277f, 0.9942485f}, {0.9969809f, -1.9939617f, 0.9969809f, -1.9934012f, 0.9945222f}, {0.9971084f, -1.9942168f, 0.9971084f, -1.9936562f, 0.9947773f}, {0.9972274f, -1.9944549f, 0.9972274f, -1.9938942f, 0.9950155f}, {0.9973387f, -1.9946774f, 0.9973387f, -1.9941168f, 0.9952381f}, {0.9974429f, -1.9948858f, 0.9974429f, -1.9943251f, 0.9954465f}, {0.9975405f, -1.9950811f, 0.9975405f, -1.9945203f, 0.9956419f}, {0.9976322f, -1.9952644f, 0.9976322f, -1.9947035f, 0.9958252f}, {0.9977203f, -1.9954406f, 0.9977203f, -1.9948797f, 0.9960015f}, {0.9978079f, -1.9956158f, 0.9978079f, -1.9950549f, 0.9961768f}, {0.9978948f, -1.9957896f, 0.9978948f, -1.9952286f, 0.9963506f}, {0.9979806f, -1.9959613f, 0.9979806f, -1.9954002f, 0.9965223f}, {0.9980652f, -1.9961303f, 0.9980652f, -1.9955692f, 0.9966914f}, {0.9981481f, -1.9962961f, 0.9981481f, -1.995735f, 0.9968573f}, {0.9982291f, -1.9964582f, 0.9982291f, -1.995897f, 0.9970194f}, {0.998308f, -1.996616f, 0.998308f, -1.9960548f, 0.9971772f}, {0.9983845f, -1.996769f, 0.9983845f, -1.9962078f, 0.9973303f}, {0.9984585f, -1.9969169f, 0.9984585f, -1.9963556f, 0.9974783f}, {0.9985297f, -1.9970594f, 0.9985297f, -1.9964981f, 0.9976207f}, {0.9985981f, -1.9971961f, 0.9985981f, -1.9966348f, 0.9977575f}, {0.9986635f, -1.997327f, 0.9986635f, -1.9967656f, 0.9978884f}, {0.9987259f, -1.9974518f, 0.9987259f, -1.9968904f, 0.9980133f}, {0.9987853f, -1.9975706f, 0.9987853f, -1.9970091f, 0.9981321f}, {0.9988416f, -1.9976833f, 0.9988416f, -1.9971218f, 0.9982448f}, {0.998895f, -1.99779f, 0.998895f, -1.9972285f, 0.9983516f}, {0.9989454f, -1.9978908f, 0.9989454f, -1.9973293f, 0.9984524f}, {0.998993f, -1.9979859f, 0.998993f, -1.9974243f, 0.9985475f}},
-      {{0.9633315f, -1.9266629f, 0.9633315f, -1.9259869f, 0.927339f}, {0.9636028f, -1.9272056f, 0.9636028f, -1.9265293f, 0.9278818f}, {0.9643929f, -1.9287859f, 0.9643929f, -1.9281091f, 0.9294626f}, {0.9656356f, -1.9312712f, 0.9656356f, -1.9305935f, 0.9319488f}, {0.9672351f, -1.9344701f, 0.9672351f, -1.9337913f, 0.9351489f}, {0.9690831f, -1.9381662f, 0.9690831f, -1.9374861f, 0.9388462f}, {0.9710743f, -1.9421485f, 0.9710743f, -1.941467f, 0.94283f}, {0.9731169f, -1.9462338f, 0.9731169f, -1.9455509f, 0.9469167f}, {0.9751386f, -1.9502772f, 0.9751386f, -1.9495928f, 0.9509615f}, {0.977087f, -1.9541739f, 0.977087f, -1.9534883f, 0.9548596f}, {0.9789279f, -1.9578559f, 0.9789279f, -1.9571689f, 0.9585428f}, {0.9806421f, -1.9612841f, 0.9806421f, -1.9605959f, 0.9619723f}, {0.9822211f, -1.9644421f, 0.9822211f, -1.9637529f, 0.9651314f}, {0.9836645f, -1.967329f, 0.9836645f, -1.9666387f, 0.9680193f}, {0.9849769f, -1.9699537f, 0.9849769f, -1.9692625f, 0.9706449f}, {0.9861659f, -1.9723317f, 0.9861659f, -1.9716397f, 0.9730238f}, {0.9872408f, -1.9744815f, 0.9872408f, -1.9737887f, 0.9751743f}, {0.9882114f, -1.9764229f, 0.9882114f, -1.9757294f, 0.9771163f}, {0.9890877f, -1.9781754f, 0.9890877f, -1.9774813f, 0.9788695f}, {0.989879f, -1.9797579f, 0.989879f, -1.9790632f, 0.9804526f}, {0.990594f, -1.9811881f, 0.990594f, -1.9804929f, 0.9818832f}, {0.991241f, -1.982482f, 0.991241f, -1.9817864f, 0.9831776f}, {0.9918271f, -1.9836542f, 0.9918271f, -1.9829582f, 0.9843503f}, {0.9923589f, -1.9847179f, 0.9923589f, -1.9840215f, 0.9854143f}, {0.9928423f, -1.9856846f, 0.9928423f, -1.9849879f, 0.9863814f}, {0.9932824f, -1.9865649f, 0.9932824f, -1.9858678f, 0.9872619f}, {0.9936839f, -1.9873677f, 0.9936839f, -1.9866704f, 0.9880651f}, {0.9940507f, -1.9881014f, 0.9940507f, -1.9874038f, 0.988799f}, {0.9943866f, -1.9887731f, 0.9943866f, -1.9880753f, 0.9894709f}, {0.9946946f, -1.9893892f, 0.9946946f, -1.9886911f, 0.9900872f}, {0.9949776f, -1.9899552f, 0.9949776f, -1.989257f, 0.9906534f}, {0.9952381f, -1.9904762f, 0.9952381f, -1.9897778f, 0.9911747f}, {0.9954783f, -1.9909567f, 0.9954783f, -1.9902581f, 0.9916553f}, {0.9957002f, -1.9914004f, 0.9957002f, -1.9907017f, 0.9920992f}, {0.9959055f, -1.991811f, 0.9959055f, -1.9911121f, 0.9925099f}, {0.9960957f, -1.9921915f, 0.9960957f, -1.9914925f, 0.9928905f}, {0.9962723f, -1.9925446f, 0.9962723f, -1.9918455f, 0.9932438f}, {0.9964365f, -1.9928729f, 0.9964365f, -1.9921737f, 0.9935722f}, {0.9965893f, -1.9931785f, 0.9965893f, -1.9924792f, 0.9938779f}, {0.9967317f, -1.9934635f, 0.9967317f, -1.992764f, 0.9941629f}, {0.9968647f, -1.9937295f, 0.9968647f, -1.9930299f, 0.994429f}, {0.9969891f, -1.9939782f, 0.9969891f, -1.9932785f, 0.9946778f}, {0.9971055f, -1.994211f, 0.9971055f, -1.9935112f, 0.9949107f}, {0.9972146f, -1.9944292f, 0.9972146f, -1.9937294f, 0.995129f}, {0.997317f, -1.9946339f, 0.997317f, -1.9939341f, 0.9953338f}, {0.9974154f, -1.9948309f, 0.9974154f, -1.9941309f, 0.9955308f}, {0.9975133f, -1.9950267f, 0.9975133f, -1.9943267f, 0.9957267f}, {0.9976104f, -1.9952208f, 0.9976104f, -1.9945207f, 0.9959209f}, {0.9977063f, -1.9954127f, 0.9977063f, -1.9947125f, 0.9961128f}, {0.9978008f, -1.9956016f, 0.9978008f, -1.9949013f, 0.9963018f}, {0.9978934f, -1.9957869f, 0.9978934f, -1.9950866f, 0.9964871f}, {0.997984f, -1.995968f, 0.997984f, -1.9952676f, 0.9966683f}, {0.9980721f, -1.9961443f, 0.9980721f, -1.9954439f, 0.9968447f}, {0.9981577f, -1.9963153f, 0.9981577f, -1.9956149f, 0.9970158f}, {0.9982403f, -1.9964806f, 0.9982403f, -1.9957801f, 0.9971812f}, {0.9983199f, -1.9966398f, 0.9983199f, -1.9959393f, 0.9973404f}, {0.9983963f, -1.9967927f, 0.9983963f, -1.996092f, 0.9974933f}, {0.9984694f, -1.9969389f, 0.9984694f, -1.9962382f, 0.9976396f}, {0.9985392f, -1.9970784f, 0.9985392f, -1.9963777f, 0.9977791f}, {0.9986056f, -1.9972111f, 0.9986056f, -1.9965104f, 0.9979119f}, {0.9986686f, -1.9973371f, 0.9986686f, -1.9966363f, 0.9980379f}, {0.9987282f, -1.9974564f, 0.9987282f, -1.9967555f, 0.9981573f}, {0.9987845f, -1.9975691f, 0.9987845f, -1.9968682f, 0.99827f}, {0.9988377f, -1.9976754f, 0.9988377f, -1.9969744f, 0.9983763f}},
-      {{0.9591338f, -1.9182675f, 0.9591338f, -1.9174273f, 0.9191077f}, {0.9594345f, -1.918869f, 0.9594345f, -1.9180285f, 0.9197095f}, {0.9603105f, -1.9206209f, 0.9603105f, -1.9197797f, 0.9214622f}, {0.9616884f, -1.9233768f, 0.9616884f, -1.9225344f, 0.9242193f}, {0.9634626f, -1.9269252f, 0.9634626f, -1.9260812f, 0.9277692f}, {0.9655133f, -1.9310267f, 0.9655133f, -1.9301809f, 0.9318725f}, {0.9677239f, -1.9354479f, 0.9677239f, -1.9346001f, 0.9362956f}, {0.9699927f, -1.9399855f, 0.9699927f, -1.9391358f, 0.9408352f}, {0.9722393f, -1.9444787f, 0.9722393f, -1.943627f, 0.9453304f}, {0.9744055f, -1.948811f, 0.9744055f, -1.9479574f, 0.9496646f}, {0.9764531f, -1.9529063f, 0.9764531f, -1.9520509f, 0.9537617f}, {0.9783605f, -1.956721f, 0.9783605f, -1.9558639f, 0.9575781f}, {0.9801182f, -1.9602364f, 0.9801182f, -1.9593778f, 0.961095f}, {0.9817255f, -1.9634511f, 0.9817255f, -1.962591f, 0.9643111f}, {0.9831874f, -1.9663748f, 0.9831874f, -1.9655135f, 0.9672361f}, {0.9845123f, -1.9690246f, 0.9845123f, -1.9681621f, 0.969887f}, {0.9857103f, -1.9714206f, 0.9857103f, -1.9705571f, 0.9722841f}, {0.9867924f, -1.9735848f, 0.9867924f, -1.9727204f, 0.9744493f}, {0.9877695f, -1.975539f, 0.9877695f, -1.9746737f, 0.9764043f}, {0.988652f, -1.977304f, 0.988652f, -1.9764379f, 0.97817f}, {0.9894496f, -1.9788993f, 0.9894496f, -1.9780325f, 0.9797661f}, {0.9901714f, -1.9803429f, 0.9901714f, -1.9794754f, 0.9812103f}, {0.9908254f, -1.9816509f, 0.9908254f, -1.9807829f, 0.9825189f}, {0.9914189f, -1.9828379f, 0.9914189f, -1.9819694f, 0.9837064f}, {0.9919584f, -1.9839169f, 0.9919584f, -1.9830479f, 0.9847858f}, {0.9924497f, -1.9848994f, 0.9924497f, -1.98403f, 0.9857688f}, {0.9928978f, -1.9857957f, 0.9928978f, -1.9849259f, 0.9866655f}, {0.9933074f, -1.9866148f, 0.9933074f, -1.9857446f, 0.9874849f}, {0.9936824f, -1.9873647f, 0.9936824f, -1.9864942f, 0.9882352f}, {0.9940263f, -1.9880526f, 0.9940263f, -1.9871818f, 0.9889234f}, {0.9943424f, -1.9886847f, 0.9943424f, -1.9878136f, 0.9895558f}, {0.9946333f, -1.9892666f, 0.9946333f, -1.9883953f, 0.9901379f}, {0.9949016f, -1.9898032f, 0.9949016f, -1.9889316f, 0.9906747f}, {0.9951494f, -1.9902988f, 0.9951494f, -1.989427f, 0.9911706f}, {0.9953787f, -1.9907574f, 0.9953787f, -1.9898854f, 0.9916293f}, {0.9955912f, -1.9911824f, 0.9955912f, -1.9903102f, 0.9920545f}, {0.9957884f, -1.9915768f, 0.9957884f, -1.9907045f, 0.9924492f}, {0.9959718f, -1.9919436f, 0.9959718f, -1.9910711f, 0.9928161f}, {0.9961425f, -1.992285f, 0.9961425f, -1.9914123f, 0.9931576f}, {0.9963016f, -1.9926033f, 0.9963016f, -1.9917305f, 0.9934761f}, {0.9964502f, -1.9929005f, 0.9964502f, -1.9920276f, 0.9937734f}, {0.9965892f, -1.9931783f, 0.9965892f, -1.9923053f, 0.9940514f}, {0.9967192f, -1.9934384f, 0.9967192f, -1.9925653f, 0.9943116f}, {0.9968411f, -1.9936822f, 0.9968411f, -1.992809f, 0.9945555f}, {0.9969555f, -1.993911f, 0.9969555f, -1.9930377f, 0.9947844f}, {0.9970655f, -1.9941311f, 0.9970655f, -1.9932576f, 0.9950045f}, {0.9971749f, -1.9943499f, 0.9971749f, -1.9934763f, 0.9952234f}, {0.9972834f, -1.9945668f, 0.9972834f, -1.9936932f, 0.9954404f}, {0.9973906f, -1.9947812f, 0.9973906f, -1.9939074f, 0.9956549f}, {0.9974961f, -1.9949922f, 0.9974961f, -1.9941184f, 0.9958661f}, {0.9975997f, -1.9951993f, 0.9975997f, -1.9943254f, 0.9960732f}, {0.9977009f, -1.9954017f, 0.9977009f, -1.9945277f, 0.9962757f}, {0.9977994f, -1.9955988f, 0.9977994f, -1.9947247f, 0.9964729f}, {0.997895f, -1.9957899f, 0.997895f, -1.9949157f, 0.9966641f}, {0.9979873f, -1.9959746f, 0.9979873f, -1.9951004f, 0.9968489f}, {0.9980763f, -1.9961526f, 0.9980763f, -1.9952782f, 0.9970269f}, {0.9981617f, -1.9963234f, 0.9981617f, -1.995449f, 0.9971978f}, {0.9982434f, -1.9964868f, 0.9982434f, -1.9956123f, 0.9973613f}, {0.9983214f, -1.9966427f, 0.9983214f, -1.9957682f, 0.9975173f}, {0.9983955f, -1.9967911f, 0.9983955f, -1.9959165f, 0.9976657f}, {0.9984659f, -1.9969319f, 0.9984659f, -1.9960572f, 0.9978066f}, {0.9985326f, -1.9970652f, 0.9985326f, -1.9961905f, 0.9979399f}, {0.9985956f, -1.9971912f, 0.9985956f, -1.9963164f, 0.9980659f}, {0.998655f, -1.99731f, 0.998655f, -1.9964351f, 0.9981848f}},
-      {{0.9544686f, -1.9089372f, 0.9544686f, -1.9078934f, 0.9099809f}, {0.9548016f, -1.9096033f, 0.9548016f, -1.9085591f, 0.9106474f}, {0.9557719f, -1.9115437f, 0.9557719f, -1.9104985f, 0.9125889f}, {0.9572985f, -1.914597f, 0.9572985f, -1.9135501f, 0.9156438f}, {0.9592648f, -1.9185297f, 0.9592648f, -1.9174807f, 0.9195787f}, {0.9615387f, -1.9230774f, 0.9615387f, -1.9220259f, 0.924129f}, {0.9639911f, -1.9279821f, 0.9639911f, -1.926928f, 0.9290363f}, {0.9665093f, -1.9330187f, 0.9665093f, -1.9319618f, 0.9340756f}, {0.9690043f, -1.9380086f, 0.9690043f, -1.9369489f, 0.9390682f}, {0.9714111f, -1.9428223f, 0.9714111f, -1.94176f, 0.9438846f}, {0.9736874f, -1.9473749f, 0.9736874f, -1.9463101f, 0.9484397f}, {0.9758088f, -1.9516176f, 0.9758088f, -1.9505505f, 0.9526847f}, {0.9777646f, -1.9555291f, 0.9777646f, -1.9544599f, 0.9565984f}, {0.9795537f, -1.9591074f, 0.9795537f, -1.9580362f, 0.9601786f}, {0.9811815f, -1.962363f, 0.9811815f, -1.9612901f, 0.963436f}, {0.9826573f, -1.9653145f, 0.9826573f, -1.9642399f, 0.9663891f}, {0.9839921f, -1.9679842f, 0.9839921f, -1.9669082f, 0.9690603f}, {0.9851981f, -1.9703963f, 0.9851981f, -1.9693189f, 0.9714736f}, {0.9862874f, -1.9725747f, 0.9862874f, -1.9714962f, 0.9736533f}, {0.9872714f, -1.9745427f, 0.9872714f, -1.9734631f, 0.9756224f}, {0.988161f, -1.9763219f, 0.988161f, -1.9752413f, 0.9774025f}, {0.9889661f, -1.9779322f, 0.9889661f, -1.9768507f, 0.9790137f}, {0.9896957f, -1.9793914f, 0.9896957f, -1.9783091f, 0.9804737f}, {0.9903579f, -1.9807159f, 0.9903579f, -1.9796329f, 0.9817989f}, {0.99096f, -1.98192f, 0.99096f, -1.9808363f, 0.9830036f}, {0.9915083f, -1.9830165f, 0.9915083f, -1.9819323f, 0.9841008f}, {0.9920085f, -1.984017f, 0.9920085f, -1.9829321f, 0.9851018f}, {0.9924657f, -1.9849313f, 0.9924657f, -1.983846f, 0.9860167f}, {0.9928843f, -1.9857686f, 0.9928843f, -1.9846828f, 0.9868544f}, {0.9932683f, -1.9865366f, 0.9932683f, -1.9854504f, 0.9876229f}, {0.9936212f, -1.9872425f, 0.9936212f, -1.9861559f, 0.988329f}, {0.9939461f, -1.9878922f, 0.9939461f, -1.9868053f, 0.9889792f}, {0.9942457f, -1.9884914f, 0.9942457f, -1.9874042f, 0.9895787f}, {0.9945225f, -1.989045f, 0.9945225f, -1.9879574f, 0.9901326f}, {0.9947786f, -1.9895572f, 0.9947786f, -1.9884693f, 0.990645f}, {0.9950159f, -1.9900319f, 0.9950159f, -1.9889437f, 0.99112f}, {0.9952362f, -1.9904725f, 0.9952362f, -1.9893841f, 0.9915609f}, {0.9954411f, -1.9908821f, 0.9954411f, -1.9897936f, 0.9919707f}, {0.9956318f, -1.9912635f, 0.9956318f, -1.9901747f, 0.9923523f}, {0.9958096f, -1.9916191f, 0.9958096f, -1.9905302f, 0.9927081f}, {0.9959756f, -1.9919512f, 0.9959756f, -1.990862f, 0.9930403f}, {0.9961308f, -1.9922616f, 0.9961308f, -1.9911722f, 0.9933509f}, {0.9962761f, -1.9925522f, 0.9962761f, -1.9914627f, 0.9936417f}, {0.9964123f, -1.9928246f, 0.9964123f, -1.9917349f, 0.9939142f}, {0.9965401f, -1.9930802f, 0.9965401f, -1.9919904f, 0.99417f}, {0.996663f, -1.9933261f, 0.996663f, -1.9922361f, 0.994416f}, {0.9967853f, -1.9935705f, 0.9967853f, -1.9924805f, 0.9946606f}, {0.9969065f, -1.9938129f, 0.9969065f, -1.9927228f, 0.9949031f}, {0.9970262f, -1.9940525f, 0.9970262f, -1.9929622f, 0.9951428f}, {0.9971442f, -1.9942884f, 0.9971442f, -1.9931979f, 0.9953788f}, {0.9972599f, -1.9945198f, 0.9972599f, -1.9934292f, 0.9956103f}, {0.997373f, -1.9947459f, 0.997373f, -1.9936553f, 0.9958366f}, {0.9974831f, -1.9949662f, 0.9974831f, -1.9938753f, 0.996057f}, {0.9975899f, -1.9951798f, 0.9975899f, -1.9940888f, 0.9962707f}, {0.9976931f, -1.9953862f, 0.9976931f, -1.9942952f, 0.9964773f}, {0.9977925f, -1.9955851f, 0.9977925f, -1.9944939f, 0.9966762f}, {0.997888f, -1.995776f, 0.997888f, -1.9946847f, 0.9968672f}, {0.9979793f, -1.9959586f, 0.9979793f, -1.9948673f, 0.99705f}, {0.9980665f, -1.9961329f, 0.9980665f, -1.9950415f, 0.9972244f}, {0.9981494f, -1.9962987f, 0.9981494f, -1.9952072f, 0.9973903f}, {0.9982281f, -1.9964561f, 0.9982281f, -1.9953645f, 0.9975477f}, {0.9983026f, -1.9966051f, 0.9983026f, -1.9955134f, 0.9976968f}, {0.998373f, -1.9967459f, 0.998373f, -1.9956541f, 0.9978377f}, {0.9984394f, -1.9968787f, 0.9984394f, -1.9957868f, 0.9979706f}},
-      {{0.949287f, -1.898574f, 0.949287f, -1.8972781f, 0.89987f}, {0.9496555f, -1.899311f, 0.9496555f, -1.8980145f, 0.9006074f}, {0.950729f, -1.9014581f, 0.950729f, -1.9001602f, 0.902756f}, {0.9524187f, -1.9048375f, 0.9524187f, -1.9035373f, 0.9061377f}, {0.954596f, -1.9091921f, 0.954596f, -1.9078889f, 0.9104952f}, {0.9571151f, -1.9142302f, 0.9571151f, -1.9129236f, 0.9155368f}, {0.9598334f, -1.9196668f, 0.9598334f, -1.9183565f, 0.9209771f}, {0.9626264f, -1.9252528f, 0.9626264f, -1.9239387f, 0.9265669f}, {0.9653952f, -1.9307903f, 0.9653952f, -1.9294724f, 0.9321082f}, {0.9680677f, -1.9361354f, 0.9680677f, -1.9348139f, 0.937457f}, {0.9705967f, -1.9411934f, 0.9705967f, -1.9398684f, 0.9425184f}, {0.9729548f, -1.9459095f, 0.9729548f, -1.9445813f, 0.9472377f}, {0.9751298f, -1.9502596f, 0.9751298f, -1.9489283f, 0.9515908f}, {0.9771204f, -1.9542407f, 0.9771204f, -1.9529068f, 0.9555747f}, {0.9789322f, -1.9578645f, 0.9789322f, -1.9565281f, 0.9592009f}, {0.9805754f, -1.9611509f, 0.9805754f, -1.9598122f, 0.9624895f}, {0.9820622f, -1.9641245f, 0.9820622f, -1.9627838f, 0.9654651f}, {0.9834059f, -1.9668119f, 0.9834059f, -1.9654694f, 0.9681544f}, {0.9846199f, -1.9692397f, 0.9846199f, -1.9678956f, 0.9705839f}, {0.9857168f, -1.9714335f, 0.9857168f, -1.9700879f, 0.9727792f}, {0.9867087f, -1.9734173f, 0.9867087f, -1.9720703f, 0.9747643f}, {0.9876065f, -1.9752131f, 0.9876065f, -1.9738648f, 0.9765613f}, {0.9884204f, -1.9768408f, 0.9884204f, -1.9754914f, 0.9781901f}, {0.9891592f, -1.9783183f, 0.9891592f, -1.976968f, 0.9796687f}, {0.9898309f, -1.9796618f, 0.9898309f, -1.9783105f, 0.9810131f}, {0.9904427f, -1.9808855f, 0.9904427f, -1.9795334f, 0.9822376f}, {0.991001f, -1.982002f, 0.991001f, -1.9806491f, 0.9833549f}, {0.9915113f, -1.9830226f, 0.9915113f, -1.9816691f, 0.9843762f}, {0.9919786f, -1.9839573f, 0.9919786f, -1.9826031f, 0.9853115f}, {0.9924074f, -1.9848147f, 0.9924074f, -1.9834599f, 0.9861695f}, {0.9928014f, -1.9856027f, 0.9928014f, -1.9842474f, 0.9869581f}, {0.9931641f, -1.9863283f, 0.9931641f, -1.9849724f, 0.9876841f}, {0.9934987f, -1.9869974f, 0.9934987f, -1.9856411f, 0.9883537f}, {0.9938078f, -1.9876156f, 0.9938078f, -1.9862589f, 0.9889723f}, {0.9940938f, -1.9881876f, 0.9940938f, -1.9868305f, 0.9895447f}, {0.9943589f, -1.9887178f, 0.9943589f, -1.9873603f, 0.9900752f}, {0.994605f, -1.9892099f, 0.994605f, -1.9878521f, 0.9905677f}, {0.9948337f, -1.9896675f, 0.9948337f, -1.9883094f, 0.9910256f}, {0.9950468f, -1.9900935f, 0.9950468f, -1.9887351f, 0.9914519f}, {0.9952454f, -1.9904908f, 0.9952454f, -1.9891321f, 0.9918494f}, {0.9954308f, -1.9908617f, 0.9954308f, -1.9895028f, 0.9922206f}, {0.9956042f, -1.9912085f, 0.9956042f, -1.9898493f, 0.9925676f}, {0.9957666f, -1.9915331f, 0.9957666f, -1.9901738f, 0.9928925f}, {0.9959187f, -1.9918375f, 0.9959187f, -1.9904779f, 0.9931971f}, {0.9960615f, -1.9921231f, 0.9960615f, -1.9907633f, 0.9934829f}, {0.9961989f, -1.9923978f, 0.9961989f, -1.9910378f, 0.9937578f}, {0.9963355f, -1.992671f, 0.9963355f, -1.9913108f, 0.9940311f}, {0.9964709f, -1.9929418f, 0.9964709f, -1.9915815f, 0.9943022f}, {0.9966048f, -1.9932095f, 0.9966048f, -1.991849f, 0.99457f}, {0.9967366f, -1.9934731f, 0.9967366f, -1.9921124f, 0.9948338f}, {0.9968659f, -1.9937317f, 0.9968659f, -1.9923708f, 0.9950926f}, {0.9969922f, -1.9939845f, 0.9969922f, -1.9926234f, 0.9953455f}, {0.9971153f, -1.9942306f, 0.9971153f, -1.9928693f, 0.9955918f}, {0.9972346f, -1.9944693f, 0.9972346f, -1.9931079f, 0.9958307f}, {0.99735f, -1.9947f, 0.99735f, -1.9933385f, 0.9960616f}, {0.9974611f, -1.9949223f, 0.9974611f, -1.9935606f, 0.996284f}, {0.9975678f, -1.9951356f, 0.9975678f, -1.9937738f, 0.9964975f}, {0.9976699f, -1.9953398f, 0.9976699f, -1.9939778f, 0.9967018f}, {0.9977673f, -1.9955346f, 0.9977673f, -1.9941725f, 0.9968967f}, {0.99786f, -1.9957199f, 0.99786f, -1.9943577f, 0.9970821f}, {0.9979479f, -1.9958958f, 0.9979479f, -1.9945335f, 0.9972582f}, {0.9980312f, -1.9960624f, 0.9980312f, -1.9946999f, 0.9974248f}, {0.9981099f, -1.9962198f, 0.9981099f, -1.9948572f, 0.9975823f}, {0.9981841f, -1.9963682f, 0.9981841f, -1.9950055f, 0.9977309f}},
-      {{0.9435358f, -1.8870717f, 0.9435358f, -1.8854637f, 0.8886797f}, {0.943943f, -1.887886f, 0.943943f, -1.8862773f, 0.8894947f}, {0.9451296f, -1.8902591f, 0.9451296f, -1.8886484f, 0.8918699f}, {0.9469977f, -1.8939954f, 0.9469977f, -1.8923815f, 0.8956094f}, {0.9494061f, -1.8988122f, 0.9494061f, -1.8971942f, 0.9004302f}, {0.952194f, -1.904388f, 0.952194f, -1.9027653f, 0.9060108f}, {0.9552043f, -1.9104086f, 0.9552043f, -1.9087807f, 0.9120365f}, {0.9582993f, -1.9165987f, 0.9582993f, -1.9149655f, 0.9182318f}, {0.9613695f, -1.922739f, 0.9613695f, -1.9211006f, 0.9243774f}, {0.9643349f, -1.9286698f, 0.9643349f, -1.9270264f, 0.9303133f}, {0.9671427f, -1.9342854f, 0.9671427f, -1.9326372f, 0.9359337f}, {0.9697623f, -1.9395246f, 0.9697623f, -1.9378719f, 0.9411773f}, {0.9721798f, -1.9443596f, 0.9721798f, -1.9427028f, 0.9460164f}, {0.9743934f, -1.9487868f, 0.9743934f, -1.9471262f, 0.9504474f}, {0.9764092f, -1.9528184f, 0.9764092f, -1.9511544f, 0.9544824f}, {0.978238f, -1.9564761f, 0.978238f, -1.9548089f, 0.9581432f}, {0.9798935f, -1.9597869f, 0.9798935f, -1.958117f, 0.9614569f}, {0.9813901f, -1.9627801f, 0.9813901f, -1.9611076f, 0.9644526f}, {0.9827425f, -1.965485f, 0.9827425f, -1.9638101f, 0.9671598f}, {0.9839649f, -1.9679298f, 0.9839649f, -1.9662529f, 0.9696067f}, {0.9850706f, -1.9701411f, 0.9850706f, -1.9684623f, 0.9718199f}, {0.9860716f, -1.9721433f, 0.9860716f, -1.9704628f, 0.9738238f}, {0.9869792f, -1.9739584f, 0.9869792f, -1.9722764f, 0.9756405f}, {0.9878032f, -1.9756064f, 0.9878032f, -1.973923f, 0.9772899f}, {0.9885526f, -1.9771052f, 0.9885526f, -1.9754204f, 0.9787899f}, {0.9892352f, -1.9784705f, 0.9892352f, -1.9767846f, 0.9801564f}, {0.9898582f, -1.9797164f, 0.9898582f, -1.9780294f, 0.9814033f}, {0.9904277f, -1.9808554f, 0.9904277f, -1.9791675f, 0.9825433f}, {0.9909493f, -1.9818986f, 0.9909493f, -1.9802098f, 0.9835874f}, {0.9914279f, -1.9828557f, 0.9914279f, -1.9811661f, 0.9845454f}, {0.9918677f, -1.9837355f, 0.9918677f, -1.9820451f, 0.9854259f}, {0.9922728f, -1.9845455f, 0.9922728f, -1.9828545f, 0.9862366f}, {0.9926463f, -1.9852927f, 0.9926463f, -1.983601f, 0.9869844f}, {0.9929915f, -1.9859829f, 0.9929915f, -1.9842906f, 0.9876752f}, {0.9933109f, -1.9866217f, 0.9933109f, -1.9849289f, 0.9883146f}, {0.9936069f, -1.9872138f, 0.9936069f, -1.9855205f, 0.9889072f}, {0.9938818f, -1.9877635f, 0.9938818f, -1.9860697f, 0.9894573f}, {0.9941373f, -1.9882746f, 0.9941373f, -1.9865804f, 0.9899689f}, {0.9943752f, -1.9887505f, 0.9943752f, -1.9870558f, 0.9904451f}, {0.9945971f, -1.9891942f, 0.9945971f, -1.9874992f, 0.9908893f}, {0.9948043f, -1.9896086f, 0.9948043f, -1.9879132f, 0.991304f}, {0.994998f, -1.989996f, 0.994998f, -1.9883003f, 0.9916917f}, {0.9951794f, -1.9903587f, 0.9951794f, -1.9886627f, 0.9920547f}, {0.9953494f, -1.9906987f, 0.9953494f, -1.9890024f, 0.992395f}, {0.9955089f, -1.9910178f, 0.9955089f, -1.9893212f, 0.9927144f}, {0.9956624f, -1.9913248f, 0.9956624f, -1.9896279f, 0.9930216f}, {0.995815f, -1.99163f, 0.995815f, -1.9899329f, 0.9933271f}, {0.9959663f, -1.9919326f, 0.9959663f, -1.9902353f, 0.99363f}, {0.9961159f, -1.9922318f, 0.9961159f, -1.9905341f, 0.9939294f}, {0.9962632f, -1.9925263f, 0.9962632f, -1.9908284f, 0.9942242f}, {0.9964076f, -1.9928153f, 0.9964076f, -1.9911172f, 0.9945134f}, {0.9965489f, -1.9930977f, 0.9965489f, -1.9913994f, 0.9947961f}, {0.9966864f, -1.9933728f, 0.9966864f, -1.9916742f, 0.9950714f}, {0.9968198f, -1.9936396f, 0.9968198f, -1.9919408f, 0.9953384f}, {0.9969487f, -1.9938975f, 0.9969487f, -1.9921984f, 0.9955965f}, {0.9970729f, -1.9941459f, 0.9970729f, -1.9924466f, 0.9958451f}, {0.9971922f, -1.9943843f, 0.9971922f, -1.9926849f, 0.9960838f}, {0.9973062f, -1.9946125f, 0.9973062f, -1.9929128f, 0.9963121f}, {0.9974151f, -1.9948302f, 0.9974151f, -1.9931304f, 0.9965301f}, {0.9975187f, -1.9950374f, 0.9975187f, -1.9933374f, 0.9967374f}, {0.997617f, -1.995234f, 0.997617f, -1.9935338f, 0.9969342f}, {0.9977101f, -1.9954202f, 0.9977101f, -1.9937199f, 0.9971205f}, {0.9977981f, -1.9955961f, 0.9977981f, -1.9938956f, 0.9972966f}, {0.997881f, -1.995762f, 0.997881f, -1.9940614f, 0.9974627f}},
-      {{0.9371573f, -1.8743145f, 0.9371573f, -1.8723206f, 0.8763084f}, {0.9376067f, -1.8752133f, 0.9376067f, -1.8732185f, 0.8772082f}, {0.9389165f, -1.8778329f, 0.9389165f, -1.8758353f, 0.8798306f}, {0.9409794f, -1.8819589f, 0.9409794f, -1.8799568f, 0.8839609f}, {0.9436403f, -1.8872806f, 0.9436403f, -1.8852729f, 0.8892882f}, {0.9467224f, -1.8934447f, 0.9467224f, -1.8914305f, 0.895459f}, {0.9500526f, -1.9001051f, 0.9500526f, -1.8980838f, 0.9021264f}, {0.9534789f, -1.9069579f, 0.9534789f, -1.9049293f, 0.9089865f}, {0.9568803f, -1.9137606f, 0.9568803f, -1.9117247f, 0.9157964f}, {0.9601679f, -1.9203358f, 0.9601679f, -1.918293f, 0.9223787f}, {0.963283f, -1.9265659f, 0.963283f, -1.9245164f, 0.9286154f}, {0.966191f, -1.932382f, 0.966191f, -1.9303263f, 0.9344377f}, {0.9688763f, -1.9377527f, 0.9688763f, -1.9356913f, 0.9398141f}, {0.9713365f, -1.9426731f, 0.9713365f, -1.9406065f, 0.9447397f}, {0.973578f, -1.947156f, 0.973578f, -1.9450846f, 0.9492274f}, {0.9756125f, -1.951225f, 0.9756125f, -1.9491493f, 0.9533007f}, {0.9774549f, -1.9549097f, 0.9774549f, -1.9528301f, 0.9569893f}, {0.9791211f, -1.9582421f, 0.9791211f, -1.9561589f, 0.9603253f}, {0.9806273f, -1.9612545f, 0.9806273f, -1.9591681f, 0.9633409f}, {0.9819891f, -1.9639782f, 0.9819891f, -1.9618889f, 0.9660675f}, {0.9832212f, -1.9664424f, 0.9832212f, -1.9643505f, 0.9685343f}, {0.984337f, -1.968674f, 0.984337f, -1.9665797f, 0.9707683f}, {0.9853488f, -1.9706977f, 0.9853488f, -1.9686013f, 0.9727941f}, {0.9862677f, -1.9725354f, 0.9862677f, -1.970437f, 0.9746338f}, {0.9871035f, -1.974207f, 0.9871035f, -1.9721068f, 0.9763072f}, {0.987865f, -1.97573f, 0.987865f, -1.9736282f, 0.9778318f}, {0.98856f, -1.97712f, 0.98856f, -1.9750168f, 0.9792233f}, {0.9891955f, -1.978391f, 0.9891955f, -1.9762864f, 0.9804956f}, {0.9897776f, -1.9795552f, 0.9897776f, -1.9774493f, 0.9816611f}, {0.9903117f, -1.9806235f, 0.9903117f, -1.9785165f, 0.9827305f}, {0.9908027f, -1.9816055f, 0.9908027f, -1.9794974f, 0.9837135f}, {0.9912549f, -1.9825098f, 0.9912549f, -1.9804008f, 0.9846188f}, {0.9916719f, -1.9833439f, 0.9916719f, -1.981234f, 0.9854538f}, {0.9920573f, -1.9841146f, 0.9920573f, -1.9820039f, 0.9862253f}, {0.992414f, -1.9848279f, 0.992414f, -1.9827164f, 0.9869394f}, {0.9927446f, -1.9854891f, 0.9927446f, -1.983377f, 0.9876013f}, {0.9930515f, -1.986103f, 0.9930515f, -1.9839902f, 0.9882158f}, {0.9933369f, -1.9866738f, 0.9933369f, -1.9845604f, 0.9887872f}, {0.9936027f, -1.9872053f, 0.9936027f, -1.9850913f, 0.9893193f}, {0.9938505f, -1.987701f, 0.9938505f, -1.9855865f, 0.9898155f}, {0.9940819f, -1.9881638f, 0.9940819f, -1.9860488f, 0.9902789f}, {0.9942983f, -1.9885966f, 0.9942983f, -1.9864812f, 0.9907121f}, {0.9945009f, -1.9890018f, 0.9945009f, -1.9868859f, 0.9911177f}, {0.9946908f, -1.9893817f, 0.9946908f, -1.9872654f, 0.991498f}, {0.9948691f, -1.9897382f, 0.9948691f, -1.9876215f, 0.9918549f}, {0.9950406f, -1.9900812f, 0.9950406f, -1.9879641f, 0.9921982f}, {0.9952111f, -1.9904222f, 0.9952111f, -1.9883048f, 0.9925396f}, {0.9953802f, -1.9907603f, 0.9953802f, -1.9886426f, 0.9928781f}, {0.9955473f, -1.9910946f, 0.9955473f, -1.9889764f, 0.9932127f}, {0.9957119f, -1.9914237f, 0.9957119f, -1.9893052f, 0.9935422f}, {0.9958733f, -1.9917466f, 0.9958733f, -1.9896278f, 0.9938655f}, {0.9960311f, -1.9920623f, 0.9960311f, -1.9899431f, 0.9941815f}, {0.9961848f, -1.9923697f, 0.9961848f, -1.9902502f, 0.9944891f}, {0.9963339f, -1.9926678f, 0.9963339f, -1.990548f, 0.9947876f}, {0.996478f, -1.992956f, 0.996478f, -1.9908359f, 0.9950762f}, {0.9966168f, -1.9932337f, 0.9966168f, -1.9911133f, 0.9953541f}, {0.9967501f, -1.9935002f, 0.9967501f, -1.9913795f, 0.9956209f}, {0.9968776f, -1.9937552f, 0.9968776f, -1.9916343f, 0.9958762f}, {0.9969993f, -1.9939986f, 0.9969993f, -1.9918774f, 0.9961198f}, {0.9971151f, -1.9942302f, 0.9971151f, -1.9921087f, 0.9963516f}, {0.997225f, -1.9944499f, 0.997225f, -1.9923282f, 0.9965716f}, {0.997329f, -1.9946581f, 0.997329f, -1.9925361f, 0.99678f}, {0.9974274f, -1.9948547f, 0.9974274f, -1.9927326f, 0.9969769f}, {0.9975201f, -1.9950402f, 0.9975201f, -1.9929179f, 0.9971625f}},
-      {{0.9300888f, -1.8601777f, 0.9300888f, -1.8577071f, 0.8626482f}, {0.9305841f, -1.8611683f, 0.9305841f, -1.8586964f, 0.8636401f}, {0.932028f, -1.864056f, 0.932028f, -1.8615803f, 0.8665317f}, {0.934303f, -1.868606f, 0.934303f, -1.8661243f, 0.8710877f}, {0.937239f, -1.874478f, 0.937239f, -1.8719884f, 0.8769675f}, {0.9406421f, -1.8812842f, 0.9406421f, -1.8787856f, 0.8837827f}, {0.9443219f, -1.8886438f, 0.9443219f, -1.8861354f, 0.8911521f}, {0.948111f, -1.896222f, 0.948111f, -1.8937036f, 0.8987404f}, {0.9518755f, -1.903751f, 0.9518755f, -1.9012226f, 0.9062794f}, {0.955517f, -1.9110339f, 0.955517f, -1.9084959f, 0.913572f}, {0.9589699f, -1.9179398f, 0.9589699f, -1.9153925f, 0.920487f}, {0.9621957f, -1.9243913f, 0.9621957f, -1.9218355f, 0.9269472f}, {0.9651764f, -1.9303528f, 0.9651764f, -1.9277891f, 0.9329165f}, {0.9679089f, -1.9358177f, 0.9679089f, -1.9332467f, 0.9383887f}, {0.9703998f, -1.9407995f, 0.9703998f, -1.9382219f, 0.9433772f}, {0.9726618f, -1.9453237f, 0.9726618f, -1.9427401f, 0.9479073f}, {0.9747112f, -1.9494224f, 0.9747112f, -1.9468333f, 0.9520115f}, {0.9765654f, -1.9531308f, 0.9765654f, -1.9505368f, 0.9557248f}, {0.9782422f, -1.9564843f, 0.9782422f, -1.9538859f, 0.9590828f}, {0.9797587f, -1.9595174f, 0.9797587f, -1.956915f, 0.9621199f}, {0.9811312f, -1.9622624f, 0.9811312f, -1.9596563f, 0.9648686f}, {0.9823746f, -1.9647491f, 0.9823746f, -1.9621397f, 0.9673585f}, {0.9835023f, -1.9670046f, 0.9835023f, -1.9643922f, 0.969617f}, {0.9845267f, -1.9690533f, 0.9845267f, -1.9664382f, 0.9716685f}, {0.9854586f, -1.9709172f, 0.9854586f, -1.9682996f, 0.9735348f}, {0.9863079f, -1.9726157f, 0.9863079f, -1.9699958f, 0.9752356f}, {0.9870831f, -1.9741662f, 0.9870831f, -1.9715443f, 0.9767882f}, {0.9877921f, -1.9755842f, 0.9877921f, -1.9729604f, 0.978208f}, {0.9884416f, -1.9768831f, 0.9884416f, -1.9742576f, 0.9795087f}, {0.9890376f, -1.9780753f, 0.9890376f, -1.9754481f, 0.9807024f}, {0.9895856f, -1.9791712f, 0.9895856f, -1.9765427f, 0.9817998f}, {0.9900903f, -1.9801806f, 0.9900903f, -1.9775507f, 0.9828105f}, {0.9905559f, -1.9811117f, 0.9905559f, -1.9784806f, 0.9837429f}, {0.9909861f, -1.9819722f, 0.9909861f, -1.9793399f, 0.9846045f}, {0.9913843f, -1.9827686f, 0.9913843f, -1.9801352f, 0.9854019f}, {0.9917534f, -1.9835069f, 0.9917534f, -1.9808726f, 0.9861412f}, {0.9920962f, -1.9841924f, 0.9920962f, -1.9815572f, 0.9868277f}, {0.9924149f, -1.9848299f, 0.9924149f, -1.9821938f, 0.987466f}, {0.9927117f, -1.9854235f, 0.9927117f, -1.9827866f, 0.9880604f}, {0.9929885f, -1.9859771f, 0.9929885f, -1.9833395f, 0.9886147f}, {0.993247f, -1.9864941f, 0.993247f, -1.9838558f, 0.9891324f}, {0.9934888f, -1.9869775f, 0.9934888f, -1.9843386f, 0.9896164f}, {0.9937151f, -1.9874302f, 0.9937151f, -1.9847906f, 0.9900697f}, {0.9939273f, -1.9878545f, 0.9939273f, -1.9852144f, 0.9904946f}, {0.9941264f, -1.9882528f, 0.9941264f, -1.9856122f, 0.9908934f}, {0.994318f, -1.988636f, 0.994318f, -1.9859948f, 0.9912771f}, {0.9945085f, -1.989017f, 0.9945085f, -1.9863753f, 0.9916586f}, {0.9946974f, -1.9893948f, 0.9946974f, -1.9867527f, 0.992037f}, {0.9948841f, -1.9897683f, 0.9948841f, -1.9871256f, 0.9924109f}, {0.995068f, -1.990136f, 0.995068f, -1.9874929f, 0.9927792f}, {0.9952485f, -1.9904969f, 0.9952485f, -1.9878533f, 0.9931405f}, {0.9954248f, -1.9908496f, 0.9954248f, -1.9882056f, 0.9934937f}, {0.9955966f, -1.9911931f, 0.9955966f, -1.9885486f, 0.9938377f}, {0.9957632f, -1.9915264f, 0.9957632f, -1.9888814f, 0.9941713f}, {0.9959242f, -1.9918485f, 0.9959242f, -1.9892031f, 0.9944939f}, {0.9960794f, -1.9921588f, 0.9960794f, -1.9895129f, 0.9948046f}, {0.9962283f, -1.9924566f, 0.9962283f, -1.9898104f, 0.9951029f}, {0.9963709f, -1.9927417f, 0.9963709f, -1.9900951f, 0.9953883f}, {0.9965069f, -1.9930137f, 0.9965069f, -1.9903668f, 0.9956607f}, {0.9966363f, -1.9932726f, 0.9966363f, -1.9906253f, 0.9959199f}, {0.9967591f, -1.9935183f, 0.9967591f, -1.9908706f, 0.9961659f}, {0.9968754f, -1.9937509f, 0.9968754f, -1.991103f, 0.9963988f}, {0.9969854f, -1.9939707f, 0.9969854f, -1.9913225f, 0.996619f}, {0.997089f, -1.9941781f, 0.997089f, -1.9915296f, 0.9968266f}},
-      {{0.9222633f, -1.8445266f, 0.9222633f, -1.8414681f, 0.8475852f}, {0.9228083f, -1.8456167f, 0.9228083f, -1.8425563f, 0.848677f}, {0.9243975f, -1.848795f, 0.9243975f, -1.8457294f, 0.8518607f}, {0.9269026f, -1.8538052f, 0.9269026f, -1.8507313f, 0.8568791f}, {0.9301375f, -1.860275f, 0.9301375f, -1.8571903f, 0.8633596f}, {0.9338898f, -1.8677797f, 0.9338898f, -1.8646826f, 0.8708768f}, {0.9379507f, -1.8759014f, 0.9379507f, -1.8727908f, 0.879012f}, {0.9421359f, -1.8842718f, 0.9421359f, -1.8811473f, 0.8873963f}, {0.9462976f, -1.8925951f, 0.9462976f, -1.8894569f, 0.8957334f}, {0.9503268f, -1.9006536f, 0.9503268f, -1.897502f, 0.9038053f}, {0.9541506f, -1.9083012f, 0.9541506f, -1.9051369f, 0.9114655f}, {0.9577257f, -1.9154514f, 0.9577257f, -1.9122753f, 0.9186276f}, {0.9610316f, -1.9220633f, 0.9610316f, -1.9188761f, 0.9252504f}, {0.9640643f, -1.9281285f, 0.9640643f, -1.9249314f, 0.9313257f}, {0.9668305f, -1.933661f, 0.9668305f, -1.9304547f, 0.9368674f}, {0.9693441f, -1.9386881f, 0.9693441f, -1.9354734f, 0.9419028f}, {0.9716224f, -1.9432448f, 0.9716224f, -1.9400225f, 0.946467f}, {0.9736847f, -1.9473694f, 0.9736847f, -1.9441403f, 0.9505985f}, {0.9755505f, -1.9511009f, 0.9755505f, -1.9478657f, 0.9543362f}, {0.9772386f, -1.9544772f, 0.9772386f, -1.9512363f, 0.9577181f}, {0.9787669f, -1.9575338f, 0.9787669f, -1.9542879f, 0.9607797f}, {0.9801518f, -1.9603036f, 0.9801518f, -1.9570531f, 0.9635541f}, {0.9814083f, -1.9628166f, 0.9814083f, -1.9595619f, 0.9660713f}, {0.9825499f, -1.9650998f, 0.9825499f, -1.9618413f, 0.9683583f}, {0.9835888f, -1.9671775f, 0.9835888f, -1.9639156f, 0.9704394f}, {0.9845356f, -1.9690713f, 0.9845356f, -1.9658062f, 0.9723363f}, {0.9854002f, -1.9708004f, 0.9854002f, -1.9675324f, 0.9740683f}, {0.9861909f, -1.9723819f, 0.9861909f, -1.9691113f, 0.9756524f}, {0.9869155f, -1.9738309f, 0.9869155f, -1.970558f, 0.9771039f}, {0.9875805f, -1.975161f, 0.9875805f, -1.9718858f, 0.9784362f}, {0.988192f, -1.976384f, 0.988192f, -1.9731068f, 0.9796612f}, {0.9887552f, -1.9775104f, 0.9887552f, -1.9742313f, 0.9807895f}, {0.9892748f, -1.9785497f, 0.9892748f, -1.9752689f, 0.9818305f}, {0.9897551f, -1.9795101f, 0.9897551f, -1.9762278f, 0.9827925f}, {0.9901996f, -1.9803992f, 0.9901996f, -1.9771154f, 0.9836831f}, {0.9906118f, -1.9812235f, 0.9906118f, -1.9779383f, 0.9845087f}, {0.9909945f, -1.9819889f, 0.9909945f, -1.9787024f, 0.9852754f}, {0.9913504f, -1.9827007f, 0.9913504f, -1.9794131f, 0.9859884f}, {0.9916818f, -1.9833636f, 0.9916818f, -1.9800749f, 0.9866524f}, {0.991991f, -1.9839819f, 0.991991f, -1.9806921f, 0.9872717f}, {0.9922797f, -1.9845593f, 0.9922797f, -1.9812686f, 0.9878501f}, {0.9925496f, -1.9850993f, 0.9925496f, -1.9818076f, 0.9883909f}, {0.9928024f, -1.9856049f, 0.9928024f, -1.9823124f, 0.9888974f}, {0.9930395f, -1.9860789f, 0.9930395f, -1.9827856f, 0.9893722f}, {0.9932619f, -1.9865239f, 0.9932619f, -1.9832298f, 0.9898179f}, {0.9934759f, -1.9869519f, 0.9934759f, -1.9836572f, 0.9902466f}, {0.9936888f, -1.9873776f, 0.9936888f, -1.9840821f, 0.990673f}, {0.9938999f, -1.9877997f, 0.9938999f, -1.9845036f, 0.9910958f}, {0.9941085f, -1.988217f, 0.9941085f, -1.9849202f, 0.9915138f}, {0.994314f, -1.9886279f, 0.994314f, -1.9853304f, 0.9919254f}, {0.9945156f, -1.9890312f, 0.9945156f, -1.985733f, 0.9923293f}, {0.9947127f, -1.9894253f, 0.9947127f, -1.9861265f, 0.9927241f}, {0.9949046f, -1.9898092f, 0.9949046f, -1.9865097f, 0.9931086f}, {0.9950908f, -1.9901816f, 0.9950908f, -1.9868815f, 0.9934817f}, {0.9952708f, -1.9905416f, 0.9952708f, -1.9872409f, 0.9938422f}, {0.9954442f, -1.9908884f, 0.9954442f, -1.9875871f, 0.9941896f}, {0.9956106f, -1.9912213f, 0.9956106f, -1.9879195f, 0.9945231f}, {0.99577f, -1.9915399f, 0.99577f, -1.9882376f, 0.9948422f}, {0.995922f, -1.991844f, 0.995922f, -1.9885411f, 0.9951468f}, {0.9960666f, -1.9921333f, 0.9960666f, -1.98883f, 0.9954366f}, {0.996204f, -1.9924079f, 0.996204f, -1.9891042f, 0.9957117f}, {0.996334f, -1.992668f, 0.996334f, -1.9893638f, 0.9959722f}, {0.9964569f, -1.9929137f, 0.9964569f, -1.9896091f, 0.9962183f}, {0.9965728f, -1.9931455f, 0.9965728f, -1.9898406f, 0.9964505f}},
-      {{0.9136086f, -1.8272173f, 0.9136086f, -1.8234342f, 0.8310003f}, {0.9142073f, -1.8284147f, 0.9142073f, -1.8246292f, 0.8322002f}, {0.9159535f, -1.8319069f, 0.9159535f, -1.8281142f, 0.8356997f}, {0.9187073f, -1.8374145f, 0.9187073f, -1.8336104f, 0.8412187f}, {0.9222657f, -1.8445315f, 0.9222657f, -1.8407126f, 0.8483503f}, {0.9263969f, -1.8527937f, 0.9263969f, -1.8489577f, 0.8566297f}, {0.9308717f, -1.8617435f, 0.9308717f, -1.857889f, 0.865598f}, {0.9354882f, -1.8709763f, 0.9354882f, -1.8671027f, 0.87485f}, {0.9400832f, -1.8801663f, 0.9400832f, -1.8762736f, 0.884059f}, {0.9445362f, -1.8890725f, 0.9445362f, -1.8851614f, 0.8929836f}, {0.9487662f, -1.8975324f, 0.9487662f, -1.8936038f, 0.901461f}, {0.9527245f, -1.905449f, 0.9527245f, -1.901504f, 0.909394f}, {0.9563878f, -1.9127756f, 0.9563878f, -1.9088154f, 0.9167357f}, {0.9597508f, -1.9195015f, 0.9597508f, -1.9155274f, 0.9234756f}, {0.9628204f, -1.9256408f, 0.9628204f, -1.921654f, 0.9296276f}, {0.9656114f, -1.9312228f, 0.9656114f, -1.9272244f, 0.9352212f}, {0.9681427f, -1.9362853f, 0.9681427f, -1.9322765f, 0.9402942f}, {0.9704351f, -1.9408702f, 0.9704351f, -1.9368519f, 0.9448885f}, {0.97251f, -1.9450201f, 0.97251f, -1.9409931f, 0.949047f}, {0.9743882f, -1.9487764f, 0.9743882f, -1.9447417f, 0.9528111f}, {0.9760892f, -1.9521784f, 0.9760892f, -1.9481367f, 0.9562202f}, {0.9776311f, -1.9552623f, 0.9776311f, -1.9512142f, 0.9593104f}, {0.9790305f, -1.9580611f, 0.9790305f, -1.9540072f, 0.962115f}, {0.9803024f, -1.9606047f, 0.9803024f, -1.9565455f, 0.9646639f}, {0.98146f, -1.96292f, 0.98146f, -1.958856f, 0.9669839f}, {0.9825154f, -1.9650308f, 0.9825154f, -1.9609624f, 0.9690991f}, {0.9834792f, -1.9669584f, 0.9834792f, -1.9628861f, 0.9710308f}, {0.984361f, -1.9687219f, 0.984361f, -1.9646459f, 0.9727979f}, {0.985169f, -1.970338f, 0.985169f, -1.9662587f, 0.9744173f}, {0.9859108f, -1.9718216f, 0.9859108f, -1.9677392f, 0.975904f}, {0.986593f, -1.973186f, 0.986593f, -1.9691007f, 0.9772712f}, {0.9872214f, -1.9744428f, 0.9872214f, -1.970355f, 0.9785306f}, {0.9878013f, -1.9756026f, 0.9878013f, -1.9715123f, 0.9796928f}, {0.9883372f, -1.9766745f, 0.9883372f, -1.972582f, 0.9807669f}, {0.9888334f, -1.9776668f, 0.9888334f, -1.9735723f, 0.9817614f}, {0.9892935f, -1.978587f, 0.9892935f, -1.9744906f, 0.9826834f}, {0.9897208f, -1.9794415f, 0.9897208f, -1.9753433f, 0.9835397f}, {0.9901181f, -1.9802362f, 0.9901181f, -1.9761364f, 0.9843361f}, {0.9904882f, -1.9809764f, 0.9904882f, -1.9768751f, 0.9850778f}, {0.9908334f, -1.9816668f, 0.9908334f, -1.977564f, 0.9857696f}, {0.9911558f, -1.9823116f, 0.9911558f, -1.9782075f, 0.9864158f}, {0.9914573f, -1.9829147f, 0.9914573f, -1.9788093f, 0.9870201f}, {0.9917397f, -1.9834794f, 0.9917397f, -1.9793728f, 0.9875859f}, {0.9920044f, -1.9840088f, 0.9920044f, -1.9799012f, 0.9881165f}, {0.9922529f, -1.9845059f, 0.9922529f, -1.9803972f, 0.9886145f}, {0.992492f, -1.984984f, 0.992492f, -1.9808743f, 0.9890937f}, {0.9927298f, -1.9854595f, 0.9927298f, -1.9813489f, 0.9895702f}, {0.9929656f, -1.9859312f, 0.9929656f, -1.9818195f, 0.9900428f}, {0.9931987f, -1.9863973f, 0.9931987f, -1.9822848f, 0.9905099f}, {0.9934282f, -1.9868565f, 0.9934282f, -1.982743f, 0.99097f}, {0.9936535f, -1.987307f, 0.9936535f, -1.9831926f, 0.9914215f}, {0.9938737f, -1.9877475f, 0.9938737f, -1.9836321f, 0.9918629f}, {0.9940882f, -1.9881764f, 0.9940882f, -1.9840601f, 0.9922927f}, {0.9942963f, -1.9885926f, 0.9942963f, -1.9844754f, 0.9927097f}, {0.9944974f, -1.9889949f, 0.9944974f, -1.9848769f, 0.9931129f}, {0.9946912f, -1.9893825f, 0.9946912f, -1.9852637f, 0.9935012f}, {0.9948773f, -1.9897546f, 0.9948773f, -1.985635f, 0.9938741f}, {0.9950554f, -1.9901107f, 0.9950554f, -1.9859904f, 0.994231f}, {0.9952253f, -1.9904505f, 0.9952253f, -1.9863296f, 0.9945715f}, {0.995387f, -1.9907739f, 0.995387f, -1.9866523f, 0.9948956f}, {0.9955405f, -1.9910809f, 0.9955405f, -1.9869586f, 0.9952032f}, {0.9956858f, -1.9913716f, 0.9956858f, -1.9872487f, 0.9954945f}, {0.9958232f, -1.9916464f, 0.9958232f, -1.9875229f, 0.9957698f}, {0.9959527f, -1.9919055f, 0.9959527f, -1.9877815f, 0.9960295f}},
-      {{0.9040481f, -1.8080962f, 0.9040481f, -1.8034218f, 0.8127705f}, {0.9047045f, -1.8094089f, 0.9047045f, -1.8047312f, 0.8140866f}, {0.9066194f, -1.8132387f, 0.9066194f, -1.8085511f, 0.8179264f}, {0.9096409f, -1.8192819f, 0.9096409f, -1.8145787f, 0.8239851f}, {0.9135484f, -1.8270967f, 0.9135484f, -1.8223733f, 0.8318202f}, {0.9180887f, -1.8361774f, 0.9180887f, -1.8314305f, 0.8409243f}, {0.9230119f, -1.8460237f, 0.9230119f, -1.8412513f, 0.8507961f}, {0.9280962f, -1.8561924f, 0.9280962f, -1.8513937f, 0.8609911f}, {0.9331625f, -1.8663249f, 0.9331625f, -1.8615f, 0.8711498f}, {0.9380775f, -1.876155f, 0.9380775f, -1.8713048f, 0.8810053f}, {0.9427511f, -1.8855022f, 0.9427511f, -1.8806278f, 0.8903767f}, {0.9471288f, -1.8942576f, 0.9471288f, -1.8893606f, 0.8991547f}, {0.9511839f, -1.9023678f, 0.9511839f, -1.8974497f, 0.9072858f}, {0.9549096f, -1.9098193f, 0.9549096f, -1.904882f, 0.9147566f}, {0.958313f, -1.9166261f, 0.958313f, -1.9116712f, 0.921581f}, {0.9614096f, -1.9228193f, 0.9614096f, -1.9178484f, 0.9277902f}, {0.9642198f, -1.9284397f, 0.9642198f, -1.9234542f, 0.9334251f}, {0.9667663f, -1.9335327f, 0.9667663f, -1.9285341f, 0.9385313f}, {0.9690725f, -1.9381449f, 0.9690725f, -1.9331344f, 0.9431554f}, {0.9711609f, -1.9423217f, 0.9711609f, -1.9373004f, 0.947343f}, {0.9730531f, -1.9461061f, 0.9730531f, -1.941075f, 0.9511372f}, {0.974769f, -1.9495379f, 0.974769f, -1.944498f, 0.9545779f}, {0.9763268f, -1.9526536f, 0.9763268f, -1.9476056f, 0.9577017f}, {0.9777431f, -1.9554862f, 0.9777431f, -1.9504308f, 0.9605415f}, {0.9790326f, -1.9580651f, 0.9790326f, -1.9530031f, 0.9631271f}, {0.9802085f, -1.960417f, 0.9802085f, -1.9553489f, 0.9654851f}, {0.9812826f, -1.9625653f, 0.9812826f, -1.9574916f, 0.9676389f}, {0.9822655f, -1.964531f, 0.9822655f, -1.9594523f, 0.9696098f}, {0.9831664f, -1.9663329f, 0.9831664f, -1.9612495f, 0.9714163f}, {0.9839936f, -1.9679873f, 0.9839936f, -1.9628996f, 0.973075f}, {0.9847545f, -1.969509f, 0.9847545f, -1.9644174f, 0.9746006f}, {0.9854555f, -1.970911f, 0.9854555f, -1.9658158f, 0.9760062f}, {0.9861024f, -1.9722049f, 0.9861024f, -1.9671063f, 0.9773035f}, {0.9867005f, -1.973401f, 0.9867005f, -1.9682993f, 0.9785026f}, {0.9872542f, -1.9745084f, 0.9872542f, -1.9694038f, 0.9796129f}, {0.9877677f, -1.9755353f, 0.9877677f, -1.9704281f, 0.9806425f}, {0.9882446f, -1.9764891f, 0.9882446f, -1.9713795f, 0.9815988f}, {0.9886881f, -1.9773763f, 0.9886881f, -1.9722643f, 0.9824882f}, {0.9891013f, -1.9782026f, 0.9891013f, -1.9730885f, 0.9833167f}, {0.9894867f, -1.9789735f, 0.9894867f, -1.9738574f, 0.9840895f}, {0.9898467f, -1.9796934f, 0.9898467f, -1.9745755f, 0.9848114f}, {0.9901834f, -1.9803668f, 0.9901834f, -1.9752472f, 0.9854865f}, {0.9904987f, -1.9809975f, 0.9904987f, -1.9758762f, 0.9861188f}, {0.9907944f, -1.9815888f, 0.9907944f, -1.9764659f, 0.9867116f}, {0.9910719f, -1.9821439f, 0.9910719f, -1.9770196f, 0.9872682f}, {0.991339f, -1.982678f, 0.991339f, -1.9775523f, 0.9878036f}, {0.9916046f, -1.9832091f, 0.9916046f, -1.9780821f, 0.9883362f}, {0.991868f, -1.983736f, 0.991868f, -1.9786076f, 0.9888644f}, {0.9921284f, -1.9842568f, 0.9921284f, -1.979127f, 0.9893865f}, {0.9923849f, -1.9847697f, 0.9923849f, -1.9796387f, 0.9899008f}, {0.9926366f, -1.9852731f, 0.9926366f, -1.9801408f, 0.9904055f}, {0.9928826f, -1.9857652f, 0.9928826f, -1.9806316f, 0.9908989f}, {0.9931223f, -1.9862445f, 0.9931223f, -1.9811096f, 0.9913794f}, {0.9933548f, -1.9867096f, 0.9933548f, -1.9815735f, 0.9918456f}, {0.9935796f, -1.9871591f, 0.9935796f, -1.9820219f, 0.9922964f}, {0.9937961f, -1.9875923f, 0.9937961f, -1.9824539f, 0.9927306f}, {0.9940041f, -1.9880081f, 0.9940041f, -1.9828687f, 0.9931476f}, {0.9942031f, -1.9884062f, 0.9942031f, -1.9832657f, 0.9935466f}, {0.994393f, -1.988786f, 0.994393f, -1.9836445f, 0.9939274f}, {0.9945737f, -1.9891475f, 0.9945737f, -1.9840051f, 0.9942899f}, {0.9947453f, -1.9894906f, 0.9947453f, -1.9843473f, 0.9946339f}, {0.9949078f, -1.9898156f, 0.9949078f, -1.9846715f, 0.9949597f}, {0.9950613f, -1.9901227f, 0.9950613f, -1.9849778f, 0.9952676f}, {0.9952062f, -1.9904124f, 0.9952062f, -1.9852667f, 0.995558f}},
-      {{0.8935005f, -1.7870009f, 0.8935005f, -1.7812318f, 0.79277f}, {0.8942185f, -1.7884371f, 0.8942185f, -1.7826633f, 0.7942108f}, {0.8963141f, -1.7926281f, 0.8963141f, -1.7868409f, 0.7984154f}, {0.8996226f, -1.7992452f, 0.8996226f, -1.7934366f, 0.8050538f}, {0.9039046f, -1.8078092f, 0.9039046f, -1.8019729f, 0.8136454f}, {0.9088851f, -1.8177703f, 0.9088851f, -1.8119019f, 0.8236387f}, {0.9142917f, -1.8285834f, 0.9142917f, -1.8226801f, 0.8344868f}, {0.9198819f, -1.8397638f, 0.9198819f, -1.8338244f, 0.8457032f}, {0.9254589f, -1.8509178f, 0.9254589f, -1.8449424f, 0.8568932f}, {0.9308759f, -1.8617518f, 0.9308759f, -1.8557414f, 0.8677622f}, {0.9360326f, -1.8720652f, 0.9360326f, -1.8660215f, 0.8781089f}, {0.940868f, -1.8817361f, 0.940868f, -1.8756611f, 0.887811f}, {0.9453516f, -1.8907031f, 0.9453516f, -1.8845993f, 0.896807f}, {0.9494748f, -1.8989496f, 0.9494748f, -1.8928191f, 0.9050801f}, {0.9532445f, -1.906489f, 0.9532445f, -1.9003342f, 0.9126439f}, {0.956677f, -1.9133541f, 0.956677f, -1.9071771f, 0.9195311f}, {0.9597943f, -1.9195886f, 0.9597943f, -1.9133914f, 0.9257857f}, {0.9626208f, -1.9252417f, 0.9626208f, -1.9190263f, 0.931457f}, {0.965182f, -1.930364f, 0.965182f, -1.9241321f, 0.9365959f}, {0.9675026f, -1.9350053f, 0.9675026f, -1.9287584f, 0.9412522f}, {0.9696062f, -1.9392124f, 0.9696062f, -1.932952f, 0.9454729f}, {0.9715147f, -1.9430293f, 0.9715147f, -1.9367565f, 0.9493021f}, {0.973248f, -1.946496f, 0.973248f, -1.940212f, 0.9527799f}, {0.9748243f, -1.9496486f, 0.9748243f, -1.9433545f, 0.9559428f}, {0.97626f, -1.95252f, 0.97626f, -1.9462165f, 0.9588234f}, {0.9775696f, -1.9551393f, 0.9775696f, -1.9488274f, 0.9614512f}, {0.9787663f, -1.9575325f, 0.9787663f, -1.9512129f, 0.9638521f}, {0.9798615f, -1.9597229f, 0.9798615f, -1.9533962f, 0.9660496f}, {0.9808656f, -1.9617311f, 0.9808656f, -1.9553979f, 0.9680643f}, {0.9817877f, -1.9635754f, 0.9817877f, -1.9572363f, 0.9699145f}, {0.982636f, -1.9652721f, 0.982636f, -1.9589275f, 0.9716167f}, {0.9834178f, -1.9668355f, 0.9834178f, -1.9604859f, 0.9731852f}, {0.9841393f, -1.9682787f, 0.9841393f, -1.9619244f, 0.974633f}, {0.9848065f, -1.9696129f, 0.9848065f, -1.9632543f, 0.9759715f}, {0.9854242f, -1.9708484f, 0.9854242f, -1.9644858f, 0.977211f}, {0.9859972f, -1.9719943f, 0.9859972f, -1.965628f, 0.9783606f}, {0.9865293f, -1.9730587f, 0.9865293f, -1.9666889f, 0.9794284f}, {0.9870244f, -1.9740488f, 0.9870244f, -1.9676759f, 0.9804217f}, {0.9874856f, -1.9749712f, 0.9874856f, -1.9685952f, 0.9813471f}, {0.9879158f, -1.9758316f, 0.9879158f, -1.9694529f, 0.9822103f}, {0.9883177f, -1.9766354f, 0.9883177f, -1.9702541f, 0.9830167f}, {0.9886936f, -1.9773872f, 0.9886936f, -1.9710035f, 0.983771f}, {0.9890457f, -1.9780914f, 0.9890457f, -1.9717054f, 0.9844774f}, {0.9893758f, -1.9787517f, 0.9893758f, -1.9723635f, 0.9851398f}, {0.9896858f, -1.9793716f, 0.9896858f, -1.9729814f, 0.9857617f}, {0.989984f, -1.979968f, 0.989984f, -1.973576f, 0.9863601f}, {0.9902806f, -1.9805613f, 0.9902806f, -1.9741673f, 0.9869552f}, {0.9905749f, -1.9811497f, 0.9905749f, -1.9747539f, 0.9875456f}, {0.9908657f, -1.9817315f, 0.9908657f, -1.9753337f, 0.9881292f}, {0.9911522f, -1.9823045f, 0.9911522f, -1.9759049f, 0.9887041f}, {0.9914334f, -1.9828668f, 0.9914334f, -1.9764654f, 0.9892682f}, {0.9917083f, -1.9834166f, 0.9917083f, -1.9770134f, 0.9898198f}, {0.9919761f, -1.9839521f, 0.9919761f, -1.9775472f, 0.990357f}, {0.9922359f, -1.9844717f, 0.9922359f, -1.9780651f, 0.9908783f}, {0.992487f, -1.9849741f, 0.992487f, -1.9785659f, 0.9913823f}, {0.992729f, -1.9854581f, 0.992729f, -1.9790483f, 0.9918678f}, {0.9929614f, -1.9859228f, 0.9929614f, -1.9795115f, 0.9923341f}, {0.9931838f, -1.9863676f, 0.9931838f, -1.9799549f, 0.9927803f}, {0.9933961f, -1.9867921f, 0.9933961f, -1.9803781f, 0.9932062f}, {0.9935981f, -1.9871962f, 0.9935981f, -1.9807808f, 0.9936115f}, {0.9937898f, -1.9875797f, 0.9937898f, -1.9811631f, 0.9939963f}, {0.9939715f, -1.9879429f, 0.9939715f, -1.9815251f, 0.9943607f}, {0.9941431f, -1.9882862f, 0.9941431f, -1.9818673f, 0.9947051f}, {0.994305f, -1.98861f, 0.994305f, -1.9821901f, 0.99503f}},
-      {{0.8818805f, -1.763761f, 0.8818805f, -1.7566496f, 0.7708724f}, {0.8826642f, -1.7653284f, 0.8826642f, -1.7582107f, 0.7724461f}, {0.884952f, -1.7699039f, 0.884952f, -1.7627678f, 0.7770401f}, {0.8885664f, -1.7771327f, 0.8885664f, -1.7699674f, 0.784298f}, {0.8932484f, -1.7864968f, 0.8932484f, -1.7792937f, 0.7936998f}, {0.8987002f, -1.7974005f, 0.8987002f, -1.7901535f, 0.8046475f}, {0.9046257f, -1.8092514f, 0.9046257f, -1.8019566f, 0.8165462f}, {0.9107604f, -1.8215207f, 0.9107604f, -1.8141765f, 0.828865f}, {0.9168887f, -1.8337774f, 0.9168887f, -1.8263837f, 0.8411711f}, {0.922849f, -1.8456979f, 0.922849f, -1.8382562f, 0.8531397f}, {0.92853f, -1.85706f, 0.92853f, -1.8495725f, 0.8645476f}, {0.9338634f, -1.8677268f, 0.9338634f, -1.8601963f, 0.8752574f}, {0.9388142f, -1.8776283f, 0.9388142f, -1.8700579f, 0.8851988f}, {0.9433718f, -1.8867435f, 0.9433718f, -1.8791363f, 0.8943508f}, {0.9475425f, -1.895085f, 0.9475425f, -1.8874441f, 0.9027258f}, {0.9513434f, -1.9026868f, 0.9513434f, -1.8950153f, 0.9103583f}, {0.9547979f, -1.9095958f, 0.9547979f, -1.9018964f, 0.9172952f}, {0.9579325f, -1.915865f, 0.9579325f, -1.9081403f, 0.9235896f}, {0.9607746f, -1.9215492f, 0.9607746f, -1.9138017f, 0.9292968f}, {0.9633513f, -1.9267025f, 0.9633513f, -1.9189342f, 0.9344709f}, {0.9656882f, -1.9313764f, 0.9656882f, -1.9235892f, 0.9391636f}, {0.9678093f, -1.9356187f, 0.9678093f, -1.9278144f, 0.943423f}, {0.9697367f, -1.9394734f, 0.9697367f, -1.9316535f, 0.9472932f}, {0.9714902f, -1.9429803f, 0.9714902f, -1.9351464f, 0.9508143f}, {0.9730878f, -1.9461755f, 0.9730878f, -1.9383287f, 0.9540224f}, {0.9745456f, -1.9490911f, 0.9745456f, -1.9412325f, 0.9569497f}, {0.975878f, -1.951756f, 0.975878f, -1.9438866f, 0.9596253f}, {0.9770978f, -1.9541956f, 0.9770978f, -1.9463164f, 0.9620748f}, {0.9782164f, -1.9564329f, 0.9782164f, -1.9485446f, 0.9643211f}, {0.979244f, -1.958488f, 0.979244f, -1.9505915f, 0.9663845f}, {0.9801895f, -1.960379f, 0.9801895f, -1.9524749f, 0.9682831f}, {0.981061f, -1.9621219f, 0.981061f, -1.9542108f, 0.9700331f}, {0.9818655f, -1.963731f, 0.9818655f, -1.9558133f, 0.9716486f}, {0.9826094f, -1.9652188f, 0.9826094f, -1.9572952f, 0.9731425f}, {0.9832984f, -1.9665968f, 0.9832984f, -1.9586677f, 0.974526f}, {0.9839375f, -1.9678751f, 0.9839375f, -1.9599407f, 0.9758094f}, {0.9845313f, -1.9690625f, 0.9845313f, -1.9611234f, 0.9770016f}, {0.9850836f, -1.9701673f, 0.9850836f, -1.9622237f, 0.9781108f}, {0.9855983f, -1.9711965f, 0.9855983f, -1.9632488f, 0.9791443f}, {0.9860784f, -1.9721568f, 0.9860784f, -1.9642052f, 0.9801084f}, {0.986527f, -1.9730539f, 0.986527f, -1.9650987f, 0.9810092f}, {0.9869466f, -1.9738932f, 0.9869466f, -1.9659345f, 0.9818518f}, {0.9873396f, -1.9746792f, 0.9873396f, -1.9667174f, 0.982641f}, {0.9877082f, -1.9754164f, 0.9877082f, -1.9674516f, 0.9833811f}, {0.9880542f, -1.9761085f, 0.9880542f, -1.9681409f, 0.984076f}, {0.9883872f, -1.9767745f, 0.9883872f, -1.9688042f, 0.9847447f}, {0.9887185f, -1.9774369f, 0.9887185f, -1.969464f, 0.9854098f}, {0.989047f, -1.9780941f, 0.989047f, -1.9701185f, 0.9860696f}, {0.9893719f, -1.9787438f, 0.9893719f, -1.9707656f, 0.9867219f}, {0.9896919f, -1.9793838f, 0.9896919f, -1.971403f, 0.9873645f}, {0.990006f, -1.9800119f, 0.990006f, -1.9720286f, 0.9879952f}, {0.990313f, -1.9806261f, 0.990313f, -1.9726403f, 0.9886118f}, {0.9906121f, -1.9812243f, 0.9906121f, -1.9732361f, 0.9892124f}, {0.9909024f, -1.9818048f, 0.9909024f, -1.9738143f, 0.9897953f}, {0.991183f, -1.982366f, 0.991183f, -1.9743733f, 0.9903588f}, {0.9914534f, -1.9829068f, 0.9914534f, -1.9749119f, 0.9909018f}, {0.9917131f, -1.9834261f, 0.9917131f, -1.9754291f, 0.9914231f}, {0.9919616f, -1.9839232f, 0.9919616f, -1.9759241f, 0.9919222f}, {0.9921988f, -1.9843976f, 0.9921988f, -1.9763966f, 0.9923985f}, {0.9924245f, -1.9848491f, 0.9924245f, -1.9768463f, 0.9928519f}, {0.9926389f, -1.9852777f, 0.9926389f, -1.9772732f, 0.9932822f}, {0.9928418f, -1.9856837f, 0.9928418f, -1.9776775f, 0.9936898f}, {0.9930337f, -1.9860674f, 0.9930337f, -1.9780597f, 0.9940751f}, {0.9932147f, -1.9864293f, 0.9932147f, -1.9784202f, 0.9944385f}},
-      {{0.8690995f, -1.738199f, 0.8690995f, -1.7294451f, 0.7469529f}, {0.8699525f, -1.739905f, 0.8699525f, -1.7311425f, 0.7486675f}, {0.8724437f, -1.7448873f, 0.8724437f, -1.7360997f, 0.7536749f}, {0.8763821f, -1.7527641f, 0.8763821f, -1.7439368f, 0.7615914f}, {0.8814888f, -1.7629777f, 0.8814888f, -1.754099f, 0.7718564f}, {0.8874424f, -1.7748848f, 0.8874424f, -1.7659462f, 0.7838235f}, {0.8939219f, -1.7878438f, 0.8939219f, -1.7788399f, 0.7968477f}, {0.9006398f, -1.8012796f, 0.9006398f, -1.792208f, 0.8103512f}, {0.9073606f, -1.8147211f, 0.9073606f, -1.8055818f, 0.8238604f}, {0.9139064f, -1.8278128f, 0.9139064f, -1.8186075f, 0.837018f}, {0.9201542f, -1.8403084f, 0.9201542f, -1.8310402f, 0.8495765f}, {0.9260274f, -1.8520547f, 0.9260274f, -1.8427274f, 0.861382f}, {0.9314859f, -1.8629717f, 0.9314859f, -1.8535894f, 0.872354f}, {0.9365166f, -1.8730331f, 0.9365166f, -1.8636002f, 0.8824661f}, {0.941125f, -1.8822501f, 0.941125f, -1.8727707f, 0.8917294f}, {0.9453289f, -1.8906578f, 0.9453289f, -1.881136f, 0.9001795f}, {0.9491529f, -1.8983058f, 0.9491529f, -1.8887456f, 0.907866f}, {0.9526255f, -1.905251f, 0.9526255f, -1.8956558f, 0.9148462f}, {0.9557764f, -1.9115527f, 0.9557764f, -1.9019258f, 0.9211797f}, {0.9586348f, -1.9172696f, 0.9586348f, -1.9076138f, 0.9269253f}, {0.9612288f, -1.9224575f, 0.9612288f, -1.9127757f, 0.9321394f}, {0.9635845f, -1.927169f, 0.9635845f, -1.9174634f, 0.9368746f}, {0.965726f, -1.931452f, 0.965726f, -1.9217249f, 0.9411792f}, {0.9676752f, -1.9353504f, 0.9676752f, -1.9256036f, 0.9450972f}, {0.9694518f, -1.9389037f, 0.9694518f, -1.929139f, 0.9486684f}, {0.9710736f, -1.9421472f, 0.9710736f, -1.9323662f, 0.9519283f}, {0.9725564f, -1.9451128f, 0.9725564f, -1.9353168f, 0.9549087f}, {0.9739143f, -1.9478285f, 0.9739143f, -1.9380189f, 0.9576382f}, {0.9751598f, -1.9503197f, 0.9751598f, -1.9404975f, 0.9601419f}, {0.9763043f, -1.9526086f, 0.9763043f, -1.9427749f, 0.9624424f}, {0.9773577f, -1.9547153f, 0.9773577f, -1.944871f, 0.9645596f}, {0.9783287f, -1.9566574f, 0.9783287f, -1.9468033f, 0.9665115f}, {0.9792254f, -1.9584507f, 0.9792254f, -1.9485876f, 0.9683139f}, {0.9800546f, -1.9601093f, 0.9800546f, -1.9502378f, 0.9699808f}, {0.9808228f, -1.9616456f, 0.9808228f, -1.9517664f, 0.9715249f}, {0.9815355f, -1.963071f, 0.9815355f, -1.9531846f, 0.9729574f}, {0.9821976f, -1.9643953f, 0.9821976f, -1.9545022f, 0.9742883f}, {0.9828137f, -1.9656275f, 0.9828137f, -1.9557282f, 0.9755268f}, {0.9833878f, -1.9667757f, 0.9833878f, -1.9568706f, 0.9766807f}, {0.9839235f, -1.967847f, 0.9839235f, -1.9579366f, 0.9777575f}, {0.984424f, -1.9688481f, 0.984424f, -1.9589326f, 0.9787636f}, {0.9848923f, -1.9697846f, 0.9848923f, -1.9598644f, 0.9797048f}, {0.9853309f, -1.9706618f, 0.9853309f, -1.9607372f, 0.9805865f}, {0.9857423f, -1.9714846f, 0.9857423f, -1.9615558f, 0.9814134f}, {0.9861286f, -1.9722572f, 0.9861286f, -1.9623245f, 0.9821898f}, {0.9865003f, -1.9730006f, 0.9865003f, -1.9630642f, 0.982937f}, {0.9868701f, -1.9737402f, 0.9868701f, -1.9638001f, 0.9836803f}, {0.9872369f, -1.9744739f, 0.9872369f, -1.9645301f, 0.9844177f}, {0.9875997f, -1.9751993f, 0.9875997f, -1.9652518f, 0.9851468f}, {0.987957f, -1.975914f, 0.987957f, -1.9659629f, 0.9858651f}, {0.9883077f, -1.9766155f, 0.9883077f, -1.9666608f, 0.9865701f}, {0.9886507f, -1.9773014f, 0.9886507f, -1.9673433f, 0.9872594f}, {0.9889848f, -1.9779695f, 0.9889848f, -1.9680081f, 0.9879309f}, {0.989309f, -1.9786179f, 0.989309f, -1.9686532f, 0.9885826f}, {0.9896225f, -1.9792449f, 0.9896225f, -1.969277f, 0.9892128f}, {0.9899245f, -1.979849f, 0.9899245f, -1.9698781f, 0.9898199f}, {0.9902146f, -1.9804292f, 0.9902146f, -1.9704554f, 0.990403f}, {0.9904923f, -1.9809846f, 0.9904923f, -1.9710079f, 0.9909612f}, {0.9907573f, -1.9815146f, 0.9907573f, -1.9715353f, 0.9914939f}, {0.9910096f, -1.9820191f, 0.9910096f, -1.9720373f, 0.992001f}, {0.9912491f, -1.9824981f, 0.9912491f, -1.9725139f, 0.9924824f}, {0.9914759f, -1.9829518f, 0.9914759f, -1.9729653f, 0.9929383f}, {0.9916903f, -1.9833806f, 0.9916903f, -1.9733919f, 0.9933693f}, {0.9918926f, -1.9837851f, 0.9918926f, -1.9737944f, 0.9937759f}},
-      {{0.8550661f, -1.7101322f, 0.8550661f, -1.6993727f, 0.7208917f}, {0.8559919f, -1.7119838f, 0.8559919f, -1.7012126f, 0.7227549f}, {0.8586966f, -1.7173931f, 0.8586966f, -1.7065879f, 0.7281983f}, {0.8629758f, -1.7259516f, 0.8629758f, -1.7150926f, 0.7368107f}, {0.8685305f, -1.7370611f, 0.8685305f, -1.7261321f, 0.74799f}, {0.8750148f, -1.7500296f, 0.8750148f, -1.7390191f, 0.7610402f}, {0.8820823f, -1.7641647f, 0.8820823f, -1.7530652f, 0.7752642f}, {0.8894214f, -1.7788428f, 0.8894214f, -1.767651f, 0.7900346f}, {0.8967753f, -1.7935507f, 0.8967753f, -1.7822663f, 0.804835f}, {0.9039492f, -1.8078983f, 0.9039492f, -1.7965237f, 0.819273f}, {0.9108068f, -1.8216137f, 0.9108068f, -1.8101528f, 0.8330746f}, {0.9172626f, -1.8345253f, 0.9172626f, -1.8229831f, 0.8460674f}, {0.9232707f, -1.8465415f, 0.9232707f, -1.8349237f, 0.8581592f}, {0.9288149f, -1.8576298f, 0.9288149f, -1.8459423f, 0.8693173f}, {0.9338996f, -1.8677992f, 0.9338996f, -1.8560477f, 0.8795507f}, {0.9385427f, -1.8770855f, 0.9385427f, -1.8652755f, 0.8888954f}, {0.9427704f, -1.8855408f, 0.9427704f, -1.8736777f, 0.8974039f}, {0.9466129f, -1.8932259f, 0.9466129f, -1.8813144f, 0.9051374f}, {0.9501022f, -1.9002044f, 0.9501022f, -1.888249f, 0.9121598f}, {0.9532699f, -1.9065398f, 0.9532699f, -1.8945446f, 0.918535f}, {0.9561464f, -1.9122929f, 0.9561464f, -1.9002614f, 0.9243243f}, {0.9587603f, -1.9175206f, 0.9587603f, -1.9054563f, 0.9295849f}, {0.9611378f, -1.9222755f, 0.9611378f, -1.9101813f, 0.9343698f}, {0.9633028f, -1.9266056f, 0.9633028f, -1.9144841f, 0.9387271f}, {0.965277f, -1.930554f, 0.965277f, -1.9184077f, 0.9427004f}, {0.9670799f, -1.9341598f, 0.9670799f, -1.9219908f, 0.9463288f}, {0.9687289f, -1.9374577f, 0.9687289f, -1.9252679f, 0.9496475f}, {0.9702395f, -1.9404789f, 0.9702395f, -1.9282701f, 0.9526877f}, {0.9716256f, -1.9432511f, 0.9716256f, -1.9310249f, 0.9554773f}, {0.9728995f, -1.945799f, 0.9728995f, -1.9335568f, 0.9580413f}, {0.9740723f, -1.9481447f, 0.9740723f, -1.9358877f, 0.9604017f}, {0.9751538f, -1.9503076f, 0.9751538f, -1.938037f, 0.9625782f}, {0.9761526f, -1.9523052f, 0.9761526f, -1.940022f, 0.9645884f}, {0.9770766f, -1.9541532f, 0.9770766f, -1.9418583f, 0.966448f}, {0.9779326f, -1.9558652f, 0.9779326f, -1.9435597f, 0.9681708f}, {0.9787269f, -1.9574539f, 0.9787269f, -1.9451383f, 0.9697695f}, {0.9794651f, -1.9589302f, 0.9794651f, -1.9466053f, 0.971255f}, {0.980152f, -1.9603041f, 0.980152f, -1.9479706f, 0.9726376f}, {0.9807922f, -1.9615844f, 0.9807922f, -1.9492429f, 0.973926f}, {0.9813896f, -1.9627793f, 0.9813896f, -1.9504302f, 0.9751283f}, {0.9819479f, -1.9638958f, 0.9819479f, -1.9515397f, 0.9762519f}, {0.9824702f, -1.9649405f, 0.9824702f, -1.9525778f, 0.9773032f}, {0.9829596f, -1.9659192f, 0.9829596f, -1.9535503f, 0.978288f}, {0.9834186f, -1.9668372f, 0.9834186f, -1.9544626f, 0.9792118f}, {0.9838496f, -1.9676993f, 0.9838496f, -1.9553192f, 0.9800793f}, {0.9842645f, -1.9685289f, 0.9842645f, -1.9561437f, 0.9809142f}, {0.9846772f, -1.9693544f, 0.9846772f, -1.9569639f, 0.9817448f}, {0.9850866f, -1.9701733f, 0.9850866f, -1.9577777f, 0.9825689f}, {0.9854915f, -1.970983f, 0.9854915f, -1.9585824f, 0.9833837f}, {0.9858904f, -1.9717809f, 0.9858904f, -1.9593752f, 0.9841866f}, {0.986282f, -1.972564f, 0.986282f, -1.9601534f, 0.9849747f}, {0.9866649f, -1.9733299f, 0.9866649f, -1.9609144f, 0.9857453f}, {0.987038f, -1.974076f, 0.987038f, -1.9616558f, 0.9864961f}, {0.9874f, -1.9748001f, 0.9874f, -1.9623754f, 0.9872248f}, {0.9877501f, -1.9755003f, 0.9877501f, -1.9630712f, 0.9879294f}, {0.9880875f, -1.976175f, 0.9880875f, -1.9637417f, 0.9886084f}, {0.9884115f, -1.976823f, 0.9884115f, -1.9643856f, 0.9892605f}, {0.9887217f, -1.9774434f, 0.9887217f, -1.9650021f, 0.9898848f}, {0.9890178f, -1.9780356f, 0.9890178f, -1.9655905f, 0.9904806f}, {0.9892996f, -1.9785992f, 0.9892996f, -1.9661506f, 0.9910478f}, {0.9895672f, -1.9791344f, 0.9895672f, -1.9666824f, 0.9915864f}, {0.9898206f, -1.9796413f, 0.9898206f, -1.9671861f, 0.9920965f}, {0.9900602f, -1.9801204f, 0.9900602f, -1.9676622f, 0.9925786f}, {0.9902862f, -1.9805725f, 0.9902862f, -1.9681114f, 0.9930335f}},
-      {{0.8396875f, -1.6793751f, 0.8396875f, -1.6661724f, 0.6925778f}, {0.840689f, -1.681378f, 0.840689f, -1.6681596f, 0.6945965f}, {0.8436161f, -1.6872321f, 0.8436161f, -1.6739677f, 0.7004966f}, {0.848251f, -1.696502f, 0.848251f, -1.6831647f, 0.7098393f}, {0.8542744f, -1.7085489f, 0.8542744f, -1.6951169f, 0.7219809f}, {0.861316f, -1.7226319f, 0.861316f, -1.7090892f, 0.7361747f}, {0.8690032f, -1.7380064f, 0.8690032f, -1.7243428f, 0.75167f}, {0.8769995f, -1.753999f, 0.8769995f, -1.7402097f, 0.7677884f}, {0.885026f, -1.7700521f, 0.885026f, -1.7561365f, 0.7839676f}, {0.8928696f, -1.7857392f, 0.8928696f, -1.7717003f, 0.799778f}, {0.90038f, -1.80076f, 0.90038f, -1.7866031f, 0.814917f}, {0.9074616f, -1.8149231f, 0.9074616f, -1.8006548f, 0.8291914f}, {0.9140619f, -1.8281237f, 0.9140619f, -1.8137516f, 0.8424958f}, {0.9201609f, -1.8403218f, 0.9201609f, -1.8258538f, 0.8547898f}, {0.9257616f, -1.8515232f, 0.9257616f, -1.8369672f, 0.8660792f}, {0.9308819f, -1.8617638f, 0.9308819f, -1.8471273f, 0.8764004f}, {0.935549f, -1.871098f, 0.935549f, -1.8563881f, 0.885808f}, {0.939795f, -1.8795901f, 0.939795f, -1.8648134f, 0.8943668f}, {0.9436541f, -1.8873082f, 0.9436541f, -1.8724709f, 0.9021456f}, {0.9471603f, -1.8943206f, 0.9471603f, -1.8794281f, 0.9092131f}, {0.9503466f, -1.9006931f, 0.9503466f, -1.8857505f, 0.9156357f}, {0.9532438f, -1.9064875f, 0.9532438f, -1.8914994f, 0.9214757f}, {0.9558805f, -1.9117611f, 0.9558805f, -1.8967315f, 0.9267907f}, {0.958283f, -1.916566f, 0.958283f, -1.9014986f, 0.9316334f}, {0.9604748f, -1.9209496f, 0.9604748f, -1.9058478f, 0.9360515f}, {0.9624773f, -1.9249547f, 0.9624773f, -1.9098213f, 0.940088f}, {0.9643096f, -1.9286193f, 0.9643096f, -1.9134571f, 0.9437814f}, {0.9659888f, -1.9319776f, 0.9659888f, -1.9167891f, 0.9471662f}, {0.9675302f, -1.9350603f, 0.9675302f, -1.9198475f, 0.9502731f}, {0.9689473f, -1.9378945f, 0.9689473f, -1.9226595f, 0.9531296f}, {0.9702522f, -1.9405044f, 0.9702522f, -1.9252489f, 0.95576f}, {0.9714559f, -1.9429117f, 0.9714559f, -1.9276372f, 0.9581862f}, {0.9725678f, -1.9451356f, 0.9725678f, -1.9298436f, 0.9604276f}, {0.9735967f, -1.9471933f, 0.9735967f, -1.9318852f, 0.9625015f}, {0.9745501f, -1.9491002f, 0.9745501f, -1.933777f, 0.9644233f}, {0.9754349f, -1.9508699f, 0.9754349f, -1.9355328f, 0.966207f}, {0.9762574f, -1.9525148f, 0.9762574f, -1.9371648f, 0.9678648f}, {0.9770229f, -1.9540458f, 0.9770229f, -1.9386837f, 0.9694078f}, {0.9777364f, -1.9554728f, 0.9777364f, -1.9400995f, 0.9708461f}, {0.9784024f, -1.9568047f, 0.9784024f, -1.941421f, 0.9721884f}, {0.9790247f, -1.9580495f, 0.9790247f, -1.942656f, 0.973443f}, {0.9796072f, -1.9592143f, 0.9796072f, -1.9438117f, 0.974617f}, {0.9801529f, -1.9603058f, 0.9801529f, -1.9448945f, 0.975717f}, {0.9806648f, -1.9613296f, 0.9806648f, -1.9459103f, 0.9767489f}, {0.9811456f, -1.9622912f, 0.9811456f, -1.9468643f, 0.977718f}, {0.9816083f, -1.9632167f, 0.9816083f, -1.9477825f, 0.9786508f}, {0.9820688f, -1.9641375f, 0.9820688f, -1.9486961f, 0.9795789f}, {0.9825256f, -1.9650512f, 0.9825256f, -1.9496027f, 0.9804998f}, {0.9829774f, -1.9659548f, 0.9829774f, -1.9504991f, 0.9814105f}, {0.9834226f, -1.9668452f, 0.9834226f, -1.9513825f, 0.9823078f}, {0.9838596f, -1.9677192f, 0.9838596f, -1.9522497f, 0.9831887f}, {0.984287f, -1.968574f, 0.984287f, -1.9530978f, 0.9840503f}, {0.9847034f, -1.9694068f, 0.9847034f, -1.953924f, 0.9848896f}, {0.9851076f, -1.9702152f, 0.9851076f, -1.954726f, 0.9857044f}, {0.9854985f, -1.970997f, 0.9854985f, -1.9555017f, 0.9864923f}, {0.9858752f, -1.9717504f, 0.9858752f, -1.9562491f, 0.9872516f}, {0.986237f, -1.972474f, 0.986237f, -1.956967f, 0.9879809f}, {0.9865834f, -1.9731668f, 0.9865834f, -1.9576544f, 0.9886791f}, {0.986914f, -1.9738281f, 0.986914f, -1.9583105f, 0.9893456f}, {0.9872288f, -1.9744576f, 0.9872288f, -1.9589351f, 0.9899801f}, {0.9875277f, -1.9750554f, 0.9875277f, -1.9595281f, 0.9905826f}, {0.9878108f, -1.9756216f, 0.9878108f, -1.9600899f, 0.9911532f}, {0.9880784f, -1.9761568f, 0.9880784f, -1.960621f, 0.9916927f}, {0.9883309f, -1.9766618f, 0.9883309f, -1.961122f, 0.9922017f}},
-      {{0.822871f, -1.645742f, 0.822871f, -1.6295709f, 0.6619131f}, {0.8239505f, -1.6479009f, 0.8239505f, -1.6317086f, 0.6640932f}, {0.8271069f, -1.6542137f, 0.8271069f, -1.6379594f, 0.670468f}, {0.8321094f, -1.6642189f, 0.8321094f, -1.6478662f, 0.6805715f}, {0.8386189f, -1.6772379f, 0.8386189f, -1.6607573f, 0.6937184f}, {0.8462405f, -1.692481f, 0.8462405f, -1.6758506f, 0.7091113f}, {0.8545756f, -1.7091512f, 0.8545756f, -1.692357f, 0.7259453f}, {0.863262f, -1.726524f, 0.863262f, -1.7095592f, 0.7434889f}, {0.8719979f, -1.7439959f, 0.8719979f, -1.7268593f, 0.7611324f}, {0.8805509f, -1.7611018f, 0.8805509f, -1.7437972f, 0.7784064f}, {0.8887557f, -1.7775114f, 0.8887557f, -1.7600455f, 0.7949772f}, {0.8965055f, -1.7930109f, 0.8965055f, -1.7753928f, 0.8106291f}, {0.9037404f, -1.8074808f, 0.9037404f, -1.7897204f, 0.8252411f}, {0.9104361f, -1.8208721f, 0.9104361f, -1.8029802f, 0.8387641f}, {0.9165933f, -1.8331866f, 0.9165933f, -1.8151736f, 0.8511995f}, {0.9222296f, -1.8444592f, 0.9222296f, -1.8263356f, 0.8625829f}, {0.9273731f, -1.8547463f, 0.9273731f, -1.8365215f, 0.872971f}, {0.9320576f, -1.8641152f, 0.9320576f, -1.8457983f, 0.882432f}, {0.9363193f, -1.8726386f, 0.9363193f, -1.854238f, 0.8910391f}, {0.9401947f, -1.8803895f, 0.9401947f, -1.8619127f, 0.8988662f}, {0.9437194f, -1.8874387f, 0.9437194f, -1.8688927f, 0.9059847f}, {0.9469266f, -1.8938532f, 0.9469266f, -1.8752442f, 0.9124622f}, {0.9498475f, -1.899695f, 0.9498475f, -1.8810285f, 0.9183614f}, {0.9525104f, -1.9050208f, 0.9525104f, -1.8863021f, 0.9237396f}, {0.9549412f, -1.9098825f, 0.9549412f, -1.8911159f, 0.928649f}, {0.9571632f, -1.9143264f, 0.9571632f, -1.8955162f, 0.9331366f}, {0.9591973f, -1.9183945f, 0.9591973f, -1.8995443f, 0.9372447f}, {0.9610621f, -1.9221243f, 0.9610621f, -1.9032374f, 0.9410111f}, {0.9627746f, -1.9255492f, 0.9627746f, -1.9066287f, 0.9444697f}, {0.9643496f, -1.9286991f, 0.9643496f, -1.9097477f, 0.9476505f}, {0.9658004f, -1.9316008f, 0.9658004f, -1.9126208f, 0.9505807f}, {0.967139f, -1.9342779f, 0.967139f, -1.9152717f, 0.9532842f}, {0.9683759f, -1.9367518f, 0.9683759f, -1.9177213f, 0.9557824f}, {0.9695207f, -1.9390414f, 0.9695207f, -1.9199884f, 0.9580945f}, {0.9705819f, -1.9411637f, 0.9705819f, -1.9220898f, 0.9602376f}, {0.9715669f, -1.9431338f, 0.9715669f, -1.9240405f, 0.9622271f}, {0.9724826f, -1.9449653f, 0.9724826f, -1.925854f, 0.9640766f}, {0.9733352f, -1.9466703f, 0.9733352f, -1.9275423f, 0.9657983f}, {0.9741299f, -1.9482598f, 0.9741299f, -1.9291162f, 0.9674035f}, {0.9748718f, -1.9497436f, 0.9748718f, -1.9305854f, 0.9689019f}, {0.9755653f, -1.9511306f, 0.9755653f, -1.9319588f, 0.9703025f}, {0.9762143f, -1.9524287f, 0.9762143f, -1.9332441f, 0.9716133f}, {0.9768226f, -1.9536451f, 0.9768226f, -1.9344486f, 0.9728417f}, {0.9773932f, -1.9547864f, 0.9773932f, -1.9355786f, 0.9739941f}, {0.9779292f, -1.9558583f, 0.9779292f, -1.93664f, 0.9750766f}, {0.9784451f, -1.9568902f, 0.9784451f, -1.9376618f, 0.9761186f}, {0.9789585f, -1.957917f, 0.9789585f, -1.9386785f, 0.9771556f}, {0.979468f, -1.958936f, 0.979468f, -1.9396874f, 0.9781845f}, {0.9799719f, -1.9599438f, 0.9799719f, -1.9406853f, 0.9792022f}, {0.9804684f, -1.9609369f, 0.9804684f, -1.9416687f, 0.9802051f}, {0.980956f, -1.9619119f, 0.980956f, -1.9426341f, 0.9811897f}, {0.9814328f, -1.9628656f, 0.9814328f, -1.9435784f, 0.9821528f}, {0.9818974f, -1.9637948f, 0.9818974f, -1.9444986f, 0.9830911f}, {0.9823484f, -1.9646969f, 0.9823484f, -1.9453917f, 0.984002f}, {0.9827847f, -1.9655693f, 0.9827847f, -1.9462556f, 0.9848831f}, {0.9832051f, -1.9664102f, 0.9832051f, -1.9470882f, 0.9857322f}, {0.9836089f, -1.9672179f, 0.9836089f, -1.947888f, 0.9865478f}, {0.9839956f, -1.9679912f, 0.9839956f, -1.9486537f, 0.9873288f}, {0.9843648f, -1.9687295f, 0.9843648f, -1.9493848f, 0.9880743f}, {0.9847162f, -1.9694324f, 0.9847162f, -1.9500807f, 0.9887841f}, {0.9850499f, -1.9700998f, 0.9850499f, -1.9507416f, 0.9894581f}, {0.985366f, -1.9707321f, 0.985366f, -1.9513676f, 0.9900965f}, {0.9856649f, -1.9713298f, 0.9856649f, -1.9519595f, 0.9907001f}, {0.9859469f, -1.9718938f, 0.9859469f, -1.9525179f, 0.9912696f}},
-      {{0.8045255f, -1.609051f, 0.8045255f, -1.5892835f, 0.6288185f}, {0.8056843f, -1.6113687f, 0.8056843f, -1.5915727f, 0.6311646f}, {0.8090746f, -1.6181492f, 0.8090746f, -1.5982699f, 0.6380285f}, {0.814453f, -1.6289061f, 0.814453f, -1.6088947f, 0.6489175f}, {0.8214612f, -1.6429224f, 0.8214612f, -1.6227388f, 0.663106f}, {0.8296805f, -1.659361f, 0.8296805f, -1.6389754f, 0.6797466f}, {0.8386864f, -1.6773728f, 0.8386864f, -1.6567659f, 0.6979796f}, {0.848091f, -1.6961819f, 0.848091f, -1.675344f, 0.7170199f}, {0.8575689f, -1.7151377f, 0.8575689f, -1.6940669f, 0.7362085f}, {0.8668675f, -1.733735f, 0.8668675f, -1.7124357f, 0.7550343f}, {0.8758055f, -1.751611f, 0.8758055f, -1.7300921f, 0.7731299f}, {0.884264f, -1.768528f, 0.884264f, -1.7468013f, 0.7902547f}, {0.8921748f, -1.7843496f, 0.8921748f, -1.7624285f, 0.8062706f}, {0.8995082f, -1.7990164f, 0.8995082f, -1.7769151f, 0.8211177f}, {0.9062623f, -1.8125246f, 0.9062623f, -1.7902574f, 0.8347918f}, {0.9124538f, -1.8249076f, 0.9124538f, -1.8024882f, 0.8473269f}, {0.9181113f, -1.8362225f, 0.9181113f, -1.8136642f, 0.8587809f}, {0.9232699f, -1.8465398f, 0.9232699f, -1.8238547f, 0.8692249f}, {0.9279681f, -1.8559361f, 0.9279681f, -1.8331356f, 0.8787367f}, {0.9322446f, -1.8644892f, 0.9322446f, -1.8415836f, 0.8873948f}, {0.9361375f, -1.872275f, 0.9361375f, -1.8492737f, 0.8952763f}, {0.9396827f, -1.8793654f, 0.9396827f, -1.8562771f, 0.9024538f}, {0.9429138f, -1.8858276f, 0.9429138f, -1.8626598f, 0.9089953f}, {0.9458615f, -1.891723f, 0.9458615f, -1.8684828f, 0.9149632f}, {0.9485539f, -1.8971079f, 0.9485539f, -1.8738016f, 0.9204142f}, {0.9510164f, -1.9020329f, 0.9510164f, -1.878666f, 0.9253997f}, {0.9532718f, -1.9065437f, 0.9532718f, -1.8831214f, 0.929966f}, {0.9553406f, -1.9106813f, 0.9553406f, -1.8872082f, 0.9341544f}, {0.9572411f, -1.9144823f, 0.9572411f, -1.8909625f, 0.9380021f}, {0.9589898f, -1.9179796f, 0.9589898f, -1.8944168f, 0.9415423f}, {0.9606012f, -1.9212023f, 0.9606012f, -1.8976f, 0.9448047f}, {0.9620884f, -1.9241768f, 0.9620884f, -1.9005379f, 0.9478157f}, {0.9634631f, -1.9269263f, 0.9634631f, -1.9032536f, 0.9505989f}, {0.9647358f, -1.9294717f, 0.9647358f, -1.9057677f, 0.9531756f}, {0.9659158f, -1.9318317f, 0.9659158f, -1.9080987f, 0.9555646f}, {0.9670115f, -1.934023f, 0.9670115f, -1.9102631f, 0.9577828f}, {0.9680303f, -1.9360605f, 0.9680303f, -1.9122757f, 0.9598454f}, {0.9689789f, -1.9379579f, 0.9689789f, -1.9141497f, 0.9617661f}, {0.9698635f, -1.939727f, 0.9698635f, -1.9158971f, 0.9635569f}, {0.9706894f, -1.9413788f, 0.9706894f, -1.9175286f, 0.965229f}, {0.9714615f, -1.942923f, 0.9714615f, -1.9190539f, 0.9667922f}, {0.9721843f, -1.9443686f, 0.9721843f, -1.9204816f, 0.9682555f}, {0.9728617f, -1.9457234f, 0.9728617f, -1.9218198f, 0.9696269f}, {0.9734973f, -1.9469946f, 0.9734973f, -1.9230754f, 0.9709138f}, {0.9740944f, -1.9481888f, 0.9740944f, -1.924255f, 0.9721227f}, {0.9746693f, -1.9493386f, 0.9746693f, -1.9253906f, 0.9732866f}, {0.9752414f, -1.9504828f, 0.9752414f, -1.9265207f, 0.9744449f}, {0.9758092f, -1.9516184f, 0.9758092f, -1.9276424f, 0.9755944f}, {0.9763708f, -1.9527417f, 0.9763708f, -1.9287519f, 0.9767315f}, {0.9769244f, -1.9538488f, 0.9769244f, -1.9298453f, 0.9778522f}, {0.9774679f, -1.9549358f, 0.9774679f, -1.9309191f, 0.9789526f}, {0.9779996f, -1.9559992f, 0.9779996f, -1.9319694f, 0.980029f}, {0.9785177f, -1.9570354f, 0.9785177f, -1.9329929f, 0.981078f}, {0.9790207f, -1.9580415f, 0.9790207f, -1.9339865f, 0.9820964f}, {0.9795073f, -1.9590146f, 0.9795073f, -1.9349477f, 0.9830815f}, {0.9799763f, -1.9599526f, 0.9799763f, -1.9358742f, 0.984031f}, {0.9804268f, -1.9608536f, 0.9804268f, -1.9367642f, 0.9849431f}, {0.9808582f, -1.9617165f, 0.9808582f, -1.9376164f, 0.9858166f}, {0.9812701f, -1.9625403f, 0.9812701f, -1.9384301f, 0.9866505f}, {0.9816623f, -1.9633246f, 0.9816623f, -1.9392048f, 0.9874444f}, {0.9820347f, -1.9640695f, 0.9820347f, -1.9399405f, 0.9881984f}, {0.9823876f, -1.9647752f, 0.9823876f, -1.9406375f, 0.9889128f}, {0.9827212f, -1.9654423f, 0.9827212f, -1.9412965f, 0.9895882f}, {0.9830359f, -1.9660718f, 0.9830359f, -1.9419183f, 0.9902254f}},
-      {{0.784564f, -1.569128f, 0.784564f, -1.5450167f, 0.5932393f}, {0.7858026f, -1.5716052f, 0.7858026f, -1.5474558f, 0.5957546f}, {0.7894281f, -1.5788562f, 0.7894281f, -1.5545954f, 0.603117f}, {0.7951858f, -1.5903716f, 0.7951858f, -1.5659338f, 0.6148093f}, {0.8026992f, -1.6053984f, 0.8026992f, -1.5807297f, 0.630067f}, {0.8115271f, -1.6230541f, 0.8115271f, -1.5981142f, 0.6479941f}, {0.8212197f, -1.6424394f, 0.8212197f, -1.6172016f, 0.6676773f}, {0.8313638f, -1.6627276f, 0.8313638f, -1.637178f, 0.6882771f}, {0.8416101f, -1.6832201f, 0.8416101f, -1.6573557f, 0.7090846f}, {0.8516852f, -1.7033704f, 0.8516852f, -1.6771963f, 0.7295445f}, {0.8613908f, -1.7227817f, 0.8613908f, -1.6963093f, 0.7492541f}, {0.870595f, -1.74119f, 0.870595f, -1.7144347f, 0.7679452f}, {0.8792201f, -1.7584402f, 0.8792201f, -1.7314199f, 0.7854605f}, {0.8872304f, -1.7744609f, 0.8872304f, -1.7471944f, 0.8017274f}, {0.8946205f, -1.789241f, 0.8946205f, -1.7617474f, 0.8167346f}, {0.9014056f, -1.8028111f, 0.9014056f, -1.775109f, 0.8305132f}, {0.9076143f, -1.8152285f, 0.9076143f, -1.7873356f, 0.8431215f}, {0.913283f, -1.8265659f, 0.913283f, -1.7984988f, 0.8546331f}, {0.9184518f, -1.8369035f, 0.9184518f, -1.8086776f, 0.8651295f}, {0.9231619f, -1.8463237f, 0.9231619f, -1.817953f, 0.8746945f}, {0.9274536f, -1.8549073f, 0.9274536f, -1.8264046f, 0.8834099f}, {0.9313656f, -1.8627313f, 0.9313656f, -1.8341084f, 0.8913541f}, {0.9349339f, -1.8698678f, 0.9349339f, -1.8411353f, 0.8986003f}, {0.9381917f, -1.8763834f, 0.9381917f, -1.8475508f, 0.905216f}, {0.9411694f, -1.8823388f, 0.9411694f, -1.8534146f, 0.9112629f}, {0.9438945f, -1.887789f, 0.9438945f, -1.8587811f, 0.9167968f}, {0.9463918f, -1.8927836f, 0.9463918f, -1.863699f, 0.9218683f}, {0.9486837f, -1.8973674f, 0.9486837f, -1.8682124f, 0.9265225f}, {0.9507902f, -1.9015804f, 0.9507902f, -1.8723606f, 0.9308003f}, {0.9527292f, -1.9054585f, 0.9527292f, -1.8761791f, 0.9347379f}, {0.9545168f, -1.9090336f, 0.9545168f, -1.8796993f, 0.9383679f}, {0.9561672f, -1.9123345f, 0.9561672f, -1.8829494f, 0.9417195f}, {0.9576934f, -1.9153868f, 0.9576934f, -1.8859548f, 0.9448187f}, {0.9591067f, -1.9182134f, 0.9591067f, -1.888738f, 0.9476888f}, {0.9604175f, -1.9208349f, 0.9604175f, -1.8913192f, 0.9503506f}, {0.9616349f, -1.9232697f, 0.9616349f, -1.8937166f, 0.9528228f}, {0.9627672f, -1.9255343f, 0.9627672f, -1.8959464f, 0.9551222f}, {0.9638218f, -1.9276435f, 0.9638218f, -1.8980232f, 0.9572638f}, {0.9648053f, -1.9296107f, 0.9648053f, -1.8999602f, 0.9592612f}, {0.9657239f, -1.9314477f, 0.9657239f, -1.901769f, 0.9611265f}, {0.9665828f, -1.9331655f, 0.9665828f, -1.9034604f, 0.9628707f}, {0.9673869f, -1.9347738f, 0.9673869f, -1.9050439f, 0.9645036f}, {0.9681407f, -1.9362813f, 0.9681407f, -1.9065283f, 0.9660344f}, {0.9688481f, -1.9376961f, 0.9688481f, -1.9079214f, 0.9674709f}, {0.9695127f, -1.9390255f, 0.9695127f, -1.9092303f, 0.9688207f}, {0.9701527f, -1.9403054f, 0.9701527f, -1.9104906f, 0.9701203f}, {0.9707897f, -1.9415794f, 0.9707897f, -1.911745f, 0.9714139f}, {0.971422f, -1.942844f, 0.971422f, -1.9129902f, 0.9726979f}, {0.9720475f, -1.944095f, 0.9720475f, -1.9142219f, 0.9739681f}, {0.9726641f, -1.9453282f, 0.9726641f, -1.9154362f, 0.9752202f}, {0.9732696f, -1.9465392f, 0.9732696f, -1.9166286f, 0.9764499f}, {0.973862f, -1.947724f, 0.973862f, -1.9177951f, 0.9776529f}, {0.9744393f, -1.9488787f, 0.9744393f, -1.9189321f, 0.9788253f}, {0.9749999f, -1.9499999f, 0.9749999f, -1.920036f, 0.9799637f}, {0.9755422f, -1.9510845f, 0.9755422f, -1.921104f, 0.981065f}, {0.976065f, -1.9521301f, 0.976065f, -1.9221335f, 0.9821266f}, {0.9765673f, -1.9531346f, 0.9765673f, -1.9231226f, 0.9831466f}, {0.9770483f, -1.9540967f, 0.9770483f, -1.9240699f, 0.9841235f}, {0.9775076f, -1.9550153f, 0.9775076f, -1.9249744f, 0.9850562f}, {0.977945f, -1.95589f, 0.977945f, -1.9258356f, 0.9859443f}, {0.9783603f, -1.9567207f, 0.9783603f, -1.9266536f, 0.9867878f}, {0.9787539f, -1.9575078f, 0.9787539f, -1.9274286f, 0.987587f}, {0.979126f, -1.958252f, 0.979126f, -1.9281614f, 0.9883427f}, {0.9794772f, -1.9589543f, 0.9794772f, -1.9288529f, 0.9890557f}},
-      {{0.7629062f, -1.5258124f, 0.7629062f, -1.4964721f, 0.5551527f}, {0.7642236f, -1.5284471f, 0.7642236f, -1.4990561f, 0.5578381f}, {0.7680819f, -1.5361638f, 0.7680819f, -1.5066244f, 0.5657032f}, {0.7742162f, -1.5484324f, 0.7742162f, -1.5186571f, 0.5782077f}, {0.7822338f, -1.5644676f, 0.7822338f, -1.5343839f, 0.5945512f}, {0.7916725f, -1.5833449f, 0.7916725f, -1.5528983f, 0.6137916f}, {0.8020588f, -1.6041176f, 0.8020588f, -1.5732715f, 0.6349636f}, {0.8129547f, -1.6259094f, 0.8129547f, -1.5946442f, 0.6571745f}, {0.8239874f, -1.6479747f, 0.8239874f, -1.6162853f, 0.6796641f}, {0.8348623f, -1.6697246f, 0.8348623f, -1.6376169f, 0.7018322f}, {0.8453633f, -1.6907266f, 0.8453633f, -1.6582151f, 0.7232381f}, {0.8553445f, -1.7106889f, 0.8553445f, -1.6777935f, 0.7435843f}, {0.8647178f, -1.7294357f, 0.8647178f, -1.6961798f, 0.7626916f}, {0.8734406f, -1.7468812f, 0.8734406f, -1.7132898f, 0.7804725f}, {0.8815029f, -1.7630057f, 0.8815029f, -1.7291043f, 0.7969071f}, {0.8889178f, -1.7778357f, 0.8889178f, -1.7436491f, 0.8120223f}, {0.8957136f, -1.7914273f, 0.8957136f, -1.7569793f, 0.8258752f}, {0.9019273f, -1.8038546f, 0.9019273f, -1.7691677f, 0.8385414f}, {0.9076004f, -1.8152009f, 0.9076004f, -1.7802958f, 0.8501059f}, {0.9127763f, -1.8255526f, 0.9127763f, -1.7904485f, 0.8606567f}, {0.9174976f, -1.8349953f, 0.9174976f, -1.7997096f, 0.870281f}, {0.9218055f, -1.843611f, 0.9218055f, -1.8081596f, 0.8790623f}, {0.9257384f, -1.8514768f, 0.9257384f, -1.8158741f, 0.8870794f}, {0.9293321f, -1.8586641f, 0.9293321f, -1.8229233f, 0.894405f}, {0.9326192f, -1.8652385f, 0.9326192f, -1.8293712f, 0.9011058f}, {0.9356297f, -1.8712593f, 0.9356297f, -1.8352763f, 0.9072424f}, {0.9383902f, -1.8767805f, 0.9383902f, -1.8406913f, 0.9128697f}, {0.9409252f, -1.8818504f, 0.9409252f, -1.8456637f, 0.9180371f}, {0.9432564f, -1.8865127f, 0.9432564f, -1.8502364f, 0.9227891f}, {0.9454032f, -1.8908064f, 0.9454032f, -1.8544475f, 0.9271654f}, {0.9473833f, -1.8947666f, 0.9473833f, -1.8583315f, 0.9312016f}, {0.9492122f, -1.8984244f, 0.9492122f, -1.861919f, 0.9349299f}, {0.9509041f, -1.9018082f, 0.9509041f, -1.8652377f, 0.9383786f}, {0.9524714f, -1.9049429f, 0.9524714f, -1.8683121f, 0.9415736f}, {0.9539255f, -1.907851f, 0.9539255f, -1.8711644f, 0.9445377f}, {0.9552765f, -1.9105529f, 0.9552765f, -1.8738143f, 0.9472916f}, {0.9565333f, -1.9130667f, 0.9565333f, -1.8762797f, 0.9498536f}, {0.9577043f, -1.9154085f, 0.9577043f, -1.8785765f, 0.9522405f}, {0.9587966f, -1.9175932f, 0.9587966f, -1.8807192f, 0.9544672f}, {0.9598169f, -1.9196339f, 0.9598169f, -1.8827206f, 0.9565471f}, {0.9607712f, -1.9215425f, 0.9607712f, -1.8845925f, 0.9584924f}, {0.9616649f, -1.9233297f, 0.9616649f, -1.8863454f, 0.9603141f}, {0.9625027f, -1.9250054f, 0.9625027f, -1.8879889f, 0.962022f}, {0.9632891f, -1.9265783f, 0.9632891f, -1.8895315f, 0.9636251f}, {0.9640282f, -1.9280564f, 0.9640282f, -1.8909811f, 0.9651316f}, {0.9647399f, -1.9294798f, 0.9647399f, -1.8923772f, 0.9665823f}, {0.9654484f, -1.9308968f, 0.9654484f, -1.893767f, 0.9680266f}, {0.9661518f, -1.9323036f, 0.9661518f, -1.8951467f, 0.9694604f}, {0.9668477f, -1.9336954f, 0.9668477f, -1.8965118f, 0.9708791f}, {0.9675338f, -1.9350676f, 0.9675338f, -1.8978576f, 0.9722777f}, {0.9682077f, -1.9364154f, 0.9682077f, -1.8991795f, 0.9736514f}, {0.9688671f, -1.9377342f, 0.9688671f, -1.9004729f, 0.9749955f}, {0.9695098f, -1.9390197f, 0.9695098f, -1.9017336f, 0.9763057f}, {0.970134f, -1.940268f, 0.970134f, -1.902958f, 0.977578f}, {0.9707379f, -1.9414758f, 0.9707379f, -1.9041425f, 0.978809f}, {0.9713201f, -1.9426403f, 0.9713201f, -1.9052846f, 0.9799959f}, {0.9718796f, -1.9437592f, 0.9718796f, -1.906382f, 0.9811363f}, {0.9724154f, -1.9448309f, 0.9724154f, -1.9074331f, 0.9822286f}, {0.9729271f, -1.9458543f, 0.9729271f, -1.9084368f, 0.9832717f}, {0.9734144f, -1.9468289f, 0.9734144f, -1.9093927f, 0.9842651f}, {0.9738773f, -1.9477546f, 0.9738773f, -1.9103006f, 0.9852086f}, {0.9743159f, -1.9486318f, 0.9743159f, -1.9111609f, 0.9861026f}, {0.9747306f, -1.9494613f, 0.9747306f, -1.9119744f, 0.9869481f}, {0.975122f, -1.9502441f, 0.975122f, -1.9127422f, 0.9877459f}},
-      {{0.7394813f, -1.4789627f, 0.7394813f, -1.4433505f, 0.5145749f}, {0.7408749f, -1.4817499f, 0.7408749f, -1.4460706f, 0.5174292f}, {0.7449591f, -1.4899182f, 0.7449591f, -1.4540422f, 0.5257942f}, {0.7514603f, -1.5029205f, 0.7514603f, -1.4667315f, 0.5391096f}, {0.7599717f, -1.5199434f, 0.7599717f, -1.4833445f, 0.5565424f}, {0.7700128f, -1.5400255f, 0.7700128f, -1.502943f, 0.5771081f}, {0.7810883f, -1.5621765f, 0.7810883f, -1.5245606f, 0.5997924f}, {0.7927369f, -1.5854738f, 0.7927369f, -1.5472969f, 0.6236507f}, {0.8045629f, -1.6091258f, 0.8045629f, -1.5703794f, 0.6478722f}, {0.8162506f, -1.6325012f, 0.8162506f, -1.593192f, 0.6718105f}, {0.8275656f, -1.6551312f, 0.8275656f, -1.6152771f, 0.6949854f}, {0.8383471f, -1.6766942f, 0.8383471f, -1.6363208f, 0.7170676f}, {0.8484958f, -1.6969916f, 0.8484958f, -1.6561294f, 0.7378537f}, {0.8579607f, -1.7159214f, 0.8579607f, -1.6746035f, 0.7572394f}, {0.8667268f, -1.7334536f, 0.8667268f, -1.6917135f, 0.7751937f}, {0.8748042f, -1.7496085f, 0.8748042f, -1.7074794f, 0.7917376f}, {0.8822199f, -1.7644398f, 0.8822199f, -1.7219536f, 0.8069261f}, {0.8890111f, -1.7780222f, 0.8890111f, -1.7352089f, 0.8208355f}, {0.8952205f, -1.790441f, 0.8952205f, -1.7473287f, 0.8335533f}, {0.9008931f, -1.8017862f, 0.9008931f, -1.7584007f, 0.8451717f}, {0.9060738f, -1.8121476f, 0.9060738f, -1.7685126f, 0.8557826f}, {0.910806f, -1.821612f, 0.910806f, -1.7777491f, 0.8654749f}, {0.9151306f, -1.8302613f, 0.9151306f, -1.7861901f, 0.8743324f}, {0.9190859f, -1.8381718f, 0.9190859f, -1.7939101f, 0.8824334f}, {0.9227068f, -1.8454137f, 0.9227068f, -1.8009777f, 0.8898497f}, {0.9260255f, -1.852051f, 0.9260255f, -1.8074552f, 0.8966468f}, {0.9290709f, -1.8581417f, 0.9290709f, -1.8133992f, 0.9028842f}, {0.9318692f, -1.8637383f, 0.9318692f, -1.818861f, 0.9086156f}, {0.934444f, -1.868888f, 0.934444f, -1.8238867f, 0.9138892f}, {0.9368165f, -1.8736331f, 0.9368165f, -1.8285176f, 0.9187486f}, {0.9390059f, -1.8780118f, 0.9390059f, -1.8327908f, 0.9232327f}, {0.9410291f, -1.8820582f, 0.9410291f, -1.8367398f, 0.9273766f}, {0.9429015f, -1.8858029f, 0.9429015f, -1.8403943f, 0.9312115f}, {0.9446367f, -1.8892734f, 0.9446367f, -1.8437813f, 0.9347655f}, {0.9462472f, -1.8924943f, 0.9462472f, -1.8469246f, 0.938064f}, {0.9477439f, -1.8954878f, 0.9477439f, -1.849846f, 0.9411296f}, {0.9491368f, -1.8982737f, 0.9491368f, -1.8525649f, 0.9439825f}, {0.9504349f, -1.9008699f, 0.9504349f, -1.8550985f, 0.9466412f}, {0.9516462f, -1.9032925f, 0.9516462f, -1.8574628f, 0.9491222f}, {0.952778f, -1.905556f, 0.952778f, -1.8596718f, 0.9514402f}, {0.9538368f, -1.9076735f, 0.9538368f, -1.8617383f, 0.9536087f}, {0.9548284f, -1.9096569f, 0.9548284f, -1.8636739f, 0.9556398f}, {0.9557584f, -1.9115168f, 0.9557584f, -1.865489f, 0.9575445f}, {0.9566315f, -1.9132629f, 0.9566315f, -1.8671932f, 0.9593327f}, {0.9574521f, -1.9149041f, 0.9574521f, -1.8687949f, 0.9610134f}, {0.9582425f, -1.9164849f, 0.9582425f, -1.8703376f, 0.9626323f}, {0.9590295f, -1.9180589f, 0.9590295f, -1.8718737f, 0.9642442f}, {0.9598109f, -1.9196218f, 0.9598109f, -1.8733989f, 0.9658447f}, {0.9605842f, -1.9211684f, 0.9605842f, -1.8749082f, 0.9674285f}, {0.9613467f, -1.9226934f, 0.9613467f, -1.8763965f, 0.9689902f}, {0.9620957f, -1.9241915f, 0.9620957f, -1.8778585f, 0.9705244f}, {0.9628288f, -1.9256575f, 0.9628288f, -1.8792893f, 0.9720258f}, {0.9635434f, -1.9270868f, 0.9635434f, -1.8806842f, 0.9734895f}, {0.9642375f, -1.928475f, 0.9642375f, -1.882039f, 0.9749111f}, {0.9649092f, -1.9298184f, 0.9649092f, -1.88335f, 0.9762868f}, {0.9655569f, -1.9311137f, 0.9655569f, -1.8846141f, 0.9776133f}, {0.9661793f, -1.9323585f, 0.9661793f, -1.885829f, 0.9788881f}, {0.9667755f, -1.933551f, 0.9667755f, -1.8869927f, 0.9801093f}, {0.967345f, -1.9346899f, 0.967345f, -1.8881042f, 0.9812756f}, {0.9678873f, -1.9357746f, 0.9678873f, -1.8891628f, 0.9823864f}, {0.9684025f, -1.936805f, 0.9684025f, -1.8901684f, 0.9834417f}, {0.9688908f, -1.9377815f, 0.9688908f, -1.8911214f, 0.9844417f}, {0.9693525f, -1.938705f, 0.9693525f, -1.8920226f, 0.9853874f}, {0.9697883f, -1.9395766f, 0.9697883f, -1.8928732f, 0.98628f}},
-      {{0.7142317f, -1.4284634f, 0.7142317f, -1.3853577f, 0.4715691f}, {0.7156972f, -1.4313944f, 0.7156972f, -1.3882003f, 0.4745885f}, {0.719995f, -1.4399899f, 0.719995f, -1.3965364f, 0.4834434f}, {0.7268447f, -1.4536895f, 0.7268447f, -1.4098226f, 0.4975564f}, {0.7358288f, -1.4716576f, 0.7358288f, -1.4272485f, 0.5160667f}, {0.746451f, -1.4929021f, 0.746451f, -1.4478519f, 0.5379523f}, {0.7581974f, -1.5163947f, 0.7581974f, -1.4706356f, 0.5621539f}, {0.7705854f, -1.5411709f, 0.7705854f, -1.4946641f, 0.5876776f}, {0.7831978f, -1.5663955f, 0.7831978f, -1.5191276f, 0.6136635f}, {0.795698f, -1.5913961f, 0.795698f, -1.5433737f, 0.6394185f}, {0.8078334f, -1.6156668f, 0.8078334f, -1.566912f, 0.6644216f}, {0.8194275f, -1.6388551f, 0.8194275f, -1.5894006f, 0.6883096f}, {0.8303689f, -1.6607378f, 0.8303689f, -1.610623f, 0.7108527f}, {0.8405975f, -1.6811949f, 0.8405975f, -1.6304627f, 0.7319271f}, {0.8500918f, -1.7001836f, 0.8500918f, -1.6488784f, 0.7514887f}, {0.8588582f, -1.7177164f, 0.8588582f, -1.6658821f, 0.7695506f}, {0.8669216f, -1.7338432f, 0.8669216f, -1.6815223f, 0.7861641f}, {0.8743188f, -1.7486375f, 0.8743188f, -1.6958702f, 0.8014048f}, {0.881093f, -1.7621859f, 0.881093f, -1.7090098f, 0.8153621f}, {0.8872905f, -1.7745811f, 0.8872905f, -1.7210309f, 0.8281313f}, {0.8929582f, -1.7859163f, 0.8929582f, -1.7320241f, 0.8398086f}, {0.8981414f, -1.7962828f, 0.8981414f, -1.7420777f, 0.8504879f}, {0.9028835f, -1.805767f, 0.9028835f, -1.7512758f, 0.8602583f}, {0.907225f, -1.81445f, 0.907225f, -1.7596967f, 0.8692033f}, {0.9112032f, -1.8224064f, 0.9112032f, -1.767413f, 0.8773998f}, {0.9148524f, -1.8297047f, 0.9148524f, -1.7744911f, 0.8849184f}, {0.9182037f, -1.8364073f, 0.9182037f, -1.7809914f, 0.8918232f}, {0.9212853f, -1.8425705f, 0.9212853f, -1.7869687f, 0.8981724f}, {0.9241226f, -1.8482453f, 0.9241226f, -1.7924722f, 0.9040184f}, {0.9267387f, -1.8534775f, 0.9267387f, -1.7975465f, 0.9094085f}, {0.9291541f, -1.8583083f, 0.9291541f, -1.8022315f, 0.9143851f}, {0.9313874f, -1.8627748f, 0.9313874f, -1.8065632f, 0.9189864f}, {0.9334551f, -1.8669103f, 0.9334551f, -1.8105739f, 0.9232467f}, {0.9353723f, -1.8707447f, 0.9353723f, -1.8142926f, 0.9271967f}, {0.9371524f, -1.8743047f, 0.9371524f, -1.8177452f, 0.9308642f}, {0.9388073f, -1.8776147f, 0.9388073f, -1.8209553f, 0.9342741f}, {0.9403481f, -1.8806962f, 0.9403481f, -1.8239438f, 0.9374486f}, {0.9417844f, -1.8835688f, 0.9417844f, -1.8267298f, 0.9404079f}, {0.9431251f, -1.8862502f, 0.9431251f, -1.8293302f, 0.9431702f}, {0.9443781f, -1.8887562f, 0.9443781f, -1.8317606f, 0.9457518f}, {0.9455506f, -1.8911012f, 0.9455506f, -1.8340349f, 0.9481676f}, {0.9466491f, -1.8932982f, 0.9466491f, -1.8361656f, 0.9504309f}, {0.9476795f, -1.895359f, 0.9476795f, -1.8381641f, 0.9525538f}, {0.948647f, -1.8972941f, 0.948647f, -1.8400409f, 0.9545473f}, {0.9495567f, -1.8991133f, 0.9495567f, -1.8418052f, 0.9564214f}, {0.950433f, -1.9008659f, 0.950433f, -1.8435049f, 0.9582269f}, {0.9513056f, -1.9026113f, 0.9513056f, -1.8451976f, 0.960025f}, {0.9521723f, -1.9043446f, 0.9521723f, -1.8468787f, 0.9618106f}, {0.9530302f, -1.9060603f, 0.9530302f, -1.8485425f, 0.9635781f}, {0.9538762f, -1.9077523f, 0.9538762f, -1.8501835f, 0.9653211f}, {0.9547074f, -1.9094148f, 0.9547074f, -1.8517958f, 0.9670338f}, {0.955521f, -1.9110421f, 0.955521f, -1.853374f, 0.9687101f}, {0.9563144f, -1.9126288f, 0.9563144f, -1.8549128f, 0.9703447f}, {0.9570851f, -1.9141701f, 0.9570851f, -1.8564076f, 0.9719326f}, {0.957831f, -1.9156619f, 0.957831f, -1.8578544f, 0.9734694f}, {0.9585503f, -1.9171006f, 0.9585503f, -1.8592497f, 0.9749515f}, {0.9592417f, -1.9184835f, 0.9592417f, -1.8605908f, 0.9763761f}, {0.9599042f, -1.9198084f, 0.9599042f, -1.8618757f, 0.977741f}, {0.9605369f, -1.9210739f, 0.9605369f, -1.8631031f, 0.9790447f}, {0.9611397f, -1.9222793f, 0.9611397f, -1.8642722f, 0.9802865f}, {0.9617123f, -1.9234246f, 0.9617123f, -1.8653829f, 0.9814664f}, {0.9622551f, -1.9245102f, 0.9622551f, -1.8664356f, 0.9825847f}, {0.9627684f, -1.9255368f, 0.9627684f, -1.8674313f, 0.9836423f}, {0.963253f, -1.926506f, 0.963253f, -1.8683712f, 0.9846407f}},
-      {{0.6871163f, -1.3742325f, 0.6871163f, -1.3222108f, 0.4262542f}, {0.6886473f, -1.3772946f, 0.6886473f, -1.325157f, 0.4294322f}, {0.6931403f, -1.3862807f, 0.6931403f, -1.3338029f, 0.4387584f}, {0.700311f, -1.4006219f, 0.700311f, -1.3476013f, 0.4536426f}, {0.7097338f, -1.4194676f, 0.7097338f, -1.3657335f, 0.4732016f}, {0.7209011f, -1.4418022f, 0.7209011f, -1.3872227f, 0.4963818f}, {0.7332836f, -1.4665672f, 0.7332836f, -1.4110501f, 0.5220842f}, {0.7463806f, -1.4927612f, 0.7463806f, -1.4362526f, 0.5492698f}, {0.7597551f, -1.5195102f, 0.7597551f, -1.461989f, 0.5770314f}, {0.7730511f, -1.5461023f, 0.7730511f, -1.4875744f, 0.6046301f}, {0.7859976f, -1.5719952f, 0.7859976f, -1.5124872f, 0.6315033f}, {0.7984024f, -1.5968048f, 0.7984024f, -1.5363576f, 0.657252f}, {0.8101409f, -1.6202818f, 0.8101409f, -1.5589459f, 0.6816177f}, {0.821143f, -1.642286f, 0.821143f, -1.5801171f, 0.7044548f}, {0.8313799f, -1.6627598f, 0.8313799f, -1.5998159f, 0.7257037f}, {0.840853f, -1.681706f, 0.840853f, -1.6180449f, 0.7453672f}, {0.8495844f, -1.6991689f, 0.8495844f, -1.6348467f, 0.7634911f}, {0.8576096f, -1.7152191f, 0.8576096f, -1.6502894f, 0.7801489f}, {0.8649716f, -1.7299432f, 0.8649716f, -1.6644561f, 0.7954304f}, {0.8717177f, -1.7434354f, 0.8717177f, -1.6774375f, 0.8094333f}, {0.8778959f, -1.7557919f, 0.8778959f, -1.6893262f, 0.8222575f}, {0.8835536f, -1.7671073f, 0.8835536f, -1.7002133f, 0.8340013f}, {0.8887362f, -1.7774723f, 0.8887362f, -1.710186f, 0.8447587f}, {0.8934861f, -1.7869723f, 0.8934861f, -1.7193263f, 0.8546183f}, {0.8978431f, -1.7956862f, 0.8978431f, -1.7277104f, 0.8636621f}, {0.9018435f, -1.803687f, 0.9018435f, -1.7354083f, 0.8719657f}, {0.9055205f, -1.8110409f, 0.9055205f, -1.7424838f, 0.8795981f}, {0.9089042f, -1.8178085f, 0.9089042f, -1.7489952f, 0.8866218f}, {0.9120221f, -1.8240442f, 0.9120221f, -1.7549949f, 0.8930936f}, {0.9148987f, -1.8297975f, 0.9148987f, -1.7605303f, 0.8990646f}, {0.9175563f, -1.8351127f, 0.9175563f, -1.7656443f, 0.904581f}, {0.9200149f, -1.8400299f, 0.9200149f, -1.7703754f, 0.9096844f}, {0.9222925f, -1.8445851f, 0.9222925f, -1.7747582f, 0.914412f}, {0.9244053f, -1.8488107f, 0.9244053f, -1.7788238f, 0.9187976f}, {0.9263679f, -1.8527358f, 0.9263679f, -1.7826003f, 0.9228713f}, {0.9281933f, -1.8563866f, 0.9281933f, -1.786113f, 0.9266603f}, {0.9298934f, -1.8597869f, 0.9298934f, -1.7893845f, 0.9301893f}, {0.9314789f, -1.8629578f, 0.9314789f, -1.7924354f, 0.9334803f}, {0.9329593f, -1.8659187f, 0.9329593f, -1.7952841f, 0.9365532f}, {0.9343434f, -1.8686867f, 0.9343434f, -1.7979474f, 0.939426f}, {0.9356389f, -1.8712777f, 0.9356389f, -1.8004404f, 0.9421151f}, {0.9368529f, -1.8737059f, 0.9368529f, -1.8027766f, 0.9446352f}, {0.937992f, -1.875984f, 0.937992f, -1.8049685f, 0.9469996f}, {0.9390619f, -1.8781239f, 0.9390619f, -1.8070273f, 0.9492204f}, {0.940068f, -1.880136f, 0.940068f, -1.8089633f, 0.9513087f}, {0.9410374f, -1.8820748f, 0.9410374f, -1.8108287f, 0.9533209f}, {0.9420031f, -1.8840061f, 0.9420031f, -1.8126869f, 0.9553253f}, {0.9429623f, -1.8859245f, 0.9429623f, -1.8145327f, 0.9573164f}, {0.9439119f, -1.8878237f, 0.9439119f, -1.81636f, 0.9592875f}, {0.9448486f, -1.8896972f, 0.9448486f, -1.8181625f, 0.9612318f}, {0.9457692f, -1.8915383f, 0.9457692f, -1.819934f, 0.9631427f}, {0.9466704f, -1.8933408f, 0.9466704f, -1.8216682f, 0.9650134f}, {0.9475493f, -1.8950987f, 0.9475493f, -1.8233596f, 0.9668378f}, {0.9484033f, -1.8968067f, 0.9484033f, -1.8250029f, 0.9686105f}, {0.94923f, -1.8984601f, 0.94923f, -1.8265937f, 0.9703264f}, {0.9500275f, -1.9000549f, 0.9500275f, -1.8281282f, 0.9719817f}, {0.9507941f, -1.9015881f, 0.9507941f, -1.8296033f, 0.9735729f}, {0.9515286f, -1.9030573f, 0.9515286f, -1.8310169f, 0.9750977f}, {0.9522304f, -1.9044608f, 0.9522304f, -1.8323673f, 0.9765544f}, {0.952899f, -1.905798f, 0.952899f, -1.8336539f, 0.9779421f}, {0.9535343f, -1.9070686f, 0.9535343f, -1.8348763f, 0.9792608f}, {0.9541365f, -1.908273f, 0.9541365f, -1.8360352f, 0.9805109f}, {0.9547062f, -1.9094123f, 0.9547062f, -1.8371314f, 0.9816933f}, {0.955244f, -1.9104879f, 0.955244f, -1.8381663f, 0.9828096f}},
-      {{0.6581145f, -1.316229f, 0.6581145f, -1.2536453f, 0.3788127f}, {0.6597025f, -1.3194049f, 0.6597025f, -1.2566702f, 0.3821396f}, {0.6643659f, -1.3287319f, 0.6643659f, -1.2655537f, 0.39191f}, {0.671819f, -1.3436381f, 0.671819f, -1.2797511f, 0.407525f}, {0.6816326f, -1.3632653f, 0.6816326f, -1.2984451f, 0.4280855f}, {0.6932921f, -1.3865841f, 0.6932921f, -1.3206552f, 0.452513f}, {0.706257f, -1.412514f, 0.706257f, -1.3453521f, 0.4796758f}, {0.7200124f, -1.4400249f, 0.7200124f, -1.371555f, 0.5084948f}, {0.7341045f, -1.4682089f, 0.7341045f, -1.3983989f, 0.5380189f}, {0.7481592f, -1.4963185f, 0.7481592f, -1.4251719f, 0.567465f}, {0.7618883f, -1.5237765f, 0.7618883f, -1.4513244f, 0.5962286f}, {0.7750835f, -1.550167f, 0.7750835f, -1.4764601f, 0.6238739f}, {0.7876069f, -1.5752137f, 0.7876069f, -1.5003159f, 0.6501115f}, {0.7993772f, -1.5987543f, 0.7993772f, -1.5227372f, 0.6747715f}, {0.8103574f, -1.6207147f, 0.8103574f, -1.5436534f, 0.6977761f}, {0.8205429f, -1.6410858f, 0.8205429f, -1.5630559f, 0.7191157f}, {0.8299519f, -1.6599039f, 0.8299519f, -1.5809792f, 0.7388285f}, {0.8386176f, -1.6772353f, 0.8386176f, -1.5974865f, 0.756984f}, {0.8465824f, -1.6931648f, 0.8465824f, -1.6126587f, 0.7736709f}, {0.8538934f, -1.7077868f, 0.8538934f, -1.6265855f, 0.7889882f}, {0.8605997f, -1.7211994f, 0.8605997f, -1.6393603f, 0.8030385f}, {0.8667499f, -1.7334999f, 0.8667499f, -1.6510759f, 0.8159239f}, {0.8723912f, -1.7447823f, 0.8723912f, -1.6618219f, 0.8277428f}, {0.8775679f, -1.7551358f, 0.8775679f, -1.671683f, 0.8385885f}, {0.8823216f, -1.7646433f, 0.8823216f, -1.6807385f, 0.848548f}, {0.8866908f, -1.7733816f, 0.8866908f, -1.6890613f, 0.8577019f}, {0.8907106f, -1.7814212f, 0.8907106f, -1.6967186f, 0.8661237f}, {0.8944131f, -1.7888261f, 0.8944131f, -1.7037715f, 0.8738807f}, {0.8978273f, -1.7956546f, 0.8978273f, -1.7102753f, 0.8810339f}, {0.9009797f, -1.8019595f, 0.9009797f, -1.7162804f, 0.8876386f}, {0.9038941f, -1.8077883f, 0.9038941f, -1.7218321f, 0.8937445f}, {0.906592f, -1.813184f, 0.906592f, -1.7269713f, 0.8993968f}, {0.9090927f, -1.8181855f, 0.9090927f, -1.7317349f, 0.9046361f}, {0.9114138f, -1.8228276f, 0.9114138f, -1.7361562f, 0.9094989f}, {0.9135709f, -1.8271417f, 0.9135709f, -1.7402653f, 0.9140181f}, {0.9155782f, -1.8311563f, 0.9155782f, -1.744089f, 0.9182236f}, {0.9174485f, -1.834897f, 0.9174485f, -1.7476518f, 0.9221422f}, {0.9191934f, -1.8383868f, 0.9191934f, -1.7509757f, 0.9257979f}, {0.9208233f, -1.8416466f, 0.9208233f, -1.7540805f, 0.9292127f}, {0.9223476f, -1.8446953f, 0.9223476f, -1.7569842f, 0.9324063f}, {0.9237749f, -1.8475499f, 0.9237749f, -1.7597031f, 0.9353967f}, {0.9251129f, -1.8502259f, 0.9251129f, -1.7622519f, 0.9381999f}, {0.9263687f, -1.8527373f, 0.9263687f, -1.7646439f, 0.9408308f}, {0.9275485f, -1.8550969f, 0.9275485f, -1.7668913f, 0.9433026f}, {0.9286581f, -1.8573163f, 0.9286581f, -1.7690051f, 0.9456274f}, {0.9297277f, -1.8594553f, 0.9297277f, -1.7710424f, 0.9478682f}, {0.9307933f, -1.8615865f, 0.9307933f, -1.7730723f, 0.9501007f}, {0.931852f, -1.8637041f, 0.931852f, -1.7750892f, 0.952319f}, {0.9329004f, -1.8658009f, 0.9329004f, -1.7770863f, 0.9545155f}, {0.9339349f, -1.8678697f, 0.9339349f, -1.7790568f, 0.9566827f}, {0.9349517f, -1.8699034f, 0.9349517f, -1.7809937f, 0.958813f}, {0.9359474f, -1.8718948f, 0.9359474f, -1.7828904f, 0.9608991f}, {0.9369187f, -1.8738374f, 0.9369187f, -1.7847406f, 0.9629341f}, {0.9378626f, -1.8757252f, 0.9378626f, -1.7865387f, 0.9649117f}, {0.9387765f, -1.877553f, 0.9387765f, -1.7882797f, 0.9668264f}, {0.9396583f, -1.8793166f, 0.9396583f, -1.7899593f, 0.9686738f}, {0.9405061f, -1.8810122f, 0.9405061f, -1.7915743f, 0.97045f}, {0.9413187f, -1.8826373f, 0.9413187f, -1.7931222f, 0.9721525f}, {0.9420951f, -1.8841902f, 0.9420951f, -1.7946012f, 0.9737792f}, {0.9428349f, -1.8856698f, 0.9428349f, -1.7960105f, 0.9753292f}, {0.943538f, -1.887076f, 0.943538f, -1.7973499f, 0.9768022f}, {0.9442046f, -1.8884093f, 0.9442046f, -1.7986197f, 0.9781988f}, {0.9448353f, -1.8896706f, 0.9448353f, -1.799821f, 0.9795201f}, {0.9454307f, -1.8908615f, 0.9454307f, -1.8009553f, 0.9807676f}},
-      {{0.6272304f, -1.2544607f, 0.6272304f, -1.1794228f, 0.3294986f}, {0.6288643f, -1.2577285f, 0.6288643f, -1.1824951f, 0.3329619f}, {0.6336663f, -1.2673325f, 0.6336663f, -1.1915247f, 0.3431404f}, {0.641352f, -1.282704f, 0.641352f, -1.2059767f, 0.3594314f}, {0.6514931f, -1.3029862f, 0.6514931f, -1.2250456f, 0.3809267f}, {0.6635729f, -1.3271458f, 0.6635729f, -1.2477601f, 0.4065315f}, {0.6770454f, -1.3540908f, 0.6770454f, -1.2730933f, 0.4350883f}, {0.6913858f, -1.3827717f, 0.6913858f, -1.3000586f, 0.4654848f}, {0.7061269f, -1.4122539f, 0.7061269f, -1.3277773f, 0.4967305f}, {0.7208796f, -1.4417591f, 0.7208796f, -1.3555176f, 0.5280006f}, {0.7353392f, -1.4706783f, 0.7353392f, -1.3827069f, 0.5586497f}, {0.7492824f, -1.4985647f, 0.7492824f, -1.4089253f, 0.5882042f}, {0.7625573f, -1.5251146f, 0.7625573f, -1.433887f, 0.6163422f}, {0.7750712f, -1.5501423f, 0.7750712f, -1.4574177f, 0.642867f}, {0.7867777f, -1.5735554f, 0.7867777f, -1.4794302f, 0.6676805f}, {0.7976652f, -1.5953304f, 0.7976652f, -1.4999028f, 0.6907581f}, {0.807747f, -1.615494f, 0.807747f, -1.5188602f, 0.7121278f}, {0.817053f, -1.6341061f, 0.817053f, -1.536359f, 0.7318532f}, {0.8256239f, -1.6512478f, 0.8256239f, -1.5524753f, 0.7500202f}, {0.8335061f, -1.6670122f, 0.8335061f, -1.5672967f, 0.7667276f}, {0.8407488f, -1.6814977f, 0.8407488f, -1.5809157f, 0.7820796f}, {0.8474016f, -1.6948033f, 0.8474016f, -1.5934254f, 0.7961811f}, {0.8535127f, -1.7070254f, 0.8535127f, -1.6049165f, 0.8091344f}, {0.8591281f, -1.7182563f, 0.8591281f, -1.6154755f, 0.821037f}, {0.8642911f, -1.7285822f, 0.8642911f, -1.6251838f, 0.8319806f}, {0.8690417f, -1.7380835f, 0.8690417f, -1.6341167f, 0.8420502f}, {0.873417f, -1.7468341f, 0.873417f, -1.6423439f, 0.8513242f}, {0.8774508f, -1.7549016f, 0.8774508f, -1.6499289f, 0.8598744f}, {0.8811739f, -1.7623478f, 0.8811739f, -1.6569296f, 0.8677659f}, {0.8846142f, -1.7692285f, 0.8846142f, -1.6633988f, 0.8750582f}, {0.8877972f, -1.7755945f, 0.8877972f, -1.669384f, 0.881805f}, {0.8907458f, -1.7814916f, 0.8907458f, -1.6749284f, 0.8880549f}, {0.8934807f, -1.7869614f, 0.8934807f, -1.6800709f, 0.8938518f}, {0.8960206f, -1.7920411f, 0.8960206f, -1.6848468f, 0.8992354f}, {0.8983823f, -1.7967647f, 0.8983823f, -1.6892878f, 0.9042415f}, {0.9005813f, -1.8011625f, 0.9005813f, -1.6934226f, 0.9089024f}, {0.9026311f, -1.8052622f, 0.9026311f, -1.6972771f, 0.9132474f}, {0.9045444f, -1.8090888f, 0.9045444f, -1.7008747f, 0.9173028f}, {0.9063323f, -1.8126646f, 0.9063323f, -1.7042367f, 0.9210925f}, {0.9080051f, -1.8160102f, 0.9080051f, -1.7073821f, 0.9246382f}, {0.909572f, -1.8191439f, 0.909572f, -1.7103284f, 0.9279594f}, {0.9110413f, -1.8220826f, 0.9110413f, -1.7130913f, 0.9310739f}, {0.9124207f, -1.8248414f, 0.9124207f, -1.7156851f, 0.9339978f}, {0.9137171f, -1.8274343f, 0.9137171f, -1.7181229f, 0.9367457f}, {0.9149368f, -1.8298737f, 0.9149368f, -1.7204164f, 0.939331f}, {0.9161128f, -1.8322255f, 0.9161128f, -1.7226275f, 0.9418235f}, {0.9172847f, -1.8345693f, 0.9172847f, -1.7248311f, 0.9443075f}, {0.9184493f, -1.8368987f, 0.9184493f, -1.7270212f, 0.9467762f}, {0.919603f, -1.8392059f, 0.919603f, -1.7291903f, 0.9492215f}, {0.9207415f, -1.8414829f, 0.9207415f, -1.7313312f, 0.9516347f}, {0.9218609f, -1.8437218f, 0.9218609f, -1.7334361f, 0.9540074f}, {0.9229573f, -1.8459146f, 0.9229573f, -1.7354978f, 0.9563315f}, {0.9240272f, -1.8480543f, 0.9240272f, -1.7375095f, 0.9585991f}, {0.9250671f, -1.8501342f, 0.9250671f, -1.7394649f, 0.9608034f}, {0.9260742f, -1.8521484f, 0.9260742f, -1.7413587f, 0.9629381f}, {0.9270461f, -1.8540922f, 0.9270461f, -1.7431862f, 0.9649982f}, {0.9279808f, -1.8559615f, 0.9279808f, -1.7449437f, 0.9669793f}, {0.9288768f, -1.8577535f, 0.9288768f, -1.7466285f, 0.9688786f}, {0.9297331f, -1.8594662f, 0.9297331f, -1.7482387f, 0.9706937f}, {0.9305492f, -1.8610984f, 0.9305492f, -1.7497733f, 0.9724235f}, {0.9313249f, -1.8626499f, 0.9313249f, -1.751232f, 0.9740678f}, {0.9320605f, -1.8641211f, 0.9320605f, -1.7526152f, 0.975627f}, {0.9327566f, -1.8655131f, 0.9327566f, -1.753924f, 0.9771023f}, {0.9334139f, -1.8668277f, 0.9334139f, -1.7551599f, 0.9784955f}},
-      {{0.594496f, -1.1889919f, 0.594496f, -1.0993388f, 0.278645f}, {0.5961624f, -1.1923248f, 0.5961624f, -1.1024203f, 0.2822292f}, {0.6010637f, -1.2021275f, 0.6010637f, -1.1114839f, 0.2927711f}, {0.6089204f, -1.2178408f, 0.6089204f, -1.1260124f, 0.3096692f}, {0.6193094f, -1.2386188f, 0.6193094f, -1.1452237f, 0.3320139f}, {0.6317179f, -1.2634358f, 0.6317179f, -1.1681694f, 0.3587022f}, {0.6456001f, -1.2912001f, 0.6456001f, -1.1938402f, 0.38856f}, {0.6604266f, -1.3208532f, 0.6604266f, -1.2212574f, 0.420449f}, {0.6757215f, -1.351443f, 0.6757215f, -1.2495406f, 0.4533453f}, {0.6910835f, -1.3821671f, 0.6910835f, -1.277948f, 0.4863861f}, {0.7061944f, -1.4123887f, 0.7061944f, -1.3058909f, 0.5188866f}, {0.7208163f, -1.4416327f, 0.7208163f, -1.3329297f, 0.5503356f}, {0.7347841f, -1.4695681f, 0.7347841f, -1.3587588f, 0.5803774f}, {0.7479928f, -1.4959857f, 0.7479928f, -1.3831844f, 0.6087869f}, {0.7603863f, -1.5207726f, 0.7603863f, -1.4061024f, 0.6354429f}, {0.7719449f, -1.5438898f, 0.7719449f, -1.4274765f, 0.6603032f}, {0.7826758f, -1.5653517f, 0.7826758f, -1.44732f, 0.6833833f}, {0.7926048f, -1.5852097f, 0.7926048f, -1.4656807f, 0.7047387f}, {0.8017697f, -1.6035393f, 0.8017697f, -1.4826282f, 0.7244504f}, {0.8102153f, -1.6204307f, 0.8102153f, -1.4982459f, 0.7426154f}, {0.8179904f, -1.6359809f, 0.8179904f, -1.5126236f, 0.7593381f}, {0.8251445f, -1.650289f, 0.8251445f, -1.5258529f, 0.7747252f}, {0.8317265f, -1.663453f, 0.8317265f, -1.5380243f, 0.7888818f}, {0.8377834f, -1.6755669f, 0.8377834f, -1.5492247f, 0.8019091f}, {0.8433598f, -1.6867197f, 0.8433598f, -1.5595366f, 0.8139028f}, {0.8484972f, -1.6969945f, 0.8484972f, -1.5690366f, 0.8249523f}, {0.8532341f, -1.7064682f, 0.8532341f, -1.577796f, 0.8351404f}, {0.8576058f, -1.7152116f, 0.8576058f, -1.5858801f, 0.8445431f}, {0.8616447f, -1.7232894f, 0.8616447f, -1.5933488f, 0.8532299f}, {0.8653802f, -1.7307604f, 0.8653802f, -1.6002565f, 0.8612643f}, {0.8688391f, -1.7376783f, 0.8688391f, -1.6066527f, 0.8687038f}, {0.8720458f, -1.7440916f, 0.8720458f, -1.6125824f, 0.8756007f}, {0.8750221f, -1.7500442f, 0.8750221f, -1.6180863f, 0.8820022f}, {0.8777881f, -1.7555761f, 0.8777881f, -1.6232011f, 0.8879512f}, {0.8803617f, -1.7607233f, 0.8803617f, -1.6279601f, 0.8934865f}, {0.8827591f, -1.7655183f, 0.8827591f, -1.6323936f, 0.898643f}, {0.8849953f, -1.7699906f, 0.8849953f, -1.6365287f, 0.9034526f}, {0.8870835f, -1.774167f, 0.8870835f, -1.6403901f, 0.9079438f}, {0.8890358f, -1.7780715f, 0.8890358f, -1.6440002f, 0.9121428f}, {0.8908631f, -1.7817262f, 0.8908631f, -1.6473793f, 0.9160731f}, {0.8925755f, -1.7851509f, 0.8925755f, -1.6505458f, 0.919756f}, {0.8941818f, -1.7883637f, 0.8941818f, -1.6535163f, 0.923211f}, {0.8956904f, -1.7913809f, 0.8956904f, -1.656306f, 0.9264557f}, {0.8971087f, -1.7942175f, 0.8971087f, -1.6589287f, 0.9295062f}, {0.8984435f, -1.7968871f, 0.8984435f, -1.661397f, 0.9323771f}, {0.8997308f, -1.7994616f, 0.8997308f, -1.6637774f, 0.9351457f}, {0.901014f, -1.8020281f, 0.901014f, -1.6661504f, 0.9379057f}, {0.9022898f, -1.8045795f, 0.9022898f, -1.6685095f, 0.9406496f}, {0.9035537f, -1.8071074f, 0.9035537f, -1.6708467f, 0.9433681f}, {0.9048015f, -1.8096029f, 0.9048015f, -1.6731541f, 0.9460518f}, {0.9060287f, -1.8120573f, 0.9060287f, -1.6754234f, 0.9486912f}, {0.907231f, -1.814462f, 0.907231f, -1.6776468f, 0.9512772f}, {0.9084045f, -1.8168089f, 0.9084045f, -1.6798167f, 0.9538011f}, {0.9095454f, -1.8190909f, 0.9095454f, -1.6819266f, 0.9562551f}, {0.9106507f, -1.8213014f, 0.9106507f, -1.6839705f, 0.9586323f}, {0.9117176f, -1.8234351f, 0.9117176f, -1.6859433f, 0.960927f}, {0.9127438f, -1.8254877f, 0.9127438f, -1.6878411f, 0.9631342f}, {0.9137279f, -1.8274557f, 0.9137279f, -1.6896607f, 0.9652507f}, {0.9146685f, -1.829337f, 0.9146685f, -1.6914002f, 0.9672739f}, {0.9155652f, -1.8311304f, 0.9155652f, -1.6930583f, 0.9692024f}, {0.9164177f, -1.8328353f, 0.9164177f, -1.6946347f, 0.9710359f}, {0.9172262f, -1.8344524f, 0.9172262f, -1.6961298f, 0.9727749f}, {0.9179914f, -1.8359827f, 0.9179914f, -1.6975448f, 0.9744207f}, {0.9187141f, -1.8374281f, 0.9187141f, -1.6988812f, 0.975975f}},
-      {{0.559975f, -1.11995f, 0.559975f, -1.0132296f, 0.2266704f}, {0.5616581f, -1.1233162f, 0.5616581f, -1.016275f, 0.2303574f}, {0.5666124f, -1.1332249f, 0.5666124f, -1.0252395f, 0.2412103f}, {0.5745663f, -1.1491326f, 0.5745663f, -1.0396314f, 0.2586339f}, {0.5851072f, -1.1702144f, 0.5851072f, -1.0587042f, 0.2817245f}, {0.5977321f, -1.1954641f, 0.5977321f, -1.0815479f, 0.3093803f}, {0.6119015f, -1.2238031f, 0.6119015f, -1.1071864f, 0.3404197f}, {0.627088f, -1.254176f, 0.627088f, -1.1346652f, 0.3736869f}, {0.642812f, -1.285624f, 0.642812f, -1.1631164f, 0.4081316f}, {0.6586644f, -1.3173288f, 0.6586644f, -1.1918001f, 0.4428575f}, {0.6743159f, -1.3486319f, 0.6743159f, -1.2201203f, 0.4771435f}, {0.6895165f, -1.3790331f, 0.6895165f, -1.2476245f, 0.5104416f}, {0.7040882f, -1.4081764f, 0.7040882f, -1.2739908f, 0.542362f}, {0.7179143f, -1.4358287f, 0.7179143f, -1.2990081f, 0.5726493f}, {0.7309282f, -1.4618563f, 0.7309282f, -1.3225555f, 0.6011571f}, {0.7431013f, -1.4862026f, 0.7431013f, -1.3445819f, 0.6278234f}, {0.754434f, -1.5088681f, 0.754434f, -1.3650875f, 0.6526487f}, {0.7649468f, -1.5298935f, 0.7649468f, -1.3841094f, 0.6756776f}, {0.7746734f, -1.5493468f, 0.7746734f, -1.401709f, 0.6969847f}, {0.7836565f, -1.567313f, 0.7836565f, -1.4179632f, 0.7166628f}, {0.791943f, -1.583886f, 0.791943f, -1.4329569f, 0.7348151f}, {0.7995819f, -1.5991637f, 0.7995819f, -1.4467788f, 0.7515486f}, {0.8066219f, -1.6132438f, 0.8066219f, -1.4595172f, 0.7669704f}, {0.8131106f, -1.6262212f, 0.8131106f, -1.471258f, 0.7811844f}, {0.8190932f, -1.6381863f, 0.8190932f, -1.4820829f, 0.7942897f}, {0.8246121f, -1.6492243f, 0.8246121f, -1.4920691f, 0.8063794f}, {0.8297071f, -1.6594142f, 0.8297071f, -1.5012881f, 0.8175404f}, {0.8344147f, -1.6688294f, 0.8344147f, -1.509806f, 0.8278527f}, {0.8387685f, -1.6775369f, 0.8387685f, -1.5176838f, 0.83739f}, {0.8427991f, -1.6855983f, 0.8427991f, -1.524977f, 0.8462195f}, {0.8465347f, -1.6930695f, 0.8465347f, -1.5317363f, 0.8544027f}, {0.8500008f, -1.7000015f, 0.8500008f, -1.5380078f, 0.8619953f}, {0.8532204f, -1.7064407f, 0.8532204f, -1.5438334f, 0.8690481f}, {0.8562145f, -1.712429f, 0.8562145f, -1.5492511f, 0.875607f}, {0.8590023f, -1.7180046f, 0.8590023f, -1.5542953f, 0.8817139f}, {0.861601f, -1.7232019f, 0.861601f, -1.5589974f, 0.8874065f}, {0.8640262f, -1.7280524f, 0.8640262f, -1.5633856f, 0.8927191f}, {0.8662921f, -1.7325842f, 0.8662921f, -1.5674857f, 0.8976828f}, {0.8684117f, -1.7368233f, 0.8684117f, -1.5713208f, 0.9023259f}, {0.8703965f, -1.7407931f, 0.8703965f, -1.5749123f, 0.9066738f}, {0.8722573f, -1.7445146f, 0.8722573f, -1.5782792f, 0.91075f}, {0.8740036f, -1.7480073f, 0.8740036f, -1.5814391f, 0.9145755f}, {0.8756443f, -1.7512887f, 0.8756443f, -1.5844078f, 0.9181696f}, {0.8771874f, -1.7543748f, 0.8771874f, -1.5871998f, 0.9215498f}, {0.8786401f, -1.7572802f, 0.8786401f, -1.5898284f, 0.9247321f}, {0.8800415f, -1.7600831f, 0.8800415f, -1.5923641f, 0.927802f}, {0.8814391f, -1.7628781f, 0.8814391f, -1.5948928f, 0.9308634f}, {0.8828288f, -1.7656577f, 0.8828288f, -1.5974075f, 0.9339078f}, {0.8842062f, -1.7684124f, 0.8842062f, -1.5998998f, 0.9369251f}, {0.8855664f, -1.7711328f, 0.8855664f, -1.6023609f, 0.9399047f}, {0.8869046f, -1.7738091f, 0.8869046f, -1.6047822f, 0.942836f}, {0.888216f, -1.776432f, 0.888216f, -1.6071552f, 0.9457089f}, {0.8894964f, -1.7789928f, 0.8894964f, -1.6094719f, 0.9485136f}, {0.8907417f, -1.7814833f, 0.8907417f, -1.6117251f, 0.9512415f}, {0.8919483f, -1.7838966f, 0.8919483f, -1.6139085f, 0.9538847f}, {0.8931133f, -1.7862267f, 0.8931133f, -1.6160165f, 0.9564368f}, {0.8942343f, -1.7884687f, 0.8942343f, -1.6180448f, 0.9588925f}, {0.8953095f, -1.7906189f, 0.8953095f, -1.6199902f, 0.9612476f}, {0.8963375f, -1.7926749f, 0.8963375f, -1.6218503f, 0.9634995f}, {0.8973176f, -1.7946352f, 0.8973176f, -1.6236238f, 0.9656466f}, {0.8982497f, -1.7964993f, 0.8982497f, -1.6253102f, 0.9676884f}, {0.8991338f, -1.7982677f, 0.8991338f, -1.6269101f, 0.9696252f}, {0.8999708f, -1.7999415f, 0.8999708f, -1.6284245f, 0.9714586f}, {0.9007614f, -1.8015228f, 0.9007614f, -1.6298551f, 0.9731906f}},
-      {{0.5237655f, -1.0475311f, 0.5237655f, -0.9209774f, 0.1740848f}, {0.5254472f, -1.0508944f, 0.5254472f, -0.9239344f, 0.1778544f}, {0.5304013f, -1.0608026f, 0.5304013f, -0.9326455f, 0.1889596f}, {0.5383673f, -1.0767345f, 0.5383673f, -0.9466527f, 0.2068163f}, {0.5489479f, -1.0978958f, 0.5489479f, -0.9652575f, 0.2305342f}, {0.5616563f, -1.1233126f, 0.5616563f, -0.9876036f, 0.2590215f}, {0.5759662f, -1.1519323f, 0.5759662f, -1.0127658f, 0.2910989f}, {0.5913582f, -1.1827165f, 0.5913582f, -1.0398309f, 0.3256021f}, {0.6073555f, -1.2147111f, 0.6073555f, -1.0679601f, 0.361462f}, {0.623546f, -1.2470921f, 0.623546f, -1.0964292f, 0.397755f}, {0.6395934f, -1.2791869f, 0.6395934f, -1.1246465f, 0.4337272f}, {0.6552378f, -1.3104756f, 0.6552378f, -1.1521553f, 0.468796f}, {0.6702901f, -1.3405802f, 0.6702901f, -1.1786228f, 0.5025375f}, {0.6846224f, -1.3692449f, 0.6846224f, -1.2038245f, 0.5346653f}, {0.6981576f, -1.3963153f, 0.6981576f, -1.2276245f, 0.5650061f}, {0.7108581f, -1.4217162f, 0.7108581f, -1.2499567f, 0.5934757f}, {0.7227163f, -1.4454326f, 0.7227163f, -1.2708079f, 0.6200573f}, {0.7337464f, -1.4674927f, 0.7337464f, -1.2902029f, 0.6447826f}, {0.7439775f, -1.4879549f, 0.7439775f, -1.308193f, 0.6677169f}, {0.7534485f, -1.506897f, 0.7534485f, -1.3248466f, 0.6889473f}, {0.7622039f, -1.5244079f, 0.7622039f, -1.340242f, 0.7085737f}, {0.7702912f, -1.5405824f, 0.7702912f, -1.3544625f, 0.7267023f}, {0.7777582f, -1.5555163f, 0.7777582f, -1.3675922f, 0.7434404f}, {0.784652f, -1.569304f, 0.784652f, -1.3797142f, 0.7588938f}, {0.7910181f, -1.5820361f, 0.7910181f, -1.3909081f, 0.7731641f}, {0.7968993f, -1.5937986f, 0.7968993f, -1.4012495f, 0.7863476f}, {0.8023359f, -1.6046718f, 0.8023359f, -1.4108092f, 0.7985345f}, {0.8073654f, -1.6147307f, 0.8073654f, -1.4196529f, 0.8098086f}, {0.8120221f, -1.6240442f, 0.8120221f, -1.4278411f, 0.8202472f}, {0.8163378f, -1.6326756f, 0.8163378f, -1.4354298f, 0.8299214f}, {0.8203415f, -1.640683f, 0.8203415f, -1.4424698f, 0.8388962f}, {0.8240596f, -1.6481192f, 0.8240596f, -1.4490076f, 0.8472308f}, {0.8275163f, -1.6550326f, 0.8275163f, -1.4550858f, 0.8549793f}, {0.8307334f, -1.6614669f, 0.8307334f, -1.4607427f, 0.862191f}, {0.833731f, -1.6674621f, 0.833731f, -1.4660136f, 0.8689105f}, {0.8365272f, -1.6730543f, 0.8365272f, -1.4709303f, 0.8751784f}, {0.8391383f, -1.6782766f, 0.8391383f, -1.4755217f, 0.8810316f}, {0.8415794f, -1.6831589f, 0.8415794f, -1.4798141f, 0.8865036f}, {0.8438641f, -1.6877282f, 0.8438641f, -1.4838314f, 0.891625f}, {0.8460047f, -1.6920094f, 0.8460047f, -1.4875954f, 0.8964234f}, {0.8480124f, -1.6960249f, 0.8480124f, -1.4911258f, 0.900924f}, {0.8498976f, -1.6997952f, 0.8498976f, -1.4944406f, 0.9051498f}, {0.8516694f, -1.7033389f, 0.8516694f, -1.4975561f, 0.9091216f}, {0.8533365f, -1.706673f, 0.8533365f, -1.5004875f, 0.9128586f}, {0.8549066f, -1.7098132f, 0.8549066f, -1.5032483f, 0.9163781f}, {0.8564218f, -1.7128435f, 0.8564218f, -1.5059125f, 0.9197745f}, {0.8579333f, -1.7158665f, 0.8579333f, -1.5085703f, 0.9231628f}, {0.8594369f, -1.7188738f, 0.8594369f, -1.5112143f, 0.9265333f}, {0.8609277f, -1.7218553f, 0.8609277f, -1.5138356f, 0.9298751f}, {0.8624003f, -1.7248006f, 0.8624003f, -1.5164251f, 0.9331762f}, {0.8638496f, -1.7276993f, 0.8638496f, -1.5189735f, 0.936425f}, {0.8652705f, -1.730541f, 0.8652705f, -1.5214719f, 0.9396101f}, {0.8666581f, -1.7333163f, 0.8666581f, -1.5239119f, 0.9427206f}, {0.8680082f, -1.7360163f, 0.8680082f, -1.5262858f, 0.9457469f}, {0.8693167f, -1.7386334f, 0.8693167f, -1.5285867f, 0.9486801f}, {0.8705805f, -1.741161f, 0.8705805f, -1.5308089f, 0.9515131f}, {0.8717969f, -1.7435938f, 0.8717969f, -1.5329478f, 0.9542398f}, {0.8729638f, -1.7459277f, 0.8729638f, -1.5349997f, 0.9568557f}, {0.8740799f, -1.7481599f, 0.8740799f, -1.5369622f, 0.9593575f}, {0.8751443f, -1.7502887f, 0.8751443f, -1.5388339f, 0.9617435f}, {0.8761568f, -1.7523135f, 0.8761568f, -1.5406141f, 0.9640129f}, {0.8771174f, -1.7542348f, 0.8771174f, -1.5423033f, 0.9661664f}, {0.8780269f, -1.7560538f, 0.8780269f, -1.5439025f, 0.9682051f}, {0.8788863f, -1.7577726f, 0.8788863f, -1.5454136f, 0.9701315f}},
-      {{0.486002f, -0.9720039f, 0.486002f, -0.8225124f, 0.1214954f}, {0.4876621f, -0.9753241f, 0.4876621f, -0.825322f, 0.1253263f}, {0.4925566f, -0.9851133f, 0.4925566f, -0.8336056f, 0.1366209f}, {0.5004392f, -1.0008785f, 0.5004392f, -0.8469461f, 0.1548108f}, {0.5109329f, -1.0218658f, 0.5109329f, -0.8647056f, 0.1790259f}, {0.5235725f, -1.0471451f, 0.5235725f, -0.8860971f, 0.2081931f}, {0.5378521f, -1.0757043f, 0.5378521f, -0.9102639f, 0.2411446f}, {0.5532675f, -1.1065351f, 0.5532675f, -0.9363531f, 0.2767171f}, {0.5693509f, -1.1387017f, 0.5693509f, -0.9635725f, 0.3138309f}, {0.5856929f, -1.1713858f, 0.5856929f, -0.9912299f, 0.3515417f}, {0.6019549f, -1.2039098f, 0.6019549f, -1.0187518f, 0.3890677f}, {0.6178705f, -1.2357411f, 0.6178705f, -1.0456875f, 0.4257946f}, {0.633242f, -1.2664839f, 0.633242f, -1.0717022f, 0.4612656f}, {0.6479316f, -1.2958631f, 0.6479316f, -1.096563f, 0.4951633f}, {0.6618522f, -1.3237043f, 0.6618522f, -1.1201223f, 0.5272864f}, {0.6749569f, -1.3499138f, 0.6749569f, -1.1423008f, 0.5575267f}, {0.6872299f, -1.3744599f, 0.6872299f, -1.1630718f, 0.585848f}, {0.6986785f, -1.397357f, 0.6986785f, -1.1824474f, 0.6122667f}, {0.709326f, -1.418652f, 0.709326f, -1.2004673f, 0.6368368f}, {0.7192068f, -1.4384135f, 0.7192068f, -1.2171895f, 0.6596375f}, {0.7283619f, -1.4567237f, 0.7283619f, -1.2326837f, 0.6807638f}, {0.7368361f, -1.4736722f, 0.7368361f, -1.2470255f, 0.7003189f}, {0.7446756f, -1.4893513f, 0.7446756f, -1.2602932f, 0.7184094f}, {0.7519265f, -1.503853f, 0.7519265f, -1.2725646f, 0.7351414f}, {0.7586334f, -1.5172668f, 0.7586334f, -1.2839154f, 0.7506182f}, {0.764839f, -1.5296781f, 0.764839f, -1.2944178f, 0.7649383f}, {0.7705837f, -1.5411675f, 0.7705837f, -1.3041402f, 0.7781948f}, {0.7759052f, -1.5518104f, 0.7759052f, -1.3131463f, 0.7904745f}, {0.7808383f, -1.5616766f, 0.7808383f, -1.3214951f, 0.8018581f}, {0.7854153f, -1.5708306f, 0.7854153f, -1.3292412f, 0.81242f}, {0.7896659f, -1.5793317f, 0.7896659f, -1.3364349f, 0.8222285f}, {0.7936171f, -1.5872342f, 0.7936171f, -1.343122f, 0.8313464f}, {0.7972938f, -1.5945876f, 0.7972938f, -1.3493445f, 0.8398307f}, {0.8007186f, -1.6014373f, 0.8007186f, -1.3551407f, 0.8477339f}, {0.8039122f, -1.6078245f, 0.8039122f, -1.3605455f, 0.8551034f}, {0.8068934f, -1.6137868f, 0.8068934f, -1.3655909f, 0.8619827f}, {0.8096792f, -1.6193585f, 0.8096792f, -1.3703056f, 0.8684113f}, {0.8122853f, -1.6245706f, 0.8122853f, -1.3747162f, 0.8744251f}, {0.8147259f, -1.6294517f, 0.8147259f, -1.3788466f, 0.8800569f}, {0.8170137f, -1.6340275f, 0.8170137f, -1.3827186f, 0.8853364f}, {0.8191608f, -1.6383216f, 0.8191608f, -1.3863523f, 0.8902909f}, {0.8211777f, -1.6423554f, 0.8211777f, -1.3897657f, 0.8949451f}, {0.8230743f, -1.6461486f, 0.8230743f, -1.3929755f, 0.8993217f}, {0.8248595f, -1.649719f, 0.8248595f, -1.3959968f, 0.9034413f}, {0.8265415f, -1.6530831f, 0.8265415f, -1.3988435f, 0.9073227f}, {0.8281654f, -1.6563308f, 0.8281654f, -1.4015917f, 0.9110699f}, {0.8297859f, -1.6595718f, 0.8297859f, -1.4043343f, 0.9148094f}, {0.8313986f, -1.6627973f, 0.8313986f, -1.4070637f, 0.9185309f}, {0.8329982f, -1.6659963f, 0.8329982f, -1.4097707f, 0.9222219f}, {0.8345788f, -1.6691577f, 0.8345788f, -1.4124459f, 0.9258695f}, {0.836135f, -1.6722701f, 0.836135f, -1.4150796f, 0.9294606f}, {0.8376612f, -1.6753225f, 0.8376612f, -1.4176626f, 0.9329824f}, {0.8391523f, -1.6783046f, 0.8391523f, -1.420186f, 0.9364232f}, {0.8406034f, -1.6812069f, 0.8406034f, -1.4226419f, 0.9397718f}, {0.8420105f, -1.6840209f, 0.8420105f, -1.4250232f, 0.9430187f}, {0.8433698f, -1.6867397f, 0.8433698f, -1.4273238f, 0.9461556f}, {0.8446786f, -1.6893572f, 0.8446786f, -1.4295388f, 0.9491757f}, {0.8459346f, -1.6918692f, 0.8459346f, -1.4316644f, 0.9520739f}, {0.8471361f, -1.6942723f, 0.8471361f, -1.4336979f, 0.9548467f}, {0.8482824f, -1.6965648f, 0.8482824f, -1.4356378f, 0.9574917f}, {0.8493729f, -1.6987459f, 0.8493729f, -1.4374835f, 0.9600083f}, {0.850408f, -1.7008159f, 0.850408f, -1.4392352f, 0.9623967f}, {0.8513881f, -1.7027763f, 0.8513881f, -1.440894f, 0.9646586f}, {0.8523145f, -1.704629f, 0.8523145f, -1.4424618f, 0.9667962f}},
-      {{0.446856f, -0.893712f, 0.446856f, -0.7178093f, 0.0696147f}, {0.4484728f, -0.8969457f, 0.4484728f, -0.7204065f, 0.0734848f}, {0.4532437f, -0.9064874f, 0.4532437f, -0.7280702f, 0.0849046f}, {0.460939f, -0.921878f, 0.460939f, -0.7404316f, 0.1033244f}, {0.4712063f, -0.9424125f, 0.4712063f, -0.7569245f, 0.1279006f}, {0.4836082f, -0.9672164f, 0.4836082f, -0.7768464f, 0.1575864f}, {0.4976653f, -0.9953306f, 0.4976653f, -0.7994271f, 0.1912342f}, {0.5128958f, -1.0257915f, 0.5128958f, -0.8238926f, 0.2276905f}, {0.5288475f, -1.0576951f, 0.5288475f, -0.8495168f, 0.2658734f}, {0.5451206f, -1.0902412f, 0.5451206f, -0.8756571f, 0.3048253f}, {0.561379f, -1.122758f, 0.561379f, -0.9017738f, 0.3437421f}, {0.5773543f, -1.1547087f, 0.5773543f, -0.9274359f, 0.3819814f}, {0.5928432f, -1.1856864f, 0.5928432f, -0.9523165f, 0.4190562f}, {0.6077001f, -1.2154003f, 0.6077001f, -0.9761821f, 0.4546185f}, {0.6218293f, -1.2436586f, 0.6218293f, -0.9988785f, 0.4884388f}, {0.6351751f, -1.2703503f, 0.6351751f, -1.0203166f, 0.5203839f}, {0.6477135f, -1.295427f, 0.6477135f, -1.0404577f, 0.5503963f}, {0.6594441f, -1.3188883f, 0.6594441f, -1.0593013f, 0.5784753f}, {0.6703841f, -1.3407682f, 0.6703841f, -1.0768747f, 0.6046616f}, {0.6805623f, -1.3611246f, 0.6805623f, -1.0932245f, 0.6290246f}, {0.6900155f, -1.3800309f, 0.6900155f, -1.1084097f, 0.6516522f}, {0.6987849f, -1.3975699f, 0.6987849f, -1.1224966f, 0.6726432f}, {0.7069142f, -1.4138285f, 0.7069142f, -1.1355551f, 0.6921018f}, {0.7144473f, -1.4288946f, 0.7144473f, -1.1476559f, 0.7101334f}, {0.7214275f, -1.442855f, 0.7214275f, -1.1588685f, 0.7268414f}, {0.7278965f, -1.455793f, 0.7278965f, -1.16926f, 0.7423259f}, {0.733894f, -1.467788f, 0.733894f, -1.1788942f, 0.7566818f}, {0.7394573f, -1.4789147f, 0.7394573f, -1.1878309f, 0.7699985f}, {0.7446214f, -1.4892428f, 0.7446214f, -1.1961261f, 0.7823594f}, {0.7494184f, -1.4988368f, 0.7494184f, -1.2038319f, 0.7938417f}, {0.7538782f, -1.5077564f, 0.7538782f, -1.2109959f, 0.8045169f}, {0.7580283f, -1.5160565f, 0.7580283f, -1.2176624f, 0.8144507f}, {0.7618937f, -1.5237874f, 0.7618937f, -1.2238716f, 0.8237032f}, {0.7654976f, -1.5309952f, 0.7654976f, -1.2296607f, 0.8323296f}, {0.7688609f, -1.5377219f, 0.7688609f, -1.2350635f, 0.8403803f}, {0.772003f, -1.544006f, 0.772003f, -1.2401108f, 0.8479013f}, {0.7749414f, -1.5498827f, 0.7749414f, -1.2448308f, 0.8549346f}, {0.777692f, -1.555384f, 0.777692f, -1.2492493f, 0.8615187f}, {0.7802695f, -1.5605391f, 0.7802695f, -1.2533897f, 0.8676884f}, {0.7826873f, -1.5653746f, 0.7826873f, -1.2572736f, 0.8734757f}, {0.7849575f, -1.5699151f, 0.7849575f, -1.2609203f, 0.8789098f}, {0.7870913f, -1.5741826f, 0.7870913f, -1.2643479f, 0.8840172f}, {0.7890987f, -1.5781974f, 0.7890987f, -1.2675725f, 0.8888223f}, {0.7909892f, -1.5819783f, 0.7909892f, -1.2706093f, 0.8933474f}, {0.7927711f, -1.5855422f, 0.7927711f, -1.2734717f, 0.8976127f}, {0.7944921f, -1.5889843f, 0.7944921f, -1.2762363f, 0.9017323f}, {0.7962104f, -1.5924208f, 0.7962104f, -1.2789964f, 0.9058451f}, {0.797921f, -1.595842f, 0.797921f, -1.2817443f, 0.9099398f}, {0.7996184f, -1.5992367f, 0.7996184f, -1.2844708f, 0.9140026f}, {0.8012964f, -1.6025927f, 0.8012964f, -1.2871663f, 0.9180192f}, {0.8029491f, -1.6058981f, 0.8029491f, -1.2898211f, 0.9219752f}, {0.8045706f, -1.6091411f, 0.8045706f, -1.2924258f, 0.9258564f}, {0.8061553f, -1.6123106f, 0.8061553f, -1.2949714f, 0.9296497f}, {0.8076982f, -1.6153963f, 0.8076982f, -1.2974499f, 0.9333428f}, {0.8091947f, -1.6183894f, 0.8091947f, -1.2998538f, 0.936925f}, {0.810641f, -1.6212821f, 0.810641f, -1.3021772f, 0.940387f}, {0.812034f, -1.6240681f, 0.812034f, -1.3044148f, 0.9437214f}, {0.8133713f, -1.6267425f, 0.8133713f, -1.3065628f, 0.9469222f}, {0.814651f, -1.6293019f, 0.814651f, -1.3086185f, 0.9499853f}, {0.8158721f, -1.6317442f, 0.8158721f, -1.3105801f, 0.9529083f}, {0.8170342f, -1.6340685f, 0.8170342f, -1.3124469f, 0.95569f}, {0.8181375f, -1.636275f, 0.8181375f, -1.3142191f, 0.9583309f}, {0.8191826f, -1.6383652f, 0.8191826f, -1.3158979f, 0.9608324f}, {0.8201705f, -1.640341f, 0.8201705f, -1.3174848f, 0.9631972f}},
-      {{0.4065366f, -0.8130731f, 0.4065366f, -0.6068749f, 0.0192714f}, {0.4080874f, -0.8161749f, 0.4080874f, -0.60919f, 0.0231597f}, {0.4126671f, -0.8253342f, 0.4126671f, -0.6160265f, 0.0346419f}, {0.4200652f, -0.8401305f, 0.4200652f, -0.6270704f, 0.0531905f}, {0.4299575f, -0.859915f, 0.4299575f, -0.6418375f, 0.0779925f}, {0.4419394f, -0.8838789f, 0.4419394f, -0.6597241f, 0.1080337f}, {0.4555643f, -0.9111286f, 0.4555643f, -0.6800631f, 0.142194f}, {0.4703792f, -0.9407583f, 0.4703792f, -0.7021787f, 0.179338f}, {0.4859549f, -0.9719097f, 0.4859549f, -0.72543f, 0.2183895f}, {0.501907f, -1.003814f, 0.501907f, -0.7492432f, 0.2583848f}, {0.5179084f, -1.0358169f, 0.5179084f, -0.77313f, 0.2985037f}, {0.5336937f, -1.0673874f, 0.5336937f, -0.7966941f, 0.3380806f}, {0.5490575f, -1.0981151f, 0.5490575f, -0.8196292f, 0.376601f}, {0.5638499f, -1.1276997f, 0.5638499f, -0.8417111f, 0.4136884f}, {0.577968f, -1.155936f, 0.577968f, -0.8627865f, 0.4490855f}, {0.5913488f, -1.1826976f, 0.5913488f, -0.8827613f, 0.4826339f}, {0.6039604f, -1.2079208f, 0.6039604f, -0.9015878f, 0.5142538f}, {0.6157952f, -1.2315903f, 0.6157952f, -0.9192547f, 0.543926f}, {0.6268634f, -1.2537267f, 0.6268634f, -0.9357772f, 0.5716763f}, {0.637188f, -1.274376f, 0.637188f, -0.9511897f, 0.5975622f}, {0.6468006f, -1.2936013f, 0.6468006f, -0.9655394f, 0.6216632f}, {0.6557383f, -1.3114767f, 0.6557383f, -0.9788815f, 0.6440718f}, {0.6640411f, -1.3280822f, 0.6640411f, -0.9912758f, 0.6648885f}, {0.67175f, -1.3435f, 0.67175f, -1.0027836f, 0.6842164f}, {0.6789061f, -1.3578121f, 0.6789061f, -1.0134661f, 0.7021581f}, {0.6855493f, -1.3710985f, 0.6855493f, -1.0233831f, 0.718814f}, {0.6917179f, -1.3834358f, 0.6917179f, -1.0325916f, 0.73428f}, {0.6974483f, -1.3948966f, 0.6974483f, -1.0411459f, 0.7486473f}, {0.7027746f, -1.4055491f, 0.7027746f, -1.0490969f, 0.7620014f}, {0.7077285f, -1.4154569f, 0.7077285f, -1.056492f, 0.7744218f}, {0.7123395f, -1.424679f, 0.7123395f, -1.0633754f, 0.7859827f}, {0.7166349f, -1.4332699f, 0.7166349f, -1.0697875f, 0.7967522f}, {0.7206398f, -1.4412796f, 0.7206398f, -1.075766f, 0.8067933f}, {0.7243772f, -1.4487544f, 0.7243772f, -1.0813451f, 0.8161637f}, {0.7278682f, -1.4557365f, 0.7278682f, -1.0865565f, 0.8249164f}, {0.7311322f, -1.4622645f, 0.7311322f, -1.091429f, 0.8331f}, {0.734187f, -1.4683739f, 0.734187f, -1.0959891f, 0.8407588f}, {0.7370486f, -1.4740972f, 0.7370486f, -1.1002609f, 0.8479335f}, {0.7397319f, -1.4794639f, 0.7397319f, -1.1042666f, 0.8546612f}, {0.7422506f, -1.4845011f, 0.7422506f, -1.1080264f, 0.8609759f}, {0.7446169f, -1.4892337f, 0.7446169f, -1.1115588f, 0.8669087f}, {0.7468422f, -1.4936843f, 0.7468422f, -1.1148807f, 0.872488f}, {0.7489368f, -1.4978737f, 0.7489368f, -1.1180076f, 0.8777397f}, {0.7509104f, -1.5018208f, 0.7509104f, -1.1209537f, 0.8826878f}, {0.7527715f, -1.505543f, 0.7527715f, -1.123732f, 0.8873541f}, {0.7545699f, -1.5091397f, 0.7545699f, -1.1264165f, 0.8918629f}, {0.756366f, -1.5127321f, 0.756366f, -1.1290978f, 0.8963663f}, {0.7581551f, -1.5163101f, 0.7581551f, -1.1317685f, 0.9008518f}, {0.7599309f, -1.5198618f, 0.7599309f, -1.1344195f, 0.9053042f}, {0.7616873f, -1.5233747f, 0.7616873f, -1.1370414f, 0.9097079f}, {0.763418f, -1.5268359f, 0.763418f, -1.1396249f, 0.914047f}, {0.7651166f, -1.5302332f, 0.7651166f, -1.1421607f, 0.9183058f}, {0.7667774f, -1.5335549f, 0.7667774f, -1.1446399f, 0.9224699f}, {0.7683951f, -1.5367901f, 0.7683951f, -1.1470547f, 0.9265255f}, {0.7699647f, -1.5399294f, 0.7699647f, -1.1493978f, 0.9304609f}, {0.7714822f, -1.5429644f, 0.7714822f, -1.1516632f, 0.9342657f}, {0.7729443f, -1.5458886f, 0.7729443f, -1.1538458f, 0.9379315f}, {0.7743483f, -1.5486967f, 0.7743483f, -1.1559417f, 0.9414516f}, {0.7756924f, -1.5513848f, 0.7756924f, -1.1579481f, 0.9448215f}, {0.7769754f, -1.5539508f, 0.7769754f, -1.1598634f, 0.9480382f}, {0.7781968f, -1.5563935f, 0.7781968f, -1.1616866f, 0.9511005f}, {0.7793566f, -1.5587132f, 0.7793566f, -1.163418f, 0.9540085f}, {0.7804556f, -1.5609111f, 0.7804556f, -1.1650585f, 0.9567637f}, {0.7814947f, -1.5629894f, 0.7814947f, -1.1666097f, 0.959369f}},
-      {{0.365289f, -0.730578f, 0.365289f, -0.4897233f, -0.0285672f}, {0.3667508f, -0.7335015f, 0.3667508f, -0.491683f, -0.0246799f}, {0.3710705f, -0.742141f, 0.3710705f, -0.4974742f, -0.0131922f}, {0.3780587f, -0.7561175f, 0.3780587f, -0.506843f, 0.005392f}, {0.3874224f, -0.7748448f, 0.3874224f, -0.5193963f, 0.0302932f}, {0.3987939f, -0.7975878f, 0.3987939f, -0.5346415f, 0.0605341f}, {0.4117646f, -0.8235292f, 0.4117646f, -0.5520306f, 0.0950278f}, {0.4259167f, -0.8518334f, 0.4259167f, -0.5710035f, 0.1326633f}, {0.4408504f, -0.8817007f, 0.4408504f, -0.5910243f, 0.1723771f}, {0.4562035f, -0.912407f, 0.4562035f, -0.6116074f, 0.2132065f}, {0.4716639f, -0.9433277f, 0.4716639f, -0.6323343f, 0.2543212f}, {0.4869745f, -0.9739489f, 0.4869745f, -0.6528604f, 0.2950374f}, {0.501933f, -1.003866f, 0.501933f, -0.6729145f, 0.3348175f}, {0.5163882f, -1.0327764f, 0.5163882f, -0.6922938f, 0.3732589f}, {0.5302334f, -1.0604669f, 0.5302334f, -0.7108554f, 0.4100784f}, {0.5433998f, -1.0867997f, 0.5433998f, -0.7285069f, 0.4450925f}, {0.555849f, -1.1116981f, 0.555849f, -0.7451968f, 0.4781993f}, {0.5675666f, -1.1351331f, 0.5675666f, -0.7609059f, 0.5093604f}, {0.578556f, -1.1571121f, 0.578556f, -0.7756389f, 0.5385853f}, {0.5888343f, -1.1776685f, 0.5888343f, -0.7894183f, 0.5659187f}, {0.5984273f, -1.1968546f, 0.5984273f, -0.8022792f, 0.59143f}, {0.6073673f, -1.2147345f, 0.6073673f, -0.8142645f, 0.6152045f}, {0.6156898f, -1.2313796f, 0.6156898f, -0.8254221f, 0.6373371f}, {0.6234324f, -1.2468649f, 0.6234324f, -0.8358022f, 0.6579275f}, {0.6306331f, -1.2612661f, 0.6306331f, -0.8454557f, 0.6770765f}, {0.6373291f, -1.2746581f, 0.6373291f, -0.8544327f, 0.6948836f}, {0.6435566f, -1.2871133f, 0.6435566f, -0.8627817f, 0.7114449f}, {0.6493503f, -1.2987007f, 0.6493503f, -0.870549f, 0.7268524f}, {0.6547429f, -1.3094857f, 0.6547429f, -0.8777784f, 0.741193f}, {0.6597648f, -1.3195296f, 0.6597648f, -0.8845111f, 0.7545481f}, {0.6644447f, -1.3288895f, 0.6644447f, -0.8907852f, 0.7669937f}, {0.6688092f, -1.3376184f, 0.6688092f, -0.8966364f, 0.7786003f}, {0.6728826f, -1.3457653f, 0.6728826f, -0.9020974f, 0.7894331f}, {0.6766877f, -1.3533753f, 0.6766877f, -0.9071987f, 0.799552f}, {0.6802451f, -1.3604902f, 0.6802451f, -0.9119679f, 0.8090125f}, {0.683574f, -1.367148f, 0.683574f, -0.9164308f, 0.8178652f}, {0.6866919f, -1.3733838f, 0.6866919f, -0.9206108f, 0.8261568f}, {0.6896149f, -1.3792298f, 0.6896149f, -0.9245295f, 0.8339301f}, {0.6923577f, -1.3847154f, 0.6923577f, -0.9282066f, 0.8412241f}, {0.6949338f, -1.3898675f, 0.6949338f, -0.9316602f, 0.8480748f}, {0.6973555f, -1.394711f, 0.6973555f, -0.9349069f, 0.8545151f}, {0.6996343f, -1.3992685f, 0.6996343f, -0.9379619f, 0.8605751f}, {0.7017804f, -1.4035608f, 0.7017804f, -0.9408391f, 0.8662825f}, {0.7038035f, -1.407607f, 0.7038035f, -0.9435514f, 0.8716626f}, {0.7057123f, -1.4114246f, 0.7057123f, -0.9461104f, 0.8767387f}, {0.7075575f, -1.415115f, 0.7075575f, -0.9485842f, 0.8816458f}, {0.7094013f, -1.4188026f, 0.7094013f, -0.9510561f, 0.8865491f}, {0.7112386f, -1.4224772f, 0.7112386f, -0.9535192f, 0.8914352f}, {0.7130632f, -1.4261264f, 0.7130632f, -0.9559654f, 0.8962874f}, {0.7148686f, -1.4297372f, 0.7148686f, -0.9583858f, 0.9010887f}, {0.7166483f, -1.4332966f, 0.7166483f, -0.9607717f, 0.9058215f}, {0.7183959f, -1.4367917f, 0.7183959f, -0.9631146f, 0.9104689f}, {0.7201052f, -1.4402104f, 0.7201052f, -0.9654062f, 0.9150147f}, {0.7217708f, -1.4435416f, 0.7217708f, -0.9676392f, 0.919444f}, {0.7233876f, -1.4467752f, 0.7233876f, -0.9698067f, 0.9237436f}, {0.7249514f, -1.4499027f, 0.7249514f, -0.9719032f, 0.9279022f}, {0.7264585f, -1.4529171f, 0.7264585f, -0.9739238f, 0.9319104f}, {0.7279064f, -1.4558128f, 0.7279064f, -0.9758648f, 0.9357607f}, {0.7292929f, -1.4585858f, 0.7292929f, -0.9777237f, 0.939448f}, {0.7306168f, -1.4612337f, 0.7306168f, -0.9794986f, 0.9429687f}, {0.7318776f, -1.4637551f, 0.7318776f, -0.9811888f, 0.9463215f}, {0.7330752f, -1.4661503f, 0.7330752f, -0.9827943f, 0.9495063f}, {0.7342102f, -1.4684204f, 0.7342102f, -0.984316f, 0.9525248f}, {0.7352837f, -1.4705674f, 0.7352837f, -0.9857552f, 0.9553796f}},
-      {{0.3233935f, -0.646787f, 0.3233935f, -0.3663283f, -0.0727543f}, {0.3247434f, -0.6494869f, 0.3247434f, -0.3678574f, -0.0688837f}, {0.3287354f, -0.6574708f, 0.3287354f, -0.3723794f, -0.0574378f}, {0.335202f, -0.6704041f, 0.335202f, -0.3797046f, -0.0388964f}, {0.3438835f, -0.687767f, 0.3438835f, -0.3895386f, -0.0140046f}, {0.3544523f, -0.7089047f, 0.3544523f, -0.4015106f, 0.0162987f}, {0.3665422f, -0.7330843f, 0.3665422f, -0.4152055f, 0.0509632f}, {0.3797756f, -0.7595511f, 0.3797756f, -0.4301958f, 0.0889064f}, {0.393788f, -0.7875759f, 0.393788f, -0.4460685f, 0.1290833f}, {0.4082458f, -0.8164916f, 0.4082458f, -0.4624458f, 0.1705374f}, {0.4228581f, -0.8457162f, 0.4228581f, -0.4789981f, 0.2124343f}, {0.437382f, -0.8747639f, 0.437382f, -0.4954502f, 0.2540776f}, {0.4516232f, -0.9032464f, 0.4516232f, -0.5115821f, 0.2949106f}, {0.4654336f, -0.9308673f, 0.4654336f, -0.5272261f, 0.3345085f}, {0.4787063f, -0.9574126f, 0.4787063f, -0.5422609f, 0.3725642f}, {0.4913691f, -0.9827382f, 0.4913691f, -0.5566049f, 0.4088716f}, {0.5033791f, -1.0067581f, 0.5033791f, -0.5702093f, 0.4433069f}, {0.514716f, -1.0294321f, 0.514716f, -0.5830514f, 0.4758128f}, {0.5253778f, -1.0507555f, 0.5253778f, -0.5951286f, 0.5063824f}, {0.5353751f, -1.0707501f, 0.5353751f, -0.6064532f, 0.535047f}, {0.5447283f, -1.0894566f, 0.5447283f, -0.6170482f, 0.5618651f}, {0.5534644f, -1.1069287f, 0.5534644f, -0.6269441f, 0.5869134f}, {0.5616141f, -1.1232282f, 0.5616141f, -0.6361758f, 0.6102806f}, {0.5692107f, -1.1384214f, 0.5692107f, -0.644781f, 0.6320619f}, {0.5762884f, -1.1525768f, 0.5762884f, -0.6527983f, 0.6523552f}, {0.5828812f, -1.1657623f, 0.5828812f, -0.6602663f, 0.6712583f}, {0.5890224f, -1.1780447f, 0.5890224f, -0.6672229f, 0.6888666f}, {0.5947441f, -1.1894881f, 0.5947441f, -0.6737042f, 0.705272f}, {0.6000768f, -1.2001536f, 0.6000768f, -0.6797449f, 0.7205623f}, {0.6050494f, -1.2100988f, 0.6050494f, -0.6853777f, 0.7348199f}, {0.6096888f, -1.2193776f, 0.6096888f, -0.6906331f, 0.7481222f}, {0.6140203f, -1.2280405f, 0.6140203f, -0.6955396f, 0.7605415f}, {0.6180671f, -1.2361341f, 0.6180671f, -0.7001236f, 0.7721446f}, {0.6218508f, -1.2437017f, 0.6218508f, -0.7044098f, 0.7829936f}, {0.6253916f, -1.2507832f, 0.6253916f, -0.7084206f, 0.7931457f}, {0.6287077f, -1.2574153f, 0.6287077f, -0.7121769f, 0.8026537f}, {0.631816f, -1.263632f, 0.631816f, -0.7156979f, 0.811566f}, {0.6347322f, -1.2694643f, 0.6347322f, -0.7190012f, 0.8199274f}, {0.6374704f, -1.2749409f, 0.6374704f, -0.7221031f, 0.8277787f}, {0.640044f, -1.2800879f, 0.640044f, -0.7250183f, 0.8351576f}, {0.6424648f, -1.2849296f, 0.6424648f, -0.7277605f, 0.8420986f}, {0.644744f, -1.289488f, 0.644744f, -0.7303423f, 0.8486336f}, {0.6468917f, -1.2937834f, 0.6468917f, -0.7327751f, 0.8547917f}, {0.6489173f, -1.2978346f, 0.6489173f, -0.7350697f, 0.8605996f}, {0.6508294f, -1.3016588f, 0.6508294f, -0.7372356f, 0.866082f}, {0.6526786f, -1.3053573f, 0.6526786f, -0.7393304f, 0.8713842f}, {0.6545273f, -1.3090547f, 0.6545273f, -0.7414245f, 0.8766848f}, {0.6563703f, -1.3127406f, 0.6563703f, -0.7435122f, 0.8819691f}, {0.6582014f, -1.3164028f, 0.6582014f, -0.7455863f, 0.8872192f}, {0.660014f, -1.320028f, 0.660014f, -0.7476396f, 0.8924165f}, {0.6618016f, -1.3236032f, 0.6618016f, -0.7496645f, 0.8975419f}, {0.6635577f, -1.3271153f, 0.6635577f, -0.7516537f, 0.9025769f}, {0.6652761f, -1.3305521f, 0.6652761f, -0.7536003f, 0.907504f}, {0.6669512f, -1.3339023f, 0.6669512f, -0.7554977f, 0.9123069f}, {0.6685778f, -1.3371557f, 0.6685778f, -0.7573404f, 0.916971f}, {0.6701518f, -1.3403036f, 0.6701518f, -0.7591233f, 0.9214838f}, {0.6716694f, -1.3433387f, 0.6716694f, -0.7608423f, 0.9258351f}, {0.6731277f, -1.3462554f, 0.6731277f, -0.7624943f, 0.9300165f}, {0.6745248f, -1.3490495f, 0.6745248f, -0.7640769f, 0.9340222f}, {0.6758592f, -1.3517184f, 0.6758592f, -0.7655885f, 0.9378484f}, {0.6771304f, -1.3542607f, 0.6771304f, -0.7670284f, 0.9414931f}, {0.6783382f, -1.3566764f, 0.6783382f, -0.7683966f, 0.9449563f}, {0.6794833f, -1.3589666f, 0.6794833f, -0.7696937f, 0.9482395f}, {0.6805666f, -1.3611333f, 0.6805666f, -0.7709208f, 0.9513457f}},
-      {{0.2811637f, -0.5623275f, 0.2811637f, -0.2365396f, -0.1118846f}, {0.2823804f, -0.5647608f, 0.2823804f, -0.2375631f, -0.1080415f}, {0.2859804f, -0.5719608f, 0.2859804f, -0.2405918f, -0.0966701f}, {0.291819f, -0.583638f, 0.291819f, -0.2455037f, -0.0782278f}, {0.2996707f, -0.5993413f, 0.2996707f, -0.2521092f, -0.0534265f}, {0.3092502f, -0.6185004f, 0.3092502f, -0.2601683f, -0.0231676f}, {0.3202365f, -0.640473f, 0.3202365f, -0.269411f, 0.0115349f}, {0.3322965f, -0.664593f, 0.3322965f, -0.2795569f, 0.0496291f}, {0.345106f, -0.690212f, 0.345106f, -0.2903334f, 0.0900906f}, {0.3583656f, -0.7167312f, 0.3583656f, -0.3014885f, 0.1319739f}, {0.3718113f, -0.7436226f, 0.3718113f, -0.3128002f, 0.1744449f}, {0.38522f, -0.7704401f, 0.38522f, -0.3240808f, 0.2167993f}, {0.3984112f, -0.7968223f, 0.3984112f, -0.3351784f, 0.2584663f}, {0.4112444f, -0.8224889f, 0.4112444f, -0.3459748f, 0.2990029f}, {0.4236163f, -0.8472326f, 0.4236163f, -0.3563831f, 0.338082f}, {0.4354549f, -0.8709098f, 0.4354549f, -0.3663428f, 0.3754768f}, {0.446715f, -0.89343f, 0.446715f, -0.3758158f, 0.4110443f}, {0.4573728f, -0.9147456f, 0.4573728f, -0.3847821f, 0.4447092f}, {0.4674212f, -0.9348425f, 0.4674212f, -0.3932357f, 0.4764492f}, {0.476866f, -0.9537319f, 0.476866f, -0.4011814f, 0.5062824f}, {0.485722f, -0.971444f, 0.485722f, -0.4086319f, 0.5342562f}, {0.494011f, -0.988022f, 0.494011f, -0.4156053f, 0.5604386f}, {0.5017588f, -1.0035176f, 0.5017588f, -0.4221234f, 0.5849117f}, {0.508994f, -1.0179879f, 0.508994f, -0.4282103f, 0.6077656f}, {0.5157464f, -1.0314927f, 0.5157464f, -0.433891f, 0.6290944f}, {0.5220461f, -1.0440922f, 0.5220461f, -0.4391909f, 0.6489936f}, {0.5279231f, -1.0558462f, 0.5279231f, -0.4441351f, 0.6675572f}, {0.5334061f, -1.0668123f, 0.5334061f, -0.448748f, 0.6848766f}, {0.5385231f, -1.0770461f, 0.5385231f, -0.4530528f, 0.7010394f}, {0.5433001f, -1.0866002f, 0.5433001f, -0.4570716f, 0.7161288f}, {0.5477621f, -1.0955242f, 0.5477621f, -0.4608255f, 0.7302229f}, {0.5519322f, -1.1038645f, 0.5519322f, -0.4643337f, 0.7433952f}, {0.5558321f, -1.1116643f, 0.5558321f, -0.4676147f, 0.7557139f}, {0.5594819f, -1.1189638f, 0.5594819f, -0.4706852f, 0.7672425f}, {0.5629002f, -1.1258003f, 0.5629002f, -0.4735609f, 0.7780397f}, {0.5661041f, -1.1322082f, 0.5661041f, -0.4762563f, 0.78816f}, {0.5691096f, -1.1382191f, 0.5691096f, -0.4787848f, 0.7976534f}, {0.5719312f, -1.1438624f, 0.5719312f, -0.4811586f, 0.8065662f}, {0.5745825f, -1.1491649f, 0.5745825f, -0.4833891f, 0.8149408f}, {0.5770758f, -1.1541516f, 0.5770758f, -0.4854867f, 0.8228164f}, {0.5794225f, -1.158845f, 0.5794225f, -0.487461f, 0.8302291f}, {0.5816332f, -1.1632663f, 0.5816332f, -0.4893208f, 0.8372119f}, {0.5837174f, -1.1674348f, 0.5837174f, -0.4910742f, 0.8437954f}, {0.5856841f, -1.1713681f, 0.5856841f, -0.4927287f, 0.8500075f}, {0.5875414f, -1.1750827f, 0.5875414f, -0.4942913f, 0.8558742f}, {0.5893384f, -1.1786769f, 0.5893384f, -0.4958031f, 0.8615506f}, {0.5911357f, -1.1822715f, 0.5911357f, -0.4973152f, 0.8672277f}, {0.5929283f, -1.1858565f, 0.5929283f, -0.4988232f, 0.8728898f}, {0.59471f, -1.1894199f, 0.59471f, -0.5003221f, 0.8785177f}, {0.5964745f, -1.1929489f, 0.5964745f, -0.5018066f, 0.8840913f}, {0.5982153f, -1.1964307f, 0.5982153f, -0.5032711f, 0.8895902f}, {0.5999262f, -1.1998525f, 0.5999262f, -0.5047105f, 0.8949944f}, {0.6016011f, -1.2032022f, 0.6016011f, -0.5061195f, 0.9002849f}, {0.6032344f, -1.2064688f, 0.6032344f, -0.5074936f, 0.905444f}, {0.6048211f, -1.2096423f, 0.6048211f, -0.5088285f, 0.910456f}, {0.606357f, -1.212714f, 0.606357f, -0.5101206f, 0.9153074f}, {0.6078384f, -1.2156768f, 0.6078384f, -0.5113669f, 0.9199866f}, {0.6092625f, -1.2185249f, 0.6092625f, -0.5125649f, 0.9244849f}, {0.6106271f, -1.2212543f, 0.6106271f, -0.513713f, 0.9287955f}, {0.6119311f, -1.2238621f, 0.6119311f, -0.51481f, 0.9329143f}, {0.6131735f, -1.2263471f, 0.6131735f, -0.5158553f, 0.9368389f}, {0.6143545f, -1.228709f, 0.6143545f, -0.5168488f, 0.9405692f}, {0.6154744f, -1.2309487f, 0.6154744f, -0.517791f, 0.9441065f}, {0.6165341f, -1.2330683f, 0.6165341f, -0.5186825f, 0.947454f}},
-      {{0.2389473f, -0.4778947f, 0.2389473f, -0.0999317f, -0.1441424f}, {0.2400114f, -0.4800229f, 0.2400114f, -0.1003768f, -0.140331f}, {0.2431616f, -0.4863233f, 0.2431616f, -0.1016942f, -0.1290477f}, {0.2482757f, -0.4965513f, 0.2482757f, -0.103833f, -0.1107304f}, {0.2551627f, -0.5103255f, 0.2551627f, -0.1067133f, -0.0860624f}, {0.2635805f, -0.527161f, 0.2635805f, -0.1102338f, -0.0559117f}, {0.273255f, -0.54651f, 0.273255f, -0.1142798f, -0.0212597f}, {0.2839005f, -0.5678009f, 0.2839005f, -0.1187319f, 0.0168699f}, {0.2952367f, -0.5904733f, 0.2952367f, -0.1234729f, 0.0574738f}, {0.307003f, -0.614006f, 0.307003f, -0.1283938f, 0.0996183f}, {0.3189677f, -0.6379354f, 0.3189677f, -0.1333976f, 0.1424732f}, {0.3309329f, -0.6618659f, 0.3309329f, -0.1384017f, 0.1853301f}, {0.3427367f, -0.6854733f, 0.3427367f, -0.1433382f, 0.2276085f}, {0.3542514f, -0.7085029f, 0.3542514f, -0.1481538f, 0.2688519f}, {0.3653815f, -0.730763f, 0.3653815f, -0.1528086f, 0.3087174f}, {0.3760589f, -0.7521178f, 0.3760589f, -0.1572741f, 0.3469615f}, {0.3862392f, -0.7724783f, 0.3862392f, -0.1615316f, 0.383425f}, {0.3958971f, -0.7917941f, 0.3958971f, -0.1655707f, 0.4180175f}, {0.4050226f, -0.8100452f, 0.4050226f, -0.1693872f, 0.4507031f}, {0.4136175f, -0.8272349f, 0.4136175f, -0.1729817f, 0.4814882f}, {0.4216922f, -0.8433844f, 0.4216922f, -0.1763587f, 0.5104101f}, {0.4292636f, -0.8585271f, 0.4292636f, -0.1795252f, 0.5375291f}, {0.4363526f, -0.8727052f, 0.4363526f, -0.1824899f, 0.5629204f}, {0.442983f, -0.8859661f, 0.442983f, -0.1852629f, 0.5866693f}, {0.4491802f, -0.8983604f, 0.4491802f, -0.1878546f, 0.6088662f}, {0.45497f, -0.9099399f, 0.45497f, -0.190276f, 0.6296039f}, {0.4603781f, -0.9207562f, 0.4603781f, -0.1925378f, 0.6489746f}, {0.4654298f, -0.9308597f, 0.4654298f, -0.1946505f, 0.6670689f}, {0.4701495f, -0.9402991f, 0.4701495f, -0.1966244f, 0.6839738f}, {0.4745604f, -0.9491207f, 0.4745604f, -0.198469f, 0.6997724f}, {0.4786843f, -0.9573687f, 0.4786843f, -0.2001938f, 0.7145436f}, {0.4825421f, -0.9650842f, 0.4825421f, -0.2018071f, 0.7283612f}, {0.4861529f, -0.9723059f, 0.4861529f, -0.2033172f, 0.7412945f}, {0.4895349f, -0.9790698f, 0.4895349f, -0.2047316f, 0.753408f}, {0.4927047f, -0.9854095f, 0.4927047f, -0.2060573f, 0.7647617f}, {0.4956779f, -0.9913558f, 0.4956779f, -0.2073007f, 0.7754109f}, {0.4984687f, -0.9969375f, 0.4984687f, -0.2084679f, 0.7854071f}, {0.5010905f, -1.002181f, 0.5010905f, -0.2095644f, 0.7947977f}, {0.5035554f, -1.0071108f, 0.5035554f, -0.2105952f, 0.8036264f}, {0.5058747f, -1.0117494f, 0.5058747f, -0.2115652f, 0.8119336f}, {0.5080588f, -1.0161176f, 0.5080588f, -0.2124786f, 0.8197566f}, {0.5101172f, -1.0202345f, 0.5101172f, -0.2133395f, 0.8271295f}, {0.5120588f, -1.0241177f, 0.5120588f, -0.2141515f, 0.8340839f}, {0.5138917f, -1.0277835f, 0.5138917f, -0.2149181f, 0.8406489f}, {0.5156234f, -1.0312468f, 0.5156234f, -0.2156423f, 0.8468513f}, {0.5172995f, -1.0345991f, 0.5172995f, -0.2163433f, 0.8528549f}, {0.5189765f, -1.0379531f, 0.5189765f, -0.2170446f, 0.8588615f}, {0.5206497f, -1.0412995f, 0.5206497f, -0.2177444f, 0.8648546f}, {0.5223135f, -1.0446269f, 0.5223135f, -0.2184402f, 0.8708137f}, {0.5239618f, -1.0479235f, 0.5239618f, -0.2191295f, 0.8767176f}, {0.5255886f, -1.0511772f, 0.5255886f, -0.2198099f, 0.8825445f}, {0.527188f, -1.054376f, 0.527188f, -0.2204788f, 0.8882731f}, {0.5287543f, -1.0575086f, 0.5287543f, -0.2211338f, 0.8938833f}, {0.5302822f, -1.0605645f, 0.5302822f, -0.2217728f, 0.8993561f}, {0.5317671f, -1.0635343f, 0.5317671f, -0.2223939f, 0.9046747f}, {0.5332049f, -1.0664098f, 0.5332049f, -0.2229952f, 0.9098244f}, {0.5345921f, -1.0691842f, 0.5345921f, -0.2235753f, 0.9147932f}, {0.5359261f, -1.0718522f, 0.5359261f, -0.2241332f, 0.9195711f}, {0.5372048f, -1.0744096f, 0.5372048f, -0.224668f, 0.9241512f}, {0.5384269f, -1.0768539f, 0.5384269f, -0.2251791f, 0.9285287f}, {0.5395918f, -1.0791836f, 0.5395918f, -0.2256663f, 0.9327009f}, {0.5406992f, -1.0813985f, 0.5406992f, -0.2261294f, 0.9366676f}, {0.5417497f, -1.0834994f, 0.5417497f, -0.2265687f, 0.94043f}, {0.542744f, -1.085488f, 0.542744f, -0.2269846f, 0.9439914f}},
-      {{0.1971297f, -0.3942594f, 0.1971297f, 0.0444794f, -0.1670018f}, {0.1980252f, -0.3960504f, 0.1980252f, 0.0446815f, -0.1632178f}, {0.2006772f, -0.4013543f, 0.2006772f, 0.0452799f, -0.1520115f}, {0.2049854f, -0.4099707f, 0.2049854f, 0.046252f, -0.1338065f}, {0.2107931f, -0.4215861f, 0.2107931f, 0.0475624f, -0.1092653f}, {0.2179007f, -0.4358013f, 0.2179007f, 0.0491661f, -0.0792312f}, {0.2260818f, -0.4521636f, 0.2260818f, 0.0510121f, -0.0446607f}, {0.2350993f, -0.4701987f, 0.2350993f, 0.0530467f, -0.0065559f}, {0.2447198f, -0.4894395f, 0.2447198f, 0.0552175f, 0.0340965f}, {0.2547246f, -0.5094492f, 0.2547246f, 0.0574749f, 0.0763733f}, {0.2649184f, -0.5298368f, 0.2649184f, 0.059775f, 0.1194486f}, {0.2751332f, -0.5502665f, 0.2751332f, 0.0620798f, 0.1626128f}, {0.2852304f, -0.5704608f, 0.2852304f, 0.0643581f, 0.2052797f}, {0.2950998f, -0.5901996f, 0.2950998f, 0.066585f, 0.2469841f}, {0.3046577f, -0.6093153f, 0.3046577f, 0.0687416f, 0.2873722f}, {0.3138437f, -0.6276875f, 0.3138437f, 0.0708143f, 0.3261892f}, {0.3226176f, -0.6452352f, 0.3226176f, 0.072794f, 0.3632643f}, {0.3309552f, -0.6619104f, 0.3309552f, 0.0746752f, 0.3984961f}, {0.3388458f, -0.6776916f, 0.3388458f, 0.0764556f, 0.4318388f}, {0.3462887f, -0.6925775f, 0.3462887f, 0.078135f, 0.4632899f}, {0.3532911f, -0.7065822f, 0.3532911f, 0.079715f, 0.4928795f}, {0.3598657f, -0.7197314f, 0.3598657f, 0.0811985f, 0.5206613f}, {0.3660291f, -0.7320583f, 0.3660291f, 0.0825892f, 0.5467057f}, {0.3718006f, -0.7436012f, 0.3718006f, 0.0838914f, 0.5710938f}, {0.3772008f, -0.7544016f, 0.3772008f, 0.0851099f, 0.5939131f}, {0.3822511f, -0.7645023f, 0.3822511f, 0.0862494f, 0.615254f}, {0.3869731f, -0.7739462f, 0.3869731f, 0.0873149f, 0.6352073f}, {0.3913878f, -0.7827756f, 0.3913878f, 0.088311f, 0.6538622f}, {0.3955158f, -0.7910315f, 0.3955158f, 0.0892424f, 0.6713055f}, {0.3993766f, -0.7987532f, 0.3993766f, 0.0901135f, 0.68762f}, {0.402989f, -0.8059779f, 0.402989f, 0.0909286f, 0.7028845f}, {0.4063705f, -0.8127409f, 0.4063705f, 0.0916916f, 0.7171734f}, {0.4095375f, -0.8190751f, 0.4095375f, 0.0924062f, 0.7305563f}, {0.4125056f, -0.8250113f, 0.4125056f, 0.0930759f, 0.7430985f}, {0.4152891f, -0.8305782f, 0.4152891f, 0.0937039f, 0.7548604f}, {0.4179013f, -0.8358025f, 0.4179013f, 0.0942933f, 0.7658984f}, {0.4203544f, -0.8407089f, 0.4203544f, 0.0948469f, 0.7762646f}, {0.4226601f, -0.8453201f, 0.4226601f, 0.0953671f, 0.7860073f}, {0.4248287f, -0.8496573f, 0.4248287f, 0.0958564f, 0.7951711f}, {0.42687f, -0.85374f, 0.42687f, 0.096317f, 0.8037971f}, {0.4287931f, -0.8575862f, 0.4287931f, 0.0967509f, 0.8119234f}, {0.4306062f, -0.8612124f, 0.4306062f, 0.09716f, 0.8195849f}, {0.432317f, -0.864634f, 0.432317f, 0.097546f, 0.826814f}, {0.4339325f, -0.867865f, 0.4339325f, 0.0979106f, 0.8336406f}, {0.4354593f, -0.8709185f, 0.4354593f, 0.0982551f, 0.8400921f}, {0.4369375f, -0.873875f, 0.4369375f, 0.0985886f, 0.8463386f}, {0.4384169f, -0.8768339f, 0.4384169f, 0.0989224f, 0.8525901f}, {0.4398934f, -0.8797869f, 0.4398934f, 0.0992556f, 0.8588293f}, {0.441362f, -0.882724f, 0.441362f, 0.0995869f, 0.8650348f}, {0.4428173f, -0.8856347f, 0.4428173f, 0.0999153f, 0.8711846f}, {0.4442541f, -0.8885082f, 0.4442541f, 0.1002395f, 0.8772559f}, {0.4456671f, -0.8913341f, 0.4456671f, 0.1005583f, 0.8832265f}, {0.4470511f, -0.8941023f, 0.4470511f, 0.1008706f, 0.8890752f}, {0.4484017f, -0.8968034f, 0.4484017f, 0.1011753f, 0.8947822f}, {0.4497146f, -0.8994291f, 0.4497146f, 0.1014716f, 0.9003298f}, {0.4509861f, -0.9019721f, 0.4509861f, 0.1017584f, 0.9057027f}, {0.4522131f, -0.9044263f, 0.4522131f, 0.1020353f, 0.9108879f}, {0.4533934f, -0.9067868f, 0.4533934f, 0.1023016f, 0.9158753f}, {0.454525f, -0.9090501f, 0.454525f, 0.102557f, 0.9206571f}, {0.4556068f, -0.9112136f, 0.4556068f, 0.1028011f, 0.9252284f}, {0.4566381f, -0.9132762f, 0.4566381f, 0.1030338f, 0.9295862f}, {0.4576188f, -0.9152376f, 0.4576188f, 0.103255f, 0.9337302f}, {0.4585491f, -0.9170983f, 0.4585491f, 0.1034649f, 0.9376615f}, {0.4594299f, -0.9188598f, 0.4594299f, 0.1036637f, 0.9413834f}},
-      {{0.1561465f, -0.3122929f, 0.1561465f, 0.1988073f, -0.1766068f}, {0.1568617f, -0.3137233f, 0.1568617f, 0.1997179f, -0.1728354f}, {0.15898f, -0.31796f, 0.15898f, 0.202415f, -0.1616651f}, {0.1624222f, -0.3248445f, 0.1624222f, 0.2067977f, -0.1435133f}, {0.1670645f, -0.3341291f, 0.1670645f, 0.2127083f, -0.1190335f}, {0.172749f, -0.345498f, 0.172749f, 0.2199458f, -0.0890582f}, {0.1792962f, -0.3585924f, 0.1792962f, 0.2282818f, -0.0545334f}, {0.1865179f, -0.3730359f, 0.1865179f, 0.2374766f, -0.0164517f}, {0.1942285f, -0.388457f, 0.1942285f, 0.2472938f, 0.0242078f}, {0.2022538f, -0.4045075f, 0.2022538f, 0.2575116f, 0.0665267f}, {0.2104375f, -0.420875f, 0.2104375f, 0.2679313f, 0.1096814f}, {0.2186452f, -0.4372904f, 0.2186452f, 0.2783813f, 0.1529621f}, {0.2267652f, -0.4535304f, 0.2267652f, 0.2887198f, 0.1957806f}, {0.2347087f, -0.4694173f, 0.2347087f, 0.2988335f, 0.2376682f}, {0.2424077f, -0.4848154f, 0.2424077f, 0.308636f, 0.2782668f}, {0.249813f, -0.4996261f, 0.249813f, 0.3180646f, 0.3173167f}, {0.2568914f, -0.5137828f, 0.2568914f, 0.3270768f, 0.3546424f}, {0.2636227f, -0.5272453f, 0.2636227f, 0.3356472f, 0.3901379f}, {0.2699974f, -0.5399947f, 0.2699974f, 0.3437635f, 0.423753f}, {0.2760143f, -0.5520286f, 0.2760143f, 0.3514243f, 0.4554815f}, {0.2816785f, -0.563357f, 0.2816785f, 0.3586361f, 0.4853502f}, {0.2869997f, -0.5739995f, 0.2869997f, 0.3654111f, 0.51341f}, {0.2919908f, -0.5839817f, 0.2919908f, 0.3717658f, 0.5397292f}, {0.2966669f, -0.5933338f, 0.2966669f, 0.3777194f, 0.5643869f}, {0.3010442f, -0.6020884f, 0.3010442f, 0.3832926f, 0.5874693f}, {0.3051397f, -0.6102794f, 0.3051397f, 0.3885071f, 0.6090658f}, {0.3089705f, -0.6179409f, 0.3089705f, 0.3933845f, 0.6292663f}, {0.3125534f, -0.6251067f, 0.3125534f, 0.3979462f, 0.6481597f}, {0.3159047f, -0.6318095f, 0.3159047f, 0.4022133f, 0.6658323f}, {0.3190403f, -0.6380806f, 0.3190403f, 0.4062055f, 0.6823668f}, {0.321975f, -0.64395f, 0.321975f, 0.409942f, 0.6978421f}, {0.324723f, -0.6494459f, 0.324723f, 0.4134407f, 0.7123325f}, {0.3272974f, -0.6545947f, 0.3272974f, 0.4167185f, 0.7259079f}, {0.3297107f, -0.6594213f, 0.3297107f, 0.4197911f, 0.7386338f}, {0.3319744f, -0.6639488f, 0.3319744f, 0.4226733f, 0.7505708f}, {0.3340993f, -0.6681985f, 0.3340993f, 0.4253787f, 0.7617758f}, {0.3360952f, -0.6721905f, 0.3360952f, 0.42792f, 0.772301f}, {0.3379716f, -0.6759431f, 0.3379716f, 0.4303089f, 0.7821951f}, {0.3397367f, -0.6794734f, 0.3397367f, 0.4325563f, 0.7915031f}, {0.3413985f, -0.6827971f, 0.3413985f, 0.4346722f, 0.8002664f}, {0.3429644f, -0.6859288f, 0.3429644f, 0.4366659f, 0.8085234f}, {0.3444409f, -0.6888818f, 0.3444409f, 0.4385458f, 0.8163094f}, {0.3458343f, -0.6916686f, 0.3458343f, 0.4403199f, 0.8236571f}, {0.3471503f, -0.6943006f, 0.3471503f, 0.4419954f, 0.8305965f}, {0.3483941f, -0.6967882f, 0.3483941f, 0.4435791f, 0.8371556f}, {0.3495986f, -0.6991972f, 0.3495986f, 0.4451126f, 0.843507f}, {0.3508042f, -0.7016084f, 0.3508042f, 0.4466476f, 0.8498644f}, {0.3520076f, -0.7040151f, 0.3520076f, 0.4481797f, 0.8562099f}, {0.3532046f, -0.7064092f, 0.3532046f, 0.4497038f, 0.8625221f}, {0.354391f, -0.708782f, 0.354391f, 0.4512144f, 0.8687783f}, {0.3555624f, -0.7111248f, 0.3555624f, 0.4527058f, 0.8749555f}, {0.3567145f, -0.7134291f, 0.3567145f, 0.4541727f, 0.8810309f}, {0.3578433f, -0.7156865f, 0.3578433f, 0.4556098f, 0.8869829f}, {0.3589448f, -0.7178896f, 0.3589448f, 0.4570123f, 0.8927915f}, {0.3600157f, -0.7200313f, 0.3600157f, 0.4583757f, 0.8984384f}, {0.3610529f, -0.7221058f, 0.3610529f, 0.4596964f, 0.9039081f}, {0.3620541f, -0.7241081f, 0.3620541f, 0.4609711f, 0.9091873f}, {0.3630171f, -0.7260342f, 0.3630171f, 0.4621972f, 0.9142656f}, {0.3639405f, -0.7278811f, 0.3639405f, 0.4633729f, 0.9191351f}, {0.3648234f, -0.7296468f, 0.3648234f, 0.464497f, 0.9237905f}, {0.3656651f, -0.7313302f, 0.3656651f, 0.4655687f, 0.9282291f}, {0.3664656f, -0.7329311f, 0.3664656f, 0.4665878f, 0.9324501f}, {0.367225f, -0.7344501f, 0.367225f, 0.4675548f, 0.9364549f}, {0.3679441f, -0.7358881f, 0.3679441f, 0.4684703f, 0.9402466f}},
-      {{0.1165141f, -0.2330282f, 0.1165141f, 0.3675565f, -0.166387f}, {0.1170431f, -0.2340863f, 0.1170431f, 0.3692253f, -0.1626022f}, {0.1186097f, -0.2372195f, 0.1186097f, 0.3741673f, -0.1513937f}, {0.1211547f, -0.2423094f, 0.1211547f, 0.3821957f, -0.1331855f}, {0.1245854f, -0.2491707f, 0.1245854f, 0.3930181f, -0.1086405f}, {0.1287837f, -0.2575675f, 0.1287837f, 0.4062623f, -0.0786028f}, {0.133616f, -0.267232f, 0.133616f, 0.4215063f, -0.0440296f}, {0.1389421f, -0.2778842f, 0.1389421f, 0.438308f, -0.0059236f}, {0.144624f, -0.289248f, 0.144624f, 0.4562321f, 0.0347281f}, {0.1505326f, -0.3010652f, 0.1505326f, 0.4748715f, 0.0770019f}, {0.1565525f, -0.313105f, 0.1565525f, 0.4938619f, 0.1200718f}, {0.1625845f, -0.3251689f, 0.1625845f, 0.5128904f, 0.1632283f}, {0.1685466f, -0.3370933f, 0.1685466f, 0.5316987f, 0.2058853f}, {0.174374f, -0.348748f, 0.174374f, 0.5500818f, 0.2475777f}, {0.1800171f, -0.3600343f, 0.1800171f, 0.5678837f, 0.2879522f}, {0.1854405f, -0.370881f, 0.1854405f, 0.5849922f, 0.3267541f}, {0.1906202f, -0.3812404f, 0.1906202f, 0.6013322f, 0.363813f}, {0.1955422f, -0.3910844f, 0.1955422f, 0.6168591f, 0.3990278f}, {0.2002001f, -0.4004001f, 0.2002001f, 0.6315529f, 0.4323531f}, {0.2045935f, -0.409187f, 0.2045935f, 0.6454124f, 0.4637864f}, {0.2087267f, -0.4174534f, 0.2087267f, 0.6584512f, 0.4933581f}, {0.2126073f, -0.4252146f, 0.2126073f, 0.6706929f, 0.5211221f}, {0.2162451f, -0.4324901f, 0.2162451f, 0.6821686f, 0.5471489f}, {0.2196514f, -0.4393028f, 0.2196514f, 0.6929142f, 0.5715198f}, {0.2228385f, -0.445677f, 0.2228385f, 0.7029683f, 0.5943223f}, {0.225819f, -0.4516381f, 0.225819f, 0.7123707f, 0.6156468f}, {0.2286057f, -0.4572114f, 0.2286057f, 0.7211615f, 0.6355843f}, {0.231211f, -0.4624219f, 0.231211f, 0.7293802f, 0.654224f}, {0.233647f, -0.4672939f, 0.233647f, 0.7370648f, 0.6716527f}, {0.2359253f, -0.4718506f, 0.2359253f, 0.744252f, 0.6879532f}, {0.2380569f, -0.4761139f, 0.2380569f, 0.7509765f, 0.7032043f}, {0.2400523f, -0.4801046f, 0.2400523f, 0.7572711f, 0.7174803f}, {0.2419211f, -0.4838423f, 0.2419211f, 0.7631665f, 0.730851f}, {0.2436725f, -0.487345f, 0.2436725f, 0.7686915f, 0.7433815f}, {0.2453149f, -0.4906298f, 0.2453149f, 0.7738726f, 0.7551323f}, {0.2468562f, -0.4937124f, 0.2468562f, 0.7787348f, 0.7661597f}, {0.2483037f, -0.4966074f, 0.2483037f, 0.783301f, 0.7765158f}, {0.2496641f, -0.4993282f, 0.2496641f, 0.7875925f, 0.7862489f}, {0.2509436f, -0.5018872f, 0.2509436f, 0.791629f, 0.7954035f}, {0.2521481f, -0.5042961f, 0.2521481f, 0.7954285f, 0.8040208f}, {0.2532827f, -0.5065654f, 0.2532827f, 0.7990079f, 0.8121387f}, {0.2543525f, -0.5087049f, 0.2543525f, 0.8023825f, 0.8197924f}, {0.2553618f, -0.5107237f, 0.2553618f, 0.8055667f, 0.827014f}, {0.256315f, -0.51263f, 0.256315f, 0.8085735f, 0.8338334f}, {0.2572157f, -0.5144315f, 0.2572157f, 0.8114151f, 0.8402781f}, {0.2580879f, -0.5161758f, 0.2580879f, 0.8141663f, 0.8465179f}, {0.2589607f, -0.5179215f, 0.2589607f, 0.8169198f, 0.8527627f}, {0.2598318f, -0.5196637f, 0.2598318f, 0.8196678f, 0.8589951f}, {0.2606982f, -0.5213965f, 0.2606982f, 0.822401f, 0.8651939f}, {0.2615568f, -0.5231137f, 0.2615568f, 0.8251095f, 0.8713369f}, {0.2624045f, -0.524809f, 0.2624045f, 0.8277835f, 0.8774015f}, {0.2632381f, -0.5264762f, 0.2632381f, 0.8304132f, 0.8833655f}, {0.2640546f, -0.5281093f, 0.2640546f, 0.8329891f, 0.8892076f}, {0.2648514f, -0.5297028f, 0.2648514f, 0.8355026f, 0.8949082f}, {0.2656259f, -0.5312518f, 0.2656259f, 0.8379458f, 0.9004495f}, {0.266376f, -0.532752f, 0.266376f, 0.8403121f, 0.9058162f}, {0.2670999f, -0.5341999f, 0.2670999f, 0.8425958f, 0.9109955f}, {0.2677962f, -0.5355924f, 0.2677962f, 0.8447923f, 0.9159771f}, {0.2684638f, -0.5369276f, 0.2684638f, 0.8468983f, 0.9207534f}, {0.269102f, -0.5382039f, 0.269102f, 0.8489114f, 0.9253193f}, {0.2697104f, -0.5394207f, 0.2697104f, 0.8508307f, 0.9296721f}, {0.2702889f, -0.5405777f, 0.2702889f, 0.8526557f, 0.9338112f}, {0.2708377f, -0.5416754f, 0.2708377f, 0.854387f, 0.9377379f}, {0.2713573f, -0.5427146f, 0.2713573f, 0.8560261f, 0.9414553f}},
-      {{0.0789057f, -0.1578114f, 0.0789057f, 0.5608002f, -0.1235769f}, {0.0792508f, -0.1585015f, 0.0792508f, 0.5632525f, -0.1197444f}, {0.0802719f, -0.1605438f, 0.0802719f, 0.5705101f, -0.1084022f}, {0.0819286f, -0.1638573f, 0.0819286f, 0.5822849f, -0.0900006f}, {0.0841577f, -0.1683155f, 0.0841577f, 0.5981275f, -0.0652415f}, {0.0868791f, -0.1737583f, 0.0868791f, 0.6174692f, -0.0350142f}, {0.0900026f, -0.1800052f, 0.0900026f, 0.6396682f, -0.0003214f}, {0.0934343f, -0.1868686f, 0.0934343f, 0.6640579f, 0.037795f}, {0.0970826f, -0.1941653f, 0.0970826f, 0.6899875f, 0.078318f}, {0.1008629f, -0.2017257f, 0.1008629f, 0.7168544f, 0.1203059f}, {0.1047f, -0.2094f, 0.1047f, 0.7441257f, 0.1629256f}, {0.1085304f, -0.2170608f, 0.1085304f, 0.7713495f, 0.2054712f}, {0.1123025f, -0.2246049f, 0.1123025f, 0.7981582f, 0.2473681f}, {0.1159758f, -0.2319515f, 0.1159758f, 0.8242652f, 0.2881682f}, {0.1195203f, -0.2390407f, 0.1195203f, 0.8494573f, 0.3275386f}, {0.1229152f, -0.2458305f, 0.1229152f, 0.8735856f, 0.3652465f}, {0.1261471f, -0.2522941f, 0.1261471f, 0.8965548f, 0.401143f}, {0.1292085f, -0.258417f, 0.1292085f, 0.9183132f, 0.4351473f}, {0.1320972f, -0.2641944f, 0.1320972f, 0.9388436f, 0.4672323f}, {0.1348143f, -0.2696286f, 0.1348143f, 0.9581547f, 0.4974119f}, {0.1373638f, -0.2747276f, 0.1373638f, 0.9762747f, 0.52573f}, {0.1397516f, -0.2795032f, 0.1397516f, 0.9932454f, 0.5522519f}, {0.1419849f, -0.2839698f, 0.1419849f, 1.0091177f, 0.5770573f}, {0.1440716f, -0.2881431f, 0.1440716f, 1.0239482f, 0.6002345f}, {0.14602f, -0.2920401f, 0.14602f, 1.0377964f, 0.6218765f}, {0.1478388f, -0.2956776f, 0.1478388f, 1.0507227f, 0.6420779f}, {0.1495363f, -0.2990725f, 0.1495363f, 1.062787f, 0.660932f}, {0.1511206f, -0.3022413f, 0.1511206f, 1.0740475f, 0.6785301f}, {0.1525998f, -0.3051996f, 0.1525998f, 1.0845603f, 0.6949595f}, {0.1539812f, -0.3079625f, 0.1539812f, 1.0943785f, 0.7103034f}, {0.155272f, -0.310544f, 0.155272f, 1.1035523f, 0.7246404f}, {0.1564788f, -0.3129575f, 0.1564788f, 1.1121289f, 0.738044f}, {0.1576077f, -0.3152153f, 0.1576077f, 1.1201522f, 0.7505828f}, {0.1586644f, -0.3173289f, 0.1586644f, 1.127663f, 0.7623207f}, {0.1596545f, -0.3193089f, 0.1596545f, 1.1346992f, 0.773317f}, {0.1605826f, -0.3211653f, 0.1605826f, 1.1412959f, 0.7836265f}, {0.1614535f, -0.322907f, 0.1614535f, 1.1474855f, 0.7932996f}, {0.1622713f, -0.3245426f, 0.1622713f, 1.1532978f, 0.802383f}, {0.1630399f, -0.3260798f, 0.1630399f, 1.1587602f, 0.8109198f}, {0.1637628f, -0.3275256f, 0.1637628f, 1.1638982f, 0.8189494f}, {0.1644434f, -0.3288867f, 0.1644434f, 1.168735f, 0.8265085f}, {0.1650846f, -0.3301691f, 0.1650846f, 1.1732922f, 0.8336304f}, {0.1656892f, -0.3313784f, 0.1656892f, 1.1775894f, 0.8403462f}, {0.1662598f, -0.3325196f, 0.1662598f, 1.1816449f, 0.8466841f}, {0.1667988f, -0.3335975f, 0.1667988f, 1.1854753f, 0.8526704f}, {0.1673203f, -0.3346406f, 0.1673203f, 1.1891821f, 0.8584633f}, {0.167842f, -0.335684f, 0.167842f, 1.1928899f, 0.8642579f}, {0.1683624f, -0.3367247f, 0.1683624f, 1.1965883f, 0.8700378f}, {0.1688797f, -0.3377594f, 0.1688797f, 1.2002649f, 0.8757836f}, {0.1693921f, -0.3387841f, 0.1693921f, 1.2039065f, 0.8814747f}, {0.1698976f, -0.3397953f, 0.1698976f, 1.2074997f, 0.8870903f}, {0.1703946f, -0.3407892f, 0.1703946f, 1.2110316f, 0.8926099f}, {0.1708811f, -0.3417622f, 0.1708811f, 1.2144896f, 0.898014f}, {0.1713556f, -0.3427113f, 0.1713556f, 1.2178621f, 0.9032847f}, {0.1718167f, -0.3436334f, 0.1718167f, 1.2211389f, 0.9084057f}, {0.172263f, -0.344526f, 0.172263f, 1.224311f, 0.913363f}, {0.1726936f, -0.3453871f, 0.1726936f, 1.2273709f, 0.9181451f}, {0.1731075f, -0.346215f, 0.1731075f, 1.2303128f, 0.9227427f}, {0.1735042f, -0.3470084f, 0.1735042f, 1.2331323f, 0.9271491f}, {0.1738833f, -0.3477666f, 0.1738833f, 1.2358266f, 0.9313597f}, {0.1742445f, -0.3484891f, 0.1742445f, 1.2383941f, 0.9353722f}, {0.1745879f, -0.3491759f, 0.1745879f, 1.2408346f, 0.9391864f}, {0.1749136f, -0.3498272f, 0.1749136f, 1.2431492f, 0.9428036f}, {0.1752218f, -0.3504436f, 0.1752218f, 1.2453398f, 0.946227f}},
-      {{0.0443662f, -0.0887325f, 0.0443662f, 0.8037821f, -0.0187529f}, {0.0445421f, -0.0890842f, 0.0445421f, 0.8069678f, -0.0148639f}, {0.0450616f, -0.0901233f, 0.0450616f, 0.8163804f, -0.0033731f}, {0.0459019f, -0.0918038f, 0.0459019f, 0.8316032f, 0.0152108f}, {0.0470273f, -0.0940545f, 0.0470273f, 0.8519918f, 0.0401009f}, {0.0483932f, -0.0967865f, 0.0483932f, 0.876739f, 0.0703119f}, {0.0499503f, -0.0999006f, 0.0499503f, 0.9049484f, 0.1047496f}, {0.051648f, -0.103296f, 0.051648f, 0.9357055f, 0.1422975f}, {0.0534381f, -0.1068762f, 0.0534381f, 0.9681365f, 0.1818888f}, {0.055277f, -0.110554f, 0.055277f, 1.0014521f, 0.2225601f}, {0.0571273f, -0.1142546f, 0.0571273f, 1.0349736f, 0.2634827f}, {0.0589582f, -0.1179163f, 0.0589582f, 1.0681437f, 0.3039763f}, {0.0607455f, -0.1214911f, 0.0607455f, 1.1005255f, 0.3435077f}, {0.0624714f, -0.1249429f, 0.0624714f, 1.1317938f, 0.3816796f}, {0.0641233f, -0.1282466f, 0.0641233f, 1.1617206f, 0.4182139f}, {0.0656931f, -0.1313862f, 0.0656931f, 1.1901601f, 0.4529325f}, {0.0671764f, -0.1343527f, 0.0671764f, 1.2170326f, 0.485738f}, {0.0685716f, -0.1371432f, 0.0685716f, 1.2423097f, 0.5165961f}, {0.0698793f, -0.1397587f, 0.0698793f, 1.2660024f, 0.5455197f}, {0.0711018f, -0.1422036f, 0.0711018f, 1.2881494f, 0.5725566f}, {0.0722422f, -0.1444843f, 0.0722422f, 1.3088094f, 0.597778f}, {0.0733044f, -0.1466087f, 0.0733044f, 1.3280535f, 0.621271f}, {0.0742928f, -0.1485856f, 0.0742928f, 1.3459606f, 0.6431317f}, {0.0752119f, -0.1504239f, 0.0752119f, 1.362613f, 0.6634607f}, {0.0760664f, -0.1521329f, 0.0760664f, 1.3780936f, 0.6823593f}, {0.0768607f, -0.1537215f, 0.0768607f, 1.3924842f, 0.6999272f}, {0.0775992f, -0.1551985f, 0.0775992f, 1.4058636f, 0.7162606f}, {0.0782861f, -0.1565722f, 0.0782861f, 1.418307f, 0.7314513f}, {0.0789252f, -0.1578503f, 0.0789252f, 1.4298854f, 0.745586f}, {0.0795202f, -0.1590404f, 0.0795202f, 1.4406652f, 0.7587459f}, {0.0800745f, -0.1601491f, 0.0800745f, 1.4507083f, 0.7710064f}, {0.0805914f, -0.1611828f, 0.0805914f, 1.4600722f, 0.7824378f}, {0.0810737f, -0.1621474f, 0.0810737f, 1.4688099f, 0.7931046f}, {0.0815241f, -0.1630482f, 0.0815241f, 1.4769701f, 0.8030665f}, {0.0819451f, -0.1638903f, 0.0819451f, 1.4845979f, 0.8123784f}, {0.082339f, -0.1646781f, 0.082339f, 1.4917344f, 0.8210905f}, {0.0827079f, -0.1654158f, 0.0827079f, 1.4984174f, 0.8292491f}, {0.0830537f, -0.1661074f, 0.0830537f, 1.5046817f, 0.8368965f}, {0.0833781f, -0.1667562f, 0.0833781f, 1.5105589f, 0.8440713f}, {0.0836827f, -0.1673655f, 0.0836827f, 1.5160781f, 0.8508091f}, {0.0839691f, -0.1679382f, 0.0839691f, 1.5212661f, 0.8571424f}, {0.0842385f, -0.168477f, 0.0842385f, 1.5261471f, 0.8631011f}, {0.0844922f, -0.1689844f, 0.0844922f, 1.5307435f, 0.8687124f}, {0.0847314f, -0.1694627f, 0.0847314f, 1.5350759f, 0.8740013f}, {0.084957f, -0.1699139f, 0.084957f, 1.5391631f, 0.8789909f}, {0.085175f, -0.17035f, 0.085175f, 1.5431138f, 0.8838138f}, {0.0853929f, -0.1707858f, 0.0853929f, 1.5470611f, 0.8886327f}, {0.08561f, -0.17122f, 0.08561f, 1.5509941f, 0.8934341f}, {0.0858256f, -0.1716511f, 0.0858256f, 1.5548996f, 0.8982018f}, {0.0860388f, -0.1720777f, 0.0860388f, 1.5587636f, 0.9029189f}, {0.0862491f, -0.1724981f, 0.0862491f, 1.5625722f, 0.9075684f}, {0.0864555f, -0.1729109f, 0.0864555f, 1.5663117f, 0.9121336f}, {0.0866573f, -0.1733147f, 0.0866573f, 1.5699691f, 0.9165985f}, {0.086854f, -0.1737081f, 0.086854f, 1.5735326f, 0.9209487f}, {0.087045f, -0.1740899f, 0.087045f, 1.5769914f, 0.9251712f}, {0.0872296f, -0.1744592f, 0.0872296f, 1.5803364f, 0.9292548f}, {0.0874075f, -0.1748151f, 0.0874075f, 1.5835602f, 0.9331904f}, {0.0875785f, -0.1751569f, 0.0875785f, 1.5866568f, 0.9369707f}, {0.0877421f, -0.1754843f, 0.0877421f, 1.5896221f, 0.9405906f}, {0.0878984f, -0.1757968f, 0.0878984f, 1.5924533f, 0.9440469f}, {0.0880472f, -0.1760944f, 0.0880472f, 1.5951491f, 0.9473379f}, {0.0881885f, -0.1763771f, 0.0881885f, 1.5977098f, 0.950464f}, {0.0883225f, -0.176645f, 0.0883225f, 1.6001366f, 0.9534266f}, {0.0884492f, -0.1768984f, 0.0884492f, 1.6024317f, 0.9562284f}},
-      {{0.0151244f, -0.0302487f, 0.0151244f, 1.1755705f, 0.236068f}, {0.0151693f, -0.0303385f, 0.0151693f, 1.1790608f, 0.2397379f}, {0.0153014f, -0.0306029f, 0.0153014f, 1.1893334f, 0.2505391f}, {0.0155136f, -0.0310271f, 0.0155136f, 1.2058206f, 0.2678748f}, {0.0157945f, -0.0315891f, 0.0157945f, 1.2276616f, 0.2908398f}, {0.0161309f, -0.0322619f, 0.0161309f, 1.2538076f, 0.3183313f}, {0.0165083f, -0.0330165f, 0.0165083f, 1.2831354f, 0.3491684f}, {0.0169124f, -0.0338248f, 0.0169124f, 1.3145481f, 0.3821977f}, {0.0173306f, -0.0346611f, 0.0173306f, 1.3470509f, 0.4163732f}, {0.0177519f, -0.0355037f, 0.0177519f, 1.3797967f, 0.4508042f}, {0.0181675f, -0.036335f, 0.0181675f, 1.4121056f, 0.4847757f}, {0.018571f, -0.0371419f, 0.018571f, 1.4434627f, 0.5177465f}, {0.0189574f, -0.0379149f, 0.0189574f, 1.473503f, 0.5493327f}, {0.0193239f, -0.0386478f, 0.0193239f, 1.5019888f, 0.5792845f}, {0.0196687f, -0.0393374f, 0.0196687f, 1.5287855f, 0.6074602f}, {0.019991f, -0.039982f, 0.019991f, 1.5538375f, 0.6338014f}, {0.0202909f, -0.0405818f, 0.0202909f, 1.5771481f, 0.6583116f}, {0.020569f, -0.0411379f, 0.020569f, 1.5987617f, 0.6810376f}, {0.0208261f, -0.0416523f, 0.0208261f, 1.6187506f, 0.7020551f}, {0.0210635f, -0.0421271f, 0.0210635f, 1.6372038f, 0.721458f}, {0.0212825f, -0.0425649f, 0.0212825f, 1.6542199f, 0.7393497f}, {0.0214842f, -0.0429684f, 0.0214842f, 1.6699006f, 0.7558374f}, {0.0216701f, -0.0433401f, 0.0216701f, 1.6843475f, 0.7710278f}, {0.0218413f, -0.0436827f, 0.0218413f, 1.6976591f, 0.7850244f}, {0.0219992f, -0.0439984f, 0.0219992f, 1.709929f, 0.7979258f}, {0.0221448f, -0.0442896f, 0.0221448f, 1.7212454f, 0.8098245f}, {0.0222792f, -0.0445583f, 0.0222792f, 1.7316899f, 0.8208066f}, {0.0224033f, -0.0448066f, 0.0224033f, 1.7413383f, 0.8309515f}, {0.0225181f, -0.0450361f, 0.0225181f, 1.7502598f, 0.840332f}, {0.0226243f, -0.0452486f, 0.0226243f, 1.7585177f, 0.8490149f}, {0.0227228f, -0.0454455f, 0.0227228f, 1.7661698f, 0.8570609f}, {0.0228141f, -0.0456282f, 0.0228141f, 1.7732686f, 0.864525f}, {0.0228989f, -0.0457978f, 0.0228989f, 1.7798618f, 0.8714574f}, {0.0229778f, -0.0459556f, 0.0229778f, 1.7859924f, 0.8779036f}, {0.0230512f, -0.0461024f, 0.0230512f, 1.7916998f, 0.8839047f}, {0.0231197f, -0.0462393f, 0.0231197f, 1.7970194f, 0.889498f}, {0.0231835f, -0.046367f, 0.0231835f, 1.8019834f, 0.8947175f}, {0.0232432f, -0.0464864f, 0.0232432f, 1.8066209f, 0.8995936f}, {0.023299f, -0.046598f, 0.023299f, 1.8109584f, 0.9041543f}, {0.0233512f, -0.0467025f, 0.0233512f, 1.8150199f, 0.9084248f}, {0.0234002f, -0.0468004f, 0.0234002f, 1.8188272f, 0.912428f}, {0.0234462f, -0.0468924f, 0.0234462f, 1.8224f, 0.9161848f}, {0.0234894f, -0.0469787f, 0.0234894f, 1.8257565f, 0.919714f}, {0.02353f, -0.04706f, 0.02353f, 1.828913f, 0.923033f}, {0.0235682f, -0.0471364f, 0.0235682f, 1.8318845f, 0.9261574f}, {0.0236051f, -0.0472102f, 0.0236051f, 1.834751f, 0.9291713f}, {0.0236419f, -0.0472837f, 0.0236419f, 1.8376092f, 0.9321767f}, {0.0236784f, -0.0473569f, 0.0236784f, 1.8404515f, 0.9351652f}, {0.0237147f, -0.0474293f, 0.0237147f, 1.8432682f, 0.9381269f}, {0.0237505f, -0.0475009f, 0.0237505f, 1.8460496f, 0.9410515f}, {0.0237857f, -0.0475713f, 0.0237857f, 1.8487859f, 0.9439285f}, {0.0238202f, -0.0476403f, 0.0238202f, 1.8514673f, 0.946748f}, {0.0238538f, -0.0477077f, 0.0238538f, 1.8540851f, 0.9495004f}, {0.0238866f, -0.0477732f, 0.0238866f, 1.8566309f, 0.9521773f}, {0.0239183f, -0.0478367f, 0.0239183f, 1.8590977f, 0.954771f}, {0.023949f, -0.0478979f, 0.023949f, 1.8614792f, 0.9572751f}, {0.0239784f, -0.0479569f, 0.0239784f, 1.8637707f, 0.9596845f}, {0.0240067f, -0.0480134f, 0.0240067f, 1.8659682f, 0.9619951f}, {0.0240338f, -0.0480675f, 0.0240338f, 1.8680694f, 0.9642044f}, {0.0240595f, -0.048119f, 0.0240595f, 1.8700726f, 0.9663107f}, {0.024084f, -0.0481681f, 0.024084f, 1.8719775f, 0.9683136f}, {0.0241073f, -0.0482146f, 0.0241073f, 1.8737845f, 0.9702136f}, {0.0241293f, -0.0482586f, 0.0241293f, 1.8754948f, 0.972012f}, {0.0241501f, -0.0483001f, 0.0241501f, 1.8771105f, 0.9737108f}}};
-
-}
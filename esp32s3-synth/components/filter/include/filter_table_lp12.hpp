@@ -1,74 +0,0 @@
-#pragma once
-#include <cstdint>
-#include "protocol.hpp"
-using namespace protocol;
-namespace sound_module
-{
-  constexpr float filterTableLP12[CUTOFF_TABLE_SIZE][RESONANCE_TABLE_SIZE][5] =
-      {
-          {{0.7072341f, 1.4144681f, 0.7072341f, 1.3647374f, 0.4641988f}, {0.7087055f, 1.417411f, 0.7087055f, 1.3675768f, 0.4672452f}, {0.7130211f, 1.4260422f, 0.7130211f, 1.3759046f, 0.4761798f}, {0.7199008f, 1.4398017f, 0.7199008f, 1.3891803f, 0.4904231f}, {0.728927f, 1.457854f, 0.728927f, 1.4065979f, 0.50911f}, {0.7396031f, 1.4792061f, 0.7396031f, 1.4271993f, 0.5312129f}, {0.7514141f, 1.5028282f, 0.7514141f, 1.4499909f, 0.5556655f}, {0.7638763f, 1.5277526f, 0.7638763f, 1.474039f, 0.5814662f}, {0.7765703f, 1.5531406f, 0.7765703f, 1.4985344f, 0.6077468f}, {0.7891577f, 1.5783154f, 0.7891577f, 1.522824f, 0.6338067f}, {0.8013835f, 1.602767f, 0.8013835f, 1.546416f, 0.659118f}, {0.8130695f, 1.626139f, 0.8130695f, 1.5689662f, 0.6833117f}, {0.8241024f, 1.6482048f, 0.8241024f, 1.5902563f, 0.7061534f}, {0.8344208f, 1.6688416f, 0.8344208f, 1.6101675f, 0.7275157f}, {0.8440023f, 1.6880045f, 0.8440023f, 1.6286567f, 0.7473524f}, {0.8528522f, 1.7057045f, 0.8528522f, 1.6457343f, 0.7656746f}, {0.8609952f, 1.7219905f, 0.8609952f, 1.6614477f, 0.7825332f}, {0.8684676f, 1.7369353f, 0.8684676f, 1.6758671f, 0.7980035f}, {0.8753127f, 1.7506254f, 0.8753127f, 1.6890758f, 0.8121749f}, {0.8815766f, 1.7631533f, 0.8815766f, 1.7011633f, 0.8251432f}, {0.8873063f, 1.7746126f, 0.8873063f, 1.7122197f, 0.8370055f}, {0.8925474f, 1.7850948f, 0.8925474f, 1.7223334f, 0.8478562f}, {0.8973434f, 1.7946867f, 0.8973434f, 1.7315881f, 0.8577854f}, {0.9017349f, 1.8034699f, 0.9017349f, 1.7400624f, 0.8668773f}, {0.9057597f, 1.8115194f, 0.9057597f, 1.7478289f, 0.8752098f}, {0.9094521f, 1.8189043f, 0.9094521f, 1.7549542f, 0.8828544f}, {0.9128436f, 1.8256872f, 0.9128436f, 1.7614986f, 0.8898758f}, {0.9159626f, 1.8319251f, 0.9159626f, 1.7675172f, 0.896333f}, {0.9188347f, 1.8376693f, 0.9188347f, 1.7730595f, 0.9022792f}, {0.9214831f, 1.8429661f, 0.9214831f, 1.77817f, 0.9077622f}, {0.9239285f, 1.847857f, 0.9239285f, 1.782889f, 0.9128251f}, {0.9261898f, 1.8523796f, 0.9261898f, 1.7872525f, 0.9175066f}, {0.9282836f, 1.8565673f, 0.9282836f, 1.791293f, 0.9218415f}, {0.9302252f, 1.8604503f, 0.9302252f, 1.7950395f, 0.9258611f}, {0.932028f, 1.8640559f, 0.932028f, 1.7985183f, 0.9295935f}, {0.9337042f, 1.8674084f, 0.9337042f, 1.8017529f, 0.9330638f}, {0.9352648f, 1.8705297f, 0.9352648f, 1.8047645f, 0.9362948f}, {0.9367198f, 1.8734395f, 0.9367198f, 1.8075721f, 0.939307f}, {0.9380779f, 1.8761558f, 0.9380779f, 1.8101929f, 0.9421188f}, {0.9393473f, 1.8786946f, 0.9393473f, 1.8126424f, 0.9447469f}, {0.9405352f, 1.8810704f, 0.9405352f, 1.8149346f, 0.9472062f}, {0.9416482f, 1.8832963f, 0.9416482f, 1.8170823f, 0.9495104f}, {0.9426921f, 1.8853843f, 0.9426921f, 1.8190968f, 0.9516717f}, {0.9436725f, 1.8873451f, 0.9436725f, 1.8209887f, 0.9537014f}, {0.9445942f, 1.8891884f, 0.9445942f, 1.8227672f, 0.9556096f}, {0.9454822f, 1.8909644f, 0.9454822f, 1.8244808f, 0.957448f}, {0.9463665f, 1.8927331f, 0.9463665f, 1.8261873f, 0.9592789f}, {0.9472448f, 1.8944897f, 0.9472448f, 1.8278821f, 0.9610972f}, {0.9481142f, 1.8962283f, 0.9481142f, 1.8295596f, 0.9628971f}, {0.9489716f, 1.8979431f, 0.9489716f, 1.8312141f, 0.9646721f}, {0.949814f, 1.8996281f, 0.949814f, 1.8328398f, 0.9664163f}, {0.9506387f, 1.9012773f, 0.9506387f, 1.8344311f, 0.9681235f}, {0.9514428f, 1.9028855f, 0.9514428f, 1.8359828f, 0.9697883f}, {0.9522239f, 1.9044478f, 0.9522239f, 1.8374901f, 0.9714055f}, {0.95298f, 1.9059599f, 0.95298f, 1.8389491f, 0.9729708f}, {0.9537092f, 1.9074183f, 0.9537092f, 1.8403562f, 0.9744804f}, {0.95441f, 1.9088201f, 0.95441f, 1.8417086f, 0.9759315f}, {0.9550815f, 1.9101631f, 0.9550815f, 1.8430045f, 0.9773217f}, {0.955723f, 1.911446f, 0.955723f, 1.8442423f, 0.9786497f}, {0.956334f, 1.912668f, 0.956334f, 1.8454213f, 0.9799147f}, {0.9569146f, 1.9138291f, 0.9569146f, 1.8465416f, 0.9811166f}, {0.9574648f, 1.9149296f, 0.9574648f, 1.8476034f, 0.9822558f}, {0.9579852f, 1.9159705f, 0.9579852f, 1.8486077f, 0.9833333f}, {0.9584765f, 1.916953f, 0.9584765f, 1.8495557f, 0.9843504f}},
-          {{0.5665869f, 1.1331737f, 0.5665869f, 1.0205153f, 0.2458322f}, {0.5682475f, 1.136495f, 0.5682475f, 1.0235064f, 0.2494837f}, {0.5731344f, 1.1462687f, 0.5731344f, 1.0323084f, 0.260229f}, {0.5809754f, 1.1619507f, 0.5809754f, 1.0464313f, 0.2774701f}, {0.5913582f, 1.1827163f, 0.5913582f, 1.0651324f, 0.3003002f}, {0.603781f, 1.207562f, 0.603781f, 1.087508f, 0.327616f}, {0.6177072f, 1.2354145f, 0.6177072f, 1.1125914f, 0.3582375f}, {0.6326137f, 1.2652273f, 0.6326137f, 1.1394403f, 0.3910144f}, {0.6480267f, 1.2960533f, 0.6480267f, 1.1672016f, 0.424905f}, {0.6635439f, 1.3270878f, 0.6635439f, 1.1951507f, 0.4590249f}, {0.6788433f, 1.3576866f, 0.6788433f, 1.2227074f, 0.4926658f}, {0.6936817f, 1.3873635f, 0.6936817f, 1.2494339f, 0.5252931f}, {0.7078876f, 1.4157752f, 0.7078876f, 1.2750209f, 0.5565295f}, {0.7213498f, 1.4426996f, 0.7213498f, 1.2992686f, 0.5861307f}, {0.7340062f, 1.4680123f, 0.7340062f, 1.3220647f, 0.61396f}, {0.7458319f, 1.4916637f, 0.7458319f, 1.3433647f, 0.6399627f}, {0.7568298f, 1.5136595f, 0.7568298f, 1.3631737f, 0.6641453f}, {0.7670221f, 1.5340442f, 0.7670221f, 1.3815318f, 0.6865566f}, {0.776444f, 1.552888f, 0.776444f, 1.3985022f, 0.7072738f}, {0.7851384f, 1.5702769f, 0.7851384f, 1.4141623f, 0.7263915f}, {0.7931526f, 1.5863053f, 0.7931526f, 1.4285972f, 0.7440134f}, {0.8005353f, 1.6010707f, 0.8005353f, 1.4418946f, 0.7602467f}, {0.8073349f, 1.6146698f, 0.8073349f, 1.4541418f, 0.7751979f}, {0.8135983f, 1.6271965f, 0.8135983f, 1.4654231f, 0.78897f}, {0.8193699f, 1.6387398f, 0.8193699f, 1.4758187f, 0.8016609f}, {0.8246916f, 1.6493833f, 0.8246916f, 1.485404f, 0.8133625f}, {0.8296022f, 1.6592045f, 0.8296022f, 1.4942488f, 0.8241601f}, {0.8341375f, 1.668275f, 0.8341375f, 1.5024176f, 0.8341325f}, {0.8383303f, 1.6766605f, 0.8383303f, 1.5099694f, 0.8433516f}, {0.8422105f, 1.6844209f, 0.8422105f, 1.5169583f, 0.8518836f}, {0.8458054f, 1.6916108f, 0.8458054f, 1.5234333f, 0.8597882f}, {0.8491398f, 1.6982796f, 0.8491398f, 1.5294392f, 0.8671201f}, {0.8522363f, 1.7044726f, 0.8522363f, 1.5350164f, 0.8739287f}, {0.8551151f, 1.7102303f, 0.8551151f, 1.5402017f, 0.8802589f}, {0.8577949f, 1.7155898f, 0.8577949f, 1.5450284f, 0.8861512f}, {0.8602923f, 1.7205846f, 0.8602923f, 1.5495266f, 0.8916426f}, {0.8626225f, 1.7252449f, 0.8626225f, 1.5537236f, 0.8967662f}, {0.8647992f, 1.7295983f, 0.8647992f, 1.5576442f, 0.9015524f}, {0.8668349f, 1.7336697f, 0.8668349f, 1.5613108f, 0.9060286f}, {0.8687408f, 1.7374817f, 0.8687408f, 1.5647438f, 0.9102195f}, {0.8705274f, 1.7410547f, 0.8705274f, 1.5679616f, 0.9141478f}, {0.8722038f, 1.7444075f, 0.8722038f, 1.5709811f, 0.9178339f}, {0.8737785f, 1.747557f, 0.8737785f, 1.5738175f, 0.9212966f}, {0.8752593f, 1.7505187f, 0.8752593f, 1.5764847f, 0.9245527f}, {0.8766533f, 1.7533066f, 0.8766533f, 1.5789954f, 0.9276177f}, {0.8779979f, 1.7559957f, 0.8779979f, 1.5814172f, 0.9305742f}, {0.8793385f, 1.758677f, 0.8793385f, 1.583832f, 0.9335221f}, {0.8806716f, 1.7613431f, 0.8806716f, 1.586233f, 0.9364533f}, {0.8819926f, 1.7639852f, 0.8819926f, 1.5886124f, 0.939358f}, {0.883297f, 1.7665939f, 0.883297f, 1.5909618f, 0.9422261f}, {0.8845801f, 1.7691601f, 0.8845801f, 1.5932728f, 0.9450474f}, {0.8858374f, 1.7716748f, 0.8858374f, 1.5955375f, 0.9478121f}, {0.8870648f, 1.7741296f, 0.8870648f, 1.5977483f, 0.950511f}, {0.8882584f, 1.7765169f, 0.8882584f, 1.5998982f, 0.9531356f}, {0.8894149f, 1.7788298f, 0.8894149f, 1.6019812f, 0.9556785f}, {0.8905314f, 1.7810628f, 0.8905314f, 1.6039922f, 0.9581334f}, {0.8916056f, 1.7832111f, 0.8916056f, 1.6059269f, 0.9604953f}, {0.8926357f, 1.7852714f, 0.8926357f, 1.6077823f, 0.9627604f}, {0.8936206f, 1.7872411f, 0.8936206f, 1.6095563f, 0.964926f}, {0.8945595f, 1.789119f, 0.8945595f, 1.6112474f, 0.9669906f}, {0.8954523f, 1.7909046f, 0.8954523f, 1.6128555f, 0.9689537f}, {0.8962992f, 1.7925984f, 0.8962992f, 1.6143809f, 0.9708159f}, {0.8971008f, 1.7942015f, 0.8971008f, 1.6158246f, 0.9725784f}, {0.8978579f, 1.7957158f, 0.8978579f, 1.6171884f, 0.9742432f}},
-          {{0.4424121f, 0.8848243f, 0.4424121f, 0.6905116f, 0.079137f}, {0.4439965f, 0.8879929f, 0.4439965f, 0.6929844f, 0.0830015f}, {0.4486707f, 0.8973413f, 0.4486707f, 0.7002798f, 0.0944029f}, {0.456208f, 0.9124159f, 0.456208f, 0.7120439f, 0.1127879f}, {0.4662602f, 0.9325205f, 0.4662602f, 0.7277334f, 0.1373075f}, {0.4783962f, 0.9567923f, 0.4783962f, 0.746675f, 0.1669097f}, {0.4921435f, 0.9842869f, 0.4921435f, 0.7681316f, 0.2004422f}, {0.5070283f, 1.0140565f, 0.5070283f, 0.7913636f, 0.2367494f}, {0.5226069f, 1.0452138f, 0.5226069f, 0.8156786f, 0.274749f}, {0.5384876f, 1.0769752f, 0.5384876f, 0.840465f, 0.3134854f}, {0.5543422f, 1.1086844f, 0.5543422f, 0.8652106f, 0.3521581f}, {0.5699093f, 1.1398186f, 0.5699093f, 0.8895076f, 0.3901296f}, {0.5849915f, 1.169983f, 0.5849915f, 0.9130477f, 0.4269183f}, {0.5994484f, 1.1988968f, 0.5994484f, 0.9356118f, 0.4621817f}, {0.613188f, 1.226376f, 0.613188f, 0.9570565f, 0.4956955f}, {0.6261577f, 1.2523154f, 0.6261577f, 0.9772994f, 0.5273314f}, {0.6383355f, 1.2766711f, 0.6383355f, 0.9963064f, 0.5570357f}, {0.6497226f, 1.2994452f, 0.6497226f, 1.0140792f, 0.5848111f}, {0.6603366f, 1.3206732f, 0.6603366f, 1.0306454f, 0.610701f}, {0.6702068f, 1.3404136f, 0.6702068f, 1.0460507f, 0.6347765f}, {0.6793698f, 1.3587397f, 0.6793698f, 1.0603523f, 0.6571271f}, {0.6878666f, 1.3757332f, 0.6878666f, 1.073614f, 0.6778525f}, {0.6957401f, 1.3914802f, 0.6957401f, 1.0859028f, 0.6970576f}, {0.7030335f, 1.406067f, 0.7030335f, 1.0972863f, 0.7148478f}, {0.7097894f, 1.4195788f, 0.7097894f, 1.1078308f, 0.7313268f}, {0.7160486f, 1.4320972f, 0.7160486f, 1.1176001f, 0.7465943f}, {0.72185f, 1.4436999f, 0.72185f, 1.1266548f, 0.7607451f}, {0.7272299f, 1.4544599f, 0.7272299f, 1.1350518f, 0.773868f}, {0.7322226f, 1.4644451f, 0.7322226f, 1.1428442f, 0.7860461f}, {0.7368593f, 1.4737186f, 0.7368593f, 1.1500811f, 0.797356f}, {0.7411692f, 1.4823384f, 0.7411692f, 1.1568079f, 0.8078688f}, {0.7451789f, 1.4903579f, 0.7451789f, 1.1630663f, 0.8176494f}, {0.748913f, 1.497826f, 0.748913f, 1.1688944f, 0.8267576f}, {0.7523938f, 1.5047877f, 0.7523938f, 1.1743273f, 0.8352481f}, {0.7556418f, 1.5112836f, 0.7556418f, 1.1793967f, 0.8431706f}, {0.7586757f, 1.5173514f, 0.7586757f, 1.1841319f, 0.8505708f}, {0.7615124f, 1.5230249f, 0.7615124f, 1.1885595f, 0.8574903f}, {0.7641676f, 1.5283352f, 0.7641676f, 1.1927036f, 0.8639668f}, {0.7666554f, 1.5333108f, 0.7666554f, 1.1965866f, 0.8700351f}, {0.7689887f, 1.5379775f, 0.7689887f, 1.2002284f, 0.8757266f}, {0.7711794f, 1.5423589f, 0.7711794f, 1.2036476f, 0.8810701f}, {0.7732382f, 1.5464764f, 0.7732382f, 1.2068609f, 0.886092f}, {0.775175f, 1.5503499f, 0.775175f, 1.2098838f, 0.8908161f}, {0.7769987f, 1.5539974f, 0.7769987f, 1.2127302f, 0.8952645f}, {0.7787176f, 1.5574351f, 0.7787176f, 1.215413f, 0.8994572f}, {0.7803776f, 1.5607552f, 0.7803776f, 1.218004f, 0.9035064f}, {0.7820347f, 1.5640695f, 0.7820347f, 1.2205904f, 0.9075485f}, {0.7836845f, 1.5673689f, 0.7836845f, 1.2231653f, 0.9115726f}, {0.7853212f, 1.5706425f, 0.7853212f, 1.22572f, 0.915565f}, {0.7869393f, 1.5738785f, 0.7869393f, 1.2282453f, 0.9195117f}, {0.7885327f, 1.5770654f, 0.7885327f, 1.2307324f, 0.9233985f}, {0.790096f, 1.580192f, 0.790096f, 1.2331723f, 0.9272116f}, {0.7916237f, 1.5832474f, 0.7916237f, 1.2355568f, 0.9309381f}, {0.793111f, 1.586222f, 0.793111f, 1.2378781f, 0.9345658f}, {0.7945535f, 1.589107f, 0.7945535f, 1.2401295f, 0.9380844f}, {0.7959475f, 1.591895f, 0.7959475f, 1.2423053f, 0.9414847f}, {0.79729f, 1.5945801f, 0.79729f, 1.2444007f, 0.9447594f}, {0.7985787f, 1.5971574f, 0.7985787f, 1.246412f, 0.9479028f}, {0.7998119f, 1.5996238f, 0.7998119f, 1.2483368f, 0.9509107f}, {0.8009886f, 1.6019771f, 0.8009886f, 1.2501733f, 0.9537809f}, {0.8021083f, 1.6042166f, 0.8021083f, 1.251921f, 0.9565122f}, {0.8031713f, 1.6063427f, 0.8031713f, 1.2535802f, 0.9591051f}, {0.8041782f, 1.6083564f, 0.8041782f, 1.2551517f, 0.9615611f}, {0.8051299f, 1.6102599f, 0.8051299f, 1.2566372f, 0.9638826f}},
-          {{0.3522256f, 0.7044513f, 0.3522256f, 0.4311226f, -0.02222f}, {0.3536264f, 0.7072528f, 0.3536264f, 0.4328371f, -0.0183315f}, {0.3577654f, 0.7155308f, 0.3577654f, 0.4379032f, -0.0068416f}, {0.3644601f, 0.7289201f, 0.3644601f, 0.4460975f, 0.0117428f}, {0.3734279f, 0.7468557f, 0.3734279f, 0.457074f, 0.0366374f}, {0.3843148f, 0.7686296f, 0.3843148f, 0.4703996f, 0.0668597f}, {0.3967277f, 0.7934554f, 0.3967277f, 0.4855929f, 0.1013179f}, {0.410265f, 0.82053f, 0.410265f, 0.5021625f, 0.1388975f}, {0.4245429f, 0.8490857f, 0.4245429f, 0.5196385f, 0.1785329f}, {0.4392143f, 0.8784285f, 0.4392143f, 0.5375963f, 0.2192608f}, {0.4539805f, 0.9079611f, 0.4539805f, 0.5556701f, 0.260252f}, {0.4685961f, 0.9371922f, 0.4685961f, 0.5735595f, 0.300825f}, {0.4828684f, 0.9657367f, 0.4828684f, 0.5910287f, 0.3404448f}, {0.4966535f, 0.993307f, 0.4966535f, 0.6079016f, 0.3787124f}, {0.5098507f, 1.0197014f, 0.5098507f, 0.6240549f, 0.4153478f}, {0.5223951f, 1.0447902f, 0.5223951f, 0.6394092f, 0.4501711f}, {0.5342511f, 1.0685021f, 0.5342511f, 0.6539208f, 0.4830834f}, {0.5454057f, 1.0908113f, 0.5454057f, 0.667574f, 0.5140486f}, {0.5558632f, 1.1117264f, 0.5558632f, 0.680374f, 0.5430788f}, {0.5656404f, 1.1312809f, 0.5656404f, 0.6923413f, 0.5702204f}, {0.5747628f, 1.1495256f, 0.5747628f, 0.7035071f, 0.5955442f}, {0.5832615f, 1.166523f, 0.5832615f, 0.7139094f, 0.6191366f}, {0.591171f, 1.1823419f, 0.591171f, 0.7235905f, 0.6410933f}, {0.5985273f, 1.1970546f, 0.5985273f, 0.7325947f, 0.6615145f}, {0.6053669f, 1.2107339f, 0.6053669f, 0.7409664f, 0.6805014f}, {0.6117258f, 1.2234516f, 0.6117258f, 0.7487496f, 0.6981536f}, {0.6176385f, 1.235277f, 0.6176385f, 0.7559867f, 0.7145673f}, {0.6231382f, 1.2462763f, 0.6231382f, 0.7627183f, 0.7298344f}, {0.628256f, 1.2565121f, 0.628256f, 0.7689825f, 0.7440416f}, {0.6330214f, 1.2660428f, 0.6330214f, 0.7748153f, 0.7572703f}, {0.6374615f, 1.274923f, 0.6374615f, 0.7802499f, 0.769596f}, {0.6416016f, 1.2832032f, 0.6416016f, 0.7853175f, 0.781089f}, {0.6454652f, 1.2909303f, 0.6454652f, 0.7900464f, 0.7918142f}, {0.6490737f, 1.2981473f, 0.6490737f, 0.7944632f, 0.8018314f}, {0.6524469f, 1.3048938f, 0.6524469f, 0.798592f, 0.8111956f}, {0.6556031f, 1.3112062f, 0.6556031f, 0.8024552f, 0.8199572f}, {0.6585589f, 1.3171179f, 0.6585589f, 0.8060731f, 0.8281626f}, {0.6613297f, 1.3226594f, 0.6613297f, 0.8094645f, 0.8358542f}, {0.6639294f, 1.3278588f, 0.6639294f, 0.8126465f, 0.843071f}, {0.6663708f, 1.3327417f, 0.6663708f, 0.8156349f, 0.8498485f}, {0.6686658f, 1.3373317f, 0.6686658f, 0.8184439f, 0.8562195f}, {0.6708252f, 1.3416504f, 0.6708252f, 0.821087f, 0.8622138f}, {0.6728587f, 1.3457174f, 0.6728587f, 0.823576f, 0.8678588f}, {0.6747755f, 1.349551f, 0.6747755f, 0.8259221f, 0.8731798f}, {0.6765838f, 1.3531677f, 0.6765838f, 0.8281355f, 0.8781998f}, {0.6783319f, 1.3566637f, 0.6783319f, 0.8302751f, 0.8830523f}, {0.6800785f, 1.3601569f, 0.6800785f, 0.8324129f, 0.8879009f}, {0.6818188f, 1.3636375f, 0.6818188f, 0.8345431f, 0.892732f}, {0.6835469f, 1.3670939f, 0.6835469f, 0.8366583f, 0.8975295f}, {0.6852569f, 1.3705137f, 0.6852569f, 0.8387513f, 0.9022762f}, {0.6869423f, 1.3738846f, 0.6869423f, 0.8408142f, 0.9069549f}, {0.6885972f, 1.3771944f, 0.6885972f, 0.8428398f, 0.911549f}, {0.6902158f, 1.3804317f, 0.6902158f, 0.844821f, 0.9160423f}, {0.6917929f, 1.3835859f, 0.6917929f, 0.8467514f, 0.9204203f}, {0.6933238f, 1.3866475f, 0.6933238f, 0.8486251f, 0.9246699f}, {0.6948043f, 1.3896086f, 0.6948043f, 0.8504373f, 0.9287799f}, {0.6962312f, 1.3924623f, 0.6962312f, 0.8521838f, 0.9327409f}, {0.6976018f, 1.3952036f, 0.6976018f, 0.8538614f, 0.9365458f}, {0.6989143f, 1.3978287f, 0.6989143f, 0.855468f, 0.9401894f}, {0.7001676f, 1.4003351f, 0.7001676f, 0.8570019f, 0.9436683f}, {0.7013609f, 1.4027218f, 0.7013609f, 0.8584625f, 0.9469811f}, {0.7024944f, 1.4049889f, 0.7024944f, 0.85985f, 0.9501278f}, {0.7035687f, 1.4071374f, 0.7035687f, 0.8611649f, 0.95311f}, {0.7045847f, 1.4091695f, 0.7045847f, 0.8624085f, 0.9559304f}},
-          {{0.2844578f, 0.5689157f, 0.2844578f, 0.2212963f, -0.083465f}, {0.2856571f, 0.5713143f, 0.2856571f, 0.2222293f, -0.0796008f}, {0.2892043f, 0.5784086f, 0.2892043f, 0.2249889f, -0.0681717f}, {0.2949522f, 0.5899044f, 0.2949522f, 0.2294605f, -0.0496517f}, {0.3026724f, 0.6053447f, 0.3026724f, 0.2354664f, -0.024777f}, {0.3120765f, 0.624153f, 0.3120765f, 0.2427825f, 0.0055236f}, {0.3228416f, 0.6456832f, 0.3228416f, 0.2511573f, 0.0402091f}, {0.3346341f, 0.6692683f, 0.3346341f, 0.2603314f, 0.0782052f}, {0.3471314f, 0.6942628f, 0.3471314f, 0.2700537f, 0.1184719f}, {0.3600374f, 0.7200747f, 0.3600374f, 0.280094f, 0.1600554f}, {0.3730929f, 0.7461858f, 0.3730929f, 0.2902507f, 0.2021209f}, {0.3860811f, 0.7721622f, 0.3860811f, 0.300355f, 0.2439694f}, {0.3988279f, 0.7976559f, 0.3988279f, 0.3102715f, 0.2850403f}, {0.4112f, 0.8223999f, 0.4112f, 0.3198964f, 0.3249035f}, {0.4231002f, 0.8462004f, 0.4231002f, 0.3291543f, 0.3632465f}, {0.4344628f, 0.8689256f, 0.4344628f, 0.3379939f, 0.3998572f}, {0.4452478f, 0.8904956f, 0.4452478f, 0.3463842f, 0.434607f}, {0.4554359f, 0.9108717f, 0.4554359f, 0.3543101f, 0.4674333f}, {0.4650236f, 0.9300472f, 0.4650236f, 0.361769f, 0.4983255f}, {0.4740197f, 0.9480394f, 0.4740197f, 0.3687675f, 0.5273112f}, {0.4824413f, 0.9648826f, 0.4824413f, 0.3753192f, 0.5544459f}, {0.4903115f, 0.9806231f, 0.4903115f, 0.3814419f, 0.5798043f}, {0.4976575f, 0.9953149f, 0.4976575f, 0.3871567f, 0.6034731f}, {0.5045082f, 1.0090164f, 0.5045082f, 0.3924863f, 0.6255465f}, {0.5108938f, 1.0217876f, 0.5108938f, 0.3974541f, 0.6461212f}, {0.5168445f, 1.033689f, 0.5168445f, 0.4020834f, 0.6652946f}, {0.5223898f, 1.0447796f, 0.5223898f, 0.4063974f, 0.6831617f}, {0.5275582f, 1.0551164f, 0.5275582f, 0.4104183f, 0.6998146f}, {0.5323769f, 1.0647538f, 0.5323769f, 0.414167f, 0.7153407f}, {0.5368716f, 1.0737433f, 0.5368716f, 0.4176637f, 0.7298228f}, {0.5410665f, 1.0821329f, 0.5410665f, 0.4209271f, 0.7433388f}, {0.5449839f, 1.0899678f, 0.5449839f, 0.4239747f, 0.7559609f}, {0.5486449f, 1.0972898f, 0.5486449f, 0.4268228f, 0.7677567f}, {0.5520688f, 1.1041375f, 0.5520688f, 0.4294864f, 0.7787886f}, {0.5552734f, 1.1105469f, 0.5552734f, 0.4319795f, 0.7891142f}, {0.5582754f, 1.1165508f, 0.5582754f, 0.434315f, 0.7987867f}, {0.5610899f, 1.1221798f, 0.5610899f, 0.4365045f, 0.807855f}, {0.5637308f, 1.1274617f, 0.5637308f, 0.4385591f, 0.8163643f}, {0.5662112f, 1.1324223f, 0.5662112f, 0.4404886f, 0.824356f}, {0.5685426f, 1.1370852f, 0.5685426f, 0.4423024f, 0.831868f}, {0.5707361f, 1.1414722f, 0.5707361f, 0.4440088f, 0.8389355f}, {0.5728015f, 1.145603f, 0.5728015f, 0.4456157f, 0.8455904f}, {0.5747481f, 1.1494962f, 0.5747481f, 0.44713f, 0.8518624f}, {0.5765842f, 1.1531684f, 0.5765842f, 0.4485584f, 0.8577785f}, {0.5783176f, 1.1566353f, 0.5783176f, 0.449907f, 0.8633636f}, {0.5799943f, 1.1599886f, 0.5799943f, 0.4512114f, 0.8687659f}, {0.5816707f, 1.1633413f, 0.5816707f, 0.4525155f, 0.8741672f}, {0.583342f, 1.1666841f, 0.583342f, 0.4538158f, 0.8795524f}, {0.5850028f, 1.1700056f, 0.5850028f, 0.4551078f, 0.8849035f}, {0.586647f, 1.173294f, 0.586647f, 0.4563869f, 0.8902012f}, {0.5882687f, 1.1765374f, 0.5882687f, 0.4576485f, 0.8954263f}, {0.589862f, 1.1797239f, 0.589862f, 0.458888f, 0.9005599f}, {0.5914212f, 1.1828425f, 0.5914212f, 0.460101f, 0.9055839f}, {0.5929414f, 1.1858827f, 0.5929414f, 0.4612836f, 0.9104818f}, {0.5944177f, 1.1888354f, 0.5944177f, 0.4624322f, 0.9152387f}, {0.5958463f, 1.1916927f, 0.5958463f, 0.4635436f, 0.9198418f}, {0.5972239f, 1.1944478f, 0.5972239f, 0.4646153f, 0.9242804f}, {0.5985479f, 1.1970958f, 0.5985479f, 0.4656453f, 0.9285463f}, {0.5998163f, 1.1996326f, 0.5998163f, 0.466632f, 0.9326332f}, {0.601028f, 1.202056f, 0.601028f, 0.4675747f, 0.9365372f}, {0.6021823f, 1.2043646f, 0.6021823f, 0.4684727f, 0.9402565f}, {0.6032792f, 1.2065584f, 0.6032792f, 0.469326f, 0.9437907f}, {0.6043192f, 1.2086383f, 0.6043192f, 0.4701351f, 0.9471416f}, {0.6053031f, 1.2106063f, 0.6053031f, 0.4709006f, 0.950312f}},
-          {{0.2321819f, 0.4643639f, 0.2321819f, 0.0470773f, -0.1183496f}, {0.2331925f, 0.466385f, 0.2331925f, 0.0472822f, -0.1145122f}, {0.236183f, 0.472366f, 0.236183f, 0.0478886f, -0.1031566f}, {0.241034f, 0.482068f, 0.241034f, 0.0488722f, -0.0847361f}, {0.2475595f, 0.495119f, 0.2475595f, 0.0501953f, -0.0599573f}, {0.2555238f, 0.5110477f, 0.2555238f, 0.0518101f, -0.0297148f}, {0.2646616f, 0.5293232f, 0.2646616f, 0.0536629f, 0.0049836f}, {0.2746973f, 0.5493945f, 0.2746973f, 0.0556978f, 0.0430913f}, {0.2853621f, 0.5707242f, 0.2853621f, 0.0578602f, 0.0835882f}, {0.2964076f, 0.5928152f, 0.2964076f, 0.0600997f, 0.1255307f}, {0.3076143f, 0.6152286f, 0.3076143f, 0.062372f, 0.1680853f}, {0.3187965f, 0.637593f, 0.3187965f, 0.0646393f, 0.2105466f}, {0.3298032f, 0.6596065f, 0.3298032f, 0.0668711f, 0.2523419f}, {0.3405172f, 0.6810343f, 0.3405172f, 0.0690434f, 0.2930252f}, {0.3508513f, 0.7017025f, 0.3508513f, 0.0711388f, 0.3322662f}, {0.3607449f, 0.7214898f, 0.3607449f, 0.0731448f, 0.3698348f}, {0.3701596f, 0.7403193f, 0.3701596f, 0.0750537f, 0.4055848f}, {0.3790748f, 0.7581496f, 0.3790748f, 0.0768614f, 0.4394378f}, {0.3874838f, 0.7749677f, 0.3874838f, 0.0785664f, 0.4713689f}, {0.3953909f, 0.7907817f, 0.3953909f, 0.0801696f, 0.5013938f}, {0.4028079f, 0.8056158f, 0.4028079f, 0.0816735f, 0.529558f}, {0.4097524f, 0.8195049f, 0.4097524f, 0.0830816f, 0.5559282f}, {0.4162458f, 0.8324915f, 0.4162458f, 0.0843982f, 0.5805849f}, {0.4223114f, 0.8446227f, 0.4223114f, 0.0856281f, 0.6036174f}, {0.4279738f, 0.8559477f, 0.4279738f, 0.0867762f, 0.6251192f}, {0.4332582f, 0.8665164f, 0.4332582f, 0.0878476f, 0.6451852f}, {0.4381891f, 0.8763783f, 0.4381891f, 0.0888474f, 0.6639091f}, {0.4427907f, 0.8855814f, 0.4427907f, 0.0897805f, 0.6813823f}, {0.4470859f, 0.8941718f, 0.4470859f, 0.0906514f, 0.6976922f}, {0.4510966f, 0.9021933f, 0.4510966f, 0.0914646f, 0.712922f}, {0.4548436f, 0.9096872f, 0.4548436f, 0.0922243f, 0.72715f}, {0.4583461f, 0.9166921f, 0.4583461f, 0.0929345f, 0.7404498f}, {0.4616221f, 0.9232443f, 0.4616221f, 0.0935987f, 0.7528899f}, {0.4646886f, 0.9293772f, 0.4646886f, 0.0942205f, 0.7645339f}, {0.4675609f, 0.9351218f, 0.4675609f, 0.0948029f, 0.7754408f}, {0.4702535f, 0.9405071f, 0.4702535f, 0.0953488f, 0.7856653f}, {0.4727797f, 0.9455594f, 0.4727797f, 0.095861f, 0.7952577f}, {0.4751516f, 0.9503032f, 0.4751516f, 0.096342f, 0.8042645f}, {0.4773806f, 0.9547612f, 0.4773806f, 0.0967939f, 0.8127284f}, {0.479477f, 0.9589539f, 0.479477f, 0.097219f, 0.8206889f}, {0.4814503f, 0.9629006f, 0.4814503f, 0.0976191f, 0.8281822f}, {0.4833094f, 0.9666188f, 0.4833094f, 0.0979961f, 0.8352416f}, {0.4850623f, 0.9701247f, 0.4850623f, 0.0983515f, 0.8418979f}, {0.4867166f, 0.9734331f, 0.4867166f, 0.0986869f, 0.8481793f}, {0.4882789f, 0.9765578f, 0.4882789f, 0.0990037f, 0.8541119f}, {0.4897907f, 0.9795813f, 0.4897907f, 0.0993102f, 0.8598524f}, {0.4913027f, 0.9826055f, 0.4913027f, 0.0996168f, 0.8655942f}, {0.4928109f, 0.9856219f, 0.4928109f, 0.0999226f, 0.8713211f}, {0.4943101f, 0.9886202f, 0.4943101f, 0.1002266f, 0.8770139f}, {0.495795f, 0.9915899f, 0.495795f, 0.1005276f, 0.8826522f}, {0.49726f, 0.99452f, 0.49726f, 0.1008247f, 0.8882153f}, {0.4986999f, 0.9973998f, 0.4986999f, 0.1011166f, 0.893683f}, {0.5001096f, 1.0002193f, 0.5001096f, 0.1014025f, 0.899036f}, {0.5014844f, 1.0029689f, 0.5014844f, 0.1016812f, 0.9042565f}, {0.5028201f, 1.0056403f, 0.5028201f, 0.1019521f, 0.9093285f}, {0.5041131f, 1.0082262f, 0.5041131f, 0.1022142f, 0.9142382f}, {0.5053603f, 1.0107206f, 0.5053603f, 0.1024671f, 0.918974f}, {0.5065593f, 1.0131186f, 0.5065593f, 0.1027102f, 0.9235269f}, {0.5077084f, 1.0154167f, 0.5077084f, 0.1029432f, 0.9278902f}, {0.5088063f, 1.0176126f, 0.5088063f, 0.1031658f, 0.9320595f}, {0.5098526f, 1.0197052f, 0.5098526f, 0.103378f, 0.9360324f}, {0.5108471f, 1.0216942f, 0.5108471f, 0.1035796f, 0.9398089f}, {0.5117903f, 1.0235805f, 0.5117903f, 0.1037708f, 0.9433902f}, {0.5126828f, 1.0253656f, 0.5126828f, 0.1039518f, 0.9467794f}},
-          {{0.1910261f, 0.3820522f, 0.1910261f, -0.1010129f, -0.1348827f}, {0.1918699f, 0.3837397f, 0.1918699f, -0.1014591f, -0.1310614f}, {0.1943675f, 0.3887349f, 0.1943675f, -0.1027798f, -0.1197503f}, {0.1984209f, 0.3968418f, 0.1984209f, -0.1049233f, -0.1013931f}, {0.2038775f, 0.407755f, 0.2038775f, -0.1078086f, -0.0766814f}, {0.2105434f, 0.4210868f, 0.2105434f, -0.1113335f, -0.0464929f}, {0.2181998f, 0.4363996f, 0.2181998f, -0.1153821f, -0.0118188f}, {0.2266188f, 0.4532375f, 0.2266188f, -0.119834f, 0.0263091f}, {0.2355774f, 0.4711548f, 0.2355774f, -0.1245713f, 0.0668808f}, {0.2448687f, 0.4897374f, 0.2448687f, -0.1294844f, 0.1089591f}, {0.254309f, 0.508618f, 0.254309f, -0.1344764f, 0.1517124f}, {0.2637421f, 0.5274843f, 0.2637421f, -0.1394645f, 0.1944331f}, {0.2730405f, 0.546081f, 0.2730405f, -0.1443814f, 0.2365434f}, {0.2821041f, 0.5642082f, 0.2821041f, -0.1491742f, 0.2775905f}, {0.2908582f, 0.5817163f, 0.2908582f, -0.1538033f, 0.3172359f}, {0.29925f, 0.5985f, 0.29925f, -0.1582408f, 0.3552409f}, {0.3072455f, 0.6144911f, 0.3072455f, -0.1624688f, 0.391451f}, {0.3148257f, 0.6296515f, 0.3148257f, -0.1664771f, 0.4257801f}, {0.3219836f, 0.6439671f, 0.3219836f, -0.1702621f, 0.4581963f}, {0.3287211f, 0.6574423f, 0.3287211f, -0.1738249f, 0.4887094f}, {0.3350474f, 0.6700948f, 0.3350474f, -0.1771702f, 0.5173598f}, {0.3409762f, 0.6819524f, 0.3409762f, -0.1803052f, 0.5442099f}, {0.3465245f, 0.693049f, 0.3465245f, -0.1832391f, 0.5693372f}, {0.3517116f, 0.7034231f, 0.3517116f, -0.185982f, 0.5928282f}, {0.3565576f, 0.7131151f, 0.3565576f, -0.1885445f, 0.6147747f}, {0.3610831f, 0.7221663f, 0.3610831f, -0.1909376f, 0.6352701f}, {0.3653088f, 0.7306177f, 0.3653088f, -0.1931721f, 0.6544074f}, {0.3692547f, 0.7385093f, 0.3692547f, -0.1952586f, 0.6722773f}, {0.3729399f, 0.7458798f, 0.3729399f, -0.1972074f, 0.6889671f}, {0.376383f, 0.7527659f, 0.376383f, -0.199028f, 0.7045599f}, {0.3796012f, 0.7592023f, 0.3796012f, -0.2007298f, 0.7191344f}, {0.3826108f, 0.7652216f, 0.3826108f, -0.2023213f, 0.7327645f}, {0.3854271f, 0.7708543f, 0.3854271f, -0.2038105f, 0.745519f}, {0.3880643f, 0.7761286f, 0.3880643f, -0.205205f, 0.7574623f}, {0.3905355f, 0.781071f, 0.3905355f, -0.2065118f, 0.7686538f}, {0.3928529f, 0.7857059f, 0.3928529f, -0.2077372f, 0.7791489f}, {0.3950278f, 0.7900556f, 0.3950278f, -0.2088873f, 0.7889985f}, {0.3970706f, 0.7941411f, 0.3970706f, -0.2099675f, 0.7982497f}, {0.3989908f, 0.7979815f, 0.3989908f, -0.2109828f, 0.8069459f}, {0.4007973f, 0.8015945f, 0.4007973f, -0.2119381f, 0.8151271f}, {0.4024982f, 0.8049963f, 0.4024982f, -0.2128375f, 0.8228302f}, {0.404101f, 0.808202f, 0.404101f, -0.2136851f, 0.8300891f}, {0.4056127f, 0.8112253f, 0.4056127f, -0.2144844f, 0.836935f}, {0.4070395f, 0.814079f, 0.4070395f, -0.2152389f, 0.8433969f}, {0.4083873f, 0.8167747f, 0.4083873f, -0.2159517f, 0.849501f}, {0.4096919f, 0.8193837f, 0.4096919f, -0.2166415f, 0.8554089f}, {0.4109969f, 0.8219938f, 0.4109969f, -0.2173316f, 0.8613191f}, {0.4122988f, 0.8245976f, 0.4122988f, -0.21802f, 0.8672153f}, {0.4135932f, 0.8271865f, 0.4135932f, -0.2187045f, 0.8730774f}, {0.4148755f, 0.829751f, 0.4148755f, -0.2193825f, 0.8788845f}, {0.4161409f, 0.8322818f, 0.4161409f, -0.2200517f, 0.8846153f}, {0.4173848f, 0.8347697f, 0.4173848f, -0.2207095f, 0.8902488f}, {0.4186029f, 0.8372058f, 0.4186029f, -0.2213536f, 0.8957652f}, {0.4197911f, 0.8395821f, 0.4197911f, -0.2219818f, 0.9011461f}, {0.4209456f, 0.8418912f, 0.4209456f, -0.2225924f, 0.9063747f}, {0.4220634f, 0.8441267f, 0.4220634f, -0.2231834f, 0.9114369f}, {0.4231417f, 0.8462835f, 0.4231417f, -0.2237537f, 0.9163207f}, {0.4241786f, 0.8483573f, 0.4241786f, -0.224302f, 0.9210165f}, {0.4251725f, 0.850345f, 0.4251725f, -0.2248275f, 0.9255175f}, {0.4261223f, 0.8522446f, 0.4261223f, -0.2253298f, 0.929819f}, {0.4270275f, 0.854055f, 0.4270275f, -0.2258084f, 0.9339185f}, {0.427888f, 0.8557761f, 0.427888f, -0.2262635f, 0.9378157f}, {0.4287042f, 0.8574085f, 0.4287042f, -0.2266951f, 0.941512f}, {0.4294767f, 0.8589535f, 0.4294767f, -0.2271036f, 0.9450105f}},
-          {{0.1581033f, 0.3162066f, 0.1581033f, -0.229583f, -0.1380038f}, {0.1588036f, 0.3176072f, 0.1588036f, -0.2305999f, -0.1341858f}, {0.1608765f, 0.321753f, 0.1608765f, -0.23361f, -0.1228839f}, {0.1642411f, 0.3284823f, 0.1642411f, -0.2384958f, -0.1045397f}, {0.168771f, 0.337542f, 0.168771f, -0.2450737f, -0.0798423f}, {0.1743058f, 0.3486116f, 0.1743058f, -0.2531108f, -0.049666f}, {0.1806643f, 0.3613287f, 0.1806643f, -0.2623441f, -0.0149985f}, {0.1876578f, 0.3753156f, 0.1876578f, -0.2724994f, 0.0231306f}, {0.1951014f, 0.3902029f, 0.1951014f, -0.2833083f, 0.063714f}, {0.2028235f, 0.405647f, 0.2028235f, -0.2945215f, 0.1058155f}, {0.2106715f, 0.421343f, 0.2106715f, -0.3059177f, 0.1486037f}, {0.2185157f, 0.4370314f, 0.2185157f, -0.3173083f, 0.1913711f}, {0.2262499f, 0.4524998f, 0.2262499f, -0.3285392f, 0.2335388f}, {0.2337908f, 0.4675816f, 0.2337908f, -0.3394894f, 0.2746526f}, {0.2410761f, 0.4821521f, 0.2410761f, -0.3500684f, 0.3143727f}, {0.2480616f, 0.4961233f, 0.2480616f, -0.3602122f, 0.3524587f}, {0.2547188f, 0.5094377f, 0.2547188f, -0.3698792f, 0.3887546f}, {0.2610317f, 0.5220633f, 0.2610317f, -0.3790461f, 0.4231727f}, {0.266994f, 0.533988f, 0.266994f, -0.387704f, 0.45568f}, {0.2726074f, 0.5452148f, 0.2726074f, -0.3958553f, 0.4862849f}, {0.2778791f, 0.5557582f, 0.2778791f, -0.4035104f, 0.5150269f}, {0.2828205f, 0.5656409f, 0.2828205f, -0.4106858f, 0.5419676f}, {0.2874455f, 0.574891f, 0.2874455f, -0.4174018f, 0.5671839f}, {0.29177f, 0.5835401f, 0.29177f, -0.4236815f, 0.5907617f}, {0.2958108f, 0.5916217f, 0.2958108f, -0.4295492f, 0.6127925f}, {0.299585f, 0.5991699f, 0.299585f, -0.4350296f, 0.6333694f}, {0.3031094f, 0.6062189f, 0.3031094f, -0.4401475f, 0.6525853f}, {0.3064009f, 0.6128018f, 0.3064009f, -0.4449271f, 0.6705306f}, {0.3094753f, 0.6189506f, 0.3094753f, -0.4493915f, 0.6872927f}, {0.312348f, 0.6246959f, 0.312348f, -0.4535629f, 0.7029547f}, {0.3150333f, 0.6300665f, 0.3150333f, -0.4574622f, 0.7175953f}, {0.3175448f, 0.6350896f, 0.3175448f, -0.4611092f, 0.7312884f}, {0.3198952f, 0.6397904f, 0.3198952f, -0.4645222f, 0.7441029f}, {0.3220962f, 0.6441925f, 0.3220962f, -0.4677184f, 0.7561034f}, {0.3241589f, 0.6483178f, 0.3241589f, -0.4707137f, 0.7673493f}, {0.3260934f, 0.6521867f, 0.3260934f, -0.4735227f, 0.7778962f}, {0.327909f, 0.6558179f, 0.327909f, -0.4761591f, 0.787795f}, {0.3296143f, 0.6592287f, 0.3296143f, -0.4786355f, 0.7970929f}, {0.3312175f, 0.662435f, 0.3312175f, -0.4809635f, 0.8058336f}, {0.3327258f, 0.6654517f, 0.3327258f, -0.4831537f, 0.8140571f}, {0.3341461f, 0.6682922f, 0.3341461f, -0.4852161f, 0.8218004f}, {0.3354845f, 0.670969f, 0.3354845f, -0.4871596f, 0.8290975f}, {0.3367468f, 0.6734936f, 0.3367468f, -0.4889926f, 0.8359799f}, {0.3379384f, 0.6758767f, 0.3379384f, -0.4907229f, 0.8424763f}, {0.339064f, 0.678128f, 0.339064f, -0.4923574f, 0.8486134f}, {0.3401535f, 0.6803069f, 0.3401535f, -0.4939395f, 0.8545534f}, {0.3412434f, 0.6824869f, 0.3412434f, -0.4955222f, 0.8604959f}, {0.3423308f, 0.6846617f, 0.3423308f, -0.4971012f, 0.8664246f}, {0.343412f, 0.686824f, 0.343412f, -0.4986712f, 0.8723192f}, {0.3444831f, 0.6889661f, 0.3444831f, -0.5002265f, 0.8781587f}, {0.3455401f, 0.6910802f, 0.3455401f, -0.5017614f, 0.8839217f}, {0.3465792f, 0.6931584f, 0.3465792f, -0.5032703f, 0.8895872f}, {0.3475968f, 0.6951935f, 0.3475968f, -0.5047479f, 0.895135f}, {0.3485893f, 0.6971787f, 0.3485893f, -0.5061893f, 0.9005466f}, {0.3495539f, 0.6991078f, 0.3495539f, -0.5075899f, 0.9058054f}, {0.3504878f, 0.7009755f, 0.3504878f, -0.508946f, 0.910897f}, {0.3513887f, 0.7027775f, 0.3513887f, -0.5102543f, 0.9158092f}, {0.3522551f, 0.7045101f, 0.3522551f, -0.5115123f, 0.9205326f}, {0.3530855f, 0.706171f, 0.3530855f, -0.5127181f, 0.9250601f}, {0.3538791f, 0.7077582f, 0.3538791f, -0.5138706f, 0.9293869f}, {0.3546355f, 0.709271f, 0.3546355f, -0.5149689f, 0.9335108f}, {0.3553546f, 0.7107091f, 0.3553546f, -0.5160131f, 0.9374313f}, {0.3560366f, 0.7120732f, 0.3560366f, -0.5170035f, 0.9411498f}, {0.3566821f, 0.7133642f, 0.3566821f, -0.5179408f, 0.9446693f}},
-          {{0.1314327f, 0.2628654f, 0.1314327f, -0.3433483f, -0.130921f}, {0.1320112f, 0.2640224f, 0.1320112f, -0.3448596f, -0.1270956f}, {0.1337235f, 0.267447f, 0.1337235f, -0.3493327f, -0.1157733f}, {0.1365022f, 0.2730043f, 0.1365022f, -0.3565915f, -0.0973999f}, {0.140242f, 0.280484f, 0.140242f, -0.3663612f, -0.0726709f}, {0.1448096f, 0.2896193f, 0.1448096f, -0.3782935f, -0.0424679f}, {0.1500546f, 0.3001093f, 0.1500546f, -0.3919953f, -0.0077862f}, {0.1558204f, 0.3116407f, 0.1558204f, -0.4070574f, 0.0303388f}, {0.1619537f, 0.3239074f, 0.1619537f, -0.4230799f, 0.0708947f}, {0.1683127f, 0.3366254f, 0.1683127f, -0.4396917f, 0.1129425f}, {0.1747715f, 0.3495429f, 0.1747715f, -0.4565643f, 0.1556501f}, {0.1812231f, 0.3624462f, 0.1812231f, -0.4734182f, 0.1983106f}, {0.1875804f, 0.3751607f, 0.1875804f, -0.4900257f, 0.2403471f}, {0.193775f, 0.3875501f, 0.193775f, -0.5062084f, 0.2813085f}, {0.1997562f, 0.3995125f, 0.1997562f, -0.5218333f, 0.3208583f}, {0.2054882f, 0.4109764f, 0.2054882f, -0.5368072f, 0.3587599f}, {0.2109478f, 0.4218955f, 0.2109478f, -0.5510695f, 0.3948606f}, {0.2161223f, 0.4322445f, 0.2161223f, -0.5645871f, 0.4290762f}, {0.2210071f, 0.4420143f, 0.2210071f, -0.5773481f, 0.4613767f}, {0.2256041f, 0.4512081f, 0.2256041f, -0.5893569f, 0.4917731f}, {0.2299193f, 0.4598386f, 0.2299193f, -0.6006299f, 0.5203071f}, {0.2339625f, 0.4679251f, 0.2339625f, -0.6111921f, 0.5470423f}, {0.2377455f, 0.475491f, 0.2377455f, -0.6210746f, 0.5720567f}, {0.2412815f, 0.4825629f, 0.2412815f, -0.6303118f, 0.5954376f}, {0.2445843f, 0.4891686f, 0.2445843f, -0.63894f, 0.6172772f}, {0.2476683f, 0.4953365f, 0.2476683f, -0.6469963f, 0.6376694f}, {0.2505474f, 0.5010948f, 0.2505474f, -0.6545176f, 0.6567072f}, {0.2532355f, 0.5064709f, 0.2532355f, -0.6615398f, 0.6744816f}, {0.2557456f, 0.5114913f, 0.2557456f, -0.6680973f, 0.6910798f}, {0.2580905f, 0.5161811f, 0.2580905f, -0.674223f, 0.7065851f}, {0.260282f, 0.5205641f, 0.260282f, -0.6799479f, 0.7210761f}, {0.2623313f, 0.5246626f, 0.2623313f, -0.6853013f, 0.7346265f}, {0.2642487f, 0.5284974f, 0.2642487f, -0.6903103f, 0.7473051f}, {0.266044f, 0.532088f, 0.266044f, -0.6950002f, 0.7591761f}, {0.2677261f, 0.5354522f, 0.2677261f, -0.6993945f, 0.7702989f}, {0.2693034f, 0.5386068f, 0.2693034f, -0.7035149f, 0.7807286f}, {0.2707836f, 0.5415672f, 0.2707836f, -0.7073817f, 0.790516f}, {0.2721737f, 0.5443475f, 0.2721737f, -0.7110132f, 0.7997081f}, {0.2734804f, 0.5469608f, 0.2734804f, -0.7144266f, 0.8083482f}, {0.2747096f, 0.5494191f, 0.2747096f, -0.7176377f, 0.816476f}, {0.2758669f, 0.5517337f, 0.2758669f, -0.7206609f, 0.8241283f}, {0.2769573f, 0.5539147f, 0.2769573f, -0.7235096f, 0.831339f}, {0.2779857f, 0.5559714f, 0.2779857f, -0.7261961f, 0.838139f}, {0.2789563f, 0.5579127f, 0.2789563f, -0.7287318f, 0.8445572f}, {0.2798732f, 0.5597464f, 0.2798732f, -0.7311269f, 0.8506198f}, {0.2807605f, 0.5615211f, 0.2807605f, -0.733445f, 0.8564871f}, {0.2816482f, 0.5632964f, 0.2816482f, -0.7357638f, 0.8623566f}, {0.2825337f, 0.5650674f, 0.2825337f, -0.738077f, 0.8682117f}, {0.283414f, 0.566828f, 0.283414f, -0.7403768f, 0.8740328f}, {0.284286f, 0.5685721f, 0.284286f, -0.7426548f, 0.879799f}, {0.2851466f, 0.5702932f, 0.2851466f, -0.7449028f, 0.8854891f}, {0.2859925f, 0.571985f, 0.2859925f, -0.7471126f, 0.8910825f}, {0.2868207f, 0.5736415f, 0.2868207f, -0.7492763f, 0.8965593f}, {0.2876286f, 0.5752572f, 0.2876286f, -0.7513868f, 0.9019012f}, {0.2884136f, 0.5768272f, 0.2884136f, -0.7534375f, 0.9070919f}, {0.2891736f, 0.5783472f, 0.2891736f, -0.7554228f, 0.9121171f}, {0.2899067f, 0.5798135f, 0.2899067f, -0.757338f, 0.916965f}, {0.2906117f, 0.5812233f, 0.2906117f, -0.7591795f, 0.9216262f}, {0.2912873f, 0.5825746f, 0.2912873f, -0.7609445f, 0.9260938f}, {0.291933f, 0.5838659f, 0.291933f, -0.7626313f, 0.9303631f}, {0.2925483f, 0.5850966f, 0.2925483f, -0.7642387f, 0.9344319f}, {0.2931333f, 0.5862665f, 0.2931333f, -0.7657668f, 0.9382998f}, {0.293688f, 0.5873761f, 0.293688f, -0.7672161f, 0.9419682f}, {0.2942131f, 0.5884262f, 0.2942131f, -0.7685878f, 0.9454402f}},
-          {{0.1096105f, 0.219221f, 0.1096105f, -0.445736f, -0.1158219f}, {0.1100865f, 0.220173f, 0.1100865f, -0.4476717f, -0.1119823f}, {0.111495f, 0.2229901f, 0.111495f, -0.4533995f, -0.1006203f}, {0.1137797f, 0.2275594f, 0.1137797f, -0.4626902f, -0.0821911f}, {0.1168526f, 0.2337052f, 0.1168526f, -0.4751863f, -0.0574033f}, {0.1206026f, 0.2412051f, 0.1206026f, -0.4904357f, -0.0271541f}, {0.1249043f, 0.2498087f, 0.1249043f, -0.507929f, 0.0075463f}, {0.1296279f, 0.2592558f, 0.1296279f, -0.5271376f, 0.0456491f}, {0.1346466f, 0.2692932f, 0.1346466f, -0.5475463f, 0.0861326f}, {0.1398433f, 0.2796866f, 0.1398433f, -0.5686791f, 0.1280523f}, {0.1451148f, 0.2902295f, 0.1451148f, -0.5901156f, 0.1705746f}, {0.1503735f, 0.300747f, 0.1503735f, -0.6115005f, 0.2129945f}, {0.1555486f, 0.3110973f, 0.1555486f, -0.6325454f, 0.25474f}, {0.160585f, 0.32117f, 0.160585f, -0.6530261f, 0.2953662f}, {0.1654419f, 0.3308837f, 0.1654419f, -0.6727767f, 0.3345442f}, {0.1700908f, 0.3401816f, 0.1700908f, -0.6916818f, 0.372045f}, {0.1745139f, 0.3490277f, 0.1745139f, -0.7096684f, 0.4077238f}, {0.1787015f, 0.357403f, 0.1787015f, -0.7266975f, 0.4415034f}, {0.1826507f, 0.3653014f, 0.1826507f, -0.7427571f, 0.4733599f}, {0.1863636f, 0.3727271f, 0.1863636f, -0.7578557f, 0.5033099f}, {0.1898458f, 0.3796916f, 0.1898458f, -0.7720164f, 0.5313997f}, {0.1931058f, 0.3862116f, 0.1931058f, -0.7852733f, 0.5576964f}, {0.1961535f, 0.3923071f, 0.1961535f, -0.7976671f, 0.5822813f}, {0.1990002f, 0.3980004f, 0.1990002f, -0.8092431f, 0.6052439f}, {0.2016574f, 0.4033147f, 0.2016574f, -0.8200486f, 0.626678f}, {0.2041368f, 0.4082736f, 0.2041368f, -0.8301314f, 0.6466787f}, {0.2064502f, 0.4129004f, 0.2064502f, -0.839539f, 0.6653399f}, {0.2086089f, 0.4172178f, 0.2086089f, -0.8483173f, 0.6827529f}, {0.2106237f, 0.4212473f, 0.2106237f, -0.8565105f, 0.6990052f}, {0.2125049f, 0.4250097f, 0.2125049f, -0.8641605f, 0.71418f}, {0.2142622f, 0.4285244f, 0.2142622f, -0.8713067f, 0.7283555f}, {0.2159048f, 0.4318095f, 0.2159048f, -0.8779863f, 0.7416054f}, {0.217441f, 0.4348821f, 0.217441f, -0.8842337f, 0.7539978f}, {0.2188789f, 0.4377579f, 0.2188789f, -0.8900809f, 0.7655966f}, {0.2202257f, 0.4404514f, 0.2202257f, -0.8955577f, 0.7764606f}, {0.2214882f, 0.4429763f, 0.2214882f, -0.9006915f, 0.7866442f}, {0.2226725f, 0.445345f, 0.2226725f, -0.9055077f, 0.7961978f}, {0.2237845f, 0.447569f, 0.2237845f, -0.9100297f, 0.8051677f}, {0.2248294f, 0.4496589f, 0.2248294f, -0.9142789f, 0.8135966f}, {0.2258122f, 0.4516243f, 0.2258122f, -0.9182752f, 0.8215238f}, {0.2267372f, 0.4534744f, 0.2267372f, -0.9220368f, 0.8289855f}, {0.2276086f, 0.4552172f, 0.2276086f, -0.9255805f, 0.8360149f}, {0.2284302f, 0.4568605f, 0.2284302f, -0.9289217f, 0.8426426f}, {0.2292056f, 0.4584111f, 0.2292056f, -0.9320746f, 0.8488969f}, {0.2299378f, 0.4598756f, 0.2299378f, -0.9350523f, 0.8548036f}, {0.2306463f, 0.4612927f, 0.2306463f, -0.9379336f, 0.860519f}, {0.231355f, 0.46271f, 0.231355f, -0.9408154f, 0.8662354f}, {0.2320618f, 0.4641236f, 0.2320618f, -0.9436897f, 0.8719369f}, {0.2327644f, 0.4655288f, 0.2327644f, -0.9465467f, 0.8776042f}, {0.2334602f, 0.4669204f, 0.2334602f, -0.9493763f, 0.8832171f}, {0.2341467f, 0.4682935f, 0.2341467f, -0.9521681f, 0.888755f}, {0.2348215f, 0.4696429f, 0.2348215f, -0.9549119f, 0.8941978f}, {0.235482f, 0.4709641f, 0.235482f, -0.9575982f, 0.8995263f}, {0.2361262f, 0.4722525f, 0.2361262f, -0.9602178f, 0.9047227f}, {0.2367521f, 0.4735042f, 0.2367521f, -0.9627629f, 0.9097712f}, {0.2373579f, 0.4747158f, 0.2373579f, -0.9652264f, 0.9146579f}, {0.2379422f, 0.4758845f, 0.2379422f, -0.9676027f, 0.9193716f}, {0.238504f, 0.477008f, 0.238504f, -0.9698871f, 0.923903f}, {0.2390423f, 0.4780847f, 0.2390423f, -0.9720763f, 0.9282457f}, {0.2395567f, 0.4791135f, 0.2395567f, -0.9741681f, 0.9323951f}, {0.2400469f, 0.4800938f, 0.2400469f, -0.9761614f, 0.9363491f}, {0.2405128f, 0.4810256f, 0.2405128f, -0.9780561f, 0.9401074f}, {0.2409547f, 0.4819093f, 0.2409547f, -0.9798528f, 0.9436714f}, {0.2413728f, 0.4827456f, 0.2413728f, -0.9815531f, 0.9470443f}},
-          {{0.0916141f, 0.1832283f, 0.0916141f, -0.5392706f, -0.0942728f}, {0.0920043f, 0.1840085f, 0.0920043f, -0.541567f, -0.0904159f}, {0.0931583f, 0.1863166f, 0.0931583f, -0.5483601f, -0.0790066f}, {0.095029f, 0.190058f, 0.095029f, -0.5593715f, -0.0605125f}, {0.0975427f, 0.1950854f, 0.0975427f, -0.5741681f, -0.035661f}, {0.1006066f, 0.2012132f, 0.1006066f, -0.5922032f, -0.0053703f}, {0.1041164f, 0.2082328f, 0.1041164f, -0.6128629f, 0.0293284f}, {0.1079642f, 0.2159284f, 0.1079642f, -0.6355123f, 0.067369f}, {0.1120454f, 0.2240908f, 0.1120454f, -0.6595357f, 0.1077174f}, {0.1162639f, 0.2325277f, 0.1162639f, -0.6843669f, 0.1494224f}, {0.1205351f, 0.2410702f, 0.1205351f, -0.7095088f, 0.1916493f}, {0.1247882f, 0.2495765f, 0.1247882f, -0.7345441f, 0.233697f}, {0.1289661f, 0.2579322f, 0.1289661f, -0.7591363f, 0.2750006f}, {0.1330247f, 0.2660494f, 0.1330247f, -0.7830265f, 0.3151253f}, {0.1369318f, 0.2738637f, 0.1369318f, -0.8060253f, 0.3537527f}, {0.1406656f, 0.2813311f, 0.1406656f, -0.8280031f, 0.3906653f}, {0.1442122f, 0.2884245f, 0.1442122f, -0.84888f, 0.425729f}, {0.1475651f, 0.2951302f, 0.1475651f, -0.868616f, 0.4588764f}, {0.1507226f, 0.3014452f, 0.1507226f, -0.8872021f, 0.4900925f}, {0.1536872f, 0.3073743f, 0.1536872f, -0.9046526f, 0.5194013f}, {0.1564641f, 0.3129283f, 0.1564641f, -0.9209988f, 0.5468553f}, {0.1590608f, 0.3181216f, 0.1590608f, -0.9362836f, 0.5725269f}, {0.1614858f, 0.3229716f, 0.1614858f, -0.9505578f, 0.596501f}, {0.1637484f, 0.3274969f, 0.1637484f, -0.9638764f, 0.6188702f}, {0.1658584f, 0.3317169f, 0.1658584f, -0.9762967f, 0.6397305f}, {0.1678256f, 0.3356512f, 0.1678256f, -0.987876f, 0.6591784f}, {0.1696595f, 0.339319f, 0.1696595f, -0.9986708f, 0.6773088f}, {0.1713694f, 0.3427388f, 0.1713694f, -1.0087358f, 0.6942133f}, {0.1729641f, 0.3459283f, 0.1729641f, -1.0181231f, 0.7099797f}, {0.1744522f, 0.3489043f, 0.1744522f, -1.0268822f, 0.7246908f}, {0.1758413f, 0.3516827f, 0.1758413f, -1.0350593f, 0.7384247f}, {0.177139f, 0.3542781f, 0.177139f, -1.0426979f, 0.751254f}, {0.1783521f, 0.3567042f, 0.1783521f, -1.0498383f, 0.7632467f}, {0.1794869f, 0.3589737f, 0.1794869f, -1.056518f, 0.7744654f}, {0.1805492f, 0.3610985f, 0.1805492f, -1.0627715f, 0.7849684f}, {0.1815446f, 0.3630893f, 0.1815446f, -1.0686307f, 0.7948092f}, {0.1824781f, 0.3649561f, 0.1824781f, -1.0741251f, 0.8040373f}, {0.1833541f, 0.3667082f, 0.1833541f, -1.0792818f, 0.8126982f}, {0.184177f, 0.368354f, 0.184177f, -1.0841256f, 0.8208336f}, {0.1849506f, 0.3699013f, 0.1849506f, -1.0886796f, 0.8284822f}, {0.1856786f, 0.3713572f, 0.1856786f, -1.0929647f, 0.8356792f}, {0.1863642f, 0.3727284f, 0.1863642f, -1.0970003f, 0.8424571f}, {0.1870104f, 0.3740209f, 0.1870104f, -1.1008042f, 0.8488459f}, {0.1876201f, 0.3752402f, 0.1876201f, -1.1043927f, 0.854873f}, {0.1881957f, 0.3763914f, 0.1881957f, -1.107781f, 0.8605637f}, {0.1887525f, 0.3775051f, 0.1887525f, -1.1110587f, 0.8660688f}, {0.1893093f, 0.3786186f, 0.1893093f, -1.1143362f, 0.8715734f}, {0.1898645f, 0.3797291f, 0.1898645f, -1.1176043f, 0.8770624f}, {0.1904163f, 0.3808326f, 0.1904163f, -1.1208521f, 0.8825172f}, {0.1909626f, 0.3819252f, 0.1909626f, -1.1240678f, 0.8879182f}, {0.1915015f, 0.383003f, 0.1915015f, -1.1272399f, 0.8932458f}, {0.192031f, 0.384062f, 0.192031f, -1.1303568f, 0.8984807f}, {0.1925493f, 0.3850985f, 0.1925493f, -1.1334074f, 0.9036045f}, {0.1930546f, 0.3861091f, 0.1930546f, -1.1363819f, 0.9086001f}, {0.1935454f, 0.3870907f, 0.1935454f, -1.1392709f, 0.9134524f}, {0.1940204f, 0.3880407f, 0.1940204f, -1.1420669f, 0.9181484f}, {0.1944784f, 0.3889569f, 0.1944784f, -1.1447633f, 0.922677f}, {0.1949187f, 0.3898374f, 0.1949187f, -1.1473549f, 0.9270298f}, {0.1953406f, 0.3906811f, 0.1953406f, -1.1498381f, 0.9312003f}, {0.1957436f, 0.3914872f, 0.1957436f, -1.1522103f, 0.9351846f}, {0.1961275f, 0.3922551f, 0.1961275f, -1.1544705f, 0.9389806f}, {0.1964924f, 0.3929849f, 0.1964924f, -1.1566184f, 0.9425882f}, {0.1968384f, 0.3936769f, 0.1968384f, -1.158655f, 0.9460087f}, {0.1971658f, 0.3943316f, 0.1971658f, -1.160582f, 0.9492452f}},
-          {{0.0766808f, 0.1533616f, 0.0766808f, -0.6258255f, -0.0674513f}, {0.0769993f, 0.1539986f, 0.0769993f, -0.6284249f, -0.0635779f}, {0.0779411f, 0.1558822f, 0.0779411f, -0.6361111f, -0.0521246f}, {0.0794664f, 0.1589329f, 0.0794664f, -0.6485601f, -0.0335742f}, {0.0815137f, 0.1630274f, 0.0815137f, -0.665269f, -0.0086761f}, {0.0840054f, 0.1680108f, 0.0840054f, -0.6856045f, 0.021626f}, {0.0868546f, 0.1737093f, 0.0868546f, -0.7088585f, 0.056277f}, {0.0899722f, 0.1799444f, 0.0899722f, -0.7343022f, 0.094191f}, {0.0932719f, 0.1865438f, 0.0932719f, -0.7612325f, 0.13432f}, {0.096675f, 0.19335f, 0.096675f, -0.7890068f, 0.1757069f}, {0.100113f, 0.2002259f, 0.100113f, -0.8170654f, 0.2175172f}, {0.1035286f, 0.2070571f, 0.1035286f, -0.8449417f, 0.259056f}, {0.1068762f, 0.2137525f, 0.1068762f, -0.8722636f, 0.2997686f}, {0.1101213f, 0.2202426f, 0.1101213f, -0.8987477f, 0.3392329f}, {0.1132387f, 0.2264773f, 0.1132387f, -0.92419f, 0.3771446f}, {0.1162116f, 0.2324232f, 0.1162116f, -0.9484537f, 0.4133002f}, {0.1190302f, 0.2380605f, 0.1190302f, -0.9714577f, 0.4475787f}, {0.12169f, 0.24338f, 0.12169f, -0.993165f, 0.479925f}, {0.1241905f, 0.2483809f, 0.1241905f, -1.0135725f, 0.5103344f}, {0.1265344f, 0.2530688f, 0.1265344f, -1.0327022f, 0.5388398f}, {0.1287267f, 0.2574533f, 0.1287267f, -1.0505943f, 0.565501f}, {0.1307737f, 0.2615474f, 0.1307737f, -1.0673011f, 0.5903959f}, {0.1326829f, 0.2653657f, 0.1326829f, -1.0828826f, 0.6136141f}, {0.134462f, 0.2689241f, 0.134462f, -1.0974032f, 0.6352513f}, {0.1361193f, 0.2722386f, 0.1361193f, -1.1109287f, 0.6554059f}, {0.1376627f, 0.2753254f, 0.1376627f, -1.123525f, 0.6741757f}, {0.1391001f, 0.2782001f, 0.1391001f, -1.1352563f, 0.6916566f}, {0.140439f, 0.2808781f, 0.140439f, -1.1461842f, 0.7079404f}, {0.1416868f, 0.2833736f, 0.1416868f, -1.1563675f, 0.7231147f}, {0.1428501f, 0.2857001f, 0.1428501f, -1.1658616f, 0.7372619f}, {0.1439353f, 0.2878705f, 0.1439353f, -1.1747183f, 0.7504594f}, {0.1449483f, 0.2898965f, 0.1449483f, -1.182986f, 0.762779f}, {0.1458946f, 0.2917892f, 0.1458946f, -1.1907093f, 0.7742876f}, {0.1467793f, 0.2935586f, 0.1467793f, -1.1979298f, 0.785047f}, {0.1476071f, 0.2952142f, 0.1476071f, -1.2046857f, 0.7951141f}, {0.1483823f, 0.2967645f, 0.1483823f, -1.2110124f, 0.8045415f}, {0.1491088f, 0.2982177f, 0.1491088f, -1.2169421f, 0.8133774f}, {0.1497904f, 0.2995808f, 0.1497904f, -1.2225046f, 0.8216662f}, {0.1504303f, 0.3008607f, 0.1504303f, -1.2277275f, 0.8294488f}, {0.1510317f, 0.3020634f, 0.1510317f, -1.2326357f, 0.8367625f}, {0.1515974f, 0.3031948f, 0.1515974f, -1.2372523f, 0.8436418f}, {0.1521299f, 0.3042598f, 0.1521299f, -1.2415985f, 0.8501181f}, {0.1526317f, 0.3052634f, 0.1526317f, -1.2456937f, 0.8562205f}, {0.1531049f, 0.3062098f, 0.1531049f, -1.2495559f, 0.8619755f}, {0.1535516f, 0.3071032f, 0.1535516f, -1.2532013f, 0.8674076f}, {0.1539835f, 0.3079671f, 0.1539835f, -1.2567268f, 0.8726609f}, {0.1544154f, 0.3088307f, 0.1544154f, -1.260251f, 0.8779124f}, {0.1548458f, 0.3096916f, 0.1548458f, -1.2637641f, 0.8831474f}, {0.1552735f, 0.3105469f, 0.1552735f, -1.2672543f, 0.8883482f}, {0.1556968f, 0.3113936f, 0.1556968f, -1.2707092f, 0.8934963f}, {0.1561142f, 0.3122284f, 0.1561142f, -1.2741161f, 0.898573f}, {0.1565243f, 0.3130486f, 0.1565243f, -1.2774628f, 0.90356f}, {0.1569255f, 0.3138511f, 0.1569255f, -1.2807376f, 0.9084397f}, {0.1573166f, 0.3146333f, 0.1573166f, -1.2839296f, 0.9131962f}, {0.1576964f, 0.3153929f, 0.1576964f, -1.2870293f, 0.9178151f}, {0.1580639f, 0.3161278f, 0.1580639f, -1.2900283f, 0.9222839f}, {0.1584182f, 0.3168364f, 0.1584182f, -1.2929198f, 0.9265925f}, {0.1587586f, 0.3175172f, 0.1587586f, -1.2956983f, 0.9307328f}, {0.1590847f, 0.3181695f, 0.1590847f, -1.2983599f, 0.9346989f}, {0.1593962f, 0.3187925f, 0.1593962f, -1.3009021f, 0.938487f}, {0.1596929f, 0.3193859f, 0.1596929f, -1.3033236f, 0.9420954f}, {0.1599749f, 0.3199497f, 0.1599749f, -1.3056245f, 0.9455239f}, {0.1602421f, 0.3204842f, 0.1602421f, -1.3078057f, 0.9487742f}, {0.160495f, 0.3209899f, 0.160495f, -1.3098692f, 0.9518491f}},
-          {{0.0642298f, 0.1284597f, 0.0642298f, -0.7067939f, -0.0362867f}, {0.0644888f, 0.1289776f, 0.0644888f, -0.7096436f, -0.0324012f}, {0.0652542f, 0.1305083f, 0.0652542f, -0.7180658f, -0.0209176f}, {0.0664926f, 0.1329853f, 0.0664926f, -0.7316939f, -0.0023356f}, {0.0681526f, 0.1363052f, 0.0681526f, -0.7499606f, 0.0225711f}, {0.0701694f, 0.1403388f, 0.0701694f, -0.7721537f, 0.0528314f}, {0.072471f, 0.144942f, 0.072471f, -0.7974806f, 0.0873645f}, {0.0749836f, 0.1499672f, 0.0749836f, -0.8251296f, 0.125064f}, {0.0776365f, 0.1552731f, 0.0776365f, -0.8543231f, 0.1648693f}, {0.0803657f, 0.1607314f, 0.0803657f, -0.8843553f, 0.2058181f}, {0.0831157f, 0.1662314f, 0.0831157f, -0.9146165f, 0.2470793f}, {0.0858408f, 0.1716815f, 0.0858408f, -0.9446034f, 0.2879665f}, {0.0885048f, 0.1770097f, 0.0885048f, -0.9739192f, 0.3279385f}, {0.0910808f, 0.1821616f, 0.0910808f, -1.0022656f, 0.3665888f}, {0.0935495f, 0.1870991f, 0.0935495f, -1.0294318f, 0.4036299f}, {0.0958985f, 0.191797f, 0.0958985f, -1.0552804f, 0.4388745f}, {0.0981207f, 0.1962415f, 0.0981207f, -1.0797339f, 0.4722168f}, {0.1002134f, 0.2004268f, 0.1002134f, -1.1027616f, 0.5036152f}, {0.1021769f, 0.2043538f, 0.1021769f, -1.1243687f, 0.5330764f}, {0.1040142f, 0.2080284f, 0.1040142f, -1.1445863f, 0.560643f}, {0.1057297f, 0.2114594f, 0.1057297f, -1.1634638f, 0.5863825f}, {0.107329f, 0.214658f, 0.107329f, -1.1810628f, 0.6103788f}, {0.1088184f, 0.2176368f, 0.1088184f, -1.1974523f, 0.6327258f}, {0.1102045f, 0.2204089f, 0.1102045f, -1.2127048f, 0.6535226f}, {0.1114939f, 0.2229878f, 0.1114939f, -1.226894f, 0.6728695f}, {0.1126933f, 0.2253866f, 0.1126933f, -1.2400926f, 0.6908658f}, {0.1138091f, 0.2276183f, 0.1138091f, -1.2523711f, 0.7076076f}, {0.1148475f, 0.2296949f, 0.1148475f, -1.263797f, 0.7231869f}, {0.1158141f, 0.2316282f, 0.1158141f, -1.2744342f, 0.7376907f}, {0.1167145f, 0.2334291f, 0.1167145f, -1.2843426f, 0.7512007f}, {0.1175538f, 0.2351076f, 0.1175538f, -1.293578f, 0.7637932f}, {0.1183366f, 0.2366733f, 0.1183366f, -1.3021924f, 0.775539f}, {0.1190674f, 0.2381348f, 0.1190674f, -1.3102339f, 0.7865035f}, {0.1197501f, 0.2395003f, 0.1197501f, -1.3177467f, 0.7967473f}, {0.1203885f, 0.2407771f, 0.1203885f, -1.3247717f, 0.8063259f}, {0.120986f, 0.241972f, 0.120986f, -1.3313464f, 0.8152904f}, {0.1215457f, 0.2430914f, 0.1215457f, -1.3375052f, 0.8236879f}, {0.1220704f, 0.2441409f, 0.1220704f, -1.3432796f, 0.8315613f}, {0.1225629f, 0.2451258f, 0.1225629f, -1.3486987f, 0.8389503f}, {0.1230255f, 0.2460509f, 0.1230255f, -1.353789f, 0.8458909f}, {0.1234604f, 0.2469208f, 0.1234604f, -1.3585748f, 0.8524164f}, {0.1238697f, 0.2477393f, 0.1238697f, -1.3630785f, 0.8585571f}, {0.1242551f, 0.2485103f, 0.1242551f, -1.3673205f, 0.8643411f}, {0.1246186f, 0.2492371f, 0.1246186f, -1.3713196f, 0.8697939f}, {0.1249615f, 0.2499229f, 0.1249615f, -1.375093f, 0.8749389f}, {0.125293f, 0.250586f, 0.125293f, -1.3787411f, 0.8799131f}, {0.1256243f, 0.2512486f, 0.1256243f, -1.3823867f, 0.8848838f}, {0.1259544f, 0.2519089f, 0.1259544f, -1.3860197f, 0.8898374f}, {0.1262823f, 0.2525646f, 0.1262823f, -1.3896278f, 0.8947571f}, {0.1266068f, 0.2532136f, 0.1266068f, -1.3931983f, 0.8996254f}, {0.1269267f, 0.2538533f, 0.1269267f, -1.3967181f, 0.9044247f}, {0.1272408f, 0.2544815f, 0.1272408f, -1.4001747f, 0.9091377f}, {0.127548f, 0.2550961f, 0.127548f, -1.4035559f, 0.9137481f}, {0.1278475f, 0.2556949f, 0.1278475f, -1.4068508f, 0.9182406f}, {0.1281381f, 0.2562763f, 0.1281381f, -1.4100494f, 0.9226019f}, {0.1284193f, 0.2568386f, 0.1284193f, -1.4131433f, 0.9268204f}, {0.1286903f, 0.2573806f, 0.1286903f, -1.4161254f, 0.9308865f}, {0.1289506f, 0.2579013f, 0.1289506f, -1.4189903f, 0.9347928f}, {0.1292f, 0.2583999f, 0.1292f, -1.421734f, 0.9385338f}, {0.1294381f, 0.2588761f, 0.1294381f, -1.424354f, 0.9421062f}, {0.1296648f, 0.2593296f, 0.1296648f, -1.426849f, 0.9455082f}, {0.1298802f, 0.2597604f, 0.1298802f, -1.4292193f, 0.94874f}, {0.1300843f, 0.2601687f, 0.1300843f, -1.4314658f, 0.9518031f}, {0.1302774f, 0.2605549f, 0.1302774f, -1.4335907f, 0.9547004f}},
-          {{0.0538112f, 0.1076224f, 0.0538112f, -0.7832074f, -0.0015478f}, {0.0540209f, 0.1080417f, 0.0540209f, -0.7862589f, 0.0023423f}, {0.0546402f, 0.1092803f, 0.0546402f, -0.7952727f, 0.0138334f}, {0.0556412f, 0.1112825f, 0.0556412f, -0.809843f, 0.0324079f}, {0.056981f, 0.113962f, 0.056981f, -0.829343f, 0.057267f}, {0.0586056f, 0.1172113f, 0.0586056f, -0.8529893f, 0.0874118f}, {0.0604555f, 0.120911f, 0.0604555f, -0.8799138f, 0.1217359f}, {0.06247f, 0.12494f, 0.06247f, -0.9092336f, 0.1591135f}, {0.0645913f, 0.1291825f, 0.0645913f, -0.9401083f, 0.1984733f}, {0.0667674f, 0.1335348f, 0.0667674f, -0.9717815f, 0.2388511f}, {0.0689539f, 0.1379079f, 0.0689539f, -1.0036059f, 0.2794217f}, {0.0711145f, 0.1422291f, 0.0711145f, -1.0350528f, 0.3195109f}, {0.0732209f, 0.1464418f, 0.0732209f, -1.0657104f, 0.358594f}, {0.0752521f, 0.1505042f, 0.0752521f, -1.0952743f, 0.3962828f}, {0.0771937f, 0.1543875f, 0.0771937f, -1.1235339f, 0.4323088f}, {0.0790366f, 0.1580732f, 0.0790366f, -1.1503563f, 0.4665027f}, {0.0807759f, 0.1615518f, 0.0807759f, -1.1756715f, 0.4987752f}, {0.0824102f, 0.1648204f, 0.0824102f, -1.1994581f, 0.5290989f}, {0.0839405f, 0.1678809f, 0.0839405f, -1.2217309f, 0.5574928f}, {0.0853696f, 0.1707391f, 0.0853696f, -1.2425308f, 0.584009f}, {0.0867015f, 0.173403f, 0.0867015f, -1.2619168f, 0.6087228f}, {0.0879411f, 0.1758823f, 0.0879411f, -1.2799594f, 0.6317239f}, {0.0890937f, 0.1781875f, 0.0890937f, -1.2967354f, 0.6531104f}, {0.0901648f, 0.1803297f, 0.0901648f, -1.3123248f, 0.6729841f}, {0.0911599f, 0.1823198f, 0.0911599f, -1.3268075f, 0.6914471f}, {0.0920843f, 0.1841686f, 0.0920843f, -1.3402622f, 0.7085994f}, {0.0929433f, 0.1858865f, 0.0929433f, -1.3527642f, 0.7245372f}, {0.0937417f, 0.1874834f, 0.0937417f, -1.3643853f, 0.7393522f}, {0.0944843f, 0.1889686f, 0.0944843f, -1.3751932f, 0.7531303f}, {0.0951753f, 0.1903506f, 0.0951753f, -1.385251f, 0.7659522f}, {0.0958188f, 0.1916377f, 0.0958188f, -1.3946174f, 0.7778928f}, {0.0964186f, 0.1928372f, 0.0964186f, -1.4033469f, 0.7890213f}, {0.0969781f, 0.1939561f, 0.0969781f, -1.4114895f, 0.7994017f}, {0.0975004f, 0.1950007f, 0.0975004f, -1.4190913f, 0.8090927f}, {0.0979884f, 0.1959768f, 0.0979884f, -1.4261948f, 0.8181484f}, {0.0984449f, 0.1968898f, 0.0984449f, -1.4328387f, 0.8266182f}, {0.0988722f, 0.1977445f, 0.0988722f, -1.4390587f, 0.8345476f}, {0.0992727f, 0.1985454f, 0.0992727f, -1.4448874f, 0.8419782f}, {0.0996483f, 0.1992967f, 0.0996483f, -1.4503545f, 0.8489478f}, {0.100001f, 0.200002f, 0.100001f, -1.4554875f, 0.8554914f}, {0.1003324f, 0.2006648f, 0.1003324f, -1.4603112f, 0.8616409f}, {0.1006442f, 0.2012883f, 0.1006442f, -1.4648486f, 0.8674253f}, {0.1009377f, 0.2018754f, 0.1009377f, -1.4691207f, 0.8728714f}, {0.1012143f, 0.2024286f, 0.1012143f, -1.4731466f, 0.8780038f}, {0.1014752f, 0.2029504f, 0.1014752f, -1.476944f, 0.8828447f}, {0.1017273f, 0.2034547f, 0.1017273f, -1.4806139f, 0.8875233f}, {0.1019792f, 0.2039585f, 0.1019792f, -1.4842802f, 0.8921971f}, {0.1022302f, 0.2044603f, 0.1022302f, -1.4879325f, 0.8968532f}, {0.1024793f, 0.2049586f, 0.1024793f, -1.4915587f, 0.9014759f}, {0.1027258f, 0.2054515f, 0.1027258f, -1.4951458f, 0.9060488f}, {0.1029686f, 0.2059373f, 0.1029686f, -1.4986809f, 0.9105555f}, {0.1032071f, 0.2064142f, 0.1032071f, -1.5021513f, 0.9149797f}, {0.1034403f, 0.2068805f, 0.1034403f, -1.5055451f, 0.9193061f}, {0.1036674f, 0.2073348f, 0.1036674f, -1.5088511f, 0.9235207f}, {0.1038878f, 0.2077757f, 0.1038878f, -1.5120596f, 0.927611f}, {0.104101f, 0.208202f, 0.104101f, -1.5151621f, 0.9315662f}, {0.1043064f, 0.2086128f, 0.1043064f, -1.5181518f, 0.9353774f}, {0.1045037f, 0.2090074f, 0.1045037f, -1.5210231f, 0.9390379f}, {0.1046926f, 0.2093852f, 0.1046926f, -1.5237723f, 0.9425426f}, {0.1048729f, 0.2097458f, 0.1048729f, -1.5263969f, 0.9458885f}, {0.1050446f, 0.2100892f, 0.1050446f, -1.5288957f, 0.9490741f}, {0.1052077f, 0.2104153f, 0.1052077f, -1.531269f, 0.9520996f}, {0.1053622f, 0.2107243f, 0.1053622f, -1.533518f, 0.9549666f}, {0.1055083f, 0.2110166f, 0.1055083f, -1.5356447f, 0.9576779f}},
-          {{0.0450705f, 0.090141f, 0.0450705f, -0.8558208f, 0.0361029f}, {0.0452395f, 0.090479f, 0.0452395f, -0.8590294f, 0.0399874f}, {0.0457383f, 0.0914767f, 0.0457383f, -0.8685018f, 0.0514551f}, {0.0465438f, 0.0930876f, 0.0465438f, -0.883796f, 0.0699711f}, {0.04762f, 0.09524f, 0.04762f, -0.9042314f, 0.0947114f}, {0.0489223f, 0.0978447f, 0.0489223f, -0.9289609f, 0.1246502f}, {0.0504016f, 0.1008033f, 0.0504016f, -0.9570507f, 0.1586573f}, {0.0520082f, 0.1040165f, 0.0520082f, -0.9875575f, 0.1955905f}, {0.0536952f, 0.1073904f, 0.0536952f, -1.0195899f, 0.2343707f}, {0.0554206f, 0.1108412f, 0.0554206f, -1.0523531f, 0.2740355f}, {0.057149f, 0.1142981f, 0.057149f, -1.0851733f, 0.3137695f}, {0.0588518f, 0.1177037f, 0.0588518f, -1.1175069f, 0.3529142f}, {0.060507f, 0.121014f, 0.060507f, -1.1489363f, 0.3909643f}, {0.0620986f, 0.1241972f, 0.0620986f, -1.1791581f, 0.4275525f}, {0.0636158f, 0.1272316f, 0.0636158f, -1.2079677f, 0.4624309f}, {0.0650521f, 0.1301042f, 0.0650521f, -1.2352411f, 0.4954496f}, {0.0664044f, 0.1328088f, 0.0664044f, -1.2609188f, 0.5265364f}, {0.0676721f, 0.1353442f, 0.0676721f, -1.2849901f, 0.5556785f}, {0.0688565f, 0.137713f, 0.0688565f, -1.3074808f, 0.5829068f}, {0.0699604f, 0.1399208f, 0.0699604f, -1.3284417f, 0.6082832f}, {0.0709873f, 0.1419746f, 0.0709873f, -1.3479409f, 0.63189f}, {0.0719413f, 0.1438827f, 0.0719413f, -1.3660569f, 0.6538223f}, {0.072827f, 0.145654f, 0.072827f, -1.3828738f, 0.6741817f}, {0.0736487f, 0.1472974f, 0.0736487f, -1.3984775f, 0.6930724f}, {0.0744111f, 0.1488221f, 0.0744111f, -1.4129532f, 0.7105974f}, {0.0751184f, 0.1502367f, 0.0751184f, -1.4263836f, 0.7268571f}, {0.0757748f, 0.1515496f, 0.0757748f, -1.438848f, 0.7419471f}, {0.0763843f, 0.1527685f, 0.0763843f, -1.4504212f, 0.7559582f}, {0.0769505f, 0.153901f, 0.0769505f, -1.4611732f, 0.7689751f}, {0.0774769f, 0.1549538f, 0.0774769f, -1.4711692f, 0.7810769f}, {0.0779667f, 0.1559334f, 0.0779667f, -1.4804697f, 0.7923366f}, {0.0784228f, 0.1568456f, 0.0784228f, -1.4891304f, 0.8028217f}, {0.0788479f, 0.1576958f, 0.0788479f, -1.4972025f, 0.8125942f}, {0.0792445f, 0.158489f, 0.0792445f, -1.504733f, 0.821711f}, {0.0796148f, 0.1592297f, 0.0796148f, -1.5117649f, 0.8302243f}, {0.079961f, 0.159922f, 0.079961f, -1.5183378f, 0.8381818f}, {0.0802849f, 0.1605697f, 0.0802849f, -1.5244876f, 0.845627f}, {0.0805882f, 0.1611764f, 0.0805882f, -1.5302472f, 0.8525999f}, {0.0808725f, 0.1617451f, 0.0808725f, -1.5356468f, 0.8591369f}, {0.0811394f, 0.1622788f, 0.0811394f, -1.5407138f, 0.8652713f}, {0.08139f, 0.1627801f, 0.08139f, -1.5454734f, 0.8710335f}, {0.0816257f, 0.1632514f, 0.0816257f, -1.5499485f, 0.8764513f}, {0.0818475f, 0.163695f, 0.0818475f, -1.5541601f, 0.8815502f}, {0.0820565f, 0.1641129f, 0.0820565f, -1.5581276f, 0.8863534f}, {0.0822535f, 0.1645069f, 0.0822535f, -1.5618685f, 0.8908823f}, {0.0824438f, 0.1648876f, 0.0824438f, -1.5654826f, 0.8952577f}, {0.0826339f, 0.1652677f, 0.0826339f, -1.5690918f, 0.8996272f}, {0.0828232f, 0.1656463f, 0.0828232f, -1.5726861f, 0.9039787f}, {0.083011f, 0.166022f, 0.083011f, -1.5762534f, 0.9082975f}, {0.0831968f, 0.1663936f, 0.0831968f, -1.5797812f, 0.9125684f}, {0.0833798f, 0.1667597f, 0.0833798f, -1.5832566f, 0.916776f}, {0.0835595f, 0.1671189f, 0.0835595f, -1.5866674f, 0.9209052f}, {0.0837351f, 0.1674701f, 0.0837351f, -1.5900017f, 0.9249419f}, {0.0839061f, 0.1678121f, 0.0839061f, -1.5932488f, 0.9288731f}, {0.084072f, 0.1681439f, 0.084072f, -1.5963992f, 0.9326871f}, {0.0842324f, 0.1684647f, 0.0842324f, -1.5994447f, 0.9363741f}, {0.0843869f, 0.1687737f, 0.0843869f, -1.6023785f, 0.9399259f}, {0.0845352f, 0.1690704f, 0.0845352f, -1.6051955f, 0.9433363f}, {0.0846772f, 0.1693544f, 0.0846772f, -1.6078919f, 0.9466007f}, {0.0848127f, 0.1696255f, 0.0848127f, -1.6104654f, 0.9497164f}, {0.0849418f, 0.1698835f, 0.0849418f, -1.6129151f, 0.9526821f}, {0.0850643f, 0.1701285f, 0.0850643f, -1.6152412f, 0.9554982f}, {0.0851803f, 0.1703606f, 0.0851803f, -1.6174449f, 0.9581661f}, {0.08529f, 0.1705801f, 0.08529f, -1.6195285f, 0.9606886f}},
-          {{0.0377249f, 0.0754498f, 0.0377249f, -0.9251753f, 0.0760749f}, {0.0378604f, 0.0757209f, 0.0378604f, -0.9284995f, 0.0799413f}, {0.0382604f, 0.0765207f, 0.0382604f, -0.9383073f, 0.0913488f}, {0.0389053f, 0.0778106f, 0.0389053f, -0.9541242f, 0.1097454f}, {0.0397656f, 0.0795311f, 0.0397656f, -0.9752214f, 0.1342837f}, {0.0408043f, 0.0816086f, 0.0408043f, -1.000696f, 0.1639133f}, {0.0419812f, 0.0839624f, 0.0419812f, -1.0295586f, 0.1974835f}, {0.0432558f, 0.0865115f, 0.0432558f, -1.0608162f, 0.2338393f}, {0.04459f, 0.0891801f, 0.04459f, -1.0935383f, 0.2718985f}, {0.0459505f, 0.091901f, 0.0459505f, -1.1269027f, 0.3107048f}, {0.0473091f, 0.0946181f, 0.0473091f, -1.1602203f, 0.3494565f}, {0.0486433f, 0.0972866f, 0.0486433f, -1.1929415f, 0.3875147f}, {0.0499363f, 0.0998725f, 0.0499363f, -1.2246507f, 0.4243958f}, {0.0511759f, 0.1023518f, 0.0511759f, -1.255052f, 0.4597556f}, {0.0523543f, 0.1047086f, 0.0523543f, -1.2839511f, 0.4933683f}, {0.0534669f, 0.1069338f, 0.0534669f, -1.3112363f, 0.5251038f}, {0.0545117f, 0.1090235f, 0.0545117f, -1.3368604f, 0.5549073f}, {0.0554889f, 0.1109778f, 0.0554889f, -1.3608248f, 0.5827804f}, {0.0563999f, 0.1127998f, 0.0563999f, -1.3831661f, 0.6087656f}, {0.0572472f, 0.1144943f, 0.0572472f, -1.4039449f, 0.6329335f}, {0.0580338f, 0.1160677f, 0.0580338f, -1.4232377f, 0.6553731f}, {0.0587634f, 0.1175269f, 0.0587634f, -1.4411302f, 0.6761839f}, {0.0594396f, 0.1188791f, 0.0594396f, -1.4577121f, 0.6954703f}, {0.060066f, 0.1201319f, 0.060066f, -1.4730742f, 0.713338f}, {0.0606463f, 0.1212925f, 0.0606463f, -1.4873055f, 0.7298906f}, {0.061184f, 0.1223679f, 0.061184f, -1.5004919f, 0.7452277f}, {0.0616824f, 0.1233647f, 0.0616824f, -1.5127148f, 0.7594443f}, {0.0621446f, 0.1242892f, 0.0621446f, -1.5240509f, 0.7726293f}, {0.0625736f, 0.1251472f, 0.0625736f, -1.5345716f, 0.784866f}, {0.062972f, 0.1259441f, 0.062972f, -1.5443431f, 0.7962312f}, {0.0633424f, 0.1266848f, 0.0633424f, -1.5534264f, 0.806796f}, {0.063687f, 0.127374f, 0.063687f, -1.5618777f, 0.8166257f}, {0.064008f, 0.1280159f, 0.064008f, -1.5697484f, 0.8257802f}, {0.0643071f, 0.1286143f, 0.0643071f, -1.5770856f, 0.8343142f}, {0.0645863f, 0.1291726f, 0.0645863f, -1.5839325f, 0.8422778f}, {0.0648471f, 0.1296942f, 0.0648471f, -1.5903282f, 0.8497167f}, {0.065091f, 0.130182f, 0.065091f, -1.5963087f, 0.8566726f}, {0.0653192f, 0.1306385f, 0.0653192f, -1.6019066f, 0.8631836f}, {0.0655331f, 0.1310662f, 0.0655331f, -1.6071519f, 0.8692843f}, {0.0657337f, 0.1314674f, 0.0657337f, -1.6120716f, 0.8750065f}, {0.0659221f, 0.1318441f, 0.0659221f, -1.6166908f, 0.880379f}, {0.0660991f, 0.1321982f, 0.0660991f, -1.6210319f, 0.8854283f}, {0.0662656f, 0.1325312f, 0.0662656f, -1.6251159f, 0.8901784f}, {0.0664224f, 0.1328449f, 0.0664224f, -1.6289616f, 0.8946513f}, {0.0665702f, 0.1331405f, 0.0665702f, -1.6325863f, 0.8988672f}, {0.066713f, 0.1334259f, 0.066713f, -1.636087f, 0.9029389f}, {0.0668555f, 0.133711f, 0.0668555f, -1.6395818f, 0.9070037f}, {0.0669973f, 0.1339947f, 0.0669973f, -1.643061f, 0.9110504f}, {0.0671381f, 0.1342762f, 0.0671381f, -1.6465129f, 0.9150653f}, {0.0672772f, 0.1345545f, 0.0672772f, -1.6499254f, 0.9190344f}, {0.0674143f, 0.1348286f, 0.0674143f, -1.6532862f, 0.9229433f}, {0.0675487f, 0.1350975f, 0.0675487f, -1.6565833f, 0.9267782f}, {0.0676801f, 0.1353602f, 0.0676801f, -1.6598056f, 0.9305261f}, {0.067808f, 0.1356161f, 0.067808f, -1.6629426f, 0.9341747f}, {0.0679321f, 0.1358642f, 0.0679321f, -1.6659853f, 0.9377137f}, {0.068052f, 0.136104f, 0.068052f, -1.6689257f, 0.9411337f}, {0.0681675f, 0.1363349f, 0.0681675f, -1.6717576f, 0.9444275f}, {0.0682783f, 0.1365566f, 0.0682783f, -1.6744759f, 0.9475892f}, {0.0683844f, 0.1367688f, 0.0683844f, -1.6770773f, 0.9506148f}, {0.0684856f, 0.1369712f, 0.0684856f, -1.6795595f, 0.9535019f}, {0.0685819f, 0.1371638f, 0.0685819f, -1.6819217f, 0.9562494f}, {0.0686734f, 0.1373467f, 0.0686734f, -1.6841641f, 0.9588576f}, {0.06876f, 0.13752f, 0.06876f, -1.6862882f, 0.9613281f}, {0.0688418f, 0.1376837f, 0.0688418f, -1.6882961f, 0.9636635f}},
-          {{0.0315456f, 0.0630911f, 0.0315456f, -0.9916467f, 0.117829f}, {0.0316538f, 0.0633075f, 0.0316538f, -0.9950482f, 0.1216633f}, {0.0319728f, 0.0639456f, 0.0319728f, -1.0050775f, 0.1329688f}, {0.0324867f, 0.0649734f, 0.0324867f, -1.0212314f, 0.1511781f}, {0.0331709f, 0.0663418f, 0.0331709f, -1.0427394f, 0.1754229f}, {0.0339952f, 0.0679903f, 0.0339952f, -1.0686511f, 0.2046318f}, {0.0349266f, 0.0698532f, 0.0349266f, -1.0979315f, 0.237638f}, {0.0359324f, 0.0718648f, 0.0359324f, -1.129549f, 0.2732787f}, {0.0369821f, 0.0739641f, 0.0369821f, -1.1625453f, 0.3104736f}, {0.0380489f, 0.0760978f, 0.0380489f, -1.1960818f, 0.3482774f}, {0.0391108f, 0.0782216f, 0.0391108f, -1.2294633f, 0.3859065f}, {0.0401504f, 0.0803008f, 0.0401504f, -1.2621428f, 0.4227444f}, {0.0411547f, 0.0823094f, 0.0411547f, -1.2937135f, 0.4583323f}, {0.0421147f, 0.0842294f, 0.0421147f, -1.3238916f, 0.4923504f}, {0.0430247f, 0.0860493f, 0.0430247f, -1.3524969f, 0.5245955f}, {0.0438815f, 0.087763f, 0.0438815f, -1.3794319f, 0.5549579f}, {0.0446841f, 0.0893683f, 0.0446841f, -1.404663f, 0.5833996f}, {0.045433f, 0.090866f, 0.045433f, -1.428204f, 0.609936f}, {0.0461296f, 0.0922592f, 0.0461296f, -1.4501019f, 0.6346204f}, {0.0467762f, 0.0935523f, 0.0467762f, -1.4704265f, 0.6575312f}, {0.0473753f, 0.0947507f, 0.0473753f, -1.4892615f, 0.6787629f}, {0.04793f, 0.09586f, 0.04793f, -1.5066984f, 0.6984185f}, {0.0484432f, 0.0968865f, 0.0484432f, -1.5228316f, 0.7166046f}, {0.048918f, 0.097836f, 0.048918f, -1.5377553f, 0.7334272f}, {0.0493572f, 0.0987143f, 0.0493572f, -1.5515611f, 0.7489897f}, {0.0497636f, 0.0995271f, 0.0497636f, -1.5643364f, 0.7633907f}, {0.0501398f, 0.1002796f, 0.0501398f, -1.5761641f, 0.7767234f}, {0.0504884f, 0.1009768f, 0.0504884f, -1.5871214f, 0.7890749f}, {0.0508115f, 0.1016231f, 0.0508115f, -1.59728f, 0.8005261f}, {0.0511114f, 0.1022228f, 0.0511114f, -1.606706f, 0.8111516f}, {0.0513899f, 0.1027798f, 0.0513899f, -1.6154604f, 0.8210199f}, {0.0516488f, 0.1032976f, 0.0516488f, -1.6235988f, 0.8301939f}, {0.0518897f, 0.1037794f, 0.0518897f, -1.6311724f, 0.8387312f}, {0.0521141f, 0.1042283f, 0.0521141f, -1.6382275f, 0.846684f}, {0.0523234f, 0.1046468f, 0.0523234f, -1.6448067f, 0.8541004f}, {0.0525188f, 0.1050376f, 0.0525188f, -1.6509485f, 0.8610237f}, {0.0527014f, 0.1054028f, 0.0527014f, -1.6566882f, 0.8674938f}, {0.0528722f, 0.1057444f, 0.0528722f, -1.6620579f, 0.8735467f}, {0.0530322f, 0.1060644f, 0.0530322f, -1.6670866f, 0.8792153f}, {0.0531821f, 0.1063643f, 0.0531821f, -1.671801f, 0.8845296f}, {0.0533229f, 0.1066458f, 0.0533229f, -1.6762253f, 0.8895169f}, {0.0534551f, 0.1069102f, 0.0534551f, -1.6803817f, 0.8942021f}, {0.0535794f, 0.1071589f, 0.0535794f, -1.6842902f, 0.898608f}, {0.0536965f, 0.107393f, 0.0536965f, -1.6879693f, 0.9027553f}, {0.0538068f, 0.1076135f, 0.0538068f, -1.6914359f, 0.9066629f}, {0.0539132f, 0.1078264f, 0.0539132f, -1.6947826f, 0.9104355f}, {0.0540195f, 0.1080389f, 0.0540195f, -1.6981226f, 0.9142005f}, {0.0541252f, 0.1082504f, 0.0541252f, -1.7014466f, 0.9179475f}, {0.0542301f, 0.1084602f, 0.0542301f, -1.7047435f, 0.9216639f}, {0.0543337f, 0.1086675f, 0.0543337f, -1.7080016f, 0.9253366f}, {0.0544358f, 0.1088716f, 0.0544358f, -1.7112094f, 0.9289525f}, {0.0545359f, 0.1090717f, 0.0545359f, -1.7143555f, 0.9324989f}, {0.0546336f, 0.1092673f, 0.0546336f, -1.7174291f, 0.9359636f}, {0.0547288f, 0.1094576f, 0.0547288f, -1.7204205f, 0.9393357f}, {0.0548211f, 0.1096421f, 0.0548211f, -1.7233211f, 0.9426054f}, {0.0549102f, 0.1098204f, 0.0549102f, -1.7261235f, 0.9457644f}, {0.054996f, 0.1099921f, 0.054996f, -1.7288217f, 0.9488059f}, {0.0550784f, 0.1101568f, 0.0550784f, -1.731411f, 0.9517247f}, {0.0551572f, 0.1103144f, 0.0551572f, -1.7338883f, 0.9545172f}, {0.0552324f, 0.1104648f, 0.0552324f, -1.7362515f, 0.9571811f}, {0.0553039f, 0.1106079f, 0.0553039f, -1.7384999f, 0.9597156f}, {0.0553718f, 0.1107436f, 0.0553718f, -1.740634f, 0.9621212f}, {0.0554361f, 0.1108722f, 0.0554361f, -1.7426549f, 0.9643994f}, {0.0554969f, 0.1109937f, 0.0554969f, -1.7445649f, 0.9665524f}},
-          {{0.0263456f, 0.0526912f, 0.0263456f, -1.0554833f, 0.1608656f}, {0.0264315f, 0.0528631f, 0.0264315f, -1.0589265f, 0.1646527f}, {0.0266848f, 0.0533696f, 0.0266848f, -1.0690723f, 0.1758114f}, {0.0270921f, 0.0541843f, 0.0270921f, -1.0853927f, 0.1937613f}, {0.0276335f, 0.0552671f, 0.0276335f, -1.1070823f, 0.2176165f}, {0.0282843f, 0.0565685f, 0.0282843f, -1.1331521f, 0.2462891f}, {0.0290176f, 0.0580352f, 0.0290176f, -1.1625315f, 0.2786018f}, {0.0298071f, 0.0596142f, 0.0298071f, -1.1941615f, 0.3133899f}, {0.0306284f, 0.0612569f, 0.0306284f, -1.2270668f, 0.3495805f}, {0.0314605f, 0.062921f, 0.0314605f, -1.2604024f, 0.3862444f}, {0.032286f, 0.0645721f, 0.032286f, -1.2934759f, 0.4226201f}, {0.0330916f, 0.0661833f, 0.0330916f, -1.3257503f, 0.4581168f}, {0.0338675f, 0.0677349f, 0.0338675f, -1.3568323f, 0.4923022f}, {0.0346069f, 0.0692137f, 0.0346069f, -1.3864545f, 0.5248819f}, {0.0353057f, 0.0706114f, 0.0353057f, -1.414453f, 0.5556759f}, {0.035962f, 0.071924f, 0.035962f, -1.4407461f, 0.5845941f}, {0.0365752f, 0.0731505f, 0.0365752f, -1.4653139f, 0.6116149f}, {0.0371461f, 0.0742921f, 0.0371461f, -1.4881822f, 0.6367664f}, {0.0376759f, 0.0753517f, 0.0376759f, -1.5094079f, 0.6601113f}, {0.0381666f, 0.0763332f, 0.0381666f, -1.5290685f, 0.6817349f}, {0.0386205f, 0.077241f, 0.0386205f, -1.547254f, 0.7017361f}, {0.03904f, 0.07808f, 0.03904f, -1.5640603f, 0.7202203f}, {0.0394275f, 0.0788551f, 0.0394275f, -1.579585f, 0.7372951f}, {0.0397854f, 0.0795709f, 0.0397854f, -1.5939244f, 0.7530662f}, {0.0401161f, 0.0802322f, 0.0401161f, -1.6071714f, 0.7676358f}, {0.0404217f, 0.0808434f, 0.0404217f, -1.6194142f, 0.7811009f}, {0.0407043f, 0.0814086f, 0.0407043f, -1.6307354f, 0.7935525f}, {0.0409658f, 0.0819316f, 0.0409658f, -1.6412121f, 0.8050752f}, {0.041208f, 0.082416f, 0.041208f, -1.6509153f, 0.8157472f}, {0.0414325f, 0.082865f, 0.0414325f, -1.6599103f, 0.8256404f}, {0.0416408f, 0.0832817f, 0.0416408f, -1.6682572f, 0.8348206f}, {0.0418344f, 0.0836688f, 0.0418344f, -1.6760106f, 0.8433481f}, {0.0420143f, 0.0840287f, 0.0420143f, -1.6832204f, 0.8512778f}, {0.0421819f, 0.0843637f, 0.0421819f, -1.689932f, 0.8586595f}, {0.042338f, 0.084676f, 0.042338f, -1.6961868f, 0.8655387f}, {0.0424836f, 0.0849673f, 0.0424836f, -1.7020222f, 0.8719568f}, {0.0426197f, 0.0852394f, 0.0426197f, -1.7074725f, 0.8779512f}, {0.0427469f, 0.0854938f, 0.0427469f, -1.7125686f, 0.8835562f}, {0.042866f, 0.0857319f, 0.042866f, -1.7173389f, 0.8888027f}, {0.0429775f, 0.0859551f, 0.0429775f, -1.7218089f, 0.8937191f}, {0.0430822f, 0.0861644f, 0.0430822f, -1.7260021f, 0.8983309f}, {0.0431805f, 0.086361f, 0.0431805f, -1.7299397f, 0.9026616f}, {0.0432729f, 0.0865457f, 0.0432729f, -1.733641f, 0.9067325f}, {0.0433598f, 0.0867196f, 0.0433598f, -1.7371239f, 0.9105631f}, {0.0434417f, 0.0868834f, 0.0434417f, -1.7404044f, 0.9141712f}, {0.0435207f, 0.0870414f, 0.0435207f, -1.7435705f, 0.9176534f}, {0.0435996f, 0.0871991f, 0.0435996f, -1.7467293f, 0.9211275f}, {0.043678f, 0.087356f, 0.043678f, -1.7498719f, 0.9245839f}, {0.0437558f, 0.0875116f, 0.0437558f, -1.7529878f, 0.928011f}, {0.0438326f, 0.0876652f, 0.0438326f, -1.7560663f, 0.9313967f}, {0.0439082f, 0.0878165f, 0.0439082f, -1.7590961f, 0.9347291f}, {0.0439824f, 0.0879648f, 0.0439824f, -1.7620668f, 0.9379964f}, {0.0440548f, 0.0881096f, 0.0440548f, -1.7649683f, 0.9411876f}, {0.0441253f, 0.0882506f, 0.0441253f, -1.7677913f, 0.9442925f}, {0.0441936f, 0.0883872f, 0.0441936f, -1.7705279f, 0.9473023f}, {0.0442596f, 0.0885191f, 0.0442596f, -1.7731711f, 0.9502094f}, {0.0443231f, 0.0886462f, 0.0443231f, -1.7757153f, 0.9530076f}, {0.044384f, 0.088768f, 0.044384f, -1.7781563f, 0.9556923f}, {0.0444423f, 0.0888846f, 0.0444423f, -1.780491f, 0.9582602f}, {0.0444979f, 0.0889957f, 0.0444979f, -1.7827178f, 0.9607093f}, {0.0445507f, 0.0891015f, 0.0445507f, -1.784836f, 0.9630389f}, {0.0446009f, 0.0892018f, 0.0446009f, -1.786846f, 0.9652496f}, {0.0446484f, 0.0892968f, 0.0446484f, -1.7887491f, 0.9673427f}, {0.0446933f, 0.0893866f, 0.0446933f, -1.7905473f, 0.9693205f}},
-          {{0.0219707f, 0.0439413f, 0.0219707f, -1.1168364f, 0.2047191f}, {0.0220386f, 0.0440772f, 0.0220386f, -1.1202888f, 0.2084432f}, {0.0222386f, 0.0444771f, 0.0222386f, -1.1304548f, 0.219409f}, {0.0225598f, 0.0451197f, 0.0225598f, -1.1467861f, 0.2370255f}, {0.022986f, 0.045972f, 0.022986f, -1.1684496f, 0.2603937f}, {0.023497f, 0.0469941f, 0.023497f, -1.1944267f, 0.2884148f}, {0.0240714f, 0.0481427f, 0.0240714f, -1.2236216f, 0.3199071f}, {0.0246878f, 0.0493757f, 0.0246878f, -1.2549587f, 0.3537101f}, {0.0253271f, 0.0506543f, 0.0253271f, -1.287456f, 0.3887645f}, {0.0259727f, 0.0519454f, 0.0259727f, -1.3202713f, 0.4241621f}, {0.0266111f, 0.0532222f, 0.0266111f, -1.3527229f, 0.4591673f}, {0.0272321f, 0.0544641f, 0.0272321f, -1.3842892f, 0.4932175f}, {0.0278283f, 0.0556565f, 0.0278283f, -1.4145954f, 0.5259084f}, {0.0283948f, 0.0567895f, 0.0283948f, -1.4433928f, 0.5569719f}, {0.0289287f, 0.0578574f, 0.0289287f, -1.4705355f, 0.5862504f}, {0.0294288f, 0.0588577f, 0.0294288f, -1.4959575f, 0.6136728f}, {0.029895f, 0.0597899f, 0.029895f, -1.5196529f, 0.6392328f}, {0.0303279f, 0.0606557f, 0.0303279f, -1.5416583f, 0.6629698f}, {0.0307288f, 0.0614576f, 0.0307288f, -1.5620395f, 0.6849547f}, {0.0310995f, 0.0621989f, 0.0310995f, -1.5808806f, 0.7052784f}, {0.0314417f, 0.0628833f, 0.0314417f, -1.5982761f, 0.7240428f}, {0.0317574f, 0.0635148f, 0.0317574f, -1.6143252f, 0.7413547f}, {0.0320486f, 0.0640972f, 0.0320486f, -1.6291273f, 0.7573216f}, {0.0323171f, 0.0646343f, 0.0323171f, -1.6427796f, 0.7720482f}, {0.0325649f, 0.0651299f, 0.0325649f, -1.6553751f, 0.7856348f}, {0.0327936f, 0.0655873f, 0.0327936f, -1.6670014f, 0.798176f}, {0.0330049f, 0.0660098f, 0.0330049f, -1.6777404f, 0.8097601f}, {0.0332002f, 0.0664004f, 0.0332002f, -1.6876679f, 0.8204687f}, {0.0333809f, 0.0667618f, 0.0333809f, -1.6968535f, 0.8303771f}, {0.0335483f, 0.0670965f, 0.0335483f, -1.7053611f, 0.8395541f}, {0.0337034f, 0.0674069f, 0.0337034f, -1.713249f, 0.8480628f}, {0.0338475f, 0.0676949f, 0.0338475f, -1.7205705f, 0.8559603f}, {0.0339813f, 0.0679626f, 0.0339813f, -1.7273737f, 0.8632989f}, {0.0341058f, 0.0682116f, 0.0341058f, -1.7337026f, 0.8701258f}, {0.0342218f, 0.0684435f, 0.0342218f, -1.739597f, 0.876484f}, {0.0343299f, 0.0686598f, 0.0343299f, -1.7450931f, 0.8824126f}, {0.0344308f, 0.0688616f, 0.0344308f, -1.7502236f, 0.8879468f}, {0.0345251f, 0.0690503f, 0.0345251f, -1.7550184f, 0.8931189f}, {0.0346134f, 0.0692268f, 0.0346134f, -1.7595044f, 0.8979579f}, {0.034696f, 0.0693921f, 0.034696f, -1.7637062f, 0.9024904f}, {0.0347736f, 0.0695471f, 0.0347736f, -1.7676461f, 0.9067403f}, {0.0348463f, 0.0696926f, 0.0348463f, -1.7713445f, 0.9107297f}, {0.0349147f, 0.0698293f, 0.0349147f, -1.7748197f, 0.9144783f}, {0.034979f, 0.069958f, 0.034979f, -1.7780886f, 0.9180045f}, {0.0350395f, 0.0700791f, 0.0350395f, -1.7811666f, 0.9213247f}, {0.035098f, 0.0701959f, 0.035098f, -1.7841364f, 0.9245282f}, {0.0351562f, 0.0703124f, 0.0351562f, -1.7870983f, 0.9277232f}, {0.0352142f, 0.0704283f, 0.0352142f, -1.7900442f, 0.9309009f}, {0.0352716f, 0.0705432f, 0.0352716f, -1.7929643f, 0.9340507f}, {0.0353284f, 0.0706567f, 0.0353284f, -1.7958483f, 0.9371617f}, {0.0353842f, 0.0707684f, 0.0353842f, -1.798686f, 0.9402227f}, {0.0354389f, 0.0708778f, 0.0354389f, -1.8014675f, 0.9432231f}, {0.0354923f, 0.0709846f, 0.0354923f, -1.8041834f, 0.9461527f}, {0.0355443f, 0.0710886f, 0.0355443f, -1.8068252f, 0.9490024f}, {0.0355947f, 0.0711893f, 0.0355947f, -1.8093854f, 0.951764f}, {0.0356433f, 0.0712866f, 0.0356433f, -1.8118576f, 0.9544307f}, {0.0356901f, 0.0713802f, 0.0356901f, -1.8142366f, 0.956997f}, {0.035735f, 0.07147f, 0.035735f, -1.8165186f, 0.9594585f}, {0.0357779f, 0.0715558f, 0.0357779f, -1.8187007f, 0.9618124f}, {0.0358188f, 0.0716377f, 0.0358188f, -1.8207815f, 0.9640569f}, {0.0358578f, 0.0717155f, 0.0358578f, -1.8227604f, 0.9661915f}, {0.0358947f, 0.0717894f, 0.0358947f, -1.8246378f, 0.9682166f}, {0.0359297f, 0.0718593f, 0.0359297f, -1.826415f, 0.9701337f}, {0.0359627f, 0.0719254f, 0.0359627f, -1.8280941f, 0.9719449f}},
-          {{0.0182924f, 0.0365848f, 0.0182924f, -1.1757858f, 0.2489554f}, {0.0183458f, 0.0366916f, 0.0183458f, -1.1792177f, 0.2526008f}, {0.0185029f, 0.0370058f, 0.0185029f, -1.1893163f, 0.2633279f}, {0.018755f, 0.0375099f, 0.018755f, -1.2055181f, 0.280538f}, {0.0190887f, 0.0381774f, 0.0190887f, -1.2269692f, 0.303324f}, {0.0194879f, 0.0389759f, 0.0194879f, -1.2526308f, 0.3305825f}, {0.0199354f, 0.0398708f, 0.0199354f, -1.2813924f, 0.361134f}, {0.0204142f, 0.0408285f, 0.0204142f, -1.3121719f, 0.3938289f}, {0.0209093f, 0.0418185f, 0.0209093f, -1.3439903f, 0.4276273f}, {0.0214075f, 0.042815f, 0.0214075f, -1.3760167f, 0.4616468f}, {0.0218987f, 0.0437973f, 0.0218987f, -1.4075864f, 0.495181f}, {0.0223749f, 0.0447498f, 0.0223749f, -1.4381981f, 0.5276977f}, {0.0228308f, 0.0456615f, 0.0228308f, -1.4674986f, 0.5588216f}, {0.0232626f, 0.0465253f, 0.0232626f, -1.4952597f, 0.5883103f}, {0.0236686f, 0.0473372f, 0.0236686f, -1.5213541f, 0.6160285f}, {0.0240479f, 0.0480957f, 0.0240479f, -1.5457314f, 0.6419229f}, {0.0244005f, 0.048801f, 0.0244005f, -1.5683986f, 0.6660006f}, {0.0247273f, 0.0494546f, 0.0247273f, -1.5894022f, 0.6883113f}, {0.0250293f, 0.0500586f, 0.0250293f, -1.6088153f, 0.7089325f}, {0.025308f, 0.0506159f, 0.025308f, -1.6267273f, 0.7279591f}, {0.0255648f, 0.0511296f, 0.0255648f, -1.6432358f, 0.745495f}, {0.0258014f, 0.0516027f, 0.0258014f, -1.6584417f, 0.7616472f}, {0.0260192f, 0.0520385f, 0.0260192f, -1.6724452f, 0.7765221f}, {0.0262199f, 0.0524398f, 0.0262199f, -1.6853431f, 0.7902227f}, {0.0264048f, 0.0528096f, 0.0264048f, -1.6972274f, 0.8028465f}, {0.0265752f, 0.0531505f, 0.0265752f, -1.7081844f, 0.8144854f}, {0.0267325f, 0.0534651f, 0.0267325f, -1.7182942f, 0.8252243f}, {0.0268778f, 0.0537556f, 0.0268778f, -1.7276306f, 0.8351418f}, {0.0270121f, 0.0540241f, 0.0270121f, -1.7362614f, 0.8443096f}, {0.0271363f, 0.0542726f, 0.0271363f, -1.7442482f, 0.8527935f}, {0.0272514f, 0.0545029f, 0.0272514f, -1.7516475f, 0.8606532f}, {0.0273582f, 0.0547164f, 0.0273582f, -1.7585103f, 0.8679431f}, {0.0274573f, 0.0549147f, 0.0274573f, -1.764883f, 0.8747124f}, {0.0275495f, 0.055099f, 0.0275495f, -1.7708076f, 0.8810057f}, {0.0276353f, 0.0552706f, 0.0276353f, -1.7763223f, 0.8868635f}, {0.0277153f, 0.0554305f, 0.0277153f, -1.7814614f, 0.8923224f}, {0.0277899f, 0.0555797f, 0.0277899f, -1.7862563f, 0.8974157f}, {0.0278595f, 0.0557191f, 0.0278595f, -1.7907352f, 0.9021734f}, {0.0279247f, 0.0558494f, 0.0279247f, -1.7949238f, 0.9066227f}, {0.0279857f, 0.0559714f, 0.0279857f, -1.7988455f, 0.9107883f}, {0.0280429f, 0.0560858f, 0.0280429f, -1.8025212f, 0.9146928f}, {0.0280966f, 0.0561931f, 0.0280966f, -1.8059703f, 0.9183566f}, {0.028147f, 0.0562939f, 0.028147f, -1.8092102f, 0.9217981f}, {0.0281944f, 0.0563887f, 0.0281944f, -1.8122568f, 0.9250342f}, {0.028239f, 0.056478f, 0.028239f, -1.8151246f, 0.9280805f}, {0.028282f, 0.056564f, 0.028282f, -1.8178907f, 0.9310187f}, {0.0283249f, 0.0566498f, 0.0283249f, -1.8206487f, 0.9339484f}, {0.0283676f, 0.0567352f, 0.0283676f, -1.823391f, 0.9368614f}, {0.0284099f, 0.0568197f, 0.0284099f, -1.8261086f, 0.939748f}, {0.0284516f, 0.0569032f, 0.0284516f, -1.8287918f, 0.9425982f}, {0.0284927f, 0.0569853f, 0.0284927f, -1.8314312f, 0.9454019f}, {0.0285329f, 0.0570658f, 0.0285329f, -1.8340176f, 0.9481492f}, {0.0285722f, 0.0571444f, 0.0285722f, -1.8365424f, 0.9508311f}, {0.0286104f, 0.0572208f, 0.0286104f, -1.8389976f, 0.9534391f}, {0.0286474f, 0.0572948f, 0.0286474f, -1.8413763f, 0.9559659f}, {0.0286831f, 0.0573662f, 0.0286831f, -1.8436728f, 0.9584053f}, {0.0287175f, 0.057435f, 0.0287175f, -1.8458822f, 0.9607522f}, {0.0287505f, 0.0575009f, 0.0287505f, -1.848001f, 0.9630028f}, {0.028782f, 0.0575639f, 0.028782f, -1.8500267f, 0.9651545f}, {0.028812f, 0.057624f, 0.028812f, -1.8519578f, 0.9672059f}, {0.0288406f, 0.0576812f, 0.0288406f, -1.8537941f, 0.9691564f}, {0.0288677f, 0.0577354f, 0.0288677f, -1.8555359f, 0.9710066f}, {0.0288933f, 0.0577867f, 0.0288933f, -1.8571844f, 0.9727577f}, {0.0289176f, 0.0578351f, 0.0289176f, -1.8587416f, 0.9744119f}},
-          {{0.0152032f, 0.0304064f, 0.0152032f, -1.2323601f, 0.2931728f}, {0.0152449f, 0.0304899f, 0.0152449f, -1.2357447f, 0.2967245f}, {0.0153677f, 0.0307354f, 0.0153677f, -1.2456976f, 0.3071685f}, {0.0155645f, 0.0311289f, 0.0155645f, -1.2616447f, 0.3239026f}, {0.0158244f, 0.0316489f, 0.0158244f, -1.2827188f, 0.3460166f}, {0.0161347f, 0.0322694f, 0.0161347f, -1.3078702f, 0.372409f}, {0.0164815f, 0.0329631f, 0.0164815f, -1.3359834f, 0.4019096f}, {0.0168516f, 0.0337032f, 0.0168516f, -1.36598f, 0.4333864f}, {0.017233f, 0.0344659f, 0.017233f, -1.3968927f, 0.4658246f}, {0.0176156f, 0.0352312f, 0.0176156f, -1.427909f, 0.4983714f}, {0.0179916f, 0.0359832f, 0.0179916f, -1.4583868f, 0.5303531f}, {0.0183551f, 0.0367101f, 0.0183551f, -1.4878489f, 0.5612691f}, {0.0187019f, 0.0374038f, 0.0187019f, -1.5159656f, 0.5907733f}, {0.0190296f, 0.0380593f, 0.0190296f, -1.5425303f, 0.6186488f}, {0.0193369f, 0.0386737f, 0.0193369f, -1.5674337f, 0.6447812f}, {0.0196232f, 0.0392463f, 0.0196232f, -1.5906409f, 0.6691335f}, {0.0198888f, 0.0397775f, 0.0198888f, -1.6121701f, 0.6917251f}, {0.0201343f, 0.0402687f, 0.0201343f, -1.6320765f, 0.7126138f}, {0.0203609f, 0.0407217f, 0.0203609f, -1.6504391f, 0.7318825f}, {0.0205695f, 0.041139f, 0.0205695f, -1.6673507f, 0.7496287f}, {0.0207615f, 0.0415229f, 0.0207615f, -1.6829111f, 0.7659569f}, {0.020938f, 0.041876f, 0.020938f, -1.6972215f, 0.7809735f}, {0.0211004f, 0.0422007f, 0.0211004f, -1.7103814f, 0.7947828f}, {0.0212497f, 0.0424994f, 0.0212497f, -1.7224864f, 0.8074852f}, {0.0213871f, 0.0427742f, 0.0213871f, -1.7336267f, 0.8191752f}, {0.0215137f, 0.0430274f, 0.0215137f, -1.7438862f, 0.829941f}, {0.0216304f, 0.0432607f, 0.0216304f, -1.7533428f, 0.8398642f}, {0.021738f, 0.043476f, 0.021738f, -1.7620677f, 0.8490196f}, {0.0218374f, 0.0436748f, 0.0218374f, -1.7701261f, 0.8574757f}, {0.0219293f, 0.0438587f, 0.0219293f, -1.7775772f, 0.8652945f}, {0.0220144f, 0.0440288f, 0.0220144f, -1.784475f, 0.8725327f}, {0.0220933f, 0.0441866f, 0.0220933f, -1.7908683f, 0.8792414f}, {0.0221665f, 0.044333f, 0.0221665f, -1.7968011f, 0.8854671f}, {0.0222345f, 0.044469f, 0.0222345f, -1.8023135f, 0.8912515f}, {0.0222978f, 0.0445955f, 0.0222978f, -1.8074416f, 0.8966327f}, {0.0223567f, 0.0447134f, 0.0223567f, -1.8122181f, 0.9016448f}, {0.0224116f, 0.0448233f, 0.0224116f, -1.8166724f, 0.9063189f}, {0.0224629f, 0.0449259f, 0.0224629f, -1.8208314f, 0.9106831f}, {0.0225109f, 0.0450218f, 0.0225109f, -1.8247191f, 0.9147627f}, {0.0225558f, 0.0451116f, 0.0225558f, -1.8283576f, 0.9185808f}, {0.0225978f, 0.0451957f, 0.0225978f, -1.8317667f, 0.9221581f}, {0.0226373f, 0.0452746f, 0.0226373f, -1.8349645f, 0.9255137f}, {0.0226743f, 0.0453487f, 0.0226743f, -1.8379674f, 0.9286647f}, {0.0227092f, 0.0454183f, 0.0227092f, -1.8407902f, 0.9316269f}, {0.0227419f, 0.0454839f, 0.0227419f, -1.8434466f, 0.9344143f}, {0.0227735f, 0.0455471f, 0.0227735f, -1.8460081f, 0.9371022f}, {0.022805f, 0.0456101f, 0.022805f, -1.8485615f, 0.9397816f}, {0.0228363f, 0.0456727f, 0.0228363f, -1.8510996f, 0.942445f}, {0.0228674f, 0.0457347f, 0.0228674f, -1.8536141f, 0.9450836f}, {0.022898f, 0.045796f, 0.022898f, -1.8560962f, 0.9476882f}, {0.0229281f, 0.0458562f, 0.0229281f, -1.8585372f, 0.9502496f}, {0.0229576f, 0.0459152f, 0.0229576f, -1.8609286f, 0.952759f}, {0.0229864f, 0.0459728f, 0.0229864f, -1.8632623f, 0.9552079f}, {0.0230144f, 0.0460288f, 0.0230144f, -1.8655313f, 0.9575888f}, {0.0230415f, 0.046083f, 0.0230415f, -1.867729f, 0.959895f}, {0.0230677f, 0.0461353f, 0.0230677f, -1.8698503f, 0.9621209f}, {0.0230928f, 0.0461857f, 0.0230928f, -1.8718907f, 0.964262f}, {0.023117f, 0.0462339f, 0.023117f, -1.8738469f, 0.9663148f}, {0.02314f, 0.0462801f, 0.02314f, -1.8757169f, 0.968277f}, {0.023162f, 0.0463241f, 0.023162f, -1.8774993f, 0.9701474f}, {0.0231829f, 0.0463659f, 0.0231829f, -1.8791937f, 0.9719254f}, {0.0232028f, 0.0464055f, 0.0232028f, -1.8808007f, 0.9736117f}, {0.0232215f, 0.046443f, 0.0232215f, -1.8823214f, 0.9752075f}, {0.0232392f, 0.0464785f, 0.0232392f, -1.8837577f, 0.9767147f}},
-          {{0.0126123f, 0.0252246f, 0.0126123f, -1.2865545f, 0.3370037f}, {0.0126448f, 0.0252896f, 0.0126448f, -1.2898683f, 0.3404475f}, {0.0127403f, 0.0254805f, 0.0127403f, -1.2996064f, 0.3505674f}, {0.012893f, 0.025786f, 0.012893f, -1.315189f, 0.366761f}, {0.0130945f, 0.026189f, 0.0130945f, -1.3357431f, 0.3881211f}, {0.0133344f, 0.0266689f, 0.0133344f, -1.360217f, 0.4135547f}, {0.0136019f, 0.0272038f, 0.0136019f, -1.3875001f, 0.4419077f}, {0.0138864f, 0.0277729f, 0.0138864f, -1.4165264f, 0.4720722f}, {0.0141788f, 0.0283576f, 0.0141788f, -1.4463482f, 0.5030634f}, {0.0144712f, 0.0289424f, 0.0144712f, -1.4761777f, 0.5340626f}, {0.0147577f, 0.0295154f, 0.0147577f, -1.5053995f, 0.5644302f}, {0.0150338f, 0.0300676f, 0.0150338f, -1.5335634f, 0.5936985f}, {0.0152965f, 0.030593f, 0.0152965f, -1.5603645f, 0.6215505f}, {0.0155441f, 0.0310881f, 0.0155441f, -1.5856174f, 0.6477937f}, {0.0157756f, 0.0315511f, 0.0157756f, -1.609231f, 0.6723332f}, {0.0159908f, 0.0319815f, 0.0159908f, -1.6311837f, 0.6951468f}, {0.01619f, 0.0323799f, 0.01619f, -1.6515042f, 0.7162641f}, {0.0163738f, 0.0327476f, 0.0163738f, -1.6702547f, 0.7357498f}, {0.016543f, 0.033086f, 0.016543f, -1.6875183f, 0.7536904f}, {0.0166986f, 0.0333972f, 0.0166986f, -1.7033902f, 0.7701847f}, {0.0168416f, 0.0336831f, 0.0168416f, -1.7179706f, 0.7853368f}, {0.0169728f, 0.0339456f, 0.0169728f, -1.73136f, 0.7992513f}, {0.0170934f, 0.0341867f, 0.0170934f, -1.7436564f, 0.8120298f}, {0.0172041f, 0.0344082f, 0.0172041f, -1.7549531f, 0.8237695f}, {0.0173059f, 0.0346118f, 0.0173059f, -1.7653376f, 0.8345612f}, {0.0173996f, 0.0347991f, 0.0173996f, -1.774891f, 0.8444893f}, {0.0174858f, 0.0349716f, 0.0174858f, -1.7836883f, 0.8536315f}, {0.0175653f, 0.0351306f, 0.0175653f, -1.7917976f, 0.8620588f}, {0.0176387f, 0.0352773f, 0.0176387f, -1.7992813f, 0.8698359f}, {0.0177064f, 0.0354129f, 0.0177064f, -1.8061958f, 0.8770216f}, {0.0177691f, 0.0355383f, 0.0177691f, -1.8125924f, 0.8836689f}, {0.0178272f, 0.0356545f, 0.0178272f, -1.8185171f, 0.889826f}, {0.0178811f, 0.0357622f, 0.0178811f, -1.8240119f, 0.8955363f}, {0.0179311f, 0.0358622f, 0.0179311f, -1.8291145f, 0.900839f}, {0.0179776f, 0.0359552f, 0.0179776f, -1.8338588f, 0.9057693f}, {0.0180209f, 0.0360418f, 0.0180209f, -1.8382757f, 0.9103594f}, {0.0180613f, 0.0361226f, 0.0180613f, -1.8423928f, 0.914638f}, {0.018099f, 0.0361979f, 0.018099f, -1.8462353f, 0.9186311f}, {0.0181342f, 0.0362683f, 0.0181342f, -1.8498259f, 0.9223625f}, {0.0181671f, 0.0363342f, 0.0181671f, -1.853185f, 0.9258533f}, {0.0181979f, 0.0363958f, 0.0181979f, -1.8563312f, 0.9291229f}, {0.0182268f, 0.0364537f, 0.0182268f, -1.8592815f, 0.9321888f}, {0.018254f, 0.036508f, 0.018254f, -1.862051f, 0.935067f}, {0.0182795f, 0.036559f, 0.0182795f, -1.8646538f, 0.9377719f}, {0.0183035f, 0.036607f, 0.0183035f, -1.8671025f, 0.9403165f}, {0.0183267f, 0.0366533f, 0.0183267f, -1.8694631f, 0.9427697f}, {0.0183497f, 0.0366994f, 0.0183497f, -1.8718156f, 0.9452145f}, {0.0183726f, 0.0367453f, 0.0183726f, -1.8741535f, 0.9476441f}, {0.0183953f, 0.0367907f, 0.0183953f, -1.8764691f, 0.9500505f}, {0.0184177f, 0.0368355f, 0.0184177f, -1.8787543f, 0.9524252f}, {0.0184398f, 0.0368795f, 0.0184398f, -1.881001f, 0.9547601f}, {0.0184613f, 0.0369227f, 0.0184613f, -1.8832016f, 0.957047f}, {0.0184824f, 0.0369648f, 0.0184824f, -1.8853487f, 0.9592782f}, {0.0185028f, 0.0370057f, 0.0185028f, -1.8874357f, 0.9614471f}, {0.0185227f, 0.0370453f, 0.0185227f, -1.8894567f, 0.9635474f}, {0.0185418f, 0.0370836f, 0.0185418f, -1.891407f, 0.9655741f}, {0.0185602f, 0.0371203f, 0.0185602f, -1.8932826f, 0.9675233f}, {0.0185778f, 0.0371556f, 0.0185778f, -1.8950805f, 0.9693917f}, {0.0185946f, 0.0371893f, 0.0185946f, -1.8967987f, 0.9711773f}, {0.0186107f, 0.0372214f, 0.0186107f, -1.8984362f, 0.972879f}, {0.0186259f, 0.0372519f, 0.0186259f, -1.8999927f, 0.9744964f}, {0.0186404f, 0.0372808f, 0.0186404f, -1.9014685f, 0.9760302f}, {0.0186541f, 0.0373082f, 0.0186541f, -1.902865f, 0.9774814f}, {0.018667f, 0.0373341f, 0.018667f, -1.9041837f, 0.9788518f}},
-          {{0.010443f, 0.020886f, 0.010443f, -1.338345f, 0.380117f}, {0.0104682f, 0.0209363f, 0.0104682f, -1.3415675f, 0.3834401f}, {0.010542f, 0.021084f, 0.010542f, -1.351031f, 0.393199f}, {0.01066f, 0.02132f, 0.01066f, -1.3661549f, 0.4087949f}, {0.0108154f, 0.0216308f, 0.0108154f, -1.3860676f, 0.4293292f}, {0.011f, 0.022f, 0.011f, -1.409724f, 0.453724f}, {0.0112052f, 0.0224104f, 0.0112052f, -1.4360272f, 0.4808481f}, {0.011423f, 0.0228459f, 0.011423f, -1.4639318f, 0.5096237f}, {0.011646f, 0.023292f, 0.011646f, -1.4925167f, 0.5391007f}, {0.0118684f, 0.0237369f, 0.0118684f, -1.5210234f, 0.5684972f}, {0.0120857f, 0.0241714f, 0.0120857f, -1.548867f, 0.5972098f}, {0.0122945f, 0.024589f, 0.0122945f, -1.5756257f, 0.6248037f}, {0.0124927f, 0.0249853f, 0.0124927f, -1.6010198f, 0.6509904f}, {0.0126789f, 0.0253577f, 0.0126789f, -1.6248851f, 0.6756006f}, {0.0128526f, 0.0257052f, 0.0128526f, -1.6471468f, 0.6985571f}, {0.0130137f, 0.0260274f, 0.0130137f, -1.6677959f, 0.7198507f}, {0.0131625f, 0.0263251f, 0.0131625f, -1.6868696f, 0.7395197f}, {0.0132996f, 0.0265992f, 0.0132996f, -1.7044355f, 0.7576339f}, {0.0134256f, 0.0268511f, 0.0134256f, -1.7205796f, 0.7742819f}, {0.0135412f, 0.0270824f, 0.0135412f, -1.735398f, 0.7895628f}, {0.0136473f, 0.0272945f, 0.0136473f, -1.74899f, 0.803579f}, {0.0137445f, 0.027489f, 0.0137445f, -1.7614545f, 0.8164326f}, {0.0138337f, 0.0276674f, 0.0138337f, -1.772887f, 0.8282219f}, {0.0139156f, 0.0278312f, 0.0139156f, -1.7833778f, 0.8390401f}, {0.0139907f, 0.0279815f, 0.0139907f, -1.7930111f, 0.8489741f}, {0.0140598f, 0.0281197f, 0.0140598f, -1.8018648f, 0.8581042f}, {0.0141234f, 0.0282468f, 0.0141234f, -1.8100103f, 0.8665039f}, {0.0141819f, 0.0283639f, 0.0141819f, -1.8175126f, 0.8742404f}, {0.0142359f, 0.0284718f, 0.0142359f, -1.8244308f, 0.8813745f}, {0.0142858f, 0.0285715f, 0.0142858f, -1.8308183f, 0.8879613f}, {0.0143318f, 0.0286637f, 0.0143318f, -1.8367234f, 0.8940507f}, {0.0143745f, 0.028749f, 0.0143745f, -1.8421897f, 0.8996876f}, {0.014414f, 0.028828f, 0.014414f, -1.8472564f, 0.9049125f}, {0.0144507f, 0.0289014f, 0.0144507f, -1.851959f, 0.9097618f}, {0.0144848f, 0.0289696f, 0.0144848f, -1.8563293f, 0.9142686f}, {0.0145165f, 0.0290331f, 0.0145165f, -1.8603961f, 0.9184623f}, {0.0145461f, 0.0290922f, 0.0145461f, -1.8641854f, 0.9223699f}, {0.0145737f, 0.0291474f, 0.0145737f, -1.8677205f, 0.9260153f}, {0.0145995f, 0.0291989f, 0.0145995f, -1.8710226f, 0.9294205f}, {0.0146236f, 0.0292471f, 0.0146236f, -1.8741108f, 0.9326051f}, {0.0146461f, 0.0292922f, 0.0146461f, -1.8770024f, 0.9355869f}, {0.0146673f, 0.0293346f, 0.0146673f, -1.8797131f, 0.9383822f}, {0.0146871f, 0.0293743f, 0.0146871f, -1.882257f, 0.9410055f}, {0.0147058f, 0.0294116f, 0.0147058f, -1.8846471f, 0.9434702f}, {0.0147233f, 0.0294466f, 0.0147233f, -1.8868951f, 0.9457884f}, {0.0147402f, 0.0294804f, 0.0147402f, -1.8890618f, 0.9480227f}, {0.0147571f, 0.0295141f, 0.0147571f, -1.8912205f, 0.9502488f}, {0.0147738f, 0.0295476f, 0.0147738f, -1.8933654f, 0.9524606f}, {0.0147904f, 0.0295808f, 0.0147904f, -1.8954892f, 0.9546507f}, {0.0148067f, 0.0296135f, 0.0148067f, -1.8975847f, 0.9568117f}, {0.0148228f, 0.0296456f, 0.0148228f, -1.8996446f, 0.9589358f}, {0.0148385f, 0.0296771f, 0.0148385f, -1.9016616f, 0.9610158f}, {0.0148539f, 0.0297078f, 0.0148539f, -1.9036292f, 0.9630448f}, {0.0148688f, 0.0297376f, 0.0148688f, -1.9055413f, 0.9650166f}, {0.0148833f, 0.0297665f, 0.0148833f, -1.9073927f, 0.9669257f}, {0.0148972f, 0.0297944f, 0.0148972f, -1.9091788f, 0.9687676f}, {0.0149106f, 0.0298212f, 0.0149106f, -1.9108963f, 0.9705386f}, {0.0149234f, 0.0298469f, 0.0149234f, -1.9125423f, 0.972236f}, {0.0149357f, 0.0298714f, 0.0149357f, -1.9141151f, 0.9738579f}, {0.0149474f, 0.0298948f, 0.0149474f, -1.9156137f, 0.9754033f}, {0.0149585f, 0.029917f, 0.0149585f, -1.9170379f, 0.976872f}, {0.0149691f, 0.0299381f, 0.0149691f, -1.9183882f, 0.9782644f}, {0.014979f, 0.029958f, 0.014979f, -1.9196657f, 0.9795818f}, {0.0149884f, 0.0299769f, 0.0149884f, -1.9208718f, 0.9808256f}},
-          {{0.0086301f, 0.0172602f, 0.0086301f, -1.3876996f, 0.42222f}, {0.0086495f, 0.0172989f, 0.0086495f, -1.3908135f, 0.4254114f}, {0.0087063f, 0.0174126f, 0.0087063f, -1.3999521f, 0.4347773f}, {0.008797f, 0.017594f, 0.008797f, -1.4145386f, 0.4497267f}, {0.0089162f, 0.0178325f, 0.0089162f, -1.4337098f, 0.4693747f}, {0.0090576f, 0.0181151f, 0.0090576f, -1.456435f, 0.4926653f}, {0.0092143f, 0.0184286f, 0.0092143f, -1.4816391f, 0.5184963f}, {0.0093801f, 0.0187603f, 0.0093801f, -1.5083046f, 0.5458251f}, {0.0095495f, 0.0190991f, 0.0095495f, -1.5355424f, 0.5737405f}, {0.009718f, 0.019436f, 0.009718f, -1.5626278f, 0.6014997f}, {0.009882f, 0.0197641f, 0.009882f, -1.5890082f, 0.6285364f}, {0.0100393f, 0.0200786f, 0.0100393f, -1.6142914f, 0.6544485f}, {0.0101881f, 0.0203762f, 0.0101881f, -1.6382225f, 0.6789749f}, {0.0103276f, 0.0206553f, 0.0103276f, -1.6606575f, 0.701968f}, {0.0104575f, 0.020915f, 0.0104575f, -1.6815367f, 0.7233666f}, {0.0105777f, 0.0211553f, 0.0105777f, -1.7008621f, 0.7431727f}, {0.0106885f, 0.0213769f, 0.0106885f, -1.7186776f, 0.7614315f}, {0.0107903f, 0.0215806f, 0.0107903f, -1.7350549f, 0.7782161f}, {0.0108838f, 0.0217675f, 0.0108838f, -1.7500813f, 0.7936164f}, {0.0109694f, 0.0219388f, 0.0109694f, -1.7638525f, 0.8077301f}, {0.0110478f, 0.0220957f, 0.0110478f, -1.7764662f, 0.8206576f}, {0.0111197f, 0.0222394f, 0.0111197f, -1.7880186f, 0.8324974f}, {0.0111855f, 0.022371f, 0.0111855f, -1.7986019f, 0.8433439f}, {0.0112458f, 0.0224917f, 0.0112458f, -1.8083029f, 0.8532862f}, {0.0113012f, 0.0226024f, 0.0113012f, -1.817202f, 0.8624068f}, {0.011352f, 0.022704f, 0.011352f, -1.8253735f, 0.8707815f}, {0.0113987f, 0.0227974f, 0.0113987f, -1.832885f, 0.8784799f}, {0.0114417f, 0.0228834f, 0.0114417f, -1.839798f, 0.8855649f}, {0.0114813f, 0.0229626f, 0.0114813f, -1.8461682f, 0.8920935f}, {0.0115179f, 0.0230357f, 0.0115179f, -1.8520459f, 0.8981174f}, {0.0115516f, 0.0231033f, 0.0115516f, -1.8574764f, 0.903683f}, {0.0115829f, 0.0231658f, 0.0115829f, -1.8625005f, 0.9088321f}, {0.0116118f, 0.0232237f, 0.0116118f, -1.867155f, 0.9136023f}, {0.0116387f, 0.0232774f, 0.0116387f, -1.8714728f, 0.9180276f}, {0.0116636f, 0.0233273f, 0.0116636f, -1.8754838f, 0.9221383f}, {0.0116868f, 0.0233737f, 0.0116868f, -1.8792147f, 0.925962f}, {0.0117084f, 0.0234169f, 0.0117084f, -1.8826896f, 0.9295233f}, {0.0117286f, 0.0234572f, 0.0117286f, -1.8859302f, 0.9328446f}, {0.0117474f, 0.0234948f, 0.0117474f, -1.8889562f, 0.9359459f}, {0.011765f, 0.02353f, 0.011765f, -1.8917853f, 0.9388454f}, {0.0117815f, 0.023563f, 0.0117815f, -1.8944336f, 0.9415595f}, {0.0117969f, 0.0235938f, 0.0117969f, -1.8969154f, 0.9441031f}, {0.0118114f, 0.0236228f, 0.0118114f, -1.899244f, 0.9464895f}, {0.011825f, 0.02365f, 0.011825f, -1.9014312f, 0.9487312f}, {0.0118378f, 0.0236756f, 0.0118378f, -1.9034879f, 0.9508391f}, {0.0118501f, 0.0237002f, 0.0118501f, -1.9054698f, 0.9528703f}, {0.0118624f, 0.0237248f, 0.0118624f, -1.907444f, 0.9548936f}, {0.0118746f, 0.0237492f, 0.0118746f, -1.9094051f, 0.9569034f}, {0.0118867f, 0.0237733f, 0.0118867f, -1.9113465f, 0.9588932f}, {0.0118986f, 0.0237971f, 0.0118986f, -1.9132617f, 0.960856f}, {0.0119103f, 0.0238206f, 0.0119103f, -1.9151439f, 0.962785f}, {0.0119217f, 0.0238435f, 0.0119217f, -1.9169866f, 0.9646735f}, {0.0119329f, 0.0238658f, 0.0119329f, -1.9187837f, 0.9665154f}, {0.0119438f, 0.0238875f, 0.0119438f, -1.9205299f, 0.968305f}, {0.0119543f, 0.0239086f, 0.0119543f, -1.9222203f, 0.9700374f}, {0.0119644f, 0.0239289f, 0.0119644f, -1.9238508f, 0.9717085f}, {0.0119742f, 0.0239484f, 0.0119742f, -1.9254184f, 0.9733151f}, {0.0119835f, 0.023967f, 0.0119835f, -1.9269205f, 0.9748545f}, {0.0119924f, 0.0239849f, 0.0119924f, -1.9283555f, 0.9763253f}, {0.0120009f, 0.0240019f, 0.0120009f, -1.9297227f, 0.9777265f}, {0.012009f, 0.024018f, 0.012009f, -1.9310218f, 0.9790579f}, {0.0120167f, 0.0240334f, 0.0120167f, -1.9322533f, 0.9803201f}, {0.0120239f, 0.0240479f, 0.0120239f, -1.9334183f, 0.981514f}, {0.0120308f, 0.0240615f, 0.0120308f, -1.934518f, 0.9826411f}},
-          {{0.0071181f, 0.0142362f, 0.0071181f, -1.4345878f, 0.4630601f}, {0.0071329f, 0.0142659f, 0.0071329f, -1.4375789f, 0.4661106f}, {0.0071765f, 0.0143529f, 0.0071765f, -1.4463516f, 0.4750575f}, {0.0072458f, 0.0144917f, 0.0072458f, -1.4603373f, 0.4893207f}, {0.0073369f, 0.0146738f, 0.0073369f, -1.4786871f, 0.5080347f}, {0.0074446f, 0.0148892f, 0.0074446f, -1.5003926f, 0.530171f}, {0.0075637f, 0.0151275f, 0.0075637f, -1.5244071f, 0.5546621f}, {0.0076895f, 0.015379f, 0.0076895f, -1.5497474f, 0.5805053f}, {0.0078176f, 0.0156351f, 0.0078176f, -1.575561f, 0.6068313f}, {0.0079446f, 0.0158892f, 0.0079446f, -1.6011598f, 0.6329381f}, {0.008068f, 0.0161359f, 0.008068f, -1.6260251f, 0.6582969f}, {0.0081859f, 0.0163718f, 0.0081859f, -1.6497942f, 0.6825378f}, {0.0082972f, 0.0165945f, 0.0082972f, -1.6722365f, 0.7054255f}, {0.0084014f, 0.0168028f, 0.0084014f, -1.6932267f, 0.7268323f}, {0.0084981f, 0.0169962f, 0.0084981f, -1.7127189f, 0.7467113f}, {0.0085874f, 0.0171749f, 0.0085874f, -1.7307241f, 0.7650739f}, {0.0086696f, 0.0173393f, 0.0086696f, -1.7472917f, 0.7819703f}, {0.0087451f, 0.0174902f, 0.0087451f, -1.7624957f, 0.7974761f}, {0.0088142f, 0.0176284f, 0.0088142f, -1.7764238f, 0.8116806f}, {0.0088774f, 0.0177549f, 0.0088774f, -1.78917f, 0.8246798f}, {0.0089353f, 0.0178706f, 0.0089353f, -1.8008295f, 0.8365707f}, {0.0089882f, 0.0179764f, 0.0089882f, -1.8114951f, 0.8474479f}, {0.0090366f, 0.0180733f, 0.0090366f, -1.8212551f, 0.8574017f}, {0.009081f, 0.018162f, 0.009081f, -1.8301924f, 0.8665164f}, {0.0091216f, 0.0182433f, 0.0091216f, -1.8383835f, 0.87487f}, {0.0091589f, 0.0183178f, 0.0091589f, -1.8458984f, 0.882534f}, {0.0091932f, 0.0183863f, 0.0091932f, -1.8528009f, 0.8895735f}, {0.0092247f, 0.0184493f, 0.0092247f, -1.8591489f, 0.8960475f}, {0.0092537f, 0.0185073f, 0.0092537f, -1.8649945f, 0.9020092f}, {0.0092804f, 0.0185608f, 0.0092804f, -1.870385f, 0.9075066f}, {0.0093051f, 0.0186102f, 0.0093051f, -1.8753625f, 0.9125829f}, {0.0093279f, 0.0186559f, 0.0093279f, -1.8799651f, 0.9172769f}, {0.0093491f, 0.0186982f, 0.0093491f, -1.884227f, 0.9216234f}, {0.0093687f, 0.0187374f, 0.0093687f, -1.888179f, 0.9256538f}, {0.0093869f, 0.0187738f, 0.0093869f, -1.8918485f, 0.9293962f}, {0.0094038f, 0.0188077f, 0.0094038f, -1.8952605f, 0.9328759f}, {0.0094196f, 0.0188392f, 0.0094196f, -1.8984373f, 0.9361157f}, {0.0094343f, 0.0188686f, 0.0094343f, -1.9013989f, 0.9391361f}, {0.009448f, 0.018896f, 0.009448f, -1.9041635f, 0.9419556f}, {0.0094608f, 0.0189217f, 0.0094608f, -1.9067475f, 0.9445908f}, {0.0094728f, 0.0189457f, 0.0094728f, -1.9091655f, 0.9470569f}, {0.0094841f, 0.0189681f, 0.0094841f, -1.9114311f, 0.9493674f}, {0.0094946f, 0.0189892f, 0.0094946f, -1.9135563f, 0.9515347f}, {0.0095045f, 0.019009f, 0.0095045f, -1.915552f, 0.9535701f}, {0.0095138f, 0.0190277f, 0.0095138f, -1.9174282f, 0.9554835f}, {0.0095228f, 0.0190456f, 0.0095228f, -1.9192359f, 0.957327f}, {0.0095317f, 0.0190635f, 0.0095317f, -1.9210361f, 0.959163f}, {0.0095406f, 0.0190812f, 0.0095406f, -1.922824f, 0.9609864f}, {0.0095494f, 0.0190988f, 0.0095494f, -1.9245937f, 0.9627913f}, {0.009558f, 0.0191161f, 0.009558f, -1.9263392f, 0.9645713f}, {0.0095666f, 0.0191331f, 0.0095666f, -1.9280542f, 0.9663204f}, {0.0095749f, 0.0191498f, 0.0095749f, -1.9297329f, 0.9680324f}, {0.009583f, 0.019166f, 0.009583f, -1.9313699f, 0.9697019f}, {0.0095909f, 0.0191818f, 0.0095909f, -1.9329601f, 0.9713236f}, {0.0095985f, 0.0191971f, 0.0095985f, -1.9344992f, 0.9728933f}, {0.0096059f, 0.0192118f, 0.0096059f, -1.9359837f, 0.9744072f}, {0.009613f, 0.0192259f, 0.009613f, -1.9374105f, 0.9758624f}, {0.0096198f, 0.0192395f, 0.0096198f, -1.9387776f, 0.9772566f}, {0.0096262f, 0.0192525f, 0.0096262f, -1.9400834f, 0.9785884f}, {0.0096324f, 0.0192648f, 0.0096324f, -1.9413273f, 0.979857f}, {0.0096383f, 0.0192765f, 0.0096383f, -1.9425092f, 0.9810623f}, {0.0096438f, 0.0192877f, 0.0096438f, -1.9436294f, 0.9822047f}, {0.0096491f, 0.0192982f, 0.0096491f, -1.9446889f, 0.9832853f}, {0.0096541f, 0.0193081f, 0.0096541f, -1.9456891f, 0.9843053f}},
-          {{0.0058597f, 0.0117194f, 0.0058597f, -1.478987f, 0.5024258f}, {0.005871f, 0.0117421f, 0.005871f, -1.4818441f, 0.5053283f}, {0.0059042f, 0.0118084f, 0.0059042f, -1.490219f, 0.5138359f}, {0.005957f, 0.0119141f, 0.005957f, -1.5035548f, 0.527383f}, {0.0060263f, 0.0120525f, 0.0060263f, -1.5210232f, 0.5451283f}, {0.006108f, 0.0122159f, 0.006108f, -1.5416439f, 0.5660757f}, {0.0061981f, 0.0123963f, 0.0061981f, -1.5644052f, 0.5891977f}, {0.0062931f, 0.0125861f, 0.0062931f, -1.5883628f, 0.613535f}, {0.0063895f, 0.012779f, 0.0063895f, -1.6127045f, 0.6382625f}, {0.0064849f, 0.0129698f, 0.0064849f, -1.6367808f, 0.6627204f}, {0.0065773f, 0.0131546f, 0.0065773f, -1.6601076f, 0.6864168f}, {0.0066654f, 0.0133309f, 0.0066654f, -1.6823511f, 0.7090128f}, {0.0067484f, 0.0134969f, 0.0067484f, -1.7033039f, 0.7302977f}, {0.0068259f, 0.0136518f, 0.0068259f, -1.7228581f, 0.7501618f}, {0.0068977f, 0.0137954f, 0.0068977f, -1.7409798f, 0.7685707f}, {0.0069639f, 0.0139278f, 0.0069639f, -1.7576874f, 0.7855431f}, {0.0070247f, 0.0140494f, 0.0070247f, -1.7730343f, 0.8011332f}, {0.0070804f, 0.0141609f, 0.0070804f, -1.7870956f, 0.8154173f}, {0.0071314f, 0.0142628f, 0.0071314f, -1.799958f, 0.8284835f}, {0.007178f, 0.0143559f, 0.007178f, -1.8117132f, 0.840425f}, {0.0072205f, 0.014441f, 0.0072205f, -1.8224529f, 0.851335f}, {0.0072594f, 0.0145188f, 0.0072594f, -1.8322662f, 0.8613038f}, {0.0072949f, 0.0145899f, 0.0072949f, -1.8412372f, 0.8704169f}, {0.0073275f, 0.0146549f, 0.0073275f, -1.8494442f, 0.878754f}, {0.0073572f, 0.0147145f, 0.0073572f, -1.8569595f, 0.8863884f}, {0.0073845f, 0.014769f, 0.0073845f, -1.8638489f, 0.893387f}, {0.0074096f, 0.0148192f, 0.0074096f, -1.8701725f, 0.8998108f}, {0.0074326f, 0.0148652f, 0.0074326f, -1.8759841f, 0.9057145f}, {0.0074538f, 0.0149076f, 0.0074538f, -1.8813326f, 0.9111478f}, {0.0074733f, 0.0149466f, 0.0074733f, -1.8862618f, 0.9161551f}, {0.0074913f, 0.0149827f, 0.0074913f, -1.8908111f, 0.9207765f}, {0.007508f, 0.015016f, 0.007508f, -1.8950157f, 0.9250477f}, {0.0075234f, 0.0150469f, 0.0075234f, -1.8989073f, 0.929001f}, {0.0075377f, 0.0150754f, 0.0075377f, -1.9025145f, 0.9326653f}, {0.007551f, 0.015102f, 0.007551f, -1.9058626f, 0.9360665f}, {0.0075633f, 0.0151266f, 0.0075633f, -1.9089746f, 0.9392278f}, {0.0075748f, 0.0151496f, 0.0075748f, -1.9118711f, 0.9421702f}, {0.0075855f, 0.015171f, 0.0075855f, -1.9145706f, 0.9449125f}, {0.0075955f, 0.0151909f, 0.0075955f, -1.9170898f, 0.9474716f}, {0.0076048f, 0.0152096f, 0.0076048f, -1.9194438f, 0.9498629f}, {0.0076135f, 0.015227f, 0.0076135f, -1.9216461f, 0.9521001f}, {0.0076217f, 0.0152434f, 0.0076217f, -1.923709f, 0.9541957f}, {0.0076294f, 0.0152587f, 0.0076294f, -1.9256436f, 0.956161f}, {0.0076366f, 0.0152731f, 0.0076366f, -1.9274601f, 0.9580063f}, {0.0076433f, 0.0152866f, 0.0076433f, -1.9291674f, 0.9597407f}, {0.0076498f, 0.0152997f, 0.0076498f, -1.930812f, 0.9614114f}, {0.0076563f, 0.0153126f, 0.0076563f, -1.9324496f, 0.9630749f}, {0.0076628f, 0.0153255f, 0.0076628f, -1.9340758f, 0.9647268f}, {0.0076691f, 0.0153383f, 0.0076691f, -1.935685f, 0.9663616f}, {0.0076754f, 0.0153508f, 0.0076754f, -1.9372719f, 0.9679736f}, {0.0076816f, 0.0153632f, 0.0076816f, -1.9388309f, 0.9695573f}, {0.0076876f, 0.0153753f, 0.0076876f, -1.9403566f, 0.9711072f}, {0.0076935f, 0.0153871f, 0.0076935f, -1.9418442f, 0.9726183f}, {0.0076993f, 0.0153985f, 0.0076993f, -1.943289f, 0.9740861f}, {0.0077048f, 0.0154096f, 0.0077048f, -1.9446872f, 0.9755064f}, {0.0077101f, 0.0154203f, 0.0077101f, -1.9460355f, 0.9768761f}, {0.0077153f, 0.0154306f, 0.0077153f, -1.9473313f, 0.9781924f}, {0.0077202f, 0.0154404f, 0.0077202f, -1.9485726f, 0.9794534f}, {0.0077249f, 0.0154498f, 0.0077249f, -1.9497583f, 0.9806578f}, {0.0077294f, 0.0154587f, 0.0077294f, -1.9508875f, 0.981805f}, {0.0077336f, 0.0154672f, 0.0077336f, -1.9519602f, 0.9828947f}, {0.0077376f, 0.0154753f, 0.0077376f, -1.9529769f, 0.9839275f}, {0.0077415f, 0.0154829f, 0.0077415f, -1.9539384f, 0.9849042f}, {0.0077451f, 0.0154901f, 0.0077451f, -1.9548459f, 0.9858261f}},
-          {{0.0048147f, 0.0096294f, 0.0048147f, -1.5208873f, 0.5401462f}, {0.0048233f, 0.0096466f, 0.0048233f, -1.5236022f, 0.5428955f}, {0.0048485f, 0.009697f, 0.0048485f, -1.5315558f, 0.5509498f}, {0.0048885f, 0.0097771f, 0.0048885f, -1.5442066f, 0.5637607f}, {0.0049409f, 0.0098818f, 0.0049409f, -1.5607516f, 0.5805152f}, {0.0050026f, 0.0100053f, 0.0050026f, -1.5802442f, 0.6002547f}, {0.0050706f, 0.0101412f, 0.0050706f, -1.6017127f, 0.621995f}, {0.005142f, 0.0102839f, 0.005142f, -1.6242557f, 0.6448235f}, {0.0052143f, 0.0104286f, 0.0052143f, -1.6471039f, 0.6679611f}, {0.0052857f, 0.0105713f, 0.0052857f, -1.6696473f, 0.6907899f}, {0.0053546f, 0.0107093f, 0.0053546f, -1.6914363f, 0.7128548f}, {0.0054203f, 0.0108405f, 0.0054203f, -1.7121654f, 0.7338464f}, {0.0054819f, 0.0109639f, 0.0054819f, -1.731649f, 0.7535768f}, {0.0055394f, 0.0110788f, 0.0055394f, -1.7497948f, 0.7719523f}, {0.0055925f, 0.011185f, 0.0055925f, -1.7665791f, 0.7889492f}, {0.0056414f, 0.0112828f, 0.0056414f, -1.7820265f, 0.8045922f}, {0.0056863f, 0.0113725f, 0.0056863f, -1.7961929f, 0.8189379f}, {0.0057273f, 0.0114546f, 0.0057273f, -1.8091532f, 0.8320624f}, {0.0057648f, 0.0115295f, 0.0057648f, -1.8209925f, 0.8440516f}, {0.005799f, 0.011598f, 0.005799f, -1.8317992f, 0.8549951f}, {0.0058302f, 0.0116604f, 0.0058302f, -1.8416612f, 0.8649821f}, {0.0058587f, 0.0117174f, 0.0058587f, -1.8506632f, 0.874098f}, {0.0058847f, 0.0117695f, 0.0058847f, -1.8588846f, 0.8824236f}, {0.0059085f, 0.011817f, 0.0059085f, -1.8663995f, 0.8900336f}, {0.0059303f, 0.0118606f, 0.0059303f, -1.8732755f, 0.8969967f}, {0.0059502f, 0.0119005f, 0.0059502f, -1.8795744f, 0.9033753f}, {0.0059685f, 0.011937f, 0.0059685f, -1.885352f, 0.9092261f}, {0.0059853f, 0.0119706f, 0.0059853f, -1.8906587f, 0.9145999f}, {0.0060008f, 0.0120015f, 0.0060008f, -1.8955397f, 0.9195428f}, {0.006015f, 0.01203f, 0.006015f, -1.9000358f, 0.9240958f}, {0.0060281f, 0.0120563f, 0.0060281f, -1.9041833f, 0.9282959f}, {0.0060403f, 0.0120805f, 0.0060403f, -1.908015f, 0.932176f}, {0.0060515f, 0.012103f, 0.0060515f, -1.91156f, 0.9357659f}, {0.0060619f, 0.0121238f, 0.0060619f, -1.9148446f, 0.9390921f}, {0.0060715f, 0.0121431f, 0.0060715f, -1.9178922f, 0.9421784f}, {0.0060805f, 0.012161f, 0.0060805f, -1.920724f, 0.945046f}, {0.0060888f, 0.0121777f, 0.0060888f, -1.923359f, 0.9477143f}, {0.0060966f, 0.0121932f, 0.0060966f, -1.925814f, 0.9502005f}, {0.0061039f, 0.0122077f, 0.0061039f, -1.9281045f, 0.9525199f}, {0.0061106f, 0.0122213f, 0.0061106f, -1.9302442f, 0.9546867f}, {0.006117f, 0.0122339f, 0.006117f, -1.9322456f, 0.9567135f}, {0.0061229f, 0.0122458f, 0.0061229f, -1.9341199f, 0.9586115f}, {0.0061285f, 0.0122569f, 0.0061285f, -1.9358773f, 0.9603912f}, {0.0061337f, 0.0122674f, 0.0061337f, -1.9375271f, 0.9620618f}, {0.0061386f, 0.0122772f, 0.0061386f, -1.9390775f, 0.9636319f}, {0.0061433f, 0.0122867f, 0.0061433f, -1.9405706f, 0.965144f}, {0.006148f, 0.0122961f, 0.006148f, -1.9420572f, 0.9666493f}, {0.0061527f, 0.0123054f, 0.0061527f, -1.9435331f, 0.9681439f}, {0.0061573f, 0.0123147f, 0.0061573f, -1.9449935f, 0.9696228f}, {0.0061619f, 0.0123238f, 0.0061619f, -1.9464333f, 0.9710808f}, {0.0061664f, 0.0123327f, 0.0061664f, -1.9478475f, 0.972513f}, {0.0061707f, 0.0123415f, 0.0061707f, -1.9492315f, 0.9739144f}, {0.006175f, 0.01235f, 0.006175f, -1.9505805f, 0.9752806f}, {0.0061792f, 0.0123583f, 0.0061792f, -1.9518906f, 0.9766073f}, {0.0061832f, 0.0123664f, 0.0061832f, -1.9531583f, 0.977891f}, {0.006187f, 0.0123741f, 0.006187f, -1.9543806f, 0.9791287f}, {0.0061908f, 0.0123815f, 0.0061908f, -1.9555551f, 0.9803181f}, {0.0061943f, 0.0123886f, 0.0061943f, -1.9566801f, 0.9814574f}, {0.0061977f, 0.0123955f, 0.0061977f, -1.9577544f, 0.9825453f}, {0.006201f, 0.0124019f, 0.006201f, -1.9587776f, 0.9835814f}, {0.006204f, 0.0124081f, 0.006204f, -1.9597495f, 0.9845656f}, {0.006207f, 0.0124139f, 0.006207f, -1.9606704f, 0.9854983f}, {0.0062097f, 0.0124194f, 0.0062097f, -1.9615413f, 0.9863802f}, {0.0062123f, 0.0124246f, 0.0062123f, -1.9623633f, 0.9872125f}},
-          {{0.0039489f, 0.0078977f, 0.0039489f, -1.5602944f, 0.5760898f}, {0.0039554f, 0.0079107f, 0.0039554f, -1.5628617f, 0.5786831f}, {0.0039744f, 0.0079488f, 0.0039744f, -1.5703783f, 0.5862758f}, {0.0040046f, 0.0080092f, 0.0040046f, -1.5823216f, 0.59834f}, {0.0040441f, 0.0080882f, 0.0040441f, -1.5979179f, 0.6140942f}, {0.0040905f, 0.008181f, 0.0040905f, -1.6162588f, 0.6326208f}, {0.0041415f, 0.008283f, 0.0041415f, -1.6364165f, 0.6529826f}, {0.004195f, 0.0083899f, 0.004195f, -1.6575356f, 0.6743155f}, {0.004249f, 0.008498f, 0.004249f, -1.678891f, 0.695887f}, {0.0043022f, 0.0086044f, 0.0043022f, -1.6999126f, 0.7171215f}, {0.0043535f, 0.008707f, 0.0043535f, -1.7201849f, 0.737599f}, {0.0044022f, 0.0088044f, 0.0044022f, -1.7394294f, 0.7570383f}, {0.0044479f, 0.0088958f, 0.0044479f, -1.7574806f, 0.7752722f}, {0.0044904f, 0.0089807f, 0.0044904f, -1.7742601f, 0.7922216f}, {0.0045296f, 0.0090592f, 0.0045296f, -1.7897533f, 0.8078716f}, {0.0045656f, 0.0091312f, 0.0045656f, -1.803989f, 0.8222514f}, {0.0045986f, 0.0091972f, 0.0045986f, -1.8170246f, 0.835419f}, {0.0046287f, 0.0092575f, 0.0046287f, -1.828934f, 0.847449f}, {0.0046562f, 0.0093125f, 0.0046562f, -1.8397996f, 0.8584246f}, {0.0046813f, 0.0093626f, 0.0046813f, -1.8497062f, 0.8684315f}, {0.0047042f, 0.0094083f, 0.0047042f, -1.8587374f, 0.8775541f}, {0.004725f, 0.00945f, 0.004725f, -1.8669731f, 0.8858731f}, {0.004744f, 0.0094881f, 0.004744f, -1.8744882f, 0.8934643f}, {0.0047614f, 0.0095228f, 0.0047614f, -1.8813519f, 0.9003975f}, {0.0047773f, 0.0095546f, 0.0047773f, -1.8876276f, 0.9067368f}, {0.0047918f, 0.0095837f, 0.0047918f, -1.8933727f, 0.9125401f}, {0.0048052f, 0.0096103f, 0.0048052f, -1.8986392f, 0.9178598f}, {0.0048174f, 0.0096348f, 0.0048174f, -1.9034737f, 0.9227433f}, {0.0048286f, 0.0096573f, 0.0048286f, -1.9079182f, 0.9272327f}, {0.004839f, 0.009678f, 0.004839f, -1.9120101f, 0.9313661f}, {0.0048485f, 0.0096971f, 0.0048485f, -1.9157832f, 0.9351774f}, {0.0048574f, 0.0097147f, 0.0048574f, -1.9192676f, 0.938697f}, {0.0048655f, 0.009731f, 0.0048655f, -1.9224901f, 0.9419521f}, {0.0048731f, 0.0097461f, 0.0048731f, -1.9254748f, 0.9449671f}, {0.0048801f, 0.0097602f, 0.0048801f, -1.9282434f, 0.9477637f}, {0.0048866f, 0.0097732f, 0.0048866f, -1.9308151f, 0.9503614f}, {0.0048926f, 0.0097853f, 0.0048926f, -1.9332073f, 0.9527779f}, {0.0048983f, 0.0097966f, 0.0048983f, -1.9354357f, 0.9550288f}, {0.0049035f, 0.0098071f, 0.0049035f, -1.9375142f, 0.9571284f}, {0.0049085f, 0.0098169f, 0.0049085f, -1.9394554f, 0.9590893f}, {0.004913f, 0.0098261f, 0.004913f, -1.9412708f, 0.960923f}, {0.0049174f, 0.0098347f, 0.0049174f, -1.9429706f, 0.96264f}, {0.0049214f, 0.0098428f, 0.0049214f, -1.9445641f, 0.9642496f}, {0.0049252f, 0.0098503f, 0.0049252f, -1.9460597f, 0.9657604f}, {0.0049287f, 0.0098575f, 0.0049287f, -1.947465f, 0.9671799f}, {0.0049321f, 0.0098643f, 0.0049321f, -1.9488182f, 0.9685468f}, {0.0049356f, 0.0098711f, 0.0049356f, -1.9501653f, 0.9699075f}, {0.0049389f, 0.0098779f, 0.0049389f, -1.9515024f, 0.9712582f}, {0.0049423f, 0.0098846f, 0.0049423f, -1.9528253f, 0.9725945f}, {0.0049456f, 0.0098912f, 0.0049456f, -1.9541294f, 0.9739118f}, {0.0049488f, 0.0098977f, 0.0049488f, -1.9554102f, 0.9752055f}, {0.004952f, 0.009904f, 0.004952f, -1.9566633f, 0.9764713f}, {0.0049551f, 0.0099102f, 0.0049551f, -1.9578847f, 0.9777051f}, {0.0049581f, 0.0099162f, 0.0049581f, -1.9590706f, 0.978903f}, {0.004961f, 0.009922f, 0.004961f, -1.960218f, 0.980062f}, {0.0049638f, 0.0099276f, 0.0049638f, -1.9613242f, 0.9811794f}, {0.0049665f, 0.009933f, 0.0049665f, -1.962387f, 0.982253f}, {0.0049691f, 0.0099381f, 0.0049691f, -1.9634049f, 0.9832812f}, {0.0049715f, 0.0099431f, 0.0049715f, -1.9643769f, 0.984263f}, {0.0049739f, 0.0099477f, 0.0049739f, -1.9653024f, 0.9851979f}, {0.0049761f, 0.0099522f, 0.0049761f, -1.9661815f, 0.9860858f}, {0.0049782f, 0.0099564f, 0.0049782f, -1.9670144f, 0.9869272f}, {0.0049802f, 0.0099604f, 0.0049802f, -1.967802f, 0.9877228f}, {0.0049821f, 0.0099642f, 0.0049821f, -1.9685453f, 0.9884736f}},
-          {{0.003233f, 0.006466f, 0.003233f, -1.5972311f, 0.6101631f}, {0.0032379f, 0.0064758f, 0.0032379f, -1.5996475f, 0.6125991f}, {0.0032522f, 0.0065044f, 0.0032522f, -1.606719f, 0.6197278f}, {0.0032749f, 0.0065499f, 0.0032749f, -1.6179437f, 0.6310434f}, {0.0033046f, 0.0066091f, 0.0033046f, -1.6325809f, 0.6457992f}, {0.0033393f, 0.0066787f, 0.0033393f, -1.649764f, 0.6631214f}, {0.0033775f, 0.006755f, 0.0033775f, -1.6686119f, 0.6821218f}, {0.0034174f, 0.0068347f, 0.0034174f, -1.6883169f, 0.7019863f}, {0.0034576f, 0.0069152f, 0.0034576f, -1.7081989f, 0.7220294f}, {0.0034971f, 0.0069943f, 0.0034971f, -1.7277279f, 0.7417165f}, {0.0035352f, 0.0070704f, 0.0035352f, -1.746521f, 0.7606617f}, {0.0035712f, 0.0071424f, 0.0035712f, -1.7643253f, 0.7786102f}, {0.003605f, 0.0072099f, 0.003605f, -1.7809938f, 0.7954137f}, {0.0036363f, 0.0072725f, 0.0036363f, -1.7964606f, 0.8110057f}, {0.0036651f, 0.0073303f, 0.0036651f, -1.8107182f, 0.8253787f}, {0.0036916f, 0.0073832f, 0.0036916f, -1.8237988f, 0.8385652f}, {0.0037158f, 0.0074316f, 0.0037158f, -1.83576f, 0.8506233f}, {0.0037379f, 0.0074758f, 0.0037379f, -1.8466741f, 0.8616258f}, {0.003758f, 0.0075161f, 0.003758f, -1.8566201f, 0.8716523f}, {0.0037764f, 0.0075527f, 0.0037764f, -1.8656787f, 0.8807842f}, {0.0037931f, 0.0075861f, 0.0037931f, -1.8739288f, 0.8891011f}, {0.0038083f, 0.0076166f, 0.0038083f, -1.8814457f, 0.8966788f}, {0.0038222f, 0.0076443f, 0.0038222f, -1.8882993f, 0.903588f}, {0.0038348f, 0.0076696f, 0.0038348f, -1.8945544f, 0.9098937f}, {0.0038464f, 0.0076928f, 0.0038464f, -1.9002698f, 0.9156554f}, {0.003857f, 0.0077139f, 0.003857f, -1.9054988f, 0.9209267f}, {0.0038667f, 0.0077333f, 0.0038667f, -1.9102895f, 0.9257562f}, {0.0038756f, 0.0077511f, 0.0038756f, -1.914685f, 0.9301872f}, {0.0038837f, 0.0077675f, 0.0038837f, -1.9187239f, 0.9342589f}, {0.0038913f, 0.0077825f, 0.0038913f, -1.922441f, 0.938006f}, {0.0038982f, 0.0077964f, 0.0038982f, -1.925867f, 0.9414598f}, {0.0039046f, 0.0078092f, 0.0039046f, -1.9290297f, 0.9446481f}, {0.0039105f, 0.007821f, 0.0039105f, -1.9319536f, 0.9475957f}, {0.003916f, 0.007832f, 0.003916f, -1.934661f, 0.9503251f}, {0.0039211f, 0.0078422f, 0.0039211f, -1.9371716f, 0.952856f}, {0.0039258f, 0.0078516f, 0.0039258f, -1.9395031f, 0.9552063f}, {0.0039302f, 0.0078604f, 0.0039302f, -1.9416713f, 0.9573921f}, {0.0039343f, 0.0078686f, 0.0039343f, -1.9436905f, 0.9594276f}, {0.0039381f, 0.0078762f, 0.0039381f, -1.9455735f, 0.9613258f}, {0.0039416f, 0.0078833f, 0.0039416f, -1.9473318f, 0.9630984f}, {0.003945f, 0.00789f, 0.003945f, -1.9489758f, 0.9647557f}, {0.0039481f, 0.0078962f, 0.0039481f, -1.9505148f, 0.9663072f}, {0.003951f, 0.007902f, 0.003951f, -1.9519573f, 0.9677614f}, {0.0039538f, 0.0079075f, 0.0039538f, -1.953311f, 0.969126f}, {0.0039563f, 0.0079127f, 0.0039563f, -1.9545828f, 0.9704081f}, {0.0039588f, 0.0079176f, 0.0039588f, -1.9558073f, 0.9716425f}, {0.0039613f, 0.0079225f, 0.0039613f, -1.9570261f, 0.9728711f}, {0.0039637f, 0.0079274f, 0.0039637f, -1.9582357f, 0.9740906f}, {0.0039661f, 0.0079323f, 0.0039661f, -1.9594323f, 0.9752968f}, {0.0039685f, 0.0079371f, 0.0039685f, -1.9606117f, 0.9764858f}, {0.0039709f, 0.0079417f, 0.0039709f, -1.9617698f, 0.9776533f}, {0.0039732f, 0.0079463f, 0.0039732f, -1.9629028f, 0.9787955f}, {0.0039754f, 0.0079508f, 0.0039754f, -1.964007f, 0.9799086f}, {0.0039776f, 0.0079551f, 0.0039776f, -1.965079f, 0.9809893f}, {0.0039797f, 0.0079593f, 0.0039797f, -1.9661161f, 0.9820347f}, {0.0039817f, 0.0079634f, 0.0039817f, -1.9671157f, 0.9830425f}, {0.0039836f, 0.0079673f, 0.0039836f, -1.9680761f, 0.9840106f}, {0.0039855f, 0.007971f, 0.0039855f, -1.9689958f, 0.9849378f}, {0.0039873f, 0.0079746f, 0.0039873f, -1.9698739f, 0.985823f}, {0.003989f, 0.0079779f, 0.003989f, -1.97071f, 0.9866659f}, {0.0039906f, 0.0079812f, 0.0039906f, -1.971504f, 0.9874663f}, {0.0039921f, 0.0079842f, 0.0039921f, -1.9722563f, 0.9882247f}, {0.0039935f, 0.0079871f, 0.0039935f, -1.9729676f, 0.9889418f}, {0.0039949f, 0.0079898f, 0.0039949f, -1.9736388f, 0.9896184f}},
-          {{0.0026425f, 0.0052849f, 0.0026425f, -1.6317371f, 0.6423069f}, {0.0026461f, 0.0052922f, 0.0026461f, -1.6340019f, 0.6445864f}, {0.0026568f, 0.0053137f, 0.0026568f, -1.6406264f, 0.6512538f}, {0.0026739f, 0.0053477f, 0.0026739f, -1.6511317f, 0.6618272f}, {0.002696f, 0.005392f, 0.002696f, -1.6648125f, 0.6755966f}, {0.002722f, 0.005444f, 0.002722f, -1.6808466f, 0.6917345f}, {0.0027504f, 0.0055008f, 0.0027504f, -1.6984015f, 0.7094031f}, {0.0027801f, 0.0055601f, 0.0027801f, -1.7167184f, 0.7278386f}, {0.0028099f, 0.0056199f, 0.0028099f, -1.7351623f, 0.746402f}, {0.0028392f, 0.0056784f, 0.0028392f, -1.7532421f, 0.7645989f}, {0.0028673f, 0.0057347f, 0.0028673f, -1.7706064f, 0.7820757f}, {0.0028939f, 0.0057879f, 0.0028939f, -1.7870263f, 0.798602f}, {0.0029188f, 0.0058376f, 0.0029188f, -1.8023716f, 0.8140468f}, {0.0029418f, 0.0058836f, 0.0029418f, -1.8165873f, 0.8283545f}, {0.002963f, 0.005926f, 0.002963f, -1.8296716f, 0.8415236f}, {0.0029824f, 0.0059648f, 0.0029824f, -1.8416591f, 0.8535887f}, {0.0030001f, 0.0060003f, 0.0030001f, -1.8526067f, 0.8646073f}, {0.0030163f, 0.0060326f, 0.0030163f, -1.8625843f, 0.8746495f}, {0.003031f, 0.006062f, 0.003031f, -1.8716672f, 0.8837912f}, {0.0030444f, 0.0060888f, 0.0030444f, -1.8799317f, 0.8921092f}, {0.0030566f, 0.0061131f, 0.0030566f, -1.887452f, 0.8996782f}, {0.0030676f, 0.0061353f, 0.0030676f, -1.8942984f, 0.9065689f}, {0.0030777f, 0.0061555f, 0.0030777f, -1.9005362f, 0.9128471f}, {0.003087f, 0.0061739f, 0.003087f, -1.9062254f, 0.9185732f}, {0.0030954f, 0.0061907f, 0.0030954f, -1.9114205f, 0.923802f}, {0.0031031f, 0.0062061f, 0.0031031f, -1.9161709f, 0.9285832f}, {0.0031101f, 0.0062202f, 0.0031101f, -1.9205209f, 0.9329613f}, {0.0031166f, 0.0062331f, 0.0031166f, -1.9245102f, 0.9369764f}, {0.0031225f, 0.006245f, 0.0031225f, -1.9281743f, 0.9406643f}, {0.003128f, 0.0062559f, 0.003128f, -1.9315451f, 0.9440569f}, {0.003133f, 0.006266f, 0.003133f, -1.9346508f, 0.9471828f}, {0.0031376f, 0.0062753f, 0.0031376f, -1.9375168f, 0.9500674f}, {0.0031419f, 0.0062838f, 0.0031419f, -1.9401657f, 0.9527334f}, {0.0031459f, 0.0062918f, 0.0031459f, -1.9426178f, 0.9552013f}, {0.0031496f, 0.0062991f, 0.0031496f, -1.9448909f, 0.9574892f}, {0.003153f, 0.006306f, 0.003153f, -1.9470014f, 0.9596133f}, {0.0031562f, 0.0063123f, 0.0031562f, -1.9489636f, 0.9615883f}, {0.0031591f, 0.0063183f, 0.0031591f, -1.9507906f, 0.9634271f}, {0.0031619f, 0.0063238f, 0.0031619f, -1.952494f, 0.9651415f}, {0.0031645f, 0.0063289f, 0.0031645f, -1.9540843f, 0.9667422f}, {0.0031669f, 0.0063337f, 0.0031669f, -1.955571f, 0.9682385f}, {0.0031691f, 0.0063382f, 0.0031691f, -1.9569625f, 0.969639f}, {0.0031712f, 0.0063425f, 0.0031712f, -1.9582666f, 0.9709515f}, {0.0031732f, 0.0063464f, 0.0031732f, -1.9594902f, 0.9721831f}, {0.0031751f, 0.0063502f, 0.0031751f, -1.9606396f, 0.9733399f}, {0.0031769f, 0.0063537f, 0.0031769f, -1.9617462f, 0.9744536f}, {0.0031787f, 0.0063573f, 0.0031787f, -1.9628473f, 0.9755619f}, {0.0031804f, 0.0063608f, 0.0031804f, -1.9639402f, 0.9766619f}, {0.0031822f, 0.0063643f, 0.0031822f, -1.9650211f, 0.9777497f}, {0.0031839f, 0.0063678f, 0.0031839f, -1.9660863f, 0.9788219f}, {0.0031856f, 0.0063712f, 0.0031856f, -1.9671323f, 0.9798746f}, {0.0031872f, 0.0063745f, 0.0031872f, -1.9681554f, 0.9809044f}, {0.0031889f, 0.0063777f, 0.0031889f, -1.9691523f, 0.9819078f}, {0.0031904f, 0.0063809f, 0.0031904f, -1.9701202f, 0.9828819f}, {0.0031919f, 0.0063839f, 0.0031919f, -1.9710563f, 0.9838241f}, {0.0031934f, 0.0063868f, 0.0031934f, -1.9719586f, 0.9847322f}, {0.0031948f, 0.0063896f, 0.0031948f, -1.9728254f, 0.9856046f}, {0.0031962f, 0.0063923f, 0.0031962f, -1.9736553f, 0.98644f}, {0.0031974f, 0.0063949f, 0.0031974f, -1.9744477f, 0.9872375f}, {0.0031987f, 0.0063973f, 0.0031987f, -1.9752021f, 0.9879967f}, {0.0031998f, 0.0063996f, 0.0031998f, -1.9759185f, 0.9887178f}, {0.0032009f, 0.0064018f, 0.0032009f, -1.9765972f, 0.9894008f}, {0.003202f, 0.0064039f, 0.003202f, -1.9772388f, 0.9900466f}, {0.0032029f, 0.0064059f, 0.0032029f, -1.9778442f, 0.990656f}},
-          {{0.0021563f, 0.0043126f, 0.0021563f, -1.6638685f, 0.6724938f}, {0.002159f, 0.0043181f, 0.002159f, -1.6659828f, 0.674619f}, {0.0021671f, 0.0043341f, 0.0021671f, -1.6721641f, 0.6808324f}, {0.0021798f, 0.0043595f, 0.0021798f, -1.6819579f, 0.6906769f}, {0.0021963f, 0.0043925f, 0.0021963f, -1.6946963f, 0.7034813f}, {0.0022156f, 0.0044312f, 0.0022156f, -1.7096028f, 0.7184651f}, {0.0022367f, 0.0044734f, 0.0022367f, -1.725895f, 0.7348418f}, {0.0022587f, 0.0045174f, 0.0022587f, -1.742863f, 0.7518977f}, {0.0022808f, 0.0045616f, 0.0022808f, -1.7599163f, 0.7690394f}, {0.0023024f, 0.0046048f, 0.0023024f, -1.7766016f, 0.7858112f}, {0.0023231f, 0.0046463f, 0.0023231f, -1.7925974f, 0.80189f}, {0.0023427f, 0.0046854f, 0.0023427f, -1.807697f, 0.8170679f}, {0.002361f, 0.0047219f, 0.002361f, -1.8217855f, 0.8312294f}, {0.0023778f, 0.0047557f, 0.0023778f, -1.8348171f, 0.8443285f}, {0.0023934f, 0.0047867f, 0.0023934f, -1.8467948f, 0.8563683f}, {0.0024076f, 0.0048152f, 0.0024076f, -1.8577543f, 0.8673846f}, {0.0024205f, 0.0048411f, 0.0024205f, -1.8677515f, 0.8774336f}, {0.0024323f, 0.0048647f, 0.0024323f, -1.8768531f, 0.8865824f}, {0.0024431f, 0.0048861f, 0.0024431f, -1.8851304f, 0.8949026f}, {0.0024528f, 0.0049056f, 0.0024528f, -1.8926552f, 0.9024665f}, {0.0024617f, 0.0049233f, 0.0024617f, -1.899497f, 0.9093437f}, {0.0024697f, 0.0049395f, 0.0024697f, -1.905721f, 0.9156f}, {0.0024771f, 0.0049542f, 0.0024771f, -1.9113881f, 0.9212964f}, {0.0024838f, 0.0049676f, 0.0024838f, -1.9165536f, 0.9264887f}, {0.0024899f, 0.0049798f, 0.0024899f, -1.9212679f, 0.9312274f}, {0.0024955f, 0.0049909f, 0.0024955f, -1.9255764f, 0.9355583f}, {0.0025006f, 0.0050012f, 0.0025006f, -1.9295199f, 0.9395222f}, {0.0025053f, 0.0050105f, 0.0025053f, -1.9331349f, 0.943156f}, {0.0025096f, 0.0050191f, 0.0025096f, -1.9364539f, 0.9464922f}, {0.0025135f, 0.005027f, 0.0025135f, -1.9395062f, 0.9495603f}, {0.0025172f, 0.0050343f, 0.0025172f, -1.9423175f, 0.9523861f}, {0.0025205f, 0.0050411f, 0.0025205f, -1.944911f, 0.9549931f}, {0.0025236f, 0.0050473f, 0.0025236f, -1.9473074f, 0.9574019f}, {0.0025265f, 0.005053f, 0.0025265f, -1.9495251f, 0.9596311f}, {0.0025292f, 0.0050583f, 0.0025292f, -1.9515805f, 0.9616972f}, {0.0025316f, 0.0050633f, 0.0025316f, -1.9534884f, 0.963615f}, {0.0025339f, 0.0050679f, 0.0025339f, -1.9552619f, 0.9653977f}, {0.0025361f, 0.0050722f, 0.0025361f, -1.9569129f, 0.9670572f}, {0.0025381f, 0.0050762f, 0.0025381f, -1.9584519f, 0.9686042f}, {0.0025399f, 0.0050799f, 0.0025399f, -1.9598885f, 0.9700483f}, {0.0025417f, 0.0050834f, 0.0025417f, -1.9612313f, 0.971398f}, {0.0025433f, 0.0050866f, 0.0025433f, -1.9624879f, 0.9726611f}, {0.0025448f, 0.0050897f, 0.0025448f, -1.9636654f, 0.9738447f}, {0.0025463f, 0.0050925f, 0.0025463f, -1.9647701f, 0.9749552f}, {0.0025476f, 0.0050952f, 0.0025476f, -1.9658077f, 0.9759982f}, {0.0025489f, 0.0050978f, 0.0025489f, -1.9668065f, 0.9770021f}, {0.0025502f, 0.0051004f, 0.0025502f, -1.9678003f, 0.9780011f}, {0.0025515f, 0.0051029f, 0.0025515f, -1.9687865f, 0.9789924f}, {0.0025527f, 0.0051055f, 0.0025527f, -1.9697618f, 0.9799727f}, {0.002554f, 0.005108f, 0.002554f, -1.9707229f, 0.9809388f}, {0.0025552f, 0.0051104f, 0.0025552f, -1.9716665f, 0.9818873f}, {0.0025564f, 0.0051128f, 0.0025564f, -1.9725893f, 0.9828149f}, {0.0025576f, 0.0051151f, 0.0025576f, -1.9734885f, 0.9837188f}, {0.0025587f, 0.0051174f, 0.0025587f, -1.9743614f, 0.9845961f}, {0.0025598f, 0.0051196f, 0.0025598f, -1.9752055f, 0.9854447f}, {0.0025608f, 0.0051217f, 0.0025608f, -1.9760191f, 0.9862625f}, {0.0025619f, 0.0051237f, 0.0025619f, -1.9768006f, 0.987048f}, {0.0025628f, 0.0051256f, 0.0025628f, -1.9775488f, 0.9878001f}, {0.0025638f, 0.0051275f, 0.0025638f, -1.9782631f, 0.9885181f}, {0.0025646f, 0.0051293f, 0.0025646f, -1.978943f, 0.9892016f}, {0.0025655f, 0.0051309f, 0.0025655f, -1.9795887f, 0.9898506f}, {0.0025663f, 0.0051325f, 0.0025663f, -1.9802004f, 0.9904654f}, {0.002567f, 0.005134f, 0.002567f, -1.9807786f, 0.9910466f}, {0.0025677f, 0.0051354f, 0.0025677f, -1.9813241f, 0.991595f}},
-          {{0.0017569f, 0.0035139f, 0.0017569f, -1.6936963f, 0.700724f}, {0.001759f, 0.0035179f, 0.001759f, -1.6956627f, 0.7026986f}, {0.0017649f, 0.0035299f, 0.0017649f, -1.7014094f, 0.7084691f}, {0.0017744f, 0.0035487f, 0.0017744f, -1.710507f, 0.7176045f}, {0.0017866f, 0.0035733f, 0.0017866f, -1.722326f, 0.7294725f}, {0.001801f, 0.0036019f, 0.001801f, -1.736137f, 0.7433408f}, {0.0018166f, 0.0036332f, 0.0018166f, -1.7512075f, 0.7584739f}, {0.0018328f, 0.0036657f, 0.0018328f, -1.7668762f, 0.7742075f}, {0.0018492f, 0.0036983f, 0.0018492f, -1.782596f, 0.7899926f}, {0.0018651f, 0.0037302f, 0.0018651f, -1.7979499f, 0.8054102f}, {0.0018803f, 0.0037606f, 0.0018803f, -1.8126446f, 0.8201659f}, {0.0018947f, 0.0037894f, 0.0018947f, -1.8264938f, 0.8340725f}, {0.0019081f, 0.0038161f, 0.0019081f, -1.8393962f, 0.8470285f}, {0.0019204f, 0.0038409f, 0.0019204f, -1.851314f, 0.8589957f}, {0.0019318f, 0.0038636f, 0.0019318f, -1.862254f, 0.8699811f}, {0.0019422f, 0.0038843f, 0.0019422f, -1.8722522f, 0.8800209f}, {0.0019516f, 0.0039032f, 0.0019516f, -1.8813627f, 0.8891692f}, {0.0019602f, 0.0039204f, 0.0019602f, -1.889649f, 0.8974898f}, {0.001968f, 0.003936f, 0.001968f, -1.8971781f, 0.9050501f}, {0.0019751f, 0.0039502f, 0.0019751f, -1.9040172f, 0.9119176f}, {0.0019816f, 0.0039631f, 0.0019816f, -1.9102309f, 0.9181571f}, {0.0019874f, 0.0039748f, 0.0019874f, -1.9158798f, 0.9238294f}, {0.0019927f, 0.0039855f, 0.0019927f, -1.92102f, 0.928991f}, {0.0019976f, 0.0039952f, 0.0019976f, -1.9257028f, 0.9336932f}, {0.002002f, 0.0040041f, 0.002002f, -1.9299743f, 0.9379824f}, {0.0020061f, 0.0040122f, 0.0020061f, -1.9338764f, 0.9419007f}, {0.0020098f, 0.0040196f, 0.0020098f, -1.9374464f, 0.9454855f}, {0.0020132f, 0.0040264f, 0.0020132f, -1.9407177f, 0.9487704f}, {0.0020163f, 0.0040326f, 0.0020163f, -1.9437202f, 0.9517853f}, {0.0020192f, 0.0040383f, 0.0020192f, -1.9464803f, 0.9545569f}, {0.0020218f, 0.0040436f, 0.0020218f, -1.9490219f, 0.957109f}, {0.0020242f, 0.0040484f, 0.0020242f, -1.9513659f, 0.9594628f}, {0.0020265f, 0.0040529f, 0.0020265f, -1.9535312f, 0.9616371f}, {0.0020285f, 0.0040571f, 0.0020285f, -1.9555346f, 0.9636488f}, {0.0020305f, 0.0040609f, 0.0020305f, -1.957391f, 0.9655128f}, {0.0020323f, 0.0040645f, 0.0020323f, -1.9591137f, 0.9672428f}, {0.0020339f, 0.0040678f, 0.0020339f, -1.9607149f, 0.9688506f}, {0.0020355f, 0.0040709f, 0.0020355f, -1.9622051f, 0.970347f}, {0.0020369f, 0.0040738f, 0.0020369f, -1.9635941f, 0.9717417f}, {0.0020383f, 0.0040765f, 0.0020383f, -1.9648904f, 0.9730434f}, {0.0020395f, 0.004079f, 0.0020395f, -1.9661019f, 0.9742599f}, {0.0020407f, 0.0040814f, 0.0020407f, -1.9672355f, 0.9753983f}, {0.0020418f, 0.0040836f, 0.0020418f, -1.9682976f, 0.9764648f}, {0.0020428f, 0.0040856f, 0.0020428f, -1.969294f, 0.9774653f}, {0.0020438f, 0.0040876f, 0.0020438f, -1.9702297f, 0.9784049f}, {0.0020447f, 0.0040895f, 0.0020447f, -1.9711303f, 0.9793092f}, {0.0020457f, 0.0040913f, 0.0020457f, -1.9720263f, 0.980209f}, {0.0020466f, 0.0040932f, 0.0020466f, -1.9729154f, 0.9811017f}, {0.0020475f, 0.004095f, 0.0020475f, -1.9737946f, 0.9819845f}, {0.0020484f, 0.0040968f, 0.0020484f, -1.9746609f, 0.9828544f}, {0.0020493f, 0.0040985f, 0.0020493f, -1.9755113f, 0.9837083f}, {0.0020501f, 0.0041003f, 0.0020501f, -1.9763429f, 0.9845434f}, {0.002051f, 0.0041019f, 0.002051f, -1.9771532f, 0.985357f}, {0.0020518f, 0.0041036f, 0.0020518f, -1.9779396f, 0.9861467f}, {0.0020526f, 0.0041052f, 0.0020526f, -1.9787001f, 0.9869104f}, {0.0020533f, 0.0041067f, 0.0020533f, -1.979433f, 0.9876464f}, {0.0020541f, 0.0041081f, 0.0020541f, -1.980137f, 0.9883532f}, {0.0020548f, 0.0041095f, 0.0020548f, -1.9808109f, 0.98903f}, {0.0020554f, 0.0041109f, 0.0020554f, -1.9814542f, 0.9896759f}, {0.0020561f, 0.0041121f, 0.0020561f, -1.9820666f, 0.9902908f}, {0.0020567f, 0.0041133f, 0.0020567f, -1.982648f, 0.9908747f}, {0.0020572f, 0.0041145f, 0.0020572f, -1.9831988f, 0.9914277f}, {0.0020578f, 0.0041156f, 0.0020578f, -1.9837194f, 0.9919505f}, {0.0020583f, 0.0041166f, 0.0020583f, -1.9842106f, 0.9924438f}},
-          {{0.0014295f, 0.002859f, 0.0014295f, -1.7213039f, 0.7270218f}, {0.001431f, 0.002862f, 0.001431f, -1.7231266f, 0.7288506f}, {0.0014354f, 0.0028708f, 0.0014354f, -1.7284511f, 0.7341928f}, {0.0014424f, 0.0028848f, 0.0014424f, -1.7368738f, 0.7426434f}, {0.0014515f, 0.002903f, 0.0014515f, -1.7478042f, 0.7536102f}, {0.0014621f, 0.0029242f, 0.0014621f, -1.7605599f, 0.7664082f}, {0.0014736f, 0.0029473f, 0.0014736f, -1.774458f, 0.7803525f}, {0.0014856f, 0.0029712f, 0.0014856f, -1.7888848f, 0.7948272f}, {0.0014976f, 0.0029952f, 0.0014976f, -1.8033353f, 0.8093257f}, {0.0015093f, 0.0030186f, 0.0015093f, -1.8174267f, 0.823464f}, {0.0015205f, 0.003041f, 0.0015205f, -1.8308922f, 0.8369742f}, {0.001531f, 0.003062f, 0.001531f, -1.8435643f, 0.8496884f}, {0.0015408f, 0.0030816f, 0.0015408f, -1.8553539f, 0.8615171f}, {0.0015498f, 0.0030997f, 0.0015498f, -1.8662298f, 0.8724292f}, {0.0015581f, 0.0031162f, 0.0015581f, -1.8762017f, 0.8824342f}, {0.0015657f, 0.0031314f, 0.0015657f, -1.8853054f, 0.8915681f}, {0.0015726f, 0.0031451f, 0.0015726f, -1.8935926f, 0.8998828f}, {0.0015788f, 0.0031576f, 0.0015788f, -1.9011232f, 0.9074385f}, {0.0015845f, 0.003169f, 0.0015845f, -1.9079603f, 0.9142983f}, {0.0015897f, 0.0031793f, 0.0015897f, -1.9141661f, 0.9205247f}, {0.0015943f, 0.0031887f, 0.0015943f, -1.9198007f, 0.9261781f}, {0.0015986f, 0.0031972f, 0.0015986f, -1.9249201f, 0.9313144f}, {0.0016024f, 0.0032049f, 0.0016024f, -1.9295759f, 0.9359857f}, {0.001606f, 0.0032119f, 0.001606f, -1.9338151f, 0.940239f}, {0.0016092f, 0.0032184f, 0.0016092f, -1.9376803f, 0.944117f}, {0.0016121f, 0.0032242f, 0.0016121f, -1.9412098f, 0.9476582f}, {0.0016148f, 0.0032296f, 0.0016148f, -1.9444376f, 0.9508967f}, {0.0016172f, 0.0032345f, 0.0016172f, -1.9473943f, 0.9538633f}, {0.0016195f, 0.003239f, 0.0016195f, -1.9501072f, 0.9565852f}, {0.0016216f, 0.0032431f, 0.0016216f, -1.9526004f, 0.9590867f}, {0.0016235f, 0.0032469f, 0.0016235f, -1.9548955f, 0.9613894f}, {0.0016252f, 0.0032505f, 0.0016252f, -1.9570117f, 0.9635126f}, {0.0016269f, 0.0032537f, 0.0016269f, -1.9589661f, 0.9654735f}, {0.0016284f, 0.0032567f, 0.0016284f, -1.960774f, 0.9672874f}, {0.0016297f, 0.0032595f, 0.0016297f, -1.9624488f, 0.9689678f}, {0.001631f, 0.0032621f, 0.001631f, -1.9640029f, 0.970527f}, {0.0016322f, 0.0032645f, 0.0016322f, -1.965447f, 0.9719759f}, {0.0016334f, 0.0032667f, 0.0016334f, -1.9667908f, 0.9733242f}, {0.0016344f, 0.0032688f, 0.0016344f, -1.9680432f, 0.9745807f}, {0.0016354f, 0.0032707f, 0.0016354f, -1.9692118f, 0.9757533f}, {0.0016363f, 0.0032725f, 0.0016363f, -1.9703038f, 0.9768489f}, {0.0016371f, 0.0032742f, 0.0016371f, -1.9713256f, 0.9778741f}, {0.0016379f, 0.0032758f, 0.0016379f, -1.9722828f, 0.9788344f}, {0.0016387f, 0.0032773f, 0.0016387f, -1.9731805f, 0.9797352f}, {0.0016394f, 0.0032787f, 0.0016394f, -1.9740236f, 0.9805811f}, {0.00164f, 0.0032801f, 0.00164f, -1.974835f, 0.9813951f}, {0.0016407f, 0.0032814f, 0.0016407f, -1.9756422f, 0.982205f}, {0.0016414f, 0.0032827f, 0.0016414f, -1.976443f, 0.9830085f}, {0.001642f, 0.0032841f, 0.001642f, -1.9772348f, 0.983803f}, {0.0016427f, 0.0032853f, 0.0016427f, -1.978015f, 0.9845857f}, {0.0016433f, 0.0032866f, 0.0016433f, -1.9787808f, 0.985354f}, {0.0016439f, 0.0032879f, 0.0016439f, -1.9795297f, 0.9861054f}, {0.0016445f, 0.0032891f, 0.0016445f, -1.9802592f, 0.9868373f}, {0.0016451f, 0.0032903f, 0.0016451f, -1.9809672f, 0.9875477f}, {0.0016457f, 0.0032914f, 0.0016457f, -1.9816518f, 0.9882346f}, {0.0016462f, 0.0032925f, 0.0016462f, -1.9823115f, 0.9888965f}, {0.0016468f, 0.0032935f, 0.0016468f, -1.9829451f, 0.9895322f}, {0.0016473f, 0.0032945f, 0.0016473f, -1.9835517f, 0.9901408f}, {0.0016478f, 0.0032955f, 0.0016478f, -1.9841306f, 0.9907216f}, {0.0016482f, 0.0032964f, 0.0016482f, -1.9846817f, 0.9912745f}, {0.0016486f, 0.0032973f, 0.0016486f, -1.9852049f, 0.9917995f}, {0.0016491f, 0.0032981f, 0.0016491f, -1.9857005f, 0.9922967f}, {0.0016494f, 0.0032989f, 0.0016494f, -1.9861689f, 0.9927667f}, {0.0016498f, 0.0032996f, 0.0016498f, -1.9866108f, 0.9932101f}},
-          {{0.0011615f, 0.002323f, 0.0011615f, -1.7467854f, 0.7514314f}, {0.0011626f, 0.0023253f, 0.0011626f, -1.7484695f, 0.75312f}, {0.0011659f, 0.0023318f, 0.0011659f, -1.7533873f, 0.7580509f}, {0.0011711f, 0.0023421f, 0.0011711f, -1.7611613f, 0.7658455f}, {0.0011778f, 0.0023555f, 0.0011778f, -1.7712396f, 0.7759507f}, {0.0011856f, 0.0023712f, 0.0011856f, -1.7829864f, 0.7877287f}, {0.0011941f, 0.0023882f, 0.0011941f, -1.7957677f, 0.800544f}, {0.0012029f, 0.0024058f, 0.0012029f, -1.8090157f, 0.8138273f}, {0.0012117f, 0.0024234f, 0.0012117f, -1.8222657f, 0.8271125f}, {0.0012203f, 0.0024406f, 0.0012203f, -1.8351673f, 0.8400484f}, {0.0012285f, 0.0024569f, 0.0012285f, -1.8474784f, 0.8523922f}, {0.0012362f, 0.0024723f, 0.0012362f, -1.8590484f, 0.863993f}, {0.0012433f, 0.0024866f, 0.0012433f, -1.869799f, 0.8747722f}, {0.0012499f, 0.0024998f, 0.0012499f, -1.879705f, 0.8847045f}, {0.0012559f, 0.0025119f, 0.0012559f, -1.8887777f, 0.8938014f}, {0.0012614f, 0.0025229f, 0.0012614f, -1.8970524f, 0.9020981f}, {0.0012664f, 0.0025329f, 0.0012664f, -1.9045782f, 0.9096439f}, {0.001271f, 0.002542f, 0.001271f, -1.9114114f, 0.9164953f}, {0.0012751f, 0.0025502f, 0.0012751f, -1.9176107f, 0.9227111f}, {0.0012788f, 0.0025577f, 0.0012788f, -1.9232339f, 0.9283493f}, {0.0012822f, 0.0025645f, 0.0012822f, -1.9283363f, 0.9334653f}, {0.0012853f, 0.0025706f, 0.0012853f, -1.9329696f, 0.9381109f}, {0.0012881f, 0.0025762f, 0.0012881f, -1.9371812f, 0.9423337f}, {0.0012907f, 0.0025813f, 0.0012907f, -1.9410143f, 0.946177f}, {0.001293f, 0.002586f, 0.001293f, -1.9445078f, 0.9496797f}, {0.0012951f, 0.0025902f, 0.0012951f, -1.9476965f, 0.9528769f}, {0.001297f, 0.0025941f, 0.001297f, -1.9506117f, 0.9557999f}, {0.0012988f, 0.0025976f, 0.0012988f, -1.9532812f, 0.9584765f}, {0.0013004f, 0.0026009f, 0.0013004f, -1.9557299f, 0.9609317f}, {0.0013019f, 0.0026039f, 0.0013019f, -1.9579797f, 0.9631874f}, {0.0013033f, 0.0026066f, 0.0013033f, -1.9600502f, 0.9652635f}, {0.0013046f, 0.0026092f, 0.0013046f, -1.9619589f, 0.9671772f}, {0.0013058f, 0.0026115f, 0.0013058f, -1.9637213f, 0.9689443f}, {0.0013068f, 0.0026137f, 0.0013068f, -1.9653512f, 0.9705785f}, {0.0013078f, 0.0026157f, 0.0013078f, -1.9668609f, 0.9720923f}, {0.0013088f, 0.0026176f, 0.0013088f, -1.9682615f, 0.9734966f}, {0.0013096f, 0.0026193f, 0.0013096f, -1.9695628f, 0.9748014f}, {0.0013105f, 0.0026209f, 0.0013105f, -1.9707736f, 0.9760154f}, {0.0013112f, 0.0026224f, 0.0013112f, -1.9719018f, 0.9771466f}, {0.0013119f, 0.0026238f, 0.0013119f, -1.9729545f, 0.9782021f}, {0.0013126f, 0.0026251f, 0.0013126f, -1.9739381f, 0.9791883f}, {0.0013132f, 0.0026263f, 0.0013132f, -1.9748582f, 0.9801109f}, {0.0013137f, 0.0026275f, 0.0013137f, -1.9757201f, 0.9809751f}, {0.0013143f, 0.0026286f, 0.0013143f, -1.9765285f, 0.9817856f}, {0.0013148f, 0.0026296f, 0.0013148f, -1.9772875f, 0.9825466f}, {0.0013153f, 0.0026305f, 0.0013153f, -1.9780179f, 0.983279f}, {0.0013158f, 0.0026315f, 0.0013158f, -1.9787445f, 0.9840075f}, {0.0013162f, 0.0026325f, 0.0013162f, -1.9794653f, 0.9847302f}, {0.0013167f, 0.0026334f, 0.0013167f, -1.980178f, 0.9854448f}, {0.0013172f, 0.0026343f, 0.0013172f, -1.9808801f, 0.9861488f}, {0.0013176f, 0.0026353f, 0.0013176f, -1.9815692f, 0.9868397f}, {0.0013181f, 0.0026362f, 0.0013181f, -1.982243f, 0.9875153f}, {0.0013185f, 0.002637f, 0.0013185f, -1.9828994f, 0.9881734f}, {0.0013189f, 0.0026379f, 0.0013189f, -1.9835363f, 0.9888121f}, {0.0013193f, 0.0026387f, 0.0013193f, -1.9841522f, 0.9894296f}, {0.0013197f, 0.0026395f, 0.0013197f, -1.9847457f, 0.9900246f}, {0.0013201f, 0.0026402f, 0.0013201f, -1.9853156f, 0.990596f}, {0.0013205f, 0.002641f, 0.0013205f, -1.9858611f, 0.991143f}, {0.0013208f, 0.0026417f, 0.0013208f, -1.9863818f, 0.9916651f}, {0.0013212f, 0.0026423f, 0.0013212f, -1.9868774f, 0.992162f}, {0.0013215f, 0.0026429f, 0.0013215f, -1.9873479f, 0.9926337f}, {0.0013218f, 0.0026435f, 0.0013218f, -1.9877935f, 0.9930806f}, {0.001322f, 0.0026441f, 0.001322f, -1.9882147f, 0.9935029f}, {0.0013223f, 0.0026446f, 0.0013223f, -1.988612f, 0.9939013f}},
-          {{0.0009426f, 0.0018852f, 0.0009426f, -1.7702427f, 0.7740131f}, {0.0009434f, 0.0018868f, 0.0009434f, -1.7717943f, 0.775568f}, {0.0009458f, 0.0018917f, 0.0009458f, -1.7763235f, 0.7801068f}, {0.0009496f, 0.0018993f, 0.0009496f, -1.7834783f, 0.7872768f}, {0.0009546f, 0.0019092f, 0.0009546f, -1.7927453f, 0.7965636f}, {0.0009603f, 0.0019206f, 0.0009603f, -1.8035343f, 0.8073756f}, {0.0009666f, 0.0019331f, 0.0009666f, -1.8152585f, 0.8191248f}, {0.000973f, 0.0019461f, 0.000973f, -1.8273944f, 0.8312866f}, {0.0009795f, 0.001959f, 0.0009795f, -1.8395155f, 0.8434334f}, {0.0009858f, 0.0019715f, 0.0009858f, -1.8513019f, 0.855245f}, {0.0009917f, 0.0019835f, 0.0009917f, -1.8625341f, 0.8665011f}, {0.0009974f, 0.0019947f, 0.0009974f, -1.8730772f, 0.8770666f}, {0.0010026f, 0.0020051f, 0.0010026f, -1.8828623f, 0.8868726f}, {0.0010074f, 0.0020147f, 0.0010074f, -1.891869f, 0.8958984f}, {0.0010117f, 0.0020235f, 0.0010117f, -1.90011f, 0.904157f}, {0.0010157f, 0.0020315f, 0.0010157f, -1.9076194f, 0.9116824f}, {0.0010194f, 0.0020388f, 0.0010194f, -1.9144437f, 0.9185212f}, {0.0010227f, 0.0020454f, 0.0010227f, -1.9206353f, 0.924726f}, {0.0010257f, 0.0020513f, 0.0010257f, -1.9262487f, 0.9303513f}, {0.0010284f, 0.0020567f, 0.0010284f, -1.9313374f, 0.9354509f}, {0.0010308f, 0.0020617f, 0.0010308f, -1.9359522f, 0.9400756f}, {0.0010331f, 0.0020661f, 0.0010331f, -1.9401407f, 0.9442729f}, {0.0010351f, 0.0020702f, 0.0010351f, -1.9439462f, 0.9480866f}, {0.0010369f, 0.0020739f, 0.0010369f, -1.9474083f, 0.951556f}, {0.0010386f, 0.0020772f, 0.0010386f, -1.9505624f, 0.9547168f}, {0.0010401f, 0.0020803f, 0.0010401f, -1.9534404f, 0.9576009f}, {0.0010415f, 0.0020831f, 0.0010415f, -1.9560707f, 0.9602368f}, {0.0010428f, 0.0020857f, 0.0010428f, -1.9584786f, 0.9626499f}, {0.001044f, 0.002088f, 0.001044f, -1.9606867f, 0.9648627f}, {0.0010451f, 0.0020902f, 0.0010451f, -1.962715f, 0.9668954f}, {0.0010461f, 0.0020922f, 0.0010461f, -1.9645813f, 0.9687656f}, {0.001047f, 0.002094f, 0.001047f, -1.9663014f, 0.9704893f}, {0.0010478f, 0.0020957f, 0.0010478f, -1.9678893f, 0.9720806f}, {0.0010486f, 0.0020972f, 0.0010486f, -1.9693576f, 0.973552f}, {0.0010493f, 0.0020987f, 0.0010493f, -1.9707174f, 0.9749148f}, {0.00105f, 0.0021f, 0.00105f, -1.9719787f, 0.9761788f}, {0.0010506f, 0.0021013f, 0.0010506f, -1.9731505f, 0.977353f}, {0.0010512f, 0.0021024f, 0.0010512f, -1.9742406f, 0.9784455f}, {0.0010518f, 0.0021035f, 0.0010518f, -1.9752562f, 0.9794632f}, {0.0010523f, 0.0021045f, 0.0010523f, -1.9762037f, 0.9804128f}, {0.0010527f, 0.0021055f, 0.0010527f, -1.9770889f, 0.9812999f}, {0.0010532f, 0.0021064f, 0.0010532f, -1.977917f, 0.9821297f}, {0.0010536f, 0.0021072f, 0.0010536f, -1.9786926f, 0.9829069f}, {0.001054f, 0.002108f, 0.001054f, -1.9794199f, 0.9836358f}, {0.0010543f, 0.0021087f, 0.0010543f, -1.9801028f, 0.9843202f}, {0.0010547f, 0.0021094f, 0.0010547f, -1.9807599f, 0.9849787f}, {0.001055f, 0.0021101f, 0.001055f, -1.9814135f, 0.9856337f}, {0.0010554f, 0.0021108f, 0.0010554f, -1.9820619f, 0.9862834f}, {0.0010557f, 0.0021115f, 0.0010557f, -1.9827029f, 0.9869258f}, {0.0010561f, 0.0021121f, 0.0010561f, -1.9833343f, 0.9875586f}, {0.0010564f, 0.0021128f, 0.0010564f, -1.983954f, 0.9881796f}, {0.0010567f, 0.0021134f, 0.0010567f, -1.98456f, 0.9887868f}, {0.001057f, 0.0021141f, 0.001057f, -1.9851501f, 0.9893783f}, {0.0010573f, 0.0021147f, 0.0010573f, -1.9857229f, 0.9899522f}, {0.0010576f, 0.0021153f, 0.0010576f, -1.9862766f, 0.9905071f}, {0.0010579f, 0.0021158f, 0.0010579f, -1.9868101f, 0.9910417f}, {0.0010582f, 0.0021164f, 0.0010582f, -1.9873224f, 0.9915551f}, {0.0010584f, 0.0021169f, 0.0010584f, -1.9878128f, 0.9920466f}, {0.0010587f, 0.0021174f, 0.0010587f, -1.9882808f, 0.9925156f}, {0.0010589f, 0.0021179f, 0.0010589f, -1.9887262f, 0.9929619f}, {0.0010592f, 0.0021183f, 0.0010592f, -1.9891491f, 0.9933857f}, {0.0010594f, 0.0021187f, 0.0010594f, -1.9895496f, 0.9937871f}, {0.0010596f, 0.0021191f, 0.0010596f, -1.9899281f, 0.9941664f}, {0.0010598f, 0.0021195f, 0.0010598f, -1.9902851f, 0.9945242f}},
-          {{0.0007641f, 0.0015281f, 0.0007641f, -1.7917839f, 0.7948401f}, {0.0007647f, 0.0015293f, 0.0007647f, -1.7932095f, 0.7962681f}, {0.0007664f, 0.0015329f, 0.0007664f, -1.7973696f, 0.8004354f}, {0.0007692f, 0.0015385f, 0.0007692f, -1.8039375f, 0.8070144f}, {0.0007729f, 0.0015457f, 0.0007729f, -1.812437f, 0.8155285f}, {0.0007771f, 0.0015542f, 0.0007771f, -1.8223222f, 0.8254305f}, {0.0007817f, 0.0015633f, 0.0007817f, -1.8330516f, 0.8361782f}, {0.0007864f, 0.0015728f, 0.0007864f, -1.844144f, 0.8472896f}, {0.0007911f, 0.0015822f, 0.0007911f, -1.855209f, 0.8583734f}, {0.0007957f, 0.0015914f, 0.0007957f, -1.8659551f, 0.8691378f}, {0.0008f, 0.0016001f, 0.0008f, -1.8761837f, 0.8793839f}, {0.0008041f, 0.0016083f, 0.0008041f, -1.8857739f, 0.8889905f}, {0.0008079f, 0.0016159f, 0.0008079f, -1.8946653f, 0.897897f}, {0.0008114f, 0.0016228f, 0.0008114f, -1.9028414f, 0.9060871f}, {0.0008146f, 0.0016292f, 0.0008146f, -1.9103158f, 0.9135743f}, {0.0008175f, 0.001635f, 0.0008175f, -1.9171211f, 0.9203911f}, {0.0008201f, 0.0016403f, 0.0008201f, -1.9233009f, 0.9265815f}, {0.0008225f, 0.0016451f, 0.0008225f, -1.928904f, 0.9321941f}, {0.0008247f, 0.0016494f, 0.0008247f, -1.9339808f, 0.9372796f}, {0.0008267f, 0.0016533f, 0.0008267f, -1.9385805f, 0.9418871f}, {0.0008284f, 0.0016569f, 0.0008284f, -1.9427498f, 0.9460635f}, {0.00083f, 0.0016601f, 0.00083f, -1.9465321f, 0.9498523f}, {0.0008315f, 0.001663f, 0.0008315f, -1.9499673f, 0.9532933f}, {0.0008328f, 0.0016657f, 0.0008328f, -1.9530912f, 0.9564225f}, {0.0008341f, 0.0016681f, 0.0008341f, -1.9559362f, 0.9592724f}, {0.0008352f, 0.0016703f, 0.0008352f, -1.9585314f, 0.9618721f}, {0.0008362f, 0.0016723f, 0.0008362f, -1.9609026f, 0.9642473f}, {0.0008371f, 0.0016742f, 0.0008371f, -1.9630728f, 0.9664212f}, {0.0008379f, 0.0016759f, 0.0008379f, -1.9650624f, 0.9684142f}, {0.0008387f, 0.0016775f, 0.0008387f, -1.9668895f, 0.9702445f}, {0.0008394f, 0.0016789f, 0.0008394f, -1.9685704f, 0.9719282f}, {0.0008401f, 0.0016802f, 0.0008401f, -1.9701193f, 0.9734797f}, {0.0008407f, 0.0016814f, 0.0008407f, -1.971549f, 0.9749118f}, {0.0008413f, 0.0016826f, 0.0008413f, -1.9728707f, 0.9762358f}, {0.0008418f, 0.0016836f, 0.0008418f, -1.9740947f, 0.9774619f}, {0.0008423f, 0.0016846f, 0.0008423f, -1.9752298f, 0.9785989f}, {0.0008427f, 0.0016855f, 0.0008427f, -1.9762842f, 0.9796551f}, {0.0008432f, 0.0016863f, 0.0008432f, -1.977265f, 0.9806376f}, {0.0008435f, 0.0016871f, 0.0008435f, -1.9781786f, 0.9815528f}, {0.0008439f, 0.0016878f, 0.0008439f, -1.979031f, 0.9824066f}, {0.0008442f, 0.0016885f, 0.0008442f, -1.9798272f, 0.9832042f}, {0.0008446f, 0.0016891f, 0.0008446f, -1.9805719f, 0.9839502f}, {0.0008449f, 0.0016897f, 0.0008449f, -1.9812694f, 0.9846488f}, {0.0008451f, 0.0016903f, 0.0008451f, -1.9819234f, 0.985304f}, {0.0008454f, 0.0016908f, 0.0008454f, -1.9825375f, 0.9859191f}, {0.0008457f, 0.0016913f, 0.0008457f, -1.9831283f, 0.9865109f}, {0.0008459f, 0.0016918f, 0.0008459f, -1.9837159f, 0.9870995f}, {0.0008462f, 0.0016923f, 0.0008462f, -1.9842988f, 0.9876834f}, {0.0008464f, 0.0016928f, 0.0008464f, -1.984875f, 0.9882606f}, {0.0008466f, 0.0016933f, 0.0008466f, -1.9854426f, 0.9888291f}, {0.0008469f, 0.0016938f, 0.0008469f, -1.9859996f, 0.9893871f}, {0.0008471f, 0.0016942f, 0.0008471f, -1.9865441f, 0.9899326f}, {0.0008473f, 0.0016947f, 0.0008473f, -1.9870745f, 0.9904639f}, {0.0008476f, 0.0016951f, 0.0008476f, -1.9875892f, 0.9909794f}, {0.0008478f, 0.0016955f, 0.0008478f, -1.9880867f, 0.9914778f}, {0.000848f, 0.0016959f, 0.000848f, -1.9885661f, 0.991958f}, {0.0008482f, 0.0016963f, 0.0008482f, -1.9890264f, 0.9924191f}, {0.0008484f, 0.0016967f, 0.0008484f, -1.989467f, 0.9928604f}, {0.0008485f, 0.0016971f, 0.0008485f, -1.9898875f, 0.9932816f}, {0.0008487f, 0.0016974f, 0.0008487f, -1.9902876f, 0.9936824f}, {0.0008489f, 0.0016977f, 0.0008489f, -1.9906675f, 0.9940629f}, {0.000849f, 0.001698f, 0.000849f, -1.9910272f, 0.9944233f}, {0.0008492f, 0.0016983f, 0.0008492f, -1.9913672f, 0.9947639f}, {0.0008493f, 0.0016986f, 0.0008493f, -1.9916879f, 0.9950852f}},
-          {{0.0006187f, 0.0012373f, 0.0006187f, -1.8115202f, 0.8139949f}, {0.0006191f, 0.0012382f, 0.0006191f, -1.8128268f, 0.8153033f}, {0.0006204f, 0.0012408f, 0.0006204f, -1.8166387f, 0.8191204f}, {0.0006225f, 0.001245f, 0.0006225f, -1.8226533f, 0.8251432f}, {0.0006251f, 0.0012503f, 0.0006251f, -1.8304309f, 0.8329314f}, {0.0006282f, 0.0012564f, 0.0006282f, -1.8394677f, 0.8419806f}, {0.0006316f, 0.0012631f, 0.0006316f, -1.8492659f, 0.8517921f}, {0.000635f, 0.00127f, 0.000635f, -1.859384f, 0.8619241f}, {0.0006385f, 0.0012769f, 0.0006385f, -1.8694655f, 0.8720193f}, {0.0006418f, 0.0012836f, 0.0006418f, -1.8792453f, 0.8818126f}, {0.000645f, 0.00129f, 0.000645f, -1.8885441f, 0.891124f}, {0.000648f, 0.0012959f, 0.000648f, -1.8972536f, 0.8998454f}, {0.0006507f, 0.0013014f, 0.0006507f, -1.9053207f, 0.9079235f}, {0.0006532f, 0.0013065f, 0.0006532f, -1.9127322f, 0.9153452f}, {0.0006556f, 0.0013111f, 0.0006556f, -1.9195022f, 0.9221244f}, {0.0006577f, 0.0013153f, 0.0006577f, -1.9256615f, 0.9282921f}, {0.0006596f, 0.0013191f, 0.0006596f, -1.931251f, 0.9338892f}, {0.0006613f, 0.0013226f, 0.0006613f, -1.9363158f, 0.938961f}, {0.0006629f, 0.0013257f, 0.0006629f, -1.9409023f, 0.9435537f}, {0.0006643f, 0.0013286f, 0.0006643f, -1.9450556f, 0.9477128f}, {0.0006656f, 0.0013311f, 0.0006656f, -1.9488187f, 0.951481f}, {0.0006667f, 0.0013335f, 0.0006667f, -1.9522311f, 0.954898f}, {0.0006678f, 0.0013356f, 0.0006678f, -1.9553291f, 0.9580002f}, {0.0006688f, 0.0013375f, 0.0006688f, -1.9581455f, 0.9608205f}, {0.0006696f, 0.0013393f, 0.0006696f, -1.9607096f, 0.9633881f}, {0.0006704f, 0.0013408f, 0.0006704f, -1.963048f, 0.9657297f}, {0.0006712f, 0.0013423f, 0.0006712f, -1.9651839f, 0.9678685f}, {0.0006718f, 0.0013436f, 0.0006718f, -1.9671383f, 0.9698256f}, {0.0006724f, 0.0013449f, 0.0006724f, -1.9689297f, 0.9716194f}, {0.000673f, 0.001346f, 0.000673f, -1.9705745f, 0.9732665f}, {0.0006735f, 0.001347f, 0.0006735f, -1.9720874f, 0.9747814f}, {0.000674f, 0.001348f, 0.000674f, -1.9734812f, 0.9761772f}, {0.0006744f, 0.0013489f, 0.0006744f, -1.9747676f, 0.9774653f}, {0.0006748f, 0.0013497f, 0.0006748f, -1.9759566f, 0.978656f}, {0.0006752f, 0.0013504f, 0.0006752f, -1.9770576f, 0.9797584f}, {0.0006756f, 0.0013511f, 0.0006756f, -1.9780785f, 0.9807807f}, {0.0006759f, 0.0013518f, 0.0006759f, -1.9790267f, 0.9817302f}, {0.0006762f, 0.0013524f, 0.0006762f, -1.9799086f, 0.9826134f}, {0.0006765f, 0.0013529f, 0.0006765f, -1.9807302f, 0.983436f}, {0.0006767f, 0.0013534f, 0.0006767f, -1.9814964f, 0.9842033f}, {0.000677f, 0.0013539f, 0.000677f, -1.9822122f, 0.9849201f}, {0.0006772f, 0.0013544f, 0.0006772f, -1.9828816f, 0.9855904f}, {0.0006774f, 0.0013548f, 0.0006774f, -1.9835085f, 0.9862182f}, {0.0006776f, 0.0013552f, 0.0006776f, -1.9840963f, 0.9868068f}, {0.0006778f, 0.0013556f, 0.0006778f, -1.9846482f, 0.9873594f}, {0.000678f, 0.001356f, 0.000678f, -1.9851791f, 0.987891f}, {0.0006782f, 0.0013563f, 0.0006782f, -1.9857071f, 0.9884198f}, {0.0006783f, 0.0013567f, 0.0006783f, -1.9862309f, 0.9889442f}, {0.0006785f, 0.001357f, 0.0006785f, -1.9867486f, 0.9894626f}, {0.0006787f, 0.0013574f, 0.0006787f, -1.9872585f, 0.9899733f}, {0.0006789f, 0.0013577f, 0.0006789f, -1.9877589f, 0.9904743f}, {0.000679f, 0.0013581f, 0.000679f, -1.9882481f, 0.9909642f}, {0.0006792f, 0.0013584f, 0.0006792f, -1.9887245f, 0.9914413f}, {0.0006794f, 0.0013587f, 0.0006794f, -1.9891868f, 0.9919042f}, {0.0006795f, 0.001359f, 0.0006795f, -1.9896337f, 0.9923517f}, {0.0006797f, 0.0013593f, 0.0006797f, -1.9900642f, 0.9927828f}, {0.0006798f, 0.0013596f, 0.0006798f, -1.9904776f, 0.9931968f}, {0.0006799f, 0.0013599f, 0.0006799f, -1.9908733f, 0.993593f}, {0.0006801f, 0.0013601f, 0.0006801f, -1.9912509f, 0.9939711f}, {0.0006802f, 0.0013604f, 0.0006802f, -1.9916102f, 0.9943309f}, {0.0006803f, 0.0013606f, 0.0006803f, -1.9919513f, 0.9946725f}, {0.0006804f, 0.0013608f, 0.0006804f, -1.9922743f, 0.9949959f}, {0.0006805f, 0.001361f, 0.0006805f, -1.9925796f, 0.9953016f}, {0.0006806f, 0.0013612f, 0.0006806f, -1.9928675f, 0.99559f}},
-          {{0.0005005f, 0.0010009f, 0.0005005f, -1.8295645f, 0.8315664f}, {0.0005008f, 0.0010016f, 0.0005008f, -1.8307594f, 0.8327626f}, {0.0005017f, 0.0010035f, 0.0005017f, -1.8342444f, 0.8362514f}, {0.0005032f, 0.0010065f, 0.0005032f, -1.8397405f, 0.8417534f}, {0.0005052f, 0.0010104f, 0.0005052f, -1.8468423f, 0.8488631f}, {0.0005074f, 0.0010149f, 0.0005074f, -1.8550868f, 0.8571166f}, {0.0005099f, 0.0010198f, 0.0005099f, -1.8640171f, 0.8660566f}, {0.0005124f, 0.0010248f, 0.0005124f, -1.8732295f, 0.8752791f}, {0.0005149f, 0.0010298f, 0.0005149f, -1.8823989f, 0.8844585f}, {0.0005173f, 0.0010347f, 0.0005173f, -1.8912847f, 0.8933541f}, {0.0005197f, 0.0010393f, 0.0005197f, -1.8997251f, 0.9018037f}, {0.0005218f, 0.0010436f, 0.0005218f, -1.9076232f, 0.9097104f}, {0.0005238f, 0.0010476f, 0.0005238f, -1.9149324f, 0.9170276f}, {0.0005256f, 0.0010513f, 0.0005256f, -1.9216422f, 0.9237448f}, {0.0005273f, 0.0010546f, 0.0005273f, -1.9277667f, 0.929876f}, {0.0005288f, 0.0010577f, 0.0005288f, -1.9333351f, 0.9354504f}, {0.0005302f, 0.0010605f, 0.0005302f, -1.9383851f, 0.940506f}, {0.0005315f, 0.001063f, 0.0005315f, -1.9429587f, 0.9450846f}, {0.0005326f, 0.0010652f, 0.0005326f, -1.9470982f, 0.9492286f}, {0.0005336f, 0.0010673f, 0.0005336f, -1.9508451f, 0.9529797f}, {0.0005346f, 0.0010691f, 0.0005346f, -1.9542385f, 0.9563768f}, {0.0005354f, 0.0010708f, 0.0005354f, -1.9573146f, 0.9594562f}, {0.0005362f, 0.0010723f, 0.0005362f, -1.9601063f, 0.962251f}, {0.0005369f, 0.0010737f, 0.0005369f, -1.9626434f, 0.9647909f}, {0.0005375f, 0.001075f, 0.0005375f, -1.9649527f, 0.9671027f}, {0.0005381f, 0.0010761f, 0.0005381f, -1.9670581f, 0.9692104f}, {0.0005386f, 0.0010772f, 0.0005386f, -1.9689808f, 0.9711352f}, {0.0005391f, 0.0010782f, 0.0005391f, -1.9707397f, 0.972896f}, {0.0005395f, 0.001079f, 0.0005395f, -1.9723516f, 0.9745097f}, {0.0005399f, 0.0010798f, 0.0005399f, -1.9738314f, 0.9759911f}, {0.0005403f, 0.0010806f, 0.0005403f, -1.9751922f, 0.9773534f}, {0.0005406f, 0.0010813f, 0.0005406f, -1.9764458f, 0.9786083f}, {0.000541f, 0.0010819f, 0.000541f, -1.9776025f, 0.9797663f}, {0.0005412f, 0.0010825f, 0.0005412f, -1.9786716f, 0.9808366f}, {0.0005415f, 0.001083f, 0.0005415f, -1.9796614f, 0.9818275f}, {0.0005418f, 0.0010835f, 0.0005418f, -1.9805791f, 0.9827462f}, {0.000542f, 0.001084f, 0.000542f, -1.9814314f, 0.9835994f}, {0.0005422f, 0.0010844f, 0.0005422f, -1.982224f, 0.9843929f}, {0.0005424f, 0.0010848f, 0.0005424f, -1.9829623f, 0.985132f}, {0.0005426f, 0.0010852f, 0.0005426f, -1.9836509f, 0.9858213f}, {0.0005428f, 0.0010856f, 0.0005428f, -1.984294f, 0.9864651f}, {0.0005429f, 0.0010859f, 0.0005429f, -1.9848954f, 0.9870672f}, {0.0005431f, 0.0010862f, 0.0005431f, -1.9854586f, 0.987631f}, {0.0005432f, 0.0010865f, 0.0005432f, -1.9859867f, 0.9881597f}, {0.0005434f, 0.0010868f, 0.0005434f, -1.9864824f, 0.9886559f}, {0.0005435f, 0.001087f, 0.0005435f, -1.9869593f, 0.9891333f}, {0.0005436f, 0.0010873f, 0.0005436f, -1.9874336f, 0.9896081f}, {0.0005438f, 0.0010875f, 0.0005438f, -1.9879039f, 0.990079f}, {0.0005439f, 0.0010878f, 0.0005439f, -1.9883689f, 0.9905445f}, {0.000544f, 0.001088f, 0.000544f, -1.9888268f, 0.9910029f}, {0.0005441f, 0.0010883f, 0.0005441f, -1.9892762f, 0.9914528f}, {0.0005443f, 0.0010885f, 0.0005443f, -1.9897154f, 0.9918925f}, {0.0005444f, 0.0010888f, 0.0005444f, -1.9901432f, 0.9923208f}, {0.0005445f, 0.001089f, 0.0005445f, -1.9905583f, 0.9927363f}, {0.0005446f, 0.0010892f, 0.0005446f, -1.9909595f, 0.993138f}, {0.0005447f, 0.0010894f, 0.0005447f, -1.9913461f, 0.9935249f}, {0.0005448f, 0.0010896f, 0.0005448f, -1.9917172f, 0.9938964f}, {0.0005449f, 0.0010898f, 0.0005449f, -1.9920724f, 0.994252f}, {0.000545f, 0.00109f, 0.000545f, -1.9924113f, 0.9945913f}, {0.0005451f, 0.0010902f, 0.0005451f, -1.9927338f, 0.9949142f}, {0.0005452f, 0.0010904f, 0.0005452f, -1.99304f, 0.9952207f}, {0.0005453f, 0.0010905f, 0.0005453f, -1.9933299f, 0.995511f}, {0.0005453f, 0.0010907f, 0.0005453f, -1.9936039f, 0.9957853f}, {0.0005454f, 0.0010908f, 0.0005454f, -1.9938624f, 0.996044f}},
-          {{0.0004045f, 0.0008089f, 0.0004045f, -1.8460297f, 0.8476476f}, {0.0004047f, 0.0008094f, 0.0004047f, -1.8471202f, 0.848739f}, {0.0004054f, 0.0008108f, 0.0004054f, -1.8502999f, 0.8519215f}, {0.0004065f, 0.000813f, 0.0004065f, -1.855312f, 0.856938f}, {0.0004079f, 0.0008158f, 0.0004079f, -1.8617844f, 0.8634161f}, {0.0004096f, 0.0008191f, 0.0004096f, -1.8692921f, 0.8709303f}, {0.0004113f, 0.0008227f, 0.0004113f, -1.877417f, 0.8790624f}, {0.0004132f, 0.0008264f, 0.0004132f, -1.8857907f, 0.8874434f}, {0.000415f, 0.00083f, 0.000415f, -1.8941172f, 0.8957772f}, {0.0004168f, 0.0008335f, 0.0004168f, -1.9021788f, 0.9038458f}, {0.0004184f, 0.0008369f, 0.0004184f, -1.9098293f, 0.9115031f}, {0.00042f, 0.00084f, 0.00042f, -1.9169821f, 0.9186622f}, {0.0004215f, 0.0008429f, 0.0004215f, -1.9235964f, 0.9252823f}, {0.0004228f, 0.0008456f, 0.0004228f, -1.929664f, 0.9313551f}, {0.000424f, 0.000848f, 0.000424f, -1.9351985f, 0.9368945f}, {0.0004251f, 0.0008502f, 0.0004251f, -1.9402274f, 0.9419278f}, {0.0004261f, 0.0008522f, 0.0004261f, -1.9447857f, 0.9464901f}, {0.000427f, 0.000854f, 0.000427f, -1.9489118f, 0.9506198f}, {0.0004278f, 0.0008557f, 0.0004278f, -1.9526447f, 0.954356f}, {0.0004286f, 0.0008571f, 0.0004286f, -1.9560222f, 0.9577364f}, {0.0004292f, 0.0008585f, 0.0004292f, -1.9590798f, 0.9607968f}, {0.0004298f, 0.0008597f, 0.0004298f, -1.9618506f, 0.96357f}, {0.0004304f, 0.0008608f, 0.0004304f, -1.9643645f, 0.9660861f}, {0.0004309f, 0.0008618f, 0.0004309f, -1.9666485f, 0.9683721f}, {0.0004313f, 0.0008627f, 0.0004313f, -1.968727f, 0.9704523f}, {0.0004318f, 0.0008635f, 0.0004318f, -1.9706214f, 0.9723484f}, {0.0004321f, 0.0008643f, 0.0004321f, -1.9723511f, 0.9740797f}, {0.0004325f, 0.000865f, 0.0004325f, -1.9739331f, 0.9756631f}, {0.0004328f, 0.0008656f, 0.0004328f, -1.9753827f, 0.9771139f}, {0.0004331f, 0.0008662f, 0.0004331f, -1.9767132f, 0.9784456f}, {0.0004334f, 0.0008667f, 0.0004334f, -1.9779366f, 0.9796701f}, {0.0004336f, 0.0008672f, 0.0004336f, -1.9790634f, 0.9807979f}, {0.0004338f, 0.0008677f, 0.0004338f, -1.9801031f, 0.9818384f}, {0.0004341f, 0.0008681f, 0.0004341f, -1.9810639f, 0.9828001f}, {0.0004342f, 0.0008685f, 0.0004342f, -1.9819533f, 0.9836902f}, {0.0004344f, 0.0008689f, 0.0004344f, -1.9827778f, 0.9845155f}, {0.0004346f, 0.0008692f, 0.0004346f, -1.9835435f, 0.9852819f}, {0.0004348f, 0.0008695f, 0.0004348f, -1.9842556f, 0.9859946f}, {0.0004349f, 0.0008698f, 0.0004349f, -1.9849187f, 0.9866583f}, {0.000435f, 0.0008701f, 0.000435f, -1.9855372f, 0.9872773f}, {0.0004352f, 0.0008703f, 0.0004352f, -1.9861148f, 0.9878554f}, {0.0004353f, 0.0008706f, 0.0004353f, -1.9866549f, 0.988396f}, {0.0004354f, 0.0008708f, 0.0004354f, -1.9871607f, 0.9889023f}, {0.0004355f, 0.000871f, 0.0004355f, -1.9876349f, 0.9893769f}, {0.0004356f, 0.0008712f, 0.0004356f, -1.98808f, 0.9898224f}, {0.0004357f, 0.0008714f, 0.0004357f, -1.9885082f, 0.9902509f}, {0.0004358f, 0.0008716f, 0.0004358f, -1.988934f, 0.9906771f}, {0.0004359f, 0.0008717f, 0.0004359f, -1.9893563f, 0.9910998f}, {0.000436f, 0.0008719f, 0.000436f, -1.9897737f, 0.9915175f}, {0.0004361f, 0.0008721f, 0.0004361f, -1.9901848f, 0.991929f}, {0.0004361f, 0.0008723f, 0.0004361f, -1.9905882f, 0.9923327f}, {0.0004362f, 0.0008725f, 0.0004362f, -1.9909825f, 0.9927274f}, {0.0004363f, 0.0008726f, 0.0004363f, -1.9913664f, 0.9931117f}, {0.0004364f, 0.0008728f, 0.0004364f, -1.991739f, 0.9934845f}, {0.0004365f, 0.0008729f, 0.0004365f, -1.9920991f, 0.993845f}, {0.0004365f, 0.0008731f, 0.0004365f, -1.992446f, 0.9941922f}, {0.0004366f, 0.0008732f, 0.0004366f, -1.992779f, 0.9945255f}, {0.0004367f, 0.0008734f, 0.0004367f, -1.9930978f, 0.9948445f}, {0.0004368f, 0.0008735f, 0.0004368f, -1.9934019f, 0.9951489f}, {0.0004368f, 0.0008736f, 0.0004368f, -1.9936913f, 0.9954386f}, {0.0004369f, 0.0008738f, 0.0004369f, -1.9939661f, 0.9957136f}, {0.0004369f, 0.0008739f, 0.0004369f, -1.9942262f, 0.995974f}, {0.000437f, 0.000874f, 0.000437f, -1.9944721f, 0.99622f}, {0.000437f, 0.0008741f, 0.000437f, -1.9947039f, 0.9964521f}},
-          {{0.0003266f, 0.0006532f, 0.0003266f, -1.861027f, 0.8623334f}, {0.0003268f, 0.0006536f, 0.0003268f, -1.8620203f, 0.8633274f}, {0.0003273f, 0.0006546f, 0.0003273f, -1.864916f, 0.8662251f}, {0.0003281f, 0.0006562f, 0.0003281f, -1.8694786f, 0.8707909f}, {0.0003291f, 0.0006583f, 0.0003291f, -1.8753668f, 0.8766833f}, {0.0003303f, 0.0006607f, 0.0003303f, -1.882192f, 0.8835133f}, {0.0003316f, 0.0006632f, 0.0003316f, -1.8895723f, 0.8908988f}, {0.000333f, 0.0006659f, 0.000333f, -1.897172f, 0.8985039f}, {0.0003343f, 0.0006686f, 0.0003343f, -1.9047224f, 0.9060595f}, {0.0003356f, 0.0006711f, 0.0003356f, -1.9120263f, 0.9133685f}, {0.0003368f, 0.0006736f, 0.0003368f, -1.918952f, 0.9202991f}, {0.0003379f, 0.0006758f, 0.0003379f, -1.9254223f, 0.9267739f}, {0.000339f, 0.0006779f, 0.000339f, -1.9314011f, 0.932757f}, {0.0003399f, 0.0006799f, 0.0003399f, -1.9368821f, 0.9382418f}, {0.0003408f, 0.0006816f, 0.0003408f, -1.9418785f, 0.9432417f}, {0.0003416f, 0.0006832f, 0.0003416f, -1.946416f, 0.9477824f}, {0.0003423f, 0.0006846f, 0.0003423f, -1.9505269f, 0.9518962f}, {0.000343f, 0.0006859f, 0.000343f, -1.9542463f, 0.9556182f}, {0.0003436f, 0.0006871f, 0.0003436f, -1.9576099f, 0.9589841f}, {0.0003441f, 0.0006882f, 0.0003441f, -1.9606521f, 0.9620285f}, {0.0003446f, 0.0006892f, 0.0003446f, -1.9634053f, 0.9647836f}, {0.000345f, 0.00069f, 0.000345f, -1.9658994f, 0.9672795f}, {0.0003454f, 0.0006908f, 0.0003454f, -1.9681617f, 0.9695434f}, {0.0003458f, 0.0006916f, 0.0003458f, -1.9702166f, 0.9715997f}, {0.0003461f, 0.0006922f, 0.0003461f, -1.9720861f, 0.9734705f}, {0.0003464f, 0.0006928f, 0.0003464f, -1.9737898f, 0.9751754f}, {0.0003467f, 0.0006934f, 0.0003467f, -1.975345f, 0.9767317f}, {0.0003469f, 0.0006939f, 0.0003469f, -1.9767672f, 0.9781549f}, {0.0003472f, 0.0006943f, 0.0003472f, -1.9780701f, 0.9794588f}, {0.0003474f, 0.0006947f, 0.0003474f, -1.9792659f, 0.9806553f}, {0.0003476f, 0.0006951f, 0.0003476f, -1.9803652f, 0.9817554f}, {0.0003477f, 0.0006955f, 0.0003477f, -1.9813776f, 0.9827686f}, {0.0003479f, 0.0006958f, 0.0003479f, -1.9823116f, 0.9837032f}, {0.0003481f, 0.0006961f, 0.0003481f, -1.9831747f, 0.9845669f}, {0.0003482f, 0.0006964f, 0.0003482f, -1.9839735f, 0.9853663f}, {0.0003483f, 0.0006966f, 0.0003483f, -1.9847141f, 0.9861074f}, {0.0003484f, 0.0006969f, 0.0003484f, -1.9854017f, 0.9867954f}, {0.0003486f, 0.0006971f, 0.0003486f, -1.9860411f, 0.9874353f}, {0.0003487f, 0.0006973f, 0.0003487f, -1.9866365f, 0.9880312f}, {0.0003488f, 0.0006975f, 0.0003488f, -1.9871918f, 0.9885868f}, {0.0003488f, 0.0006977f, 0.0003488f, -1.9877104f, 0.9891058f}, {0.0003489f, 0.0006979f, 0.0003489f, -1.9881953f, 0.989591f}, {0.000349f, 0.000698f, 0.000349f, -1.9886493f, 0.9900454f}, {0.0003491f, 0.0006982f, 0.0003491f, -1.989075f, 0.9904713f}, {0.0003492f, 0.0006983f, 0.0003492f, -1.9894745f, 0.9908711f}, {0.0003492f, 0.0006984f, 0.0003492f, -1.9898588f, 0.9912557f}, {0.0003493f, 0.0006986f, 0.0003493f, -1.990241f, 0.9916382f}, {0.0003494f, 0.0006987f, 0.0003494f, -1.99062f, 0.9920174f}, {0.0003494f, 0.0006988f, 0.0003494f, -1.9909946f, 0.9923923f}, {0.0003495f, 0.000699f, 0.0003495f, -1.9913635f, 0.9927615f}, {0.0003496f, 0.0006991f, 0.0003496f, -1.9917255f, 0.9931237f}, {0.0003496f, 0.0006992f, 0.0003496f, -1.9920793f, 0.9934778f}, {0.0003497f, 0.0006993f, 0.0003497f, -1.9924238f, 0.9938225f}, {0.0003497f, 0.0006995f, 0.0003497f, -1.9927581f, 0.994157f}, {0.0003498f, 0.0006996f, 0.0003498f, -1.9930812f, 0.9944804f}, {0.0003498f, 0.0006997f, 0.0003498f, -1.9933925f, 0.9947918f}, {0.0003499f, 0.0006998f, 0.0003499f, -1.9936912f, 0.9950908f}, {0.0003499f, 0.0006999f, 0.0003499f, -1.9939772f, 0.995377f}, {0.00035f, 0.0007f, 0.00035f, -1.9942501f, 0.99565f}, {0.00035f, 0.0007001f, 0.00035f, -1.9945097f, 0.9959098f}, {0.0003501f, 0.0007002f, 0.0003501f, -1.9947561f, 0.9961565f}, {0.0003501f, 0.0007002f, 0.0003501f, -1.9949895f, 0.99639f}, {0.0003502f, 0.0007003f, 0.0003502f, -1.99521f, 0.9966107f}, {0.0003502f, 0.0007004f, 0.0003502f, -1.995418f, 0.9968188f}},
-          {{0.0002635f, 0.0005271f, 0.0002635f, -1.8746645f, 0.8757187f}, {0.0002637f, 0.0005273f, 0.0002637f, -1.8755678f, 0.8766225f}, {0.000264f, 0.0005281f, 0.000264f, -1.8782004f, 0.8792566f}, {0.0002646f, 0.0005293f, 0.0002646f, -1.8823469f, 0.8834054f}, {0.0002654f, 0.0005308f, 0.0002654f, -1.8876952f, 0.8887567f}, {0.0002662f, 0.0005325f, 0.0002662f, -1.8938905f, 0.8949555f}, {0.0002672f, 0.0005344f, 0.0002672f, -1.9005846f, 0.9016534f}, {0.0002682f, 0.0005363f, 0.0002682f, -1.9074724f, 0.908545f}, {0.0002691f, 0.0005382f, 0.0002691f, -1.91431f, 0.9153865f}, {0.00027f, 0.0005401f, 0.00027f, -1.9209193f, 0.9219995f}, {0.0002709f, 0.0005419f, 0.0002709f, -1.9271818f, 0.9282655f}, {0.0002718f, 0.0005435f, 0.0002718f, -1.9330284f, 0.9341154f}, {0.0002725f, 0.000545f, 0.0002725f, -1.9384273f, 0.9395174f}, {0.0002732f, 0.0005464f, 0.0002732f, -1.9433738f, 0.9444666f}, {0.0002738f, 0.0005477f, 0.0002738f, -1.9478805f, 0.9489759f}, {0.0002744f, 0.0005488f, 0.0002744f, -1.9519713f, 0.9530689f}, {0.0002749f, 0.0005499f, 0.0002749f, -1.9556757f, 0.9567754f}, {0.0002754f, 0.0005508f, 0.0002754f, -1.959026f, 0.9601276f}, {0.0002758f, 0.0005517f, 0.0002758f, -1.9620547f, 0.963158f}, {0.0002762f, 0.0005524f, 0.0002762f, -1.9647931f, 0.9658979f}, {0.0002766f, 0.0005531f, 0.0002766f, -1.9672706f, 0.9683768f}, {0.0002769f, 0.0005538f, 0.0002769f, -1.9695144f, 0.9706219f}, {0.0002772f, 0.0005543f, 0.0002772f, -1.971549f, 0.9726577f}, {0.0002774f, 0.0005549f, 0.0002774f, -1.9733968f, 0.9745065f}, {0.0002777f, 0.0005553f, 0.0002777f, -1.9750775f, 0.9761881f}, {0.0002779f, 0.0005558f, 0.0002779f, -1.9766088f, 0.9777203f}, {0.0002781f, 0.0005561f, 0.0002781f, -1.9780065f, 0.9791188f}, {0.0002783f, 0.0005565f, 0.0002783f, -1.9792844f, 0.9803974f}, {0.0002784f, 0.0005568f, 0.0002784f, -1.980455f, 0.9815687f}, {0.0002786f, 0.0005571f, 0.0002786f, -1.9815292f, 0.9826434f}, {0.0002787f, 0.0005574f, 0.0002787f, -1.9825166f, 0.9836314f}, {0.0002788f, 0.0005577f, 0.0002788f, -1.9834258f, 0.9845412f}, {0.000279f, 0.0005579f, 0.000279f, -1.9842646f, 0.9853804f}, {0.0002791f, 0.0005581f, 0.0002791f, -1.9850395f, 0.9861558f}, {0.0002792f, 0.0005583f, 0.0002792f, -1.9857568f, 0.9868734f}, {0.0002793f, 0.0005585f, 0.0002793f, -1.9864216f, 0.9875387f}, {0.0002793f, 0.0005587f, 0.0002793f, -1.9870389f, 0.9881563f}, {0.0002794f, 0.0005588f, 0.0002794f, -1.9876129f, 0.9887306f}, {0.0002795f, 0.000559f, 0.0002795f, -1.9881473f, 0.9892653f}, {0.0002796f, 0.0005591f, 0.0002796f, -1.9886457f, 0.989764f}, {0.0002796f, 0.0005593f, 0.0002796f, -1.9891111f, 0.9902297f}, {0.0002797f, 0.0005594f, 0.0002797f, -1.9895463f, 0.9906651f}, {0.0002798f, 0.0005595f, 0.0002798f, -1.9899538f, 0.9910728f}, {0.0002798f, 0.0005596f, 0.0002798f, -1.9903357f, 0.991455f}, {0.0002799f, 0.0005597f, 0.0002799f, -1.9906942f, 0.9918137f}, {0.0002799f, 0.0005598f, 0.0002799f, -1.9910391f, 0.9921587f}, {0.00028f, 0.0005599f, 0.00028f, -1.991382f, 0.9925018f}, {0.00028f, 0.00056f, 0.00028f, -1.991722f, 0.9928421f}, {0.00028f, 0.0005601f, 0.00028f, -1.9920581f, 0.9931783f}, {0.0002801f, 0.0005602f, 0.0002801f, -1.9923891f, 0.9935095f}, {0.0002801f, 0.0005603f, 0.0002801f, -1.9927138f, 0.9938344f}, {0.0002802f, 0.0005604f, 0.0002802f, -1.9930312f, 0.994152f}, {0.0002802f, 0.0005605f, 0.0002802f, -1.9933403f, 0.9944612f}, {0.0002803f, 0.0005605f, 0.0002803f, -1.9936401f, 0.9947612f}, {0.0002803f, 0.0005606f, 0.0002803f, -1.9939299f, 0.9950512f}, {0.0002804f, 0.0005607f, 0.0002804f, -1.9942091f, 0.9953305f}, {0.0002804f, 0.0005608f, 0.0002804f, -1.9944771f, 0.9955987f}, {0.0002804f, 0.0005608f, 0.0002804f, -1.9947336f, 0.9958553f}, {0.0002805f, 0.0005609f, 0.0002805f, -1.9949783f, 0.9961001f}, {0.0002805f, 0.000561f, 0.0002805f, -1.9952111f, 0.9963331f}, {0.0002805f, 0.000561f, 0.0002805f, -1.9954321f, 0.9965542f}, {0.0002806f, 0.0005611f, 0.0002806f, -1.9956414f, 0.9967636f}, {0.0002806f, 0.0005612f, 0.0002806f, -1.9958392f, 0.9969615f}, {0.0002806f, 0.0005612f, 0.0002806f, -1.9960257f, 0.9971481f}},
-          {{0.0002125f, 0.000425f, 0.0002125f, -1.8870469f, 0.887897f}, {0.0002126f, 0.0004252f, 0.0002126f, -1.887867f, 0.8887174f}, {0.0002129f, 0.0004257f, 0.0002129f, -1.8902568f, 0.8911083f}, {0.0002133f, 0.0004266f, 0.0002133f, -1.8940195f, 0.8948727f}, {0.0002138f, 0.0004277f, 0.0002138f, -1.8988703f, 0.8997257f}, {0.0002145f, 0.0004289f, 0.0002145f, -1.904486f, 0.9053438f}, {0.0002152f, 0.0004303f, 0.0002152f, -1.9105497f, 0.9114103f}, {0.0002159f, 0.0004317f, 0.0002159f, -1.9167844f, 0.9176479f}, {0.0002166f, 0.0004331f, 0.0002166f, -1.9229693f, 0.9238356f}, {0.0002172f, 0.0004345f, 0.0002172f, -1.9289435f, 0.9298124f}, {0.0002179f, 0.0004357f, 0.0002179f, -1.9346004f, 0.9354719f}, {0.0002185f, 0.0004369f, 0.0002185f, -1.9398783f, 0.9407521f}, {0.000219f, 0.000438f, 0.000219f, -1.9447492f, 0.9456252f}, {0.0002195f, 0.000439f, 0.0002195f, -1.9492095f, 0.9500875f}, {0.00022f, 0.0004399f, 0.00022f, -1.9532713f, 0.9541512f}, {0.0002204f, 0.0004408f, 0.0002204f, -1.9569565f, 0.957838f}, {0.0002208f, 0.0004415f, 0.0002208f, -1.9602924f, 0.9611754f}, {0.0002211f, 0.0004422f, 0.0002211f, -1.9633082f, 0.9641926f}, {0.0002214f, 0.0004428f, 0.0002214f, -1.9660336f, 0.9669192f}, {0.0002217f, 0.0004434f, 0.0002217f, -1.9684971f, 0.9693838f}, {0.0002219f, 0.0004439f, 0.0002219f, -1.9707253f, 0.971613f}, {0.0002222f, 0.0004443f, 0.0002222f, -1.9727427f, 0.9736314f}, {0.0002224f, 0.0004447f, 0.0002224f, -1.9745718f, 0.9754612f}, {0.0002226f, 0.0004451f, 0.0002226f, -1.9762325f, 0.9771227f}, {0.0002227f, 0.0004454f, 0.0002227f, -1.9777427f, 0.9786336f}, {0.0002229f, 0.0004458f, 0.0002229f, -1.9791185f, 0.98001f}, {0.000223f, 0.000446f, 0.000223f, -1.980374f, 0.9812661f}, {0.0002231f, 0.0004463f, 0.0002231f, -1.9815219f, 0.9824145f}, {0.0002233f, 0.0004465f, 0.0002233f, -1.9825731f, 0.9834662f}, {0.0002234f, 0.0004467f, 0.0002234f, -1.9835377f, 0.9844312f}, {0.0002235f, 0.0004469f, 0.0002235f, -1.9844242f, 0.9853181f}, {0.0002236f, 0.0004471f, 0.0002236f, -1.9852405f, 0.9861348f}, {0.0002237f, 0.0004473f, 0.0002237f, -1.9859934f, 0.9868881f}, {0.0002237f, 0.0004475f, 0.0002237f, -1.9866891f, 0.987584f}, {0.0002238f, 0.0004476f, 0.0002238f, -1.9873328f, 0.988228f}, {0.0002239f, 0.0004477f, 0.0002239f, -1.9879295f, 0.988825f}, {0.0002239f, 0.0004479f, 0.0002239f, -1.9884835f, 0.9893792f}, {0.000224f, 0.000448f, 0.000224f, -1.9889986f, 0.9898945f}, {0.000224f, 0.0004481f, 0.000224f, -1.9894781f, 0.9903743f}, {0.0002241f, 0.0004482f, 0.0002241f, -1.9899253f, 0.9908217f}, {0.0002241f, 0.0004483f, 0.0002241f, -1.9903429f, 0.9912395f}, {0.0002242f, 0.0004484f, 0.0002242f, -1.9907334f, 0.9916301f}, {0.0002242f, 0.0004485f, 0.0002242f, -1.9910989f, 0.9919958f}, {0.0002243f, 0.0004485f, 0.0002243f, -1.9914415f, 0.9923386f}, {0.0002243f, 0.0004486f, 0.0002243f, -1.9917632f, 0.9926604f}, {0.0002243f, 0.0004487f, 0.0002243f, -1.9920725f, 0.9929698f}, {0.0002244f, 0.0004487f, 0.0002244f, -1.9923801f, 0.9932776f}, {0.0002244f, 0.0004488f, 0.0002244f, -1.9926851f, 0.9935827f}, {0.0002244f, 0.0004489f, 0.0002244f, -1.9929865f, 0.9938843f}, {0.0002245f, 0.0004489f, 0.0002245f, -1.9932834f, 0.9941813f}, {0.0002245f, 0.000449f, 0.0002245f, -1.9935746f, 0.9944727f}, {0.0002245f, 0.0004491f, 0.0002245f, -1.9938593f, 0.9947574f}, {0.0002246f, 0.0004491f, 0.0002246f, -1.9941365f, 0.9950347f}, {0.0002246f, 0.0004492f, 0.0002246f, -1.9944054f, 0.9953038f}, {0.0002246f, 0.0004493f, 0.0002246f, -1.9946653f, 0.9955638f}, {0.0002247f, 0.0004493f, 0.0002247f, -1.9949156f, 0.9958142f}, {0.0002247f, 0.0004494f, 0.0002247f, -1.9951559f, 0.9960546f}, {0.0002247f, 0.0004494f, 0.0002247f, -1.9953859f, 0.9962847f}, {0.0002247f, 0.0004495f, 0.0002247f, -1.9956053f, 0.9965043f}, {0.0002248f, 0.0004495f, 0.0002248f, -1.9958141f, 0.9967131f}, {0.0002248f, 0.0004496f, 0.0002248f, -1.9960123f, 0.9969114f}, {0.0002248f, 0.0004496f, 0.0002248f, -1.9961999f, 0.9970991f}, {0.0002248f, 0.0004496f, 0.0002248f, -1.9963772f, 0.9972765f}, {0.0002248f, 0.0004497f, 0.0002248f, -1.9965444f, 0.9974438f}},
-          {{0.0001712f, 0.0003425f, 0.0001712f, -1.8982742f, 0.8989591f}, {0.0001713f, 0.0003426f, 0.0001713f, -1.8990177f, 0.8997029f}, {0.0001715f, 0.000343f, 0.0001715f, -1.901184f, 0.90187f}, {0.0001718f, 0.0003436f, 0.0001718f, -1.9045938f, 0.905281f}, {0.0001722f, 0.0003444f, 0.0001722f, -1.9089876f, 0.9096765f}, {0.0001727f, 0.0003453f, 0.0001727f, -1.9140714f, 0.9147621f}, {0.0001732f, 0.0003463f, 0.0001732f, -1.9195576f, 0.9202502f}, {0.0001737f, 0.0003473f, 0.0001737f, -1.9251948f, 0.9258895f}, {0.0001742f, 0.0003484f, 0.0001742f, -1.9307834f, 0.9314801f}, {0.0001747f, 0.0003493f, 0.0001747f, -1.9361781f, 0.9368767f}, {0.0001751f, 0.0003503f, 0.0001751f, -1.9412832f, 0.9419837f}, {0.0001756f, 0.0003511f, 0.0001756f, -1.9460435f, 0.9467457f}, {0.000176f, 0.0003519f, 0.000176f, -1.9504345f, 0.9511383f}, {0.0001763f, 0.0003526f, 0.0001763f, -1.9544533f, 0.9551586f}, {0.0001766f, 0.0003533f, 0.0001766f, -1.9581115f, 0.9588181f}, {0.0001769f, 0.0003539f, 0.0001769f, -1.9614292f, 0.9621369f}, {0.0001772f, 0.0003544f, 0.0001772f, -1.9644312f, 0.9651401f}, {0.0001775f, 0.0003549f, 0.0001775f, -1.9671444f, 0.9678542f}, {0.0001777f, 0.0003554f, 0.0001777f, -1.9695955f, 0.9703062f}, {0.0001779f, 0.0003558f, 0.0001779f, -1.9718105f, 0.972522f}, {0.0001781f, 0.0003561f, 0.0001781f, -1.9738134f, 0.9745256f}, {0.0001782f, 0.0003564f, 0.0001782f, -1.9756265f, 0.9763394f}, {0.0001784f, 0.0003567f, 0.0001784f, -1.97727f, 0.9779835f}, {0.0001785f, 0.000357f, 0.0001785f, -1.9787619f, 0.9794759f}, {0.0001786f, 0.0003573f, 0.0001786f, -1.9801184f, 0.9808329f}, {0.0001787f, 0.0003575f, 0.0001787f, -1.981354f, 0.9820689f}, {0.0001788f, 0.0003577f, 0.0001788f, -1.9824814f, 0.9831968f}, {0.0001789f, 0.0003579f, 0.0001789f, -1.983512f, 0.9842277f}, {0.000179f, 0.000358f, 0.000179f, -1.9844557f, 0.9851718f}, {0.0001791f, 0.0003582f, 0.0001791f, -1.9853215f, 0.9860379f}, {0.0001792f, 0.0003583f, 0.0001792f, -1.9861173f, 0.9868339f}, {0.0001792f, 0.0003585f, 0.0001792f, -1.9868499f, 0.9875668f}, {0.0001793f, 0.0003586f, 0.0001793f, -1.9875256f, 0.9882428f}, {0.0001794f, 0.0003587f, 0.0001794f, -1.9881498f, 0.9888672f}, {0.0001794f, 0.0003588f, 0.0001794f, -1.9887274f, 0.989445f}, {0.0001795f, 0.0003589f, 0.0001795f, -1.9892628f, 0.9899806f}, {0.0001795f, 0.000359f, 0.0001795f, -1.9897598f, 0.9904778f}, {0.0001795f, 0.0003591f, 0.0001795f, -1.9902218f, 0.99094f}, {0.0001796f, 0.0003592f, 0.0001796f, -1.9906521f, 0.9913704f}, {0.0001796f, 0.0003592f, 0.0001796f, -1.9910532f, 0.9917717f}, {0.0001796f, 0.0003593f, 0.0001796f, -1.9914278f, 0.9921464f}, {0.0001797f, 0.0003594f, 0.0001797f, -1.991778f, 0.9924967f}, {0.0001797f, 0.0003594f, 0.0001797f, -1.9921058f, 0.9928247f}, {0.0001797f, 0.0003595f, 0.0001797f, -1.9924132f, 0.9931321f}, {0.0001798f, 0.0003595f, 0.0001798f, -1.9927016f, 0.9934206f}, {0.0001798f, 0.0003596f, 0.0001798f, -1.992979f, 0.9936982f}, {0.0001798f, 0.0003596f, 0.0001798f, -1.9932549f, 0.9939741f}, {0.0001798f, 0.0003597f, 0.0001798f, -1.9935284f, 0.9942477f}, {0.0001799f, 0.0003597f, 0.0001799f, -1.9937987f, 0.9945182f}, {0.0001799f, 0.0003598f, 0.0001799f, -1.9940649f, 0.9947844f}, {0.0001799f, 0.0003598f, 0.0001799f, -1.994326f, 0.9950457f}, {0.0001799f, 0.0003599f, 0.0001799f, -1.9945813f, 0.995301f}, {0.00018f, 0.0003599f, 0.00018f, -1.9948298f, 0.9955496f}, {0.00018f, 0.00036f, 0.00018f, -1.9950709f, 0.9957908f}, {0.00018f, 0.00036f, 0.00018f, -1.9953039f, 0.9960239f}, {0.00018f, 0.00036f, 0.00018f, -1.9955284f, 0.9962484f}, {0.00018f, 0.0003601f, 0.00018f, -1.9957438f, 0.996464f}, {0.0001801f, 0.0003601f, 0.0001801f, -1.99595f, 0.9966702f}, {0.0001801f, 0.0003601f, 0.0001801f, -1.9961467f, 0.996867f}, {0.0001801f, 0.0003602f, 0.0001801f, -1.9963339f, 0.9970542f}, {0.0001801f, 0.0003602f, 0.0001801f, -1.9965115f, 0.9972319f}, {0.0001801f, 0.0003602f, 0.0001801f, -1.9966797f, 0.9974002f}, {0.0001801f, 0.0003603f, 0.0001801f, -1.9968387f, 0.9975592f}, {0.0001802f, 0.0003603f, 0.0001802f, -1.9969886f, 0.9977092f}},
-          {{0.0001379f, 0.0002758f, 0.0001379f, -1.9084412f, 0.9089928f}, {0.000138f, 0.0002759f, 0.000138f, -1.9091144f, 0.9096663f}, {0.0001381f, 0.0002762f, 0.0001381f, -1.9110757f, 0.9116281f}, {0.0001383f, 0.0002767f, 0.0001383f, -1.9141618f, 0.9147151f}, {0.0001386f, 0.0002772f, 0.0001386f, -1.918137f, 0.9186915f}, {0.0001389f, 0.0002779f, 0.0001389f, -1.9227341f, 0.9232899f}, {0.0001393f, 0.0002786f, 0.0001393f, -1.9276923f, 0.9282495f}, {0.0001397f, 0.0002793f, 0.0001397f, -1.9327841f, 0.9333428f}, {0.00014f, 0.0002801f, 0.00014f, -1.937829f, 0.9383891f}, {0.0001404f, 0.0002808f, 0.0001404f, -1.942696f, 0.9432576f}, {0.0001407f, 0.0002814f, 0.0001407f, -1.9472993f, 0.9478622f}, {0.000141f, 0.0002821f, 0.000141f, -1.9515895f, 0.9521536f}, {0.0001413f, 0.0002826f, 0.0001413f, -1.9555449f, 0.9561102f}, {0.0001416f, 0.0002832f, 0.0001416f, -1.9591635f, 0.9597298f}, {0.0001418f, 0.0002836f, 0.0001418f, -1.962456f, 0.9630233f}, {0.000142f, 0.0002841f, 0.000142f, -1.965441f, 0.9660092f}, {0.0001422f, 0.0002845f, 0.0001422f, -1.9681411f, 0.9687101f}, {0.0001424f, 0.0002848f, 0.0001424f, -1.9705807f, 0.9711503f}, {0.0001426f, 0.0002851f, 0.0001426f, -1.9727841f, 0.9733543f}, {0.0001427f, 0.0002854f, 0.0001427f, -1.9747747f, 0.9753455f}, {0.0001428f, 0.0002857f, 0.0001428f, -1.9765743f, 0.9771456f}, {0.000143f, 0.0002859f, 0.000143f, -1.978203f, 0.9787749f}, {0.0001431f, 0.0002861f, 0.0001431f, -1.9796791f, 0.9802514f}, {0.0001432f, 0.0002863f, 0.0001432f, -1.9810189f, 0.9815915f}, {0.0001432f, 0.0002865f, 0.0001432f, -1.9822369f, 0.9828099f}, {0.0001433f, 0.0002867f, 0.0001433f, -1.9833461f, 0.9839194f}, {0.0001434f, 0.0002868f, 0.0001434f, -1.9843581f, 0.9849318f}, {0.0001435f, 0.0002869f, 0.0001435f, -1.9852831f, 0.985857f}, {0.0001435f, 0.0002871f, 0.0001435f, -1.9861301f, 0.9867042f}, {0.0001436f, 0.0002872f, 0.0001436f, -1.9869071f, 0.9874814f}, {0.0001436f, 0.0002873f, 0.0001436f, -1.9876211f, 0.9881956f}, {0.0001437f, 0.0002874f, 0.0001437f, -1.9882784f, 0.9888531f}, {0.0001437f, 0.0002875f, 0.0001437f, -1.9888846f, 0.9894595f}, {0.0001438f, 0.0002875f, 0.0001438f, -1.9894446f, 0.9900196f}, {0.0001438f, 0.0002876f, 0.0001438f, -1.9899627f, 0.990538f}, {0.0001438f, 0.0002877f, 0.0001438f, -1.9904429f, 0.9910183f}, {0.0001439f, 0.0002877f, 0.0001439f, -1.9908887f, 0.9914642f}, {0.0001439f, 0.0002878f, 0.0001439f, -1.9913031f, 0.9918788f}, {0.0001439f, 0.0002879f, 0.0001439f, -1.991689f, 0.9922647f}, {0.000144f, 0.0002879f, 0.000144f, -1.9920487f, 0.9926246f}, {0.000144f, 0.000288f, 0.000144f, -1.9923846f, 0.9929606f}, {0.000144f, 0.000288f, 0.000144f, -1.9926987f, 0.9932747f}, {0.000144f, 0.0002881f, 0.000144f, -1.9929927f, 0.9935688f}, {0.000144f, 0.0002881f, 0.000144f, -1.9932682f, 0.9938444f}, {0.0001441f, 0.0002881f, 0.0001441f, -1.9935269f, 0.9941031f}, {0.0001441f, 0.0002882f, 0.0001441f, -1.9937756f, 0.9943519f}, {0.0001441f, 0.0002882f, 0.0001441f, -1.9940229f, 0.9945993f}, {0.0001441f, 0.0002882f, 0.0001441f, -1.9942682f, 0.9948447f}, {0.0001441f, 0.0002883f, 0.0001441f, -1.9945105f, 0.9950871f}, {0.0001442f, 0.0002883f, 0.0001442f, -1.9947492f, 0.9953258f}, {0.0001442f, 0.0002883f, 0.0001442f, -1.9949833f, 0.99556f}, {0.0001442f, 0.0002884f, 0.0001442f, -1.9952121f, 0.9957889f}, {0.0001442f, 0.0002884f, 0.0001442f, -1.9954349f, 0.9960117f}, {0.0001442f, 0.0002884f, 0.0001442f, -1.995651f, 0.9962279f}, {0.0001442f, 0.0002885f, 0.0001442f, -1.9958599f, 0.9964368f}, {0.0001442f, 0.0002885f, 0.0001442f, -1.9960611f, 0.9966381f}, {0.0001443f, 0.0002885f, 0.0001443f, -1.9962542f, 0.9968313f}, {0.0001443f, 0.0002886f, 0.0001443f, -1.996439f, 0.9970161f}, {0.0001443f, 0.0002886f, 0.0001443f, -1.9966153f, 0.9971925f}, {0.0001443f, 0.0002886f, 0.0001443f, -1.9967831f, 0.9973603f}, {0.0001443f, 0.0002886f, 0.0001443f, -1.9969423f, 0.9975196f}, {0.0001443f, 0.0002886f, 0.0001443f, -1.9970931f, 0.9976704f}, {0.0001443f, 0.0002887f, 0.0001443f, -1.9972355f, 0.9978129f}, {0.0001443f, 0.0002887f, 0.0001443f, -1.9973699f, 0.9979472f}},
-          {{0.000111f, 0.000222f, 0.000111f, -1.9176375f, 0.9180816f}, {0.0001111f, 0.0002221f, 0.0001111f, -1.9182464f, 0.9186906f}, {0.0001112f, 0.0002223f, 0.0001112f, -1.92002f, 0.9204647f}, {0.0001113f, 0.0002226f, 0.0001113f, -1.9228101f, 0.9232554f}, {0.0001115f, 0.000223f, 0.0001115f, -1.9264027f, 0.9268488f}, {0.0001118f, 0.0002235f, 0.0001118f, -1.9305554f, 0.9310024f}, {0.000112f, 0.000224f, 0.000112f, -1.9350321f, 0.9354802f}, {0.0001123f, 0.0002246f, 0.0001123f, -1.9396269f, 0.9400761f}, {0.0001126f, 0.0002251f, 0.0001126f, -1.944177f, 0.9446273f}, {0.0001128f, 0.0002256f, 0.0001128f, -1.9485645f, 0.9490158f}, {0.000113f, 0.0002261f, 0.000113f, -1.9527122f, 0.9531644f}, {0.0001133f, 0.0002265f, 0.0001133f, -1.9565759f, 0.957029f}, {0.0001135f, 0.000227f, 0.0001135f, -1.9601366f, 0.9605906f}, {0.0001137f, 0.0002273f, 0.0001137f, -1.9633929f, 0.9638475f}, {0.0001138f, 0.0002277f, 0.0001138f, -1.9663546f, 0.9668099f}, {0.000114f, 0.000228f, 0.000114f, -1.9690388f, 0.9694948f}, {0.0001141f, 0.0002283f, 0.0001141f, -1.9714661f, 0.9719227f}, {0.0001143f, 0.0002285f, 0.0001143f, -1.9736586f, 0.9741157f}, {0.0001144f, 0.0002287f, 0.0001144f, -1.9756384f, 0.9760959f}, {0.0001145f, 0.000229f, 0.0001145f, -1.9774266f, 0.9778845f}, {0.0001146f, 0.0002291f, 0.0001146f, -1.9790429f, 0.9795012f}, {0.0001147f, 0.0002293f, 0.0001147f, -1.9805055f, 0.9809641f}, {0.0001147f, 0.0002295f, 0.0001147f, -1.9818307f, 0.9822897f}, {0.0001148f, 0.0002296f, 0.0001148f, -1.9830334f, 0.9834926f}, {0.0001149f, 0.0002297f, 0.0001149f, -1.9841267f, 0.9845861f}, {0.0001149f, 0.0002298f, 0.0001149f, -1.9851222f, 0.9855819f}, {0.000115f, 0.0002299f, 0.000115f, -1.9860304f, 0.9864903f}, {0.000115f, 0.00023f, 0.000115f, -1.9868603f, 0.9873204f}, {0.0001151f, 0.0002301f, 0.0001151f, -1.9876202f, 0.9880805f}, {0.0001151f, 0.0002302f, 0.0001151f, -1.9883173f, 0.9887777f}, {0.0001151f, 0.0002303f, 0.0001151f, -1.9889578f, 0.9894184f}, {0.0001152f, 0.0002304f, 0.0001152f, -1.9895474f, 0.9900081f}, {0.0001152f, 0.0002304f, 0.0001152f, -1.9900911f, 0.9905519f}, {0.0001152f, 0.0002305f, 0.0001152f, -1.9905933f, 0.9910543f}, {0.0001153f, 0.0002305f, 0.0001153f, -1.991058f, 0.9915191f}, {0.0001153f, 0.0002306f, 0.0001153f, -1.9914887f, 0.9919498f}, {0.0001153f, 0.0002306f, 0.0001153f, -1.9918884f, 0.9923497f}, {0.0001153f, 0.0002307f, 0.0001153f, -1.99226f, 0.9927214f}, {0.0001154f, 0.0002307f, 0.0001154f, -1.992606f, 0.9930674f}, {0.0001154f, 0.0002307f, 0.0001154f, -1.9929286f, 0.9933901f}, {0.0001154f, 0.0002308f, 0.0001154f, -1.9932297f, 0.9936913f}, {0.0001154f, 0.0002308f, 0.0001154f, -1.9935113f, 0.9939729f}, {0.0001154f, 0.0002308f, 0.0001154f, -1.9937749f, 0.9942366f}, {0.0001154f, 0.0002309f, 0.0001154f, -1.9940219f, 0.9944837f}, {0.0001155f, 0.0002309f, 0.0001155f, -1.9942538f, 0.9947156f}, {0.0001155f, 0.0002309f, 0.0001155f, -1.9944768f, 0.9949386f}, {0.0001155f, 0.000231f, 0.0001155f, -1.9946985f, 0.9951604f}, {0.0001155f, 0.000231f, 0.0001155f, -1.9949183f, 0.9953803f}, {0.0001155f, 0.000231f, 0.0001155f, -1.9951355f, 0.9955975f}, {0.0001155f, 0.000231f, 0.0001155f, -1.9953495f, 0.9958115f}, {0.0001155f, 0.0002311f, 0.0001155f, -1.9955593f, 0.9960214f}, {0.0001155f, 0.0002311f, 0.0001155f, -1.9957644f, 0.9962266f}, {0.0001155f, 0.0002311f, 0.0001155f, -1.9959641f, 0.9964263f}, {0.0001156f, 0.0002311f, 0.0001156f, -1.9961578f, 0.99662f}, {0.0001156f, 0.0002311f, 0.0001156f, -1.996345f, 0.9968073f}, {0.0001156f, 0.0002312f, 0.0001156f, -1.9965253f, 0.9969876f}, {0.0001156f, 0.0002312f, 0.0001156f, -1.9966984f, 0.9971608f}, {0.0001156f, 0.0002312f, 0.0001156f, -1.996864f, 0.9973264f}, {0.0001156f, 0.0002312f, 0.0001156f, -1.997022f, 0.9974845f}, {0.0001156f, 0.0002312f, 0.0001156f, -1.9971724f, 0.9976349f}, {0.0001156f, 0.0002313f, 0.0001156f, -1.9973151f, 0.9977776f}, {0.0001156f, 0.0002313f, 0.0001156f, -1.9974502f, 0.9979127f}, {0.0001156f, 0.0002313f, 0.0001156f, -1.9975778f, 0.9980404f}, {0.0001156f, 0.0002313f, 0.0001156f, -1.9976982f, 0.9981608f}},
-          {{8.93e-05f, 0.0001786f, 8.93e-05f, -1.9259472f, 0.9263045f}, {8.93e-05f, 0.0001787f, 8.93e-05f, -1.9264974f, 0.9268548f}, {8.94e-05f, 0.0001788f, 8.94e-05f, -1.9280996f, 0.9284573f}, {8.95e-05f, 0.0001791f, 8.95e-05f, -1.9306195f, 0.9309776f}, {8.97e-05f, 0.0001794f, 8.97e-05f, -1.9338631f, 0.9342218f}, {8.99e-05f, 0.0001797f, 8.99e-05f, -1.9376109f, 0.9379703f}, {9e-05f, 0.0001801f, 9e-05f, -1.9416492f, 0.9420094f}, {9.02e-05f, 0.0001805f, 9.02e-05f, -1.9457922f, 0.9461532f}, {9.04e-05f, 0.0001809f, 9.04e-05f, -1.9498929f, 0.9502547f}, {9.06e-05f, 0.0001812f, 9.06e-05f, -1.9538452f, 0.9542077f}, {9.08e-05f, 0.0001816f, 9.08e-05f, -1.9575798f, 0.9579429f}, {9.09e-05f, 0.0001819f, 9.09e-05f, -1.9610572f, 0.961421f}, {9.11e-05f, 0.0001822f, 9.11e-05f, -1.9642608f, 0.9646251f}, {9.12e-05f, 0.0001825f, 9.12e-05f, -1.9671893f, 0.9675542f}, {9.14e-05f, 0.0001827f, 9.14e-05f, -1.9698521f, 0.9702175f}, {9.15e-05f, 0.0001829f, 9.15e-05f, -1.9722646f, 0.9726305f}, {9.16e-05f, 0.0001831f, 9.16e-05f, -1.9744457f, 0.974812f}, {9.17e-05f, 0.0001833f, 9.17e-05f, -1.9764154f, 0.976782f}, {9.17e-05f, 0.0001835f, 9.17e-05f, -1.9781935f, 0.9785605f}, {9.18e-05f, 0.0001836f, 9.18e-05f, -1.9797992f, 0.9801665f}, {9.19e-05f, 0.0001838f, 9.19e-05f, -1.9812504f, 0.9816179f}, {9.19e-05f, 0.0001839f, 9.19e-05f, -1.9825633f, 0.9829311f}, {9.2e-05f, 0.000184f, 9.2e-05f, -1.9837528f, 0.9841208f}, {9.2e-05f, 0.0001841f, 9.2e-05f, -1.9848321f, 0.9852003f}, {9.21e-05f, 0.0001842f, 9.21e-05f, -1.9858131f, 0.9861815f}, {9.21e-05f, 0.0001843f, 9.21e-05f, -1.9867063f, 0.9870748f}, {9.22e-05f, 0.0001843f, 9.22e-05f, -1.987521f, 0.9878897f}, {9.22e-05f, 0.0001844f, 9.22e-05f, -1.9882655f, 0.9886344f}, {9.22e-05f, 0.0001845f, 9.22e-05f, -1.9889472f, 0.9893161f}, {9.23e-05f, 0.0001845f, 9.23e-05f, -1.9895723f, 0.9899414f}, {9.23e-05f, 0.0001846f, 9.23e-05f, -1.9901468f, 0.9905159f}, {9.23e-05f, 0.0001846f, 9.23e-05f, -1.9906755f, 0.9910448f}, {9.23e-05f, 0.0001847f, 9.23e-05f, -1.9911631f, 0.9915324f}, {9.24e-05f, 0.0001847f, 9.24e-05f, -1.9916134f, 0.9919829f}, {9.24e-05f, 0.0001848f, 9.24e-05f, -1.9920301f, 0.9923996f}, {9.24e-05f, 0.0001848f, 9.24e-05f, -1.9924162f, 0.9927858f}, {9.24e-05f, 0.0001848f, 9.24e-05f, -1.9927746f, 0.9931443f}, {9.24e-05f, 0.0001849f, 9.24e-05f, -1.9931077f, 0.9934775f}, {9.24e-05f, 0.0001849f, 9.24e-05f, -1.9934179f, 0.9937877f}, {9.25e-05f, 0.0001849f, 9.25e-05f, -1.9937071f, 0.9940769f}, {9.25e-05f, 0.0001849f, 9.25e-05f, -1.993977f, 0.9943469f}, {9.25e-05f, 0.000185f, 9.25e-05f, -1.9942294f, 0.9945994f}, {9.25e-05f, 0.000185f, 9.25e-05f, -1.9944657f, 0.9948357f}, {9.25e-05f, 0.000185f, 9.25e-05f, -1.9946871f, 0.9950572f}, {9.25e-05f, 0.000185f, 9.25e-05f, -1.9948949f, 0.995265f}, {9.25e-05f, 0.0001851f, 9.25e-05f, -1.9950948f, 0.9954649f}, {9.25e-05f, 0.0001851f, 9.25e-05f, -1.9952935f, 0.9956637f}, {9.25e-05f, 0.0001851f, 9.25e-05f, -1.9954906f, 0.9958607f}, {9.26e-05f, 0.0001851f, 9.26e-05f, -1.9956853f, 0.9960555f}, {9.26e-05f, 0.0001851f, 9.26e-05f, -1.995877f, 0.9962472f}, {9.26e-05f, 0.0001851f, 9.26e-05f, -1.996065f, 0.9964353f}, {9.26e-05f, 0.0001852f, 9.26e-05f, -1.9962488f, 0.9966192f}, {9.26e-05f, 0.0001852f, 9.26e-05f, -1.9964278f, 0.9967981f}, {9.26e-05f, 0.0001852f, 9.26e-05f, -1.9966014f, 0.9969718f}, {9.26e-05f, 0.0001852f, 9.26e-05f, -1.9967691f, 0.9971396f}, {9.26e-05f, 0.0001852f, 9.26e-05f, -1.9969307f, 0.9973012f}, {9.26e-05f, 0.0001852f, 9.26e-05f, -1.9970858f, 0.9974563f}, {9.26e-05f, 0.0001853f, 9.26e-05f, -1.9972342f, 0.9976047f}, {9.26e-05f, 0.0001853f, 9.26e-05f, -1.9973758f, 0.9977463f}, {9.26e-05f, 0.0001853f, 9.26e-05f, -1.9975105f, 0.9978811f}, {9.26e-05f, 0.0001853f, 9.26e-05f, -1.9976384f, 0.998009f}, {9.26e-05f, 0.0001853f, 9.26e-05f, -1.9977594f, 0.99813f}, {9.27e-05f, 0.0001853f, 9.27e-05f, -1.9978738f, 0.9982444f}, {9.27e-05f, 0.0001853f, 9.27e-05f, -1.9979817f, 0.9983523f}},
-          {{7.18e-05f, 0.0001437f, 7.18e-05f, -1.9334487f, 0.933736f}, {7.19e-05f, 0.0001437f, 7.19e-05f, -1.9339453f, 0.9342327f}, {7.19e-05f, 0.0001438f, 7.19e-05f, -1.9353914f, 0.935679f}, {7.2e-05f, 0.000144f, 7.2e-05f, -1.9376652f, 0.9379531f}, {7.21e-05f, 0.0001442f, 7.21e-05f, -1.9405911f, 0.9408795f}, {7.22e-05f, 0.0001444f, 7.22e-05f, -1.9439706f, 0.9442595f}, {7.24e-05f, 0.0001447f, 7.24e-05f, -1.9476107f, 0.9479001f}, {7.25e-05f, 0.000145f, 7.25e-05f, -1.9513434f, 0.9516334f}, {7.26e-05f, 0.0001453f, 7.26e-05f, -1.9550365f, 0.955327f}, {7.28e-05f, 0.0001455f, 7.28e-05f, -1.9585944f, 0.9588855f}, {7.29e-05f, 0.0001458f, 7.29e-05f, -1.961955f, 0.9622465f}, {7.3e-05f, 0.000146f, 7.3e-05f, -1.965083f, 0.965375f}, {7.31e-05f, 0.0001462f, 7.31e-05f, -1.9679636f, 0.9682561f}, {7.32e-05f, 0.0001464f, 7.32e-05f, -1.9705961f, 0.9708889f}, {7.33e-05f, 0.0001466f, 7.33e-05f, -1.972989f, 0.9732822f}, {7.34e-05f, 0.0001468f, 7.34e-05f, -1.9751565f, 0.97545f}, {7.35e-05f, 0.0001469f, 7.35e-05f, -1.9771155f, 0.9774094f}, {7.35e-05f, 0.000147f, 7.35e-05f, -1.9788843f, 0.9791784f}, {7.36e-05f, 0.0001472f, 7.36e-05f, -1.9804807f, 0.980775f}, {7.36e-05f, 0.0001473f, 7.36e-05f, -1.9819221f, 0.9822167f}, {7.37e-05f, 0.0001474f, 7.37e-05f, -1.9832246f, 0.9835193f}, {7.37e-05f, 0.0001475f, 7.37e-05f, -1.9844028f, 0.9846977f}, {7.38e-05f, 0.0001475f, 7.38e-05f, -1.9854701f, 0.9857651f}, {7.38e-05f, 0.0001476f, 7.38e-05f, -1.9864384f, 0.9867336f}, {7.38e-05f, 0.0001477f, 7.38e-05f, -1.9873184f, 0.9876138f}, {7.39e-05f, 0.0001477f, 7.39e-05f, -1.9881196f, 0.9884151f}, {7.39e-05f, 0.0001478f, 7.39e-05f, -1.9888504f, 0.9891459f}, {7.39e-05f, 0.0001478f, 7.39e-05f, -1.9895181f, 0.9898137f}, {7.39e-05f, 0.0001479f, 7.39e-05f, -1.9901293f, 0.9904251f}, {7.4e-05f, 0.0001479f, 7.4e-05f, -1.9906899f, 0.9909858f}, {7.4e-05f, 0.000148f, 7.4e-05f, -1.991205f, 0.9915009f}, {7.4e-05f, 0.000148f, 7.4e-05f, -1.9916791f, 0.991975f}, {7.4e-05f, 0.000148f, 7.4e-05f, -1.9921162f, 0.9924122f}, {7.4e-05f, 0.0001481f, 7.4e-05f, -1.9925199f, 0.992816f}, {7.4e-05f, 0.0001481f, 7.4e-05f, -1.9928934f, 0.9931896f}, {7.41e-05f, 0.0001481f, 7.41e-05f, -1.9932396f, 0.9935358f}, {7.41e-05f, 0.0001481f, 7.41e-05f, -1.9935608f, 0.9938571f}, {7.41e-05f, 0.0001482f, 7.41e-05f, -1.9938595f, 0.9941558f}, {7.41e-05f, 0.0001482f, 7.41e-05f, -1.9941375f, 0.9944338f}, {7.41e-05f, 0.0001482f, 7.41e-05f, -1.9943966f, 0.994693f}, {7.41e-05f, 0.0001482f, 7.41e-05f, -1.9946386f, 0.994935f}, {7.41e-05f, 0.0001482f, 7.41e-05f, -1.9948648f, 0.9951613f}, {7.41e-05f, 0.0001482f, 7.41e-05f, -1.9950766f, 0.995373f}, {7.41e-05f, 0.0001483f, 7.41e-05f, -1.995275f, 0.9955715f}, {7.41e-05f, 0.0001483f, 7.41e-05f, -1.9954613f, 0.9957578f}, {7.41e-05f, 0.0001483f, 7.41e-05f, -1.9956404f, 0.9959369f}, {7.41e-05f, 0.0001483f, 7.41e-05f, -1.9958185f, 0.996115f}, {7.42e-05f, 0.0001483f, 7.42e-05f, -1.995995f, 0.9962916f}, {7.42e-05f, 0.0001483f, 7.42e-05f, -1.9961695f, 0.9964661f}, {7.42e-05f, 0.0001483f, 7.42e-05f, -1.9963413f, 0.996638f}, {7.42e-05f, 0.0001484f, 7.42e-05f, -1.9965098f, 0.9968065f}, {7.42e-05f, 0.0001484f, 7.42e-05f, -1.9966745f, 0.9969712f}, {7.42e-05f, 0.0001484f, 7.42e-05f, -1.9968349f, 0.9971316f}, {7.42e-05f, 0.0001484f, 7.42e-05f, -1.9969904f, 0.9972872f}, {7.42e-05f, 0.0001484f, 7.42e-05f, -1.9971407f, 0.9974375f}, {7.42e-05f, 0.0001484f, 7.42e-05f, -1.9972855f, 0.9975823f}, {7.42e-05f, 0.0001484f, 7.42e-05f, -1.9974245f, 0.9977213f}, {7.42e-05f, 0.0001484f, 7.42e-05f, -1.9975574f, 0.9978543f}, {7.42e-05f, 0.0001484f, 7.42e-05f, -1.9976843f, 0.9979812f}, {7.42e-05f, 0.0001484f, 7.42e-05f, -1.997805f, 0.9981019f}, {7.42e-05f, 0.0001485f, 7.42e-05f, -1.9979195f, 0.9982164f}, {7.42e-05f, 0.0001485f, 7.42e-05f, -1.998028f, 0.9983249f}, {7.42e-05f, 0.0001485f, 7.42e-05f, -1.9981305f, 0.9984274f}, {7.42e-05f, 0.0001485f, 7.42e-05f, -1.9982271f, 0.9985241f}},
-          {{5.77e-05f, 0.0001155f, 5.77e-05f, -1.9402148f, 0.9404458f}, {5.78e-05f, 0.0001155f, 5.78e-05f, -1.9406626f, 0.9408937f}, {5.78e-05f, 0.0001156f, 5.78e-05f, -1.9419667f, 0.9421979f}, {5.79e-05f, 0.0001157f, 5.79e-05f, -1.9440167f, 0.9442481f}, {5.79e-05f, 0.0001159f, 5.79e-05f, -1.946654f, 0.9468857f}, {5.8e-05f, 0.0001161f, 5.8e-05f, -1.9496991f, 0.9499312f}, {5.81e-05f, 0.0001163f, 5.81e-05f, -1.9529778f, 0.9532103f}, {5.82e-05f, 0.0001165f, 5.82e-05f, -1.9563387f, 0.9565716f}, {5.83e-05f, 0.0001167f, 5.83e-05f, -1.9596625f, 0.9598958f}, {5.84e-05f, 0.0001168f, 5.84e-05f, -1.9628635f, 0.9630972f}, {5.85e-05f, 0.000117f, 5.85e-05f, -1.9658859f, 0.9661199f}, {5.86e-05f, 0.0001172f, 5.86e-05f, -1.9686982f, 0.9689325f}, {5.87e-05f, 0.0001173f, 5.87e-05f, -1.9712872f, 0.9715219f}, {5.87e-05f, 0.0001175f, 5.87e-05f, -1.9736525f, 0.9738874f}, {5.88e-05f, 0.0001176f, 5.88e-05f, -1.975802f, 0.9760372f}, {5.89e-05f, 0.0001177f, 5.89e-05f, -1.9777485f, 0.977984f}, {5.89e-05f, 0.0001178f, 5.89e-05f, -1.9795075f, 0.9797432f}, {5.9e-05f, 0.0001179f, 5.9e-05f, -1.9810953f, 0.9813311f}, {5.9e-05f, 0.000118f, 5.9e-05f, -1.9825281f, 0.9827642f}, {5.9e-05f, 0.0001181f, 5.9e-05f, -1.9838217f, 0.9840578f}, {5.91e-05f, 0.0001182f, 5.91e-05f, -1.9849903f, 0.9852266f}, {5.91e-05f, 0.0001182f, 5.91e-05f, -1.9860473f, 0.9862838f}, {5.91e-05f, 0.0001183f, 5.91e-05f, -1.9870047f, 0.9872413f}, {5.92e-05f, 0.0001183f, 5.92e-05f, -1.9878733f, 0.9881099f}, {5.92e-05f, 0.0001184f, 5.92e-05f, -1.9886625f, 0.9888993f}, {5.92e-05f, 0.0001184f, 5.92e-05f, -1.989381f, 0.9896179f}, {5.92e-05f, 0.0001185f, 5.92e-05f, -1.9900363f, 0.9902732f}, {5.92e-05f, 0.0001185f, 5.92e-05f, -1.990635f, 0.990872f}, {5.93e-05f, 0.0001185f, 5.93e-05f, -1.991183f, 0.9914201f}, {5.93e-05f, 0.0001186f, 5.93e-05f, -1.9916856f, 0.9919227f}, {5.93e-05f, 0.0001186f, 5.93e-05f, -1.9921474f, 0.9923845f}, {5.93e-05f, 0.0001186f, 5.93e-05f, -1.9925723f, 0.9928096f}, {5.93e-05f, 0.0001186f, 5.93e-05f, -1.9929642f, 0.9932014f}, {5.93e-05f, 0.0001187f, 5.93e-05f, -1.9933261f, 0.9935634f}, {5.93e-05f, 0.0001187f, 5.93e-05f, -1.9936609f, 0.9938982f}, {5.93e-05f, 0.0001187f, 5.93e-05f, -1.9939711f, 0.9942085f}, {5.94e-05f, 0.0001187f, 5.94e-05f, -1.994259f, 0.9944964f}, {5.94e-05f, 0.0001187f, 5.94e-05f, -1.9945267f, 0.9947641f}, {5.94e-05f, 0.0001187f, 5.94e-05f, -1.9947758f, 0.9950133f}, {5.94e-05f, 0.0001188f, 5.94e-05f, -1.9950081f, 0.9952456f}, {5.94e-05f, 0.0001188f, 5.94e-05f, -1.9952249f, 0.9954624f}, {5.94e-05f, 0.0001188f, 5.94e-05f, -1.9954276f, 0.9956652f}, {5.94e-05f, 0.0001188f, 5.94e-05f, -1.9956174f, 0.9958549f}, {5.94e-05f, 0.0001188f, 5.94e-05f, -1.9957952f, 0.9960328f}, {5.94e-05f, 0.0001188f, 5.94e-05f, -1.9959621f, 0.9961997f}, {5.94e-05f, 0.0001188f, 5.94e-05f, -1.9961226f, 0.9963602f}, {5.94e-05f, 0.0001188f, 5.94e-05f, -1.9962821f, 0.9965198f}, {5.94e-05f, 0.0001188f, 5.94e-05f, -1.9964403f, 0.996678f}, {5.94e-05f, 0.0001188f, 5.94e-05f, -1.9965967f, 0.9968344f}, {5.94e-05f, 0.0001189f, 5.94e-05f, -1.9967506f, 0.9969883f}, {5.94e-05f, 0.0001189f, 5.94e-05f, -1.9969016f, 0.9971393f}, {5.94e-05f, 0.0001189f, 5.94e-05f, -1.9970491f, 0.9972869f}, {5.94e-05f, 0.0001189f, 5.94e-05f, -1.9971928f, 0.9974306f}, {5.94e-05f, 0.0001189f, 5.94e-05f, -1.9973322f, 0.9975699f}, {5.95e-05f, 0.0001189f, 5.95e-05f, -1.9974668f, 0.9977046f}, {5.95e-05f, 0.0001189f, 5.95e-05f, -1.9975965f, 0.9978344f}, {5.95e-05f, 0.0001189f, 5.95e-05f, -1.997721f, 0.9979589f}, {5.95e-05f, 0.0001189f, 5.95e-05f, -1.9978402f, 0.998078f}, {5.95e-05f, 0.0001189f, 5.95e-05f, -1.9979538f, 0.9981917f}, {5.95e-05f, 0.0001189f, 5.95e-05f, -1.9980619f, 0.9982998f}, {5.95e-05f, 0.0001189f, 5.95e-05f, -1.9981645f, 0.9984024f}, {5.95e-05f, 0.0001189f, 5.95e-05f, -1.9982617f, 0.9984996f}, {5.95e-05f, 0.000119f, 5.95e-05f, -1.9983535f, 0.9985914f}, {5.95e-05f, 0.000119f, 5.95e-05f, -1.9984401f, 0.998678f}},
-          {{4.64e-05f, 9.28e-05f, 4.64e-05f, -1.9463128f, 0.9464984f}, {4.64e-05f, 9.28e-05f, 4.64e-05f, -1.9467164f, 0.9469021f}, {4.64e-05f, 9.29e-05f, 4.64e-05f, -1.9478914f, 0.9480772f}, {4.65e-05f, 9.3e-05f, 4.65e-05f, -1.9497384f, 0.9499243f}, {4.65e-05f, 9.31e-05f, 4.65e-05f, -1.9521138f, 0.9523f}, {4.66e-05f, 9.32e-05f, 4.66e-05f, -1.9548558f, 0.9550422f}, {4.67e-05f, 9.34e-05f, 4.67e-05f, -1.957807f, 0.9579938f}, {4.68e-05f, 9.35e-05f, 4.68e-05f, -1.9608313f, 0.9610183f}, {4.68e-05f, 9.36e-05f, 4.68e-05f, -1.9638211f, 0.9640084f}, {4.69e-05f, 9.38e-05f, 4.69e-05f, -1.9666995f, 0.966887f}, {4.7e-05f, 9.39e-05f, 4.7e-05f, -1.9694163f, 0.9696041f}, {4.7e-05f, 9.4e-05f, 4.7e-05f, -1.9719435f, 0.9721316f}, {4.71e-05f, 9.41e-05f, 4.71e-05f, -1.9742694f, 0.9744577f}, {4.71e-05f, 9.42e-05f, 4.71e-05f, -1.9763939f, 0.9765824f}, {4.72e-05f, 9.43e-05f, 4.72e-05f, -1.978324f, 0.9785127f}, {4.72e-05f, 9.44e-05f, 4.72e-05f, -1.9800715f, 0.9802603f}, {4.72e-05f, 9.45e-05f, 4.72e-05f, -1.9816503f, 0.9818393f}, {4.73e-05f, 9.46e-05f, 4.73e-05f, -1.9830752f, 0.9832643f}, {4.73e-05f, 9.46e-05f, 4.73e-05f, -1.9843609f, 0.9845501f}, {4.73e-05f, 9.47e-05f, 4.73e-05f, -1.9855214f, 0.9857107f}, {4.74e-05f, 9.47e-05f, 4.74e-05f, -1.9865697f, 0.9867591f}, {4.74e-05f, 9.48e-05f, 4.74e-05f, -1.9875177f, 0.9877073f}, {4.74e-05f, 9.48e-05f, 4.74e-05f, -1.9883764f, 0.988566f}, {4.74e-05f, 9.49e-05f, 4.74e-05f, -1.9891552f, 0.989345f}, {4.74e-05f, 9.49e-05f, 4.74e-05f, -1.989863f, 0.9900527f}, {4.75e-05f, 9.49e-05f, 4.75e-05f, -1.9905071f, 0.990697f}, {4.75e-05f, 9.49e-05f, 4.75e-05f, -1.9910946f, 0.9912845f}, {4.75e-05f, 9.5e-05f, 4.75e-05f, -1.9916313f, 0.9918213f}, {4.75e-05f, 9.5e-05f, 4.75e-05f, -1.9921226f, 0.9923126f}, {4.75e-05f, 9.5e-05f, 4.75e-05f, -1.9925731f, 0.9927632f}, {4.75e-05f, 9.5e-05f, 4.75e-05f, -1.992987f, 0.9931771f}, {4.75e-05f, 9.51e-05f, 4.75e-05f, -1.9933679f, 0.993558f}, {4.75e-05f, 9.51e-05f, 4.75e-05f, -1.9937191f, 0.9939092f}, {4.75e-05f, 9.51e-05f, 4.75e-05f, -1.9940434f, 0.9942336f}, {4.76e-05f, 9.51e-05f, 4.76e-05f, -1.9943434f, 0.9945337f}, {4.76e-05f, 9.51e-05f, 4.76e-05f, -1.9946215f, 0.9948117f}, {4.76e-05f, 9.51e-05f, 4.76e-05f, -1.9948795f, 0.9950697f}, {4.76e-05f, 9.51e-05f, 4.76e-05f, -1.9951193f, 0.9953096f}, {4.76e-05f, 9.52e-05f, 4.76e-05f, -1.9953426f, 0.9955329f}, {4.76e-05f, 9.52e-05f, 4.76e-05f, -1.9955507f, 0.995741f}, {4.76e-05f, 9.52e-05f, 4.76e-05f, -1.995745f, 0.9959353f}, {4.76e-05f, 9.52e-05f, 4.76e-05f, -1.9959266f, 0.996117f}, {4.76e-05f, 9.52e-05f, 4.76e-05f, -1.9960966f, 0.996287f}, {4.76e-05f, 9.52e-05f, 4.76e-05f, -1.996256f, 0.9964463f}, {4.76e-05f, 9.52e-05f, 4.76e-05f, -1.9964055f, 0.9965959f}, {4.76e-05f, 9.52e-05f, 4.76e-05f, -1.9965493f, 0.9967397f}, {4.76e-05f, 9.52e-05f, 4.76e-05f, -1.9966922f, 0.9968827f}, {4.76e-05f, 9.52e-05f, 4.76e-05f, -1.996834f, 0.9970244f}, {4.76e-05f, 9.52e-05f, 4.76e-05f, -1.996974f, 0.9971645f}, {4.76e-05f, 9.52e-05f, 4.76e-05f, -1.9971119f, 0.9973024f}, {4.76e-05f, 9.52e-05f, 4.76e-05f, -1.9972472f, 0.9974377f}, {4.76e-05f, 9.52e-05f, 4.76e-05f, -1.9973794f, 0.9975699f}, {4.76e-05f, 9.53e-05f, 4.76e-05f, -1.9975081f, 0.9976986f}, {4.76e-05f, 9.53e-05f, 4.76e-05f, -1.9976329f, 0.9978234f}, {4.76e-05f, 9.53e-05f, 4.76e-05f, -1.9977536f, 0.9979441f}, {4.76e-05f, 9.53e-05f, 4.76e-05f, -1.9978697f, 0.9980603f}, {4.76e-05f, 9.53e-05f, 4.76e-05f, -1.9979813f, 0.9981718f}, {4.76e-05f, 9.53e-05f, 4.76e-05f, -1.998088f, 0.9982785f}, {4.76e-05f, 9.53e-05f, 4.76e-05f, -1.9981898f, 0.9983803f}, {4.76e-05f, 9.53e-05f, 4.76e-05f, -1.9982866f, 0.9984772f}, {4.76e-05f, 9.53e-05f, 4.76e-05f, -1.9983785f, 0.9985691f}, {4.77e-05f, 9.53e-05f, 4.77e-05f, -1.9984656f, 0.9986562f}, {4.77e-05f, 9.53e-05f, 4.77e-05f, -1.9985478f, 0.9987384f}, {4.77e-05f, 9.53e-05f, 4.77e-05f, -1.9986253f, 0.998816f}},
-          {{3.73e-05f, 7.46e-05f, 3.73e-05f, -1.9518049f, 0.9519541f}, {3.73e-05f, 7.46e-05f, 3.73e-05f, -1.9521684f, 0.9523175f}, {3.73e-05f, 7.46e-05f, 3.73e-05f, -1.9532265f, 0.9533757f}, {3.73e-05f, 7.47e-05f, 3.73e-05f, -1.9548893f, 0.9550387f}, {3.74e-05f, 7.48e-05f, 3.74e-05f, -1.9570275f, 0.957177f}, {3.74e-05f, 7.49e-05f, 3.74e-05f, -1.959495f, 0.9596447f}, {3.75e-05f, 7.5e-05f, 3.75e-05f, -1.96215f, 0.9622999f}, {3.75e-05f, 7.51e-05f, 3.75e-05f, -1.9648698f, 0.9650199f}, {3.76e-05f, 7.52e-05f, 3.76e-05f, -1.9675578f, 0.9677081f}, {3.76e-05f, 7.53e-05f, 3.76e-05f, -1.9701448f, 0.9702953f}, {3.77e-05f, 7.54e-05f, 3.77e-05f, -1.9725859f, 0.9727366f}, {3.77e-05f, 7.54e-05f, 3.77e-05f, -1.974856f, 0.9750069f}, {3.78e-05f, 7.55e-05f, 3.78e-05f, -1.9769448f, 0.9770959f}, {3.78e-05f, 7.56e-05f, 3.78e-05f, -1.9788522f, 0.9790034f}, {3.78e-05f, 7.57e-05f, 3.78e-05f, -1.9805847f, 0.9807361f}, {3.79e-05f, 7.57e-05f, 3.79e-05f, -1.9821531f, 0.9823045f}, {3.79e-05f, 7.58e-05f, 3.79e-05f, -1.9835698f, 0.9837213f}, {3.79e-05f, 7.58e-05f, 3.79e-05f, -1.9848481f, 0.9849998f}, {3.79e-05f, 7.59e-05f, 3.79e-05f, -1.9860014f, 0.9861532f}, {3.8e-05f, 7.59e-05f, 3.8e-05f, -1.9870423f, 0.9871941f}, {3.8e-05f, 7.59e-05f, 3.8e-05f, -1.9879824f, 0.9881343f}, {3.8e-05f, 7.6e-05f, 3.8e-05f, -1.9888326f, 0.9889846f}, {3.8e-05f, 7.6e-05f, 3.8e-05f, -1.9896025f, 0.9897545f}, {3.8e-05f, 7.6e-05f, 3.8e-05f, -1.9903008f, 0.9904529f}, {3.8e-05f, 7.61e-05f, 3.8e-05f, -1.9909353f, 0.9910874f}, {3.8e-05f, 7.61e-05f, 3.8e-05f, -1.9915128f, 0.9916649f}, {3.81e-05f, 7.61e-05f, 3.81e-05f, -1.9920394f, 0.9921916f}, {3.81e-05f, 7.61e-05f, 3.81e-05f, -1.9925204f, 0.9926727f}, {3.81e-05f, 7.61e-05f, 3.81e-05f, -1.9929608f, 0.993113f}, {3.81e-05f, 7.62e-05f, 3.81e-05f, -1.9933645f, 0.9935168f}, {3.81e-05f, 7.62e-05f, 3.81e-05f, -1.9937354f, 0.9938878f}, {3.81e-05f, 7.62e-05f, 3.81e-05f, -1.9940768f, 0.9942291f}, {3.81e-05f, 7.62e-05f, 3.81e-05f, -1.9943915f, 0.9945439f}, {3.81e-05f, 7.62e-05f, 3.81e-05f, -1.9946821f, 0.9948345f}, {3.81e-05f, 7.62e-05f, 3.81e-05f, -1.994951f, 0.9951034f}, {3.81e-05f, 7.62e-05f, 3.81e-05f, -1.9952001f, 0.9953525f}, {3.81e-05f, 7.62e-05f, 3.81e-05f, -1.9954313f, 0.9955837f}, {3.81e-05f, 7.62e-05f, 3.81e-05f, -1.9956461f, 0.9957986f}, {3.81e-05f, 7.62e-05f, 3.81e-05f, -1.9958462f, 0.9959987f}, {3.81e-05f, 7.63e-05f, 3.81e-05f, -1.9960326f, 0.9961851f}, {3.81e-05f, 7.63e-05f, 3.81e-05f, -1.9962067f, 0.9963592f}, {3.81e-05f, 7.63e-05f, 3.81e-05f, -1.9963694f, 0.996522f}, {3.81e-05f, 7.63e-05f, 3.81e-05f, -1.9965217f, 0.9966743f}, {3.81e-05f, 7.63e-05f, 3.81e-05f, -1.9966645f, 0.996817f}, {3.81e-05f, 7.63e-05f, 3.81e-05f, -1.9967984f, 0.996951f}, {3.81e-05f, 7.63e-05f, 3.81e-05f, -1.9969273f, 0.9970798f}, {3.81e-05f, 7.63e-05f, 3.81e-05f, -1.9970553f, 0.9972079f}, {3.81e-05f, 7.63e-05f, 3.81e-05f, -1.9971823f, 0.9973349f}, {3.82e-05f, 7.63e-05f, 3.82e-05f, -1.9973078f, 0.9974604f}, {3.82e-05f, 7.63e-05f, 3.82e-05f, -1.9974313f, 0.9975839f}, {3.82e-05f, 7.63e-05f, 3.82e-05f, -1.9975525f, 0.9977051f}, {3.82e-05f, 7.63e-05f, 3.82e-05f, -1.9976709f, 0.9978235f}, {3.82e-05f, 7.63e-05f, 3.82e-05f, -1.9977862f, 0.9979388f}, {3.82e-05f, 7.63e-05f, 3.82e-05f, -1.997898f, 0.9980506f}, {3.82e-05f, 7.63e-05f, 3.82e-05f, -1.998006f, 0.9981587f}, {3.82e-05f, 7.63e-05f, 3.82e-05f, -1.9981101f, 0.9982628f}, {3.82e-05f, 7.63e-05f, 3.82e-05f, -1.99821f, 0.9983627f}, {3.82e-05f, 7.63e-05f, 3.82e-05f, -1.9983056f, 0.9984583f}, {3.82e-05f, 7.63e-05f, 3.82e-05f, -1.9983968f, 0.9985494f}, {3.82e-05f, 7.63e-05f, 3.82e-05f, -1.9984835f, 0.9986362f}, {3.82e-05f, 7.64e-05f, 3.82e-05f, -1.9985658f, 0.9987185f}, {3.82e-05f, 7.64e-05f, 3.82e-05f, -1.9986438f, 0.9987965f}, {3.82e-05f, 7.64e-05f, 3.82e-05f, -1.9987174f, 0.9988701f}, {3.82e-05f, 7.64e-05f, 3.82e-05f, -1.9987869f, 0.9989396f}},
-          {{2.99e-05f, 5.99e-05f, 2.99e-05f, -1.9567482f, 0.956868f}, {2.99e-05f, 5.99e-05f, 2.99e-05f, -1.9570753f, 0.9571951f}, {3e-05f, 5.99e-05f, 3e-05f, -1.9580275f, 0.9581474f}, {3e-05f, 6e-05f, 3e-05f, -1.9595237f, 0.9596436f}, {3e-05f, 6e-05f, 3e-05f, -1.9614472f, 0.9615673f}, {3e-05f, 6.01e-05f, 3e-05f, -1.9636664f, 0.9637866f}, {3.01e-05f, 6.02e-05f, 3.01e-05f, -1.9660537f, 0.966174f}, {3.01e-05f, 6.02e-05f, 3.01e-05f, -1.9684985f, 0.968619f}, {3.02e-05f, 6.03e-05f, 3.02e-05f, -1.9709141f, 0.9710347f}, {3.02e-05f, 6.04e-05f, 3.02e-05f, -1.9732382f, 0.973359f}, {3.02e-05f, 6.05e-05f, 3.02e-05f, -1.9754307f, 0.9755516f}, {3.03e-05f, 6.05e-05f, 3.03e-05f, -1.9774691f, 0.9775902f}, {3.03e-05f, 6.06e-05f, 3.03e-05f, -1.9793443f, 0.9794655f}, {3.03e-05f, 6.06e-05f, 3.03e-05f, -1.9810562f, 0.9811775f}, {3.03e-05f, 6.07e-05f, 3.03e-05f, -1.982611f, 0.9827323f}, {3.04e-05f, 6.07e-05f, 3.04e-05f, -1.9840181f, 0.9841396f}, {3.04e-05f, 6.08e-05f, 3.04e-05f, -1.985289f, 0.9854105f}, {3.04e-05f, 6.08e-05f, 3.04e-05f, -1.9864356f, 0.9865572f}, {3.04e-05f, 6.08e-05f, 3.04e-05f, -1.98747f, 0.9875916f}, {3.04e-05f, 6.09e-05f, 3.04e-05f, -1.9884033f, 0.988525f}, {3.04e-05f, 6.09e-05f, 3.04e-05f, -1.9892463f, 0.9893681f}, {3.05e-05f, 6.09e-05f, 3.05e-05f, -1.9900085f, 0.9901303f}, {3.05e-05f, 6.09e-05f, 3.05e-05f, -1.9906987f, 0.9908206f}, {3.05e-05f, 6.09e-05f, 3.05e-05f, -1.9913247f, 0.9914466f}, {3.05e-05f, 6.1e-05f, 3.05e-05f, -1.9918934f, 0.9920153f}, {3.05e-05f, 6.1e-05f, 3.05e-05f, -1.992411f, 0.9925329f}, {3.05e-05f, 6.1e-05f, 3.05e-05f, -1.9928829f, 0.9930049f}, {3.05e-05f, 6.1e-05f, 3.05e-05f, -1.9933141f, 0.9934361f}, {3.05e-05f, 6.1e-05f, 3.05e-05f, -1.9937087f, 0.9938307f}, {3.05e-05f, 6.1e-05f, 3.05e-05f, -1.9940705f, 0.9941925f}, {3.05e-05f, 6.1e-05f, 3.05e-05f, -1.9944028f, 0.9945249f}, {3.05e-05f, 6.1e-05f, 3.05e-05f, -1.9947087f, 0.9948308f}, {3.05e-05f, 6.11e-05f, 3.05e-05f, -1.9949907f, 0.9951128f}, {3.05e-05f, 6.11e-05f, 3.05e-05f, -1.9952511f, 0.9953732f}, {3.05e-05f, 6.11e-05f, 3.05e-05f, -1.995492f, 0.9956141f}, {3.05e-05f, 6.11e-05f, 3.05e-05f, -1.9957151f, 0.9958373f}, {3.05e-05f, 6.11e-05f, 3.05e-05f, -1.9959223f, 0.9960444f}, {3.05e-05f, 6.11e-05f, 3.05e-05f, -1.9961148f, 0.996237f}, {3.05e-05f, 6.11e-05f, 3.05e-05f, -1.996294f, 0.9964162f}, {3.06e-05f, 6.11e-05f, 3.06e-05f, -1.996461f, 0.9965832f}, {3.06e-05f, 6.11e-05f, 3.06e-05f, -1.996617f, 0.9967392f}, {3.06e-05f, 6.11e-05f, 3.06e-05f, -1.9967627f, 0.996885f}, {3.06e-05f, 6.11e-05f, 3.06e-05f, -1.9968992f, 0.9970214f}, {3.06e-05f, 6.11e-05f, 3.06e-05f, -1.997027f, 0.9971493f}, {3.06e-05f, 6.11e-05f, 3.06e-05f, -1.997147f, 0.9972693f}, {3.06e-05f, 6.11e-05f, 3.06e-05f, -1.9972624f, 0.9973847f}, {3.06e-05f, 6.11e-05f, 3.06e-05f, -1.9973771f, 0.9974994f}, {3.06e-05f, 6.11e-05f, 3.06e-05f, -1.9974909f, 0.9976131f}, {3.06e-05f, 6.11e-05f, 3.06e-05f, -1.9976033f, 0.9977255f}, {3.06e-05f, 6.11e-05f, 3.06e-05f, -1.9977139f, 0.9978362f}, {3.06e-05f, 6.11e-05f, 3.06e-05f, -1.9978224f, 0.9979447f}, {3.06e-05f, 6.11e-05f, 3.06e-05f, -1.9979285f, 0.9980508f}, {3.06e-05f, 6.11e-05f, 3.06e-05f, -1.9980318f, 0.9981541f}, {3.06e-05f, 6.12e-05f, 3.06e-05f, -1.9981319f, 0.9982542f}, {3.06e-05f, 6.12e-05f, 3.06e-05f, -1.9982287f, 0.998351f}, {3.06e-05f, 6.12e-05f, 3.06e-05f, -1.9983219f, 0.9984442f}, {3.06e-05f, 6.12e-05f, 3.06e-05f, -1.9984114f, 0.9985337f}, {3.06e-05f, 6.12e-05f, 3.06e-05f, -1.998497f, 0.9986193f}, {3.06e-05f, 6.12e-05f, 3.06e-05f, -1.9985786f, 0.998701f}, {3.06e-05f, 6.12e-05f, 3.06e-05f, -1.9986563f, 0.9987787f}, {3.06e-05f, 6.12e-05f, 3.06e-05f, -1.9987301f, 0.9988524f}, {3.06e-05f, 6.12e-05f, 3.06e-05f, -1.9987999f, 0.9989222f}, {3.06e-05f, 6.12e-05f, 3.06e-05f, -1.9988658f, 0.9989882f}, {3.06e-05f, 6.12e-05f, 3.06e-05f, -1.998928f, 0.9990504f}},
-          {{2.4e-05f, 4.81e-05f, 2.4e-05f, -1.961195f, 0.9612912f}, {2.4e-05f, 4.81e-05f, 2.4e-05f, -1.9614892f, 0.9615854f}, {2.41e-05f, 4.81e-05f, 2.41e-05f, -1.9623456f, 0.9624418f}, {2.41e-05f, 4.81e-05f, 2.41e-05f, -1.9636912f, 0.9637874f}, {2.41e-05f, 4.82e-05f, 2.41e-05f, -1.9654207f, 0.965517f}, {2.41e-05f, 4.82e-05f, 2.41e-05f, -1.9674156f, 0.9675121f}, {2.41e-05f, 4.83e-05f, 2.41e-05f, -1.9695611f, 0.9696577f}, {2.42e-05f, 4.83e-05f, 2.42e-05f, -1.9717578f, 0.9718544f}, {2.42e-05f, 4.84e-05f, 2.42e-05f, -1.9739276f, 0.9740244f}, {2.42e-05f, 4.84e-05f, 2.42e-05f, -1.9760148f, 0.9761117f}, {2.42e-05f, 4.85e-05f, 2.42e-05f, -1.9779833f, 0.9780803f}, {2.43e-05f, 4.85e-05f, 2.43e-05f, -1.979813f, 0.9799101f}, {2.43e-05f, 4.86e-05f, 2.43e-05f, -1.9814959f, 0.9815931f}, {2.43e-05f, 4.86e-05f, 2.43e-05f, -1.983032f, 0.9831292f}, {2.43e-05f, 4.87e-05f, 2.43e-05f, -1.9844268f, 0.9845241f}, {2.43e-05f, 4.87e-05f, 2.43e-05f, -1.985689f, 0.9857863f}, {2.44e-05f, 4.87e-05f, 2.44e-05f, -1.9868288f, 0.9869262f}, {2.44e-05f, 4.87e-05f, 2.44e-05f, -1.987857f, 0.9879545f}, {2.44e-05f, 4.88e-05f, 2.44e-05f, -1.9887845f, 0.988882f}, {2.44e-05f, 4.88e-05f, 2.44e-05f, -1.9896213f, 0.9897188f}, {2.44e-05f, 4.88e-05f, 2.44e-05f, -1.990377f, 0.9904746f}, {2.44e-05f, 4.88e-05f, 2.44e-05f, -1.9910602f, 0.9911579f}, {2.44e-05f, 4.88e-05f, 2.44e-05f, -1.9916789f, 0.9917766f}, {2.44e-05f, 4.88e-05f, 2.44e-05f, -1.9922399f, 0.9923376f}, {2.44e-05f, 4.89e-05f, 2.44e-05f, -1.9927496f, 0.9928473f}, {2.44e-05f, 4.89e-05f, 2.44e-05f, -1.9932134f, 0.9933112f}, {2.44e-05f, 4.89e-05f, 2.44e-05f, -1.9936364f, 0.9937341f}, {2.44e-05f, 4.89e-05f, 2.44e-05f, -1.9940227f, 0.9941205f}, {2.44e-05f, 4.89e-05f, 2.44e-05f, -1.9943763f, 0.9944741f}, {2.45e-05f, 4.89e-05f, 2.45e-05f, -1.9947005f, 0.9947983f}, {2.45e-05f, 4.89e-05f, 2.45e-05f, -1.9949982f, 0.9950961f}, {2.45e-05f, 4.89e-05f, 2.45e-05f, -1.9952723f, 0.9953701f}, {2.45e-05f, 4.89e-05f, 2.45e-05f, -1.9955249f, 0.9956228f}, {2.45e-05f, 4.89e-05f, 2.45e-05f, -1.9957582f, 0.995856f}, {2.45e-05f, 4.89e-05f, 2.45e-05f, -1.995974f, 0.9960719f}, {2.45e-05f, 4.89e-05f, 2.45e-05f, -1.9961739f, 0.9962718f}, {2.45e-05f, 4.89e-05f, 2.45e-05f, -1.9963595f, 0.9964574f}, {2.45e-05f, 4.9e-05f, 2.45e-05f, -1.9965319f, 0.9966298f}, {2.45e-05f, 4.9e-05f, 2.45e-05f, -1.9966924f, 0.9967903f}, {2.45e-05f, 4.9e-05f, 2.45e-05f, -1.9968421f, 0.99694f}, {2.45e-05f, 4.9e-05f, 2.45e-05f, -1.9969818f, 0.9970797f}, {2.45e-05f, 4.9e-05f, 2.45e-05f, -1.9971123f, 0.9972103f}, {2.45e-05f, 4.9e-05f, 2.45e-05f, -1.9972345f, 0.9973325f}, {2.45e-05f, 4.9e-05f, 2.45e-05f, -1.9973491f, 0.997447f}, {2.45e-05f, 4.9e-05f, 2.45e-05f, -1.9974565f, 0.9975545f}, {2.45e-05f, 4.9e-05f, 2.45e-05f, -1.9975599f, 0.9976578f}, {2.45e-05f, 4.9e-05f, 2.45e-05f, -1.9976626f, 0.9977606f}, {2.45e-05f, 4.9e-05f, 2.45e-05f, -1.9977645f, 0.9978625f}, {2.45e-05f, 4.9e-05f, 2.45e-05f, -1.9978652f, 0.9979631f}, {2.45e-05f, 4.9e-05f, 2.45e-05f, -1.9979643f, 0.9980622f}, {2.45e-05f, 4.9e-05f, 2.45e-05f, -1.9980615f, 0.9981594f}, {2.45e-05f, 4.9e-05f, 2.45e-05f, -1.9981565f, 0.9982544f}, {2.45e-05f, 4.9e-05f, 2.45e-05f, -1.9982489f, 0.9983469f}, {2.45e-05f, 4.9e-05f, 2.45e-05f, -1.9983386f, 0.9984366f}, {2.45e-05f, 4.9e-05f, 2.45e-05f, -1.9984253f, 0.9985233f}, {2.45e-05f, 4.9e-05f, 2.45e-05f, -1.9985088f, 0.9986068f}, {2.45e-05f, 4.9e-05f, 2.45e-05f, -1.9985889f, 0.9986869f}, {2.45e-05f, 4.9e-05f, 2.45e-05f, -1.9986656f, 0.9987636f}, {2.45e-05f, 4.9e-05f, 2.45e-05f, -1.9987387f, 0.9988367f}, {2.45e-05f, 4.9e-05f, 2.45e-05f, -1.9988083f, 0.9989063f}, {2.45e-05f, 4.9e-05f, 2.45e-05f, -1.9988743f, 0.9989724f}, {2.45e-05f, 4.9e-05f, 2.45e-05f, -1.9989369f, 0.9990349f}, {2.45e-05f, 4.9e-05f, 2.45e-05f, -1.9989959f, 0.999094f}, {2.45e-05f, 4.9e-05f, 2.45e-05f, -1.9990516f, 0.9991497f}},
-          {{1.93e-05f, 3.86e-05f, 1.93e-05f, -1.9651931f, 0.9652703f}, {1.93e-05f, 3.86e-05f, 1.93e-05f, -1.9654576f, 0.9655348f}, {1.93e-05f, 3.86e-05f, 1.93e-05f, -1.9662275f, 0.9663047f}, {1.93e-05f, 3.86e-05f, 1.93e-05f, -1.9674369f, 0.9675142f}, {1.93e-05f, 3.87e-05f, 1.93e-05f, -1.9689913f, 0.9690686f}, {1.94e-05f, 3.87e-05f, 1.94e-05f, -1.9707838f, 0.9708612f}, {1.94e-05f, 3.87e-05f, 1.94e-05f, -1.9727112f, 0.9727887f}, {1.94e-05f, 3.88e-05f, 1.94e-05f, -1.9746841f, 0.9747617f}, {1.94e-05f, 3.88e-05f, 1.94e-05f, -1.9766325f, 0.9767101f}, {1.94e-05f, 3.89e-05f, 1.94e-05f, -1.9785062f, 0.9785839f}, {1.94e-05f, 3.89e-05f, 1.94e-05f, -1.980273f, 0.9803508f}, {1.95e-05f, 3.89e-05f, 1.95e-05f, -1.981915f, 0.9819929f}, {1.95e-05f, 3.9e-05f, 1.95e-05f, -1.9834249f, 0.9835028f}, {1.95e-05f, 3.9e-05f, 1.95e-05f, -1.9848028f, 0.9848808f}, {1.95e-05f, 3.9e-05f, 1.95e-05f, -1.9860538f, 0.9861319f}, {1.95e-05f, 3.9e-05f, 1.95e-05f, -1.9871857f, 0.9872638f}, {1.95e-05f, 3.91e-05f, 1.95e-05f, -1.9882078f, 0.9882859f}, {1.95e-05f, 3.91e-05f, 1.95e-05f, -1.9891297f, 0.9892078f}, {1.95e-05f, 3.91e-05f, 1.95e-05f, -1.9899611f, 0.9900393f}, {1.96e-05f, 3.91e-05f, 1.96e-05f, -1.9907112f, 0.9907894f}, {1.96e-05f, 3.91e-05f, 1.96e-05f, -1.9913886f, 0.9914668f}, {1.96e-05f, 3.91e-05f, 1.96e-05f, -1.992001f, 0.9920792f}, {1.96e-05f, 3.91e-05f, 1.96e-05f, -1.9925554f, 0.9926337f}, {1.96e-05f, 3.91e-05f, 1.96e-05f, -1.9930582f, 0.9931365f}, {1.96e-05f, 3.92e-05f, 1.96e-05f, -1.9935149f, 0.9935932f}, {1.96e-05f, 3.92e-05f, 1.96e-05f, -1.9939305f, 0.9940088f}, {1.96e-05f, 3.92e-05f, 1.96e-05f, -1.9943094f, 0.9943878f}, {1.96e-05f, 3.92e-05f, 1.96e-05f, -1.9946556f, 0.9947339f}, {1.96e-05f, 3.92e-05f, 1.96e-05f, -1.9949723f, 0.9950507f}, {1.96e-05f, 3.92e-05f, 1.96e-05f, -1.9952628f, 0.9953412f}, {1.96e-05f, 3.92e-05f, 1.96e-05f, -1.9955296f, 0.995608f}, {1.96e-05f, 3.92e-05f, 1.96e-05f, -1.9957751f, 0.9958535f}, {1.96e-05f, 3.92e-05f, 1.96e-05f, -1.9960014f, 0.9960798f}, {1.96e-05f, 3.92e-05f, 1.96e-05f, -1.9962103f, 0.9962888f}, {1.96e-05f, 3.92e-05f, 1.96e-05f, -1.9964036f, 0.9964821f}, {1.96e-05f, 3.92e-05f, 1.96e-05f, -1.9965827f, 0.9966612f}, {1.96e-05f, 3.92e-05f, 1.96e-05f, -1.9967489f, 0.9968274f}, {1.96e-05f, 3.92e-05f, 1.96e-05f, -1.9969034f, 0.9969818f}, {1.96e-05f, 3.92e-05f, 1.96e-05f, -1.9970472f, 0.9971256f}, {1.96e-05f, 3.92e-05f, 1.96e-05f, -1.9971812f, 0.9972597f}, {1.96e-05f, 3.92e-05f, 1.96e-05f, -1.9973063f, 0.9973848f}, {1.96e-05f, 3.92e-05f, 1.96e-05f, -1.9974233f, 0.9975017f}, {1.96e-05f, 3.92e-05f, 1.96e-05f, -1.9975327f, 0.9976112f}, {1.96e-05f, 3.92e-05f, 1.96e-05f, -1.9976353f, 0.9977138f}, {1.96e-05f, 3.92e-05f, 1.96e-05f, -1.9977316f, 0.99781f}, {1.96e-05f, 3.92e-05f, 1.96e-05f, -1.9978241f, 0.9979026f}, {1.96e-05f, 3.92e-05f, 1.96e-05f, -1.9979162f, 0.9979946f}, {1.96e-05f, 3.92e-05f, 1.96e-05f, -1.9980074f, 0.9980859f}, {1.96e-05f, 3.92e-05f, 1.96e-05f, -1.9980975f, 0.998176f}, {1.96e-05f, 3.92e-05f, 1.96e-05f, -1.9981863f, 0.9982648f}, {1.96e-05f, 3.92e-05f, 1.96e-05f, -1.9982733f, 0.9983518f}, {1.96e-05f, 3.93e-05f, 1.96e-05f, -1.9983584f, 0.9984369f}, {1.96e-05f, 3.93e-05f, 1.96e-05f, -1.9984412f, 0.9985197f}, {1.96e-05f, 3.93e-05f, 1.96e-05f, -1.9985216f, 0.9986001f}, {1.96e-05f, 3.93e-05f, 1.96e-05f, -1.9985992f, 0.9986777f}, {1.96e-05f, 3.93e-05f, 1.96e-05f, -1.9986739f, 0.9987525f}, {1.96e-05f, 3.93e-05f, 1.96e-05f, -1.9987457f, 0.9988242f}, {1.96e-05f, 3.93e-05f, 1.96e-05f, -1.9988144f, 0.9988929f}, {1.96e-05f, 3.93e-05f, 1.96e-05f, -1.9988798f, 0.9989584f}, {1.96e-05f, 3.93e-05f, 1.96e-05f, -1.9989422f, 0.9990207f}, {1.96e-05f, 3.93e-05f, 1.96e-05f, -1.9990013f, 0.9990798f}, {1.96e-05f, 3.93e-05f, 1.96e-05f, -1.9990573f, 0.9991358f}, {1.96e-05f, 3.93e-05f, 1.96e-05f, -1.9991102f, 0.9991887f}, {1.96e-05f, 3.93e-05f, 1.96e-05f, -1.99916f, 0.9992386f}},
-          {{1.55e-05f, 3.1e-05f, 1.55e-05f, -1.9687861f, 0.9688481f}, {1.55e-05f, 3.1e-05f, 1.55e-05f, -1.9690238f, 0.9690857f}, {1.55e-05f, 3.1e-05f, 1.55e-05f, -1.9697156f, 0.9697776f}, {1.55e-05f, 3.1e-05f, 1.55e-05f, -1.9708022f, 0.9708642f}, {1.55e-05f, 3.1e-05f, 1.55e-05f, -1.9721985f, 0.9722606f}, {1.55e-05f, 3.11e-05f, 1.55e-05f, -1.9738086f, 0.9738707f}, {1.55e-05f, 3.11e-05f, 1.55e-05f, -1.9755394f, 0.9756015f}, {1.56e-05f, 3.11e-05f, 1.56e-05f, -1.9773107f, 0.9773729f}, {1.56e-05f, 3.11e-05f, 1.56e-05f, -1.9790596f, 0.9791219f}, {1.56e-05f, 3.12e-05f, 1.56e-05f, -1.9807412f, 0.9808036f}, {1.56e-05f, 3.12e-05f, 1.56e-05f, -1.9823266f, 0.982389f}, {1.56e-05f, 3.12e-05f, 1.56e-05f, -1.9837996f, 0.9838621f}, {1.56e-05f, 3.12e-05f, 1.56e-05f, -1.9851539f, 0.9852164f}, {1.56e-05f, 3.13e-05f, 1.56e-05f, -1.9863897f, 0.9864523f}, {1.56e-05f, 3.13e-05f, 1.56e-05f, -1.9875116f, 0.9875741f}, {1.56e-05f, 3.13e-05f, 1.56e-05f, -1.9885264f, 0.988589f}, {1.57e-05f, 3.13e-05f, 1.57e-05f, -1.9894427f, 0.9895053f}, {1.57e-05f, 3.13e-05f, 1.57e-05f, -1.9902691f, 0.9903317f}, {1.57e-05f, 3.13e-05f, 1.57e-05f, -1.9910143f, 0.991077f}, {1.57e-05f, 3.13e-05f, 1.57e-05f, -1.9916866f, 0.9917493f}, {1.57e-05f, 3.13e-05f, 1.57e-05f, -1.9922937f, 0.9923564f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9928425f, 0.9929052f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9933393f, 0.993402f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9937898f, 0.9938525f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.994199f, 0.9942617f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9945713f, 0.9946341f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9949108f, 0.9949736f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9952209f, 0.9952837f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9955047f, 0.9955675f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9957649f, 0.9958277f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9960039f, 0.9960667f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9962238f, 0.9962866f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9964265f, 0.9964893f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9966136f, 0.9966765f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9967868f, 0.9968496f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9969472f, 0.99701f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9970961f, 0.9971589f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9972344f, 0.9972973f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9973632f, 0.997426f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9974832f, 0.9975461f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9975953f, 0.9976581f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9977f, 0.9977629f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.997798f, 0.9978609f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9978899f, 0.9979528f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9979761f, 0.998039f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.998059f, 0.9981219f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9981414f, 0.9982043f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9982231f, 0.998286f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9983039f, 0.9983667f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9983833f, 0.9984462f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9984613f, 0.9985242f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9985375f, 0.9986004f}, {1.57e-05f, 3.14e-05f, 1.57e-05f, -1.9986116f, 0.9986745f}, {1.57e-05f, 3.15e-05f, 1.57e-05f, -1.9986836f, 0.9987465f}, {1.57e-05f, 3.15e-05f, 1.57e-05f, -1.9987531f, 0.998816f}, {1.57e-05f, 3.15e-05f, 1.57e-05f, -1.99882f, 0.9988829f}, {1.57e-05f, 3.15e-05f, 1.57e-05f, -1.9988843f, 0.9989472f}, {1.57e-05f, 3.15e-05f, 1.57e-05f, -1.9989458f, 0.9990087f}, {1.57e-05f, 3.15e-05f, 1.57e-05f, -1.9990044f, 0.9990673f}, {1.57e-05f, 3.15e-05f, 1.57e-05f, -1.9990602f, 0.9991231f}, {1.57e-05f, 3.15e-05f, 1.57e-05f, -1.9991132f, 0.9991761f}, {1.57e-05f, 3.15e-05f, 1.57e-05f, -1.9991633f, 0.9992262f}, {1.57e-05f, 3.15e-05f, 1.57e-05f, -1.9992106f, 0.9992736f}, {1.57e-05f, 3.15e-05f, 1.57e-05f, -1.9992553f, 0.9993182f}},
-          {{1.24e-05f, 2.49e-05f, 1.24e-05f, -1.9720137f, 0.9720635f}, {1.24e-05f, 2.49e-05f, 1.24e-05f, -1.9722272f, 0.972277f}, {1.24e-05f, 2.49e-05f, 1.24e-05f, -1.9728486f, 0.9728983f}, {1.24e-05f, 2.49e-05f, 1.24e-05f, -1.9738245f, 0.9738743f}, {1.24e-05f, 2.49e-05f, 1.24e-05f, -1.9750784f, 0.9751282f}, {1.25e-05f, 2.49e-05f, 1.25e-05f, -1.976524f, 0.9765738f}, {1.25e-05f, 2.49e-05f, 1.25e-05f, -1.9780777f, 0.9781276f}, {1.25e-05f, 2.5e-05f, 1.25e-05f, -1.9796676f, 0.9797175f}, {1.25e-05f, 2.5e-05f, 1.25e-05f, -1.981237f, 0.981287f}, {1.25e-05f, 2.5e-05f, 1.25e-05f, -1.9827458f, 0.9827957f}, {1.25e-05f, 2.5e-05f, 1.25e-05f, -1.9841679f, 0.9842179f}, {1.25e-05f, 2.5e-05f, 1.25e-05f, -1.9854891f, 0.9855391f}, {1.25e-05f, 2.5e-05f, 1.25e-05f, -1.9867036f, 0.9867537f}, {1.25e-05f, 2.51e-05f, 1.25e-05f, -1.9878117f, 0.9878618f}, {1.25e-05f, 2.51e-05f, 1.25e-05f, -1.9888175f, 0.9888676f}, {1.25e-05f, 2.51e-05f, 1.25e-05f, -1.9897272f, 0.9897774f}, {1.25e-05f, 2.51e-05f, 1.25e-05f, -1.9905485f, 0.9905987f}, {1.26e-05f, 2.51e-05f, 1.26e-05f, -1.9912892f, 0.9913394f}, {1.26e-05f, 2.51e-05f, 1.26e-05f, -1.9919571f, 0.9920073f}, {1.26e-05f, 2.51e-05f, 1.26e-05f, -1.9925596f, 0.9926098f}, {1.26e-05f, 2.51e-05f, 1.26e-05f, -1.9931035f, 0.9931538f}, {1.26e-05f, 2.51e-05f, 1.26e-05f, -1.9935952f, 0.9936455f}, {1.26e-05f, 2.51e-05f, 1.26e-05f, -1.9940403f, 0.9940906f}, {1.26e-05f, 2.51e-05f, 1.26e-05f, -1.994444f, 0.9944942f}, {1.26e-05f, 2.51e-05f, 1.26e-05f, -1.9948106f, 0.9948608f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9951442f, 0.9951945f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9954483f, 0.9954986f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9957261f, 0.9957764f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9959802f, 0.9960306f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9962133f, 0.9962636f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9964273f, 0.9964777f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9966243f, 0.9966746f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9968059f, 0.9968562f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9969735f, 0.9970239f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9971286f, 0.9971789f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9972723f, 0.9973226f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9974056f, 0.9974559f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9975295f, 0.9975798f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9976448f, 0.9976952f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9977523f, 0.9978027f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9978527f, 0.997903f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9979464f, 0.9979968f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9980342f, 0.9980846f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9981165f, 0.9981669f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9981937f, 0.9982441f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9982679f, 0.9983183f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9983417f, 0.9983921f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9984149f, 0.9984653f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9984872f, 0.9985376f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9985584f, 0.9986088f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9986282f, 0.9986786f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9986964f, 0.9987468f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9987628f, 0.9988132f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9988272f, 0.9988776f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9988895f, 0.9989399f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9989494f, 0.9989998f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9990069f, 0.9990573f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.999062f, 0.9991124f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9991145f, 0.9991649f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9991645f, 0.9992149f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9992119f, 0.9992623f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9992568f, 0.9993072f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9992992f, 0.9993496f}, {1.26e-05f, 2.52e-05f, 1.26e-05f, -1.9993392f, 0.9993896f}},
-          {{1e-05f, 1.99e-05f, 1e-05f, -1.9749121f, 0.974952f}, {1e-05f, 1.99e-05f, 1e-05f, -1.9751038f, 0.9751437f}, {1e-05f, 2e-05f, 1e-05f, -1.9756617f, 0.9757016f}, {1e-05f, 2e-05f, 1e-05f, -1.9765379f, 0.9765778f}, {1e-05f, 2e-05f, 1e-05f, -1.9776635f, 0.9777034f}, {1e-05f, 2e-05f, 1e-05f, -1.978961f, 0.979001f}, {1e-05f, 2e-05f, 1e-05f, -1.9803553f, 0.9803953f}, {1e-05f, 2e-05f, 1e-05f, -1.9817819f, 0.9818219f}, {1e-05f, 2e-05f, 1e-05f, -1.9831898f, 0.9832299f}, {1e-05f, 2e-05f, 1e-05f, -1.9845432f, 0.9845833f}, {1e-05f, 2.01e-05f, 1e-05f, -1.9858186f, 0.9858587f}, {1e-05f, 2.01e-05f, 1e-05f, -1.9870033f, 0.9870435f}, {1e-05f, 2.01e-05f, 1e-05f, -1.9880923f, 0.9881324f}, {1e-05f, 2.01e-05f, 1e-05f, -1.9890857f, 0.9891259f}, {1e-05f, 2.01e-05f, 1e-05f, -1.9899872f, 0.9900274f}, {1.01e-05f, 2.01e-05f, 1.01e-05f, -1.9908027f, 0.9908429f}, {1.01e-05f, 2.01e-05f, 1.01e-05f, -1.9915387f, 0.9915789f}, {1.01e-05f, 2.01e-05f, 1.01e-05f, -1.9922025f, 0.9922427f}, {1.01e-05f, 2.01e-05f, 1.01e-05f, -1.992801f, 0.9928412f}, {1.01e-05f, 2.01e-05f, 1.01e-05f, -1.9933408f, 0.993381f}, {1.01e-05f, 2.01e-05f, 1.01e-05f, -1.9938281f, 0.9938684f}, {1.01e-05f, 2.01e-05f, 1.01e-05f, -1.9942687f, 0.994309f}, {1.01e-05f, 2.01e-05f, 1.01e-05f, -1.9946674f, 0.9947077f}, {1.01e-05f, 2.01e-05f, 1.01e-05f, -1.995029f, 0.9950693f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9953574f, 0.9953977f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9956562f, 0.9956965f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9959286f, 0.995969f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9961775f, 0.9962178f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9964051f, 0.9964455f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9966139f, 0.9966542f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9968056f, 0.9968459f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.996982f, 0.9970223f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9971446f, 0.9971849f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9972947f, 0.9973351f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9974336f, 0.997474f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9975623f, 0.9976026f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9976817f, 0.997722f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9977926f, 0.997833f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9978959f, 0.9979363f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9979922f, 0.9980325f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.998082f, 0.9981224f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.998166f, 0.9982064f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9982446f, 0.998285f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9983183f, 0.9983587f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9983874f, 0.9984278f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9984539f, 0.9984943f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.99852f, 0.9985604f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9985855f, 0.9986259f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9986502f, 0.9986906f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.998714f, 0.9987543f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9987765f, 0.9988168f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9988376f, 0.9988779f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.998897f, 0.9989374f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9989547f, 0.9989951f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9990104f, 0.9990508f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9990641f, 0.9991045f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9991156f, 0.999156f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9991649f, 0.9992053f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9992119f, 0.9992523f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9992567f, 0.9992971f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9992991f, 0.9993395f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9993393f, 0.9993797f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9993773f, 0.9994177f}, {1.01e-05f, 2.02e-05f, 1.01e-05f, -1.9994131f, 0.9994535f}},
-          {{8e-06f, 1.6e-05f, 8e-06f, -1.9775138f, 0.9775458f}, {8e-06f, 1.6e-05f, 8e-06f, -1.9776859f, 0.9777179f}, {8e-06f, 1.6e-05f, 8e-06f, -1.9781867f, 0.9782187f}, {8e-06f, 1.6e-05f, 8e-06f, -1.9789731f, 0.9790051f}, {8e-06f, 1.6e-05f, 8e-06f, -1.9799832f, 0.9800153f}, {8e-06f, 1.6e-05f, 8e-06f, -1.9811475f, 0.9811795f}, {8e-06f, 1.6e-05f, 8e-06f, -1.9823985f, 0.9824305f}, {8e-06f, 1.6e-05f, 8e-06f, -1.9836781f, 0.9837102f}, {8e-06f, 1.61e-05f, 8e-06f, -1.984941f, 0.9849731f}, {8e-06f, 1.61e-05f, 8e-06f, -1.9861546f, 0.9861867f}, {8e-06f, 1.61e-05f, 8e-06f, -1.9872982f, 0.9873304f}, {8e-06f, 1.61e-05f, 8e-06f, -1.9883604f, 0.9883926f}, {8e-06f, 1.61e-05f, 8e-06f, -1.9893366f, 0.9893687f}, {8.1e-06f, 1.61e-05f, 8.1e-06f, -1.990227f, 0.9902592f}, {8.1e-06f, 1.61e-05f, 8.1e-06f, -1.991035f, 0.9910672f}, {8.1e-06f, 1.61e-05f, 8.1e-06f, -1.9917658f, 0.991798f}, {8.1e-06f, 1.61e-05f, 8.1e-06f, -1.9924253f, 0.9924576f}, {8.1e-06f, 1.61e-05f, 8.1e-06f, -1.9930201f, 0.9930523f}, {8.1e-06f, 1.61e-05f, 8.1e-06f, -1.9935563f, 0.9935886f}, {8.1e-06f, 1.61e-05f, 8.1e-06f, -1.9940399f, 0.9940722f}, {8.1e-06f, 1.61e-05f, 8.1e-06f, -1.9944766f, 0.9945088f}, {8.1e-06f, 1.61e-05f, 8.1e-06f, -1.9948712f, 0.9949035f}, {8.1e-06f, 1.61e-05f, 8.1e-06f, -1.9952284f, 0.9952607f}, {8.1e-06f, 1.61e-05f, 8.1e-06f, -1.9955523f, 0.9955846f}, {8.1e-06f, 1.61e-05f, 8.1e-06f, -1.9958464f, 0.9958787f}, {8.1e-06f, 1.61e-05f, 8.1e-06f, -1.9961141f, 0.9961464f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9963581f, 0.9963904f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9965809f, 0.9966132f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9967848f, 0.9968171f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9969718f, 0.9970041f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9971435f, 0.9971758f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9973014f, 0.9973338f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9974471f, 0.9974794f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9975815f, 0.9976138f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9977059f, 0.9977382f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9978211f, 0.9978534f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.997928f, 0.9979603f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9980274f, 0.9980597f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9981199f, 0.9981522f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9982061f, 0.9982384f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9982865f, 0.9983189f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9983617f, 0.9983941f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9984321f, 0.9984645f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9984981f, 0.9985304f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.99856f, 0.9985923f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9986195f, 0.9986519f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9986787f, 0.998711f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9987374f, 0.9987697f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9987953f, 0.9988277f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9988524f, 0.9988847f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9989084f, 0.9989407f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.998963f, 0.9989954f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9990163f, 0.9990486f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9990679f, 0.9991003f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9991178f, 0.9991502f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9991659f, 0.9991982f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.999212f, 0.9992444f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9992561f, 0.9992885f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9992982f, 0.9993306f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9993383f, 0.9993707f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9993763f, 0.9994087f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9994123f, 0.9994446f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9994463f, 0.9994786f}, {8.1e-06f, 1.62e-05f, 8.1e-06f, -1.9994783f, 0.9995107f}},
-          {{6.4e-06f, 1.28e-05f, 6.4e-06f, -1.9798487f, 0.9798743f}, {6.4e-06f, 1.28e-05f, 6.4e-06f, -1.9800031f, 0.9800287f}, {6.4e-06f, 1.28e-05f, 6.4e-06f, -1.9804524f, 0.9804781f}, {6.4e-06f, 1.28e-05f, 6.4e-06f, -1.981158f, 0.9811837f}, {6.4e-06f, 1.28e-05f, 6.4e-06f, -1.9820643f, 0.98209f}, {6.4e-06f, 1.29e-05f, 6.4e-06f, -1.9831087f, 0.9831344f}, {6.4e-06f, 1.29e-05f, 6.4e-06f, -1.9842308f, 0.9842565f}, {6.4e-06f, 1.29e-05f, 6.4e-06f, -1.9853784f, 0.9854042f}, {6.4e-06f, 1.29e-05f, 6.4e-06f, -1.9865109f, 0.9865366f}, {6.4e-06f, 1.29e-05f, 6.4e-06f, -1.987599f, 0.9876248f}, {6.4e-06f, 1.29e-05f, 6.4e-06f, -1.9886243f, 0.98865f}, {6.4e-06f, 1.29e-05f, 6.4e-06f, -1.9895764f, 0.9896022f}, {6.5e-06f, 1.29e-05f, 6.5e-06f, -1.9904513f, 0.9904771f}, {6.5e-06f, 1.29e-05f, 6.5e-06f, -1.9912493f, 0.9912751f}, {6.5e-06f, 1.29e-05f, 6.5e-06f, -1.9919734f, 0.9919992f}, {6.5e-06f, 1.29e-05f, 6.5e-06f, -1.9926282f, 0.992654f}, {6.5e-06f, 1.29e-05f, 6.5e-06f, -1.9932192f, 0.993245f}, {6.5e-06f, 1.29e-05f, 6.5e-06f, -1.993752f, 0.9937779f}, {6.5e-06f, 1.29e-05f, 6.5e-06f, -1.9942324f, 0.9942583f}, {6.5e-06f, 1.29e-05f, 6.5e-06f, -1.9946657f, 0.9946915f}, {6.5e-06f, 1.29e-05f, 6.5e-06f, -1.9950568f, 0.9950826f}, {6.5e-06f, 1.29e-05f, 6.5e-06f, -1.9954103f, 0.9954361f}, {6.5e-06f, 1.29e-05f, 6.5e-06f, -1.9957302f, 0.9957561f}, {6.5e-06f, 1.29e-05f, 6.5e-06f, -1.9960203f, 0.9960462f}, {6.5e-06f, 1.29e-05f, 6.5e-06f, -1.9962838f, 0.9963096f}, {6.5e-06f, 1.29e-05f, 6.5e-06f, -1.9965235f, 0.9965494f}, {6.5e-06f, 1.29e-05f, 6.5e-06f, -1.996742f, 0.9967679f}, {6.5e-06f, 1.29e-05f, 6.5e-06f, -1.9969416f, 0.9969675f}, {6.5e-06f, 1.29e-05f, 6.5e-06f, -1.9971242f, 0.9971501f}, {6.5e-06f, 1.29e-05f, 6.5e-06f, -1.9972916f, 0.9973175f}, {6.5e-06f, 1.29e-05f, 6.5e-06f, -1.9974454f, 0.9974712f}, {6.5e-06f, 1.29e-05f, 6.5e-06f, -1.9975868f, 0.9976127f}, {6.5e-06f, 1.29e-05f, 6.5e-06f, -1.9977172f, 0.9977431f}, {6.5e-06f, 1.29e-05f, 6.5e-06f, -1.9978376f, 0.9978635f}, {6.5e-06f, 1.29e-05f, 6.5e-06f, -1.997949f, 0.9979749f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.9980522f, 0.9980781f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.9981479f, 0.9981738f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.9982369f, 0.9982628f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.9983197f, 0.9983456f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.9983969f, 0.9984228f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.9984689f, 0.9984948f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.9985363f, 0.9985622f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.9985993f, 0.9986252f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.9986584f, 0.9986843f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.9987138f, 0.9987397f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.9987671f, 0.998793f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.9988201f, 0.998846f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.9988726f, 0.9988985f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.9989245f, 0.9989504f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.9989756f, 0.9990015f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.9990257f, 0.9990516f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.9990747f, 0.9991006f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.9991223f, 0.9991483f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.9991686f, 0.9991945f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.9992133f, 0.9992392f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.9992563f, 0.9992822f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.9992976f, 0.9993235f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.9993371f, 0.999363f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.9993748f, 0.9994007f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.9994106f, 0.9994366f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.9994447f, 0.9994706f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.9994769f, 0.9995028f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.9995073f, 0.9995332f}, {6.5e-06f, 1.3e-05f, 6.5e-06f, -1.999536f, 0.9995619f}},
-          {{5.1e-06f, 1.03e-05f, 5.1e-06f, -1.9819434f, 0.981964f}, {5.1e-06f, 1.03e-05f, 5.1e-06f, -1.9820819f, 0.9821025f}, {5.1e-06f, 1.03e-05f, 5.1e-06f, -1.982485f, 0.9825056f}, {5.1e-06f, 1.03e-05f, 5.1e-06f, -1.9831179f, 0.9831385f}, {5.2e-06f, 1.03e-05f, 5.2e-06f, -1.9839308f, 0.9839514f}, {5.2e-06f, 1.03e-05f, 5.2e-06f, -1.9848675f, 0.9848881f}, {5.2e-06f, 1.03e-05f, 5.2e-06f, -1.9858738f, 0.9858944f}, {5.2e-06f, 1.03e-05f, 5.2e-06f, -1.9869028f, 0.9869234f}, {5.2e-06f, 1.03e-05f, 5.2e-06f, -1.9879181f, 0.9879387f}, {5.2e-06f, 1.03e-05f, 5.2e-06f, -1.9888935f, 0.9889142f}, {5.2e-06f, 1.03e-05f, 5.2e-06f, -1.9898125f, 0.9898332f}, {5.2e-06f, 1.03e-05f, 5.2e-06f, -1.9906658f, 0.9906865f}, {5.2e-06f, 1.03e-05f, 5.2e-06f, -1.9914499f, 0.9914706f}, {5.2e-06f, 1.03e-05f, 5.2e-06f, -1.992165f, 0.9921857f}, {5.2e-06f, 1.03e-05f, 5.2e-06f, -1.9928138f, 0.9928345f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9934005f, 0.9934212f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9939299f, 0.9939506f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9944073f, 0.994428f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9948376f, 0.9948583f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9952257f, 0.9952464f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.995576f, 0.9955967f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9958926f, 0.9959133f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9961792f, 0.9961999f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.996439f, 0.9964597f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9966749f, 0.9966957f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9968896f, 0.9969103f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9970853f, 0.997106f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.997264f, 0.9972848f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9974276f, 0.9974483f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9975775f, 0.9975982f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9977151f, 0.9977359f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9978418f, 0.9978626f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9979586f, 0.9979793f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9980664f, 0.9980872f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9981661f, 0.9981869f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9982585f, 0.9982793f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9983442f, 0.998365f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9984239f, 0.9984447f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9984981f, 0.9985188f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9985672f, 0.9985879f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9986317f, 0.9986524f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.998692f, 0.9987127f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9987484f, 0.9987692f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9988013f, 0.9988221f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9988509f, 0.9988717f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9988986f, 0.9989194f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9989461f, 0.9989668f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9989931f, 0.9990139f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9990396f, 0.9990603f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9990853f, 0.9991061f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9991302f, 0.9991509f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.999174f, 0.9991948f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9992167f, 0.9992375f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9992581f, 0.9992789f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9992981f, 0.9993189f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9993366f, 0.9993574f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9993736f, 0.9993944f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.999409f, 0.9994297f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9994427f, 0.9994635f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9994748f, 0.9994956f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9995053f, 0.999526f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9995341f, 0.9995549f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9995614f, 0.9995821f}, {5.2e-06f, 1.04e-05f, 5.2e-06f, -1.9995871f, 0.9996078f}},
-          {{4.1e-06f, 8.3e-06f, 4.1e-06f, -1.9838222f, 0.9838387f}, {4.1e-06f, 8.3e-06f, 4.1e-06f, -1.9839465f, 0.983963f}, {4.1e-06f, 8.3e-06f, 4.1e-06f, -1.984308f, 0.9843245f}, {4.1e-06f, 8.3e-06f, 4.1e-06f, -1.9848756f, 0.9848921f}, {4.1e-06f, 8.3e-06f, 4.1e-06f, -1.9856046f, 0.9856211f}, {4.1e-06f, 8.3e-06f, 4.1e-06f, -1.9864445f, 0.986461f}, {4.1e-06f, 8.3e-06f, 4.1e-06f, -1.9873467f, 0.9873632f}, {4.1e-06f, 8.3e-06f, 4.1e-06f, -1.9882692f, 0.9882857f}, {4.1e-06f, 8.3e-06f, 4.1e-06f, -1.9891793f, 0.9891958f}, {4.1e-06f, 8.3e-06f, 4.1e-06f, -1.9900536f, 0.9900701f}, {4.1e-06f, 8.3e-06f, 4.1e-06f, -1.9908772f, 0.9908937f}, {4.1e-06f, 8.3e-06f, 4.1e-06f, -1.9916419f, 0.9916584f}, {4.1e-06f, 8.3e-06f, 4.1e-06f, -1.9923444f, 0.992361f}, {4.1e-06f, 8.3e-06f, 4.1e-06f, -1.9929851f, 0.9930017f}, {4.1e-06f, 8.3e-06f, 4.1e-06f, -1.9935664f, 0.993583f}, {4.1e-06f, 8.3e-06f, 4.1e-06f, -1.9940919f, 0.9941085f}, {4.1e-06f, 8.3e-06f, 4.1e-06f, -1.9945662f, 0.9945828f}, {4.1e-06f, 8.3e-06f, 4.1e-06f, -1.9949938f, 0.9950104f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9953793f, 0.9953959f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9957269f, 0.9957435f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9960406f, 0.9960572f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9963242f, 0.9963408f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9965808f, 0.9965974f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9968135f, 0.9968301f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9970248f, 0.9970414f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9972171f, 0.9972337f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9973923f, 0.9974089f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9975523f, 0.997569f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9976988f, 0.9977154f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.997833f, 0.9978496f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9979563f, 0.9979729f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9980697f, 0.9980863f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9981743f, 0.9981909f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9982708f, 0.9982874f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9983601f, 0.9983767f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9984428f, 0.9984594f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9985196f, 0.9985362f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9985909f, 0.9986075f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9986573f, 0.9986739f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9987192f, 0.9987358f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9987769f, 0.9987936f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9988309f, 0.9988475f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9988814f, 0.9988981f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9989288f, 0.9989454f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9989732f, 0.9989899f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9990159f, 0.9990326f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9990584f, 0.999075f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9991005f, 0.9991172f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9991421f, 0.9991588f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9991831f, 0.9991997f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9992232f, 0.9992399f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9992625f, 0.9992791f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9993007f, 0.9993173f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9993378f, 0.9993544f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9993736f, 0.9993902f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9994081f, 0.9994247f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9994412f, 0.9994578f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9994728f, 0.9994895f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.999503f, 0.9995197f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9995318f, 0.9995484f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9995591f, 0.9995757f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9995849f, 0.9996015f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9996093f, 0.9996259f}, {4.2e-06f, 8.3e-06f, 4.2e-06f, -1.9996323f, 0.9996489f}},
-          {{3.3e-06f, 6.6e-06f, 3.3e-06f, -1.985507f, 0.9855203f}, {3.3e-06f, 6.6e-06f, 3.3e-06f, -1.9856185f, 0.9856317f}, {3.3e-06f, 6.6e-06f, 3.3e-06f, -1.9859426f, 0.9859559f}, {3.3e-06f, 6.6e-06f, 3.3e-06f, -1.9864516f, 0.9864648f}, {3.3e-06f, 6.6e-06f, 3.3e-06f, -1.9871052f, 0.9871184f}, {3.3e-06f, 6.6e-06f, 3.3e-06f, -1.9878582f, 0.9878714f}, {3.3e-06f, 6.6e-06f, 3.3e-06f, -1.9886669f, 0.9886801f}, {3.3e-06f, 6.6e-06f, 3.3e-06f, -1.9894938f, 0.989507f}, {3.3e-06f, 6.6e-06f, 3.3e-06f, -1.9903094f, 0.9903227f}, {3.3e-06f, 6.6e-06f, 3.3e-06f, -1.9910929f, 0.9911062f}, {3.3e-06f, 6.6e-06f, 3.3e-06f, -1.991831f, 0.9918442f}, {3.3e-06f, 6.6e-06f, 3.3e-06f, -1.9925161f, 0.9925294f}, {3.3e-06f, 6.6e-06f, 3.3e-06f, -1.9931456f, 0.9931589f}, {3.3e-06f, 6.6e-06f, 3.3e-06f, -1.9937196f, 0.9937329f}, {3.3e-06f, 6.6e-06f, 3.3e-06f, -1.9942403f, 0.9942536f}, {3.3e-06f, 6.6e-06f, 3.3e-06f, -1.9947111f, 0.9947244f}, {3.3e-06f, 6.6e-06f, 3.3e-06f, -1.9951359f, 0.9951492f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9955189f, 0.9955322f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9958641f, 0.9958774f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9961754f, 0.9961887f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9964564f, 0.9964697f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9967104f, 0.9967237f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9969402f, 0.9969535f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9971486f, 0.9971619f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9973378f, 0.9973511f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9975099f, 0.9975232f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9976668f, 0.9976802f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9978102f, 0.9978235f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9979413f, 0.9979546f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9980615f, 0.9980748f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9981719f, 0.9981852f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9982734f, 0.9982867f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.998367f, 0.9983804f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9984535f, 0.9984668f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9985334f, 0.9985467f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9986075f, 0.9986208f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9986762f, 0.9986895f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9987401f, 0.9987534f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9987995f, 0.9988128f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9988549f, 0.9988682f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9989066f, 0.9989199f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9989549f, 0.9989683f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9990002f, 0.9990135f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9990426f, 0.9990559f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9990824f, 0.9990957f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9991206f, 0.9991339f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9991586f, 0.999172f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9991963f, 0.9992096f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9992336f, 0.9992469f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9992702f, 0.9992836f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9993062f, 0.9993195f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9993413f, 0.9993547f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9993755f, 0.9993889f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9994087f, 0.999422f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9994408f, 0.9994541f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9994717f, 0.999485f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9995013f, 0.9995146f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9995296f, 0.999543f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9995567f, 0.99957f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9995824f, 0.9995957f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9996068f, 0.9996202f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9996299f, 0.9996433f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9996518f, 0.9996651f}, {3.3e-06f, 6.7e-06f, 3.3e-06f, -1.9996724f, 0.9996857f}},
-          {{2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9870176f, 0.9870282f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9871175f, 0.9871281f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9874081f, 0.9874187f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9878644f, 0.987875f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9884503f, 0.9884609f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9891252f, 0.9891358f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9898501f, 0.9898607f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9905911f, 0.9906018f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9913221f, 0.9913327f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9920241f, 0.9920348f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9926854f, 0.992696f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9932992f, 0.9933099f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9938631f, 0.9938738f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9943773f, 0.994388f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9948437f, 0.9948544f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9952654f, 0.9952761f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9956459f, 0.9956566f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9959889f, 0.9959996f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9962981f, 0.9963088f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9965769f, 0.9965876f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9968285f, 0.9968392f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9970559f, 0.9970666f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9972618f, 0.9972724f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9974483f, 0.997459f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9976178f, 0.9976284f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9977719f, 0.9977826f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9979124f, 0.9979231f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9980407f, 0.9980514f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9981581f, 0.9981688f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9982657f, 0.9982764f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9983646f, 0.9983753f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9984555f, 0.9984662f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9985393f, 0.99855f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9986167f, 0.9986274f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9986883f, 0.998699f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9987546f, 0.9987653f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9988161f, 0.9988268f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9988733f, 0.998884f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9989265f, 0.9989372f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9989761f, 0.9989868f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9990224f, 0.9990331f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9990657f, 0.9990764f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9991062f, 0.9991169f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9991441f, 0.9991548f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9991798f, 0.9991904f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.999214f, 0.9992247f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.999248f, 0.9992587f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9992818f, 0.9992925f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9993151f, 0.9993258f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.999348f, 0.9993586f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9993801f, 0.9993908f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9994116f, 0.9994223f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9994422f, 0.9994529f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9994719f, 0.9994826f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9995006f, 0.9995113f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9995283f, 0.999539f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9995548f, 0.9995655f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9995802f, 0.9995909f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9996044f, 0.9996151f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9996274f, 0.9996381f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9996493f, 0.99966f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.99967f, 0.9996807f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.9996895f, 0.9997002f}, {2.7e-06f, 5.3e-06f, 2.7e-06f, -1.999708f, 0.9997187f}},
-          {{2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9883717f, 0.9883802f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9884612f, 0.9884698f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9887218f, 0.9887303f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9891307f, 0.9891392f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9896558f, 0.9896643f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9902607f, 0.9902692f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9909103f, 0.9909188f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9915744f, 0.9915829f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9922293f, 0.9922378f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9928583f, 0.9928668f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9934507f, 0.9934592f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9940006f, 0.9940091f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9945057f, 0.9945143f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9949663f, 0.9949748f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.995384f, 0.9953926f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9957617f, 0.9957703f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9961025f, 0.996111f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9964097f, 0.9964182f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9966865f, 0.9966951f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9969362f, 0.9969448f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9971615f, 0.9971701f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9973652f, 0.9973737f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9975495f, 0.997558f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9977165f, 0.9977251f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9978682f, 0.9978768f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9980063f, 0.9980148f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9981321f, 0.9981406f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9982469f, 0.9982555f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9983521f, 0.9983606f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9984484f, 0.998457f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9985369f, 0.9985455f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9986183f, 0.9986269f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9986934f, 0.9987019f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9987627f, 0.9987712f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9988267f, 0.9988353f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9988861f, 0.9988947f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9989412f, 0.9989497f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9989924f, 0.9990009f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.99904f, 0.9990486f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9990844f, 0.999093f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9991259f, 0.9991344f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9991646f, 0.9991732f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9992009f, 0.9992094f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9992348f, 0.9992434f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9992667f, 0.9992753f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9992974f, 0.9993059f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9993279f, 0.9993364f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9993581f, 0.9993666f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9993879f, 0.9993965f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9994173f, 0.9994258f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9994461f, 0.9994547f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9994743f, 0.9994828f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9995017f, 0.9995103f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9995283f, 0.9995368f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.999554f, 0.9995625f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9995787f, 0.9995873f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9996025f, 0.999611f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9996252f, 0.9996337f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9996469f, 0.9996554f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9996675f, 0.999676f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9996871f, 0.9996956f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9997056f, 0.9997141f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9997231f, 0.9997316f}, {2.1e-06f, 4.3e-06f, 2.1e-06f, -1.9997396f, 0.9997481f}},
-          {{1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9895854f, 0.9895922f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9896656f, 0.9896724f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9898991f, 0.9899059f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9902656f, 0.9902724f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9907362f, 0.990743f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9912782f, 0.991285f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9918603f, 0.9918671f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9924552f, 0.9924621f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.993042f, 0.9930488f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9936055f, 0.9936123f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9941362f, 0.994143f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9946287f, 0.9946356f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9950812f, 0.995088f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9954937f, 0.9955005f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9958678f, 0.9958747f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.996206f, 0.9962129f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9965112f, 0.9965181f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9967863f, 0.9967931f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9970342f, 0.9970411f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9972578f, 0.9972646f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9974596f, 0.9974664f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9976419f, 0.9976488f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9978069f, 0.9978138f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9979565f, 0.9979633f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9980923f, 0.9980992f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9982159f, 0.9982228f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9983285f, 0.9983354f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9984314f, 0.9984383f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9985255f, 0.9985324f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9986118f, 0.9986186f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.998691f, 0.9986979f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9987639f, 0.9987708f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9988311f, 0.9988379f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9988931f, 0.9989f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9989505f, 0.9989573f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9990036f, 0.9990105f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9990529f, 0.9990598f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9990988f, 0.9991056f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9991414f, 0.9991483f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9991812f, 0.999188f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9992183f, 0.9992251f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.999253f, 0.9992598f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9992854f, 0.9992923f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9993158f, 0.9993227f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9993444f, 0.9993512f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9993718f, 0.9993787f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9993991f, 0.999406f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9994262f, 0.999433f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9994529f, 0.9994597f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9994792f, 0.999486f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.999505f, 0.9995118f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9995302f, 0.999537f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9995547f, 0.9995616f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9995785f, 0.9995854f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9996015f, 0.9996084f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9996237f, 0.9996305f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.999645f, 0.9996518f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9996653f, 0.9996721f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9996847f, 0.9996915f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9997032f, 0.99971f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9997207f, 0.9997275f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9997373f, 0.9997441f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9997529f, 0.9997598f}, {1.7e-06f, 3.4e-06f, 1.7e-06f, -1.9997677f, 0.9997745f}}};
-
-}
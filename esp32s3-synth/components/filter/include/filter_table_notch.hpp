@@ -1,74 +0,0 @@
-#pragma once
-#include <cstdint>
-#include "protocol.hpp"
-using namespace protocol;
-namespace sound_module
-{
-    constexpr float filterTableNotch[CUTOFF_TABLE_SIZE][RESONANCE_TABLE_SIZE][5] = {
-
-        {{0.8896537f, 1.6584409f, 0.8896537f, 1.6584409f, 0.7793073f}, {0.8904151f, 1.6598604f, 0.8904151f, 1.6598604f, 0.7808302f}, {0.8926378f, 1.6640037f, 0.8926378f, 1.6640037f, 0.7852755f}, {0.8961483f, 1.6705479f, 0.8961483f, 1.6705479f, 0.7922967f}, {0.9006943f, 1.6790223f, 0.9006943f, 1.6790223f, 0.8013887f}, {0.9059855f, 1.6888859f, 0.9059855f, 1.6888859f, 0.8119711f}, {0.9117337f, 1.6996012f, 0.9117337f, 1.6996012f, 0.8234673f}, {0.9176818f, 1.7106893f, 0.9176818f, 1.7106893f, 0.8353635f}, {0.9236207f, 1.7217603f, 0.9236207f, 1.7217603f, 0.8472413f}, {0.9293938f, 1.7325222f, 0.9293938f, 1.7325222f, 0.8587876f}, {0.9348938f, 1.742775f, 0.9348938f, 1.742775f, 0.8697876f}, {0.9400549f, 1.752396f, 0.9400549f, 1.752396f, 0.8801097f}, {0.9448436f, 1.7613229f, 0.9448436f, 1.7613229f, 0.8896872f}, {0.9492503f, 1.7695376f, 0.9492503f, 1.7695376f, 0.8985006f}, {0.9532815f, 1.7770522f, 0.9532815f, 1.7770522f, 0.9065629f}, {0.956954f, 1.7838983f, 0.956954f, 1.7838983f, 0.913908f}, {0.9602908f, 1.7901186f, 0.9602908f, 1.7901186f, 0.9205815f}, {0.9633177f, 1.7957612f, 0.9633177f, 1.7957612f, 0.9266354f}, {0.9660616f, 1.8008762f, 0.9660616f, 1.8008762f, 0.9321231f}, {0.9685486f, 1.8055123f, 0.9685486f, 1.8055123f, 0.9370972f}, {0.9708037f, 1.8097162f, 0.9708037f, 1.8097162f, 0.9416075f}, {0.9728503f, 1.8135313f, 0.9728503f, 1.8135313f, 0.9457005f}, {0.9747095f, 1.8169972f, 0.9747095f, 1.8169972f, 0.949419f}, {0.9764008f, 1.8201499f, 0.9764008f, 1.8201499f, 0.9528015f}, {0.9779415f, 1.823022f, 0.9779415f, 1.823022f, 0.9558829f}, {0.9793472f, 1.8256424f, 0.9793472f, 1.8256424f, 0.9586943f}, {0.9806318f, 1.8280372f, 0.9806318f, 1.8280372f, 0.9612636f}, {0.9818078f, 1.8302293f, 0.9818078f, 1.8302293f, 0.9636156f}, {0.9828861f, 1.8322395f, 0.9828861f, 1.8322395f, 0.9657722f}, {0.9838765f, 1.8340858f, 0.9838765f, 1.8340858f, 0.967753f}, {0.9847878f, 1.8357845f, 0.9847878f, 1.8357845f, 0.9695756f}, {0.9856276f, 1.8373501f, 0.9856276f, 1.8373501f, 0.9712553f}, {0.9864029f, 1.8387953f, 0.9864029f, 1.8387953f, 0.9728058f}, {0.9871198f, 1.8401316f, 0.9871198f, 1.8401316f, 0.9742395f}, {0.9877836f, 1.8413692f, 0.9877836f, 1.8413692f, 0.9755673f}, {0.9883994f, 1.842517f, 0.9883994f, 1.842517f, 0.9767988f}, {0.9889714f, 1.8435834f, 0.9889714f, 1.8435834f, 0.9779428f}, {0.9895035f, 1.8445753f, 0.9895035f, 1.8445753f, 0.9790071f}, {0.9899993f, 1.8454995f, 0.9899993f, 1.8454995f, 0.9799986f}, {0.9904618f, 1.8463617f, 0.9904618f, 1.8463617f, 0.9809237f}, {0.9908939f, 1.8471672f, 0.9908939f, 1.8471672f, 0.9817878f}, {0.9912981f, 1.8479206f, 0.9912981f, 1.8479206f, 0.9825962f}, {0.9916767f, 1.8486263f, 0.9916767f, 1.8486263f, 0.9833533f}, {0.9920317f, 1.8492881f, 0.9920317f, 1.8492881f, 0.9840633f}, {0.992365f, 1.8499094f, 0.992365f, 1.8499094f, 0.9847299f}, {0.9926857f, 1.8505073f, 0.9926857f, 1.8505073f, 0.9853713f}, {0.9930047f, 1.8511019f, 0.9930047f, 1.8511019f, 0.9860093f}, {0.9933211f, 1.8516918f, 0.9933211f, 1.8516918f, 0.9866422f}, {0.9936339f, 1.852275f, 0.9936339f, 1.852275f, 0.9872679f}, {0.9939421f, 1.8528494f, 0.9939421f, 1.8528494f, 0.9878842f}, {0.9942445f, 1.8534132f, 0.9942445f, 1.8534132f, 0.9884891f}, {0.9945402f, 1.8539645f, 0.9945402f, 1.8539645f, 0.9890805f}, {0.9948283f, 1.8545014f, 0.9948283f, 1.8545014f, 0.9896565f}, {0.9951077f, 1.8550224f, 0.9951077f, 1.8550224f, 0.9902155f}, {0.995378f, 1.8555261f, 0.995378f, 1.8555261f, 0.9907559f}, {0.9956383f, 1.8560114f, 0.9956383f, 1.8560114f, 0.9912766f}, {0.9958883f, 1.8564774f, 0.9958883f, 1.8564774f, 0.9917766f}, {0.9961276f, 1.8569235f, 0.9961276f, 1.8569235f, 0.9922552f}, {0.996356f, 1.8573492f, 0.996356f, 1.8573492f, 0.9927119f}, {0.9965733f, 1.8577544f, 0.9965733f, 1.8577544f, 0.9931466f}, {0.9967797f, 1.858139f, 0.9967797f, 1.858139f, 0.9935593f}, {0.9969751f, 1.8585033f, 0.9969751f, 1.8585033f, 0.9939502f}, {0.9971598f, 1.8588476f, 0.9971598f, 1.8588476f, 0.9943196f}, {0.997334f, 1.8591724f, 0.997334f, 1.8591724f, 0.994668f}},
-        {{0.81939f, 1.3423958f, 0.81939f, 1.3423958f, 0.6387799f}, {0.8205385f, 1.3442775f, 0.8205385f, 1.3442775f, 0.641077f}, {0.8238981f, 1.3497814f, 0.8238981f, 1.3497814f, 0.6477962f}, {0.8292263f, 1.3585106f, 0.8292263f, 1.3585106f, 0.6584527f}, {0.8361662f, 1.3698801f, 0.8361662f, 1.3698801f, 0.6723324f}, {0.8443013f, 1.3832077f, 0.8443013f, 1.3832077f, 0.6886025f}, {0.8532098f, 1.3978024f, 0.8532098f, 1.3978024f, 0.7064195f}, {0.8625069f, 1.4130338f, 0.8625069f, 1.4130338f, 0.7250138f}, {0.8718707f, 1.4283743f, 0.8718707f, 1.4283743f, 0.7437414f}, {0.8810516f, 1.4434153f, 0.8810516f, 1.4434153f, 0.7621032f}, {0.8898711f, 1.4578641f, 0.8898711f, 1.4578641f, 0.7797421f}, {0.8982126f, 1.4715299f, 0.8982126f, 1.4715299f, 0.7964251f}, {0.9060097f, 1.4843038f, 0.9060097f, 1.4843038f, 0.8120194f}, {0.9132341f, 1.4961394f, 0.9132341f, 1.4961394f, 0.8264682f}, {0.9198846f, 1.507035f, 0.9198846f, 1.507035f, 0.8397693f}, {0.9259786f, 1.5170186f, 0.9259786f, 1.5170186f, 0.8519572f}, {0.9315448f, 1.5261376f, 0.9315448f, 1.5261376f, 0.8630895f}, {0.9366183f, 1.5344495f, 0.9366183f, 1.5344495f, 0.8732367f}, {0.9412375f, 1.542017f, 0.9412375f, 1.542017f, 0.882475f}, {0.9454409f, 1.5489034f, 0.9454409f, 1.5489034f, 0.8908817f}, {0.9492661f, 1.5551702f, 0.9492661f, 1.5551702f, 0.8985322f}, {0.9527489f, 1.560876f, 0.9527489f, 1.560876f, 0.9054977f}, {0.9559223f, 1.566075f, 0.9559223f, 1.566075f, 0.9118446f}, {0.9588168f, 1.5708171f, 0.9588168f, 1.5708171f, 0.9176337f}, {0.9614602f, 1.5751477f, 0.9614602f, 1.5751477f, 0.9229204f}, {0.9638774f, 1.5791077f, 0.9638774f, 1.5791077f, 0.9277548f}, {0.966091f, 1.5827342f, 0.966091f, 1.5827342f, 0.932182f}, {0.9681211f, 1.5860601f, 0.9681211f, 1.5860601f, 0.9362422f}, {0.9699859f, 1.5891151f, 0.9699859f, 1.5891151f, 0.9399717f}, {0.9717014f, 1.5919256f, 0.9717014f, 1.5919256f, 0.9434028f}, {0.9732821f, 1.5945153f, 0.9732821f, 1.5945153f, 0.9465642f}, {0.9747408f, 1.5969051f, 0.9747408f, 1.5969051f, 0.9494817f}, {0.9760891f, 1.599114f, 0.9760891f, 1.599114f, 0.9521782f}, {0.9773372f, 1.6011588f, 0.9773372f, 1.6011588f, 0.9546745f}, {0.9784943f, 1.6030544f, 0.9784943f, 1.6030544f, 0.9569887f}, {0.9795686f, 1.6048145f, 0.9795686f, 1.6048145f, 0.9591373f}, {0.9805675f, 1.6064509f, 0.9805675f, 1.6064509f, 0.961135f}, {0.9814976f, 1.6079746f, 0.9814976f, 1.6079746f, 0.9629951f}, {0.9823647f, 1.6093953f, 0.9823647f, 1.6093953f, 0.9647295f}, {0.9831743f, 1.6107216f, 0.9831743f, 1.6107216f, 0.9663487f}, {0.9839312f, 1.6119616f, 0.9839312f, 1.6119616f, 0.9678624f}, {0.9846396f, 1.6131222f, 0.9846396f, 1.6131222f, 0.9692793f}, {0.9853036f, 1.6142099f, 0.9853036f, 1.6142099f, 0.9706071f}, {0.9859265f, 1.6152305f, 0.9859265f, 1.6152305f, 0.971853f}, {0.9865117f, 1.6161892f, 0.9865117f, 1.6161892f, 0.9730234f}, {0.9870751f, 1.6171122f, 0.9870751f, 1.6171122f, 0.9741502f}, {0.9876358f, 1.6180307f, 0.9876358f, 1.6180307f, 0.9752715f}, {0.9881922f, 1.6189423f, 0.9881922f, 1.6189423f, 0.9763843f}, {0.9887425f, 1.6198439f, 0.9887425f, 1.6198439f, 0.977485f}, {0.9892849f, 1.6207325f, 0.9892849f, 1.6207325f, 0.9785698f}, {0.9898175f, 1.621605f, 0.9898175f, 1.621605f, 0.9796349f}, {0.9903384f, 1.6224584f, 0.9903384f, 1.6224584f, 0.9806768f}, {0.990846f, 1.6232901f, 0.990846f, 1.6232901f, 0.9816921f}, {0.9913388f, 1.6240974f, 0.9913388f, 1.6240974f, 0.9826777f}, {0.9918155f, 1.6248784f, 0.9918155f, 1.6248784f, 0.983631f}, {0.992275f, 1.6256311f, 0.992275f, 1.6256311f, 0.9845499f}, {0.9927163f, 1.6263542f, 0.9927163f, 1.6263542f, 0.9854327f}, {0.993139f, 1.6270465f, 0.993139f, 1.6270465f, 0.9862779f}, {0.9935424f, 1.6277076f, 0.9935424f, 1.6277076f, 0.9870849f}, {0.9939266f, 1.6283369f, 0.9939266f, 1.6283369f, 0.9878532f}, {0.9942914f, 1.6289345f, 0.9942914f, 1.6289345f, 0.9885828f}, {0.994637f, 1.6295008f, 0.994637f, 1.6295008f, 0.989274f}, {0.9949637f, 1.630036f, 0.9949637f, 1.630036f, 0.9899275f}, {0.995272f, 1.6305411f, 0.995272f, 1.6305411f, 0.9905441f}},
-        {{0.7482115f, 0.957522f, 0.7482115f, 0.957522f, 0.4964231f}, {0.7496744f, 0.9593941f, 0.7496744f, 0.9593941f, 0.4993489f}, {0.7539628f, 0.9648822f, 0.7539628f, 0.9648822f, 0.5079257f}, {0.7607927f, 0.9736228f, 0.7607927f, 0.9736228f, 0.5215855f}, {0.7697414f, 0.9850748f, 0.7697414f, 0.9850748f, 0.5394828f}, {0.7803081f, 0.9985976f, 0.7803081f, 0.9985976f, 0.5606163f}, {0.7919759f, 1.0135294f, 0.7919759f, 1.0135294f, 0.5839519f}, {0.8042617f, 1.0292521f, 0.8042617f, 1.0292521f, 0.6085234f}, {0.8167494f, 1.0452332f, 0.8167494f, 1.0452332f, 0.6334988f}, {0.8291058f, 1.0610462f, 0.8291058f, 1.0610462f, 0.6582115f}, {0.8410821f, 1.0763729f, 0.8410821f, 1.0763729f, 0.6821641f}, {0.8525065f, 1.0909932f, 0.8525065f, 1.0909932f, 0.705013f}, {0.8632718f, 1.1047702f, 0.8632718f, 1.1047702f, 0.7265437f}, {0.8733219f, 1.1176317f, 0.8733219f, 1.1176317f, 0.7466438f}, {0.8826386f, 1.1295547f, 0.8826386f, 1.1295547f, 0.7652771f}, {0.8912306f, 1.1405504f, 0.8912306f, 1.1405504f, 0.7824613f}, {0.8991251f, 1.1506533f, 0.8991251f, 1.1506533f, 0.7982502f}, {0.9063599f, 1.159912f, 0.9063599f, 1.159912f, 0.8127198f}, {0.9129793f, 1.1683832f, 0.9129793f, 1.1683832f, 0.8259587f}, {0.9190302f, 1.1761268f, 0.9190302f, 1.1761268f, 0.8380604f}, {0.9245594f, 1.1832028f, 0.9245594f, 1.1832028f, 0.8491188f}, {0.9296124f, 1.1896694f, 0.9296124f, 1.1896694f, 0.8592249f}, {0.9342325f, 1.1955819f, 0.9342325f, 1.1955819f, 0.868465f}, {0.9384597f, 1.2009916f, 0.9384597f, 1.2009916f, 0.8769194f}, {0.9423311f, 1.2059461f, 0.9423311f, 1.2059461f, 0.8846622f}, {0.9458805f, 1.2104884f, 0.9458805f, 1.2104884f, 0.8917611f}, {0.9491387f, 1.2146581f, 0.9491387f, 1.2146581f, 0.8982775f}, {0.9521335f, 1.2184907f, 0.9521335f, 1.2184907f, 0.904267f}, {0.9548899f, 1.2220181f, 0.9548899f, 1.2220181f, 0.9097798f}, {0.9574304f, 1.2252693f, 0.9574304f, 1.2252693f, 0.9148608f}, {0.9597752f, 1.2282702f, 0.9597752f, 1.2282702f, 0.9195505f}, {0.9619426f, 1.2310438f, 0.9619426f, 1.2310438f, 0.9238852f}, {0.9639488f, 1.2336112f, 0.9639488f, 1.2336112f, 0.9278975f}, {0.9658084f, 1.2359911f, 0.9658084f, 1.2359911f, 0.9316168f}, {0.9675346f, 1.2382001f, 0.9675346f, 1.2382001f, 0.9350691f}, {0.9691391f, 1.2402535f, 0.9691391f, 1.2402535f, 0.9382782f}, {0.9706326f, 1.2421648f, 0.9706326f, 1.2421648f, 0.9412652f}, {0.9720246f, 1.2439462f, 0.9720246f, 1.2439462f, 0.9440491f}, {0.9733236f, 1.2456087f, 0.9733236f, 1.2456087f, 0.9466473f}, {0.9745375f, 1.2471622f, 0.9745375f, 1.2471622f, 0.9490751f}, {0.9756733f, 1.2486157f, 0.9756733f, 1.2486157f, 0.9513466f}, {0.9767372f, 1.2499772f, 0.9767372f, 1.2499772f, 0.9534744f}, {0.977735f, 1.2512541f, 0.977735f, 1.2512541f, 0.9554699f}, {0.9786718f, 1.252453f, 0.9786718f, 1.252453f, 0.9573436f}, {0.9795524f, 1.25358f, 0.9795524f, 1.25358f, 0.9591048f}, {0.9804007f, 1.2546655f, 0.9804007f, 1.2546655f, 0.9608014f}, {0.9812454f, 1.2557465f, 0.9812454f, 1.2557465f, 0.9624907f}, {0.9820841f, 1.2568199f, 0.9820841f, 1.2568199f, 0.9641683f}, {0.9829142f, 1.2578822f, 0.9829142f, 1.2578822f, 0.9658285f}, {0.9837328f, 1.2589298f, 0.9837328f, 1.2589298f, 0.9674656f}, {0.984537f, 1.259959f, 0.984537f, 1.259959f, 0.969074f}, {0.9853241f, 1.2609663f, 0.9853241f, 1.2609663f, 0.9706482f}, {0.9860915f, 1.2619483f, 0.9860915f, 1.2619483f, 0.972183f}, {0.9868369f, 1.2629022f, 0.9868369f, 1.2629022f, 0.9736737f}, {0.9875582f, 1.2638254f, 0.9875582f, 1.2638254f, 0.9751164f}, {0.9882538f, 1.2647156f, 0.9882538f, 1.2647156f, 0.9765076f}, {0.9889223f, 1.2655711f, 0.9889223f, 1.2655711f, 0.9778447f}, {0.9895628f, 1.2663907f, 0.9895628f, 1.2663907f, 0.9791256f}, {0.9901745f, 1.2671736f, 0.9901745f, 1.2671736f, 0.980349f}, {0.9907572f, 1.2679192f, 0.9907572f, 1.2679192f, 0.9815143f}, {0.9913107f, 1.2686275f, 0.9913107f, 1.2686275f, 0.9826213f}, {0.9918352f, 1.2692989f, 0.9918352f, 1.2692989f, 0.9836705f}, {0.9923314f, 1.2699338f, 0.9923314f, 1.2699338f, 0.9846627f}, {0.9927996f, 1.2705331f, 0.9927996f, 1.2705331f, 0.9855993f}},
-        {{0.6932384f, 0.6113251f, 0.6932384f, 0.6113251f, 0.3864768f}, {0.6948905f, 0.6127819f, 0.6948905f, 0.6127819f, 0.3897809f}, {0.6997415f, 0.6170598f, 0.6997415f, 0.6170598f, 0.399483f}, {0.7074926f, 0.623895f, 0.7074926f, 0.623895f, 0.4149852f}, {0.7176953f, 0.6328922f, 0.7176953f, 0.6328922f, 0.4353906f}, {0.7298121f, 0.6435773f, 0.7298121f, 0.6435773f, 0.4596243f}, {0.7432795f, 0.6554533f, 0.7432795f, 0.6554533f, 0.4865589f}, {0.7575608f, 0.6680471f, 0.7575608f, 0.6680471f, 0.5151216f}, {0.7721839f, 0.6809424f, 0.7721839f, 0.6809424f, 0.5443679f}, {0.7867608f, 0.6937968f, 0.7867608f, 0.6937968f, 0.5735215f}, {0.8009923f, 0.7063468f, 0.8009923f, 0.7063468f, 0.6019847f}, {0.8146637f, 0.7184027f, 0.8146637f, 0.7184027f, 0.6293274f}, {0.8276327f, 0.7298393f, 0.8276327f, 0.7298393f, 0.6552653f}, {0.8398163f, 0.7405833f, 0.8398163f, 0.7405833f, 0.6796325f}, {0.8511772f, 0.7506018f, 0.8511772f, 0.7506018f, 0.7023544f}, {0.8617117f, 0.7598916f, 0.8617117f, 0.7598916f, 0.7234234f}, {0.8714396f, 0.76847f, 0.8714396f, 0.76847f, 0.7428791f}, {0.8803959f, 0.776368f, 0.8803959f, 0.776368f, 0.7607918f}, {0.8886252f, 0.7836249f, 0.8886252f, 0.7836249f, 0.7772504f}, {0.8961769f, 0.7902843f, 0.8961769f, 0.7902843f, 0.7923538f}, {0.9031021f, 0.7963913f, 0.9031021f, 0.7963913f, 0.8062043f}, {0.9094517f, 0.8019905f, 0.9094517f, 0.8019905f, 0.8189033f}, {0.9152744f, 0.8071252f, 0.9152744f, 0.8071252f, 0.8305488f}, {0.9206166f, 0.8118362f, 0.9206166f, 0.8118362f, 0.8412331f}, {0.9255214f, 0.8161614f, 0.9255214f, 0.8161614f, 0.8510428f}, {0.9300286f, 0.8201361f, 0.9300286f, 0.8201361f, 0.8600572f}, {0.9341748f, 0.8237923f, 0.9341748f, 0.8237923f, 0.8683495f}, {0.9379931f, 0.8271595f, 0.9379931f, 0.8271595f, 0.8759861f}, {0.9415137f, 0.8302641f, 0.9415137f, 0.8302641f, 0.8830274f}, {0.9447639f, 0.8331303f, 0.9447639f, 0.8331303f, 0.8895278f}, {0.9477684f, 0.8357798f, 0.9477684f, 0.8357798f, 0.8955368f}, {0.9505494f, 0.8382321f, 0.9505494f, 0.8382321f, 0.9010988f}, {0.9531269f, 0.8405051f, 0.9531269f, 0.8405051f, 0.9062538f}, {0.955519f, 0.8426145f, 0.955519f, 0.8426145f, 0.9110379f}, {0.9577419f, 0.8445747f, 0.9577419f, 0.8445747f, 0.9154837f}, {0.9598103f, 0.8463988f, 0.9598103f, 0.8463988f, 0.9196206f}, {0.9617374f, 0.8480982f, 0.9617374f, 0.8480982f, 0.9234748f}, {0.9635352f, 0.8496835f, 0.9635352f, 0.8496835f, 0.9270703f}, {0.9652144f, 0.8511643f, 0.9652144f, 0.8511643f, 0.9304287f}, {0.9667847f, 0.8525491f, 0.9667847f, 0.8525491f, 0.9335694f}, {0.968255f, 0.8538456f, 0.968255f, 0.8538456f, 0.93651f}, {0.9696332f, 0.855061f, 0.9696332f, 0.855061f, 0.9392664f}, {0.9709266f, 0.8562016f, 0.9709266f, 0.8562016f, 0.9418532f}, {0.9721418f, 0.8572731f, 0.9721418f, 0.8572731f, 0.9442835f}, {0.9732846f, 0.858281f, 0.9732846f, 0.858281f, 0.9465693f}, {0.9743861f, 0.8592523f, 0.9743861f, 0.8592523f, 0.9487722f}, {0.9754835f, 0.86022f, 0.9754835f, 0.86022f, 0.9509671f}, {0.9765738f, 0.8611815f, 0.9765738f, 0.8611815f, 0.9531477f}, {0.9776534f, 0.8621336f, 0.9776534f, 0.8621336f, 0.9553069f}, {0.9787186f, 0.8630729f, 0.9787186f, 0.8630729f, 0.9574372f}, {0.9797656f, 0.8639962f, 0.9797656f, 0.8639962f, 0.9595312f}, {0.9807908f, 0.8649002f, 0.9807908f, 0.8649002f, 0.9615816f}, {0.9817909f, 0.8657821f, 0.9817909f, 0.8657821f, 0.9635817f}, {0.9827627f, 0.8666391f, 0.9827627f, 0.8666391f, 0.9655254f}, {0.9837036f, 0.8674688f, 0.9837036f, 0.8674688f, 0.9674072f}, {0.9846114f, 0.8682693f, 0.9846114f, 0.8682693f, 0.9692227f}, {0.9854842f, 0.869039f, 0.9854842f, 0.869039f, 0.9709683f}, {0.9863206f, 0.8697766f, 0.9863206f, 0.8697766f, 0.9726413f}, {0.9871199f, 0.8704815f, 0.9871199f, 0.8704815f, 0.9742398f}, {0.9878815f, 0.871153f, 0.9878815f, 0.871153f, 0.9757629f}, {0.9886052f, 0.8717912f, 0.9886052f, 0.8717912f, 0.9772104f}, {0.9892913f, 0.8723963f, 0.9892913f, 0.8723963f, 0.9785827f}, {0.9899405f, 0.8729687f, 0.9899405f, 0.8729687f, 0.9798809f}, {0.9905533f, 0.8735092f, 0.9905533f, 0.8735092f, 0.9811067f}},
-        {{0.6527087f, 0.3151915f, 0.6527087f, 0.3151915f, 0.3054175f}, {0.6544703f, 0.3160422f, 0.6544703f, 0.3160422f, 0.3089405f}, {0.6596492f, 0.3185431f, 0.6596492f, 0.3185431f, 0.3192984f}, {0.6679441f, 0.3225487f, 0.6679441f, 0.3225487f, 0.3358883f}, {0.6789002f, 0.3278393f, 0.6789002f, 0.3278393f, 0.3578004f}, {0.6919675f, 0.3341495f, 0.6919675f, 0.3341495f, 0.383935f}, {0.7065627f, 0.3411975f, 0.7065627f, 0.3411975f, 0.4131254f}, {0.722123f, 0.3487115f, 0.722123f, 0.3487115f, 0.444246f}, {0.7381448f, 0.3564484f, 0.7381448f, 0.3564484f, 0.4762896f}, {0.7542063f, 0.3642045f, 0.7542063f, 0.3642045f, 0.5084127f}, {0.7699754f, 0.3718193f, 0.7699754f, 0.3718193f, 0.5399507f}, {0.7852061f, 0.3791742f, 0.7852061f, 0.3791742f, 0.5704122f}, {0.7997297f, 0.3861876f, 0.7997297f, 0.3861876f, 0.5994593f}, {0.813441f, 0.3928088f, 0.813441f, 0.3928088f, 0.626882f}, {0.8262856f, 0.3990114f, 0.8262856f, 0.3990114f, 0.6525712f}, {0.8382473f, 0.4047877f, 0.8382473f, 0.4047877f, 0.6764946f}, {0.8493371f, 0.4101429f, 0.8493371f, 0.4101429f, 0.6986743f}, {0.8595851f, 0.4150917f, 0.8595851f, 0.4150917f, 0.7191703f}, {0.8690333f, 0.4196542f, 0.8690333f, 0.4196542f, 0.7380666f}, {0.8777307f, 0.4238541f, 0.8777307f, 0.4238541f, 0.7554613f}, {0.8857294f, 0.4277167f, 0.8857294f, 0.4277167f, 0.7714588f}, {0.8930826f, 0.4312675f, 0.8930826f, 0.4312675f, 0.7861651f}, {0.899842f, 0.4345316f, 0.899842f, 0.4345316f, 0.7996839f}, {0.9060573f, 0.437533f, 0.9060573f, 0.437533f, 0.8121147f}, {0.9117755f, 0.4402943f, 0.9117755f, 0.4402943f, 0.823551f}, {0.91704f, 0.4428365f, 0.91704f, 0.4428365f, 0.8340801f}, {0.9218912f, 0.4451791f, 0.9218912f, 0.4451791f, 0.8437824f}, {0.9263659f, 0.4473399f, 0.9263659f, 0.4473399f, 0.8527317f}, {0.9304977f, 0.4493352f, 0.9304977f, 0.4493352f, 0.8609955f}, {0.9343174f, 0.4511797f, 0.9343174f, 0.4511797f, 0.8686349f}, {0.9378528f, 0.4528869f, 0.9378528f, 0.4528869f, 0.8757055f}, {0.9411289f, 0.454469f, 0.9411289f, 0.454469f, 0.8822578f}, {0.9441686f, 0.4559368f, 0.9441686f, 0.4559368f, 0.8883371f}, {0.9469924f, 0.4573004f, 0.9469924f, 0.4573004f, 0.8939848f}, {0.9496189f, 0.4585688f, 0.9496189f, 0.4585688f, 0.8992379f}, {0.952065f, 0.45975f, 0.952065f, 0.45975f, 0.9041301f}, {0.9543459f, 0.4608514f, 0.9543459f, 0.4608514f, 0.9086918f}, {0.9564752f, 0.4618797f, 0.9564752f, 0.4618797f, 0.9129505f}, {0.9584655f, 0.4628408f, 0.9584655f, 0.4628408f, 0.916931f}, {0.960328f, 0.4637402f, 0.960328f, 0.4637402f, 0.920656f}, {0.9620729f, 0.4645828f, 0.9620729f, 0.4645828f, 0.9241457f}, {0.9637094f, 0.465373f, 0.9637094f, 0.465373f, 0.9274189f}, {0.9652461f, 0.4661151f, 0.9652461f, 0.4661151f, 0.9304922f}, {0.9666905f, 0.4668126f, 0.9666905f, 0.4668126f, 0.9333811f}, {0.9680497f, 0.4674689f, 0.9680497f, 0.4674689f, 0.9360994f}, {0.9693602f, 0.4681018f, 0.9693602f, 0.4681018f, 0.9387205f}, {0.9706665f, 0.4687326f, 0.9706665f, 0.4687326f, 0.941333f}, {0.9719649f, 0.4693596f, 0.9719649f, 0.4693596f, 0.9439297f}, {0.9732511f, 0.4699807f, 0.9732511f, 0.4699807f, 0.9465021f}, {0.9745206f, 0.4705937f, 0.9745206f, 0.4705937f, 0.9490412f}, {0.975769f, 0.4711966f, 0.975769f, 0.4711966f, 0.951538f}, {0.976992f, 0.4717871f, 0.976992f, 0.4717871f, 0.9539839f}, {0.9781854f, 0.4723634f, 0.9781854f, 0.4723634f, 0.9563708f}, {0.9793456f, 0.4729237f, 0.9793456f, 0.4729237f, 0.9586912f}, {0.9804693f, 0.4734664f, 0.9804693f, 0.4734664f, 0.9609386f}, {0.9815539f, 0.4739901f, 0.9815539f, 0.4739901f, 0.9631077f}, {0.982597f, 0.4744938f, 0.982597f, 0.4744938f, 0.965194f}, {0.9835971f, 0.4749768f, 0.9835971f, 0.4749768f, 0.9671942f}, {0.984553f, 0.4754384f, 0.984553f, 0.4754384f, 0.969106f}, {0.9854641f, 0.4758783f, 0.9854641f, 0.4758783f, 0.9709282f}, {0.9863302f, 0.4762966f, 0.9863302f, 0.4762966f, 0.9726604f}, {0.9871515f, 0.4766932f, 0.9871515f, 0.4766932f, 0.9743031f}, {0.9879288f, 0.4770685f, 0.9879288f, 0.4770685f, 0.9758576f}, {0.9886628f, 0.477423f, 0.9886628f, 0.477423f, 0.9773257f}},
-        {{0.6243929f, 0.0666812f, 0.6243929f, 0.0666812f, 0.2487859f}, {0.6262158f, 0.0668759f, 0.6262158f, 0.0668759f, 0.2524316f}, {0.6315798f, 0.0674487f, 0.6315798f, 0.0674487f, 0.2631597f}, {0.6401857f, 0.0683678f, 0.6401857f, 0.0683678f, 0.2803715f}, {0.65158f, 0.0695846f, 0.65158f, 0.0695846f, 0.3031599f}, {0.6652108f, 0.0710403f, 0.6652108f, 0.0710403f, 0.3304215f}, {0.6804884f, 0.0726718f, 0.6804884f, 0.0726718f, 0.3609768f}, {0.6968381f, 0.0744179f, 0.6968381f, 0.0744179f, 0.3936762f}, {0.7137398f, 0.0762229f, 0.7137398f, 0.0762229f, 0.4274797f}, {0.7307523f, 0.0780397f, 0.7307523f, 0.0780397f, 0.4615045f}, {0.7475223f, 0.0798306f, 0.7475223f, 0.0798306f, 0.4950446f}, {0.7637837f, 0.0815672f, 0.7637837f, 0.0815672f, 0.5275673f}, {0.7793487f, 0.0832295f, 0.7793487f, 0.0832295f, 0.5586973f}, {0.7940961f, 0.0848044f, 0.7940961f, 0.0848044f, 0.5881922f}, {0.8079582f, 0.0862848f, 0.8079582f, 0.0862848f, 0.6159164f}, {0.8209083f, 0.0876678f, 0.8209083f, 0.0876678f, 0.6418166f}, {0.83295f, 0.0889538f, 0.83295f, 0.0889538f, 0.6659f}, {0.8441081f, 0.0901454f, 0.8441081f, 0.0901454f, 0.6882162f}, {0.8544213f, 0.0912467f, 0.8544213f, 0.0912467f, 0.7088426f}, {0.8639371f, 0.092263f, 0.8639371f, 0.092263f, 0.7278742f}, {0.8727073f, 0.0931996f, 0.8727073f, 0.0931996f, 0.7454147f}, {0.8807857f, 0.0940623f, 0.8807857f, 0.0940623f, 0.7615713f}, {0.8882252f, 0.0948568f, 0.8882252f, 0.0948568f, 0.7764504f}, {0.8950774f, 0.0955886f, 0.8950774f, 0.0955886f, 0.7901548f}, {0.9013911f, 0.0962628f, 0.9013911f, 0.0962628f, 0.8027823f}, {0.9072123f, 0.0968845f, 0.9072123f, 0.0968845f, 0.8144246f}, {0.9125833f, 0.0974581f, 0.9125833f, 0.0974581f, 0.8251667f}, {0.9175435f, 0.0979878f, 0.9175435f, 0.0979878f, 0.8350871f}, {0.9221288f, 0.0984775f, 0.9221288f, 0.0984775f, 0.8442577f}, {0.9263721f, 0.0989306f, 0.9263721f, 0.0989306f, 0.8527442f}, {0.9303032f, 0.0993504f, 0.9303032f, 0.0993504f, 0.8606064f}, {0.9339493f, 0.0997398f, 0.9339493f, 0.0997398f, 0.8678985f}, {0.937335f, 0.1001014f, 0.937335f, 0.1001014f, 0.8746699f}, {0.9404826f, 0.1004375f, 0.9404826f, 0.1004375f, 0.8809652f}, {0.9434125f, 0.1007504f, 0.9434125f, 0.1007504f, 0.8868249f}, {0.9461428f, 0.101042f, 0.9461428f, 0.101042f, 0.8922856f}, {0.9486903f, 0.1013141f, 0.9486903f, 0.1013141f, 0.8973805f}, {0.9510699f, 0.1015682f, 0.9510699f, 0.1015682f, 0.9021397f}, {0.9532952f, 0.1018059f, 0.9532952f, 0.1018059f, 0.9065905f}, {0.9553788f, 0.1020284f, 0.9553788f, 0.1020284f, 0.9107575f}, {0.9573317f, 0.1022369f, 0.9573317f, 0.1022369f, 0.9146633f}, {0.9591641f, 0.1024326f, 0.9591641f, 0.1024326f, 0.9183283f}, {0.9608855f, 0.1026164f, 0.9608855f, 0.1026164f, 0.9217709f}, {0.9625041f, 0.1027893f, 0.9625041f, 0.1027893f, 0.9250082f}, {0.9640277f, 0.102952f, 0.9640277f, 0.102952f, 0.9280554f}, {0.9654973f, 0.103109f, 0.9654973f, 0.103109f, 0.9309946f}, {0.9669626f, 0.1032654f, 0.9669626f, 0.1032654f, 0.9339253f}, {0.9684196f, 0.103421f, 0.9684196f, 0.103421f, 0.9368393f}, {0.9698634f, 0.1035752f, 0.9698634f, 0.1035752f, 0.9397269f}, {0.971289f, 0.1037275f, 0.971289f, 0.1037275f, 0.942578f}, {0.9726913f, 0.1038772f, 0.9726913f, 0.1038772f, 0.9453827f}, {0.9740655f, 0.104024f, 0.9740655f, 0.104024f, 0.948131f}, {0.9754069f, 0.1041672f, 0.9754069f, 0.1041672f, 0.9508138f}, {0.9767113f, 0.1043065f, 0.9767113f, 0.1043065f, 0.9534227f}, {0.9779752f, 0.1044415f, 0.9779752f, 0.1044415f, 0.9559503f}, {0.9791953f, 0.1045718f, 0.9791953f, 0.1045718f, 0.9583906f}, {0.9803691f, 0.1046972f, 0.9803691f, 0.1046972f, 0.9607383f}, {0.9814948f, 0.1048174f, 0.9814948f, 0.1048174f, 0.9629897f}, {0.9825711f, 0.1049323f, 0.9825711f, 0.1049323f, 0.9651422f}, {0.9835971f, 0.1050419f, 0.9835971f, 0.1050419f, 0.9671942f}, {0.9845727f, 0.1051461f, 0.9845727f, 0.1051461f, 0.9691454f}, {0.9854981f, 0.1052449f, 0.9854981f, 0.1052449f, 0.9709963f}, {0.986374f, 0.1053385f, 0.986374f, 0.1053385f, 0.972748f}, {0.9872014f, 0.1054268f, 0.9872014f, 0.1054268f, 0.9744027f}},
-        {{0.6061845f, -0.1415588f, 0.6061845f, -0.1415588f, 0.2123689f}, {0.6080403f, -0.1419921f, 0.6080403f, -0.1419921f, 0.2160805f}, {0.6135041f, -0.1432681f, 0.6135041f, -0.1432681f, 0.2270082f}, {0.6222797f, -0.1453174f, 0.6222797f, -0.1453174f, 0.2445595f}, {0.6339167f, -0.1480349f, 0.6339167f, -0.1480349f, 0.2678335f}, {0.6478651f, -0.1512922f, 0.6478651f, -0.1512922f, 0.2957302f}, {0.6635339f, -0.1549513f, 0.6635339f, -0.1549513f, 0.3270678f}, {0.6803436f, -0.1588767f, 0.6803436f, -0.1588767f, 0.3606873f}, {0.6977661f, -0.1629453f, 0.6977661f, -0.1629453f, 0.3955323f}, {0.7153493f, -0.1670514f, 0.7153493f, -0.1670514f, 0.4306986f}, {0.7327278f, -0.1711097f, 0.7327278f, -0.1711097f, 0.4654556f}, {0.7496229f, -0.1750551f, 0.7496229f, -0.1750551f, 0.4992457f}, {0.7658349f, -0.178841f, 0.7658349f, -0.178841f, 0.5316698f}, {0.781232f, -0.1824366f, 0.781232f, -0.1824366f, 0.562464f}, {0.7957374f, -0.185824f, 0.7957374f, -0.185824f, 0.5914747f}, {0.8093171f, -0.1889952f, 0.8093171f, -0.1889952f, 0.6186342f}, {0.8219692f, -0.1919497f, 0.8219692f, -0.1919497f, 0.6439383f}, {0.8337143f, -0.1946925f, 0.8337143f, -0.1946925f, 0.6674285f}, {0.8445885f, -0.1972319f, 0.8445885f, -0.1972319f, 0.689177f}, {0.8546376f, -0.1995786f, 0.8546376f, -0.1995786f, 0.7092753f}, {0.8639129f, -0.2017446f, 0.8639129f, -0.2017446f, 0.7278258f}, {0.8724678f, -0.2037424f, 0.8724678f, -0.2037424f, 0.7449355f}, {0.8803559f, -0.2055844f, 0.8803559f, -0.2055844f, 0.7607117f}, {0.8876295f, -0.207283f, 0.8876295f, -0.207283f, 0.7752589f}, {0.8943385f, -0.2088497f, 0.8943385f, -0.2088497f, 0.788677f}, {0.90053f, -0.2102956f, 0.90053f, -0.2102956f, 0.80106f}, {0.9062479f, -0.2116309f, 0.9062479f, -0.2116309f, 0.8124958f}, {0.9115327f, -0.212865f, 0.9115327f, -0.212865f, 0.8230655f}, {0.9164219f, -0.2140067f, 0.9164219f, -0.2140067f, 0.8328437f}, {0.9209494f, -0.215064f, 0.9209494f, -0.215064f, 0.8418989f}, {0.9251466f, -0.2160442f, 0.9251466f, -0.2160442f, 0.8502933f}, {0.9290419f, -0.2169538f, 0.9290419f, -0.2169538f, 0.8580838f}, {0.932661f, -0.217799f, 0.932661f, -0.217799f, 0.865322f}, {0.9360274f, -0.2185851f, 0.9360274f, -0.2185851f, 0.8720548f}, {0.9391624f, -0.2193172f, 0.9391624f, -0.2193172f, 0.8783248f}, {0.9420852f, -0.2199997f, 0.9420852f, -0.2199997f, 0.8841704f}, {0.9448134f, -0.2206368f, 0.9448134f, -0.2206368f, 0.8896268f}, {0.9473628f, -0.2212322f, 0.9473628f, -0.2212322f, 0.8947256f}, {0.9497479f, -0.2217892f, 0.9497479f, -0.2217892f, 0.8994958f}, {0.9519817f, -0.2223108f, 0.9519817f, -0.2223108f, 0.9039634f}, {0.9540761f, -0.2227999f, 0.9540761f, -0.2227999f, 0.9081522f}, {0.956042f, -0.223259f, 0.956042f, -0.223259f, 0.912084f}, {0.9578891f, -0.2236903f, 0.9578891f, -0.2236903f, 0.9157783f}, {0.9596265f, -0.2240961f, 0.9596265f, -0.2240961f, 0.9192531f}, {0.9612624f, -0.2244781f, 0.9612624f, -0.2244781f, 0.9225248f}, {0.9628406f, -0.2248466f, 0.9628406f, -0.2248466f, 0.9256813f}, {0.9644146f, -0.2252142f, 0.9644146f, -0.2252142f, 0.9288293f}, {0.96598f, -0.2255798f, 0.96598f, -0.2255798f, 0.9319601f}, {0.9675316f, -0.2259421f, 0.9675316f, -0.2259421f, 0.9350633f}, {0.969064f, -0.2262999f, 0.969064f, -0.2262999f, 0.938128f}, {0.9705717f, -0.226652f, 0.9705717f, -0.226652f, 0.9411434f}, {0.9720494f, -0.2269971f, 0.9720494f, -0.2269971f, 0.9440989f}, {0.9734923f, -0.227334f, 0.9734923f, -0.227334f, 0.9469845f}, {0.9748957f, -0.2276618f, 0.9748957f, -0.2276618f, 0.9497913f}, {0.9762556f, -0.2279794f, 0.9762556f, -0.2279794f, 0.9525113f}, {0.9775688f, -0.228286f, 0.9775688f, -0.228286f, 0.9551376f}, {0.9788325f, -0.2285811f, 0.9788325f, -0.2285811f, 0.9576649f}, {0.9800445f, -0.2288642f, 0.9800445f, -0.2288642f, 0.960089f}, {0.9812035f, -0.2291348f, 0.9812035f, -0.2291348f, 0.9624069f}, {0.9823086f, -0.2293929f, 0.9823086f, -0.2293929f, 0.9646171f}, {0.9833595f, -0.2296383f, 0.9833595f, -0.2296383f, 0.966719f}, {0.9843565f, -0.2298711f, 0.9843565f, -0.2298711f, 0.9687131f}, {0.9853003f, -0.2300915f, 0.9853003f, -0.2300915f, 0.9706007f}, {0.986192f, -0.2302997f, 0.986192f, -0.2302997f, 0.972384f}},
-        {{0.5962741f, -0.3176218f, 0.5962741f, -0.3176218f, 0.1925481f}, {0.5981456f, -0.3186187f, 0.5981456f, -0.3186187f, 0.1962912f}, {0.6036575f, -0.3215548f, 0.6036575f, -0.3215548f, 0.2073149f}, {0.6125155f, -0.3262732f, 0.6125155f, -0.3262732f, 0.2250309f}, {0.6242716f, -0.3325355f, 0.6242716f, -0.3325355f, 0.2485433f}, {0.6383779f, -0.3400496f, 0.6383779f, -0.3400496f, 0.2767558f}, {0.6542435f, -0.3485008f, 0.6542435f, -0.3485008f, 0.3084871f}, {0.6712875f, -0.3575798f, 0.6712875f, -0.3575798f, 0.3425749f}, {0.6889779f, -0.3670031f, 0.6889779f, -0.3670031f, 0.3779558f}, {0.7068575f, -0.3765271f, 0.7068575f, -0.3765271f, 0.4137151f}, {0.7245549f, -0.3859541f, 0.7245549f, -0.3859541f, 0.4491097f}, {0.7417845f, -0.395132f, 0.7417845f, -0.395132f, 0.483569f}, {0.7583404f, -0.4039509f, 0.7583404f, -0.4039509f, 0.5166809f}, {0.774085f, -0.4123377f, 0.774085f, -0.4123377f, 0.5481699f}, {0.7889362f, -0.4202486f, 0.7889362f, -0.4202486f, 0.5778724f}, {0.8028561f, -0.4276634f, 0.8028561f, -0.4276634f, 0.6057121f}, {0.8158393f, -0.4345793f, 0.8158393f, -0.4345793f, 0.6316785f}, {0.8279041f, -0.4410059f, 0.8279041f, -0.4410059f, 0.6558082f}, {0.839085f, -0.4469617f, 0.839085f, -0.4469617f, 0.6781699f}, {0.8494265f, -0.4524704f, 0.8494265f, -0.4524704f, 0.6988531f}, {0.8589794f, -0.4575591f, 0.8589794f, -0.4575591f, 0.7179589f}, {0.867797f, -0.462256f, 0.867797f, -0.462256f, 0.7355939f}, {0.8759329f, -0.4665898f, 0.8759329f, -0.4665898f, 0.7518658f}, {0.8834398f, -0.4705885f, 0.8834398f, -0.4705885f, 0.7668795f}, {0.890368f, -0.4742791f, 0.890368f, -0.4742791f, 0.7807361f}, {0.8967654f, -0.4776868f, 0.8967654f, -0.4776868f, 0.7935307f}, {0.9026763f, -0.4808354f, 0.9026763f, -0.4808354f, 0.8053526f}, {0.908142f, -0.4837469f, 0.908142f, -0.4837469f, 0.8162841f}, {0.9132007f, -0.4864415f, 0.9132007f, -0.4864415f, 0.8264014f}, {0.9178871f, -0.4889379f, 0.9178871f, -0.4889379f, 0.8357743f}, {0.9222332f, -0.4912529f, 0.9222332f, -0.4912529f, 0.8444664f}, {0.926268f, -0.4934022f, 0.926268f, -0.4934022f, 0.852536f}, {0.9300179f, -0.4953997f, 0.9300179f, -0.4953997f, 0.8600358f}, {0.933507f, -0.4972582f, 0.933507f, -0.4972582f, 0.8670141f}, {0.9367572f, -0.4989895f, 0.9367572f, -0.4989895f, 0.8735144f}, {0.9397882f, -0.5006041f, 0.9397882f, -0.5006041f, 0.8795763f}, {0.942618f, -0.5021114f, 0.942618f, -0.5021114f, 0.8852359f}, {0.9452629f, -0.5035203f, 0.9452629f, -0.5035203f, 0.8905258f}, {0.9477379f, -0.5048387f, 0.9477379f, -0.5048387f, 0.8954758f}, {0.9500563f, -0.5060737f, 0.9500563f, -0.5060737f, 0.9001127f}, {0.9522305f, -0.5072318f, 0.9522305f, -0.5072318f, 0.9044611f}, {0.9542716f, -0.5083191f, 0.9542716f, -0.5083191f, 0.9085432f}, {0.9561898f, -0.5093408f, 0.9561898f, -0.5093408f, 0.9123795f}, {0.9579942f, -0.510302f, 0.9579942f, -0.510302f, 0.9159884f}, {0.9596934f, -0.5112071f, 0.9596934f, -0.5112071f, 0.9193868f}, {0.961333f, -0.5120805f, 0.961333f, -0.5120805f, 0.922666f}, {0.9629684f, -0.5129516f, 0.9629684f, -0.5129516f, 0.9259368f}, {0.9645951f, -0.5138181f, 0.9645951f, -0.5138181f, 0.9291902f}, {0.9662076f, -0.5146771f, 0.9662076f, -0.5146771f, 0.9324153f}, {0.9678004f, -0.5155256f, 0.9678004f, -0.5155256f, 0.9356008f}, {0.9693677f, -0.5163604f, 0.9693677f, -0.5163604f, 0.9387355f}, {0.9709041f, -0.5171788f, 0.9709041f, -0.5171788f, 0.9418083f}, {0.9724044f, -0.517978f, 0.9724044f, -0.517978f, 0.9448088f}, {0.9738639f, -0.5187554f, 0.9738639f, -0.5187554f, 0.9477277f}, {0.9752783f, -0.5195089f, 0.9752783f, -0.5195089f, 0.9505566f}, {0.9766442f, -0.5202365f, 0.9766442f, -0.5202365f, 0.9532885f}, {0.9779588f, -0.5209367f, 0.9779588f, -0.5209367f, 0.9559176f}, {0.9792198f, -0.5216084f, 0.9792198f, -0.5216084f, 0.9584396f}, {0.9804257f, -0.5222508f, 0.9804257f, -0.5222508f, 0.9608514f}, {0.9815757f, -0.5228633f, 0.9815757f, -0.5228633f, 0.9631513f}, {0.9826694f, -0.5234459f, 0.9826694f, -0.5234459f, 0.9653388f}, {0.9837071f, -0.5239987f, 0.9837071f, -0.5239987f, 0.9674142f}, {0.9846895f, -0.524522f, 0.9846895f, -0.524522f, 0.9693789f}, {0.9856176f, -0.5250164f, 0.9856176f, -0.5250164f, 0.9712352f}},
-        {{0.593156f, -0.4686779f, 0.593156f, -0.4686779f, 0.186312f}, {0.5950321f, -0.4701604f, 0.5950321f, -0.4701604f, 0.1900643f}, {0.6005582f, -0.4745267f, 0.6005582f, -0.4745267f, 0.2011164f}, {0.6094406f, -0.4815451f, 0.6094406f, -0.4815451f, 0.2188813f}, {0.6212324f, -0.4908623f, 0.6212324f, -0.4908623f, 0.2424649f}, {0.6353861f, -0.5020458f, 0.6353861f, -0.5020458f, 0.2707723f}, {0.6513113f, -0.514629f, 0.6513113f, -0.514629f, 0.3026227f}, {0.6684266f, -0.5281524f, 0.6684266f, -0.5281524f, 0.3368531f}, {0.686199f, -0.5421952f, 0.686199f, -0.5421952f, 0.372398f}, {0.7041698f, -0.5563947f, 0.7041698f, -0.5563947f, 0.4083396f}, {0.7219655f, -0.5704559f, 0.7219655f, -0.5704559f, 0.4439311f}, {0.7392989f, -0.5841517f, 0.7392989f, -0.5841517f, 0.4785978f}, {0.7559618f, -0.5973177f, 0.7559618f, -0.5973177f, 0.5119235f}, {0.7718146f, -0.6098438f, 0.7718146f, -0.6098438f, 0.5436292f}, {0.786774f, -0.6216638f, 0.786774f, -0.6216638f, 0.573548f}, {0.8008004f, -0.6327467f, 0.8008004f, -0.6327467f, 0.6016009f}, {0.8138877f, -0.6430875f, 0.8138877f, -0.6430875f, 0.6277753f}, {0.8260531f, -0.6526999f, 0.8260531f, -0.6526999f, 0.6521062f}, {0.8373306f, -0.6616107f, 0.8373306f, -0.6616107f, 0.6746611f}, {0.8477644f, -0.669855f, 0.8477644f, -0.669855f, 0.6955289f}, {0.8574051f, -0.6774724f, 0.8574051f, -0.6774724f, 0.7148102f}, {0.8663057f, -0.6845052f, 0.8663057f, -0.6845052f, 0.7326115f}, {0.8745202f, -0.6909958f, 0.8745202f, -0.6909958f, 0.7490403f}, {0.882101f, -0.6969858f, 0.882101f, -0.6969858f, 0.764202f}, {0.8890989f, -0.7025151f, 0.8890989f, -0.7025151f, 0.7781978f}, {0.8955616f, -0.7076215f, 0.8955616f, -0.7076215f, 0.7911232f}, {0.9015338f, -0.7123405f, 0.9015338f, -0.7123405f, 0.8030677f}, {0.9070572f, -0.7167047f, 0.9070572f, -0.7167047f, 0.8141143f}, {0.9121698f, -0.7207444f, 0.9121698f, -0.7207444f, 0.8243396f}, {0.9169068f, -0.7244873f, 0.9169068f, -0.7244873f, 0.8338136f}, {0.9213003f, -0.7279588f, 0.9213003f, -0.7279588f, 0.8426007f}, {0.9253796f, -0.731182f, 0.9253796f, -0.731182f, 0.8507592f}, {0.9291713f, -0.734178f, 0.9291713f, -0.734178f, 0.8583425f}, {0.9326995f, -0.7369658f, 0.9326995f, -0.7369658f, 0.8653991f}, {0.9359864f, -0.7395629f, 0.9359864f, -0.7395629f, 0.8719729f}, {0.9390519f, -0.7419851f, 0.9390519f, -0.7419851f, 0.8781039f}, {0.9419142f, -0.7442467f, 0.9419142f, -0.7442467f, 0.8838284f}, {0.9445897f, -0.7463607f, 0.9445897f, -0.7463607f, 0.8891794f}, {0.9470934f, -0.748339f, 0.9470934f, -0.748339f, 0.8941868f}, {0.9494389f, -0.7501923f, 0.9494389f, -0.7501923f, 0.8988778f}, {0.9516386f, -0.7519304f, 0.9516386f, -0.7519304f, 0.9032772f}, {0.9537038f, -0.7535622f, 0.9537038f, -0.7535622f, 0.9074075f}, {0.9556446f, -0.7550957f, 0.9556446f, -0.7550957f, 0.9112892f}, {0.9574705f, -0.7565384f, 0.9574705f, -0.7565384f, 0.914941f}, {0.95919f, -0.7578971f, 0.95919f, -0.7578971f, 0.91838f}, {0.9608492f, -0.7592081f, 0.9608492f, -0.7592081f, 0.9216985f}, {0.9625043f, -0.7605158f, 0.9625043f, -0.7605158f, 0.9250086f}, {0.9641506f, -0.7618167f, 0.9641506f, -0.7618167f, 0.9283012f}, {0.9657827f, -0.7631062f, 0.9657827f, -0.7631062f, 0.9315654f}, {0.9673948f, -0.76438f, 0.9673948f, -0.76438f, 0.9347897f}, {0.9689813f, -0.7656336f, 0.9689813f, -0.7656336f, 0.9379625f}, {0.9705365f, -0.7668624f, 0.9705365f, -0.7668624f, 0.9410729f}, {0.9720551f, -0.7680624f, 0.9720551f, -0.7680624f, 0.9441103f}, {0.9735326f, -0.7692297f, 0.9735326f, -0.7692297f, 0.9470651f}, {0.9749645f, -0.7703611f, 0.9749645f, -0.7703611f, 0.9499289f}, {0.9763473f, -0.7714538f, 0.9763473f, -0.7714538f, 0.9526947f}, {0.9776782f, -0.7725054f, 0.9776782f, -0.7725054f, 0.9553564f}, {0.9789549f, -0.7735142f, 0.9789549f, -0.7735142f, 0.9579098f}, {0.9801759f, -0.7744789f, 0.9801759f, -0.7744789f, 0.9603518f}, {0.9813402f, -0.7753989f, 0.9813402f, -0.7753989f, 0.9626805f}, {0.9824477f, -0.776274f, 0.9824477f, -0.776274f, 0.9648954f}, {0.9834984f, -0.7771042f, 0.9834984f, -0.7771042f, 0.9669969f}, {0.9844932f, -0.7778902f, 0.9844932f, -0.7778902f, 0.9689864f}, {0.9854331f, -0.7786328f, 0.9854331f, -0.7786328f, 0.9708661f}},
-        {{0.5955811f, -0.6004943f, 0.5955811f, -0.6004943f, 0.1911622f}, {0.5974537f, -0.6023823f, 0.5974537f, -0.6023823f, 0.1949074f}, {0.6029688f, -0.6079429f, 0.6029688f, -0.6079429f, 0.2059375f}, {0.6118322f, -0.6168795f, 0.6118322f, -0.6168795f, 0.2236645f}, {0.6235964f, -0.6287407f, 0.6235964f, -0.6287407f, 0.2471928f}, {0.6377133f, -0.6429741f, 0.6377133f, -0.6429741f, 0.2754266f}, {0.6535923f, -0.658984f, 0.6535923f, -0.658984f, 0.3071845f}, {0.6706521f, -0.6761847f, 0.6706521f, -0.6761847f, 0.3413043f}, {0.6883609f, -0.6940395f, 0.6883609f, -0.6940395f, 0.3767218f}, {0.7062609f, -0.7120871f, 0.7062609f, -0.7120871f, 0.4125218f}, {0.7239802f, -0.7299526f, 0.7239802f, -0.7299526f, 0.4479603f}, {0.7412329f, -0.7473477f, 0.7412329f, -0.7473477f, 0.4824658f}, {0.7578127f, -0.7640642f, 0.7578127f, -0.7640642f, 0.5156254f}, {0.7735813f, -0.7799629f, 0.7735813f, -0.7799629f, 0.5471626f}, {0.7884566f, -0.7949609f, 0.7884566f, -0.7949609f, 0.5769132f}, {0.8024002f, -0.8090195f, 0.8024002f, -0.8090195f, 0.6048004f}, {0.8154065f, -0.8221332f, 0.8154065f, -0.8221332f, 0.630813f}, {0.8274937f, -0.8343201f, 0.8274937f, -0.8343201f, 0.6549874f}, {0.838696f, -0.8456148f, 0.838696f, -0.8456148f, 0.677392f}, {0.8490581f, -0.8560623f, 0.8490581f, -0.8560623f, 0.6981162f}, {0.8586305f, -0.8657137f, 0.8586305f, -0.8657137f, 0.717261f}, {0.8674665f, -0.8746226f, 0.8674665f, -0.8746226f, 0.734933f}, {0.8756198f, -0.8828432f, 0.8756198f, -0.8828432f, 0.7512396f}, {0.8831431f, -0.8904285f, 0.8831431f, -0.8904285f, 0.7662862f}, {0.8900868f, -0.8974295f, 0.8900868f, -0.8974295f, 0.7801737f}, {0.8964987f, -0.9038943f, 0.8964987f, -0.9038943f, 0.7929973f}, {0.9024232f, -0.9098677f, 0.9024232f, -0.9098677f, 0.8048463f}, {0.9079017f, -0.9153914f, 0.9079017f, -0.9153914f, 0.8158034f}, {0.9129723f, -0.9205038f, 0.9129723f, -0.9205038f, 0.8259447f}, {0.91767f, -0.9252402f, 0.91767f, -0.9252402f, 0.83534f}, {0.9220266f, -0.9296328f, 0.9220266f, -0.9296328f, 0.8440531f}, {0.9260712f, -0.9337108f, 0.9260712f, -0.9337108f, 0.8521424f}, {0.9298304f, -0.937501f, 0.9298304f, -0.937501f, 0.8596608f}, {0.9333282f, -0.9410276f, 0.9333282f, -0.9410276f, 0.8666564f}, {0.9365865f, -0.9443128f, 0.9365865f, -0.9443128f, 0.873173f}, {0.9396251f, -0.9473765f, 0.9396251f, -0.9473765f, 0.8792502f}, {0.9424621f, -0.9502369f, 0.9424621f, -0.9502369f, 0.8849242f}, {0.9451138f, -0.9529105f, 0.9451138f, -0.9529105f, 0.8902277f}, {0.9475952f, -0.9554123f, 0.9475952f, -0.9554123f, 0.8951903f}, {0.9499196f, -0.9577559f, 0.9499196f, -0.9577559f, 0.8998392f}, {0.9520995f, -0.9599537f, 0.9520995f, -0.9599537f, 0.9041989f}, {0.9541459f, -0.962017f, 0.9541459f, -0.962017f, 0.9082918f}, {0.956069f, -0.9639561f, 0.956069f, -0.9639561f, 0.9121381f}, {0.9578782f, -0.9657802f, 0.9578782f, -0.9657802f, 0.9157565f}, {0.9595819f, -0.9674979f, 0.9595819f, -0.9674979f, 0.9191639f}, {0.9612259f, -0.9691555f, 0.9612259f, -0.9691555f, 0.9224518f}, {0.9628656f, -0.9708087f, 0.9628656f, -0.9708087f, 0.9257313f}, {0.9644967f, -0.9724532f, 0.9644967f, -0.9724532f, 0.9289934f}, {0.9661136f, -0.9740835f, 0.9661136f, -0.9740835f, 0.9322271f}, {0.9677106f, -0.9756937f, 0.9677106f, -0.9756937f, 0.9354212f}, {0.9692822f, -0.9772782f, 0.9692822f, -0.9772782f, 0.9385644f}, {0.9708227f, -0.9788315f, 0.9708227f, -0.9788315f, 0.9416455f}, {0.9723271f, -0.9803482f, 0.9723271f, -0.9803482f, 0.9446542f}, {0.9737905f, -0.9818237f, 0.9737905f, -0.9818237f, 0.947581f}, {0.9752088f, -0.9832538f, 0.9752088f, -0.9832538f, 0.9504177f}, {0.9765785f, -0.9846347f, 0.9765785f, -0.9846347f, 0.953157f}, {0.9778967f, -0.9859638f, 0.9778967f, -0.9859638f, 0.9557934f}, {0.9791611f, -0.9872387f, 0.9791611f, -0.9872387f, 0.9583223f}, {0.9803704f, -0.9884579f, 0.9803704f, -0.9884579f, 0.9607408f}, {0.9815236f, -0.9896206f, 0.9815236f, -0.9896206f, 0.9630471f}, {0.9826203f, -0.9907264f, 0.9826203f, -0.9907264f, 0.9652406f}, {0.9836609f, -0.9917755f, 0.9836609f, -0.9917755f, 0.9673218f}, {0.984646f, -0.9927688f, 0.984646f, -0.9927688f, 0.969292f}, {0.9855768f, -0.9937072f, 0.9855768f, -0.9937072f, 0.9711535f}},
-        {{0.6025028f, -0.7174612f, 0.6025028f, -0.7174612f, 0.2050056f}, {0.6043646f, -0.7196783f, 0.6043646f, -0.7196783f, 0.2087292f}, {0.6098469f, -0.7262065f, 0.6098469f, -0.7262065f, 0.2196937f}, {0.6186539f, -0.7366939f, 0.6186539f, -0.7366939f, 0.2373078f}, {0.6303362f, -0.7506053f, 0.6303362f, -0.7506053f, 0.2606725f}, {0.6443445f, -0.7672864f, 0.6443445f, -0.7672864f, 0.288689f}, {0.6600878f, -0.7860334f, 0.6600878f, -0.7860334f, 0.3201755f}, {0.6769858f, -0.8061557f, 0.6769858f, -0.8061557f, 0.3539717f}, {0.6945092f, -0.8270225f, 0.6945092f, -0.8270225f, 0.3890183f}, {0.7122037f, -0.8480931f, 0.7122037f, -0.8480931f, 0.4244073f}, {0.7297016f, -0.8689297f, 0.7297016f, -0.8689297f, 0.4594033f}, {0.7467219f, -0.8891975f, 0.7467219f, -0.8891975f, 0.4934438f}, {0.7630624f, -0.9086558f, 0.7630624f, -0.9086558f, 0.5261248f}, {0.7785891f, -0.927145f, 0.7785891f, -0.927145f, 0.5571781f}, {0.7932233f, -0.9445714f, 0.7932233f, -0.9445714f, 0.5864466f}, {0.8069296f, -0.9608929f, 0.8069296f, -0.9608929f, 0.6138592f}, {0.8197048f, -0.9761056f, 0.8197048f, -0.9761056f, 0.6394096f}, {0.8315687f, -0.9902332f, 0.8315687f, -0.9902332f, 0.6631374f}, {0.8425567f, -1.0033178f, 0.8425567f, -1.0033178f, 0.6851135f}, {0.8527143f, -1.0154135f, 0.8527143f, -1.0154135f, 0.7054287f}, {0.8620925f, -1.026581f, 0.8620925f, -1.026581f, 0.7241851f}, {0.8707447f, -1.036884f, 0.8707447f, -1.036884f, 0.7414894f}, {0.8787246f, -1.0463865f, 0.8787246f, -1.0463865f, 0.7574491f}, {0.8860845f, -1.0551507f, 0.8860845f, -1.0551507f, 0.772169f}, {0.8928746f, -1.0632364f, 0.8928746f, -1.0632364f, 0.7857493f}, {0.8991423f, -1.0706999f, 0.8991423f, -1.0706999f, 0.7982845f}, {0.9049315f, -1.0775937f, 0.9049315f, -1.0775937f, 0.809863f}, {0.9102832f, -1.0839665f, 0.9102832f, -1.0839665f, 0.8205664f}, {0.915235f, -1.0898631f, 0.915235f, -1.0898631f, 0.8304699f}, {0.9198212f, -1.0953244f, 0.9198212f, -1.0953244f, 0.8396424f}, {0.9240734f, -1.1003879f, 0.9240734f, -1.1003879f, 0.8481468f}, {0.9280201f, -1.1050877f, 0.9280201f, -1.1050877f, 0.8560403f}, {0.9316875f, -1.1094548f, 0.9316875f, -1.1094548f, 0.8633751f}, {0.9350992f, -1.1135175f, 0.9350992f, -1.1135175f, 0.8701984f}, {0.9382767f, -1.1173012f, 0.9382767f, -1.1173012f, 0.8765533f}, {0.9412394f, -1.1208292f, 0.9412394f, -1.1208292f, 0.8824788f}, {0.944005f, -1.1241226f, 0.944005f, -1.1241226f, 0.8880101f}, {0.9465897f, -1.1272004f, 0.9465897f, -1.1272004f, 0.8931794f}, {0.9490079f, -1.13008f, 0.9490079f, -1.13008f, 0.8980158f}, {0.9512729f, -1.1327771f, 0.9512729f, -1.1327771f, 0.9025458f}, {0.9533968f, -1.1353062f, 0.9533968f, -1.1353062f, 0.9067935f}, {0.9553903f, -1.1376802f, 0.9553903f, -1.1376802f, 0.9107807f}, {0.9572637f, -1.1399109f, 0.9572637f, -1.1399109f, 0.9145273f}, {0.9590258f, -1.1420092f, 0.9590258f, -1.1420092f, 0.9180515f}, {0.9606849f, -1.143985f, 0.9606849f, -1.143985f, 0.9213699f}, {0.9622858f, -1.1458913f, 0.9622858f, -1.1458913f, 0.9245716f}, {0.9638824f, -1.1477925f, 0.9638824f, -1.1477925f, 0.9277648f}, {0.9654704f, -1.1496835f, 0.9654704f, -1.1496835f, 0.9309408f}, {0.9670444f, -1.1515579f, 0.9670444f, -1.1515579f, 0.9340889f}, {0.9685991f, -1.1534091f, 0.9685991f, -1.1534091f, 0.9371981f}, {0.9701287f, -1.1552306f, 0.9701287f, -1.1552306f, 0.9402574f}, {0.9716281f, -1.1570161f, 0.9716281f, -1.1570161f, 0.9432561f}, {0.973092f, -1.1587594f, 0.973092f, -1.1587594f, 0.9461841f}, {0.9745161f, -1.1604551f, 0.9745161f, -1.1604551f, 0.9490321f}, {0.9758961f, -1.1620985f, 0.9758961f, -1.1620985f, 0.9517922f}, {0.9772287f, -1.1636853f, 0.9772287f, -1.1636853f, 0.9544574f}, {0.9785111f, -1.1652124f, 0.9785111f, -1.1652124f, 0.9570221f}, {0.9797411f, -1.1666771f, 0.9797411f, -1.1666771f, 0.9594822f}, {0.9809174f, -1.1680778f, 0.9809174f, -1.1680778f, 0.9618348f}, {0.982039f, -1.1694134f, 0.982039f, -1.1694134f, 0.964078f}, {0.9831057f, -1.1706836f, 0.9831057f, -1.1706836f, 0.9662113f}, {0.9841177f, -1.1718887f, 0.9841177f, -1.1718887f, 0.9682353f}, {0.9850757f, -1.1730295f, 0.9850757f, -1.1730295f, 0.9701513f}, {0.9859807f, -1.1741073f, 0.9859807f, -1.1741073f, 0.9719615f}},
-        {{0.6130314f, -0.8228003f, 0.6130314f, -0.8228003f, 0.2260628f}, {0.6148754f, -0.8252753f, 0.6148754f, -0.8252753f, 0.2297508f}, {0.6203035f, -0.8325608f, 0.6203035f, -0.8325608f, 0.240607f}, {0.6290181f, -0.8442573f, 0.6290181f, -0.8442573f, 0.2580362f}, {0.6405674f, -0.8597586f, 0.6405674f, -0.8597586f, 0.2811348f}, {0.6544005f, -0.8783252f, 0.6544005f, -0.8783252f, 0.308801f}, {0.6699267f, -0.8991641f, 0.6699267f, -0.8991641f, 0.3398533f}, {0.6865679f, -0.9214997f, 0.6865679f, -0.9214997f, 0.3731358f}, {0.7037988f, -0.9446268f, 0.7037988f, -0.9446268f, 0.4075976f}, {0.7211713f, -0.9679438f, 0.7211713f, -0.9679438f, 0.4423425f}, {0.7383243f, -0.9909663f, 0.7383243f, -0.9909663f, 0.4766487f}, {0.7549839f, -1.0133266f, 0.7549839f, -1.0133266f, 0.5099679f}, {0.7709549f, -1.0347625f, 0.7709549f, -1.0347625f, 0.5419098f}, {0.7861094f, -1.0551026f, 0.7861094f, -1.0551026f, 0.5722187f}, {0.800374f, -1.0742483f, 0.800374f, -1.0742483f, 0.600748f}, {0.8137176f, -1.0921579f, 0.8137176f, -1.0921579f, 0.6274353f}, {0.8261404f, -1.1088316f, 0.8261404f, -1.1088316f, 0.6522809f}, {0.8376647f, -1.1242992f, 0.8376647f, -1.1242992f, 0.6753294f}, {0.8483276f, -1.1386108f, 0.8483276f, -1.1386108f, 0.6966552f}, {0.8581756f, -1.1518286f, 0.8581756f, -1.1518286f, 0.7163511f}, {0.8672601f, -1.1640217f, 0.8672601f, -1.1640217f, 0.7345203f}, {0.8756349f, -1.1752622f, 0.8756349f, -1.1752622f, 0.7512698f}, {0.8833533f, -1.1856217f, 0.8833533f, -1.1856217f, 0.7667066f}, {0.8904673f, -1.19517f, 0.8904673f, -1.19517f, 0.7809346f}, {0.8970266f, -1.2039737f, 0.8970266f, -1.2039737f, 0.7940531f}, {0.9030776f, -1.2120954f, 0.9030776f, -1.2120954f, 0.8061553f}, {0.9086639f, -1.2195932f, 0.9086639f, -1.2195932f, 0.8173279f}, {0.9138255f, -1.226521f, 0.9138255f, -1.226521f, 0.8276511f}, {0.9185993f, -1.2329282f, 0.9185993f, -1.2329282f, 0.8371985f}, {0.9230188f, -1.2388601f, 0.9230188f, -1.2388601f, 0.8460376f}, {0.9271148f, -1.2443577f, 0.9271148f, -1.2443577f, 0.8542296f}, {0.9309153f, -1.2494586f, 0.9309153f, -1.2494586f, 0.8618306f}, {0.9344456f, -1.2541969f, 0.9344456f, -1.2541969f, 0.8688912f}, {0.9377288f, -1.2586035f, 0.9377288f, -1.2586035f, 0.8754575f}, {0.9407856f, -1.2627064f, 0.9407856f, -1.2627064f, 0.8815712f}, {0.9436351f, -1.266531f, 0.9436351f, -1.266531f, 0.8872703f}, {0.9462945f, -1.2701003f, 0.9462945f, -1.2701003f, 0.892589f}, {0.9487792f, -1.2734352f, 0.9487792f, -1.2734352f, 0.8975584f}, {0.9511034f, -1.2765547f, 0.9511034f, -1.2765547f, 0.9022068f}, {0.9532799f, -1.279476f, 0.9532799f, -1.279476f, 0.9065598f}, {0.9553204f, -1.2822147f, 0.9553204f, -1.2822147f, 0.9106407f}, {0.9572354f, -1.2847849f, 0.9572354f, -1.2847849f, 0.9144707f}, {0.9590345f, -1.2871997f, 0.9590345f, -1.2871997f, 0.918069f}, {0.9607266f, -1.2894708f, 0.9607266f, -1.2894708f, 0.9214532f}, {0.9623196f, -1.291609f, 0.9623196f, -1.291609f, 0.9246392f}, {0.9638564f, -1.2936716f, 0.9638564f, -1.2936716f, 0.9277128f}, {0.9653889f, -1.2957285f, 0.9653889f, -1.2957285f, 0.9307779f}, {0.9669129f, -1.297774f, 0.9669129f, -1.297774f, 0.9338259f}, {0.9684234f, -1.2998013f, 0.9684234f, -1.2998013f, 0.9368468f}, {0.969915f, -1.3018033f, 0.969915f, -1.3018033f, 0.9398299f}, {0.9713824f, -1.3037729f, 0.9713824f, -1.3037729f, 0.9427648f}, {0.9728206f, -1.3057032f, 0.9728206f, -1.3057032f, 0.9456412f}, {0.9742247f, -1.3075877f, 0.9742247f, -1.3075877f, 0.9484493f}, {0.9755903f, -1.3094206f, 0.9755903f, -1.3094206f, 0.9511805f}, {0.9769135f, -1.3111966f, 0.9769135f, -1.3111966f, 0.953827f}, {0.9781911f, -1.3129114f, 0.9781911f, -1.3129114f, 0.9563822f}, {0.9794204f, -1.3145614f, 0.9794204f, -1.3145614f, 0.9588409f}, {0.9805995f, -1.3161439f, 0.9805995f, -1.3161439f, 0.9611989f}, {0.9817268f, -1.317657f, 0.9817268f, -1.317657f, 0.9634536f}, {0.9828017f, -1.3190996f, 0.9828017f, -1.3190996f, 0.9656033f}, {0.9838238f, -1.3204715f, 0.9838238f, -1.3204715f, 0.9676476f}, {0.9847935f, -1.3217729f, 0.9847935f, -1.3217729f, 0.9695869f}, {0.9857113f, -1.3230048f, 0.9857113f, -1.3230048f, 0.9714226f}, {0.9865783f, -1.3241686f, 0.9865783f, -1.3241686f, 0.9731567f}},
-        {{0.6264004f, -0.9188127f, 0.6264004f, -0.9188127f, 0.2528008f}, {0.6282194f, -0.9214808f, 0.6282194f, -0.9214808f, 0.2564387f}, {0.6335715f, -0.9293313f, 0.6335715f, -0.9293313f, 0.2671429f}, {0.6421572f, -0.941925f, 0.6421572f, -0.941925f, 0.2843144f}, {0.6535228f, -0.9585961f, 0.6535228f, -0.9585961f, 0.3070455f}, {0.6671164f, -0.9785355f, 0.6671164f, -0.9785355f, 0.3342328f}, {0.6823486f, -1.0008783f, 0.6823486f, -1.0008783f, 0.3646972f}, {0.6986452f, -1.0247824f, 0.6986452f, -1.0247824f, 0.3972905f}, {0.7154874f, -1.0494867f, 0.7154874f, -1.0494867f, 0.4309748f}, {0.7324349f, -1.0743455f, 0.7324349f, -1.0743455f, 0.4648698f}, {0.7491361f, -1.0988431f, 0.7491361f, -1.0988431f, 0.4982722f}, {0.7653262f, -1.1225909f, 0.7653262f, -1.1225909f, 0.5306523f}, {0.7808187f, -1.1453155f, 0.7808187f, -1.1453155f, 0.5616374f}, {0.7954936f, -1.1668409f, 0.7954936f, -1.1668409f, 0.5909873f}, {0.8092842f, -1.1870692f, 0.8092842f, -1.1870692f, 0.6185685f}, {0.8221646f, -1.2059623f, 0.8221646f, -1.2059623f, 0.6443293f}, {0.8341389f, -1.2235264f, 0.8341389f, -1.2235264f, 0.6682779f}, {0.8452323f, -1.2397984f, 0.8452323f, -1.2397984f, 0.6904647f}, {0.8554839f, -1.2548355f, 0.8554839f, -1.2548355f, 0.7109678f}, {0.8649412f, -1.2687076f, 0.8649412f, -1.2687076f, 0.7298824f}, {0.8736562f, -1.2814909f, 0.8736562f, -1.2814909f, 0.7473124f}, {0.8816825f, -1.2932639f, 0.8816825f, -1.2932639f, 0.763365f}, {0.8890731f, -1.3041046f, 0.8890731f, -1.3041046f, 0.7781462f}, {0.8958794f, -1.3140882f, 0.8958794f, -1.3140882f, 0.7917588f}, {0.9021502f, -1.3232862f, 0.9021502f, -1.3232862f, 0.8043004f}, {0.9079311f, -1.3317657f, 0.9079311f, -1.3317657f, 0.8158622f}, {0.9132645f, -1.3395889f, 0.9132645f, -1.3395889f, 0.826529f}, {0.9181895f, -1.346813f, 0.9181895f, -1.346813f, 0.8363791f}, {0.9227419f, -1.3534905f, 0.9227419f, -1.3534905f, 0.8454839f}, {0.9269544f, -1.3596694f, 0.9269544f, -1.3596694f, 0.8539089f}, {0.9308567f, -1.3653934f, 0.9308567f, -1.3653934f, 0.8617135f}, {0.9344759f, -1.370702f, 0.9344759f, -1.370702f, 0.8689518f}, {0.9378364f, -1.3756313f, 0.9378364f, -1.3756313f, 0.8756728f}, {0.9409605f, -1.3802137f, 0.9409605f, -1.3802137f, 0.8819209f}, {0.9438682f, -1.3844788f, 0.9438682f, -1.3844788f, 0.8877364f}, {0.9465778f, -1.3884532f, 0.9465778f, -1.3884532f, 0.8931556f}, {0.9491058f, -1.3921613f, 0.9491058f, -1.3921613f, 0.8982115f}, {0.9514671f, -1.3956249f, 0.9514671f, -1.3956249f, 0.9029342f}, {0.9536753f, -1.398864f, 0.9536753f, -1.398864f, 0.9073506f}, {0.9557426f, -1.4018964f, 0.9557426f, -1.4018964f, 0.9114853f}, {0.9576803f, -1.4047386f, 0.9576803f, -1.4047386f, 0.9153606f}, {0.9594984f, -1.4074054f, 0.9594984f, -1.4074054f, 0.9189969f}, {0.9612062f, -1.4099105f, 0.9612062f, -1.4099105f, 0.9224125f}, {0.9628121f, -1.412266f, 0.9628121f, -1.412266f, 0.9256242f}, {0.9643237f, -1.4144832f, 0.9643237f, -1.4144832f, 0.9286474f}, {0.9657816f, -1.4166217f, 0.9657816f, -1.4166217f, 0.9315633f}, {0.9672353f, -1.418754f, 0.9672353f, -1.418754f, 0.9344706f}, {0.9686807f, -1.420874f, 0.9686807f, -1.420874f, 0.9373613f}, {0.9701129f, -1.4229749f, 0.9701129f, -1.4229749f, 0.9402258f}, {0.971527f, -1.4250491f, 0.971527f, -1.4250491f, 0.943054f}, {0.972918f, -1.4270895f, 0.972918f, -1.4270895f, 0.9458361f}, {0.9742811f, -1.4290888f, 0.9742811f, -1.4290888f, 0.9485622f}, {0.9756116f, -1.4310404f, 0.9756116f, -1.4310404f, 0.9512232f}, {0.9769055f, -1.4329383f, 0.9769055f, -1.4329383f, 0.9538109f}, {0.978159f, -1.434777f, 0.978159f, -1.434777f, 0.956318f}, {0.9793691f, -1.436552f, 0.9793691f, -1.436552f, 0.9587383f}, {0.9805334f, -1.4382598f, 0.9805334f, -1.4382598f, 0.9610667f}, {0.9816498f, -1.4398974f, 0.9816498f, -1.4398974f, 0.9632997f}, {0.9827172f, -1.4414631f, 0.9827172f, -1.4414631f, 0.9654344f}, {0.9837348f, -1.4429557f, 0.9837348f, -1.4429557f, 0.9674696f}, {0.9847023f, -1.4443749f, 0.9847023f, -1.4443749f, 0.9694047f}, {0.9856201f, -1.445721f, 0.9856201f, -1.445721f, 0.9712402f}, {0.9864887f, -1.4469951f, 0.9864887f, -1.4469951f, 0.9729774f}, {0.9873092f, -1.4481986f, 0.9873092f, -1.4481986f, 0.9746184f}},
-        {{0.6419437f, -1.0071089f, 0.6419437f, -1.0071089f, 0.2838874f}, {0.64373f, -1.0099114f, 0.64373f, -1.0099114f, 0.28746f}, {0.6489836f, -1.0181534f, 0.6489836f, -1.0181534f, 0.2979671f}, {0.6574035f, -1.0313629f, 0.6574035f, -1.0313629f, 0.3148069f}, {0.6685347f, -1.0488261f, 0.6685347f, -1.0488261f, 0.3370695f}, {0.6818262f, -1.0696783f, 0.6818262f, -1.0696783f, 0.3636523f}, {0.6966913f, -1.0929993f, 0.6966913f, -1.0929993f, 0.3933825f}, {0.7125621f, -1.1178981f, 0.7125621f, -1.1178981f, 0.4251241f}, {0.7289282f, -1.143574f, 0.7289282f, -1.143574f, 0.4578564f}, {0.74536f, -1.1693529f, 0.74536f, -1.1693529f, 0.4907201f}, {0.7615171f, -1.1947009f, 0.7615171f, -1.1947009f, 0.5230343f}, {0.7771459f, -1.2192199f, 0.7771459f, -1.2192199f, 0.5542917f}, {0.7920701f, -1.2426337f, 0.7920701f, -1.2426337f, 0.5841402f}, {0.8061787f, -1.2647679f, 0.8061787f, -1.2647679f, 0.6123574f}, {0.8194123f, -1.2855294f, 0.8194123f, -1.2855294f, 0.6388247f}, {0.8317509f, -1.3048867f, 0.8317509f, -1.3048867f, 0.6635018f}, {0.8432029f, -1.322853f, 0.8432029f, -1.322853f, 0.6864057f}, {0.8537963f, -1.3394724f, 0.8537963f, -1.3394724f, 0.7075926f}, {0.8635722f, -1.3548092f, 0.8635722f, -1.3548092f, 0.7271443f}, {0.872579f, -1.3689395f, 0.872579f, -1.3689395f, 0.745158f}, {0.880869f, -1.3819453f, 0.880869f, -1.3819453f, 0.7617381f}, {0.8884956f, -1.3939101f, 0.8884956f, -1.3939101f, 0.7769911f}, {0.895511f, -1.4049163f, 0.895511f, -1.4049163f, 0.7910221f}, {0.9019659f, -1.415043f, 0.9019659f, -1.415043f, 0.8039318f}, {0.9079078f, -1.4243648f, 0.9079078f, -1.4243648f, 0.8158155f}, {0.9133812f, -1.4329518f, 0.9133812f, -1.4329518f, 0.8267624f}, {0.9184273f, -1.4408683f, 0.9184273f, -1.4408683f, 0.8368545f}, {0.9230838f, -1.4481737f, 0.9230838f, -1.4481737f, 0.8461676f}, {0.9273854f, -1.4549222f, 0.9273854f, -1.4549222f, 0.8547708f}, {0.9313636f, -1.4611633f, 0.9313636f, -1.4611633f, 0.8627271f}, {0.9350468f, -1.4669417f, 0.9350468f, -1.4669417f, 0.8700936f}, {0.9384612f, -1.4722983f, 0.9384612f, -1.4722983f, 0.8769223f}, {0.94163f, -1.4772698f, 0.94163f, -1.4772698f, 0.8832601f}, {0.9445747f, -1.4818895f, 0.9445747f, -1.4818895f, 0.8891494f}, {0.9473144f, -1.4861876f, 0.9473144f, -1.4861876f, 0.8946288f}, {0.9498665f, -1.4901915f, 0.9498665f, -1.4901915f, 0.899733f}, {0.9522467f, -1.4939256f, 0.9522467f, -1.4939256f, 0.9044934f}, {0.9544693f, -1.4974125f, 0.9544693f, -1.4974125f, 0.9089385f}, {0.9565471f, -1.5006723f, 0.9565471f, -1.5006723f, 0.9130942f}, {0.9584919f, -1.5037234f, 0.9584919f, -1.5037234f, 0.9169838f}, {0.9603142f, -1.5065823f, 0.9603142f, -1.5065823f, 0.9206284f}, {0.9620236f, -1.5092642f, 0.9620236f, -1.5092642f, 0.9240473f}, {0.963629f, -1.5117827f, 0.963629f, -1.5117827f, 0.927258f}, {0.9651382f, -1.5141504f, 0.9651382f, -1.5141504f, 0.9302764f}, {0.9665585f, -1.5163787f, 0.9665585f, -1.5163787f, 0.933117f}, {0.9679282f, -1.5185275f, 0.9679282f, -1.5185275f, 0.9358564f}, {0.9692936f, -1.5206695f, 0.9692936f, -1.5206695f, 0.9385871f}, {0.9706509f, -1.5227989f, 0.9706509f, -1.5227989f, 0.9413017f}, {0.9719956f, -1.5249086f, 0.9719956f, -1.5249086f, 0.9439912f}, {0.9733231f, -1.5269912f, 0.9733231f, -1.5269912f, 0.9466462f}, {0.9746287f, -1.5290395f, 0.9746287f, -1.5290395f, 0.9492573f}, {0.9759078f, -1.5310461f, 0.9759078f, -1.5310461f, 0.9518155f}, {0.9771561f, -1.5330046f, 0.9771561f, -1.5330046f, 0.9543122f}, {0.9783698f, -1.5349087f, 0.9783698f, -1.5349087f, 0.9567397f}, {0.9795455f, -1.5367533f, 0.9795455f, -1.5367533f, 0.9590911f}, {0.9806804f, -1.5385336f, 0.9806804f, -1.5385336f, 0.9613607f}, {0.981772f, -1.5402462f, 0.981772f, -1.5402462f, 0.963544f}, {0.9828187f, -1.5418883f, 0.9828187f, -1.5418883f, 0.9656373f}, {0.9838192f, -1.5434579f, 0.9838192f, -1.5434579f, 0.9676384f}, {0.9847729f, -1.5449541f, 0.9847729f, -1.5449541f, 0.9695458f}, {0.9856796f, -1.5463766f, 0.9856796f, -1.5463766f, 0.9713591f}, {0.9865395f, -1.5477257f, 0.9865395f, -1.5477257f, 0.973079f}, {0.9873533f, -1.5490024f, 0.9873533f, -1.5490024f, 0.9747066f}, {0.9881219f, -1.5502082f, 0.9881219f, -1.5502082f, 0.9762438f}},
-        {{0.6590801f, -1.0888001f, 0.6590801f, -1.0888001f, 0.3181601f}, {0.6608261f, -1.0916844f, 0.6608261f, -1.0916844f, 0.3216521f}, {0.6659583f, -1.100163f, 0.6659583f, -1.100163f, 0.3319167f}, {0.6741755f, -1.1137377f, 0.6741755f, -1.1137377f, 0.348351f}, {0.6850229f, -1.1316576f, 0.6850229f, -1.1316576f, 0.3700459f}, {0.6979519f, -1.1530163f, 0.6979519f, -1.1530163f, 0.3959038f}, {0.7123814f, -1.1768539f, 0.7123814f, -1.1768539f, 0.4247628f}, {0.727752f, -1.2022461f, 0.727752f, -1.2022461f, 0.4555041f}, {0.7435645f, -1.2283684f, 0.7435645f, -1.2283684f, 0.4871291f}, {0.759402f, -1.2545318f, 0.759402f, -1.2545318f, 0.518804f}, {0.7749372f, -1.2801959f, 0.7749372f, -1.2801959f, 0.5498743f}, {0.789929f, -1.3049625f, 0.789929f, -1.3049625f, 0.579858f}, {0.8042128f, -1.3285593f, 0.8042128f, -1.3285593f, 0.6084257f}, {0.8176872f, -1.350819f, 0.8176872f, -1.350819f, 0.6353744f}, {0.8303005f, -1.3716561f, 0.8303005f, -1.3716561f, 0.6606009f}, {0.8420385f, -1.3910474f, 0.8420385f, -1.3910474f, 0.6840771f}, {0.8529141f, -1.4090137f, 0.8529141f, -1.4090137f, 0.7058281f}, {0.862958f, -1.4256064f, 0.862958f, -1.4256064f, 0.725916f}, {0.872213f, -1.4408956f, 0.872213f, -1.4408956f, 0.744426f}, {0.8807281f, -1.4549626f, 0.8807281f, -1.4549626f, 0.7614563f}, {0.8885557f, -1.4678937f, 0.8885557f, -1.4678937f, 0.7771114f}, {0.8957484f, -1.479776f, 0.8957484f, -1.479776f, 0.7914968f}, {0.9023577f, -1.4906946f, 0.9023577f, -1.4906946f, 0.8047154f}, {0.9084328f, -1.5007307f, 0.9084328f, -1.5007307f, 0.8168657f}, {0.9140201f, -1.5099609f, 0.9140201f, -1.5099609f, 0.8280403f}, {0.9191626f, -1.5184563f, 0.9191626f, -1.5184563f, 0.8383252f}, {0.9238999f, -1.5262824f, 0.9238999f, -1.5262824f, 0.8477999f}, {0.9282685f, -1.5334992f, 0.9282685f, -1.5334992f, 0.856537f}, {0.9323014f, -1.5401616f, 0.9323014f, -1.5401616f, 0.8646028f}, {0.9360288f, -1.5463192f, 0.9360288f, -1.5463192f, 0.8720576f}, {0.939478f, -1.5520173f, 0.939478f, -1.5520173f, 0.8789559f}, {0.9426737f, -1.5572966f, 0.9426737f, -1.5572966f, 0.8853473f}, {0.9456382f, -1.562194f, 0.9456382f, -1.562194f, 0.8912764f}, {0.9483917f, -1.5667428f, 0.9483917f, -1.5667428f, 0.8967835f}, {0.9509525f, -1.5709733f, 0.9509525f, -1.5709733f, 0.9019051f}, {0.9533371f, -1.5749125f, 0.9533371f, -1.5749125f, 0.9066742f}, {0.9555602f, -1.5785852f, 0.9555602f, -1.5785852f, 0.9111205f}, {0.9576354f, -1.5820134f, 0.9576354f, -1.5820134f, 0.9152709f}, {0.9595749f, -1.5852174f, 0.9595749f, -1.5852174f, 0.9191498f}, {0.9613896f, -1.5882153f, 0.9613896f, -1.5882153f, 0.9227793f}, {0.9630896f, -1.5910237f, 0.9630896f, -1.5910237f, 0.9261792f}, {0.9646839f, -1.5936575f, 0.9646839f, -1.5936575f, 0.9293679f}, {0.9661808f, -1.5961303f, 0.9661808f, -1.5961303f, 0.9323616f}, {0.9675877f, -1.5984545f, 0.9675877f, -1.5984545f, 0.9351754f}, {0.9689114f, -1.6006413f, 0.9689114f, -1.6006413f, 0.9378228f}, {0.9701877f, -1.6027497f, 0.9701877f, -1.6027497f, 0.9403753f}, {0.9714597f, -1.6048511f, 0.9714597f, -1.6048511f, 0.9429194f}, {0.9727239f, -1.6069396f, 0.9727239f, -1.6069396f, 0.9454479f}, {0.9739763f, -1.6090084f, 0.9739763f, -1.6090084f, 0.9479525f}, {0.9752123f, -1.6110503f, 0.9752123f, -1.6110503f, 0.9504245f}, {0.9764276f, -1.6130581f, 0.9764276f, -1.6130581f, 0.9528552f}, {0.9776181f, -1.6150247f, 0.9776181f, -1.6150247f, 0.9552361f}, {0.9787797f, -1.6169438f, 0.9787797f, -1.6169438f, 0.9575594f}, {0.979909f, -1.6188093f, 0.979909f, -1.6188093f, 0.9598179f}, {0.9810026f, -1.620616f, 0.9810026f, -1.620616f, 0.9620053f}, {0.9820581f, -1.6223597f, 0.9820581f, -1.6223597f, 0.9641162f}, {0.9830732f, -1.6240366f, 0.9830732f, -1.6240366f, 0.9661465f}, {0.9840464f, -1.6256443f, 0.9840464f, -1.6256443f, 0.9680928f}, {0.9849765f, -1.6271809f, 0.9849765f, -1.6271809f, 0.969953f}, {0.985863f, -1.6286453f, 0.985863f, -1.6286453f, 0.971726f}, {0.9867056f, -1.6300374f, 0.9867056f, -1.6300374f, 0.9734113f}, {0.9875047f, -1.6313575f, 0.9875047f, -1.6313575f, 0.9750094f}, {0.9882609f, -1.6326066f, 0.9882609f, -1.6326066f, 0.9765217f}, {0.9889749f, -1.6337862f, 0.9889749f, -1.6337862f, 0.9779499f}},
-        {{0.6773038f, -1.1646489f, 0.6773038f, -1.1646489f, 0.3546075f}, {0.6790019f, -1.1675689f, 0.6790019f, -1.1675689f, 0.3580038f}, {0.6839907f, -1.1761473f, 0.6839907f, -1.1761473f, 0.3679813f}, {0.6919694f, -1.189867f, 0.6919694f, -1.189867f, 0.3839388f}, {0.7024859f, -1.2079505f, 0.7024859f, -1.2079505f, 0.4049717f}, {0.7149962f, -1.2294626f, 0.7149962f, -1.2294626f, 0.4299925f}, {0.7289278f, -1.2534183f, 0.7289278f, -1.2534183f, 0.4578555f}, {0.7437322f, -1.2788751f, 0.7437322f, -1.2788751f, 0.4874645f}, {0.758924f, -1.304998f, 0.758924f, -1.304998f, 0.5178481f}, {0.7741011f, -1.3310955f, 0.7741011f, -1.3310955f, 0.5482021f}, {0.7889509f, -1.3566303f, 0.7889509f, -1.3566303f, 0.5779018f}, {0.8032463f, -1.3812118f, 0.8032463f, -1.3812118f, 0.6064926f}, {0.8168346f, -1.4045773f, 0.8168346f, -1.4045773f, 0.6336691f}, {0.8296243f, -1.4265698f, 0.8296243f, -1.4265698f, 0.6592486f}, {0.8415717f, -1.4471138f, 0.8415717f, -1.4471138f, 0.6831434f}, {0.8526685f, -1.4661951f, 0.8526685f, -1.4661951f, 0.705337f}, {0.8629313f, -1.4838424f, 0.8629313f, -1.4838424f, 0.7258626f}, {0.8723936f, -1.5001131f, 0.8723936f, -1.5001131f, 0.7447871f}, {0.8810991f, -1.5150826f, 0.8810991f, -1.5150826f, 0.7621982f}, {0.8890974f, -1.528836f, 0.8890974f, -1.528836f, 0.7781948f}, {0.8964403f, -1.5414624f, 0.8964403f, -1.5414624f, 0.7928806f}, {0.9031796f, -1.5530508f, 0.9031796f, -1.5530508f, 0.8063591f}, {0.9093654f, -1.5636876f, 0.9093654f, -1.5636876f, 0.8187308f}, {0.9150456f, -1.5734549f, 0.9150456f, -1.5734549f, 0.8300912f}, {0.9202648f, -1.5824295f, 0.9202648f, -1.5824295f, 0.8405296f}, {0.9250644f, -1.5906825f, 0.9250644f, -1.5906825f, 0.8501288f}, {0.9294824f, -1.5982795f, 0.9294824f, -1.5982795f, 0.8589648f}, {0.9335535f, -1.6052799f, 0.9335535f, -1.6052799f, 0.8671071f}, {0.9373094f, -1.6117382f, 0.9373094f, -1.6117382f, 0.8746188f}, {0.9407786f, -1.6177036f, 0.9407786f, -1.6177036f, 0.8815571f}, {0.943987f, -1.6232206f, 0.943987f, -1.6232206f, 0.8879739f}, {0.946958f, -1.6283294f, 0.946958f, -1.6283294f, 0.893916f}, {0.9497128f, -1.6330664f, 0.9497128f, -1.6330664f, 0.8994256f}, {0.9522704f, -1.6374642f, 0.9522704f, -1.6374642f, 0.9045408f}, {0.9546479f, -1.6415525f, 0.9546479f, -1.6415525f, 0.9092959f}, {0.956861f, -1.6453579f, 0.956861f, -1.6453579f, 0.9137219f}, {0.9589235f, -1.6489044f, 0.9589235f, -1.6489044f, 0.9178469f}, {0.9608481f, -1.6522139f, 0.9608481f, -1.6522139f, 0.9216961f}, {0.9626462f, -1.6553058f, 0.9626462f, -1.6553058f, 0.9252924f}, {0.9643282f, -1.658198f, 0.9643282f, -1.658198f, 0.9286563f}, {0.9659034f, -1.6609066f, 0.9659034f, -1.6609066f, 0.9318067f}, {0.9673802f, -1.6634462f, 0.9673802f, -1.6634462f, 0.9347605f}, {0.9687665f, -1.66583f, 0.9687665f, -1.66583f, 0.937533f}, {0.9700692f, -1.6680699f, 0.9700692f, -1.6680699f, 0.9401383f}, {0.9712946f, -1.670177f, 0.9712946f, -1.670177f, 0.9425891f}, {0.9724758f, -1.6722082f, 0.9724758f, -1.6722082f, 0.9449515f}, {0.9736528f, -1.6742321f, 0.9736528f, -1.6742321f, 0.9473056f}, {0.9748224f, -1.6762433f, 0.9748224f, -1.6762433f, 0.9496449f}, {0.9759808f, -1.6782351f, 0.9759808f, -1.6782351f, 0.9519616f}, {0.9771238f, -1.6802006f, 0.9771238f, -1.6802006f, 0.9542476f}, {0.9782475f, -1.6821329f, 0.9782475f, -1.6821329f, 0.956495f}, {0.979348f, -1.6840252f, 0.979348f, -1.6840252f, 0.958696f}, {0.9804217f, -1.6858714f, 0.9804217f, -1.6858714f, 0.9608434f}, {0.9814652f, -1.6876658f, 0.9814652f, -1.6876658f, 0.9629304f}, {0.9824757f, -1.6894034f, 0.9824757f, -1.6894034f, 0.9649514f}, {0.9834507f, -1.6910799f, 0.9834507f, -1.6910799f, 0.9669014f}, {0.9843883f, -1.6926921f, 0.9843883f, -1.6926921f, 0.9687766f}, {0.985287f, -1.6942375f, 0.985287f, -1.6942375f, 0.9705739f}, {0.9861458f, -1.6957142f, 0.9861458f, -1.6957142f, 0.9722916f}, {0.9869642f, -1.6971215f, 0.9869642f, -1.6971215f, 0.9739283f}, {0.987742f, -1.698459f, 0.987742f, -1.698459f, 0.975484f}, {0.9884795f, -1.6997272f, 0.9884795f, -1.6997272f, 0.976959f}, {0.9891773f, -1.7009271f, 0.9891773f, -1.7009271f, 0.9783546f}, {0.9898362f, -1.7020601f, 0.9898362f, -1.7020601f, 0.9796724f}},
-        {{0.6961778f, -1.2351843f, 0.6961778f, -1.2351843f, 0.3923556f}, {0.6978209f, -1.2380996f, 0.6978209f, -1.2380996f, 0.3956418f}, {0.7026453f, -1.2466592f, 0.7026453f, -1.2466592f, 0.4052906f}, {0.7103525f, -1.2603336f, 0.7103525f, -1.2603336f, 0.4207049f}, {0.7204948f, -1.2783285f, 0.7204948f, -1.2783285f, 0.4409897f}, {0.7325363f, -1.2996929f, 0.7325363f, -1.2996929f, 0.4650725f}, {0.7459151f, -1.3234301f, 0.7459151f, -1.3234301f, 0.4918302f}, {0.7600971f, -1.3485924f, 0.7600971f, -1.3485924f, 0.5201943f}, {0.7746128f, -1.3743466f, 0.7746128f, -1.3743466f, 0.5492256f}, {0.7890767f, -1.400009f, 0.7890767f, -1.400009f, 0.5781533f}, {0.8031923f, -1.4250535f, 0.8031923f, -1.4250535f, 0.6063847f}, {0.8167471f, -1.4491029f, 0.8167471f, -1.4491029f, 0.6334943f}, {0.8296008f, -1.4719084f, 0.8296008f, -1.4719084f, 0.6592016f}, {0.8416719f, -1.4933254f, 0.8416719f, -1.4933254f, 0.6833438f}, {0.8529243f, -1.5132898f, 0.8529243f, -1.5132898f, 0.7058486f}, {0.863355f, -1.5317963f, 0.863355f, -1.5317963f, 0.72671f}, {0.8729843f, -1.5488809f, 0.8729843f, -1.5488809f, 0.7459686f}, {0.8818476f, -1.5646065f, 0.8818476f, -1.5646065f, 0.7636952f}, {0.8899895f, -1.5790522f, 0.8899895f, -1.5790522f, 0.779979f}, {0.8974594f, -1.5923055f, 0.8974594f, -1.5923055f, 0.7949187f}, {0.9043082f, -1.604457f, 0.9043082f, -1.604457f, 0.8086164f}, {0.9105865f, -1.6155962f, 0.9105865f, -1.6155962f, 0.821173f}, {0.916343f, -1.6258095f, 0.916343f, -1.6258095f, 0.8326859f}, {0.9216235f, -1.6351785f, 0.9216235f, -1.6351785f, 0.8432471f}, {0.9264711f, -1.6437792f, 0.9264711f, -1.6437792f, 0.8529422f}, {0.9309252f, -1.6516818f, 0.9309252f, -1.6516818f, 0.8618503f}, {0.9350219f, -1.6589504f, 0.9350219f, -1.6589504f, 0.8700438f}, {0.9387943f, -1.6656435f, 0.9387943f, -1.6656435f, 0.8775886f}, {0.9422722f, -1.6718142f, 0.9422722f, -1.6718142f, 0.8845444f}, {0.9454827f, -1.6775104f, 0.9454827f, -1.6775104f, 0.8909655f}, {0.9484502f, -1.6827755f, 0.9484502f, -1.6827755f, 0.8969005f}, {0.9511968f, -1.6876485f, 0.9511968f, -1.6876485f, 0.9023936f}, {0.9537422f, -1.6921646f, 0.9537422f, -1.6921646f, 0.9074844f}, {0.9561043f, -1.6963556f, 0.9561043f, -1.6963556f, 0.9122086f}, {0.9582992f, -1.7002499f, 0.9582992f, -1.7002499f, 0.9165985f}, {0.9603415f, -1.7038734f, 0.9603415f, -1.7038734f, 0.920683f}, {0.9622442f, -1.7072491f, 0.9622442f, -1.7072491f, 0.9244883f}, {0.964019f, -1.7103981f, 0.964019f, -1.7103981f, 0.928038f}, {0.9656767f, -1.7133393f, 0.9656767f, -1.7133393f, 0.9313534f}, {0.9672269f, -1.7160896f, 0.9672269f, -1.7160896f, 0.9344537f}, {0.9686782f, -1.7186647f, 0.9686782f, -1.7186647f, 0.9373564f}, {0.9700386f, -1.7210784f, 0.9700386f, -1.7210784f, 0.9400773f}, {0.9713153f, -1.7233435f, 0.9713153f, -1.7233435f, 0.9426306f}, {0.9725147f, -1.7254714f, 0.9725147f, -1.7254714f, 0.9450293f}, {0.9736426f, -1.7274727f, 0.9736426f, -1.7274727f, 0.9472853f}, {0.9747298f, -1.7294015f, 0.9747298f, -1.7294015f, 0.9494595f}, {0.9758128f, -1.7313231f, 0.9758128f, -1.7313231f, 0.9516256f}, {0.9768888f, -1.7332322f, 0.9768888f, -1.7332322f, 0.9537776f}, {0.9779542f, -1.7351225f, 0.9779542f, -1.7351225f, 0.9559085f}, {0.9790054f, -1.7369875f, 0.9790054f, -1.7369875f, 0.9580107f}, {0.9800385f, -1.7388206f, 0.9800385f, -1.7388206f, 0.9600771f}, {0.9810502f, -1.7406155f, 0.9810502f, -1.7406155f, 0.9621004f}, {0.982037f, -1.7423663f, 0.982037f, -1.7423663f, 0.964074f}, {0.9829959f, -1.7440676f, 0.9829959f, -1.7440676f, 0.9659918f}, {0.9839243f, -1.7457148f, 0.9839243f, -1.7457148f, 0.9678486f}, {0.98482f, -1.7473039f, 0.98482f, -1.7473039f, 0.9696399f}, {0.9856811f, -1.7488318f, 0.9856811f, -1.7488318f, 0.9713622f}, {0.9865064f, -1.7502961f, 0.9865064f, -1.7502961f, 0.9730128f}, {0.9872949f, -1.7516951f, 0.9872949f, -1.7516951f, 0.9745899f}, {0.9880463f, -1.7530282f, 0.9880463f, -1.7530282f, 0.9760925f}, {0.9887603f, -1.754295f, 0.9887603f, -1.754295f, 0.9775205f}, {0.9894372f, -1.755496f, 0.9894372f, -1.755496f, 0.9788744f}, {0.9900775f, -1.7566321f, 0.9900775f, -1.7566321f, 0.9801551f}, {0.9906822f, -1.7577049f, 0.9906822f, -1.7577049f, 0.9813643f}},
-        {{0.7153291f, -1.3007844f, 0.7153291f, -1.3007844f, 0.4306582f}, {0.7169108f, -1.3036605f, 0.7169108f, -1.3036605f, 0.4338215f}, {0.721552f, -1.3121003f, 0.721552f, -1.3121003f, 0.443104f}, {0.7289582f, -1.325568f, 0.7289582f, -1.325568f, 0.4579163f}, {0.7386887f, -1.3432624f, 0.7386887f, -1.3432624f, 0.4773774f}, {0.750218f, -1.3642278f, 0.750218f, -1.3642278f, 0.5004361f}, {0.7629986f, -1.3874684f, 0.7629986f, -1.3874684f, 0.5259971f}, {0.7765128f, -1.4120432f, 0.7765128f, -1.4120432f, 0.5530255f}, {0.7903092f, -1.4371313f, 0.7903092f, -1.4371313f, 0.5806184f}, {0.8040206f, -1.4620647f, 0.8040206f, -1.4620647f, 0.6080412f}, {0.8173677f, -1.4863355f, 0.8173677f, -1.4863355f, 0.6347353f}, {0.8301526f, -1.5095842f, 0.8301526f, -1.5095842f, 0.6603052f}, {0.8422476f, -1.5315782f, 0.8422476f, -1.5315782f, 0.6844952f}, {0.8535809f, -1.5521872f, 0.8535809f, -1.5521872f, 0.7071619f}, {0.8641236f, -1.5713584f, 0.8641236f, -1.5713584f, 0.7282471f}, {0.8738775f, -1.5890953f, 0.8738775f, -1.5890953f, 0.7477549f}, {0.8828658f, -1.6054401f, 0.8828658f, -1.6054401f, 0.7657317f}, {0.8911256f, -1.62046f, 0.8911256f, -1.62046f, 0.7822512f}, {0.8987016f, -1.6342365f, 0.8987016f, -1.6342365f, 0.7974032f}, {0.9056426f, -1.6468584f, 0.9056426f, -1.6468584f, 0.8112852f}, {0.9119985f, -1.6584161f, 0.9119985f, -1.6584161f, 0.8239969f}, {0.9178181f, -1.6689987f, 0.9178181f, -1.6689987f, 0.8356362f}, {0.9231483f, -1.6786914f, 0.9231483f, -1.6786914f, 0.8462965f}, {0.928033f, -1.687574f, 0.928033f, -1.687574f, 0.856066f}, {0.9325132f, -1.6957209f, 0.9325132f, -1.6957209f, 0.8650264f}, {0.9366263f, -1.7032003f, 0.9366263f, -1.7032003f, 0.8732525f}, {0.9404065f, -1.7100745f, 0.9404065f, -1.7100745f, 0.8808131f}, {0.9438851f, -1.7164f, 0.9438851f, -1.7164f, 0.8877701f}, {0.94709f, -1.7222281f, 0.94709f, -1.7222281f, 0.89418f}, {0.9500468f, -1.7276048f, 0.9500468f, -1.7276048f, 0.9000936f}, {0.9527783f, -1.7325719f, 0.9527783f, -1.7325719f, 0.9055566f}, {0.9553051f, -1.7371667f, 0.9553051f, -1.7371667f, 0.9106102f}, {0.9576458f, -1.7414231f, 0.9576458f, -1.7414231f, 0.9152915f}, {0.959817f, -1.7453712f, 0.959817f, -1.7453712f, 0.9196339f}, {0.9618337f, -1.7490385f, 0.9618337f, -1.7490385f, 0.9236673f}, {0.9637094f, -1.7524494f, 0.9637094f, -1.7524494f, 0.9274187f}, {0.9654563f, -1.755626f, 0.9654563f, -1.755626f, 0.9309125f}, {0.9670853f, -1.7585883f, 0.9670853f, -1.7585883f, 0.9341706f}, {0.9686063f, -1.7613542f, 0.9686063f, -1.7613542f, 0.9372126f}, {0.9700283f, -1.7639399f, 0.9700283f, -1.7639399f, 0.9400565f}, {0.9713592f, -1.7663602f, 0.9713592f, -1.7663602f, 0.9427185f}, {0.9726065f, -1.7686283f, 0.9726065f, -1.7686283f, 0.945213f}, {0.9737767f, -1.7707562f, 0.9737767f, -1.7707562f, 0.9475534f}, {0.9748758f, -1.7727549f, 0.9748758f, -1.7727549f, 0.9497516f}, {0.9759093f, -1.7746342f, 0.9759093f, -1.7746342f, 0.9518186f}, {0.9769051f, -1.7764451f, 0.9769051f, -1.7764451f, 0.9538103f}, {0.9778971f, -1.7782489f, 0.9778971f, -1.7782489f, 0.9557941f}, {0.9788824f, -1.7800406f, 0.9788824f, -1.7800406f, 0.9577647f}, {0.9798578f, -1.7818143f, 0.9798578f, -1.7818143f, 0.9597155f}, {0.9808199f, -1.7835639f, 0.9808199f, -1.7835639f, 0.9616399f}, {0.9817655f, -1.7852833f, 0.9817655f, -1.7852833f, 0.9635309f}, {0.9826911f, -1.7869666f, 0.9826911f, -1.7869666f, 0.9653823f}, {0.9835939f, -1.7886083f, 0.9835939f, -1.7886083f, 0.9671878f}, {0.984471f, -1.7902032f, 0.984471f, -1.7902032f, 0.9689421f}, {0.9853201f, -1.7917472f, 0.9853201f, -1.7917472f, 0.9706402f}, {0.9861391f, -1.7932365f, 0.9861391f, -1.7932365f, 0.9722782f}, {0.9869264f, -1.7946681f, 0.9869264f, -1.7946681f, 0.9738528f}, {0.9876808f, -1.79604f, 0.9876808f, -1.79604f, 0.9753616f}, {0.9884015f, -1.7973506f, 0.9884015f, -1.7973506f, 0.976803f}, {0.9890881f, -1.7985992f, 0.9890881f, -1.7985992f, 0.9781763f}, {0.9897405f, -1.7997855f, 0.9897405f, -1.7997855f, 0.9794811f}, {0.990359f, -1.8009102f, 0.990359f, -1.8009102f, 0.980718f}, {0.990944f, -1.8019739f, 0.990944f, -1.8019739f, 0.981888f}, {0.9914963f, -1.8029782f, 0.9914963f, -1.8029782f, 0.9829925f}},
-        {{0.7344444f, -1.3617353f, 0.7344444f, -1.3617353f, 0.4688889f}, {0.7359591f, -1.3645436f, 0.7359591f, -1.3645436f, 0.4719181f}, {0.7404011f, -1.3727796f, 0.7404011f, -1.3727796f, 0.4808022f}, {0.7474814f, -1.3859072f, 0.7474814f, -1.3859072f, 0.4949627f}, {0.7567688f, -1.403127f, 0.7567688f, -1.403127f, 0.5135376f}, {0.7677512f, -1.4234896f, 0.7677512f, -1.4234896f, 0.5355025f}, {0.7798978f, -1.4460106f, 0.7798978f, -1.4460106f, 0.5597957f}, {0.7927102f, -1.4697661f, 0.7927102f, -1.4697661f, 0.5854204f}, {0.8057569f, -1.4939559f, 0.8057569f, -1.4939559f, 0.6115137f}, {0.8186899f, -1.5179351f, 0.8186899f, -1.5179351f, 0.6373798f}, {0.8312476f, -1.5412183f, 0.8312476f, -1.5412183f, 0.6624952f}, {0.8432472f, -1.5634669f, 0.8432472f, -1.5634669f, 0.6864945f}, {0.8545731f, -1.5844663f, 0.8545731f, -1.5844663f, 0.7091462f}, {0.8651627f, -1.6041004f, 0.8651627f, -1.6041004f, 0.7303254f}, {0.8749935f, -1.6223278f, 0.8749935f, -1.6223278f, 0.7499871f}, {0.8840718f, -1.6391599f, 0.8840718f, -1.6391599f, 0.7681436f}, {0.8924231f, -1.654644f, 0.8924231f, -1.654644f, 0.7848462f}, {0.9000852f, -1.6688503f, 0.9000852f, -1.6688503f, 0.8001704f}, {0.9071027f, -1.6818616f, 0.9071027f, -1.6818616f, 0.8142055f}, {0.9135235f, -1.6937663f, 0.9135235f, -1.6937663f, 0.827047f}, {0.9193958f, -1.7046541f, 0.9193958f, -1.7046541f, 0.8387915f}, {0.9247665f, -1.714612f, 0.9247665f, -1.714612f, 0.8495331f}, {0.9296806f, -1.7237232f, 0.9296806f, -1.7237232f, 0.8593611f}, {0.9341797f, -1.7320651f, 0.9341797f, -1.7320651f, 0.8683595f}, {0.9383027f, -1.7397095f, 0.9383027f, -1.7397095f, 0.8766054f}, {0.9420848f, -1.746722f, 0.9420848f, -1.746722f, 0.8841697f}, {0.9455584f, -1.7531623f, 0.9455584f, -1.7531623f, 0.8911168f}, {0.9487526f, -1.7590847f, 0.9487526f, -1.7590847f, 0.8975052f}, {0.9516938f, -1.764538f, 0.9516938f, -1.764538f, 0.9033876f}, {0.9544057f, -1.7695661f, 0.9544057f, -1.7695661f, 0.9088114f}, {0.9569096f, -1.7742087f, 0.9569096f, -1.7742087f, 0.9138193f}, {0.9592249f, -1.7785013f, 0.9592249f, -1.7785013f, 0.9184497f}, {0.9613685f, -1.7824759f, 0.9613685f, -1.7824759f, 0.9227371f}, {0.9633562f, -1.7861612f, 0.9633562f, -1.7861612f, 0.9267124f}, {0.9652017f, -1.789583f, 0.9652017f, -1.789583f, 0.9304034f}, {0.9669176f, -1.7927644f, 0.9669176f, -1.7927644f, 0.9338352f}, {0.9685151f, -1.7957264f, 0.9685151f, -1.7957264f, 0.9370302f}, {0.9700043f, -1.7984876f, 0.9700043f, -1.7984876f, 0.9400087f}, {0.9713945f, -1.801065f, 0.9713945f, -1.801065f, 0.9427889f}, {0.9726937f, -1.8034739f, 0.9726937f, -1.8034739f, 0.9453874f}, {0.9739095f, -1.8057281f, 0.9739095f, -1.8057281f, 0.947819f}, {0.9750485f, -1.8078401f, 0.9750485f, -1.8078401f, 0.9500971f}, {0.976117f, -1.8098211f, 0.976117f, -1.8098211f, 0.952234f}, {0.9771203f, -1.8116813f, 0.9771203f, -1.8116813f, 0.9542406f}, {0.9780635f, -1.8134302f, 0.9780635f, -1.8134302f, 0.9561271f}, {0.9789723f, -1.815115f, 0.9789723f, -1.815115f, 0.9579445f}, {0.9798772f, -1.8167929f, 0.9798772f, -1.8167929f, 0.9597545f}, {0.980776f, -1.8184593f, 0.980776f, -1.8184593f, 0.961552f}, {0.9816656f, -1.8201087f, 0.9816656f, -1.8201087f, 0.9633311f}, {0.9825429f, -1.8217354f, 0.9825429f, -1.8217354f, 0.9650858f}, {0.983405f, -1.8233337f, 0.983405f, -1.8233337f, 0.9668099f}, {0.9842487f, -1.8248982f, 0.9842487f, -1.8248982f, 0.9684975f}, {0.9850715f, -1.8264236f, 0.9850715f, -1.8264236f, 0.970143f}, {0.9858708f, -1.8279055f, 0.9858708f, -1.8279055f, 0.9717415f}, {0.9866443f, -1.8293398f, 0.9866443f, -1.8293398f, 0.9732886f}, {0.9873904f, -1.8307231f, 0.9873904f, -1.8307231f, 0.9747807f}, {0.9881075f, -1.8320526f, 0.9881075f, -1.8320526f, 0.9762149f}, {0.9887945f, -1.8333265f, 0.9887945f, -1.8333265f, 0.977589f}, {0.9894508f, -1.8345432f, 0.9894508f, -1.8345432f, 0.9789015f}, {0.9900759f, -1.8357023f, 0.9900759f, -1.8357023f, 0.9801518f}, {0.9906698f, -1.8368035f, 0.9906698f, -1.8368035f, 0.9813396f}, {0.9912327f, -1.8378472f, 0.9912327f, -1.8378472f, 0.9824655f}, {0.9917651f, -1.8388344f, 0.9917651f, -1.8388344f, 0.9835303f}, {0.9922677f, -1.8397662f, 0.9922677f, -1.8397662f, 0.9845354f}},
-        {{0.7532658f, -1.418272f, 0.7532658f, -1.418272f, 0.5065317f}, {0.754709f, -1.4209892f, 0.754709f, -1.4209892f, 0.5094179f}, {0.7589389f, -1.4289534f, 0.7589389f, -1.4289534f, 0.5178777f}, {0.7656736f, -1.4416337f, 0.7656736f, -1.4416337f, 0.5313471f}, {0.7744937f, -1.4582406f, 0.7744937f, -1.4582406f, 0.5489875f}, {0.7849034f, -1.4778401f, 0.7849034f, -1.4778401f, 0.5698067f}, {0.7963908f, -1.499469f, 0.7963908f, -1.499469f, 0.5927816f}, {0.8084789f, -1.5222288f, 0.8084789f, -1.5222288f, 0.6169577f}, {0.8207575f, -1.5453473f, 0.8207575f, -1.5453473f, 0.6415149f}, {0.8328989f, -1.5682076f, 0.8328989f, -1.5682076f, 0.6657977f}, {0.8446592f, -1.5903502f, 0.8446592f, -1.5903502f, 0.6893183f}, {0.8558705f, -1.6114593f, 0.8558705f, -1.6114593f, 0.711741f}, {0.8664288f, -1.6313387f, 0.8664288f, -1.6313387f, 0.7328576f}, {0.87628f, -1.649887f, 0.87628f, -1.649887f, 0.7525601f}, {0.8854077f, -1.6670728f, 0.8854077f, -1.6670728f, 0.7708154f}, {0.8938214f, -1.6829145f, 0.8938214f, -1.6829145f, 0.7876429f}, {0.9015486f, -1.6974634f, 0.9015486f, -1.6974634f, 0.8030972f}, {0.9086273f, -1.7107913f, 0.9086273f, -1.7107913f, 0.8172546f}, {0.9151015f, -1.7229811f, 0.9151015f, -1.7229811f, 0.8302029f}, {0.9210175f, -1.73412f, 0.9210175f, -1.73412f, 0.842035f}, {0.9264219f, -1.7442955f, 0.9264219f, -1.7442955f, 0.8528437f}, {0.9313594f, -1.7535921f, 0.9313594f, -1.7535921f, 0.8627189f}, {0.9358727f, -1.7620899f, 0.9358727f, -1.7620899f, 0.8717454f}, {0.9400013f, -1.7698632f, 0.9400013f, -1.7698632f, 0.8800025f}, {0.9437815f, -1.7769808f, 0.9437815f, -1.7769808f, 0.887563f}, {0.9472467f, -1.7835051f, 0.9472467f, -1.7835051f, 0.8944933f}, {0.9504269f, -1.789493f, 0.9504269f, -1.789493f, 0.9008539f}, {0.9533496f, -1.7949959f, 0.9533496f, -1.7949959f, 0.9066992f}, {0.9560392f, -1.8000599f, 0.9560392f, -1.8000599f, 0.9120783f}, {0.9585177f, -1.8047266f, 0.9585177f, -1.8047266f, 0.9170355f}, {0.9608051f, -1.8090334f, 0.9608051f, -1.8090334f, 0.9216103f}, {0.9629192f, -1.8130138f, 0.9629192f, -1.8130138f, 0.9258383f}, {0.9648757f, -1.8166977f, 0.9648757f, -1.8166977f, 0.9297515f}, {0.9666892f, -1.8201121f, 0.9666892f, -1.8201121f, 0.9333784f}, {0.9683724f, -1.8232812f, 0.9683724f, -1.8232812f, 0.9367447f}, {0.9699368f, -1.8262267f, 0.9699368f, -1.8262267f, 0.9398735f}, {0.9713928f, -1.8289682f, 0.9713928f, -1.8289682f, 0.9427856f}, {0.9727498f, -1.8315231f, 0.9727498f, -1.8315231f, 0.9454995f}, {0.9740161f, -1.8339073f, 0.9740161f, -1.8339073f, 0.9480321f}, {0.9751993f, -1.8361351f, 0.9751993f, -1.8361351f, 0.9503985f}, {0.9763062f, -1.8382193f, 0.9763062f, -1.8382193f, 0.9526124f}, {0.9773431f, -1.8401715f, 0.9773431f, -1.8401715f, 0.9546861f}, {0.9783154f, -1.8420023f, 0.9783154f, -1.8420023f, 0.9566309f}, {0.9792284f, -1.8437212f, 0.9792284f, -1.8437212f, 0.9584567f}, {0.9800865f, -1.8453369f, 0.9800865f, -1.8453369f, 0.9601729f}, {0.980913f, -1.8468931f, 0.980913f, -1.8468931f, 0.961826f}, {0.981736f, -1.8484427f, 0.981736f, -1.8484427f, 0.963472f}, {0.9825532f, -1.8499814f, 0.9825532f, -1.8499814f, 0.9651065f}, {0.983362f, -1.8515041f, 0.983362f, -1.8515041f, 0.966724f}, {0.9841595f, -1.8530056f, 0.9841595f, -1.8530056f, 0.9683189f}, {0.9849429f, -1.8544807f, 0.9849429f, -1.8544807f, 0.9698858f}, {0.9857096f, -1.8559243f, 0.9857096f, -1.8559243f, 0.9714192f}, {0.9864571f, -1.8573317f, 0.9864571f, -1.8573317f, 0.9729142f}, {0.9871831f, -1.8586987f, 0.9871831f, -1.8586987f, 0.9743663f}, {0.9878857f, -1.8600216f, 0.9878857f, -1.8600216f, 0.9757715f}, {0.9885633f, -1.8612973f, 0.9885633f, -1.8612973f, 0.9771265f}, {0.9892144f, -1.8625232f, 0.9892144f, -1.8625232f, 0.9784287f}, {0.9898381f, -1.8636976f, 0.9898381f, -1.8636976f, 0.9796762f}, {0.9904338f, -1.8648193f, 0.9904338f, -1.8648193f, 0.9808677f}, {0.9910012f, -1.8658876f, 0.9910012f, -1.8658876f, 0.9820025f}, {0.9915403f, -1.8669024f, 0.9915403f, -1.8669024f, 0.9830805f}, {0.9920511f, -1.8678643f, 0.9920511f, -1.8678643f, 0.9841022f}, {0.9925342f, -1.8687738f, 0.9925342f, -1.8687738f, 0.9850684f}, {0.9929902f, -1.8696324f, 0.9929902f, -1.8696324f, 0.9859803f}},
-        {{0.7715863f, -1.4706035f, 0.7715863f, -1.4706035f, 0.5431727f}, {0.7729546f, -1.4732114f, 0.7729546f, -1.4732114f, 0.5459093f}, {0.7769629f, -1.4808509f, 0.7769629f, -1.4808509f, 0.5539257f}, {0.7833378f, -1.4930011f, 0.7833378f, -1.4930011f, 0.5666755f}, {0.791674f, -1.5088894f, 0.791674f, -1.5088894f, 0.5833479f}, {0.8014938f, -1.5276055f, 0.8014938f, -1.5276055f, 0.6029876f}, {0.8123071f, -1.5482151f, 0.8123071f, -1.5482151f, 0.6246141f}, {0.8236594f, -1.5698521f, 0.8236594f, -1.5698521f, 0.6473189f}, {0.8351632f, -1.5917777f, 0.8351632f, -1.5917777f, 0.6703264f}, {0.8465113f, -1.6134066f, 0.8465113f, -1.6134066f, 0.6930226f}, {0.8574775f, -1.6343076f, 0.8574775f, -1.6343076f, 0.714955f}, {0.8679084f, -1.6541883f, 0.8679084f, -1.6541883f, 0.7358168f}, {0.8777108f, -1.6728712f, 0.8777108f, -1.6728712f, 0.7554217f}, {0.8868387f, -1.6902685f, 0.8868387f, -1.6902685f, 0.7736774f}, {0.8952804f, -1.706358f, 0.8952804f, -1.706358f, 0.7905609f}, {0.9030487f, -1.7211639f, 0.9030487f, -1.7211639f, 0.8060974f}, {0.9101718f, -1.7347402f, 0.9101718f, -1.7347402f, 0.8203436f}, {0.9166878f, -1.7471593f, 0.9166878f, -1.7471593f, 0.8333755f}, {0.9226395f, -1.7585029f, 0.9226395f, -1.7585029f, 0.8452789f}, {0.9280715f, -1.7688561f, 0.9280715f, -1.7688561f, 0.856143f}, {0.9330283f, -1.7783035f, 0.9330283f, -1.7783035f, 0.8660566f}, {0.9375524f, -1.7869262f, 0.9375524f, -1.7869262f, 0.8751048f}, {0.941684f, -1.7948008f, 0.941684f, -1.7948008f, 0.883368f}, {0.9454602f, -1.801998f, 0.9454602f, -1.801998f, 0.8909204f}, {0.9489152f, -1.808583f, 0.9489152f, -1.808583f, 0.8978304f}, {0.95208f, -1.814615f, 0.95208f, -1.814615f, 0.90416f}, {0.9549827f, -1.8201475f, 0.9549827f, -1.8201475f, 0.9099655f}, {0.9576488f, -1.8252288f, 0.9576488f, -1.8252288f, 0.9152975f}, {0.9601009f, -1.8299023f, 0.9601009f, -1.8299023f, 0.9202017f}, {0.9623594f, -1.8342071f, 0.9623594f, -1.8342071f, 0.9247189f}, {0.9644429f, -1.838178f, 0.9644429f, -1.838178f, 0.9288857f}, {0.9663675f, -1.8418463f, 0.9663675f, -1.8418463f, 0.9327351f}, {0.9681482f, -1.8452401f, 0.9681482f, -1.8452401f, 0.9362964f}, {0.969798f, -1.8483845f, 0.969798f, -1.8483845f, 0.9395959f}, {0.9713287f, -1.8513021f, 0.9713287f, -1.8513021f, 0.9426574f}, {0.972751f, -1.8540129f, 0.972751f, -1.8540129f, 0.945502f}, {0.9740744f, -1.8565351f, 0.9740744f, -1.8565351f, 0.9481487f}, {0.9753074f, -1.8588852f, 0.9753074f, -1.8588852f, 0.9506147f}, {0.9764577f, -1.8610776f, 0.9764577f, -1.8610776f, 0.9529154f}, {0.9775323f, -1.8631257f, 0.9775323f, -1.8631257f, 0.9550646f}, {0.9785374f, -1.8650414f, 0.9785374f, -1.8650414f, 0.9570748f}, {0.9794787f, -1.8668354f, 0.9794787f, -1.8668354f, 0.9589573f}, {0.9803612f, -1.8685175f, 0.9803612f, -1.8685175f, 0.9607224f}, {0.9811897f, -1.8700966f, 0.9811897f, -1.8700966f, 0.9623794f}, {0.9819682f, -1.8715805f, 0.9819682f, -1.8715805f, 0.9639365f}, {0.9827181f, -1.8730096f, 0.9827181f, -1.8730096f, 0.9654361f}, {0.9834646f, -1.8744323f, 0.9834646f, -1.8744323f, 0.9669291f}, {0.9842057f, -1.8758449f, 0.9842057f, -1.8758449f, 0.9684113f}, {0.984939f, -1.8772425f, 0.984939f, -1.8772425f, 0.969878f}, {0.985662f, -1.8786205f, 0.985662f, -1.8786205f, 0.971324f}, {0.9863721f, -1.879974f, 0.9863721f, -1.879974f, 0.9727443f}, {0.987067f, -1.8812985f, 0.987067f, -1.8812985f, 0.9741341f}, {0.9877444f, -1.8825895f, 0.9877444f, -1.8825895f, 0.9754888f}, {0.9884022f, -1.8838433f, 0.9884022f, -1.8838433f, 0.9768045f}, {0.9890388f, -1.8850565f, 0.9890388f, -1.8850565f, 0.9780775f}, {0.9896525f, -1.8862262f, 0.9896525f, -1.8862262f, 0.9793049f}, {0.9902422f, -1.8873501f, 0.9902422f, -1.8873501f, 0.9804844f}, {0.990807f, -1.8884267f, 0.990807f, -1.8884267f, 0.9816141f}, {0.9913465f, -1.8894548f, 0.9913465f, -1.8894548f, 0.9826929f}, {0.9918602f, -1.890434f, 0.9918602f, -1.890434f, 0.9837203f}, {0.9923481f, -1.891364f, 0.9923481f, -1.891364f, 0.9846963f}, {0.9928105f, -1.8922453f, 0.9928105f, -1.8922453f, 0.9856211f}, {0.9932478f, -1.8930787f, 0.9932478f, -1.8930787f, 0.9864956f}, {0.9936605f, -1.8938652f, 0.9936605f, -1.8938652f, 0.9873209f}},
-        {{0.789245f, -1.5189288f, 0.789245f, -1.5189288f, 0.5784901f}, {0.7905363f, -1.5214138f, 0.7905363f, -1.5214138f, 0.5810725f}, {0.7943167f, -1.5286894f, 0.7943167f, -1.5286894f, 0.5886334f}, {0.8003231f, -1.5402489f, 0.8003231f, -1.5402489f, 0.6006461f}, {0.8081658f, -1.5553425f, 0.8081658f, -1.5553425f, 0.6163316f}, {0.8173875f, -1.57309f, 0.8173875f, -1.57309f, 0.6347751f}, {0.8275214f, -1.5925929f, 0.8275214f, -1.5925929f, 0.6550427f}, {0.8381369f, -1.6130228f, 0.8381369f, -1.6130228f, 0.6762738f}, {0.8488695f, -1.6336781f, 0.8488695f, -1.6336781f, 0.697739f}, {0.8594328f, -1.6540076f, 0.8594328f, -1.6540076f, 0.7188656f}, {0.869618f, -1.6736093f, 0.869618f, -1.6736093f, 0.739236f}, {0.8792854f, -1.6922146f, 0.8792854f, -1.6922146f, 0.7585709f}, {0.8883522f, -1.7096639f, 0.8883522f, -1.7096639f, 0.7767044f}, {0.8967792f, -1.7258819f, 0.8967792f, -1.7258819f, 0.7935584f}, {0.9045592f, -1.7408548f, 0.9045592f, -1.7408548f, 0.8091184f}, {0.911707f, -1.754611f, 0.911707f, -1.754611f, 0.823414f}, {0.9182516f, -1.7672063f, 0.9182516f, -1.7672063f, 0.8365032f}, {0.9242302f, -1.7787124f, 0.9242302f, -1.7787124f, 0.8484605f}, {0.9296844f, -1.7892092f, 0.9296844f, -1.7892092f, 0.8593689f}, {0.9346569f, -1.7987788f, 0.9346569f, -1.7987788f, 0.8693137f}, {0.9391896f, -1.8075021f, 0.9391896f, -1.8075021f, 0.8783791f}, {0.9433227f, -1.8154566f, 0.9433227f, -1.8154566f, 0.8866455f}, {0.9470941f, -1.8227147f, 0.9470941f, -1.8227147f, 0.8941882f}, {0.9505384f, -1.8293433f, 0.9505384f, -1.8293433f, 0.9010768f}, {0.9536874f, -1.8354038f, 0.9536874f, -1.8354038f, 0.9073749f}, {0.9565701f, -1.8409516f, 0.9565701f, -1.8409516f, 0.9131402f}, {0.9592125f, -1.846037f, 0.9592125f, -1.846037f, 0.9184251f}, {0.9616381f, -1.8507052f, 0.9616381f, -1.8507052f, 0.9232762f}, {0.9638679f, -1.8549965f, 0.9638679f, -1.8549965f, 0.9277359f}, {0.9659209f, -1.8589474f, 0.9659209f, -1.8589474f, 0.9318417f}, {0.9678137f, -1.8625904f, 0.9678137f, -1.8625904f, 0.9356275f}, {0.9695617f, -1.8659544f, 0.9695617f, -1.8659544f, 0.9391234f}, {0.9711783f, -1.8690655f, 0.9711783f, -1.8690655f, 0.9423566f}, {0.9726756f, -1.8719471f, 0.9726756f, -1.8719471f, 0.9453511f}, {0.9740644f, -1.8746199f, 0.9740644f, -1.8746199f, 0.9481287f}, {0.9753544f, -1.8771026f, 0.9753544f, -1.8771026f, 0.9507088f}, {0.9765544f, -1.879412f, 0.9765544f, -1.879412f, 0.9531087f}, {0.9776721f, -1.8815631f, 0.9776721f, -1.8815631f, 0.9553442f}, {0.9787147f, -1.8835696f, 0.9787147f, -1.8835696f, 0.9574294f}, {0.9796884f, -1.8854435f, 0.9796884f, -1.8854435f, 0.9593768f}, {0.980599f, -1.8871959f, 0.980599f, -1.8871959f, 0.9611979f}, {0.9814515f, -1.8888367f, 0.9814515f, -1.8888367f, 0.9629031f}, {0.9822508f, -1.8903749f, 0.9822508f, -1.8903749f, 0.9645016f}, {0.9830009f, -1.8918186f, 0.9830009f, -1.8918186f, 0.9660018f}, {0.9837058f, -1.8931751f, 0.9837058f, -1.8931751f, 0.9674115f}, {0.9843845f, -1.8944813f, 0.9843845f, -1.8944813f, 0.9687689f}, {0.9850601f, -1.8957815f, 0.9850601f, -1.8957815f, 0.9701202f}, {0.9857307f, -1.8970722f, 0.9857307f, -1.8970722f, 0.9714614f}, {0.9863942f, -1.8983491f, 0.9863942f, -1.8983491f, 0.9727884f}, {0.9870483f, -1.8996078f, 0.9870483f, -1.8996078f, 0.9740965f}, {0.9876906f, -1.9008441f, 0.9876906f, -1.9008441f, 0.9753812f}, {0.9883191f, -1.9020536f, 0.9883191f, -1.9020536f, 0.9766381f}, {0.9889316f, -1.9032324f, 0.9889316f, -1.9032324f, 0.9778632f}, {0.9895264f, -1.9043771f, 0.9895264f, -1.9043771f, 0.9790528f}, {0.9901018f, -1.9054845f, 0.9901018f, -1.9054845f, 0.9802037f}, {0.9906566f, -1.9065522f, 0.9906566f, -1.9065522f, 0.9813132f}, {0.9911896f, -1.9075779f, 0.9911896f, -1.9075779f, 0.9823792f}, {0.9917001f, -1.9085604f, 0.9917001f, -1.9085604f, 0.9834001f}, {0.9921875f, -1.9094985f, 0.9921875f, -1.9094985f, 0.984375f}, {0.9926516f, -1.9103917f, 0.9926516f, -1.9103917f, 0.9853033f}, {0.9930925f, -1.9112402f, 0.9930925f, -1.9112402f, 0.986185f}, {0.9935102f, -1.9120441f, 0.9935102f, -1.9120441f, 0.9870204f}, {0.9939052f, -1.9128042f, 0.9939052f, -1.9128042f, 0.9878103f}, {0.9942779f, -1.9135215f, 0.9942779f, -1.9135215f, 0.9885558f}},
-        {{0.8061219f, -1.563446f, 0.8061219f, -1.563446f, 0.6122438f}, {0.807335f, -1.5657986f, 0.807335f, -1.5657986f, 0.6146699f}, {0.8108848f, -1.5726834f, 0.8108848f, -1.5726834f, 0.6217695f}, {0.8165191f, -1.5836109f, 0.8165191f, -1.5836109f, 0.6330381f}, {0.8238657f, -1.5978593f, 0.8238657f, -1.5978593f, 0.6477313f}, {0.8324891f, -1.6145843f, 0.8324891f, -1.6145843f, 0.6649782f}, {0.8419469f, -1.6329274f, 0.8419469f, -1.6329274f, 0.6838939f}, {0.8518336f, -1.6521022f, 0.8518336f, -1.6521022f, 0.7036672f}, {0.8618078f, -1.6714468f, 0.8618078f, -1.6714468f, 0.7236155f}, {0.8716035f, -1.6904453f, 0.8716035f, -1.6904453f, 0.7432071f}, {0.8810289f, -1.7087256f, 0.8810289f, -1.7087256f, 0.7620579f}, {0.8899574f, -1.726042f, 0.8899574f, -1.726042f, 0.7799147f}, {0.8983153f, -1.7422518f, 0.8983153f, -1.7422518f, 0.7966305f}, {0.9060698f, -1.7572914f, 0.9060698f, -1.7572914f, 0.8121395f}, {0.9132173f, -1.7711538f, 0.9132173f, -1.7711538f, 0.8264345f}, {0.9197742f, -1.7838706f, 0.9197742f, -1.7838706f, 0.8395483f}, {0.9257695f, -1.7954983f, 0.9257695f, -1.7954983f, 0.8515389f}, {0.9312395f, -1.8061072f, 0.9312395f, -1.8061072f, 0.862479f}, {0.9362239f, -1.8157744f, 0.9362239f, -1.8157744f, 0.8724479f}, {0.9407634f, -1.8245785f, 0.9407634f, -1.8245785f, 0.8815267f}, {0.9448975f, -1.8325964f, 0.9448975f, -1.8325964f, 0.8897949f}, {0.9486639f, -1.8399013f, 0.9486639f, -1.8399013f, 0.8973278f}, {0.9520979f, -1.8465614f, 0.9520979f, -1.8465614f, 0.9041958f}, {0.9552318f, -1.8526395f, 0.9552318f, -1.8526395f, 0.9104636f}, {0.9580952f, -1.858193f, 0.9580952f, -1.858193f, 0.9161904f}, {0.9607149f, -1.8632737f, 0.9607149f, -1.8632737f, 0.9214297f}, {0.9631148f, -1.8679283f, 0.9631148f, -1.8679283f, 0.9262296f}, {0.9653167f, -1.8721989f, 0.9653167f, -1.8721989f, 0.9306335f}, {0.96734f, -1.8761229f, 0.96734f, -1.8761229f, 0.93468f}, {0.9692019f, -1.8797341f, 0.9692019f, -1.8797341f, 0.9384039f}, {0.9709181f, -1.8830625f, 0.9709181f, -1.8830625f, 0.9418361f}, {0.9725022f, -1.8861349f, 0.9725022f, -1.8861349f, 0.9450045f}, {0.9739668f, -1.8889755f, 0.9739668f, -1.8889755f, 0.9479337f}, {0.9753229f, -1.8916056f, 0.9753229f, -1.8916056f, 0.9506458f}, {0.9765804f, -1.8940444f, 0.9765804f, -1.8940444f, 0.9531608f}, {0.9777481f, -1.8963092f, 0.9777481f, -1.8963092f, 0.9554963f}, {0.9788341f, -1.8984154f, 0.9788341f, -1.8984154f, 0.9576682f}, {0.9798454f, -1.9003768f, 0.9798454f, -1.9003768f, 0.9596908f}, {0.9807885f, -1.9022059f, 0.9807885f, -1.9022059f, 0.961577f}, {0.9816691f, -1.9039138f, 0.9816691f, -1.9039138f, 0.9633382f}, {0.9824925f, -1.9055107f, 0.9824925f, -1.9055107f, 0.9649849f}, {0.9832633f, -1.9070056f, 0.9832633f, -1.9070056f, 0.9665265f}, {0.9839857f, -1.9084067f, 0.9839857f, -1.9084067f, 0.9679714f}, {0.9846637f, -1.9097216f, 0.9846637f, -1.9097216f, 0.9693273f}, {0.9853006f, -1.9109569f, 0.9853006f, -1.9109569f, 0.9706012f}, {0.9859138f, -1.9121463f, 0.9859138f, -1.9121463f, 0.9718277f}, {0.9865242f, -1.91333f, 0.9865242f, -1.91333f, 0.9730483f}, {0.98713f, -1.9145049f, 0.98713f, -1.9145049f, 0.9742599f}, {0.9877292f, -1.9156671f, 0.9877292f, -1.9156671f, 0.9754584f}, {0.9883198f, -1.9168126f, 0.9883198f, -1.9168126f, 0.9766397f}, {0.9888998f, -1.9179375f, 0.9888998f, -1.9179375f, 0.9777996f}, {0.9894672f, -1.9190379f, 0.9894672f, -1.9190379f, 0.9789344f}, {0.9900201f, -1.9201103f, 0.9900201f, -1.9201103f, 0.9800403f}, {0.990557f, -1.9211515f, 0.990557f, -1.9211515f, 0.981114f}, {0.9910763f, -1.9221587f, 0.9910763f, -1.9221587f, 0.9821526f}, {0.9915769f, -1.9231296f, 0.9915769f, -1.9231296f, 0.9831538f}, {0.9920578f, -1.9240623f, 0.9920578f, -1.9240623f, 0.9841157f}, {0.9925184f, -1.9249556f, 0.9925184f, -1.9249556f, 0.9850368f}, {0.9929581f, -1.9258084f, 0.9929581f, -1.9258084f, 0.9859162f}, {0.9933768f, -1.9266204f, 0.9933768f, -1.9266204f, 0.9867536f}, {0.9937744f, -1.9273916f, 0.9937744f, -1.9273916f, 0.9875488f}, {0.9941511f, -1.9281222f, 0.9941511f, -1.9281222f, 0.9883022f}, {0.9945073f, -1.928813f, 0.9945073f, -1.928813f, 0.9890146f}, {0.9948434f, -1.9294648f, 0.9948434f, -1.9294648f, 0.9896868f}},
-        {{0.8221326f, -1.6043554f, 0.8221326f, -1.6043554f, 0.6442653f}, {0.8232675f, -1.60657f, 0.8232675f, -1.60657f, 0.646535f}, {0.8265868f, -1.6130474f, 0.8265868f, -1.6130474f, 0.6531736f}, {0.8318503f, -1.6233189f, 0.8318503f, -1.6233189f, 0.6637006f}, {0.8387043f, -1.6366942f, 0.8387043f, -1.6366942f, 0.6774086f}, {0.8467364f, -1.6523685f, 0.8467364f, -1.6523685f, 0.6934728f}, {0.8555294f, -1.6695277f, 0.8555294f, -1.6695277f, 0.7110588f}, {0.864703f, -1.6874294f, 0.864703f, -1.6874294f, 0.7294059f}, {0.873939f, -1.7054532f, 0.873939f, -1.7054532f, 0.747878f}, {0.8829916f, -1.7231189f, 0.8829916f, -1.7231189f, 0.7659832f}, {0.8916849f, -1.7400835f, 0.8916849f, -1.7400835f, 0.7833699f}, {0.8999045f, -1.7561237f, 0.8999045f, -1.7561237f, 0.799809f}, {0.9075853f, -1.7711125f, 0.9075853f, -1.7711125f, 0.8151707f}, {0.9147f, -1.7849965f, 0.9147f, -1.7849965f, 0.8294001f}, {0.9212479f, -1.7977744f, 0.9212479f, -1.7977744f, 0.8424958f}, {0.9272464f, -1.8094802f, 0.9272464f, -1.8094802f, 0.8544928f}, {0.9327241f, -1.8201697f, 0.9327241f, -1.8201697f, 0.8654483f}, {0.9377161f, -1.8299114f, 0.9377161f, -1.8299114f, 0.8754323f}, {0.9422602f, -1.838779f, 0.9422602f, -1.838779f, 0.8845204f}, {0.9463946f, -1.846847f, 0.9463946f, -1.846847f, 0.8927892f}, {0.9501565f, -1.8541882f, 0.9501565f, -1.8541882f, 0.900313f}, {0.9535811f, -1.8608712f, 0.9535811f, -1.8608712f, 0.9071623f}, {0.9567012f, -1.8669599f, 0.9567012f, -1.8669599f, 0.9134024f}, {0.9595468f, -1.8725129f, 0.9595468f, -1.8725129f, 0.9190935f}, {0.9621451f, -1.8775835f, 0.9621451f, -1.8775835f, 0.9242903f}, {0.964521f, -1.8822198f, 0.964521f, -1.8822198f, 0.9290419f}, {0.9666965f, -1.8864652f, 0.9666965f, -1.8864652f, 0.9333929f}, {0.9686915f, -1.8903585f, 0.9686915f, -1.8903585f, 0.937383f}, {0.9705239f, -1.8939343f, 0.9705239f, -1.8939343f, 0.9410478f}, {0.9722096f, -1.8972238f, 0.9722096f, -1.8972238f, 0.9444191f}, {0.9737626f, -1.9002546f, 0.9737626f, -1.9002546f, 0.9475253f}, {0.9751958f, -1.9030513f, 0.9751958f, -1.9030513f, 0.9503916f}, {0.9765204f, -1.9056362f, 0.9765204f, -1.9056362f, 0.9530408f}, {0.9777465f, -1.9080289f, 0.9777465f, -1.9080289f, 0.955493f}, {0.9788832f, -1.910247f, 0.9788832f, -1.910247f, 0.9577663f}, {0.9799385f, -1.9123064f, 0.9799385f, -1.9123064f, 0.9598769f}, {0.9809196f, -1.9142211f, 0.9809196f, -1.9142211f, 0.9618392f}, {0.9818331f, -1.9160037f, 0.9818331f, -1.9160037f, 0.9636662f}, {0.9826848f, -1.9176658f, 0.9826848f, -1.9176658f, 0.9653697f}, {0.98348f, -1.9192175f, 0.98348f, -1.9192175f, 0.96696f}, {0.9842233f, -1.9206681f, 0.9842233f, -1.9206681f, 0.9684466f}, {0.9849191f, -1.9220258f, 0.9849191f, -1.9220258f, 0.9698381f}, {0.9855711f, -1.9232982f, 0.9855711f, -1.9232982f, 0.9711422f}, {0.9861829f, -1.9244921f, 0.9861829f, -1.9244921f, 0.9723658f}, {0.9867576f, -1.9256136f, 0.9867576f, -1.9256136f, 0.9735151f}, {0.9873108f, -1.9266932f, 0.9873108f, -1.9266932f, 0.9746216f}, {0.9878614f, -1.9277676f, 0.9878614f, -1.9277676f, 0.9757227f}, {0.9884077f, -1.9288338f, 0.9884077f, -1.9288338f, 0.9768155f}, {0.9889481f, -1.9298884f, 0.9889481f, -1.9298884f, 0.9778963f}, {0.9894807f, -1.9309277f, 0.9894807f, -1.9309277f, 0.9789615f}, {0.9900037f, -1.9319482f, 0.9900037f, -1.9319482f, 0.9800073f}, {0.9905152f, -1.9329464f, 0.9905152f, -1.9329464f, 0.9810303f}, {0.9910136f, -1.933919f, 0.9910136f, -1.933919f, 0.9820272f}, {0.9914975f, -1.9348633f, 0.9914975f, -1.9348633f, 0.9829949f}, {0.9919655f, -1.9357766f, 0.9919655f, -1.9357766f, 0.983931f}, {0.9924166f, -1.9366569f, 0.9924166f, -1.9366569f, 0.9848332f}, {0.9928499f, -1.9375025f, 0.9928499f, -1.9375025f, 0.9856998f}, {0.9932648f, -1.9383122f, 0.9932648f, -1.9383122f, 0.9865297f}, {0.993661f, -1.9390852f, 0.993661f, -1.9390852f, 0.9873219f}, {0.9940381f, -1.9398212f, 0.9940381f, -1.9398212f, 0.9880762f}, {0.9943962f, -1.9405201f, 0.9943962f, -1.9405201f, 0.9887925f}, {0.9947355f, -1.9411822f, 0.9947355f, -1.9411822f, 0.9894711f}, {0.9950563f, -1.9418082f, 0.9950563f, -1.9418082f, 0.9901126f}, {0.995359f, -1.9423988f, 0.995359f, -1.9423988f, 0.9907179f}},
-        {{0.8372235f, -1.6418609f, 0.8372235f, -1.6418609f, 0.674447f}, {0.838281f, -1.6439348f, 0.838281f, -1.6439348f, 0.6765621f}, {0.8413727f, -1.6499978f, 0.8413727f, -1.6499978f, 0.6827454f}, {0.8462709f, -1.6596035f, 0.8462709f, -1.6596035f, 0.6925417f}, {0.8526412f, -1.6720961f, 0.8526412f, -1.6720961f, 0.7052823f}, {0.860095f, -1.6867138f, 0.860095f, -1.6867138f, 0.7201901f}, {0.8682409f, -1.7026884f, 0.8682409f, -1.7026884f, 0.7364818f}, {0.8767236f, -1.7193237f, 0.8767236f, -1.7193237f, 0.7534472f}, {0.885248f, -1.7360406f, 0.885248f, -1.7360406f, 0.7704959f}, {0.8935873f, -1.7523948f, 0.8935873f, -1.7523948f, 0.7871747f}, {0.9015812f, -1.7680713f, 0.9015812f, -1.7680713f, 0.8031623f}, {0.9091263f, -1.7828679f, 0.9091263f, -1.7828679f, 0.8182526f}, {0.9161654f, -1.7966722f, 0.9161654f, -1.7966722f, 0.8323309f}, {0.9226758f, -1.8094396f, 0.9226758f, -1.8094396f, 0.8453517f}, {0.9286592f, -1.8211735f, 0.9286592f, -1.8211735f, 0.8573185f}, {0.9341336f, -1.8319091f, 0.9341336f, -1.8319091f, 0.8682671f}, {0.9391268f, -1.8417012f, 0.9391268f, -1.8417012f, 0.8782536f}, {0.9436724f, -1.8506155f, 0.9436724f, -1.8506155f, 0.8873448f}, {0.9478061f, -1.858722f, 0.9478061f, -1.858722f, 0.8956122f}, {0.9515638f, -1.8660912f, 0.9515638f, -1.8660912f, 0.9031276f}, {0.9549802f, -1.872791f, 0.9549802f, -1.872791f, 0.9099604f}, {0.958088f, -1.8788857f, 0.958088f, -1.8788857f, 0.916176f}, {0.9609176f, -1.8844347f, 0.9609176f, -1.8844347f, 0.9218352f}, {0.9634966f, -1.8894924f, 0.9634966f, -1.8894924f, 0.9269932f}, {0.9658503f, -1.8941081f, 0.9658503f, -1.8941081f, 0.9317006f}, {0.9680013f, -1.8983265f, 0.9680013f, -1.8983265f, 0.9360026f}, {0.9699701f, -1.9021873f, 0.9699701f, -1.9021873f, 0.9399401f}, {0.9717747f, -1.9057264f, 0.9717747f, -1.9057264f, 0.9435495f}, {0.9734316f, -1.9089757f, 0.9734316f, -1.9089757f, 0.9468633f}, {0.9749553f, -1.9119637f, 0.9749553f, -1.9119637f, 0.9499106f}, {0.9763586f, -1.9147158f, 0.9763586f, -1.9147158f, 0.9527173f}, {0.9776533f, -1.9172547f, 0.9776533f, -1.9172547f, 0.9553066f}, {0.9788495f, -1.9196005f, 0.9788495f, -1.9196005f, 0.957699f}, {0.9799565f, -1.9217714f, 0.9799565f, -1.9217714f, 0.9599129f}, {0.9809824f, -1.9237834f, 0.9809824f, -1.9237834f, 0.9619649f}, {0.9819347f, -1.925651f, 0.9819347f, -1.925651f, 0.9638695f}, {0.98282f, -1.927387f, 0.98282f, -1.927387f, 0.96564f}, {0.983644f, -1.929003f, 0.983644f, -1.929003f, 0.9672881f}, {0.9844122f, -1.9305094f, 0.9844122f, -1.9305094f, 0.9688244f}, {0.9851292f, -1.9319156f, 0.9851292f, -1.9319156f, 0.9702584f}, {0.9857994f, -1.9332299f, 0.9857994f, -1.9332299f, 0.9715988f}, {0.9864266f, -1.9344599f, 0.9864266f, -1.9344599f, 0.9728532f}, {0.9870143f, -1.9356124f, 0.9870143f, -1.9356124f, 0.9740286f}, {0.9875657f, -1.9366937f, 0.9875657f, -1.9366937f, 0.9751314f}, {0.9880836f, -1.9377093f, 0.9880836f, -1.9377093f, 0.9761671f}, {0.988582f, -1.9386868f, 0.988582f, -1.9386868f, 0.9771641f}, {0.989078f, -1.9396595f, 0.989078f, -1.9396595f, 0.9781561f}, {0.9895702f, -1.9406248f, 0.9895702f, -1.9406248f, 0.9791405f}, {0.990057f, -1.9415793f, 0.990057f, -1.9415793f, 0.980114f}, {0.9905367f, -1.94252f, 0.9905367f, -1.94252f, 0.9810733f}, {0.9910076f, -1.9434435f, 0.9910076f, -1.9434435f, 0.9820151f}, {0.9914682f, -1.9443467f, 0.9914682f, -1.9443467f, 0.9829363f}, {0.9919169f, -1.9452268f, 0.9919169f, -1.9452268f, 0.9838338f}, {0.9923525f, -1.946081f, 0.9923525f, -1.946081f, 0.984705f}, {0.9927738f, -1.9469072f, 0.9927738f, -1.9469072f, 0.9855476f}, {0.9931798f, -1.9477035f, 0.9931798f, -1.9477035f, 0.9863597f}, {0.9935698f, -1.9484683f, 0.9935698f, -1.9484683f, 0.9871397f}, {0.9939432f, -1.9492006f, 0.9939432f, -1.9492006f, 0.9878865f}, {0.9942997f, -1.9498996f, 0.9942997f, -1.9498996f, 0.9885994f}, {0.994639f, -1.9505651f, 0.994639f, -1.9505651f, 0.9892781f}, {0.9949613f, -1.951197f, 0.9949613f, -1.951197f, 0.9899225f}, {0.9952665f, -1.9517956f, 0.9952665f, -1.9517956f, 0.990533f}, {0.9955551f, -1.9523615f, 0.9955551f, -1.9523615f, 0.9911101f}, {0.9958273f, -1.9528954f, 0.9958273f, -1.9528954f, 0.9916546f}},
-        {{0.8513664f, -1.6761691f, 0.8513664f, -1.6761691f, 0.7027328f}, {0.8523482f, -1.6781021f, 0.8523482f, -1.6781021f, 0.7046965f}, {0.8552174f, -1.6837509f, 0.8552174f, -1.6837509f, 0.7104348f}, {0.8597593f, -1.692693f, 0.8597593f, -1.692693f, 0.7195187f}, {0.8656594f, -1.7043091f, 0.8656594f, -1.7043091f, 0.7313189f}, {0.8725532f, -1.7178816f, 0.8725532f, -1.7178816f, 0.7451065f}, {0.8800749f, -1.7326902f, 0.8800749f, -1.7326902f, 0.7601497f}, {0.8878941f, -1.7480846f, 0.8878941f, -1.7480846f, 0.7757881f}, {0.8957379f, -1.7635275f, 0.8957379f, -1.7635275f, 0.7914757f}, {0.9033981f, -1.778609f, 0.9033981f, -1.778609f, 0.8067962f}, {0.9107286f, -1.7930412f, 0.9107286f, -1.7930412f, 0.8214571f}, {0.9176365f, -1.8066415f, 0.9176365f, -1.8066415f, 0.8352729f}, {0.9240715f, -1.8193107f, 0.9240715f, -1.8193107f, 0.8481429f}, {0.9300148f, -1.8310119f, 0.9300148f, -1.8310119f, 0.8600296f}, {0.93547f, -1.8417521f, 0.93547f, -1.8417521f, 0.8709401f}, {0.9404552f, -1.851567f, 0.9404552f, -1.851567f, 0.8809105f}, {0.9449975f, -1.8605097f, 0.9449975f, -1.8605097f, 0.8899949f}, {0.9491284f, -1.8686428f, 0.9491284f, -1.8686428f, 0.8982568f}, {0.9528817f, -1.8760323f, 0.9528817f, -1.8760323f, 0.9057634f}, {0.9562909f, -1.8827442f, 0.9562909f, -1.8827442f, 0.9125817f}, {0.9593881f, -1.8888419f, 0.9593881f, -1.8888419f, 0.9187761f}, {0.9622036f, -1.8943852f, 0.9622036f, -1.8943852f, 0.9244073f}, {0.9647656f, -1.8994292f, 0.9647656f, -1.8994292f, 0.9295311f}, {0.9670994f, -1.9040239f, 0.9670994f, -1.9040239f, 0.9341987f}, {0.9692282f, -1.9082151f, 0.9692282f, -1.9082151f, 0.9384563f}, {0.9711728f, -1.9120437f, 0.9711728f, -1.9120437f, 0.9423456f}, {0.9729518f, -1.9155463f, 0.9729518f, -1.9155463f, 0.9459037f}, {0.974582f, -1.9187558f, 0.974582f, -1.9187558f, 0.949164f}, {0.9760782f, -1.9217014f, 0.9760782f, -1.9217014f, 0.9521564f}, {0.9774536f, -1.9244093f, 0.9774536f, -1.9244093f, 0.9549071f}, {0.97872f, -1.9269026f, 0.97872f, -1.9269026f, 0.95744f}, {0.979888f, -1.9292022f, 0.979888f, -1.9292022f, 0.959776f}, {0.9809669f, -1.9313263f, 0.9809669f, -1.9313263f, 0.9619338f}, {0.9819651f, -1.9332916f, 0.9819651f, -1.9332916f, 0.9639302f}, {0.98289f, -1.9351126f, 0.98289f, -1.9351126f, 0.9657801f}, {0.9837484f, -1.9368026f, 0.9837484f, -1.9368026f, 0.9674968f}, {0.9845462f, -1.9383732f, 0.9845462f, -1.9383732f, 0.9690923f}, {0.9852887f, -1.939835f, 0.9852887f, -1.939835f, 0.9705773f}, {0.9859807f, -1.9411975f, 0.9859807f, -1.9411975f, 0.9719614f}, {0.9866265f, -1.942469f, 0.9866265f, -1.942469f, 0.9732531f}, {0.9872301f, -1.9436574f, 0.9872301f, -1.9436574f, 0.9744603f}, {0.9877949f, -1.9447693f, 0.9877949f, -1.9447693f, 0.9755899f}, {0.9883241f, -1.9458112f, 0.9883241f, -1.9458112f, 0.9766482f}, {0.9888205f, -1.9467884f, 0.9888205f, -1.9467884f, 0.9776409f}, {0.9892866f, -1.9477062f, 0.9892866f, -1.9477062f, 0.9785733f}, {0.9897353f, -1.9485896f, 0.9897353f, -1.9485896f, 0.9794706f}, {0.9901817f, -1.9494685f, 0.9901817f, -1.9494685f, 0.9803635f}, {0.9906247f, -1.9503405f, 0.9906247f, -1.9503405f, 0.9812493f}, {0.9910626f, -1.9512028f, 0.9910626f, -1.9512028f, 0.9821253f}, {0.9914942f, -1.9520525f, 0.9914942f, -1.9520525f, 0.9829884f}, {0.9919179f, -1.9528866f, 0.9919179f, -1.9528866f, 0.9838357f}, {0.9923322f, -1.9537023f, 0.9923322f, -1.9537023f, 0.9846644f}, {0.9927358f, -1.954497f, 0.9927358f, -1.954497f, 0.9854717f}, {0.9931276f, -1.9552683f, 0.9931276f, -1.9552683f, 0.9862552f}, {0.9935065f, -1.9560142f, 0.9935065f, -1.9560142f, 0.987013f}, {0.9938716f, -1.9567331f, 0.9938716f, -1.9567331f, 0.9877432f}, {0.9942223f, -1.9574235f, 0.9942223f, -1.9574235f, 0.9884445f}, {0.994558f, -1.9580844f, 0.994558f, -1.9580844f, 0.989116f}, {0.9948785f, -1.9587154f, 0.9948785f, -1.9587154f, 0.9897569f}, {0.9951835f, -1.959316f, 0.9951835f, -1.959316f, 0.990367f}, {0.9954732f, -1.9598862f, 0.9954732f, -1.9598862f, 0.9909463f}, {0.9957475f, -1.9604264f, 0.9957475f, -1.9604264f, 0.991495f}, {0.9960069f, -1.960937f, 0.9960069f, -1.960937f, 0.9920137f}, {0.9962516f, -1.9614187f, 0.9962516f, -1.9614187f, 0.9925031f}},
-        {{0.8645542f, -1.7074867f, 0.8645542f, -1.7074867f, 0.7291084f}, {0.8654627f, -1.7092809f, 0.8654627f, -1.7092809f, 0.7309254f}, {0.8681165f, -1.714522f, 0.8681165f, -1.714522f, 0.7362329f}, {0.8723142f, -1.7228125f, 0.8723142f, -1.7228125f, 0.7446283f}, {0.8777612f, -1.7335702f, 0.8777612f, -1.7335702f, 0.7555223f}, {0.8841171f, -1.7461231f, 0.8841171f, -1.7461231f, 0.7682341f}, {0.8910415f, -1.7597987f, 0.8910415f, -1.7597987f, 0.7820829f}, {0.8982283f, -1.7739927f, 0.8982283f, -1.7739927f, 0.7964566f}, {0.9054261f, -1.7882082f, 0.9054261f, -1.7882082f, 0.8108521f}, {0.9124441f, -1.8020687f, 0.9124441f, -1.8020687f, 0.8248881f}, {0.9191495f, -1.8153119f, 0.9191495f, -1.8153119f, 0.8382991f}, {0.9254592f, -1.8277733f, 0.9254592f, -1.8277733f, 0.8509183f}, {0.9313287f, -1.8393657f, 0.9313287f, -1.8393657f, 0.8626574f}, {0.9367429f, -1.8500586f, 0.9367429f, -1.8500586f, 0.8734858f}, {0.9417065f, -1.8598617f, 0.9417065f, -1.8598617f, 0.883413f}, {0.9462376f, -1.8688106f, 0.9462376f, -1.8688106f, 0.8924752f}, {0.950362f, -1.8769563f, 0.950362f, -1.8769563f, 0.9007241f}, {0.9541097f, -1.8843578f, 0.9541097f, -1.8843578f, 0.9082193f}, {0.9575119f, -1.8910772f, 0.9575119f, -1.8910772f, 0.9150238f}, {0.9605999f, -1.8971759f, 0.9605999f, -1.8971759f, 0.9211997f}, {0.9634034f, -1.9027129f, 0.9634034f, -1.9027129f, 0.9268069f}, {0.9659505f, -1.9077434f, 0.9659505f, -1.9077434f, 0.931901f}, {0.9682668f, -1.9123181f, 0.9682668f, -1.9123181f, 0.9365337f}, {0.9703758f, -1.9164834f, 0.9703758f, -1.9164834f, 0.9407517f}, {0.9722987f, -1.9202811f, 0.9722987f, -1.9202811f, 0.9445974f}, {0.9740545f, -1.9237487f, 0.9740545f, -1.9237487f, 0.948109f}, {0.9756602f, -1.9269199f, 0.9756602f, -1.9269199f, 0.9513203f}, {0.9771309f, -1.9298247f, 0.9771309f, -1.9298247f, 0.9542619f}, {0.9784804f, -1.9324898f, 0.9784804f, -1.9324898f, 0.9569608f}, {0.9797205f, -1.9349391f, 0.9797205f, -1.9349391f, 0.9594411f}, {0.9808621f, -1.9371937f, 0.9808621f, -1.9371937f, 0.9617242f}, {0.9819147f, -1.9392725f, 0.9819147f, -1.9392725f, 0.9638294f}, {0.9828868f, -1.9411924f, 0.9828868f, -1.9411924f, 0.9657736f}, {0.983786f, -1.9429683f, 0.983786f, -1.9429683f, 0.9675719f}, {0.984619f, -1.9446135f, 0.984619f, -1.9446135f, 0.969238f}, {0.9853919f, -1.94614f, 0.9853919f, -1.94614f, 0.9707838f}, {0.9861101f, -1.9475585f, 0.9861101f, -1.9475585f, 0.9722203f}, {0.9867785f, -1.9488785f, 0.9867785f, -1.9488785f, 0.973557f}, {0.9874013f, -1.9501086f, 0.9874013f, -1.9501086f, 0.9748026f}, {0.9879825f, -1.9512565f, 0.9879825f, -1.9512565f, 0.9759651f}, {0.9885256f, -1.9523291f, 0.9885256f, -1.9523291f, 0.9770513f}, {0.9890338f, -1.9533326f, 0.9890338f, -1.9533326f, 0.9780675f}, {0.9895098f, -1.9542728f, 0.9895098f, -1.9542728f, 0.9790196f}, {0.9899563f, -1.9551546f, 0.9899563f, -1.9551546f, 0.9799125f}, {0.9903755f, -1.9559826f, 0.9903755f, -1.9559826f, 0.9807511f}, {0.990779f, -1.9567795f, 0.990779f, -1.9567795f, 0.9815581f}, {0.9911805f, -1.9575723f, 0.9911805f, -1.9575723f, 0.9823609f}, {0.9915787f, -1.9583589f, 0.9915787f, -1.9583589f, 0.9831574f}, {0.9919725f, -1.9591366f, 0.9919725f, -1.9591366f, 0.983945f}, {0.9923605f, -1.9599028f, 0.9923605f, -1.9599028f, 0.9847209f}, {0.9927413f, -1.960655f, 0.9927413f, -1.960655f, 0.9854826f}, {0.9931137f, -1.9613904f, 0.9931137f, -1.9613904f, 0.9862274f}, {0.9934765f, -1.9621069f, 0.9934765f, -1.9621069f, 0.9869529f}, {0.9938285f, -1.9628023f, 0.9938285f, -1.9628023f, 0.9876571f}, {0.994169f, -1.9634747f, 0.994169f, -1.9634747f, 0.988338f}, {0.9944971f, -1.9641226f, 0.9944971f, -1.9641226f, 0.9889941f}, {0.9948121f, -1.9647449f, 0.9948121f, -1.9647449f, 0.9896243f}, {0.9951138f, -1.9653405f, 0.9951138f, -1.9653405f, 0.9902275f}, {0.9954016f, -1.9659091f, 0.9954016f, -1.9659091f, 0.9908033f}, {0.9956757f, -1.9664503f, 0.9956757f, -1.9664503f, 0.9913513f}, {0.9959358f, -1.9669642f, 0.9959358f, -1.9669642f, 0.9918717f}, {0.9961823f, -1.9674509f, 0.9961823f, -1.9674509f, 0.9923646f}, {0.9964152f, -1.9679109f, 0.9964152f, -1.9679109f, 0.9928304f}, {0.996635f, -1.9683449f, 0.996635f, -1.9683449f, 0.9932699f}},
-        {{0.8767967f, -1.736019f, 0.8767967f, -1.736019f, 0.7535934f}, {0.8776347f, -1.7376782f, 0.8776347f, -1.7376782f, 0.7552694f}, {0.8800816f, -1.742523f, 0.8800816f, -1.742523f, 0.7601632f}, {0.8839494f, -1.750181f, 0.8839494f, -1.750181f, 0.7678988f}, {0.8889632f, -1.7601082f, 0.8889632f, -1.7601082f, 0.7779264f}, {0.8948065f, -1.7716776f, 0.8948065f, -1.7716776f, 0.789613f}, {0.9011635f, -1.7842643f, 0.9011635f, -1.7842643f, 0.8023271f}, {0.9077519f, -1.7973089f, 0.9077519f, -1.7973089f, 0.8155037f}, {0.9143403f, -1.8103537f, 0.9143403f, -1.8103537f, 0.8286806f}, {0.9207547f, -1.823054f, 0.9207547f, -1.823054f, 0.8415094f}, {0.9268747f, -1.8351713f, 0.9268747f, -1.8351713f, 0.8537494f}, {0.9326256f, -1.8465579f, 0.9326256f, -1.8465579f, 0.8652513f}, {0.9379687f, -1.8571369f, 0.9379687f, -1.8571369f, 0.8759374f}, {0.9428915f, -1.8668838f, 0.9428915f, -1.8668838f, 0.8857829f}, {0.9473997f, -1.87581f, 0.9473997f, -1.87581f, 0.8947995f}, {0.9515111f, -1.8839503f, 0.9515111f, -1.8839503f, 0.9030222f}, {0.9552501f, -1.8913533f, 0.9552501f, -1.8913533f, 0.9105002f}, {0.9586447f, -1.8980745f, 0.9586447f, -1.8980745f, 0.9172895f}, {0.9617242f, -1.9041718f, 0.9617242f, -1.9041718f, 0.9234485f}, {0.9645174f, -1.9097022f, 0.9645174f, -1.9097022f, 0.9290348f}, {0.9670518f, -1.9147201f, 0.9670518f, -1.9147201f, 0.9341035f}, {0.969353f, -1.9192765f, 0.969353f, -1.9192765f, 0.938706f}, {0.9714447f, -1.9234179f, 0.9714447f, -1.9234179f, 0.9428894f}, {0.9733483f, -1.927187f, 0.9733483f, -1.927187f, 0.9466967f}, {0.9750832f, -1.930622f, 0.9750832f, -1.930622f, 0.9501664f}, {0.9766667f, -1.9337573f, 0.9766667f, -1.9337573f, 0.9533335f}, {0.9781144f, -1.9366236f, 0.9781144f, -1.9366236f, 0.9562287f}, {0.97944f, -1.9392482f, 0.97944f, -1.9392482f, 0.95888f}, {0.9806559f, -1.9416556f, 0.9806559f, -1.9416556f, 0.9613117f}, {0.981773f, -1.9438675f, 0.981773f, -1.9438675f, 0.963546f}, {0.9828011f, -1.945903f, 0.9828011f, -1.945903f, 0.9656021f}, {0.9837488f, -1.9477794f, 0.9837488f, -1.9477794f, 0.9674975f}, {0.9846238f, -1.949512f, 0.9846238f, -1.949512f, 0.9692476f}, {0.9854331f, -1.9511143f, 0.9854331f, -1.9511143f, 0.9708661f}, {0.9861827f, -1.9525985f, 0.9861827f, -1.9525985f, 0.9723653f}, {0.9868781f, -1.9539753f, 0.9868781f, -1.9539753f, 0.9737561f}, {0.9875241f, -1.9552545f, 0.9875241f, -1.9552545f, 0.9750483f}, {0.9881253f, -1.9564447f, 0.9881253f, -1.9564447f, 0.9762505f}, {0.9886854f, -1.9575538f, 0.9886854f, -1.9575538f, 0.9773708f}, {0.989208f, -1.9585885f, 0.989208f, -1.9585885f, 0.978416f}, {0.9896963f, -1.9595553f, 0.9896963f, -1.9595553f, 0.9793926f}, {0.9901531f, -1.9604598f, 0.9901531f, -1.9604598f, 0.9803062f}, {0.990581f, -1.961307f, 0.990581f, -1.961307f, 0.981162f}, {0.9909823f, -1.9621016f, 0.9909823f, -1.9621016f, 0.9819646f}, {0.9913591f, -1.9628476f, 0.9913591f, -1.9628476f, 0.9827183f}, {0.9917217f, -1.9635656f, 0.9917217f, -1.9635656f, 0.9834435f}, {0.9920824f, -1.9642798f, 0.9920824f, -1.9642798f, 0.9841649f}, {0.9924403f, -1.9649883f, 0.9924403f, -1.9649883f, 0.9848806f}, {0.9927941f, -1.9656888f, 0.9927941f, -1.9656888f, 0.9855881f}, {0.9931426f, -1.9663788f, 0.9931426f, -1.9663788f, 0.9862852f}, {0.9934847f, -1.9670562f, 0.9934847f, -1.9670562f, 0.9869694f}, {0.9938192f, -1.9677185f, 0.9938192f, -1.9677185f, 0.9876384f}, {0.994145f, -1.9683636f, 0.994145f, -1.9683636f, 0.98829f}, {0.9944612f, -1.9689896f, 0.9944612f, -1.9689896f, 0.9889224f}, {0.994767f, -1.969595f, 0.994767f, -1.969595f, 0.9895339f}, {0.9950616f, -1.9701783f, 0.9950616f, -1.9701783f, 0.9901231f}, {0.9953445f, -1.9707384f, 0.9953445f, -1.9707384f, 0.9906889f}, {0.9956153f, -1.9712746f, 0.9956153f, -1.9712746f, 0.9912305f}, {0.9958737f, -1.9717863f, 0.9958737f, -1.9717863f, 0.9917474f}, {0.9961197f, -1.9722734f, 0.9961197f, -1.9722734f, 0.9922395f}, {0.9963533f, -1.9727358f, 0.9963533f, -1.9727358f, 0.9927066f}, {0.9965745f, -1.9731738f, 0.9965745f, -1.9731738f, 0.993149f}, {0.9967836f, -1.9735878f, 0.9967836f, -1.9735878f, 0.9935671f}, {0.9969808f, -1.9739783f, 0.9969808f, -1.9739783f, 0.9939616f}},
-        {{0.8881167f, -1.7619677f, 0.8881167f, -1.7619677f, 0.7762335f}, {0.8888875f, -1.7634968f, 0.8888875f, -1.7634968f, 0.777775f}, {0.8911373f, -1.7679603f, 0.8911373f, -1.7679603f, 0.7822746f}, {0.8946912f, -1.7750109f, 0.8946912f, -1.7750109f, 0.7893823f}, {0.8992938f, -1.7841422f, 0.8992938f, -1.7841422f, 0.7985875f}, {0.9046517f, -1.794772f, 0.9046517f, -1.794772f, 0.8093034f}, {0.9104733f, -1.8063217f, 0.9104733f, -1.8063217f, 0.8209466f}, {0.9164986f, -1.8182755f, 0.9164986f, -1.8182755f, 0.8329971f}, {0.9225156f, -1.8302129f, 0.9225156f, -1.8302129f, 0.8450313f}, {0.9283658f, -1.8418193f, 0.9283658f, -1.8418193f, 0.8567316f}, {0.9339402f, -1.8528785f, 0.9339402f, -1.8528785f, 0.8678804f}, {0.9391719f, -1.863258f, 0.9391719f, -1.863258f, 0.8783439f}, {0.944027f, -1.8728901f, 0.944027f, -1.8728901f, 0.888054f}, {0.9484954f, -1.8817551f, 0.9484954f, -1.8817551f, 0.8969908f}, {0.9525835f, -1.8898657f, 0.9525835f, -1.8898657f, 0.905167f}, {0.9563084f, -1.8972556f, 0.9563084f, -1.8972556f, 0.9126168f}, {0.9596931f, -1.9039707f, 0.9596931f, -1.9039707f, 0.9193862f}, {0.9627639f, -1.9100629f, 0.9627639f, -1.9100629f, 0.9255277f}, {0.9655477f, -1.9155857f, 0.9655477f, -1.9155857f, 0.9310953f}, {0.9680711f, -1.9205921f, 0.9680711f, -1.9205921f, 0.9361422f}, {0.9703594f, -1.925132f, 0.9703594f, -1.925132f, 0.9407188f}, {0.9724362f, -1.9292522f, 0.9724362f, -1.9292522f, 0.9448724f}, {0.9743231f, -1.9329956f, 0.9743231f, -1.9329956f, 0.9486461f}, {0.9760395f, -1.936401f, 0.9760395f, -1.936401f, 0.9520791f}, {0.9776033f, -1.9395033f, 0.9776033f, -1.9395033f, 0.9552065f}, {0.9790301f, -1.942334f, 0.9790301f, -1.942334f, 0.9580601f}, {0.980334f, -1.944921f, 0.980334f, -1.944921f, 0.9606681f}, {0.9815277f, -1.9472892f, 0.9815277f, -1.9472892f, 0.9630555f}, {0.9826224f, -1.9494609f, 0.9826224f, -1.9494609f, 0.9652447f}, {0.9836278f, -1.9514556f, 0.9836278f, -1.9514556f, 0.9672556f}, {0.9845529f, -1.953291f, 0.9845529f, -1.953291f, 0.9691058f}, {0.9854055f, -1.9549825f, 0.9854055f, -1.9549825f, 0.970811f}, {0.9861926f, -1.956544f, 0.9861926f, -1.956544f, 0.9723852f}, {0.9869204f, -1.9579879f, 0.9869204f, -1.9579879f, 0.9738408f}, {0.9875944f, -1.9593251f, 0.9875944f, -1.9593251f, 0.9751888f}, {0.9882196f, -1.9605655f, 0.9882196f, -1.9605655f, 0.9764392f}, {0.9888004f, -1.9617177f, 0.9888004f, -1.9617177f, 0.9776008f}, {0.9893407f, -1.9627896f, 0.9893407f, -1.9627896f, 0.9786814f}, {0.9898441f, -1.9637883f, 0.9898441f, -1.9637883f, 0.9796881f}, {0.9903137f, -1.96472f, 0.9903137f, -1.96472f, 0.9806274f}, {0.9907524f, -1.9655904f, 0.9907524f, -1.9655904f, 0.9815049f}, {0.9911628f, -1.9664046f, 0.9911628f, -1.9664046f, 0.9823257f}, {0.9915472f, -1.9671673f, 0.9915472f, -1.9671673f, 0.9830944f}, {0.9919077f, -1.9678824f, 0.9919077f, -1.9678824f, 0.9838154f}, {0.9922461f, -1.9685539f, 0.9922461f, -1.9685539f, 0.9844923f}, {0.9925718f, -1.9692f, 0.9925718f, -1.9692f, 0.9851436f}, {0.9928957f, -1.9698426f, 0.9928957f, -1.9698426f, 0.9857915f}, {0.9932171f, -1.9704801f, 0.9932171f, -1.9704801f, 0.9864342f}, {0.9935347f, -1.9711104f, 0.9935347f, -1.9711104f, 0.9870695f}, {0.9938477f, -1.9717312f, 0.9938477f, -1.9717312f, 0.9876954f}, {0.9941548f, -1.9723405f, 0.9941548f, -1.9723405f, 0.9883096f}, {0.9944551f, -1.9729363f, 0.9944551f, -1.9729363f, 0.9889102f}, {0.9947476f, -1.9735165f, 0.9947476f, -1.9735165f, 0.9894951f}, {0.9950314f, -1.9740796f, 0.9950314f, -1.9740796f, 0.9900628f}, {0.9953058f, -1.9746241f, 0.9953058f, -1.9746241f, 0.9906116f}, {0.9955702f, -1.9751486f, 0.9955702f, -1.9751486f, 0.9911404f}, {0.9958241f, -1.9756523f, 0.9958241f, -1.9756523f, 0.9916482f}, {0.9960671f, -1.9761344f, 0.9960671f, -1.9761344f, 0.9921342f}, {0.996299f, -1.9765945f, 0.996299f, -1.9765945f, 0.9925981f}, {0.9965198f, -1.9770325f, 0.9965198f, -1.9770325f, 0.9930395f}, {0.9967293f, -1.9774482f, 0.9967293f, -1.9774482f, 0.9934586f}, {0.9969278f, -1.977842f, 0.9969278f, -1.977842f, 0.9938556f}, {0.9971154f, -1.9782141f, 0.9971154f, -1.9782141f, 0.9942307f}, {0.9972923f, -1.9785651f, 0.9972923f, -1.9785651f, 0.9945846f}},
-        {{0.8985471f, -1.7855282f, 0.8985471f, -1.7855282f, 0.7970942f}, {0.8992542f, -1.7869332f, 0.8992542f, -1.7869332f, 0.7985083f}, {0.9013174f, -1.7910331f, 0.9013174f, -1.7910331f, 0.8026348f}, {0.9045745f, -1.7975054f, 0.9045745f, -1.7975054f, 0.809149f}, {0.9087892f, -1.8058805f, 0.9087892f, -1.8058805f, 0.8175784f}, {0.9136904f, -1.8156199f, 0.9136904f, -1.8156199f, 0.8273808f}, {0.9190096f, -1.8261897f, 0.9190096f, -1.8261897f, 0.8380191f}, {0.9245079f, -1.8371157f, 0.9245079f, -1.8371157f, 0.8490159f}, {0.9299919f, -1.8480131f, 0.9299919f, -1.8480131f, 0.8599839f}, {0.9353172f, -1.8585952f, 0.9353172f, -1.8585952f, 0.8706345f}, {0.9403854f, -1.8686663f, 0.9403854f, -1.8686663f, 0.8807708f}, {0.9451367f, -1.8781077f, 0.9451367f, -1.8781077f, 0.8902734f}, {0.9495413f, -1.8868601f, 0.9495413f, -1.8868601f, 0.8990825f}, {0.9535911f, -1.8949076f, 0.9535911f, -1.8949076f, 0.9071821f}, {0.9572929f, -1.9022637f, 0.9572929f, -1.9022637f, 0.9145859f}, {0.9606631f, -1.9089607f, 0.9606631f, -1.9089607f, 0.9213263f}, {0.9637233f, -1.9150417f, 0.9637233f, -1.9150417f, 0.9274466f}, {0.9664977f, -1.9205548f, 0.9664977f, -1.9205548f, 0.9329955f}, {0.9690114f, -1.9255497f, 0.9690114f, -1.9255497f, 0.9380227f}, {0.9712886f, -1.930075f, 0.9712886f, -1.930075f, 0.9425773f}, {0.9733527f, -1.9341766f, 0.9733527f, -1.9341766f, 0.9467055f}, {0.9752252f, -1.9378973f, 0.9752252f, -1.9378973f, 0.9504503f}, {0.9769256f, -1.9412763f, 0.9769256f, -1.9412763f, 0.9538512f}, {0.978472f, -1.9443491f, 0.978472f, -1.9443491f, 0.9569439f}, {0.9798802f, -1.9471475f, 0.9798802f, -1.9471475f, 0.9597604f}, {0.9811648f, -1.9497001f, 0.9811648f, -1.9497001f, 0.9623295f}, {0.9823384f, -1.9520322f, 0.9823384f, -1.9520322f, 0.9646768f}, {0.9834125f, -1.9541666f, 0.9834125f, -1.9541666f, 0.966825f}, {0.9843972f, -1.9561233f, 0.9843972f, -1.9561233f, 0.9687944f}, {0.9853015f, -1.9579202f, 0.9853015f, -1.9579202f, 0.9706029f}, {0.9861333f, -1.9595733f, 0.9861333f, -1.9595733f, 0.9722667f}, {0.9868999f, -1.9610965f, 0.9868999f, -1.9610965f, 0.9737998f}, {0.9876074f, -1.9625024f, 0.9876074f, -1.9625024f, 0.9752148f}, {0.9882615f, -1.9638022f, 0.9882615f, -1.9638022f, 0.976523f}, {0.9888672f, -1.9650058f, 0.9888672f, -1.9650058f, 0.9777344f}, {0.9894289f, -1.966122f, 0.9894289f, -1.966122f, 0.9788578f}, {0.9899507f, -1.9671588f, 0.9899507f, -1.9671588f, 0.9799014f}, {0.990436f, -1.9681233f, 0.990436f, -1.9681233f, 0.9808721f}, {0.9908882f, -1.9690217f, 0.9908882f, -1.9690217f, 0.9817763f}, {0.9913099f, -1.9698598f, 0.9913099f, -1.9698598f, 0.9826199f}, {0.9917039f, -1.9706427f, 0.9917039f, -1.9706427f, 0.9834078f}, {0.9920724f, -1.971375f, 0.9920724f, -1.971375f, 0.9841449f}, {0.9924176f, -1.9720608f, 0.9924176f, -1.9720608f, 0.9848351f}, {0.9927412f, -1.9727039f, 0.9927412f, -1.9727039f, 0.9854824f}, {0.993045f, -1.9733077f, 0.993045f, -1.9733077f, 0.9860901f}, {0.9933374f, -1.9738886f, 0.9933374f, -1.9738886f, 0.9866747f}, {0.9936281f, -1.9744664f, 0.9936281f, -1.9744664f, 0.9872563f}, {0.9939165f, -1.9750395f, 0.9939165f, -1.9750395f, 0.9878331f}, {0.9942016f, -1.975606f, 0.9942016f, -1.975606f, 0.9884033f}, {0.9944825f, -1.9761641f, 0.9944825f, -1.9761641f, 0.9889649f}, {0.9947581f, -1.9767117f, 0.9947581f, -1.9767117f, 0.9895162f}, {0.9950275f, -1.9772472f, 0.9950275f, -1.9772472f, 0.990055f}, {0.99529f, -1.9777686f, 0.99529f, -1.9777686f, 0.9905799f}, {0.9955446f, -1.9782746f, 0.9955446f, -1.9782746f, 0.9910892f}, {0.9957908f, -1.9787639f, 0.9957908f, -1.9787639f, 0.9915816f}, {0.996028f, -1.9792352f, 0.996028f, -1.9792352f, 0.9920559f}, {0.9962557f, -1.9796877f, 0.9962557f, -1.9796877f, 0.9925114f}, {0.9964737f, -1.9801209f, 0.9964737f, -1.9801209f, 0.9929474f}, {0.9966817f, -1.9805343f, 0.9966817f, -1.9805343f, 0.9933635f}, {0.9968797f, -1.9809277f, 0.9968797f, -1.9809277f, 0.9937594f}, {0.9970677f, -1.9813012f, 0.9970677f, -1.9813012f, 0.9941353f}, {0.9972457f, -1.9816549f, 0.9972457f, -1.9816549f, 0.9944913f}, {0.9974139f, -1.9819891f, 0.9974139f, -1.9819891f, 0.9948277f}, {0.9975726f, -1.9823045f, 0.9975726f, -1.9823045f, 0.9951451f}},
-        {{0.9081278f, -1.8068889f, 0.9081278f, -1.8068889f, 0.8162556f}, {0.9087748f, -1.8081764f, 0.9087748f, -1.8081764f, 0.8175497f}, {0.9106625f, -1.8119321f, 0.9106625f, -1.8119321f, 0.8213249f}, {0.9136407f, -1.8178579f, 0.9136407f, -1.8178579f, 0.8272813f}, {0.9174915f, -1.8255197f, 0.9174915f, -1.8255197f, 0.8349829f}, {0.9219652f, -1.8344211f, 0.9219652f, -1.8344211f, 0.8439304f}, {0.9268153f, -1.8440711f, 0.9268153f, -1.8440711f, 0.8536305f}, {0.931823f, -1.854035f, 0.931823f, -1.854035f, 0.8636461f}, {0.936812f, -1.8639614f, 0.936812f, -1.8639614f, 0.8736239f}, {0.941651f, -1.8735896f, 0.941651f, -1.8735896f, 0.883302f}, {0.9462514f, -1.882743f, 0.9462514f, -1.882743f, 0.8925029f}, {0.9505598f, -1.8913153f, 0.9505598f, -1.8913153f, 0.9011195f}, {0.9545499f, -1.8992544f, 0.9545499f, -1.8992544f, 0.9090998f}, {0.9582154f, -1.9065476f, 0.9582154f, -1.9065476f, 0.9164308f}, {0.9615633f, -1.9132088f, 0.9615633f, -1.9132088f, 0.9231266f}, {0.9646089f, -1.9192687f, 0.9646089f, -1.9192687f, 0.9292179f}, {0.9673726f, -1.9247675f, 0.9673726f, -1.9247675f, 0.9347452f}, {0.9698766f, -1.9297498f, 0.9698766f, -1.9297498f, 0.9397533f}, {0.9721441f, -1.9342612f, 0.9721441f, -1.9342612f, 0.9442881f}, {0.9741972f, -1.9383464f, 0.9741972f, -1.9383464f, 0.9483945f}, {0.9760574f, -1.9420475f, 0.9760574f, -1.9420475f, 0.9521148f}, {0.9777441f, -1.9454036f, 0.9777441f, -1.9454036f, 0.9554882f}, {0.9792754f, -1.9484502f, 0.9792754f, -1.9484502f, 0.9585507f}, {0.9806673f, -1.9512199f, 0.9806673f, -1.9512199f, 0.9613347f}, {0.9819346f, -1.9537414f, 0.9819346f, -1.9537414f, 0.9638693f}, {0.9830903f, -1.9560408f, 0.9830903f, -1.9560408f, 0.9661806f}, {0.9841459f, -1.958141f, 0.9841459f, -1.958141f, 0.9682917f}, {0.9851117f, -1.9600628f, 0.9851117f, -1.9600628f, 0.9702234f}, {0.985997f, -1.9618242f, 0.985997f, -1.9618242f, 0.9719939f}, {0.9868098f, -1.9634414f, 0.9868098f, -1.9634414f, 0.9736196f}, {0.9875574f, -1.9649289f, 0.9875574f, -1.9649289f, 0.9751147f}, {0.9882461f, -1.9662993f, 0.9882461f, -1.9662993f, 0.9764923f}, {0.9888818f, -1.967564f, 0.9888818f, -1.967564f, 0.9777635f}, {0.9894693f, -1.968733f, 0.9894693f, -1.968733f, 0.9789386f}, {0.9900133f, -1.9698154f, 0.9900133f, -1.9698154f, 0.9800266f}, {0.9905178f, -1.9708191f, 0.9905178f, -1.9708191f, 0.9810355f}, {0.9909863f, -1.9717513f, 0.9909863f, -1.9717513f, 0.9819725f}, {0.991422f, -1.9726183f, 0.991422f, -1.9726183f, 0.9828441f}, {0.9918279f, -1.973426f, 0.9918279f, -1.973426f, 0.9836559f}, {0.9922066f, -1.9741793f, 0.9922066f, -1.9741793f, 0.9844131f}, {0.9925602f, -1.9748829f, 0.9925602f, -1.9748829f, 0.9851204f}, {0.9928909f, -1.975541f, 0.9928909f, -1.975541f, 0.9857819f}, {0.9932007f, -1.9761573f, 0.9932007f, -1.9761573f, 0.9864014f}, {0.9934911f, -1.9767351f, 0.9934911f, -1.9767351f, 0.9869822f}, {0.9937638f, -1.9772776f, 0.9937638f, -1.9772776f, 0.9875275f}, {0.9940261f, -1.9777995f, 0.9940261f, -1.9777995f, 0.9880521f}, {0.9942869f, -1.9783186f, 0.9942869f, -1.9783186f, 0.9885739f}, {0.9945457f, -1.9788334f, 0.9945457f, -1.9788334f, 0.9890914f}, {0.9948015f, -1.9793423f, 0.9948015f, -1.9793423f, 0.9896029f}, {0.9950534f, -1.9798436f, 0.9950534f, -1.9798436f, 0.9901068f}, {0.9953006f, -1.9803355f, 0.9953006f, -1.9803355f, 0.9906012f}, {0.9955423f, -1.9808164f, 0.9955423f, -1.9808164f, 0.9910846f}, {0.9957777f, -1.9812847f, 0.9957777f, -1.9812847f, 0.9915554f}, {0.9960061f, -1.9817391f, 0.9960061f, -1.9817391f, 0.9920121f}, {0.9962268f, -1.9821784f, 0.9962268f, -1.9821784f, 0.9924537f}, {0.9964395f, -1.9826016f, 0.9964395f, -1.9826016f, 0.9928791f}, {0.9966438f, -1.983008f, 0.9966438f, -1.983008f, 0.9932875f}, {0.9968392f, -1.9833969f, 0.9968392f, -1.9833969f, 0.9936785f}, {0.9970258f, -1.983768f, 0.9970258f, -1.983768f, 0.9940515f}, {0.9972033f, -1.9841212f, 0.9972033f, -1.9841212f, 0.9944066f}, {0.9973718f, -1.9844565f, 0.9973718f, -1.9844565f, 0.9947436f}, {0.9975314f, -1.984774f, 0.9975314f, -1.984774f, 0.9950627f}, {0.9976822f, -1.985074f, 0.9976822f, -1.985074f, 0.9953644f}, {0.9978244f, -1.9853571f, 0.9978244f, -1.9853571f, 0.9956489f}},
-        {{0.9169035f, -1.8262294f, 0.9169035f, -1.8262294f, 0.8338071f}, {0.9174944f, -1.8274063f, 0.9174944f, -1.8274063f, 0.8349888f}, {0.9192176f, -1.8308385f, 0.9192176f, -1.8308385f, 0.8384353f}, {0.9219351f, -1.8362509f, 0.9219351f, -1.8362509f, 0.8438702f}, {0.9254462f, -1.8432442f, 0.9254462f, -1.8432442f, 0.8508924f}, {0.9295218f, -1.8513616f, 0.9295218f, -1.8513616f, 0.8590436f}, {0.9339358f, -1.8601532f, 0.9339358f, -1.8601532f, 0.8678716f}, {0.9384887f, -1.8692213f, 0.9384887f, -1.8692213f, 0.8769774f}, {0.9430197f, -1.8782459f, 0.9430197f, -1.8782459f, 0.8860394f}, {0.94741f, -1.8869903f, 0.94741f, -1.8869903f, 0.89482f}, {0.9515797f, -1.8952952f, 0.9515797f, -1.8952952f, 0.9031595f}, {0.9554811f, -1.9030656f, 0.9554811f, -1.9030656f, 0.9109621f}, {0.9590911f, -1.9102559f, 0.9590911f, -1.9102559f, 0.9181822f}, {0.9624048f, -1.9168559f, 0.9624048f, -1.9168559f, 0.9248096f}, {0.9654291f, -1.9228795f, 0.9654291f, -1.9228795f, 0.9308582f}, {0.9681786f, -1.9283558f, 0.9681786f, -1.9283558f, 0.9363572f}, {0.970672f, -1.9333219f, 0.970672f, -1.9333219f, 0.9413439f}, {0.9729299f, -1.9378191f, 0.9729299f, -1.9378191f, 0.9458598f}, {0.9749734f, -1.9418893f, 0.9749734f, -1.9418893f, 0.9499468f}, {0.976823f, -1.9455732f, 0.976823f, -1.9455732f, 0.9536461f}, {0.9784981f, -1.9489094f, 0.9784981f, -1.9489094f, 0.9569961f}, {0.9800164f, -1.9519335f, 0.9800164f, -1.9519335f, 0.9600327f}, {0.9813942f, -1.9546778f, 0.9813942f, -1.9546778f, 0.9627885f}, {0.9826464f, -1.9571719f, 0.9826464f, -1.9571719f, 0.9652929f}, {0.9837861f, -1.9594419f, 0.9837861f, -1.9594419f, 0.9675723f}, {0.9848252f, -1.9615113f, 0.9848252f, -1.9615113f, 0.9696503f}, {0.985774f, -1.9634012f, 0.985774f, -1.9634012f, 0.971548f}, {0.986642f, -1.96513f, 0.986642f, -1.96513f, 0.973284f}, {0.9874375f, -1.9667143f, 0.9874375f, -1.9667143f, 0.9748749f}, {0.9881677f, -1.9681687f, 0.9881677f, -1.9681687f, 0.9763353f}, {0.9888392f, -1.9695061f, 0.9888392f, -1.9695061f, 0.9776783f}, {0.9894577f, -1.9707382f, 0.9894577f, -1.9707382f, 0.9789154f}, {0.9900285f, -1.971875f, 0.9900285f, -1.971875f, 0.980057f}, {0.990556f, -1.9729257f, 0.990556f, -1.9729257f, 0.981112f}, {0.9910444f, -1.9738984f, 0.9910444f, -1.9738984f, 0.9820888f}, {0.9914972f, -1.9748003f, 0.9914972f, -1.9748003f, 0.9829944f}, {0.9919177f, -1.9756378f, 0.9919177f, -1.9756378f, 0.9838354f}, {0.9923088f, -1.9764168f, 0.9923088f, -1.9764168f, 0.9846176f}, {0.9926731f, -1.9771423f, 0.9926731f, -1.9771423f, 0.9853461f}, {0.9930128f, -1.9778189f, 0.9930128f, -1.9778189f, 0.9860256f}, {0.9933301f, -1.9784509f, 0.9933301f, -1.9784509f, 0.9866602f}, {0.9936268f, -1.9790419f, 0.9936268f, -1.9790419f, 0.9872537f}, {0.9939047f, -1.9795954f, 0.9939047f, -1.9795954f, 0.9878094f}, {0.9941652f, -1.9801143f, 0.9941652f, -1.9801143f, 0.9883305f}, {0.9944098f, -1.9806014f, 0.9944098f, -1.9806014f, 0.9888196f}, {0.9946451f, -1.98107f, 0.9946451f, -1.98107f, 0.9892902f}, {0.9948791f, -1.9815361f, 0.9948791f, -1.9815361f, 0.9897581f}, {0.9951111f, -1.9819983f, 0.9951111f, -1.9819983f, 0.9902223f}, {0.9953405f, -1.9824551f, 0.9953405f, -1.9824551f, 0.990681f}, {0.9955664f, -1.9829051f, 0.9955664f, -1.9829051f, 0.9911329f}, {0.9957881f, -1.9833467f, 0.9957881f, -1.9833467f, 0.9915762f}, {0.9960048f, -1.9837783f, 0.9960048f, -1.9837783f, 0.9920097f}, {0.9962159f, -1.9841986f, 0.9962159f, -1.9841986f, 0.9924318f}, {0.9964206f, -1.9846065f, 0.9964206f, -1.9846065f, 0.9928413f}, {0.9966186f, -1.9850007f, 0.9966186f, -1.9850007f, 0.9932372f}, {0.9968093f, -1.9853805f, 0.9968093f, -1.9853805f, 0.9936186f}, {0.9969924f, -1.9857452f, 0.9969924f, -1.9857452f, 0.9939847f}, {0.9971676f, -1.9860942f, 0.9971676f, -1.9860942f, 0.9943352f}, {0.9973348f, -1.9864272f, 0.9973348f, -1.9864272f, 0.9946696f}, {0.9974939f, -1.9867441f, 0.9974939f, -1.9867441f, 0.9949878f}, {0.9976449f, -1.987045f, 0.9976449f, -1.987045f, 0.9952899f}, {0.997788f, -1.9873298f, 0.997788f, -1.9873298f, 0.995576f}, {0.9979231f, -1.9875991f, 0.9979231f, -1.9875991f, 0.9958463f}, {0.9980506f, -1.987853f, 0.9980506f, -1.987853f, 0.9961013f}},
-        {{0.9249221f, -1.8437197f, 0.9249221f, -1.8437197f, 0.8498443f}, {0.9254606f, -1.8447931f, 0.9254606f, -1.8447931f, 0.8509212f}, {0.9270307f, -1.8479228f, 0.9270307f, -1.8479228f, 0.8540614f}, {0.9295055f, -1.852856f, 0.9295055f, -1.852856f, 0.859011f}, {0.932701f, -1.8592258f, 0.932701f, -1.8592258f, 0.8654019f}, {0.9364072f, -1.8666138f, 0.9364072f, -1.8666138f, 0.8728144f}, {0.9404176f, -1.8746081f, 0.9404176f, -1.8746081f, 0.8808353f}, {0.9445503f, -1.8828461f, 0.9445503f, -1.8828461f, 0.8891007f}, {0.9486592f, -1.8910367f, 0.9486592f, -1.8910367f, 0.8973185f}, {0.9526369f, -1.8989657f, 0.9526369f, -1.8989657f, 0.9052738f}, {0.9564112f, -1.9064894f, 0.9564112f, -1.9064894f, 0.9128225f}, {0.9599397f, -1.9135229f, 0.9599397f, -1.9135229f, 0.9198793f}, {0.9632021f, -1.9200261f, 0.9632021f, -1.9200261f, 0.9264042f}, {0.9661945f, -1.9259912f, 0.9661945f, -1.9259912f, 0.932389f}, {0.9689238f, -1.9314317f, 0.9689238f, -1.9314317f, 0.9378476f}, {0.9714036f, -1.9363748f, 0.9714036f, -1.9363748f, 0.9428072f}, {0.9736511f, -1.940855f, 0.9736511f, -1.940855f, 0.9473023f}, {0.9756854f, -1.9449102f, 0.9756854f, -1.9449102f, 0.9513709f}, {0.9775258f, -1.9485786f, 0.9775258f, -1.9485786f, 0.9550515f}, {0.9791908f, -1.9518976f, 0.9791908f, -1.9518976f, 0.9583815f}, {0.9806981f, -1.9549022f, 0.9806981f, -1.9549022f, 0.9613961f}, {0.9820639f, -1.9576248f, 0.9820639f, -1.9576248f, 0.9641277f}, {0.983303f, -1.9600948f, 0.983303f, -1.9600948f, 0.9666059f}, {0.9844287f, -1.9623389f, 0.9844287f, -1.9623389f, 0.9688575f}, {0.9854531f, -1.9643808f, 0.9854531f, -1.9643808f, 0.9709063f}, {0.9863868f, -1.966242f, 0.9863868f, -1.966242f, 0.9727736f}, {0.9872393f, -1.9679413f, 0.9872393f, -1.9679413f, 0.9744786f}, {0.988019f, -1.9694955f, 0.988019f, -1.9694955f, 0.9760379f}, {0.9887333f, -1.9709196f, 0.9887333f, -1.9709196f, 0.9774667f}, {0.989389f, -1.9722266f, 0.989389f, -1.9722266f, 0.9787781f}, {0.9899919f, -1.9734284f, 0.9899919f, -1.9734284f, 0.9799838f}, {0.9905472f, -1.9745353f, 0.9905472f, -1.9745353f, 0.9810944f}, {0.9910595f, -1.9755565f, 0.9910595f, -1.9755565f, 0.982119f}, {0.991533f, -1.9765003f, 0.991533f, -1.9765003f, 0.9830659f}, {0.9919712f, -1.9773739f, 0.9919712f, -1.9773739f, 0.9839424f}, {0.9923775f, -1.9781838f, 0.9923775f, -1.9781838f, 0.9847551f}, {0.9927548f, -1.9789359f, 0.9927548f, -1.9789359f, 0.9855097f}, {0.9931057f, -1.9796353f, 0.9931057f, -1.9796353f, 0.9862114f}, {0.9934325f, -1.9802867f, 0.9934325f, -1.9802867f, 0.9868649f}, {0.9937372f, -1.9808941f, 0.9937372f, -1.9808941f, 0.9874744f}, {0.9940218f, -1.9814615f, 0.9940218f, -1.9814615f, 0.9880436f}, {0.9942879f, -1.981992f, 0.9942879f, -1.981992f, 0.9885759f}, {0.9945372f, -1.9824888f, 0.9945372f, -1.9824888f, 0.9890743f}, {0.9947708f, -1.9829545f, 0.9947708f, -1.9829545f, 0.9895416f}, {0.9949901f, -1.9833917f, 0.9949901f, -1.9833917f, 0.9899802f}, {0.9952011f, -1.9838122f, 0.9952011f, -1.9838122f, 0.9904022f}, {0.9954109f, -1.9842304f, 0.9954109f, -1.9842304f, 0.9908218f}, {0.995619f, -1.9846452f, 0.995619f, -1.9846452f, 0.9912379f}, {0.9958246f, -1.9850551f, 0.9958246f, -1.9850551f, 0.9916492f}, {0.9960272f, -1.9854589f, 0.9960272f, -1.9854589f, 0.9920543f}, {0.9962259f, -1.985855f, 0.9962259f, -1.985855f, 0.9924518f}, {0.9964202f, -1.9862423f, 0.9964202f, -1.9862423f, 0.9928403f}, {0.9966093f, -1.9866194f, 0.9966093f, -1.9866194f, 0.9932187f}, {0.9967929f, -1.9869853f, 0.9967929f, -1.9869853f, 0.9935858f}, {0.9969703f, -1.987339f, 0.9969703f, -1.987339f, 0.9939406f}, {0.9971412f, -1.9876796f, 0.9971412f, -1.9876796f, 0.9942824f}, {0.9973053f, -1.9880067f, 0.9973053f, -1.9880067f, 0.9946106f}, {0.9974623f, -1.9883198f, 0.9974623f, -1.9883198f, 0.9949247f}, {0.9976122f, -1.9886185f, 0.9976122f, -1.9886185f, 0.9952244f}, {0.9977548f, -1.9889027f, 0.9977548f, -1.9889027f, 0.9955096f}, {0.9978901f, -1.9891725f, 0.9978901f, -1.9891725f, 0.9957803f}, {0.9980183f, -1.989428f, 0.9980183f, -1.989428f, 0.9960366f}, {0.9981394f, -1.9896694f, 0.9981394f, -1.9896694f, 0.9962788f}, {0.9982537f, -1.9898971f, 0.9982537f, -1.9898971f, 0.9965073f}},
-        {{0.9322327f, -1.8595196f, 0.9322327f, -1.8595196f, 0.8644655f}, {0.9327226f, -1.8604967f, 0.9327226f, -1.8604967f, 0.8654452f}, {0.9341506f, -1.8633451f, 0.9341506f, -1.8633451f, 0.8683012f}, {0.9364005f, -1.867833f, 0.9364005f, -1.867833f, 0.872801f}, {0.9393038f, -1.8736243f, 0.9393038f, -1.8736243f, 0.8786077f}, {0.9426688f, -1.8803363f, 0.9426688f, -1.8803363f, 0.8853376f}, {0.946307f, -1.8875934f, 0.946307f, -1.8875934f, 0.892614f}, {0.9500529f, -1.8950654f, 0.9500529f, -1.8950654f, 0.9001058f}, {0.953774f, -1.9024878f, 0.953774f, -1.9024878f, 0.907548f}, {0.9573732f, -1.9096671f, 0.9573732f, -1.9096671f, 0.9147464f}, {0.9607856f, -1.9164739f, 0.9607856f, -1.9164739f, 0.9215713f}, {0.9639733f, -1.9228323f, 0.9639733f, -1.9228323f, 0.9279466f}, {0.9669186f, -1.9287072f, 0.9669186f, -1.9287072f, 0.9338371f}, {0.9696183f, -1.9340924f, 0.9696183f, -1.9340924f, 0.9392366f}, {0.9720792f, -1.939001f, 0.9720792f, -1.939001f, 0.9441583f}, {0.9743138f, -1.9434585f, 0.9743138f, -1.9434585f, 0.9486276f}, {0.9763382f, -1.9474965f, 0.9763382f, -1.9474965f, 0.9526764f}, {0.9781697f, -1.9511498f, 0.9781697f, -1.9511498f, 0.9563394f}, {0.9798259f, -1.9544534f, 0.9798259f, -1.9544534f, 0.9596518f}, {0.9813237f, -1.9574412f, 0.9813237f, -1.9574412f, 0.9626475f}, {0.9826793f, -1.960145f, 0.9826793f, -1.960145f, 0.9653585f}, {0.9839072f, -1.9625943f, 0.9839072f, -1.9625943f, 0.9678144f}, {0.9850209f, -1.9648158f, 0.9850209f, -1.9648158f, 0.9700418f}, {0.9860325f, -1.9668336f, 0.9860325f, -1.9668336f, 0.9720649f}, {0.9869528f, -1.9686693f, 0.9869528f, -1.9686693f, 0.9739055f}, {0.9877914f, -1.9703421f, 0.9877914f, -1.9703421f, 0.9755828f}, {0.9885569f, -1.9718691f, 0.9885569f, -1.9718691f, 0.9771138f}, {0.989257f, -1.9732655f, 0.989257f, -1.9732655f, 0.9785139f}, {0.9898983f, -1.9745447f, 0.9898983f, -1.9745447f, 0.9797966f}, {0.9904868f, -1.9757187f, 0.9904868f, -1.9757187f, 0.9809737f}, {0.9910279f, -1.976798f, 0.9910279f, -1.976798f, 0.9820558f}, {0.9915262f, -1.9777919f, 0.9915262f, -1.9777919f, 0.9830524f}, {0.9919859f, -1.9787089f, 0.9919859f, -1.9787089f, 0.9839718f}, {0.9924107f, -1.9795561f, 0.9924107f, -1.9795561f, 0.9848213f}, {0.9928038f, -1.9803404f, 0.9928038f, -1.9803404f, 0.9856076f}, {0.9931683f, -1.9810674f, 0.9931683f, -1.9810674f, 0.9863366f}, {0.9935067f, -1.9817424f, 0.9935067f, -1.9817424f, 0.9870134f}, {0.9938214f, -1.9823701f, 0.9938214f, -1.9823701f, 0.9876427f}, {0.9941144f, -1.9829546f, 0.9941144f, -1.9829546f, 0.9882288f}, {0.9943877f, -1.9834997f, 0.9943877f, -1.9834997f, 0.9887754f}, {0.9946429f, -1.9840088f, 0.9946429f, -1.9840088f, 0.9892858f}, {0.9948815f, -1.9844848f, 0.9948815f, -1.9844848f, 0.9897631f}, {0.995105f, -1.9849305f, 0.995105f, -1.9849305f, 0.9902099f}, {0.9953144f, -1.9853483f, 0.9953144f, -1.9853483f, 0.9906289f}, {0.9955111f, -1.9857405f, 0.9955111f, -1.9857405f, 0.9910221f}, {0.9957002f, -1.9861178f, 0.9957002f, -1.9861178f, 0.9914004f}, {0.9958883f, -1.9864929f, 0.9958883f, -1.9864929f, 0.9917765f}, {0.9960748f, -1.9868649f, 0.9960748f, -1.9868649f, 0.9921495f}, {0.9962591f, -1.9872326f, 0.9962591f, -1.9872326f, 0.9925182f}, {0.9964406f, -1.9875948f, 0.9964406f, -1.9875948f, 0.9928813f}, {0.9966188f, -1.9879501f, 0.9966188f, -1.9879501f, 0.9932375f}, {0.9967929f, -1.9882974f, 0.9967929f, -1.9882974f, 0.9935858f}, {0.9969624f, -1.9886355f, 0.9969624f, -1.9886355f, 0.9939249f}, {0.9971269f, -1.9889636f, 0.9971269f, -1.9889636f, 0.9942538f}, {0.9972859f, -1.9892808f, 0.9972859f, -1.9892808f, 0.9945718f}, {0.9974391f, -1.9895863f, 0.9974391f, -1.9895863f, 0.9948781f}, {0.9975861f, -1.9898796f, 0.9975861f, -1.9898796f, 0.9951722f}, {0.9977268f, -1.9901602f, 0.9977268f, -1.9901602f, 0.9954536f}, {0.9978611f, -1.9904281f, 0.9978611f, -1.9904281f, 0.9957221f}, {0.9979888f, -1.9906829f, 0.9979888f, -1.9906829f, 0.9959777f}, {0.9981101f, -1.9909248f, 0.9981101f, -1.9909248f, 0.9962202f}, {0.9982249f, -1.9911538f, 0.9982249f, -1.9911538f, 0.9964499f}, {0.9983334f, -1.9913703f, 0.9983334f, -1.9913703f, 0.9966669f}, {0.9984358f, -1.9915744f, 0.9984358f, -1.9915744f, 0.9968716f}},
-        {{0.9388848f, -1.8737787f, 0.9388848f, -1.8737787f, 0.8777696f}, {0.9393297f, -1.8746666f, 0.9393297f, -1.8746666f, 0.8786594f}, {0.9406264f, -1.8772545f, 0.9406264f, -1.8772545f, 0.8812528f}, {0.9426686f, -1.8813302f, 0.9426686f, -1.8813302f, 0.8853372f}, {0.9453025f, -1.8865868f, 0.9453025f, -1.8865868f, 0.890605f}, {0.9483532f, -1.8926752f, 0.9483532f, -1.8926752f, 0.8967064f}, {0.9516492f, -1.8992532f, 0.9516492f, -1.8992532f, 0.9032983f}, {0.9550401f, -1.9060206f, 0.9550401f, -1.9060206f, 0.9100802f}, {0.9584059f, -1.9127379f, 0.9584059f, -1.9127379f, 0.9168118f}, {0.9616589f, -1.9192302f, 0.9616589f, -1.9192302f, 0.9233179f}, {0.9647409f, -1.9253811f, 0.9647409f, -1.9253811f, 0.9294819f}, {0.9676179f, -1.9311228f, 0.9676179f, -1.9311228f, 0.9352359f}, {0.9702744f, -1.9364245f, 0.9702744f, -1.9364245f, 0.9405488f}, {0.972708f, -1.9412813f, 0.972708f, -1.9412813f, 0.945416f}, {0.9749251f, -1.9457061f, 0.9749251f, -1.9457061f, 0.9498502f}, {0.9769374f, -1.9497221f, 0.9769374f, -1.9497221f, 0.9538748f}, {0.9787595f, -1.9533586f, 0.9787595f, -1.9533586f, 0.957519f}, {0.9804073f, -1.9566473f, 0.9804073f, -1.9566473f, 0.9608147f}, {0.9818969f, -1.9596201f, 0.9818969f, -1.9596201f, 0.9637938f}, {0.9832436f, -1.9623078f, 0.9832436f, -1.9623078f, 0.9664873f}, {0.984462f, -1.9647394f, 0.984462f, -1.9647394f, 0.968924f}, {0.9855654f, -1.9669415f, 0.9855654f, -1.9669415f, 0.9711308f}, {0.9865659f, -1.9689382f, 0.9865659f, -1.9689382f, 0.9731318f}, {0.9874745f, -1.9707515f, 0.9874745f, -1.9707515f, 0.974949f}, {0.9883009f, -1.9724008f, 0.9883009f, -1.9724008f, 0.9766018f}, {0.9890538f, -1.9739035f, 0.9890538f, -1.9739035f, 0.9781076f}, {0.989741f, -1.9752749f, 0.989741f, -1.9752749f, 0.979482f}, {0.9903693f, -1.9765289f, 0.9903693f, -1.9765289f, 0.9807387f}, {0.9909448f, -1.9776775f, 0.9909448f, -1.9776775f, 0.9818897f}, {0.9914729f, -1.9787315f, 0.9914729f, -1.9787315f, 0.9829459f}, {0.9919584f, -1.9797003f, 0.9919584f, -1.9797003f, 0.9839168f}, {0.9924054f, -1.9805924f, 0.9924054f, -1.9805924f, 0.9848108f}, {0.9928177f, -1.9814153f, 0.9928177f, -1.9814153f, 0.9856355f}, {0.9931987f, -1.9821757f, 0.9931987f, -1.9821757f, 0.9863974f}, {0.9935513f, -1.9828794f, 0.9935513f, -1.9828794f, 0.9871026f}, {0.9938782f, -1.9835317f, 0.9938782f, -1.9835317f, 0.9877563f}, {0.9941816f, -1.9841373f, 0.9941816f, -1.9841373f, 0.9883632f}, {0.9944638f, -1.9847004f, 0.9944638f, -1.9847004f, 0.9889275f}, {0.9947265f, -1.9852247f, 0.9947265f, -1.9852247f, 0.989453f}, {0.9949715f, -1.9857137f, 0.9949715f, -1.9857137f, 0.989943f}, {0.9952003f, -1.9861703f, 0.9952003f, -1.9861703f, 0.9904006f}, {0.9954142f, -1.9865972f, 0.9954142f, -1.9865972f, 0.9908284f}, {0.9956145f, -1.986997f, 0.9956145f, -1.986997f, 0.991229f}, {0.9958023f, -1.9873717f, 0.9958023f, -1.9873717f, 0.9916045f}, {0.9959785f, -1.9877234f, 0.9959785f, -1.9877234f, 0.991957f}, {0.996148f, -1.9880617f, 0.996148f, -1.9880617f, 0.992296f}, {0.9963166f, -1.9883981f, 0.9963166f, -1.9883981f, 0.9926331f}, {0.9964837f, -1.9887317f, 0.9964837f, -1.9887317f, 0.9929674f}, {0.9966489f, -1.9890614f, 0.9966489f, -1.9890614f, 0.9932978f}, {0.9968116f, -1.9893861f, 0.9968116f, -1.9893861f, 0.9936232f}, {0.9969712f, -1.9897046f, 0.9969712f, -1.9897046f, 0.9939424f}, {0.9971272f, -1.990016f, 0.9971272f, -1.990016f, 0.9942544f}, {0.9972791f, -1.9903192f, 0.9972791f, -1.9903192f, 0.9945583f}, {0.9974265f, -1.9906133f, 0.9974265f, -1.9906133f, 0.994853f}, {0.997569f, -1.9908976f, 0.997569f, -1.9908976f, 0.995138f}, {0.9977062f, -1.9911715f, 0.9977062f, -1.9911715f, 0.9954124f}, {0.9978379f, -1.9914344f, 0.9978379f, -1.9914344f, 0.9956758f}, {0.997964f, -1.9916859f, 0.997964f, -1.9916859f, 0.995928f}, {0.9980843f, -1.991926f, 0.9980843f, -1.991926f, 0.9961685f}, {0.9981987f, -1.9921544f, 0.9981987f, -1.9921544f, 0.9963974f}, {0.9983073f, -1.9923712f, 0.9983073f, -1.9923712f, 0.9966147f}, {0.9984102f, -1.9925765f, 0.9984102f, -1.9925765f, 0.9968204f}, {0.9985074f, -1.9927705f, 0.9985074f, -1.9927705f, 0.9970148f}, {0.9985991f, -1.9929534f, 0.9985991f, -1.9929534f, 0.9971982f}},
-        {{0.944927f, -1.886636f, 0.944927f, -1.886636f, 0.889854f}, {0.9453305f, -1.8874416f, 0.9453305f, -1.8874416f, 0.890661f}, {0.9465062f, -1.8897891f, 0.9465062f, -1.8897891f, 0.8930125f}, {0.9483573f, -1.8934849f, 0.9483573f, -1.8934849f, 0.8967146f}, {0.9507435f, -1.8982492f, 0.9507435f, -1.8982492f, 0.901487f}, {0.9535057f, -1.9037641f, 0.9535057f, -1.9037641f, 0.9070113f}, {0.9564879f, -1.9097184f, 0.9564879f, -1.9097184f, 0.9129758f}, {0.9595539f, -1.9158399f, 0.9595539f, -1.9158399f, 0.9191078f}, {0.962595f, -1.9219119f, 0.962595f, -1.9219119f, 0.9251901f}, {0.9655322f, -1.9277763f, 0.9655322f, -1.9277763f, 0.9310644f}, {0.9683131f, -1.9333286f, 0.9683131f, -1.9333286f, 0.9366263f}, {0.9709074f, -1.9385084f, 0.9709074f, -1.9385084f, 0.9418149f}, {0.9733015f, -1.9432884f, 0.9733015f, -1.9432884f, 0.946603f}, {0.9754935f, -1.947665f, 0.9754935f, -1.947665f, 0.9509871f}, {0.9774896f, -1.9516502f, 0.9774896f, -1.9516502f, 0.9549792f}, {0.9793004f, -1.9552658f, 0.9793004f, -1.9552658f, 0.9586009f}, {0.9809395f, -1.9585383f, 0.9809395f, -1.9585383f, 0.961879f}, {0.9824213f, -1.9614968f, 0.9824213f, -1.9614968f, 0.9648425f}, {0.9837602f, -1.9641702f, 0.9837602f, -1.9641702f, 0.9675205f}, {0.9849705f, -1.9665865f, 0.9849705f, -1.9665865f, 0.9699409f}, {0.9860651f, -1.968772f, 0.9860651f, -1.968772f, 0.9721301f}, {0.9870561f, -1.9707507f, 0.9870561f, -1.9707507f, 0.9741122f}, {0.9879546f, -1.9725446f, 0.9879546f, -1.9725446f, 0.9759091f}, {0.9887703f, -1.9741732f, 0.9887703f, -1.9741732f, 0.9775406f}, {0.9895121f, -1.9756543f, 0.9895121f, -1.9756543f, 0.9790242f}, {0.9901879f, -1.9770036f, 0.9901879f, -1.9770036f, 0.9803757f}, {0.9908045f, -1.9782348f, 0.9908045f, -1.9782348f, 0.981609f}, {0.9913683f, -1.9793604f, 0.9913683f, -1.9793604f, 0.9827365f}, {0.9918846f, -1.9803912f, 0.9918846f, -1.9803912f, 0.9837692f}, {0.9923583f, -1.981337f, 0.9923583f, -1.981337f, 0.9847166f}, {0.9927937f, -1.9822064f, 0.9927937f, -1.9822064f, 0.9855874f}, {0.9931946f, -1.9830068f, 0.9931946f, -1.9830068f, 0.9863892f}, {0.9935644f, -1.9837451f, 0.9935644f, -1.9837451f, 0.9871287f}, {0.993906f, -1.9844272f, 0.993906f, -1.9844272f, 0.987812f}, {0.9942221f, -1.9850584f, 0.9942221f, -1.9850584f, 0.9884443f}, {0.9945152f, -1.9856434f, 0.9945152f, -1.9856434f, 0.9890303f}, {0.9947872f, -1.9861866f, 0.9947872f, -1.9861866f, 0.9895744f}, {0.9950401f, -1.9866916f, 0.9950401f, -1.9866916f, 0.9900803f}, {0.9952757f, -1.9871618f, 0.9952757f, -1.9871618f, 0.9905513f}, {0.9954953f, -1.9876003f, 0.9954953f, -1.9876003f, 0.9909905f}, {0.9957003f, -1.9880097f, 0.9957003f, -1.9880097f, 0.9914006f}, {0.995892f, -1.9883925f, 0.995892f, -1.9883925f, 0.9917841f}, {0.9960715f, -1.9887509f, 0.9960715f, -1.9887509f, 0.9921431f}, {0.9962398f, -1.9890868f, 0.9962398f, -1.9890868f, 0.9924796f}, {0.9963977f, -1.9894022f, 0.9963977f, -1.9894022f, 0.9927955f}, {0.9965496f, -1.9897054f, 0.9965496f, -1.9897054f, 0.9930993f}, {0.9967007f, -1.990007f, 0.9967007f, -1.990007f, 0.9934014f}, {0.9968505f, -1.9903061f, 0.9968505f, -1.9903061f, 0.9937009f}, {0.9969985f, -1.9906016f, 0.9969985f, -1.9906016f, 0.9939969f}, {0.9971442f, -1.9908926f, 0.9971442f, -1.9908926f, 0.9942885f}, {0.9972872f, -1.9911782f, 0.9972872f, -1.9911782f, 0.9945745f}, {0.997427f, -1.9914572f, 0.997427f, -1.9914572f, 0.994854f}, {0.9975631f, -1.991729f, 0.9975631f, -1.991729f, 0.9951263f}, {0.9976952f, -1.9919926f, 0.9976952f, -1.9919926f, 0.9953903f}, {0.9978228f, -1.9922474f, 0.9978228f, -1.9922474f, 0.9956456f}, {0.9979457f, -1.9924928f, 0.9979457f, -1.9924928f, 0.9958914f}, {0.9980637f, -1.9927284f, 0.9980637f, -1.9927284f, 0.9961274f}, {0.9981766f, -1.9929539f, 0.9981766f, -1.9929539f, 0.9963532f}, {0.9982844f, -1.993169f, 0.9982844f, -1.993169f, 0.9965687f}, {0.9983869f, -1.9933737f, 0.9983869f, -1.9933737f, 0.9967738f}, {0.9984842f, -1.9935679f, 0.9984842f, -1.9935679f, 0.9969684f}, {0.9985763f, -1.9937519f, 0.9985763f, -1.9937519f, 0.9971526f}, {0.9986634f, -1.9939257f, 0.9986634f, -1.9939257f, 0.9973267f}, {0.9987455f, -1.9940897f, 0.9987455f, -1.9940897f, 0.997491f}},
-        {{0.9504067f, -1.8982203f, 0.9504067f, -1.8982203f, 0.9008134f}, {0.9507721f, -1.8989501f, 0.9507721f, -1.8989501f, 0.9015443f}, {0.9518368f, -1.9010766f, 0.9518368f, -1.9010766f, 0.9036736f}, {0.9535125f, -1.9044233f, 0.9535125f, -1.9044233f, 0.907025f}, {0.9556716f, -1.9087358f, 0.9556716f, -1.9087358f, 0.9113433f}, {0.9581696f, -1.9137248f, 0.9581696f, -1.9137248f, 0.9163392f}, {0.9608649f, -1.9191082f, 0.9608649f, -1.9191082f, 0.9217299f}, {0.9636342f, -1.9246393f, 0.9636342f, -1.9246393f, 0.9272685f}, {0.9663793f, -1.930122f, 0.9663793f, -1.930122f, 0.9327587f}, {0.9690289f, -1.9354139f, 0.9690289f, -1.9354139f, 0.9380579f}, {0.971536f, -1.9404213f, 0.971536f, -1.9404213f, 0.9430721f}, {0.9738736f, -1.94509f, 0.9738736f, -1.94509f, 0.9477472f}, {0.9760296f, -1.9493961f, 0.9760296f, -1.9493961f, 0.9520592f}, {0.9780027f, -1.953337f, 0.9780027f, -1.953337f, 0.9560054f}, {0.9797986f, -1.9569239f, 0.9797986f, -1.9569239f, 0.9595972f}, {0.9814272f, -1.9601767f, 0.9814272f, -1.9601767f, 0.9628545f}, {0.9829008f, -1.9631199f, 0.9829008f, -1.9631199f, 0.9658017f}, {0.9842326f, -1.9657797f, 0.9842326f, -1.9657797f, 0.9684651f}, {0.9854356f, -1.9681826f, 0.9854356f, -1.9681826f, 0.9708713f}, {0.9865227f, -1.9703538f, 0.9865227f, -1.9703538f, 0.9730454f}, {0.9875057f, -1.972317f, 0.9875057f, -1.972317f, 0.9750114f}, {0.9883955f, -1.9740942f, 0.9883955f, -1.9740942f, 0.976791f}, {0.989202f, -1.975705f, 0.989202f, -1.975705f, 0.978404f}, {0.9899341f, -1.9771672f, 0.9899341f, -1.9771672f, 0.9798682f}, {0.9905998f, -1.9784967f, 0.9905998f, -1.9784967f, 0.9811995f}, {0.9912061f, -1.9797077f, 0.9912061f, -1.9797077f, 0.9824121f}, {0.9917593f, -1.9808126f, 0.9917593f, -1.9808126f, 0.9835185f}, {0.9922649f, -1.9818225f, 0.9922649f, -1.9818225f, 0.9845299f}, {0.992728f, -1.9827474f, 0.992728f, -1.9827474f, 0.985456f}, {0.9931528f, -1.9835959f, 0.9931528f, -1.9835959f, 0.9863057f}, {0.9935433f, -1.9843757f, 0.9935433f, -1.9843757f, 0.9870865f}, {0.9939027f, -1.9850936f, 0.9939027f, -1.9850936f, 0.9878054f}, {0.9942342f, -1.9857558f, 0.9942342f, -1.9857558f, 0.9884685f}, {0.9945405f, -1.9863674f, 0.9945405f, -1.9863674f, 0.989081f}, {0.9948239f, -1.9869335f, 0.9948239f, -1.9869335f, 0.9896478f}, {0.9950866f, -1.9874581f, 0.9950866f, -1.9874581f, 0.9901731f}, {0.9953304f, -1.9879451f, 0.9953304f, -1.9879451f, 0.9906608f}, {0.9955571f, -1.9883978f, 0.9955571f, -1.9883978f, 0.9911142f}, {0.9957682f, -1.9888194f, 0.9957682f, -1.9888194f, 0.9915363f}, {0.995965f, -1.9892125f, 0.995965f, -1.9892125f, 0.9919299f}, {0.9961487f, -1.9895795f, 0.9961487f, -1.9895795f, 0.9922974f}, {0.9963205f, -1.9899226f, 0.9963205f, -1.9899226f, 0.9926411f}, {0.9964814f, -1.9902439f, 0.9964814f, -1.9902439f, 0.9929627f}, {0.9966321f, -1.990545f, 0.9966321f, -1.990545f, 0.9932643f}, {0.9967736f, -1.9908276f, 0.9967736f, -1.9908276f, 0.9935473f}, {0.9969097f, -1.9910995f, 0.9969097f, -1.9910995f, 0.9938195f}, {0.9970451f, -1.9913697f, 0.9970451f, -1.9913697f, 0.9940901f}, {0.9971793f, -1.9916377f, 0.9971793f, -1.9916377f, 0.9943585f}, {0.9973119f, -1.9919026f, 0.9973119f, -1.9919026f, 0.9946237f}, {0.9974424f, -1.9921634f, 0.9974424f, -1.9921634f, 0.9948849f}, {0.9975706f, -1.9924193f, 0.9975706f, -1.9924193f, 0.9951411f}, {0.9976958f, -1.9926694f, 0.9976958f, -1.9926694f, 0.9953915f}, {0.9978177f, -1.9929129f, 0.9978177f, -1.9929129f, 0.9956354f}, {0.997936f, -1.9931491f, 0.997936f, -1.9931491f, 0.9958719f}, {0.9980503f, -1.9933774f, 0.9980503f, -1.9933774f, 0.9961005f}, {0.9981604f, -1.9935973f, 0.9981604f, -1.9935973f, 0.9963207f}, {0.9982661f, -1.9938084f, 0.9982661f, -1.9938084f, 0.9965321f}, {0.9983672f, -1.9940104f, 0.9983672f, -1.9940104f, 0.9967344f}, {0.9984637f, -1.9942031f, 0.9984637f, -1.9942031f, 0.9969274f}, {0.9985555f, -1.9943865f, 0.9985555f, -1.9943865f, 0.997111f}, {0.9986427f, -1.9945606f, 0.9986427f, -1.9945606f, 0.9972853f}, {0.9987252f, -1.9947254f, 0.9987252f, -1.9947254f, 0.9974503f}, {0.9988031f, -1.9948811f, 0.9988031f, -1.9948811f, 0.9976063f}, {0.9988767f, -1.995028f, 0.9988767f, -1.995028f, 0.9977533f}},
-        {{0.9553693f, -1.9086503f, 0.9553693f, -1.9086503f, 0.9107387f}, {0.9556999f, -1.9093107f, 0.9556999f, -1.9093107f, 0.9113998f}, {0.9566629f, -1.9112345f, 0.9566629f, -1.9112345f, 0.9133257f}, {0.958178f, -1.9142615f, 0.958178f, -1.9142615f, 0.916356f}, {0.9601295f, -1.9181603f, 0.9601295f, -1.9181603f, 0.920259f}, {0.9623861f, -1.9226686f, 0.9623861f, -1.9226686f, 0.9247723f}, {0.9648198f, -1.9275306f, 0.9648198f, -1.9275306f, 0.9296396f}, {0.9673188f, -1.932523f, 0.9673188f, -1.932523f, 0.9346375f}, {0.9697944f, -1.937469f, 0.9697944f, -1.937469f, 0.9395889f}, {0.9721826f, -1.9422401f, 0.9721826f, -1.9422401f, 0.9443653f}, {0.9744412f, -1.9467523f, 0.9744412f, -1.9467523f, 0.9488824f}, {0.9765459f, -1.9509572f, 0.9765459f, -1.9509572f, 0.9530918f}, {0.9784863f, -1.9548336f, 0.9784863f, -1.9548336f, 0.9569725f}, {0.9802612f, -1.9583797f, 0.9802612f, -1.9583797f, 0.9605225f}, {0.9818762f, -1.961606f, 0.9818762f, -1.961606f, 0.9637523f}, {0.9833402f, -1.9645308f, 0.9833402f, -1.9645308f, 0.9666803f}, {0.9846644f, -1.9671763f, 0.9846644f, -1.9671763f, 0.9693287f}, {0.9858607f, -1.9695664f, 0.9858607f, -1.9695664f, 0.9717214f}, {0.9869412f, -1.971725f, 0.9869412f, -1.971725f, 0.9738824f}, {0.9879173f, -1.9736751f, 0.9879173f, -1.9736751f, 0.9758346f}, {0.9887997f, -1.975438f, 0.9887997f, -1.975438f, 0.9775994f}, {0.9895983f, -1.9770334f, 0.9895983f, -1.9770334f, 0.9791966f}, {0.990322f, -1.9784793f, 0.990322f, -1.9784793f, 0.9806441f}, {0.9909789f, -1.9797916f, 0.9909789f, -1.9797916f, 0.9819578f}, {0.9915761f, -1.9809846f, 0.9915761f, -1.9809846f, 0.9831521f}, {0.9921199f, -1.9820711f, 0.9921199f, -1.9820711f, 0.9842398f}, {0.992616f, -1.9830623f, 0.992616f, -1.9830623f, 0.9852321f}, {0.9930695f, -1.9839682f, 0.9930695f, -1.9839682f, 0.986139f}, {0.9934847f, -1.9847978f, 0.9934847f, -1.9847978f, 0.9869695f}, {0.9938656f, -1.9855587f, 0.9938656f, -1.9855587f, 0.9877312f}, {0.9942156f, -1.986258f, 0.9942156f, -1.986258f, 0.9884313f}, {0.9945379f, -1.9869017f, 0.9945379f, -1.9869017f, 0.9890757f}, {0.994835f, -1.9874954f, 0.994835f, -1.9874954f, 0.9896701f}, {0.9951095f, -1.9880438f, 0.9951095f, -1.9880438f, 0.9902191f}, {0.9953635f, -1.9885513f, 0.9953635f, -1.9885513f, 0.9907271f}, {0.9955989f, -1.9890216f, 0.9955989f, -1.9890216f, 0.9911979f}, {0.9958174f, -1.9894581f, 0.9958174f, -1.9894581f, 0.9916349f}, {0.9960206f, -1.9898639f, 0.9960206f, -1.9898639f, 0.9920412f}, {0.9962097f, -1.9902418f, 0.9962097f, -1.9902418f, 0.9924194f}, {0.9963861f, -1.9905941f, 0.9963861f, -1.9905941f, 0.9927721f}, {0.9965507f, -1.990923f, 0.9965507f, -1.990923f, 0.9931014f}, {0.9967046f, -1.9912306f, 0.9967046f, -1.9912306f, 0.9934093f}, {0.9968488f, -1.9915185f, 0.9968488f, -1.9915185f, 0.9936975f}, {0.9969838f, -1.9917883f, 0.9969838f, -1.9917883f, 0.9939677f}, {0.9971106f, -1.9920416f, 0.9971106f, -1.9920416f, 0.9942212f}, {0.9972325f, -1.9922852f, 0.9972325f, -1.9922852f, 0.994465f}, {0.9973537f, -1.9925274f, 0.9973537f, -1.9925274f, 0.9947075f}, {0.997474f, -1.9927675f, 0.997474f, -1.9927675f, 0.9949479f}, {0.9975927f, -1.9930048f, 0.9975927f, -1.9930048f, 0.9951855f}, {0.9977097f, -1.9932385f, 0.9977097f, -1.9932385f, 0.9954194f}, {0.9978245f, -1.9934678f, 0.9978245f, -1.9934678f, 0.9956489f}, {0.9979366f, -1.9936918f, 0.9979366f, -1.9936918f, 0.9958732f}, {0.9980458f, -1.99391f, 0.9980458f, -1.99391f, 0.9960916f}, {0.9981517f, -1.9941216f, 0.9981517f, -1.9941216f, 0.9963035f}, {0.9982541f, -1.9943261f, 0.9982541f, -1.9943261f, 0.9965083f}, {0.9983527f, -1.9945231f, 0.9983527f, -1.9945231f, 0.9967055f}, {0.9984474f, -1.9947123f, 0.9984474f, -1.9947123f, 0.9968948f}, {0.998538f, -1.9948932f, 0.998538f, -1.9948932f, 0.9970759f}, {0.9986244f, -1.9950659f, 0.9986244f, -1.9950659f, 0.9972488f}, {0.9987066f, -1.9952301f, 0.9987066f, -1.9952301f, 0.9974132f}, {0.9987847f, -1.995386f, 0.9987847f, -1.995386f, 0.9975693f}, {0.9988585f, -1.9955337f, 0.9988585f, -1.9955337f, 0.9977171f}, {0.9989284f, -1.9956731f, 0.9989284f, -1.9956731f, 0.9978567f}, {0.9989942f, -1.9958047f, 0.9989942f, -1.9958047f, 0.9979884f}},
-        {{0.9598581f, -1.9180352f, 0.9598581f, -1.9180352f, 0.9197162f}, {0.9601568f, -1.9186321f, 0.9601568f, -1.9186321f, 0.9203136f}, {0.9610268f, -1.9203706f, 0.9610268f, -1.9203706f, 0.9220536f}, {0.9623954f, -1.9231053f, 0.9623954f, -1.9231053f, 0.9247907f}, {0.9641575f, -1.9266264f, 0.9641575f, -1.9266264f, 0.9283149f}, {0.9661941f, -1.9306962f, 0.9661941f, -1.9306962f, 0.9323883f}, {0.9683895f, -1.9350831f, 0.9683895f, -1.9350831f, 0.936779f}, {0.9706426f, -1.9395854f, 0.9706426f, -1.9395854f, 0.9412852f}, {0.9728736f, -1.9440434f, 0.9728736f, -1.9440434f, 0.9457471f}, {0.9750246f, -1.9483416f, 0.9750246f, -1.9483416f, 0.9500492f}, {0.9770578f, -1.9524046f, 0.9770578f, -1.9524046f, 0.9541157f}, {0.9789517f, -1.9561891f, 0.9789517f, -1.9561891f, 0.9579035f}, {0.980697f, -1.9596765f, 0.980697f, -1.9596765f, 0.961394f}, {0.9822929f, -1.9628655f, 0.9822929f, -1.9628655f, 0.9645858f}, {0.9837443f, -1.9657659f, 0.9837443f, -1.9657659f, 0.9674887f}, {0.9850597f, -1.9683943f, 0.9850597f, -1.9683943f, 0.9701194f}, {0.9862492f, -1.9707711f, 0.9862492f, -1.9707711f, 0.9724983f}, {0.9873235f, -1.9729179f, 0.9873235f, -1.9729179f, 0.9746469f}, {0.9882935f, -1.9748562f, 0.9882935f, -1.9748562f, 0.976587f}, {0.9891696f, -1.9766069f, 0.9891696f, -1.9766069f, 0.9783392f}, {0.9899615f, -1.9781893f, 0.9899615f, -1.9781893f, 0.979923f}, {0.9906781f, -1.9796212f, 0.9906781f, -1.9796212f, 0.9813561f}, {0.9913273f, -1.9809186f, 0.9913273f, -1.9809186f, 0.9826546f}, {0.9919165f, -1.9820959f, 0.9919165f, -1.9820959f, 0.983833f}, {0.9924521f, -1.9831661f, 0.9924521f, -1.9831661f, 0.9849042f}, {0.9929398f, -1.9841406f, 0.9929398f, -1.9841406f, 0.9858795f}, {0.9933846f, -1.9850296f, 0.9933846f, -1.9850296f, 0.9867692f}, {0.9937912f, -1.985842f, 0.9937912f, -1.985842f, 0.9875824f}, {0.9941634f, -1.9865858f, 0.9941634f, -1.9865858f, 0.9883268f}, {0.9945049f, -1.9872681f, 0.9945049f, -1.9872681f, 0.9890097f}, {0.9948186f, -1.987895f, 0.9948186f, -1.987895f, 0.9896372f}, {0.9951074f, -1.9884721f, 0.9951074f, -1.9884721f, 0.9902148f}, {0.9953737f, -1.9890043f, 0.9953737f, -1.9890043f, 0.9907474f}, {0.9956197f, -1.9894958f, 0.9956197f, -1.9894958f, 0.9912394f}, {0.9958473f, -1.9899507f, 0.9958473f, -1.9899507f, 0.9916947f}, {0.9960583f, -1.9903722f, 0.9960583f, -1.9903722f, 0.9921165f}, {0.9962541f, -1.9907634f, 0.9962541f, -1.9907634f, 0.9925081f}, {0.9964361f, -1.9911271f, 0.9964361f, -1.9911271f, 0.9928721f}, {0.9966055f, -1.9914657f, 0.9966055f, -1.9914657f, 0.9932111f}, {0.9967635f, -1.9917814f, 0.9967635f, -1.9917814f, 0.993527f}, {0.996911f, -1.9920762f, 0.996911f, -1.9920762f, 0.993822f}, {0.9970489f, -1.9923517f, 0.9970489f, -1.9923517f, 0.9940978f}, {0.997178f, -1.9926097f, 0.997178f, -1.9926097f, 0.994356f}, {0.997299f, -1.9928515f, 0.997299f, -1.9928515f, 0.994598f}, {0.9974126f, -1.9930784f, 0.9974126f, -1.9930784f, 0.9948251f}, {0.9975218f, -1.9932966f, 0.9975218f, -1.9932966f, 0.9950436f}, {0.9976304f, -1.9935136f, 0.9976304f, -1.9935136f, 0.9952607f}, {0.997738f, -1.9937288f, 0.997738f, -1.9937288f, 0.9954761f}, {0.9978444f, -1.9939414f, 0.9978444f, -1.9939414f, 0.9956889f}, {0.9979492f, -1.9941507f, 0.9979492f, -1.9941507f, 0.9958984f}, {0.998052f, -1.9943561f, 0.998052f, -1.9943561f, 0.996104f}, {0.9981524f, -1.9945568f, 0.9981524f, -1.9945568f, 0.9963048f}, {0.9982502f, -1.9947522f, 0.9982502f, -1.9947522f, 0.9965004f}, {0.9983451f, -1.9949418f, 0.9983451f, -1.9949418f, 0.9966902f}, {0.9984368f, -1.995125f, 0.9984368f, -1.995125f, 0.9968736f}, {0.9985251f, -1.9953015f, 0.9985251f, -1.9953015f, 0.9970502f}, {0.9986099f, -1.9954709f, 0.9986099f, -1.9954709f, 0.9972197f}, {0.998691f, -1.995633f, 0.998691f, -1.995633f, 0.9973819f}, {0.9987684f, -1.9957876f, 0.9987684f, -1.9957876f, 0.9975367f}, {0.998842f, -1.9959347f, 0.998842f, -1.9959347f, 0.997684f}, {0.9989119f, -1.9960744f, 0.9989119f, -1.9960744f, 0.9978237f}, {0.998978f, -1.9962066f, 0.998978f, -1.9962066f, 0.9979561f}, {0.9990405f, -1.9963315f, 0.9990405f, -1.9963315f, 0.9980811f}, {0.9990995f, -1.9964493f, 0.9990995f, -1.9964493f, 0.998199f}},
-        {{0.9639137f, -1.9264749f, 0.9639137f, -1.9264749f, 0.9278273f}, {0.9641833f, -1.9270139f, 0.9641833f, -1.9270139f, 0.9283666f}, {0.9649686f, -1.9285834f, 0.9649686f, -1.9285834f, 0.9299373f}, {0.9662036f, -1.9310517f, 0.9662036f, -1.9310517f, 0.9324073f}, {0.9677933f, -1.9342287f, 0.9677933f, -1.9342287f, 0.9355865f}, {0.9696298f, -1.9378993f, 0.9696298f, -1.9378993f, 0.9392597f}, {0.9716086f, -1.9418541f, 0.9716086f, -1.9418541f, 0.9432173f}, {0.9736385f, -1.945911f, 0.9736385f, -1.945911f, 0.9472771f}, {0.9756475f, -1.9499262f, 0.9756475f, -1.9499262f, 0.9512951f}, {0.9775837f, -1.9537957f, 0.9775837f, -1.9537957f, 0.9551673f}, {0.979413f, -1.9574518f, 0.979413f, -1.9574518f, 0.9588259f}, {0.9811162f, -1.9608559f, 0.9811162f, -1.9608559f, 0.9622324f}, {0.9826852f, -1.9639916f, 0.9826852f, -1.9639916f, 0.9653704f}, {0.9841194f, -1.966858f, 0.9841194f, -1.966858f, 0.9682387f}, {0.9854233f, -1.9694641f, 0.9854233f, -1.9694641f, 0.9708466f}, {0.9866047f, -1.9718251f, 0.9866047f, -1.9718251f, 0.9732094f}, {0.9876727f, -1.9739596f, 0.9876727f, -1.9739596f, 0.9753453f}, {0.988637f, -1.975887f, 0.988637f, -1.975887f, 0.9772741f}, {0.9895076f, -1.9776269f, 0.9895076f, -1.9776269f, 0.9790153f}, {0.9902938f, -1.9791981f, 0.9902938f, -1.9791981f, 0.9805875f}, {0.9910042f, -1.980618f, 0.9910042f, -1.980618f, 0.9820084f}, {0.991647f, -1.9819026f, 0.991647f, -1.9819026f, 0.9832939f}, {0.9922293f, -1.9830664f, 0.9922293f, -1.9830664f, 0.9844585f}, {0.9927576f, -1.9841224f, 0.9927576f, -1.9841224f, 0.9855153f}, {0.9932379f, -1.9850822f, 0.9932379f, -1.9850822f, 0.9864757f}, {0.9936751f, -1.985956f, 0.9936751f, -1.985956f, 0.9873502f}, {0.9940739f, -1.9867531f, 0.9940739f, -1.9867531f, 0.9881478f}, {0.9944383f, -1.9874814f, 0.9944383f, -1.9874814f, 0.9888767f}, {0.994772f, -1.9881483f, 0.994772f, -1.9881483f, 0.989544f}, {0.995078f, -1.9887598f, 0.995078f, -1.9887598f, 0.990156f}, {0.9953592f, -1.9893218f, 0.9953592f, -1.9893218f, 0.9907183f}, {0.995618f, -1.989839f, 0.995618f, -1.989839f, 0.9912359f}, {0.9958566f, -1.990316f, 0.9958566f, -1.990316f, 0.9917132f}, {0.996077f, -1.9907565f, 0.996077f, -1.9907565f, 0.9921541f}, {0.996281f, -1.9911641f, 0.996281f, -1.9911641f, 0.9925619f}, {0.99647f, -1.9915418f, 0.99647f, -1.9915418f, 0.9929399f}, {0.9966454f, -1.9918924f, 0.9966454f, -1.9918924f, 0.9932907f}, {0.9968084f, -1.9922183f, 0.9968084f, -1.9922183f, 0.9936169f}, {0.9969602f, -1.9925217f, 0.9969602f, -1.9925217f, 0.9939205f}, {0.9971018f, -1.9928046f, 0.9971018f, -1.9928046f, 0.9942035f}, {0.9972339f, -1.9930686f, 0.9972339f, -1.9930686f, 0.9944678f}, {0.9973574f, -1.9933155f, 0.9973574f, -1.9933155f, 0.9947148f}, {0.997473f, -1.9935466f, 0.997473f, -1.9935466f, 0.9949461f}, {0.9975814f, -1.9937632f, 0.9975814f, -1.9937632f, 0.9951629f}, {0.9976831f, -1.9939665f, 0.9976831f, -1.9939665f, 0.9953663f}, {0.997781f, -1.994162f, 0.997781f, -1.994162f, 0.9955619f}, {0.9978782f, -1.9943564f, 0.9978782f, -1.9943564f, 0.9957564f}, {0.9979746f, -1.9945491f, 0.9979746f, -1.9945491f, 0.9959493f}, {0.9980699f, -1.9947395f, 0.9980699f, -1.9947395f, 0.9961399f}, {0.9981638f, -1.9949271f, 0.9981638f, -1.9949271f, 0.9963275f}, {0.9982558f, -1.995111f, 0.9982558f, -1.995111f, 0.9965116f}, {0.9983458f, -1.9952908f, 0.9983458f, -1.9952908f, 0.9966915f}, {0.9984333f, -1.9954658f, 0.9984333f, -1.9954658f, 0.9968667f}, {0.9985183f, -1.9956356f, 0.9985183f, -1.9956356f, 0.9970366f}, {0.9986004f, -1.9957997f, 0.9986004f, -1.9957997f, 0.9972008f}, {0.9986795f, -1.9959578f, 0.9986795f, -1.9959578f, 0.9973589f}, {0.9987554f, -1.9961095f, 0.9987554f, -1.9961095f, 0.9975108f}, {0.998828f, -1.9962546f, 0.998828f, -1.9962546f, 0.997656f}, {0.9988973f, -1.9963931f, 0.9988973f, -1.9963931f, 0.9977946f}, {0.9989632f, -1.9965249f, 0.9989632f, -1.9965249f, 0.9979265f}, {0.9990258f, -1.9966499f, 0.9990258f, -1.9966499f, 0.9980516f}, {0.999085f, -1.9967683f, 0.999085f, -1.9967683f, 0.9981701f}, {0.999141f, -1.9968802f, 0.999141f, -1.9968802f, 0.998282f}, {0.9991938f, -1.9969857f, 0.9991938f, -1.9969857f, 0.9983876f}},
-        {{0.9675743f, -1.9340609f, 0.9675743f, -1.9340609f, 0.9351485f}, {0.9678175f, -1.9345471f, 0.9678175f, -1.9345471f, 0.9356349f}, {0.9685257f, -1.9359628f, 0.9685257f, -1.9359628f, 0.9370514f}, {0.9696393f, -1.9381886f, 0.9696393f, -1.9381886f, 0.9392785f}, {0.9710721f, -1.9410527f, 0.9710721f, -1.9410527f, 0.9421442f}, {0.972727f, -1.9443606f, 0.972727f, -1.9443606f, 0.945454f}, {0.9745093f, -1.9479232f, 0.9745093f, -1.9479232f, 0.9490186f}, {0.9763369f, -1.9515763f, 0.9763369f, -1.9515763f, 0.9526737f}, {0.9781448f, -1.9551902f, 0.9781448f, -1.9551902f, 0.9562897f}, {0.9798865f, -1.9586716f, 0.9798865f, -1.9586716f, 0.959773f}, {0.9815314f, -1.9619596f, 0.9815314f, -1.9619596f, 0.9630629f}, {0.9830625f, -1.9650199f, 0.9830625f, -1.9650199f, 0.9661249f}, {0.9844723f, -1.967838f, 0.9844723f, -1.967838f, 0.9689445f}, {0.9857606f, -1.9704131f, 0.9857606f, -1.9704131f, 0.9715211f}, {0.9869316f, -1.9727538f, 0.9869316f, -1.9727538f, 0.9738631f}, {0.9879922f, -1.9748738f, 0.9879922f, -1.9748738f, 0.9759844f}, {0.9889508f, -1.9767899f, 0.9889508f, -1.9767899f, 0.9779015f}, {0.9898162f, -1.9785198f, 0.9898162f, -1.9785198f, 0.9796324f}, {0.9905973f, -1.9800811f, 0.9905973f, -1.9800811f, 0.9811946f}, {0.9913025f, -1.9814908f, 0.9913025f, -1.9814908f, 0.982605f}, {0.9919397f, -1.9827645f, 0.9919397f, -1.9827645f, 0.9838795f}, {0.9925161f, -1.9839167f, 0.9925161f, -1.9839167f, 0.9850323f}, {0.9930383f, -1.9849604f, 0.9930383f, -1.9849604f, 0.9860766f}, {0.993512f, -1.9859072f, 0.993512f, -1.9859072f, 0.987024f}, {0.9939425f, -1.9867678f, 0.9939425f, -1.9867678f, 0.987885f}, {0.9943344f, -1.9875512f, 0.9943344f, -1.9875512f, 0.9886689f}, {0.9946919f, -1.9882657f, 0.9946919f, -1.9882657f, 0.9893838f}, {0.9950185f, -1.9889186f, 0.9950185f, -1.9889186f, 0.990037f}, {0.9953175f, -1.9895163f, 0.9953175f, -1.9895163f, 0.990635f}, {0.9955917f, -1.9900644f, 0.9955917f, -1.9900644f, 0.9911835f}, {0.9958437f, -1.990568f, 0.9958437f, -1.990568f, 0.9916874f}, {0.9960756f, -1.9910315f, 0.9960756f, -1.9910315f, 0.9921511f}, {0.9962894f, -1.9914589f, 0.9962894f, -1.9914589f, 0.9925788f}, {0.9964869f, -1.9918537f, 0.9964869f, -1.9918537f, 0.9929737f}, {0.9966696f, -1.9922189f, 0.9966696f, -1.9922189f, 0.9933391f}, {0.9968389f, -1.9925573f, 0.9968389f, -1.9925573f, 0.9936777f}, {0.996996f, -1.9928714f, 0.996996f, -1.9928714f, 0.993992f}, {0.9971421f, -1.9931633f, 0.9971421f, -1.9931633f, 0.9942841f}, {0.9972781f, -1.9934351f, 0.9972781f, -1.9934351f, 0.9945561f}, {0.9974048f, -1.9936885f, 0.9974048f, -1.9936885f, 0.9948096f}, {0.9975232f, -1.9939251f, 0.9975232f, -1.9939251f, 0.9950463f}, {0.9976338f, -1.9941462f, 0.9976338f, -1.9941462f, 0.9952676f}, {0.9977374f, -1.9943533f, 0.9977374f, -1.9943533f, 0.9954747f}, {0.9978344f, -1.9945473f, 0.9978344f, -1.9945473f, 0.9956689f}, {0.9979255f, -1.9947294f, 0.9979255f, -1.9947294f, 0.9958511f}, {0.9980131f, -1.9949045f, 0.9980131f, -1.9949045f, 0.9960263f}, {0.9981002f, -1.9950786f, 0.9981002f, -1.9950786f, 0.9962005f}, {0.9981866f, -1.9952512f, 0.9981866f, -1.9952512f, 0.9963732f}, {0.9982719f, -1.9954218f, 0.9982719f, -1.9954218f, 0.9965439f}, {0.998356f, -1.9955897f, 0.998356f, -1.9955897f, 0.9967119f}, {0.9984384f, -1.9957545f, 0.9984384f, -1.9957545f, 0.9968768f}, {0.9985189f, -1.9959155f, 0.9985189f, -1.9959155f, 0.9970379f}, {0.9985974f, -1.9960723f, 0.9985974f, -1.9960723f, 0.9971947f}, {0.9986734f, -1.9962243f, 0.9986734f, -1.9962243f, 0.9973469f}, {0.9987469f, -1.9963713f, 0.9987469f, -1.9963713f, 0.9974939f}, {0.9988178f, -1.9965128f, 0.9988178f, -1.9965128f, 0.9976355f}, {0.9988857f, -1.9966487f, 0.9988857f, -1.9966487f, 0.9977714f}, {0.9989508f, -1.9967787f, 0.9989508f, -1.9967787f, 0.9979015f}, {0.9990128f, -1.9969027f, 0.9990128f, -1.9969027f, 0.9980256f}, {0.9990718f, -1.9970207f, 0.9990718f, -1.9970207f, 0.9981437f}, {0.9991278f, -1.9971326f, 0.9991278f, -1.9971326f, 0.9982557f}, {0.9991809f, -1.9972387f, 0.9991809f, -1.9972387f, 0.9983618f}, {0.999231f, -1.9973389f, 0.999231f, -1.9973389f, 0.998462f}, {0.9992783f, -1.9974333f, 0.9992783f, -1.9974333f, 0.9985565f}},
-        {{0.9708754f, -1.9408765f, 0.9708754f, -1.9408765f, 0.9417508f}, {0.9710946f, -1.9413147f, 0.9710946f, -1.9413147f, 0.9421892f}, {0.9717328f, -1.9425906f, 0.9717328f, -1.9425906f, 0.9434656f}, {0.9727361f, -1.9445962f, 0.9727361f, -1.9445962f, 0.9454722f}, {0.9740267f, -1.9471763f, 0.9740267f, -1.9471763f, 0.9480534f}, {0.9755168f, -1.9501552f, 0.9755168f, -1.9501552f, 0.9510337f}, {0.9771211f, -1.9533623f, 0.9771211f, -1.9533623f, 0.9542422f}, {0.9787655f, -1.9566496f, 0.9787655f, -1.9566496f, 0.957531f}, {0.9803916f, -1.9599004f, 0.9803916f, -1.9599004f, 0.9607833f}, {0.9819576f, -1.9630309f, 0.9819576f, -1.9630309f, 0.9639151f}, {0.983436f, -1.9659864f, 0.983436f, -1.9659864f, 0.966872f}, {0.9848116f, -1.9687363f, 0.9848116f, -1.9687363f, 0.9696231f}, {0.9860778f, -1.9712677f, 0.9860778f, -1.9712677f, 0.9721557f}, {0.9872347f, -1.9735803f, 0.9872347f, -1.9735803f, 0.9744693f}, {0.9882859f, -1.9756818f, 0.9882859f, -1.9756818f, 0.9765717f}, {0.9892378f, -1.9775847f, 0.9892378f, -1.9775847f, 0.9784755f}, {0.9900979f, -1.9793043f, 0.9900979f, -1.9793043f, 0.9801958f}, {0.9908743f, -1.9808564f, 0.9908743f, -1.9808564f, 0.9817487f}, {0.991575f, -1.982257f, 0.991575f, -1.982257f, 0.9831499f}, {0.9922074f, -1.9835214f, 0.9922074f, -1.9835214f, 0.9844149f}, {0.9927788f, -1.9846636f, 0.9927788f, -1.9846636f, 0.9855576f}, {0.9932956f, -1.9856968f, 0.9932956f, -1.9856968f, 0.9865913f}, {0.9937637f, -1.9866326f, 0.9937637f, -1.9866326f, 0.9875275f}, {0.9941884f, -1.9874815f, 0.9941884f, -1.9874815f, 0.9883767f}, {0.9945742f, -1.9882529f, 0.9945742f, -1.9882529f, 0.9891485f}, {0.9949255f, -1.9889551f, 0.9949255f, -1.9889551f, 0.989851f}, {0.9952459f, -1.9895955f, 0.9952459f, -1.9895955f, 0.9904917f}, {0.9955385f, -1.9901806f, 0.9955385f, -1.9901806f, 0.9910771f}, {0.9958065f, -1.9907162f, 0.9958065f, -1.9907162f, 0.9916129f}, {0.9960522f, -1.9912074f, 0.9960522f, -1.9912074f, 0.9921043f}, {0.9962779f, -1.9916586f, 0.9962779f, -1.9916586f, 0.9925558f}, {0.9964856f, -1.9920739f, 0.9964856f, -1.9920739f, 0.9929713f}, {0.9966772f, -1.9924569f, 0.9966772f, -1.9924569f, 0.9933544f}, {0.9968541f, -1.9928105f, 0.9968541f, -1.9928105f, 0.9937082f}, {0.9970178f, -1.9931377f, 0.9970178f, -1.9931377f, 0.9940355f}, {0.9971694f, -1.9934409f, 0.9971694f, -1.9934409f, 0.9943388f}, {0.9973102f, -1.9937222f, 0.9973102f, -1.9937222f, 0.9946203f}, {0.997441f, -1.9939838f, 0.997441f, -1.9939838f, 0.994882f}, {0.9975628f, -1.9942273f, 0.9975628f, -1.9942273f, 0.9951256f}, {0.9976763f, -1.9944542f, 0.9976763f, -1.9944542f, 0.9953526f}, {0.9977823f, -1.9946661f, 0.9977823f, -1.9946661f, 0.9955646f}, {0.9978814f, -1.9948642f, 0.9978814f, -1.9948642f, 0.9957628f}, {0.9979742f, -1.9950496f, 0.9979742f, -1.9950496f, 0.9959483f}, {0.9980611f, -1.9952234f, 0.9980611f, -1.9952234f, 0.9961222f}, {0.9981427f, -1.9953865f, 0.9981427f, -1.9953865f, 0.9962853f}, {0.9982211f, -1.9955433f, 0.9982211f, -1.9955433f, 0.9964422f}, {0.9982991f, -1.9956992f, 0.9982991f, -1.9956992f, 0.9965982f}, {0.9983764f, -1.9958538f, 0.9983764f, -1.9958538f, 0.9967529f}, {0.9984529f, -1.9960066f, 0.9984529f, -1.9960066f, 0.9969057f}, {0.9985281f, -1.996157f, 0.9985281f, -1.996157f, 0.9970562f}, {0.9986019f, -1.9963046f, 0.9986019f, -1.9963046f, 0.9972038f}, {0.998674f, -1.9964487f, 0.998674f, -1.9964487f, 0.9973481f}, {0.9987443f, -1.9965891f, 0.9987443f, -1.9965891f, 0.9974885f}, {0.9988124f, -1.9967253f, 0.9988124f, -1.9967253f, 0.9976247f}, {0.9988782f, -1.9968569f, 0.9988782f, -1.9968569f, 0.9977564f}, {0.9989416f, -1.9969836f, 0.9989416f, -1.9969836f, 0.9978832f}, {0.9990024f, -1.9971053f, 0.9990024f, -1.9971053f, 0.9980049f}, {0.9990607f, -1.9972217f, 0.9990607f, -1.9972217f, 0.9981213f}, {0.9991162f, -1.9973327f, 0.9991162f, -1.9973327f, 0.9982324f}, {0.9991691f, -1.9974384f, 0.9991691f, -1.9974384f, 0.9983381f}, {0.9992192f, -1.9975387f, 0.9992192f, -1.9975387f, 0.9984385f}, {0.9992667f, -1.9976336f, 0.9992667f, -1.9976336f, 0.9985334f}, {0.9993116f, -1.9977233f, 0.9993116f, -1.9977233f, 0.9986232f}, {0.9993539f, -1.9978079f, 0.9993539f, -1.9978079f, 0.9987078f}},
-        {{0.97385f, -1.9469975f, 0.97385f, -1.9469975f, 0.9477f}, {0.9740474f, -1.9473921f, 0.9740474f, -1.9473921f, 0.9480948f}, {0.9746221f, -1.9485412f, 0.9746221f, -1.9485412f, 0.9492443f}, {0.9755255f, -1.9503472f, 0.9755255f, -1.9503472f, 0.9510509f}, {0.9766872f, -1.9526698f, 0.9766872f, -1.9526698f, 0.9533744f}, {0.9780281f, -1.9553507f, 0.9780281f, -1.9553507f, 0.9560563f}, {0.9794713f, -1.958236f, 0.9794713f, -1.958236f, 0.9589426f}, {0.9809501f, -1.9611925f, 0.9809501f, -1.9611925f, 0.9619002f}, {0.9824119f, -1.9641151f, 0.9824119f, -1.9641151f, 0.9648239f}, {0.9838192f, -1.9669286f, 0.9838192f, -1.9669286f, 0.9676384f}, {0.9851474f, -1.969584f, 0.9851474f, -1.969584f, 0.9702947f}, {0.9863828f, -1.9720539f, 0.9863828f, -1.9720539f, 0.9727656f}, {0.9875197f, -1.974327f, 0.9875197f, -1.974327f, 0.9750395f}, {0.9885581f, -1.9764031f, 0.9885581f, -1.9764031f, 0.9771162f}, {0.9895015f, -1.9782892f, 0.9895015f, -1.9782892f, 0.979003f}, {0.9903556f, -1.9799967f, 0.9903556f, -1.9799967f, 0.9807112f}, {0.9911272f, -1.9815394f, 0.9911272f, -1.9815394f, 0.9822544f}, {0.9918236f, -1.9829316f, 0.9918236f, -1.9829316f, 0.9836472f}, {0.9924519f, -1.9841878f, 0.9924519f, -1.9841878f, 0.9849038f}, {0.993019f, -1.9853216f, 0.993019f, -1.9853216f, 0.986038f}, {0.9935313f, -1.9863458f, 0.9935313f, -1.9863458f, 0.9870625f}, {0.9939945f, -1.987272f, 0.9939945f, -1.987272f, 0.9879891f}, {0.9944141f, -1.9881108f, 0.9944141f, -1.9881108f, 0.9888282f}, {0.9947947f, -1.9888717f, 0.9947947f, -1.9888717f, 0.9895894f}, {0.9951405f, -1.9895631f, 0.9951405f, -1.9895631f, 0.990281f}, {0.9954553f, -1.9901924f, 0.9954553f, -1.9901924f, 0.9909106f}, {0.9957423f, -1.9907663f, 0.9957423f, -1.9907663f, 0.9914847f}, {0.9960046f, -1.9912906f, 0.9960046f, -1.9912906f, 0.9920092f}, {0.9962446f, -1.9917705f, 0.9962446f, -1.9917705f, 0.9924892f}, {0.9964647f, -1.9922106f, 0.9964647f, -1.9922106f, 0.9929295f}, {0.9966669f, -1.9926149f, 0.9966669f, -1.9926149f, 0.9933339f}, {0.9968531f, -1.992987f, 0.9968531f, -1.992987f, 0.9937061f}, {0.9970246f, -1.99333f, 0.9970246f, -1.99333f, 0.9940493f}, {0.9971831f, -1.9936468f, 0.9971831f, -1.9936468f, 0.9943662f}, {0.9973297f, -1.9939399f, 0.9973297f, -1.9939399f, 0.9946594f}, {0.9974655f, -1.9942114f, 0.9974655f, -1.9942114f, 0.994931f}, {0.9975916f, -1.9944635f, 0.9975916f, -1.9944635f, 0.9951832f}, {0.9977088f, -1.9946977f, 0.9977088f, -1.9946977f, 0.9954175f}, {0.9978178f, -1.9949158f, 0.9978178f, -1.9949158f, 0.9956357f}, {0.9979195f, -1.9951191f, 0.9979195f, -1.9951191f, 0.995839f}, {0.9980144f, -1.9953089f, 0.9980144f, -1.9953089f, 0.9960289f}, {0.9981032f, -1.9954863f, 0.9981032f, -1.9954863f, 0.9962063f}, {0.9981862f, -1.9956523f, 0.9981862f, -1.9956523f, 0.9963725f}, {0.9982641f, -1.995808f, 0.9982641f, -1.995808f, 0.9965282f}, {0.9983371f, -1.995954f, 0.9983371f, -1.995954f, 0.9966743f}, {0.9984074f, -1.9960945f, 0.9984074f, -1.9960945f, 0.9968148f}, {0.9984772f, -1.9962341f, 0.9984772f, -1.9962341f, 0.9969544f}, {0.9985465f, -1.9963726f, 0.9985465f, -1.9963726f, 0.9970929f}, {0.9986149f, -1.9965093f, 0.9986149f, -1.9965093f, 0.9972298f}, {0.9986823f, -1.996644f, 0.9986823f, -1.996644f, 0.9973645f}, {0.9987483f, -1.9967762f, 0.9987483f, -1.9967762f, 0.9974967f}, {0.9988129f, -1.9969053f, 0.9988129f, -1.9969053f, 0.9976259f}, {0.9988758f, -1.997031f, 0.9988758f, -1.997031f, 0.9977516f}, {0.9989368f, -1.9971529f, 0.9989368f, -1.9971529f, 0.9978736f}, {0.9989957f, -1.9972707f, 0.9989957f, -1.9972707f, 0.9979915f}, {0.9990525f, -1.9973842f, 0.9990525f, -1.9973842f, 0.998105f}, {0.999107f, -1.9974932f, 0.999107f, -1.9974932f, 0.9982139f}, {0.9991591f, -1.9975974f, 0.9991591f, -1.9975974f, 0.9983182f}, {0.9992088f, -1.9976968f, 0.9992088f, -1.9976968f, 0.9984177f}, {0.9992562f, -1.9977914f, 0.9992562f, -1.9977914f, 0.9985123f}, {0.9993011f, -1.9978812f, 0.9993011f, -1.9978812f, 0.9986021f}, {0.9993436f, -1.9979662f, 0.9993436f, -1.9979662f, 0.9986871f}, {0.9993837f, -1.9980465f, 0.9993837f, -1.9980465f, 0.9987675f}, {0.9994216f, -1.9981222f, 0.9994216f, -1.9981222f, 0.9988432f}},
-        {{0.9765285f, -1.9524926f, 0.9765285f, -1.9524926f, 0.953057f}, {0.9767062f, -1.9528479f, 0.9767062f, -1.9528479f, 0.9534124f}, {0.9772234f, -1.953882f, 0.9772234f, -1.953882f, 0.9544468f}, {0.9780362f, -1.9555072f, 0.9780362f, -1.9555072f, 0.9560724f}, {0.9790813f, -1.9575968f, 0.9790813f, -1.9575968f, 0.9581627f}, {0.9802873f, -1.9600081f, 0.9802873f, -1.9600081f, 0.9605747f}, {0.9815849f, -1.9626025f, 0.9815849f, -1.9626025f, 0.9631698f}, {0.9829141f, -1.9652601f, 0.9829141f, -1.9652601f, 0.9658282f}, {0.9842276f, -1.9678865f, 0.9842276f, -1.9678865f, 0.9684553f}, {0.9854918f, -1.9704139f, 0.9854918f, -1.9704139f, 0.9709835f}, {0.9866845f, -1.9727988f, 0.9866845f, -1.9727988f, 0.973369f}, {0.9877937f, -1.9750164f, 0.9877937f, -1.9750164f, 0.9755873f}, {0.9888141f, -1.9770568f, 0.9888141f, -1.9770568f, 0.9776283f}, {0.989746f, -1.9789199f, 0.989746f, -1.9789199f, 0.9794919f}, {0.9905923f, -1.9806121f, 0.9905923f, -1.9806121f, 0.9811847f}, {0.9913585f, -1.9821439f, 0.9913585f, -1.9821439f, 0.9827169f}, {0.9920505f, -1.9835276f, 0.9920505f, -1.9835276f, 0.984101f}, {0.9926749f, -1.9847761f, 0.9926749f, -1.9847761f, 0.9853498f}, {0.9932383f, -1.9859024f, 0.9932383f, -1.9859024f, 0.9864765f}, {0.9937466f, -1.9869189f, 0.9937466f, -1.9869189f, 0.9874933f}, {0.9942058f, -1.9878371f, 0.9942058f, -1.9878371f, 0.9884117f}, {0.9946211f, -1.9886673f, 0.9946211f, -1.9886673f, 0.9892421f}, {0.9949971f, -1.9894191f, 0.9949971f, -1.9894191f, 0.9899942f}, {0.9953381f, -1.990101f, 0.9953381f, -1.990101f, 0.9906763f}, {0.995648f, -1.9907206f, 0.995648f, -1.9907206f, 0.991296f}, {0.99593f, -1.9912845f, 0.99593f, -1.9912845f, 0.9918601f}, {0.9961872f, -1.9917987f, 0.9961872f, -1.9917987f, 0.9923744f}, {0.9964222f, -1.9922684f, 0.9964222f, -1.9922684f, 0.9928443f}, {0.9966372f, -1.9926984f, 0.9966372f, -1.9926984f, 0.9932744f}, {0.9968344f, -1.9930926f, 0.9968344f, -1.9930926f, 0.9936687f}, {0.9970155f, -1.9934548f, 0.9970155f, -1.9934548f, 0.994031f}, {0.9971822f, -1.9937881f, 0.9971822f, -1.9937881f, 0.9943644f}, {0.9973359f, -1.9940954f, 0.9973359f, -1.9940954f, 0.9946718f}, {0.9974778f, -1.9943791f, 0.9974778f, -1.9943791f, 0.9949556f}, {0.9976091f, -1.9946416f, 0.9976091f, -1.9946416f, 0.9952182f}, {0.9977308f, -1.9948849f, 0.9977308f, -1.9948849f, 0.9954615f}, {0.9978437f, -1.9951106f, 0.9978437f, -1.9951106f, 0.9956873f}, {0.9979486f, -1.9953204f, 0.9979486f, -1.9953204f, 0.9958972f}, {0.9980463f, -1.9955157f, 0.9980463f, -1.9955157f, 0.9960925f}, {0.9981373f, -1.9956978f, 0.9981373f, -1.9956978f, 0.9962747f}, {0.9982223f, -1.9958677f, 0.9982223f, -1.9958677f, 0.9964447f}, {0.9983018f, -1.9960266f, 0.9983018f, -1.9960266f, 0.9966036f}, {0.9983762f, -1.9961753f, 0.9983762f, -1.9961753f, 0.9967523f}, {0.9984459f, -1.9963147f, 0.9984459f, -1.9963147f, 0.9968918f}, {0.9985113f, -1.9964455f, 0.9985113f, -1.9964455f, 0.9970226f}, {0.9985742f, -1.9965712f, 0.9985742f, -1.9965712f, 0.9971484f}, {0.9986367f, -1.9966963f, 0.9986367f, -1.9966963f, 0.9972735f}, {0.9986987f, -1.9968202f, 0.9986987f, -1.9968202f, 0.9973975f}, {0.99876f, -1.9969427f, 0.99876f, -1.9969427f, 0.99752f}, {0.9988203f, -1.9970633f, 0.9988203f, -1.9970633f, 0.9976406f}, {0.9988795f, -1.9971817f, 0.9988795f, -1.9971817f, 0.997759f}, {0.9989373f, -1.9972973f, 0.9989373f, -1.9972973f, 0.9978746f}, {0.9989936f, -1.9974098f, 0.9989936f, -1.9974098f, 0.9979872f}, {0.9990482f, -1.997519f, 0.9990482f, -1.997519f, 0.9980964f}, {0.999101f, -1.9976245f, 0.999101f, -1.9976245f, 0.9982019f}, {0.9991518f, -1.9977261f, 0.9991518f, -1.9977261f, 0.9983036f}, {0.9992006f, -1.9978236f, 0.9992006f, -1.9978236f, 0.9984011f}, {0.9992472f, -1.9979169f, 0.9992472f, -1.9979169f, 0.9984945f}, {0.9992918f, -1.998006f, 0.9992918f, -1.998006f, 0.9985835f}, {0.9993341f, -1.9980907f, 0.9993341f, -1.9980907f, 0.9986682f}, {0.9993743f, -1.998171f, 0.9993743f, -1.998171f, 0.9987486f}, {0.9994124f, -1.9982471f, 0.9994124f, -1.9982471f, 0.9988248f}, {0.9994483f, -1.998319f, 0.9994483f, -1.998319f, 0.9988967f}, {0.9994823f, -1.9983869f, 0.9994823f, -1.9983869f, 0.9989645f}},
-        {{0.9789388f, -1.9574244f, 0.9789388f, -1.9574244f, 0.9578777f}, {0.9790986f, -1.9577439f, 0.9790986f, -1.9577439f, 0.9581973f}, {0.9795639f, -1.9586741f, 0.9795639f, -1.9586741f, 0.9591277f}, {0.9802948f, -1.9601358f, 0.9802948f, -1.9601358f, 0.9605897f}, {0.9812345f, -1.9620147f, 0.9812345f, -1.9620147f, 0.9624691f}, {0.9823186f, -1.9641824f, 0.9823186f, -1.9641824f, 0.9646373f}, {0.9834848f, -1.9665142f, 0.9834848f, -1.9665142f, 0.9669695f}, {0.9846789f, -1.968902f, 0.9846789f, -1.968902f, 0.9693579f}, {0.9858588f, -1.9712611f, 0.9858588f, -1.9712611f, 0.9717176f}, {0.9869939f, -1.9735308f, 0.9869939f, -1.9735308f, 0.9739878f}, {0.9880646f, -1.9756718f, 0.9880646f, -1.9756718f, 0.9761293f}, {0.9890601f, -1.9776622f, 0.9890601f, -1.9776622f, 0.9781202f}, {0.9899758f, -1.9794932f, 0.9899758f, -1.9794932f, 0.9799516f}, {0.9908117f, -1.9811647f, 0.9908117f, -1.9811647f, 0.9816235f}, {0.9915709f, -1.9826827f, 0.9915709f, -1.9826827f, 0.9831418f}, {0.9922579f, -1.9840564f, 0.9922579f, -1.9840564f, 0.9845159f}, {0.9928784f, -1.9852972f, 0.9928784f, -1.9852972f, 0.9857569f}, {0.9934383f, -1.9864166f, 0.9934383f, -1.9864166f, 0.9868766f}, {0.9939433f, -1.9874263f, 0.9939433f, -1.9874263f, 0.9878865f}, {0.994399f, -1.9883375f, 0.994399f, -1.9883375f, 0.9887979f}, {0.9948105f, -1.9891604f, 0.9948105f, -1.9891604f, 0.989621f}, {0.9951826f, -1.9899044f, 0.9951826f, -1.9899044f, 0.9903652f}, {0.9955195f, -1.9905781f, 0.9955195f, -1.9905781f, 0.9910391f}, {0.9958251f, -1.9911892f, 0.9958251f, -1.9911892f, 0.9916503f}, {0.9961028f, -1.9917443f, 0.9961028f, -1.9917443f, 0.9922055f}, {0.9963554f, -1.9922495f, 0.9963554f, -1.9922495f, 0.9927108f}, {0.9965858f, -1.9927102f, 0.9965858f, -1.9927102f, 0.9931716f}, {0.9967963f, -1.993131f, 0.9967963f, -1.993131f, 0.9935925f}, {0.9969889f, -1.9935162f, 0.9969889f, -1.9935162f, 0.9939778f}, {0.9971655f, -1.9938693f, 0.9971655f, -1.9938693f, 0.994331f}, {0.9973277f, -1.9941937f, 0.9973277f, -1.9941937f, 0.9946555f}, {0.9974771f, -1.9944922f, 0.9974771f, -1.9944922f, 0.9949541f}, {0.9976147f, -1.9947675f, 0.9976147f, -1.9947675f, 0.9952294f}, {0.9977418f, -1.9950216f, 0.9977418f, -1.9950216f, 0.9954836f}, {0.9978594f, -1.9952567f, 0.9978594f, -1.9952567f, 0.9957188f}, {0.9979683f, -1.9954746f, 0.9979683f, -1.9954746f, 0.9959366f}, {0.9980694f, -1.9956767f, 0.9980694f, -1.9956767f, 0.9961388f}, {0.9981634f, -1.9958646f, 0.9981634f, -1.9958646f, 0.9963268f}, {0.9982509f, -1.9960395f, 0.9982509f, -1.9960395f, 0.9965017f}, {0.9983324f, -1.9962025f, 0.9983324f, -1.9962025f, 0.9966648f}, {0.9984085f, -1.9963547f, 0.9984085f, -1.9963547f, 0.996817f}, {0.9984797f, -1.996497f, 0.9984797f, -1.996497f, 0.9969593f}, {0.9985463f, -1.9966302f, 0.9985463f, -1.9966302f, 0.9970925f}, {0.9986087f, -1.996755f, 0.9986087f, -1.996755f, 0.9972174f}, {0.9986672f, -1.9968721f, 0.9986672f, -1.9968721f, 0.9973345f}, {0.9987236f, -1.9969847f, 0.9987236f, -1.9969847f, 0.9974471f}, {0.9987796f, -1.9970967f, 0.9987796f, -1.9970967f, 0.9975591f}, {0.9988351f, -1.9972077f, 0.9988351f, -1.9972077f, 0.9976701f}, {0.9988899f, -1.9973173f, 0.9988899f, -1.9973173f, 0.9977799f}, {0.9989439f, -1.9974253f, 0.9989439f, -1.9974253f, 0.9978879f}, {0.9989969f, -1.9975313f, 0.9989969f, -1.9975313f, 0.9979938f}, {0.9990487f, -1.9976348f, 0.9990487f, -1.9976348f, 0.9980974f}, {0.9990991f, -1.9977355f, 0.9990991f, -1.9977355f, 0.9981982f}, {0.999148f, -1.9978333f, 0.999148f, -1.9978333f, 0.9982959f}, {0.9991952f, -1.9979278f, 0.9991952f, -1.9979278f, 0.9983904f}, {0.9992407f, -1.9980187f, 0.9992407f, -1.9980187f, 0.9984814f}, {0.9992844f, -1.998106f, 0.9992844f, -1.998106f, 0.9985687f}, {0.9993262f, -1.9981896f, 0.9993262f, -1.9981896f, 0.9986523f}, {0.999366f, -1.9982693f, 0.999366f, -1.9982693f, 0.998732f}, {0.9994039f, -1.9983451f, 0.9994039f, -1.9983451f, 0.9988079f}, {0.9994399f, -1.9984171f, 0.9994399f, -1.9984171f, 0.9988798f}, {0.999474f, -1.9984852f, 0.999474f, -1.9984852f, 0.998948f}, {0.9995062f, -1.9985496f, 0.9995062f, -1.9985496f, 0.9990124f}, {0.9995365f, -1.9986103f, 0.9995365f, -1.9986103f, 0.9990731f}},
-        {{0.9811066f, -1.9618493f, 0.9811066f, -1.9618493f, 0.9622132f}, {0.9812503f, -1.9621366f, 0.9812503f, -1.9621366f, 0.9625006f}, {0.9816685f, -1.9629728f, 0.9816685f, -1.9629728f, 0.963337f}, {0.9823255f, -1.9642867f, 0.9823255f, -1.9642867f, 0.9646511f}, {0.9831701f, -1.9659754f, 0.9831701f, -1.9659754f, 0.9663401f}, {0.9841442f, -1.9679233f, 0.9841442f, -1.9679233f, 0.9682883f}, {0.9851917f, -1.970018f, 0.9851917f, -1.970018f, 0.9703834f}, {0.9862642f, -1.9721625f, 0.9862642f, -1.9721625f, 0.9725284f}, {0.9873235f, -1.9742808f, 0.9873235f, -1.9742808f, 0.974647f}, {0.9883424f, -1.9763183f, 0.9883424f, -1.9763183f, 0.9766849f}, {0.9893034f, -1.9782398f, 0.9893034f, -1.9782398f, 0.9786068f}, {0.9901965f, -1.9800258f, 0.9901965f, -1.9800258f, 0.9803931f}, {0.991018f, -1.9816683f, 0.991018f, -1.9816683f, 0.9820359f}, {0.9917677f, -1.9831676f, 0.9917677f, -1.9831676f, 0.9835355f}, {0.9924485f, -1.9845289f, 0.9924485f, -1.9845289f, 0.984897f}, {0.9930645f, -1.9857607f, 0.9930645f, -1.9857607f, 0.986129f}, {0.9936208f, -1.986873f, 0.9936208f, -1.986873f, 0.9872416f}, {0.9941226f, -1.9878765f, 0.9941226f, -1.9878765f, 0.9882452f}, {0.9945752f, -1.9887815f, 0.9945752f, -1.9887815f, 0.9891505f}, {0.9949836f, -1.9895981f, 0.9949836f, -1.9895981f, 0.9899672f}, {0.9953524f, -1.9903356f, 0.9953524f, -1.9903356f, 0.9907048f}, {0.9956858f, -1.9910023f, 0.9956858f, -1.9910023f, 0.9913716f}, {0.9959877f, -1.991606f, 0.9959877f, -1.991606f, 0.9919754f}, {0.9962615f, -1.9921534f, 0.9962615f, -1.9921534f, 0.992523f}, {0.9965102f, -1.9926507f, 0.9965102f, -1.9926507f, 0.9930204f}, {0.9967365f, -1.9931033f, 0.9967365f, -1.9931033f, 0.9934731f}, {0.9969429f, -1.993516f, 0.9969429f, -1.993516f, 0.9938858f}, {0.9971314f, -1.9938929f, 0.9971314f, -1.9938929f, 0.9942628f}, {0.9973039f, -1.9942379f, 0.9973039f, -1.9942379f, 0.9946079f}, {0.9974621f, -1.9945542f, 0.9974621f, -1.9945542f, 0.9949242f}, {0.9976074f, -1.9948448f, 0.9976074f, -1.9948448f, 0.9952148f}, {0.9977411f, -1.9951122f, 0.9977411f, -1.9951122f, 0.9954823f}, {0.9978644f, -1.9953586f, 0.9978644f, -1.9953586f, 0.9957288f}, {0.9979782f, -1.9955863f, 0.9979782f, -1.9955863f, 0.9959565f}, {0.9980835f, -1.9957968f, 0.9980835f, -1.9957968f, 0.996167f}, {0.9981811f, -1.9959919f, 0.9981811f, -1.9959919f, 0.9963622f}, {0.9982716f, -1.9961729f, 0.9982716f, -1.9961729f, 0.9965432f}, {0.9983558f, -1.9963412f, 0.9983558f, -1.9963412f, 0.9967115f}, {0.9984341f, -1.9964978f, 0.9984341f, -1.9964978f, 0.9968681f}, {0.9985071f, -1.9966438f, 0.9985071f, -1.9966438f, 0.9970142f}, {0.9985752f, -1.9967801f, 0.9985752f, -1.9967801f, 0.9971505f}, {0.9986389f, -1.9969075f, 0.9986389f, -1.9969075f, 0.9972779f}, {0.9986986f, -1.9970267f, 0.9986986f, -1.9970267f, 0.9973971f}, {0.9987545f, -1.9971384f, 0.9987545f, -1.9971384f, 0.9975089f}, {0.9988069f, -1.9972433f, 0.9988069f, -1.9972433f, 0.9976138f}, {0.9988573f, -1.9973441f, 0.9988573f, -1.9973441f, 0.9977146f}, {0.9989075f, -1.9974444f, 0.9989075f, -1.9974444f, 0.9978149f}, {0.9989572f, -1.9975438f, 0.9989572f, -1.9975438f, 0.9979143f}, {0.9990063f, -1.997642f, 0.9990063f, -1.997642f, 0.9980125f}, {0.9990546f, -1.9977386f, 0.9990546f, -1.9977386f, 0.9981092f}, {0.999102f, -1.9978335f, 0.999102f, -1.9978335f, 0.9982041f}, {0.9991484f, -1.9979262f, 0.9991484f, -1.9979262f, 0.9982968f}, {0.9991935f, -1.9980164f, 0.9991935f, -1.9980164f, 0.998387f}, {0.9992373f, -1.9981039f, 0.9992373f, -1.9981039f, 0.9984746f}, {0.9992796f, -1.9981885f, 0.9992796f, -1.9981885f, 0.9985591f}, {0.9993203f, -1.9982699f, 0.9993203f, -1.9982699f, 0.9986406f}, {0.9993594f, -1.9983481f, 0.9993594f, -1.9983481f, 0.9987188f}, {0.9993968f, -1.9984229f, 0.9993968f, -1.9984229f, 0.9987936f}, {0.9994325f, -1.9984942f, 0.9994325f, -1.9984942f, 0.998865f}, {0.9994664f, -1.9985621f, 0.9994664f, -1.9985621f, 0.9989329f}, {0.9994986f, -1.9986265f, 0.9994986f, -1.9986265f, 0.9989973f}, {0.9995292f, -1.9986875f, 0.9995292f, -1.9986875f, 0.9990583f}, {0.999558f, -1.9987452f, 0.999558f, -1.9987452f, 0.9991159f}, {0.9995851f, -1.9987995f, 0.9995851f, -1.9987995f, 0.9991703f}},
-        {{0.9830552f, -1.9658183f, 0.9830552f, -1.9658183f, 0.9661105f}, {0.9831843f, -1.9660765f, 0.9831843f, -1.9660765f, 0.9663687f}, {0.9835601f, -1.966828f, 0.9835601f, -1.966828f, 0.9671203f}, {0.9841505f, -1.9680085f, 0.9841505f, -1.9680085f, 0.968301f}, {0.9849092f, -1.9695256f, 0.9849092f, -1.9695256f, 0.9698183f}, {0.985784f, -1.9712751f, 0.985784f, -1.9712751f, 0.9715681f}, {0.9867247f, -1.9731562f, 0.9867247f, -1.9731562f, 0.9734494f}, {0.9876876f, -1.9750816f, 0.9876876f, -1.9750816f, 0.9753751f}, {0.9886384f, -1.976983f, 0.9886384f, -1.976983f, 0.9772768f}, {0.9895527f, -1.9788114f, 0.9895527f, -1.9788114f, 0.9791055f}, {0.9904149f, -1.9805354f, 0.9904149f, -1.9805354f, 0.9808297f}, {0.991216f, -1.9821375f, 0.991216f, -1.9821375f, 0.9824321f}, {0.9919527f, -1.9836107f, 0.9919527f, -1.9836107f, 0.9839055f}, {0.9926251f, -1.9849551f, 0.9926251f, -1.9849551f, 0.9852501f}, {0.9932354f, -1.9861757f, 0.9932354f, -1.9861757f, 0.9864708f}, {0.9937876f, -1.98728f, 0.9937876f, -1.98728f, 0.9875753f}, {0.9942863f, -1.988277f, 0.9942863f, -1.988277f, 0.9885725f}, {0.994736f, -1.9891764f, 0.994736f, -1.9891764f, 0.989472f}, {0.9951416f, -1.9899875f, 0.9951416f, -1.9899875f, 0.9902832f}, {0.9955075f, -1.9907192f, 0.9955075f, -1.9907192f, 0.9910151f}, {0.995838f, -1.99138f, 0.995838f, -1.99138f, 0.9916759f}, {0.9961367f, -1.9919774f, 0.9961367f, -1.9919774f, 0.9922734f}, {0.9964071f, -1.9925182f, 0.9964071f, -1.9925182f, 0.9928143f}, {0.9966524f, -1.9930086f, 0.9966524f, -1.9930086f, 0.9933048f}, {0.9968752f, -1.9934541f, 0.9968752f, -1.9934541f, 0.9937504f}, {0.9970779f, -1.9938595f, 0.9970779f, -1.9938595f, 0.9941558f}, {0.9972628f, -1.9942292f, 0.9972628f, -1.9942292f, 0.9945255f}, {0.9974316f, -1.9945668f, 0.9974316f, -1.9945668f, 0.9948632f}, {0.9975861f, -1.9948758f, 0.9975861f, -1.9948758f, 0.9951722f}, {0.9977278f, -1.9951591f, 0.9977278f, -1.9951591f, 0.9954556f}, {0.9978579f, -1.9954193f, 0.9978579f, -1.9954193f, 0.9957158f}, {0.9979776f, -1.9956587f, 0.9979776f, -1.9956587f, 0.9959553f}, {0.998088f, -1.9958795f, 0.998088f, -1.9958795f, 0.9961761f}, {0.99819f, -1.9960833f, 0.99819f, -1.9960833f, 0.9963799f}, {0.9982842f, -1.9962718f, 0.9982842f, -1.9962718f, 0.9965685f}, {0.9983716f, -1.9964465f, 0.9983716f, -1.9964465f, 0.9967432f}, {0.9984527f, -1.9966086f, 0.9984527f, -1.9966086f, 0.9969053f}, {0.998528f, -1.9967593f, 0.998528f, -1.9967593f, 0.997056f}, {0.9985981f, -1.9968995f, 0.9985981f, -1.9968995f, 0.9971963f}, {0.9986635f, -1.9970302f, 0.9986635f, -1.9970302f, 0.997327f}, {0.9987245f, -1.9971523f, 0.9987245f, -1.9971523f, 0.9974491f}, {0.9987816f, -1.9972663f, 0.9987816f, -1.9972663f, 0.9975631f}, {0.998835f, -1.9973731f, 0.998835f, -1.9973731f, 0.9976699f}, {0.998885f, -1.9974731f, 0.998885f, -1.9974731f, 0.99777f}, {0.9989319f, -1.997567f, 0.9989319f, -1.997567f, 0.9978639f}, {0.9989771f, -1.9976573f, 0.9989771f, -1.9976573f, 0.9979542f}, {0.999022f, -1.9977471f, 0.999022f, -1.9977471f, 0.9980439f}, {0.9990665f, -1.997836f, 0.9990665f, -1.997836f, 0.9981329f}, {0.9991104f, -1.997924f, 0.9991104f, -1.997924f, 0.9982209f}, {0.9991537f, -1.9980105f, 0.9991537f, -1.9980105f, 0.9983074f}, {0.9991962f, -1.9980954f, 0.9991962f, -1.9980954f, 0.9983924f}, {0.9992377f, -1.9981784f, 0.9992377f, -1.9981784f, 0.9984753f}, {0.9992781f, -1.9982592f, 0.9992781f, -1.9982592f, 0.9985561f}, {0.9993172f, -1.9983375f, 0.9993172f, -1.9983375f, 0.9986345f}, {0.9993551f, -1.9984132f, 0.9993551f, -1.9984132f, 0.9987102f}, {0.9993916f, -1.9984861f, 0.9993916f, -1.9984861f, 0.9987831f}, {0.9994266f, -1.9985561f, 0.9994266f, -1.9985561f, 0.9988531f}, {0.9994601f, -1.9986231f, 0.9994601f, -1.9986231f, 0.9989201f}, {0.999492f, -1.998687f, 0.999492f, -1.998687f, 0.998984f}, {0.9995224f, -1.9987477f, 0.9995224f, -1.9987477f, 0.9990448f}, {0.9995512f, -1.9988054f, 0.9995512f, -1.9988054f, 0.9991024f}, {0.9995785f, -1.99886f, 0.9995785f, -1.99886f, 0.9991571f}, {0.9996043f, -1.9989116f, 0.9996043f, -1.9989116f, 0.9992087f}, {0.9996287f, -1.9989602f, 0.9996287f, -1.9989602f, 0.9992573f}},
-        {{0.9848061f, -1.9693777f, 0.9848061f, -1.9693777f, 0.9696122f}, {0.9849221f, -1.9696096f, 0.9849221f, -1.9696096f, 0.9698441f}, {0.9852596f, -1.9702847f, 0.9852596f, -1.9702847f, 0.9705192f}, {0.9857898f, -1.9713449f, 0.9857898f, -1.9713449f, 0.9715796f}, {0.9864711f, -1.9727073f, 0.9864711f, -1.9727073f, 0.9729422f}, {0.9872566f, -1.9742782f, 0.9872566f, -1.9742782f, 0.9745132f}, {0.988101f, -1.9759668f, 0.988101f, -1.9759668f, 0.976202f}, {0.9889651f, -1.9776948f, 0.9889651f, -1.9776948f, 0.9779303f}, {0.9898183f, -1.979401f, 0.9898183f, -1.979401f, 0.9796366f}, {0.9906386f, -1.9810414f, 0.9906386f, -1.9810414f, 0.9812772f}, {0.9914119f, -1.9825878f, 0.9914119f, -1.9825878f, 0.9828238f}, {0.9921304f, -1.9840246f, 0.9921304f, -1.9840246f, 0.9842608f}, {0.992791f, -1.9853456f, 0.992791f, -1.9853456f, 0.985582f}, {0.9933937f, -1.986551f, 0.9933937f, -1.986551f, 0.9867875f}, {0.9939409f, -1.9876451f, 0.9939409f, -1.9876451f, 0.9878817f}, {0.9944358f, -1.9886349f, 0.9944358f, -1.9886349f, 0.9888717f}, {0.9948827f, -1.9895285f, 0.9948827f, -1.9895285f, 0.9897654f}, {0.9952857f, -1.9903345f, 0.9952857f, -1.9903345f, 0.9905714f}, {0.9956491f, -1.9910612f, 0.9956491f, -1.9910612f, 0.9912983f}, {0.995977f, -1.9917169f, 0.995977f, -1.9917169f, 0.991954f}, {0.996273f, -1.9923089f, 0.996273f, -1.9923089f, 0.9925461f}, {0.9965406f, -1.992844f, 0.9965406f, -1.992844f, 0.9930813f}, {0.9967829f, -1.9933285f, 0.9967829f, -1.9933285f, 0.9935658f}, {0.9970026f, -1.9937678f, 0.9970026f, -1.9937678f, 0.9940052f}, {0.9972021f, -1.9941668f, 0.9972021f, -1.9941668f, 0.9944042f}, {0.9973837f, -1.99453f, 0.9973837f, -1.99453f, 0.9947674f}, {0.9975492f, -1.994861f, 0.9975492f, -1.994861f, 0.9950985f}, {0.9977005f, -1.9951634f, 0.9977005f, -1.9951634f, 0.9954009f}, {0.9978388f, -1.9954401f, 0.9978388f, -1.9954401f, 0.9956777f}, {0.9979657f, -1.9956938f, 0.9979657f, -1.9956938f, 0.9959314f}, {0.9980822f, -1.9959268f, 0.9980822f, -1.9959268f, 0.9961644f}, {0.9981895f, -1.9961413f, 0.9981895f, -1.9961413f, 0.9963789f}, {0.9982883f, -1.9963389f, 0.9982883f, -1.9963389f, 0.9965766f}, {0.9983796f, -1.9965214f, 0.9983796f, -1.9965214f, 0.9967591f}, {0.998464f, -1.9966903f, 0.998464f, -1.9966903f, 0.996928f}, {0.9985422f, -1.9968467f, 0.9985422f, -1.9968467f, 0.9970844f}, {0.9986148f, -1.9969918f, 0.9986148f, -1.9969918f, 0.9972296f}, {0.9986822f, -1.9971267f, 0.9986822f, -1.9971267f, 0.9973645f}, {0.998745f, -1.9972523f, 0.998745f, -1.9972523f, 0.9974901f}, {0.9988036f, -1.9973693f, 0.9988036f, -1.9973693f, 0.9976071f}, {0.9988582f, -1.9974786f, 0.9988582f, -1.9974786f, 0.9977164f}, {0.9989093f, -1.9975807f, 0.9989093f, -1.9975807f, 0.9978185f}, {0.9989571f, -1.9976763f, 0.9989571f, -1.9976763f, 0.9979141f}, {0.9990019f, -1.9977659f, 0.9990019f, -1.9977659f, 0.9980037f}, {0.9990439f, -1.9978499f, 0.9990439f, -1.9978499f, 0.9980878f}, {0.9990843f, -1.9979308f, 0.9990843f, -1.9979308f, 0.9981686f}, {0.9991245f, -1.9980111f, 0.9991245f, -1.9980111f, 0.998249f}, {0.9991643f, -1.9980908f, 0.9991643f, -1.9980908f, 0.9983287f}, {0.9992037f, -1.9981695f, 0.9992037f, -1.9981695f, 0.9984074f}, {0.9992424f, -1.998247f, 0.9992424f, -1.998247f, 0.9984849f}, {0.9992805f, -1.998323f, 0.9992805f, -1.998323f, 0.9985609f}, {0.9993176f, -1.9983973f, 0.9993176f, -1.9983973f, 0.9986352f}, {0.9993538f, -1.9984696f, 0.9993538f, -1.9984696f, 0.9987075f}, {0.9993888f, -1.9985397f, 0.9993888f, -1.9985397f, 0.9987777f}, {0.9994227f, -1.9986075f, 0.9994227f, -1.9986075f, 0.9988455f}, {0.9994554f, -1.9986728f, 0.9994554f, -1.9986728f, 0.9989107f}, {0.9994867f, -1.9987354f, 0.9994867f, -1.9987354f, 0.9989734f}, {0.9995167f, -1.9987954f, 0.9995167f, -1.9987954f, 0.9990334f}, {0.9995453f, -1.9988526f, 0.9995453f, -1.9988526f, 0.9990905f}, {0.9995725f, -1.998907f, 0.9995725f, -1.998907f, 0.999145f}, {0.9995983f, -1.9989586f, 0.9995983f, -1.9989586f, 0.9991966f}, {0.9996227f, -1.9990075f, 0.9996227f, -1.9990075f, 0.9992455f}, {0.9996458f, -1.9990537f, 0.9996458f, -1.9990537f, 0.9992917f}, {0.9996676f, -1.9990972f, 0.9996676f, -1.9990972f, 0.9993352f}},
-        {{0.9863786f, -1.9725691f, 0.9863786f, -1.9725691f, 0.9727572f}, {0.9864827f, -1.9727773f, 0.9864827f, -1.9727773f, 0.9729655f}, {0.9867858f, -1.9733834f, 0.9867858f, -1.9733834f, 0.9735716f}, {0.9872618f, -1.9743354f, 0.9872618f, -1.9743354f, 0.9745237f}, {0.9878734f, -1.9755584f, 0.9878734f, -1.9755584f, 0.9757468f}, {0.9885784f, -1.9769683f, 0.9885784f, -1.9769683f, 0.9771569f}, {0.9893362f, -1.9784837f, 0.9893362f, -1.9784837f, 0.9786724f}, {0.9901115f, -1.9800342f, 0.9901115f, -1.9800342f, 0.9802231f}, {0.9908769f, -1.9815648f, 0.9908769f, -1.9815648f, 0.9817538f}, {0.9916126f, -1.9830361f, 0.9916126f, -1.9830361f, 0.9832253f}, {0.9923061f, -1.9844229f, 0.9923061f, -1.9844229f, 0.9846122f}, {0.9929503f, -1.9857113f, 0.9929503f, -1.9857113f, 0.9859006f}, {0.9935425f, -1.9868955f, 0.9935425f, -1.9868955f, 0.987085f}, {0.9940828f, -1.987976f, 0.9940828f, -1.987976f, 0.9881656f}, {0.9945732f, -1.9889567f, 0.9945732f, -1.9889567f, 0.9891464f}, {0.9950167f, -1.9898437f, 0.9950167f, -1.9898437f, 0.9900335f}, {0.9954172f, -1.9906445f, 0.9954172f, -1.9906445f, 0.9908343f}, {0.9957783f, -1.9913666f, 0.9957783f, -1.9913666f, 0.9915565f}, {0.9961039f, -1.9920178f, 0.9961039f, -1.9920178f, 0.9922078f}, {0.9963976f, -1.9926051f, 0.9963976f, -1.9926051f, 0.9927952f}, {0.9966628f, -1.9931355f, 0.9966628f, -1.9931355f, 0.9933256f}, {0.9969025f, -1.9936148f, 0.9969025f, -1.9936148f, 0.993805f}, {0.9971195f, -1.9940488f, 0.9971195f, -1.9940488f, 0.994239f}, {0.9973162f, -1.9944423f, 0.9973162f, -1.9944423f, 0.9946325f}, {0.997495f, -1.9947997f, 0.997495f, -1.9947997f, 0.9949899f}, {0.9976576f, -1.9951249f, 0.9976576f, -1.9951249f, 0.9953152f}, {0.9978058f, -1.9954214f, 0.9978058f, -1.9954214f, 0.9956117f}, {0.9979412f, -1.9956921f, 0.9979412f, -1.9956921f, 0.9958825f}, {0.9980652f, -1.99594f, 0.9980652f, -1.99594f, 0.9961303f}, {0.9981788f, -1.9961671f, 0.9981788f, -1.9961671f, 0.9963575f}, {0.9982831f, -1.9963758f, 0.9982831f, -1.9963758f, 0.9965662f}, {0.9983791f, -1.9965678f, 0.9983791f, -1.9965678f, 0.9967582f}, {0.9984676f, -1.9967448f, 0.9984676f, -1.9967448f, 0.9969352f}, {0.9985493f, -1.9969082f, 0.9985493f, -1.9969082f, 0.9970987f}, {0.9986249f, -1.9970594f, 0.9986249f, -1.9970594f, 0.9972499f}, {0.998695f, -1.9971995f, 0.998695f, -1.9971995f, 0.9973899f}, {0.99876f, -1.9973294f, 0.99876f, -1.9973294f, 0.9975199f}, {0.9988203f, -1.9974502f, 0.9988203f, -1.9974502f, 0.9976407f}, {0.9988766f, -1.9975626f, 0.9988766f, -1.9975626f, 0.9977531f}, {0.998929f, -1.9976674f, 0.998929f, -1.9976674f, 0.9978579f}, {0.9989779f, -1.9977652f, 0.9989779f, -1.9977652f, 0.9979558f}, {0.9990236f, -1.9978567f, 0.9990236f, -1.9978567f, 0.9980472f}, {0.9990664f, -1.9979422f, 0.9990664f, -1.9979422f, 0.9981328f}, {0.9991065f, -1.9980224f, 0.9991065f, -1.9980224f, 0.998213f}, {0.9991441f, -1.9980977f, 0.9991441f, -1.9980977f, 0.9982883f}, {0.9991803f, -1.9981701f, 0.9991803f, -1.9981701f, 0.9983606f}, {0.9992163f, -1.998242f, 0.9992163f, -1.998242f, 0.9984326f}, {0.999252f, -1.9983133f, 0.999252f, -1.9983133f, 0.9985039f}, {0.9992872f, -1.9983838f, 0.9992872f, -1.9983838f, 0.9985744f}, {0.9993219f, -1.9984532f, 0.9993219f, -1.9984532f, 0.9986438f}, {0.9993559f, -1.9985212f, 0.9993559f, -1.9985212f, 0.9987118f}, {0.9993892f, -1.9985877f, 0.9993892f, -1.9985877f, 0.9987783f}, {0.9994215f, -1.9986524f, 0.9994215f, -1.9986524f, 0.9988431f}, {0.9994529f, -1.9987152f, 0.9994529f, -1.9987152f, 0.9989059f}, {0.9994833f, -1.9987759f, 0.9994833f, -1.9987759f, 0.9989665f}, {0.9995125f, -1.9988343f, 0.9995125f, -1.9988343f, 0.999025f}, {0.9995405f, -1.9988904f, 0.9995405f, -1.9988904f, 0.9990811f}, {0.9995674f, -1.9989441f, 0.9995674f, -1.9989441f, 0.9991347f}, {0.999593f, -1.9989953f, 0.999593f, -1.9989953f, 0.9991859f}, {0.9996173f, -1.999044f, 0.9996173f, -1.999044f, 0.9992346f}, {0.9996404f, -1.9990902f, 0.9996404f, -1.9990902f, 0.9992809f}, {0.9996623f, -1.9991339f, 0.9996623f, -1.9991339f, 0.9993246f}, {0.999683f, -1.9991753f, 0.999683f, -1.9991753f, 0.999366f}, {0.9997025f, -1.9992143f, 0.9997025f, -1.9992143f, 0.9994049f}},
-        {{0.9877904f, -1.97543f, 0.9877904f, -1.97543f, 0.9755809f}, {0.9878839f, -1.9756169f, 0.9878839f, -1.9756169f, 0.9757678f}, {0.988156f, -1.9761609f, 0.988156f, -1.9761609f, 0.9763119f}, {0.9885832f, -1.9770153f, 0.9885832f, -1.9770153f, 0.9771664f}, {0.989132f, -1.9781129f, 0.989132f, -1.9781129f, 0.978264f}, {0.9897646f, -1.979378f, 0.9897646f, -1.979378f, 0.9795293f}, {0.9904445f, -1.9807376f, 0.9904445f, -1.9807376f, 0.9808889f}, {0.9911399f, -1.9821284f, 0.9911399f, -1.9821284f, 0.9822799f}, {0.9918264f, -1.9835012f, 0.9918264f, -1.9835012f, 0.9836527f}, {0.9924861f, -1.9848205f, 0.9924861f, -1.9848205f, 0.9849722f}, {0.9931079f, -1.986064f, 0.9931079f, -1.986064f, 0.9862157f}, {0.9936854f, -1.9872189f, 0.9936854f, -1.9872189f, 0.9873707f}, {0.9942162f, -1.9882804f, 0.9942162f, -1.9882804f, 0.9884324f}, {0.9947004f, -1.9892488f, 0.9947004f, -1.9892488f, 0.9894008f}, {0.9951398f, -1.9901276f, 0.9951398f, -1.9901276f, 0.9902797f}, {0.9955373f, -1.9909225f, 0.9955373f, -1.9909225f, 0.9910746f}, {0.9958961f, -1.99164f, 0.9958961f, -1.99164f, 0.9917921f}, {0.9962196f, -1.9922869f, 0.9962196f, -1.9922869f, 0.9924392f}, {0.9965113f, -1.9928703f, 0.9965113f, -1.9928703f, 0.9930225f}, {0.9967744f, -1.9933964f, 0.9967744f, -1.9933964f, 0.9935487f}, {0.9970119f, -1.9938715f, 0.9970119f, -1.9938715f, 0.9940238f}, {0.9972266f, -1.9943008f, 0.9972266f, -1.9943008f, 0.9944532f}, {0.997421f, -1.9946895f, 0.997421f, -1.9946895f, 0.9948419f}, {0.9975972f, -1.9950419f, 0.9975972f, -1.9950419f, 0.9951943f}, {0.9977572f, -1.995362f, 0.9977572f, -1.995362f, 0.9955144f}, {0.9979029f, -1.9956532f, 0.9979029f, -1.9956532f, 0.9958057f}, {0.9980356f, -1.9959187f, 0.9980356f, -1.9959187f, 0.9960712f}, {0.9981569f, -1.9961612f, 0.9981569f, -1.9961612f, 0.9963137f}, {0.9982678f, -1.9963831f, 0.9982678f, -1.9963831f, 0.9965357f}, {0.9983695f, -1.9965865f, 0.9983695f, -1.9965865f, 0.9967391f}, {0.998463f, -1.9967734f, 0.998463f, -1.9967734f, 0.996926f}, {0.9985489f, -1.9969453f, 0.9985489f, -1.9969453f, 0.9970979f}, {0.9986282f, -1.9971038f, 0.9986282f, -1.9971038f, 0.9972564f}, {0.9987014f, -1.9972501f, 0.9987014f, -1.9972501f, 0.9974027f}, {0.998769f, -1.9973855f, 0.998769f, -1.9973855f, 0.9975381f}, {0.9988317f, -1.9975109f, 0.9988317f, -1.9975109f, 0.9976635f}, {0.9988899f, -1.9976272f, 0.9988899f, -1.9976272f, 0.9977798f}, {0.998944f, -1.9977354f, 0.998944f, -1.9977354f, 0.997888f}, {0.9989943f, -1.997836f, 0.9989943f, -1.997836f, 0.9979887f}, {0.9990412f, -1.9979298f, 0.9990412f, -1.9979298f, 0.9980825f}, {0.999085f, -1.9980174f, 0.999085f, -1.9980174f, 0.9981701f}, {0.999126f, -1.9980993f, 0.999126f, -1.9980993f, 0.9982519f}, {0.9991643f, -1.9981759f, 0.9991643f, -1.9981759f, 0.9983286f}, {0.9992002f, -1.9982477f, 0.9992002f, -1.9982477f, 0.9984004f}, {0.9992339f, -1.998315f, 0.9992339f, -1.998315f, 0.9984677f}, {0.9992663f, -1.9983798f, 0.9992663f, -1.9983798f, 0.9985325f}, {0.9992985f, -1.9984442f, 0.9992985f, -1.9984442f, 0.9985969f}, {0.9993304f, -1.9985081f, 0.9993304f, -1.9985081f, 0.9986608f}, {0.9993619f, -1.9985712f, 0.9993619f, -1.9985712f, 0.9987239f}, {0.999393f, -1.9986333f, 0.999393f, -1.9986333f, 0.998786f}, {0.9994235f, -1.9986942f, 0.9994235f, -1.9986942f, 0.9988469f}, {0.9994532f, -1.9987537f, 0.9994532f, -1.9987537f, 0.9989064f}, {0.9994822f, -1.9988117f, 0.9994822f, -1.9988117f, 0.9989644f}, {0.9995103f, -1.9988679f, 0.9995103f, -1.9988679f, 0.9990206f}, {0.9995375f, -1.9989222f, 0.9995375f, -1.9989222f, 0.9990749f}, {0.9995636f, -1.9989745f, 0.9995636f, -1.9989745f, 0.9991272f}, {0.9995887f, -1.9990247f, 0.9995887f, -1.9990247f, 0.9991775f}, {0.9996127f, -1.9990728f, 0.9996127f, -1.9990728f, 0.9992255f}, {0.9996357f, -1.9991186f, 0.9996357f, -1.9991186f, 0.9992713f}, {0.9996575f, -1.9991622f, 0.9996575f, -1.9991622f, 0.9993149f}, {0.9996781f, -1.9992035f, 0.9996781f, -1.9992035f, 0.9993563f}, {0.9996977f, -1.9992427f, 0.9996977f, -1.9992427f, 0.9993955f}, {0.9997162f, -1.9992797f, 0.9997162f, -1.9992797f, 0.9994325f}, {0.9997337f, -1.9993146f, 0.9997337f, -1.9993146f, 0.9994674f}},
-        {{0.9890576f, -1.9779941f, 0.9890576f, -1.9779941f, 0.9781152f}, {0.9891415f, -1.9781619f, 0.9891415f, -1.9781619f, 0.978283f}, {0.9893856f, -1.9786501f, 0.9893856f, -1.9786501f, 0.9787712f}, {0.9897689f, -1.9794167f, 0.9897689f, -1.9794167f, 0.9795378f}, {0.9902613f, -1.9804014f, 0.9902613f, -1.9804014f, 0.9805226f}, {0.9908288f, -1.9815363f, 0.9908288f, -1.9815363f, 0.9816576f}, {0.9914386f, -1.9827557f, 0.9914386f, -1.9827557f, 0.9828771f}, {0.9920623f, -1.9840031f, 0.9920623f, -1.9840031f, 0.9841245f}, {0.9926777f, -1.985234f, 0.9926777f, -1.985234f, 0.9853555f}, {0.9932692f, -1.9864169f, 0.9932692f, -1.9864169f, 0.9865385f}, {0.9938266f, -1.9875315f, 0.9938266f, -1.9875315f, 0.9876532f}, {0.9943442f, -1.9885667f, 0.9943442f, -1.9885667f, 0.9886885f}, {0.9948199f, -1.9895181f, 0.9948199f, -1.9895181f, 0.9896399f}, {0.9952539f, -1.9903859f, 0.9952539f, -1.9903859f, 0.9905077f}, {0.9956476f, -1.9911733f, 0.9956476f, -1.9911733f, 0.9912952f}, {0.9960037f, -1.9918855f, 0.9960037f, -1.9918855f, 0.9920074f}, {0.9963251f, -1.9925283f, 0.9963251f, -1.9925283f, 0.9926502f}, {0.9966149f, -1.9931079f, 0.9966149f, -1.9931079f, 0.9932299f}, {0.9968762f, -1.9936304f, 0.9968762f, -1.9936304f, 0.9937524f}, {0.9971119f, -1.9941017f, 0.9971119f, -1.9941017f, 0.9942237f}, {0.9973246f, -1.9945271f, 0.9973246f, -1.9945271f, 0.9946492f}, {0.9975169f, -1.9949117f, 0.9975169f, -1.9949117f, 0.9950338f}, {0.997691f, -1.9952598f, 0.997691f, -1.9952598f, 0.9953819f}, {0.9978488f, -1.9955754f, 0.9978488f, -1.9955754f, 0.9956975f}, {0.9979921f, -1.995862f, 0.9979921f, -1.995862f, 0.9959842f}, {0.9981225f, -1.9961228f, 0.9981225f, -1.9961228f, 0.996245f}, {0.9982414f, -1.9963606f, 0.9982414f, -1.9963606f, 0.9964828f}, {0.99835f, -1.9965777f, 0.99835f, -1.9965777f, 0.9966999f}, {0.9984493f, -1.9967764f, 0.9984493f, -1.9967764f, 0.9968986f}, {0.9985404f, -1.9969585f, 0.9985404f, -1.9969585f, 0.9970808f}, {0.998624f, -1.9971258f, 0.998624f, -1.9971258f, 0.9972481f}, {0.998701f, -1.9972798f, 0.998701f, -1.9972798f, 0.997402f}, {0.998772f, -1.9974217f, 0.998772f, -1.9974217f, 0.9975439f}, {0.9988375f, -1.9975527f, 0.9988375f, -1.9975527f, 0.9976749f}, {0.9988981f, -1.9976739f, 0.9988981f, -1.9976739f, 0.9977961f}, {0.9989542f, -1.9977861f, 0.9989542f, -1.9977861f, 0.9979084f}, {0.9990063f, -1.9978903f, 0.9990063f, -1.9978903f, 0.9980126f}, {0.9990547f, -1.9979871f, 0.9990547f, -1.9979871f, 0.9981094f}, {0.9990998f, -1.9980772f, 0.9990998f, -1.9980772f, 0.9981995f}, {0.9991418f, -1.9981612f, 0.9991418f, -1.9981612f, 0.9982835f}, {0.999181f, -1.9982396f, 0.999181f, -1.9982396f, 0.9983619f}, {0.9992176f, -1.9983129f, 0.9992176f, -1.9983129f, 0.9984352f}, {0.9992519f, -1.9983815f, 0.9992519f, -1.9983815f, 0.9985038f}, {0.999284f, -1.9984458f, 0.999284f, -1.9984458f, 0.9985681f}, {0.9993142f, -1.9985061f, 0.9993142f, -1.9985061f, 0.9986284f}, {0.9993432f, -1.9985641f, 0.9993432f, -1.9985641f, 0.9986864f}, {0.999372f, -1.9986217f, 0.999372f, -1.9986217f, 0.9987441f}, {0.9994006f, -1.9986789f, 0.9994006f, -1.9986789f, 0.9988012f}, {0.9994288f, -1.9987354f, 0.9994288f, -1.9987354f, 0.9988577f}, {0.9994567f, -1.998791f, 0.9994567f, -1.998791f, 0.9989133f}, {0.9994839f, -1.9988455f, 0.9994839f, -1.9988455f, 0.9989678f}, {0.9995106f, -1.9988988f, 0.9995106f, -1.9988988f, 0.9990211f}, {0.9995365f, -1.9989507f, 0.9995365f, -1.9989507f, 0.999073f}, {0.9995617f, -1.999001f, 0.9995617f, -1.999001f, 0.9991233f}, {0.999586f, -1.9990496f, 0.999586f, -1.9990496f, 0.999172f}, {0.9996094f, -1.9990964f, 0.9996094f, -1.9990964f, 0.9992188f}, {0.9996319f, -1.9991414f, 0.9996319f, -1.9991414f, 0.9992637f}, {0.9996534f, -1.9991844f, 0.9996534f, -1.9991844f, 0.9993067f}, {0.9996739f, -1.9992254f, 0.9996739f, -1.9992254f, 0.9993478f}, {0.9996934f, -1.9992644f, 0.9996934f, -1.9992644f, 0.9993868f}, {0.9997119f, -1.9993014f, 0.9997119f, -1.9993014f, 0.9994238f}, {0.9997294f, -1.9993365f, 0.9997294f, -1.9993365f, 0.9994589f}, {0.999746f, -1.9993696f, 0.999746f, -1.9993696f, 0.999492f}, {0.9997616f, -1.9994009f, 0.9997616f, -1.9994009f, 0.9995232f}},
-        {{0.9901946f, -1.980292f, 0.9901946f, -1.980292f, 0.9803892f}, {0.9902698f, -1.9804425f, 0.9902698f, -1.9804425f, 0.9805397f}, {0.9904888f, -1.9808805f, 0.9904888f, -1.9808805f, 0.9809776f}, {0.9908327f, -1.9815682f, 0.9908327f, -1.9815682f, 0.9816653f}, {0.9912743f, -1.9824514f, 0.9912743f, -1.9824514f, 0.9825486f}, {0.9917833f, -1.9834693f, 0.9917833f, -1.9834693f, 0.9835665f}, {0.9923301f, -1.9845628f, 0.9923301f, -1.9845628f, 0.9846601f}, {0.9928893f, -1.9856812f, 0.9928893f, -1.9856812f, 0.9857786f}, {0.9934411f, -1.9867847f, 0.9934411f, -1.9867847f, 0.9868821f}, {0.9939713f, -1.9878451f, 0.9939713f, -1.9878451f, 0.9879425f}, {0.9944708f, -1.9888441f, 0.9944708f, -1.9888441f, 0.9889416f}, {0.9949347f, -1.9897719f, 0.9949347f, -1.9897719f, 0.9898694f}, {0.995361f, -1.9906244f, 0.995361f, -1.9906244f, 0.990722f}, {0.9957498f, -1.9914019f, 0.9957498f, -1.9914019f, 0.9914996f}, {0.9961025f, -1.9921074f, 0.9961025f, -1.9921074f, 0.9922051f}, {0.9964216f, -1.9927454f, 0.9964216f, -1.9927454f, 0.9928431f}, {0.9967095f, -1.9933212f, 0.9967095f, -1.9933212f, 0.9934189f}, {0.9969691f, -1.9938404f, 0.9969691f, -1.9938404f, 0.9939381f}, {0.9972031f, -1.9943084f, 0.9972031f, -1.9943084f, 0.9944062f}, {0.9974142f, -1.9947305f, 0.9974142f, -1.9947305f, 0.9948283f}, {0.9976047f, -1.9951115f, 0.9976047f, -1.9951115f, 0.9952094f}, {0.9977769f, -1.9954559f, 0.9977769f, -1.9954559f, 0.9955538f}, {0.9979328f, -1.9957676f, 0.9979328f, -1.9957676f, 0.9958655f}, {0.9980741f, -1.9960503f, 0.9980741f, -1.9960503f, 0.9961481f}, {0.9982024f, -1.9963069f, 0.9982024f, -1.9963069f, 0.9964048f}, {0.9983192f, -1.9965405f, 0.9983192f, -1.9965405f, 0.9966384f}, {0.9984256f, -1.9967533f, 0.9984256f, -1.9967533f, 0.9968513f}, {0.9985228f, -1.9969478f, 0.9985228f, -1.9969478f, 0.9970457f}, {0.9986118f, -1.9971257f, 0.9986118f, -1.9971257f, 0.9972236f}, {0.9986934f, -1.9972888f, 0.9986934f, -1.9972888f, 0.9973867f}, {0.9987682f, -1.9974385f, 0.9987682f, -1.9974385f, 0.9975365f}, {0.9988372f, -1.9975764f, 0.9988372f, -1.9975764f, 0.9976743f}, {0.9989007f, -1.9977034f, 0.9989007f, -1.9977034f, 0.9978014f}, {0.9989593f, -1.9978207f, 0.9989593f, -1.9978207f, 0.9979187f}, {0.9990136f, -1.9979292f, 0.9990136f, -1.9979292f, 0.9980272f}, {0.9990638f, -1.9980297f, 0.9990638f, -1.9980297f, 0.9981277f}, {0.9991105f, -1.998123f, 0.9991105f, -1.998123f, 0.9982209f}, {0.9991538f, -1.9982096f, 0.9991538f, -1.9982096f, 0.9983076f}, {0.9991942f, -1.9982903f, 0.9991942f, -1.9982903f, 0.9983883f}, {0.9992318f, -1.9983655f, 0.9992318f, -1.9983655f, 0.9984635f}, {0.9992668f, -1.9984357f, 0.9992668f, -1.9984357f, 0.9985337f}, {0.9992997f, -1.9985013f, 0.9992997f, -1.9985013f, 0.9985993f}, {0.9993304f, -1.9985627f, 0.9993304f, -1.9985627f, 0.9986607f}, {0.9993591f, -1.9986202f, 0.9993591f, -1.9986202f, 0.9987183f}, {0.9993861f, -1.9986742f, 0.9993861f, -1.9986742f, 0.9987722f}, {0.9994121f, -1.9987262f, 0.9994121f, -1.9987262f, 0.9988242f}, {0.9994379f, -1.9987778f, 0.9994379f, -1.9987778f, 0.9988758f}, {0.9994635f, -1.9988289f, 0.9994635f, -1.9988289f, 0.9989269f}, {0.9994888f, -1.9988795f, 0.9994888f, -1.9988795f, 0.9989775f}, {0.9995136f, -1.9989293f, 0.9995136f, -1.9989293f, 0.9990273f}, {0.9995381f, -1.9989781f, 0.9995381f, -1.9989781f, 0.9990761f}, {0.9995619f, -1.9990258f, 0.9995619f, -1.9990258f, 0.9991238f}, {0.9995851f, -1.9990722f, 0.9995851f, -1.9990722f, 0.9991702f}, {0.9996076f, -1.9991173f, 0.9996076f, -1.9991173f, 0.9992153f}, {0.9996294f, -1.9991608f, 0.9996294f, -1.9991608f, 0.9992588f}, {0.9996504f, -1.9992027f, 0.9996504f, -1.9992027f, 0.9993007f}, {0.9996705f, -1.9992429f, 0.9996705f, -1.9992429f, 0.999341f}, {0.9996897f, -1.9992814f, 0.9996897f, -1.9992814f, 0.9993795f}, {0.9997081f, -1.9993181f, 0.9997081f, -1.9993181f, 0.9994162f}, {0.9997256f, -1.9993531f, 0.9997256f, -1.9993531f, 0.9994511f}, {0.9997421f, -1.9993862f, 0.9997421f, -1.9993862f, 0.9994843f}, {0.9997578f, -1.9994176f, 0.9997578f, -1.9994176f, 0.9995156f}, {0.9997726f, -1.9994473f, 0.9997726f, -1.9994473f, 0.9995453f}, {0.9997866f, -1.9994752f, 0.9997866f, -1.9994752f, 0.9995733f}},
-        {{0.9912145f, -1.9823511f, 0.9912145f, -1.9823511f, 0.982429f}, {0.991282f, -1.9824861f, 0.991282f, -1.9824861f, 0.9825639f}, {0.9914784f, -1.9828789f, 0.9914784f, -1.9828789f, 0.9829567f}, {0.9917868f, -1.9834956f, 0.9917868f, -1.9834956f, 0.9835735f}, {0.9921828f, -1.9842877f, 0.9921828f, -1.9842877f, 0.9843656f}, {0.9926392f, -1.9852003f, 0.9926392f, -1.9852003f, 0.9852783f}, {0.9931294f, -1.9861807f, 0.9931294f, -1.9861807f, 0.9862588f}, {0.9936307f, -1.9871833f, 0.9936307f, -1.9871833f, 0.9872614f}, {0.9941253f, -1.9881725f, 0.9941253f, -1.9881725f, 0.9882506f}, {0.9946005f, -1.9891228f, 0.9946005f, -1.9891228f, 0.989201f}, {0.9950482f, -1.9900181f, 0.9950482f, -1.9900181f, 0.9900963f}, {0.9954638f, -1.9908495f, 0.9954638f, -1.9908495f, 0.9909277f}, {0.9958458f, -1.9916133f, 0.9958458f, -1.9916133f, 0.9916915f}, {0.9961941f, -1.9923099f, 0.9961941f, -1.9923099f, 0.9923882f}, {0.9965101f, -1.9929419f, 0.9965101f, -1.9929419f, 0.9930202f}, {0.9967959f, -1.9935134f, 0.9967959f, -1.9935134f, 0.9935917f}, {0.9970537f, -1.9940292f, 0.9970537f, -1.9940292f, 0.9941075f}, {0.9972863f, -1.9944942f, 0.9972863f, -1.9944942f, 0.9945725f}, {0.9974958f, -1.9949133f, 0.9974958f, -1.9949133f, 0.9949917f}, {0.9976849f, -1.9952914f, 0.9976849f, -1.9952914f, 0.9953697f}, {0.9978555f, -1.9956326f, 0.9978555f, -1.9956326f, 0.995711f}, {0.9980097f, -1.995941f, 0.9980097f, -1.995941f, 0.9960194f}, {0.9981493f, -1.9962201f, 0.9981493f, -1.9962201f, 0.9962986f}, {0.9982758f, -1.9964732f, 0.9982758f, -1.9964732f, 0.9965516f}, {0.9983907f, -1.996703f, 0.9983907f, -1.996703f, 0.9967815f}, {0.9984953f, -1.9969121f, 0.9984953f, -1.9969121f, 0.9969906f}, {0.9985906f, -1.9971028f, 0.9985906f, -1.9971028f, 0.9971812f}, {0.9986776f, -1.9972768f, 0.9986776f, -1.9972768f, 0.9973553f}, {0.9987573f, -1.9974361f, 0.9987573f, -1.9974361f, 0.9975146f}, {0.9988303f, -1.9975821f, 0.9988303f, -1.9975821f, 0.9976606f}, {0.9988974f, -1.9977162f, 0.9988974f, -1.9977162f, 0.9977947f}, {0.9989591f, -1.9978396f, 0.9989591f, -1.9978396f, 0.9979181f}, {0.9990159f, -1.9979534f, 0.9990159f, -1.9979534f, 0.9980319f}, {0.9990684f, -1.9980584f, 0.9990684f, -1.9980584f, 0.9981369f}, {0.999117f, -1.9981555f, 0.999117f, -1.9981555f, 0.998234f}, {0.999162f, -1.9982455f, 0.999162f, -1.9982455f, 0.998324f}, {0.9992037f, -1.998329f, 0.9992037f, -1.998329f, 0.9984075f}, {0.9992425f, -1.9984066f, 0.9992425f, -1.9984066f, 0.9984851f}, {0.9992787f, -1.9984788f, 0.9992787f, -1.9984788f, 0.9985573f}, {0.9993123f, -1.9985461f, 0.9993123f, -1.9985461f, 0.9986246f}, {0.9993437f, -1.9986089f, 0.9993437f, -1.9986089f, 0.9986875f}, {0.9993731f, -1.9986677f, 0.9993731f, -1.9986677f, 0.9987462f}, {0.9994006f, -1.9987226f, 0.9994006f, -1.9987226f, 0.9988012f}, {0.9994263f, -1.9987742f, 0.9994263f, -1.9987742f, 0.9988527f}, {0.9994505f, -1.9988225f, 0.9994505f, -1.9988225f, 0.998901f}, {0.9994737f, -1.998869f, 0.9994737f, -1.998869f, 0.9989475f}, {0.9994968f, -1.9989152f, 0.9994968f, -1.9989152f, 0.9989937f}, {0.9995197f, -1.998961f, 0.9995197f, -1.998961f, 0.9990395f}, {0.9995424f, -1.9990062f, 0.9995424f, -1.9990062f, 0.9990848f}, {0.9995647f, -1.9990508f, 0.9995647f, -1.9990508f, 0.9991293f}, {0.9995865f, -1.9990945f, 0.9995865f, -1.9990945f, 0.999173f}, {0.9996079f, -1.9991372f, 0.9996079f, -1.9991372f, 0.9992157f}, {0.9996286f, -1.9991788f, 0.9996286f, -1.9991788f, 0.9992573f}, {0.9996488f, -1.9992191f, 0.9996488f, -1.9992191f, 0.9992976f}, {0.9996683f, -1.999258f, 0.9996683f, -1.999258f, 0.9993366f}, {0.999687f, -1.9992956f, 0.999687f, -1.9992956f, 0.9993741f}, {0.9997051f, -1.9993316f, 0.9997051f, -1.9993316f, 0.9994101f}, {0.9997223f, -1.999366f, 0.9997223f, -1.999366f, 0.9994446f}, {0.9997387f, -1.9993989f, 0.9997387f, -1.9993989f, 0.9994774f}, {0.9997543f, -1.9994302f, 0.9997543f, -1.9994302f, 0.9995087f}, {0.9997692f, -1.9994598f, 0.9997692f, -1.9994598f, 0.9995384f}, {0.9997832f, -1.9994879f, 0.9997832f, -1.9994879f, 0.9995665f}, {0.9997965f, -1.9995145f, 0.9997965f, -1.9995145f, 0.999593f}, {0.999809f, -1.9995395f, 0.999809f, -1.9995395f, 0.999618f}},
-        {{0.9921292f, -1.9841959f, 0.9921292f, -1.9841959f, 0.9842583f}, {0.9921897f, -1.9843169f, 0.9921897f, -1.9843169f, 0.9843794f}, {0.9923658f, -1.9846691f, 0.9923658f, -1.9846691f, 0.9847316f}, {0.9926423f, -1.9852221f, 0.9926423f, -1.9852221f, 0.9852846f}, {0.9929974f, -1.9859323f, 0.9929974f, -1.9859323f, 0.9859948f}, {0.9934065f, -1.9867505f, 0.9934065f, -1.9867505f, 0.986813f}, {0.9938459f, -1.9876293f, 0.9938459f, -1.9876293f, 0.9876919f}, {0.9942953f, -1.988528f, 0.9942953f, -1.988528f, 0.9885905f}, {0.9947385f, -1.9894144f, 0.9947385f, -1.9894144f, 0.9894771f}, {0.9951644f, -1.9902661f, 0.9951644f, -1.9902661f, 0.9903287f}, {0.9955655f, -1.9910683f, 0.9955655f, -1.9910683f, 0.991131f}, {0.9959379f, -1.9918131f, 0.9959379f, -1.9918131f, 0.9918758f}, {0.9962801f, -1.9924975f, 0.9962801f, -1.9924975f, 0.9925602f}, {0.9965921f, -1.9931215f, 0.9965921f, -1.9931215f, 0.9931842f}, {0.9968752f, -1.9936876f, 0.9968752f, -1.9936876f, 0.9937504f}, {0.9971311f, -1.9941995f, 0.9971311f, -1.9941995f, 0.9942623f}, {0.9973621f, -1.9946614f, 0.9973621f, -1.9946614f, 0.9947242f}, {0.9975703f, -1.9950779f, 0.9975703f, -1.9950779f, 0.9951407f}, {0.997758f, -1.9954533f, 0.997758f, -1.9954533f, 0.9955161f}, {0.9979273f, -1.9957918f, 0.9979273f, -1.9957918f, 0.9958546f}, {0.9980801f, -1.9960974f, 0.9980801f, -1.9960974f, 0.9961602f}, {0.9982182f, -1.9963736f, 0.9982182f, -1.9963736f, 0.9964364f}, {0.9983432f, -1.9966235f, 0.9983432f, -1.9966235f, 0.9966863f}, {0.9984565f, -1.9968501f, 0.9984565f, -1.9968501f, 0.9969129f}, {0.9985594f, -1.9970559f, 0.9985594f, -1.9970559f, 0.9971187f}, {0.998653f, -1.9972431f, 0.998653f, -1.9972431f, 0.997306f}, {0.9987383f, -1.9974138f, 0.9987383f, -1.9974138f, 0.9974766f}, {0.9988162f, -1.9975696f, 0.9988162f, -1.9975696f, 0.9976325f}, {0.9988876f, -1.9977122f, 0.9988876f, -1.9977122f, 0.9977751f}, {0.9989529f, -1.997843f, 0.9989529f, -1.997843f, 0.9979058f}, {0.999013f, -1.997963f, 0.999013f, -1.997963f, 0.9980259f}, {0.9990682f, -1.9980735f, 0.9990682f, -1.9980735f, 0.9981364f}, {0.9991191f, -1.9981753f, 0.9991191f, -1.9981753f, 0.9982382f}, {0.9991661f, -1.9982693f, 0.9991661f, -1.9982693f, 0.9983322f}, {0.9992096f, -1.9983563f, 0.9992096f, -1.9983563f, 0.9984192f}, {0.9992499f, -1.9984368f, 0.9992499f, -1.9984368f, 0.9984997f}, {0.9992872f, -1.9985116f, 0.9992872f, -1.9985116f, 0.9985745f}, {0.999322f, -1.998581f, 0.999322f, -1.998581f, 0.9986439f}, {0.9993543f, -1.9986457f, 0.9993543f, -1.9986457f, 0.9987086f}, {0.9993844f, -1.998706f, 0.9993844f, -1.998706f, 0.9987689f}, {0.9994126f, -1.9987622f, 0.9994126f, -1.9987622f, 0.9988251f}, {0.9994388f, -1.9988148f, 0.9994388f, -1.9988148f, 0.9988777f}, {0.9994634f, -1.998864f, 0.9994634f, -1.998864f, 0.9989269f}, {0.9994865f, -1.9989101f, 0.9994865f, -1.9989101f, 0.998973f}, {0.9995081f, -1.9989534f, 0.9995081f, -1.9989534f, 0.9990163f}, {0.9995289f, -1.998995f, 0.9995289f, -1.998995f, 0.9990579f}, {0.9995496f, -1.9990363f, 0.9995496f, -1.9990363f, 0.9990992f}, {0.9995701f, -1.9990773f, 0.9995701f, -1.9990773f, 0.9991402f}, {0.9995904f, -1.9991178f, 0.9995904f, -1.9991178f, 0.9991808f}, {0.9996103f, -1.9991577f, 0.9996103f, -1.9991577f, 0.9992206f}, {0.9996299f, -1.9991968f, 0.9996299f, -1.9991968f, 0.9992598f}, {0.999649f, -1.9992351f, 0.999649f, -1.9992351f, 0.999298f}, {0.9996676f, -1.9992723f, 0.9996676f, -1.9992723f, 0.9993352f}, {0.9996856f, -1.9993084f, 0.9996856f, -1.9993084f, 0.9993713f}, {0.9997031f, -1.9993432f, 0.9997031f, -1.9993432f, 0.9994062f}, {0.9997199f, -1.9993768f, 0.9997199f, -1.9993768f, 0.9994398f}, {0.999736f, -1.9994091f, 0.999736f, -1.9994091f, 0.999472f}, {0.9997514f, -1.9994399f, 0.9997514f, -1.9994399f, 0.9995028f}, {0.9997661f, -1.9994693f, 0.9997661f, -1.9994693f, 0.9995323f}, {0.9997801f, -1.9994973f, 0.9997801f, -1.9994973f, 0.9995602f}, {0.9997934f, -1.9995239f, 0.9997934f, -1.9995239f, 0.9995868f}, {0.999806f, -1.999549f, 0.999806f, -1.999549f, 0.9996119f}, {0.9998179f, -1.9995728f, 0.9998179f, -1.9995728f, 0.9996357f}, {0.9998291f, -1.9995952f, 0.9998291f, -1.9995952f, 0.9996581f}},
-        {{0.9929493f, -1.9858485f, 0.9929493f, -1.9858485f, 0.9858986f}, {0.9930036f, -1.985957f, 0.9930036f, -1.985957f, 0.9860071f}, {0.9931614f, -1.9862728f, 0.9931614f, -1.9862728f, 0.9863229f}, {0.9934093f, -1.9867685f, 0.9934093f, -1.9867685f, 0.9868186f}, {0.9937276f, -1.9874051f, 0.9937276f, -1.9874051f, 0.9874552f}, {0.9940943f, -1.9881385f, 0.9940943f, -1.9881385f, 0.9881886f}, {0.9944882f, -1.9889262f, 0.9944882f, -1.9889262f, 0.9889763f}, {0.9948909f, -1.9897315f, 0.9948909f, -1.9897315f, 0.9897817f}, {0.9952881f, -1.9905259f, 0.9952881f, -1.9905259f, 0.9905761f}, {0.9956696f, -1.991289f, 0.9956696f, -1.991289f, 0.9913392f}, {0.996029f, -1.9920078f, 0.996029f, -1.9920078f, 0.992058f}, {0.9963626f, -1.992675f, 0.9963626f, -1.992675f, 0.9927253f}, {0.9966691f, -1.993288f, 0.9966691f, -1.993288f, 0.9933383f}, {0.9969486f, -1.993847f, 0.9969486f, -1.993847f, 0.9938973f}, {0.9972022f, -1.9943541f, 0.9972022f, -1.9943541f, 0.9944044f}, {0.9974314f, -1.9948125f, 0.9974314f, -1.9948125f, 0.9948628f}, {0.9976383f, -1.9952262f, 0.9976383f, -1.9952262f, 0.9952765f}, {0.9978247f, -1.9955992f, 0.9978247f, -1.9955992f, 0.9956495f}, {0.9979928f, -1.9959353f, 0.9979928f, -1.9959353f, 0.9959857f}, {0.9981444f, -1.9962385f, 0.9981444f, -1.9962385f, 0.9962888f}, {0.9982812f, -1.9965121f, 0.9982812f, -1.9965121f, 0.9965625f}, {0.9984049f, -1.9967594f, 0.9984049f, -1.9967594f, 0.9968097f}, {0.9985168f, -1.9969832f, 0.9985168f, -1.9969832f, 0.9970336f}, {0.9986182f, -1.9971861f, 0.9986182f, -1.9971861f, 0.9972364f}, {0.9987103f, -1.9973703f, 0.9987103f, -1.9973703f, 0.9974207f}, {0.9987942f, -1.997538f, 0.9987942f, -1.997538f, 0.9975883f}, {0.9988706f, -1.9976908f, 0.9988706f, -1.9976908f, 0.9977411f}, {0.9989403f, -1.9978303f, 0.9989403f, -1.9978303f, 0.9978807f}, {0.9990042f, -1.997958f, 0.9990042f, -1.997958f, 0.9980084f}, {0.9990627f, -1.998075f, 0.9990627f, -1.998075f, 0.9981254f}, {0.9991164f, -1.9981825f, 0.9991164f, -1.9981825f, 0.9982329f}, {0.9991659f, -1.9982814f, 0.9991659f, -1.9982814f, 0.9983318f}, {0.9992115f, -1.9983726f, 0.9992115f, -1.9983726f, 0.9984229f}, {0.9992536f, -1.9984567f, 0.9992536f, -1.9984567f, 0.9985071f}, {0.9992925f, -1.9985346f, 0.9992925f, -1.9985346f, 0.9985849f}, {0.9993285f, -1.9986067f, 0.9993285f, -1.9986067f, 0.9986571f}, {0.999362f, -1.9986736f, 0.999362f, -1.9986736f, 0.998724f}, {0.9993931f, -1.9987358f, 0.9993931f, -1.9987358f, 0.9987862f}, {0.999422f, -1.9987936f, 0.999422f, -1.9987936f, 0.998844f}, {0.999449f, -1.9988476f, 0.999449f, -1.9988476f, 0.998898f}, {0.9994742f, -1.9988979f, 0.9994742f, -1.9988979f, 0.9989483f}, {0.9994977f, -1.998945f, 0.9994977f, -1.998945f, 0.9989954f}, {0.9995197f, -1.9989891f, 0.9995197f, -1.9989891f, 0.9990395f}, {0.9995404f, -1.9990303f, 0.9995404f, -1.9990303f, 0.9990807f}, {0.9995597f, -1.9990691f, 0.9995597f, -1.9990691f, 0.9991195f}, {0.9995784f, -1.9991063f, 0.9995784f, -1.9991063f, 0.9991567f}, {0.9995969f, -1.9991433f, 0.9995969f, -1.9991433f, 0.9991937f}, {0.9996152f, -1.99918f, 0.9996152f, -1.99918f, 0.9992304f}, {0.9996333f, -1.9992163f, 0.9996333f, -1.9992163f, 0.9992667f}, {0.9996512f, -1.999252f, 0.9996512f, -1.999252f, 0.9993024f}, {0.9996687f, -1.999287f, 0.9996687f, -1.999287f, 0.9993374f}, {0.9996858f, -1.9993212f, 0.9996858f, -1.9993212f, 0.9993716f}, {0.9997025f, -1.9993545f, 0.9997025f, -1.9993545f, 0.9994049f}, {0.9997186f, -1.9993868f, 0.9997186f, -1.9993868f, 0.9994372f}, {0.9997342f, -1.9994181f, 0.9997342f, -1.9994181f, 0.9994685f}, {0.9997493f, -1.9994481f, 0.9997493f, -1.9994481f, 0.9994985f}, {0.9997637f, -1.999477f, 0.9997637f, -1.999477f, 0.9995274f}, {0.9997775f, -1.9995046f, 0.9997775f, -1.9995046f, 0.999555f}, {0.9997907f, -1.9995309f, 0.9997907f, -1.9995309f, 0.9995813f}, {0.9998032f, -1.999556f, 0.9998032f, -1.999556f, 0.9996064f}, {0.9998151f, -1.9995797f, 0.9998151f, -1.9995797f, 0.9996302f}, {0.9998263f, -1.9996022f, 0.9998263f, -1.9996022f, 0.9996527f}, {0.999837f, -1.9996235f, 0.999837f, -1.9996235f, 0.9996739f}, {0.999847f, -1.9996436f, 0.999847f, -1.9996436f, 0.999694f}},
-        {{0.9936845f, -1.9873289f, 0.9936845f, -1.9873289f, 0.987369f}, {0.9937332f, -1.9874262f, 0.9937332f, -1.9874262f, 0.9874663f}, {0.9938747f, -1.9877092f, 0.9938747f, -1.9877092f, 0.9877494f}, {0.9940969f, -1.9881536f, 0.9940969f, -1.9881536f, 0.9881937f}, {0.9943821f, -1.9887241f, 0.9943821f, -1.9887241f, 0.9887643f}, {0.9947108f, -1.9893814f, 0.9947108f, -1.9893814f, 0.9894216f}, {0.9950637f, -1.9900873f, 0.9950637f, -1.9900873f, 0.9901275f}, {0.9954246f, -1.9908089f, 0.9954246f, -1.9908089f, 0.9908491f}, {0.9957804f, -1.9915207f, 0.9957804f, -1.9915207f, 0.9915609f}, {0.9961223f, -1.9922043f, 0.9961223f, -1.9922043f, 0.9922446f}, {0.9964442f, -1.9928482f, 0.9964442f, -1.9928482f, 0.9928885f}, {0.9967431f, -1.9934459f, 0.9967431f, -1.9934459f, 0.9934862f}, {0.9970176f, -1.993995f, 0.9970176f, -1.993995f, 0.9940353f}, {0.997268f, -1.9944957f, 0.997268f, -1.9944957f, 0.9945359f}, {0.997495f, -1.9949498f, 0.997495f, -1.9949498f, 0.9949901f}, {0.9977003f, -1.9953604f, 0.9977003f, -1.9953604f, 0.9954007f}, {0.9978856f, -1.9957309f, 0.9978856f, -1.9957309f, 0.9957712f}, {0.9980526f, -1.9960648f, 0.9980526f, -1.9960648f, 0.9961051f}, {0.9982031f, -1.9963659f, 0.9982031f, -1.9963659f, 0.9964062f}, {0.9983388f, -1.9966373f, 0.9983388f, -1.9966373f, 0.9966776f}, {0.9984613f, -1.9968823f, 0.9984613f, -1.9968823f, 0.9969226f}, {0.998572f, -1.9971037f, 0.998572f, -1.9971037f, 0.9971441f}, {0.9986722f, -1.9973041f, 0.9986722f, -1.9973041f, 0.9973444f}, {0.998763f, -1.9974857f, 0.998763f, -1.9974857f, 0.9975261f}, {0.9988455f, -1.9976507f, 0.9988455f, -1.9976507f, 0.9976911f}, {0.9989206f, -1.9978008f, 0.9989206f, -1.9978008f, 0.9978411f}, {0.998989f, -1.9979376f, 0.998989f, -1.9979376f, 0.9979779f}, {0.9990514f, -1.9980625f, 0.9990514f, -1.9980625f, 0.9981029f}, {0.9991086f, -1.9981768f, 0.9991086f, -1.9981768f, 0.9982172f}, {0.999161f, -1.9982816f, 0.999161f, -1.9982816f, 0.998322f}, {0.9992091f, -1.9983778f, 0.9992091f, -1.9983778f, 0.9984182f}, {0.9992534f, -1.9984664f, 0.9992534f, -1.9984664f, 0.9985067f}, {0.9992942f, -1.998548f, 0.9992942f, -1.998548f, 0.9985883f}, {0.9993318f, -1.9986233f, 0.9993318f, -1.9986233f, 0.9986637f}, {0.9993667f, -1.998693f, 0.9993667f, -1.998693f, 0.9987334f}, {0.999399f, -1.9987575f, 0.999399f, -1.9987575f, 0.9987979f}, {0.9994289f, -1.9988174f, 0.9994289f, -1.9988174f, 0.9988578f}, {0.9994567f, -1.9988731f, 0.9994567f, -1.9988731f, 0.9989135f}, {0.9994826f, -1.9989249f, 0.9994826f, -1.9989249f, 0.9989653f}, {0.9995068f, -1.9989732f, 0.9995068f, -1.9989732f, 0.9990136f}, {0.9995293f, -1.9990183f, 0.9995293f, -1.9990183f, 0.9990587f}, {0.9995504f, -1.9990604f, 0.9995504f, -1.9990604f, 0.9991008f}, {0.9995701f, -1.9990998f, 0.9995701f, -1.9990998f, 0.9991402f}, {0.9995886f, -1.9991368f, 0.9995886f, -1.9991368f, 0.9991772f}, {0.9996059f, -1.9991715f, 0.9996059f, -1.9991715f, 0.9992118f}, {0.9996226f, -1.9992048f, 0.9996226f, -1.9992048f, 0.9992452f}, {0.9996392f, -1.9992379f, 0.9996392f, -1.9992379f, 0.9992783f}, {0.9996556f, -1.9992708f, 0.9996556f, -1.9992708f, 0.9993112f}, {0.9996718f, -1.9993032f, 0.9996718f, -1.9993032f, 0.9993436f}, {0.9996878f, -1.9993352f, 0.9996878f, -1.9993352f, 0.9993756f}, {0.9997035f, -1.9993665f, 0.9997035f, -1.9993665f, 0.9994069f}, {0.9997188f, -1.9993972f, 0.9997188f, -1.9993972f, 0.9994376f}, {0.9997337f, -1.999427f, 0.9997337f, -1.999427f, 0.9994674f}, {0.9997481f, -1.9994559f, 0.9997481f, -1.9994559f, 0.9994963f}, {0.9997621f, -1.9994838f, 0.9997621f, -1.9994838f, 0.9995242f}, {0.9997756f, -1.9995108f, 0.9997756f, -1.9995108f, 0.9995511f}, {0.9997885f, -1.9995366f, 0.9997885f, -1.9995366f, 0.999577f}, {0.9998008f, -1.9995613f, 0.9998008f, -1.9995613f, 0.9996017f}, {0.9998126f, -1.9995849f, 0.9998126f, -1.9995849f, 0.9996253f}, {0.9998238f, -1.9996073f, 0.9998238f, -1.9996073f, 0.9996477f}, {0.9998345f, -1.9996286f, 0.9998345f, -1.9996286f, 0.999669f}, {0.9998446f, -1.9996487f, 0.9998446f, -1.9996487f, 0.9996891f}, {0.9998541f, -1.9996678f, 0.9998541f, -1.9996678f, 0.9997081f}, {0.999863f, -1.9996857f, 0.999863f, -1.9996857f, 0.9997261f}},
-        {{0.9943435f, -1.9886549f, 0.9943435f, -1.9886549f, 0.988687f}, {0.9943871f, -1.988742f, 0.9943871f, -1.988742f, 0.9887742f}, {0.9945139f, -1.9889957f, 0.9945139f, -1.9889957f, 0.9890279f}, {0.9947131f, -1.9893939f, 0.9947131f, -1.9893939f, 0.9894261f}, {0.9949687f, -1.9899052f, 0.9949687f, -1.9899052f, 0.9899374f}, {0.9952632f, -1.9904942f, 0.9952632f, -1.9904942f, 0.9905264f}, {0.9955795f, -1.9911267f, 0.9955795f, -1.9911267f, 0.9911589f}, {0.9959027f, -1.9917732f, 0.9959027f, -1.9917732f, 0.9918055f}, {0.9962216f, -1.9924109f, 0.9962216f, -1.9924109f, 0.9924431f}, {0.9965278f, -1.9930233f, 0.9965278f, -1.9930233f, 0.9930556f}, {0.9968162f, -1.9936001f, 0.9968162f, -1.9936001f, 0.9936324f}, {0.9970839f, -1.9941355f, 0.9970839f, -1.9941355f, 0.9941678f}, {0.9973298f, -1.9946273f, 0.9973298f, -1.9946273f, 0.9946596f}, {0.997554f, -1.9950757f, 0.997554f, -1.9950757f, 0.9951079f}, {0.9977573f, -1.9954824f, 0.9977573f, -1.9954824f, 0.9955147f}, {0.9979412f, -1.9958501f, 0.9979412f, -1.9958501f, 0.9958823f}, {0.9981071f, -1.9961818f, 0.9981071f, -1.9961818f, 0.9962141f}, {0.9982566f, -1.9964809f, 0.9982566f, -1.9964809f, 0.9965132f}, {0.9983914f, -1.9967504f, 0.9983914f, -1.9967504f, 0.9967827f}, {0.9985129f, -1.9969935f, 0.9985129f, -1.9969935f, 0.9970258f}, {0.9986226f, -1.9972128f, 0.9986226f, -1.9972128f, 0.9972451f}, {0.9987217f, -1.9974111f, 0.9987217f, -1.9974111f, 0.9974434f}, {0.9988114f, -1.9975905f, 0.9988114f, -1.9975905f, 0.9976228f}, {0.9988927f, -1.9977531f, 0.9988927f, -1.9977531f, 0.9977854f}, {0.9989666f, -1.9979008f, 0.9989666f, -1.9979008f, 0.9979331f}, {0.9990337f, -1.9980351f, 0.9990337f, -1.9980351f, 0.9980675f}, {0.999095f, -1.9981576f, 0.999095f, -1.9981576f, 0.9981899f}, {0.9991509f, -1.9982694f, 0.9991509f, -1.9982694f, 0.9983018f}, {0.9992021f, -1.9983718f, 0.9992021f, -1.9983718f, 0.9984041f}, {0.999249f, -1.9984656f, 0.999249f, -1.9984656f, 0.9984979f}, {0.999292f, -1.9985517f, 0.999292f, -1.9985517f, 0.9985841f}, {0.9993317f, -1.998631f, 0.9993317f, -1.998631f, 0.9986633f}, {0.9993682f, -1.998704f, 0.9993682f, -1.998704f, 0.9987364f}, {0.9994019f, -1.9987715f, 0.9994019f, -1.9987715f, 0.9988038f}, {0.9994331f, -1.9988339f, 0.9994331f, -1.9988339f, 0.9988662f}, {0.999462f, -1.9988916f, 0.999462f, -1.9988916f, 0.998924f}, {0.9994888f, -1.9989453f, 0.9994888f, -1.9989453f, 0.9989776f}, {0.9995137f, -1.9989951f, 0.9995137f, -1.9989951f, 0.9990274f}, {0.9995369f, -1.9990415f, 0.9995369f, -1.9990415f, 0.9990738f}, {0.9995585f, -1.9990847f, 0.9995585f, -1.9990847f, 0.999117f}, {0.9995787f, -1.999125f, 0.9995787f, -1.999125f, 0.9991574f}, {0.9995976f, -1.9991628f, 0.9995976f, -1.9991628f, 0.9991951f}, {0.9996152f, -1.9991981f, 0.9996152f, -1.9991981f, 0.9992304f}, {0.9996317f, -1.9992311f, 0.9996317f, -1.9992311f, 0.9992635f}, {0.9996473f, -1.9992622f, 0.9996473f, -1.9992622f, 0.9992945f}, {0.9996622f, -1.999292f, 0.9996622f, -1.999292f, 0.9993244f}, {0.999677f, -1.9993217f, 0.999677f, -1.9993217f, 0.999354f}, {0.9996917f, -1.9993511f, 0.9996917f, -1.9993511f, 0.9993834f}, {0.9997062f, -1.9993801f, 0.9997062f, -1.9993801f, 0.9994125f}, {0.9997205f, -1.9994087f, 0.9997205f, -1.9994087f, 0.9994411f}, {0.9997346f, -1.9994368f, 0.9997346f, -1.9994368f, 0.9994691f}, {0.9997483f, -1.9994642f, 0.9997483f, -1.9994642f, 0.9994966f}, {0.9997616f, -1.9994909f, 0.9997616f, -1.9994909f, 0.9995233f}, {0.9997746f, -1.9995168f, 0.9997746f, -1.9995168f, 0.9995491f}, {0.9997871f, -1.9995418f, 0.9997871f, -1.9995418f, 0.9995742f}, {0.9997991f, -1.9995659f, 0.9997991f, -1.9995659f, 0.9995982f}, {0.9998107f, -1.999589f, 0.9998107f, -1.999589f, 0.9996214f}, {0.9998217f, -1.9996111f, 0.9998217f, -1.9996111f, 0.9996435f}, {0.9998323f, -1.9996322f, 0.9998323f, -1.9996322f, 0.9996646f}, {0.9998423f, -1.9996523f, 0.9998423f, -1.9996523f, 0.9996846f}, {0.9998518f, -1.9996713f, 0.9998518f, -1.9996713f, 0.9997037f}, {0.9998609f, -1.9996894f, 0.9998609f, -1.9996894f, 0.9997217f}, {0.9998694f, -1.9997064f, 0.9998694f, -1.9997064f, 0.9997388f}, {0.9998774f, -1.9997225f, 0.9998774f, -1.9997225f, 0.9997548f}},
-        {{0.9949341f, -1.9898424f, 0.9949341f, -1.9898424f, 0.9898682f}, {0.9949732f, -1.9899206f, 0.9949732f, -1.9899206f, 0.9899463f}, {0.9950868f, -1.9901479f, 0.9950868f, -1.9901479f, 0.9901737f}, {0.9952653f, -1.9905047f, 0.9952653f, -1.9905047f, 0.9905305f}, {0.9954943f, -1.9909628f, 0.9954943f, -1.9909628f, 0.9909887f}, {0.9957582f, -1.9914906f, 0.9957582f, -1.9914906f, 0.9915164f}, {0.9960415f, -1.9920572f, 0.9960415f, -1.9920572f, 0.992083f}, {0.9963311f, -1.9926364f, 0.9963311f, -1.9926364f, 0.9926623f}, {0.9966167f, -1.9932077f, 0.9966167f, -1.9932077f, 0.9932335f}, {0.996891f, -1.9937562f, 0.996891f, -1.9937562f, 0.9937821f}, {0.9971493f, -1.9942728f, 0.9971493f, -1.9942728f, 0.9942987f}, {0.9973891f, -1.9947523f, 0.9973891f, -1.9947523f, 0.9947782f}, {0.9976093f, -1.9951928f, 0.9976093f, -1.9951928f, 0.9952186f}, {0.9978101f, -1.9955943f, 0.9978101f, -1.9955943f, 0.9956202f}, {0.9979922f, -1.9959585f, 0.9979922f, -1.9959585f, 0.9959844f}, {0.9981568f, -1.9962878f, 0.9981568f, -1.9962878f, 0.9963137f}, {0.9983054f, -1.9965848f, 0.9983054f, -1.9965848f, 0.9966107f}, {0.9984393f, -1.9968526f, 0.9984393f, -1.9968526f, 0.9968785f}, {0.9985599f, -1.997094f, 0.9985599f, -1.997094f, 0.9971198f}, {0.9986687f, -1.9973116f, 0.9986687f, -1.9973116f, 0.9973375f}, {0.9987669f, -1.997508f, 0.9987669f, -1.997508f, 0.9975339f}, {0.9988557f, -1.9976855f, 0.9988557f, -1.9976855f, 0.9977114f}, {0.998936f, -1.9978461f, 0.998936f, -1.9978461f, 0.997872f}, {0.9990088f, -1.9979917f, 0.9990088f, -1.9979917f, 0.9980176f}, {0.9990749f, -1.9981239f, 0.9990749f, -1.9981239f, 0.9981498f}, {0.999135f, -1.9982442f, 0.999135f, -1.9982442f, 0.9982701f}, {0.9991899f, -1.9983538f, 0.9991899f, -1.9983538f, 0.9983797f}, {0.9992399f, -1.998454f, 0.9992399f, -1.998454f, 0.9984799f}, {0.9992857f, -1.9985456f, 0.9992857f, -1.9985456f, 0.9985715f}, {0.9993277f, -1.9986295f, 0.9993277f, -1.9986295f, 0.9986554f}, {0.9993663f, -1.9987066f, 0.9993663f, -1.9987066f, 0.9987326f}, {0.9994018f, -1.9987776f, 0.9994018f, -1.9987776f, 0.9988035f}, {0.9994345f, -1.998843f, 0.9994345f, -1.998843f, 0.9988689f}, {0.9994646f, -1.9989034f, 0.9994646f, -1.9989034f, 0.9989293f}, {0.9994926f, -1.9989592f, 0.9994926f, -1.9989592f, 0.9989851f}, {0.9995184f, -1.9990109f, 0.9995184f, -1.9990109f, 0.9990369f}, {0.9995424f, -1.9990589f, 0.9995424f, -1.9990589f, 0.9990849f}, {0.9995647f, -1.9991035f, 0.9995647f, -1.9991035f, 0.9991295f}, {0.9995855f, -1.9991451f, 0.9995855f, -1.9991451f, 0.999171f}, {0.9996048f, -1.9991838f, 0.9996048f, -1.9991838f, 0.9992097f}, {0.9996229f, -1.9992199f, 0.9996229f, -1.9992199f, 0.9992458f}, {0.9996398f, -1.9992536f, 0.9996398f, -1.9992536f, 0.9992795f}, {0.9996556f, -1.9992852f, 0.9996556f, -1.9992852f, 0.9993111f}, {0.9996704f, -1.9993148f, 0.9996704f, -1.9993148f, 0.9993407f}, {0.9996843f, -1.9993426f, 0.9996843f, -1.9993426f, 0.9993685f}, {0.9996976f, -1.9993693f, 0.9996976f, -1.9993693f, 0.9993952f}, {0.9997109f, -1.9993959f, 0.9997109f, -1.9993959f, 0.9994218f}, {0.9997241f, -1.9994222f, 0.9997241f, -1.9994222f, 0.9994481f}, {0.9997371f, -1.9994482f, 0.9997371f, -1.9994482f, 0.9994741f}, {0.9997499f, -1.9994738f, 0.9997499f, -1.9994738f, 0.9994997f}, {0.9997624f, -1.9994989f, 0.9997624f, -1.9994989f, 0.9995248f}, {0.9997747f, -1.9995235f, 0.9997747f, -1.9995235f, 0.9995494f}, {0.9997866f, -1.9995474f, 0.9997866f, -1.9995474f, 0.9995733f}, {0.9997982f, -1.9995705f, 0.9997982f, -1.9995705f, 0.9995964f}, {0.9998094f, -1.9995929f, 0.9998094f, -1.9995929f, 0.9996188f}, {0.9998202f, -1.9996145f, 0.9998202f, -1.9996145f, 0.9996404f}, {0.9998305f, -1.9996352f, 0.9998305f, -1.9996352f, 0.9996611f}, {0.9998404f, -1.999655f, 0.9998404f, -1.999655f, 0.9996809f}, {0.9998499f, -1.9996738f, 0.9998499f, -1.9996738f, 0.9996998f}, {0.9998589f, -1.9996918f, 0.9998589f, -1.9996918f, 0.9997177f}, {0.9998674f, -1.9997089f, 0.9998674f, -1.9997089f, 0.9997348f}, {0.9998755f, -1.999725f, 0.9998755f, -1.999725f, 0.9997509f}, {0.9998831f, -1.9997403f, 0.9998831f, -1.9997403f, 0.9997662f}, {0.9998903f, -1.9997546f, 0.9998903f, -1.9997546f, 0.9997806f}},
-        {{0.9954633f, -1.990906f, 0.9954633f, -1.990906f, 0.9909266f}, {0.9954983f, -1.990976f, 0.9954983f, -1.990976f, 0.9909966f}, {0.9956002f, -1.9911796f, 0.9956002f, -1.9911796f, 0.9912003f}, {0.99576f, -1.9914994f, 0.99576f, -1.9914994f, 0.99152f}, {0.9959653f, -1.9919098f, 0.9959653f, -1.9919098f, 0.9919305f}, {0.9962016f, -1.9923826f, 0.9962016f, -1.9923826f, 0.9924033f}, {0.9964555f, -1.9928902f, 0.9964555f, -1.9928902f, 0.9929109f}, {0.9967149f, -1.9934091f, 0.9967149f, -1.9934091f, 0.9934298f}, {0.9969707f, -1.9939207f, 0.9969707f, -1.9939207f, 0.9939414f}, {0.9972164f, -1.9944121f, 0.9972164f, -1.9944121f, 0.9944328f}, {0.9974477f, -1.9948747f, 0.9974477f, -1.9948747f, 0.9948955f}, {0.9976625f, -1.9953042f, 0.9976625f, -1.9953042f, 0.9953249f}, {0.9978597f, -1.9956986f, 0.9978597f, -1.9956986f, 0.9957193f}, {0.9980395f, -1.9960582f, 0.9980395f, -1.9960582f, 0.9960789f}, {0.9982025f, -1.9963843f, 0.9982025f, -1.9963843f, 0.9964051f}, {0.9983499f, -1.9966791f, 0.9983499f, -1.9966791f, 0.9966999f}, {0.9984829f, -1.9969451f, 0.9984829f, -1.9969451f, 0.9969659f}, {0.9986028f, -1.9971849f, 0.9986028f, -1.9971849f, 0.9972056f}, {0.9987109f, -1.997401f, 0.9987109f, -1.997401f, 0.9974217f}, {0.9988083f, -1.9975958f, 0.9988083f, -1.9975958f, 0.9976165f}, {0.9988962f, -1.9977716f, 0.9988962f, -1.9977716f, 0.9977924f}, {0.9989756f, -1.9979305f, 0.9989756f, -1.9979305f, 0.9979513f}, {0.9990475f, -1.9980743f, 0.9990475f, -1.9980743f, 0.9980951f}, {0.9991127f, -1.9982047f, 0.9991127f, -1.9982047f, 0.9982254f}, {0.9991719f, -1.9983231f, 0.9991719f, -1.9983231f, 0.9983438f}, {0.9992257f, -1.9984307f, 0.9992257f, -1.9984307f, 0.9984515f}, {0.9992748f, -1.9985289f, 0.9992748f, -1.9985289f, 0.9985496f}, {0.9993196f, -1.9986185f, 0.9993196f, -1.9986185f, 0.9986393f}, {0.9993606f, -1.9987005f, 0.9993606f, -1.9987005f, 0.9987213f}, {0.9993982f, -1.9987757f, 0.9993982f, -1.9987757f, 0.9987965f}, {0.9994327f, -1.9988447f, 0.9994327f, -1.9988447f, 0.9988655f}, {0.9994645f, -1.9989082f, 0.9994645f, -1.9989082f, 0.998929f}, {0.9994938f, -1.9989668f, 0.9994938f, -1.9989668f, 0.9989875f}, {0.9995208f, -1.9990208f, 0.9995208f, -1.9990208f, 0.9990416f}, {0.9995458f, -1.9990708f, 0.9995458f, -1.9990708f, 0.9990916f}, {0.9995689f, -1.9991171f, 0.9995689f, -1.9991171f, 0.9991379f}, {0.9995904f, -1.9991601f, 0.9995904f, -1.9991601f, 0.9991808f}, {0.9996104f, -1.9992f, 0.9996104f, -1.9992f, 0.9992208f}, {0.999629f, -1.9992372f, 0.999629f, -1.9992372f, 0.9992579f}, {0.9996463f, -1.9992718f, 0.9996463f, -1.9992718f, 0.9992926f}, {0.9996625f, -1.9993041f, 0.9996625f, -1.9993041f, 0.9993249f}, {0.9996776f, -1.9993344f, 0.9996776f, -1.9993344f, 0.9993551f}, {0.9996917f, -1.9993626f, 0.9996917f, -1.9993626f, 0.9993834f}, {0.999705f, -1.9993891f, 0.999705f, -1.9993891f, 0.9994099f}, {0.9997174f, -1.999414f, 0.9997174f, -1.999414f, 0.9994348f}, {0.9997293f, -1.9994379f, 0.9997293f, -1.9994379f, 0.9994587f}, {0.9997412f, -1.9994617f, 0.9997412f, -1.9994617f, 0.9994825f}, {0.999753f, -1.9994853f, 0.999753f, -1.9994853f, 0.999506f}, {0.9997646f, -1.9995085f, 0.9997646f, -1.9995085f, 0.9995293f}, {0.9997761f, -1.9995315f, 0.9997761f, -1.9995315f, 0.9995522f}, {0.9997873f, -1.9995539f, 0.9997873f, -1.9995539f, 0.9995747f}, {0.9997983f, -1.9995759f, 0.9997983f, -1.9995759f, 0.9995967f}, {0.999809f, -1.9995973f, 0.999809f, -1.9995973f, 0.999618f}, {0.9998194f, -1.999618f, 0.9998194f, -1.999618f, 0.9996388f}, {0.9998294f, -1.9996381f, 0.9998294f, -1.9996381f, 0.9996588f}, {0.9998391f, -1.9996574f, 0.9998391f, -1.9996574f, 0.9996781f}, {0.9998483f, -1.9996759f, 0.9998483f, -1.9996759f, 0.9996966f}, {0.9998572f, -1.9996936f, 0.9998572f, -1.9996936f, 0.9997144f}, {0.9998656f, -1.9997105f, 0.9998656f, -1.9997105f, 0.9997313f}, {0.9998737f, -1.9997266f, 0.9998737f, -1.9997266f, 0.9997474f}, {0.9998813f, -1.9997418f, 0.9998813f, -1.9997418f, 0.9997626f}, {0.9998885f, -1.9997563f, 0.9998885f, -1.9997563f, 0.9997771f}, {0.9998954f, -1.9997699f, 0.9998954f, -1.9997699f, 0.9997907f}, {0.9999018f, -1.9997828f, 0.9999018f, -1.9997828f, 0.9998036f}},
-        {{0.9959375f, -1.9918584f, 0.9959375f, -1.9918584f, 0.991875f}, {0.9959688f, -1.9919211f, 0.9959688f, -1.9919211f, 0.9919377f}, {0.9960601f, -1.9921036f, 0.9960601f, -1.9921036f, 0.9921201f}, {0.9962033f, -1.99239f, 0.9962033f, -1.99239f, 0.9924066f}, {0.9963871f, -1.9927577f, 0.9963871f, -1.9927577f, 0.9927743f}, {0.9965989f, -1.9931812f, 0.9965989f, -1.9931812f, 0.9931978f}, {0.9968262f, -1.9936359f, 0.9968262f, -1.9936359f, 0.9936525f}, {0.9970586f, -1.9941006f, 0.9970586f, -1.9941006f, 0.9941172f}, {0.9972878f, -1.9945589f, 0.9972878f, -1.9945589f, 0.9945755f}, {0.9975078f, -1.994999f, 0.9975078f, -1.994999f, 0.9950156f}, {0.997715f, -1.9954133f, 0.997715f, -1.9954133f, 0.9954299f}, {0.9979072f, -1.9957979f, 0.9979072f, -1.9957979f, 0.9958145f}, {0.9980838f, -1.9961511f, 0.9980838f, -1.9961511f, 0.9961677f}, {0.9982448f, -1.9964731f, 0.9982448f, -1.9964731f, 0.9964897f}, {0.9983909f, -1.9967651f, 0.9983909f, -1.9967651f, 0.9967817f}, {0.9985228f, -1.9970291f, 0.9985228f, -1.9970291f, 0.9970457f}, {0.9986419f, -1.9972672f, 0.9986419f, -1.9972672f, 0.9972838f}, {0.9987493f, -1.9974819f, 0.9987493f, -1.9974819f, 0.9974985f}, {0.998846f, -1.9976753f, 0.998846f, -1.9976753f, 0.997692f}, {0.9989332f, -1.9978498f, 0.9989332f, -1.9978498f, 0.9978664f}, {0.9990119f, -1.9980072f, 0.9990119f, -1.9980072f, 0.9980238f}, {0.999083f, -1.9981495f, 0.999083f, -1.9981495f, 0.9981661f}, {0.9991474f, -1.9982782f, 0.9991474f, -1.9982782f, 0.9982948f}, {0.9992058f, -1.9983949f, 0.9992058f, -1.9983949f, 0.9984115f}, {0.9992587f, -1.9985009f, 0.9992587f, -1.9985009f, 0.9985175f}, {0.9993069f, -1.9985973f, 0.9993069f, -1.9985973f, 0.9986139f}, {0.9993509f, -1.9986851f, 0.9993509f, -1.9986851f, 0.9987018f}, {0.999391f, -1.9987654f, 0.999391f, -1.9987654f, 0.998782f}, {0.9994277f, -1.9988388f, 0.9994277f, -1.9988388f, 0.9988554f}, {0.9994613f, -1.9989061f, 0.9994613f, -1.9989061f, 0.9989227f}, {0.9994922f, -1.9989679f, 0.9994922f, -1.9989679f, 0.9989845f}, {0.9995207f, -1.9990247f, 0.9995207f, -1.9990247f, 0.9990413f}, {0.9995469f, -1.9990771f, 0.9995469f, -1.9990771f, 0.9990937f}, {0.9995711f, -1.9991255f, 0.9995711f, -1.9991255f, 0.9991421f}, {0.9995934f, -1.9991702f, 0.9995934f, -1.9991702f, 0.9991869f}, {0.9996142f, -1.9992117f, 0.9996142f, -1.9992117f, 0.9992283f}, {0.9996334f, -1.9992501f, 0.9996334f, -1.9992501f, 0.9992668f}, {0.9996513f, -1.9992859f, 0.9996513f, -1.9992859f, 0.9993025f}, {0.9996679f, -1.9993192f, 0.9996679f, -1.9993192f, 0.9993358f}, {0.9996834f, -1.9993502f, 0.9996834f, -1.9993502f, 0.9993668f}, {0.9996979f, -1.9993791f, 0.9996979f, -1.9993791f, 0.9993957f}, {0.9997114f, -1.9994061f, 0.9997114f, -1.9994061f, 0.9994228f}, {0.999724f, -1.9994315f, 0.999724f, -1.9994315f, 0.9994481f}, {0.9997359f, -1.9994552f, 0.9997359f, -1.9994552f, 0.9994718f}, {0.999747f, -1.9994774f, 0.999747f, -1.9994774f, 0.9994941f}, {0.9997577f, -1.9994988f, 0.9997577f, -1.9994988f, 0.9995155f}, {0.9997684f, -1.9995201f, 0.9997684f, -1.9995201f, 0.9995368f}, {0.9997789f, -1.9995412f, 0.9997789f, -1.9995412f, 0.9995578f}, {0.9997893f, -1.999562f, 0.9997893f, -1.999562f, 0.9995787f}, {0.9997996f, -1.9995826f, 0.9997996f, -1.9995826f, 0.9995992f}, {0.9998097f, -1.9996027f, 0.9998097f, -1.9996027f, 0.9996193f}, {0.9998195f, -1.9996223f, 0.9998195f, -1.9996223f, 0.999639f}, {0.9998291f, -1.9996415f, 0.9998291f, -1.9996415f, 0.9996581f}, {0.9998383f, -1.99966f, 0.9998383f, -1.99966f, 0.9996767f}, {0.9998473f, -1.999678f, 0.9998473f, -1.999678f, 0.9996946f}, {0.9998559f, -1.9996953f, 0.9998559f, -1.9996953f, 0.9997119f}, {0.9998642f, -1.9997118f, 0.9998642f, -1.9997118f, 0.9997285f}, {0.9998722f, -1.9997277f, 0.9998722f, -1.9997277f, 0.9997443f}, {0.9998797f, -1.9997428f, 0.9998797f, -1.9997428f, 0.9997595f}, {0.9998869f, -1.9997572f, 0.9998869f, -1.9997572f, 0.9997739f}, {0.9998938f, -1.9997709f, 0.9998938f, -1.9997709f, 0.9997875f}, {0.9999002f, -1.9997838f, 0.9999002f, -1.9997838f, 0.9998005f}, {0.9999063f, -1.999796f, 0.9999063f, -1.999796f, 0.9998127f}, {0.9999121f, -1.9998076f, 0.9999121f, -1.9998076f, 0.9998242f}},
-        {{0.9963623f, -1.9927112f, 0.9963623f, -1.9927112f, 0.9927245f}, {0.9963903f, -1.9927674f, 0.9963903f, -1.9927674f, 0.9927807f}, {0.9964721f, -1.9929309f, 0.9964721f, -1.9929309f, 0.9929441f}, {0.9966004f, -1.9931874f, 0.9966004f, -1.9931874f, 0.9932007f}, {0.9967651f, -1.9935168f, 0.9967651f, -1.9935168f, 0.9935301f}, {0.9969547f, -1.9938962f, 0.9969547f, -1.9938962f, 0.9939094f}, {0.9971584f, -1.9943034f, 0.9971584f, -1.9943034f, 0.9943167f}, {0.9973665f, -1.9947197f, 0.9973665f, -1.9947197f, 0.994733f}, {0.9975717f, -1.9951301f, 0.9975717f, -1.9951301f, 0.9951434f}, {0.9977687f, -1.9955242f, 0.9977687f, -1.9955242f, 0.9955375f}, {0.9979543f, -1.9958952f, 0.9979543f, -1.9958952f, 0.9959085f}, {0.9981265f, -1.9962396f, 0.9981265f, -1.9962396f, 0.9962529f}, {0.9982846f, -1.9965559f, 0.9982846f, -1.9965559f, 0.9965692f}, {0.9984287f, -1.9968442f, 0.9984287f, -1.9968442f, 0.9968575f}, {0.9985595f, -1.9971056f, 0.9985595f, -1.9971056f, 0.997119f}, {0.9986777f, -1.997342f, 0.9986777f, -1.997342f, 0.9973553f}, {0.9987843f, -1.9975552f, 0.9987843f, -1.9975552f, 0.9975685f}, {0.9988804f, -1.9977474f, 0.9988804f, -1.9977474f, 0.9977607f}, {0.998967f, -1.9979206f, 0.998967f, -1.9979206f, 0.9979339f}, {0.999045f, -1.9980768f, 0.999045f, -1.9980768f, 0.9980901f}, {0.9991155f, -1.9982177f, 0.9991155f, -1.9982177f, 0.998231f}, {0.9991792f, -1.9983451f, 0.9991792f, -1.9983451f, 0.9983584f}, {0.9992368f, -1.9984603f, 0.9992368f, -1.9984603f, 0.9984736f}, {0.9992891f, -1.9985648f, 0.9992891f, -1.9985648f, 0.9985781f}, {0.9993365f, -1.9986596f, 0.9993365f, -1.9986596f, 0.998673f}, {0.9993796f, -1.9987459f, 0.9993796f, -1.9987459f, 0.9987593f}, {0.999419f, -1.9988246f, 0.999419f, -1.9988246f, 0.9988379f}, {0.9994549f, -1.9988964f, 0.9994549f, -1.9988964f, 0.9989097f}, {0.9994877f, -1.9989621f, 0.9994877f, -1.9989621f, 0.9989755f}, {0.9995178f, -1.9990224f, 0.9995178f, -1.9990224f, 0.9990357f}, {0.9995455f, -1.9990777f, 0.9995455f, -1.9990777f, 0.999091f}, {0.999571f, -1.9991286f, 0.999571f, -1.9991286f, 0.9991419f}, {0.9995944f, -1.9991755f, 0.9995944f, -1.9991755f, 0.9991888f}, {0.9996161f, -1.9992188f, 0.9996161f, -1.9992188f, 0.9992321f}, {0.9996361f, -1.9992588f, 0.9996361f, -1.9992588f, 0.9992722f}, {0.9996546f, -1.9992959f, 0.9996546f, -1.9992959f, 0.9993093f}, {0.9996719f, -1.9993304f, 0.9996719f, -1.9993304f, 0.9993437f}, {0.9996878f, -1.9993624f, 0.9996878f, -1.9993624f, 0.9993757f}, {0.9997027f, -1.9993921f, 0.9997027f, -1.9993921f, 0.9994055f}, {0.9997166f, -1.9994199f, 0.9997166f, -1.9994199f, 0.9994332f}, {0.9997296f, -1.9994458f, 0.9997296f, -1.9994458f, 0.9994591f}, {0.9997417f, -1.99947f, 0.9997417f, -1.99947f, 0.9994833f}, {0.999753f, -1.9994927f, 0.999753f, -1.9994927f, 0.999506f}, {0.9997636f, -1.9995139f, 0.9997636f, -1.9995139f, 0.9995272f}, {0.9997736f, -1.9995338f, 0.9997736f, -1.9995338f, 0.9995472f}, {0.9997832f, -1.999553f, 0.9997832f, -1.999553f, 0.9995663f}, {0.9997927f, -1.999572f, 0.9997927f, -1.999572f, 0.9995854f}, {0.9998021f, -1.9995909f, 0.9998021f, -1.9995909f, 0.9996042f}, {0.9998114f, -1.9996096f, 0.9998114f, -1.9996096f, 0.9996229f}, {0.9998206f, -1.9996279f, 0.9998206f, -1.9996279f, 0.9996413f}, {0.9998296f, -1.9996459f, 0.9998296f, -1.9996459f, 0.9996593f}, {0.9998384f, -1.9996635f, 0.9998384f, -1.9996635f, 0.9996769f}, {0.999847f, -1.9996807f, 0.999847f, -1.9996807f, 0.999694f}, {0.9998553f, -1.9996973f, 0.9998553f, -1.9996973f, 0.9997106f}, {0.9998633f, -1.9997133f, 0.9998633f, -1.9997133f, 0.9997267f}, {0.9998711f, -1.9997288f, 0.9998711f, -1.9997288f, 0.9997421f}, {0.9998785f, -1.9997436f, 0.9998785f, -1.9997436f, 0.999757f}, {0.9998856f, -1.9997578f, 0.9998856f, -1.9997578f, 0.9997712f}, {0.9998924f, -1.9997714f, 0.9998924f, -1.9997714f, 0.9997847f}, {0.9998988f, -1.9997843f, 0.9998988f, -1.9997843f, 0.9997976f}, {0.9999049f, -1.9997965f, 0.9999049f, -1.9997965f, 0.9998098f}, {0.9999107f, -1.9998081f, 0.9999107f, -1.9998081f, 0.9998214f}, {0.9999162f, -1.999819f, 0.9999162f, -1.999819f, 0.9998323f}, {0.9999213f, -1.9998293f, 0.9999213f, -1.9998293f, 0.9998426f}},
-        {{0.9967428f, -1.9934749f, 0.9967428f, -1.9934749f, 0.9934855f}, {0.9967679f, -1.9935252f, 0.9967679f, -1.9935252f, 0.9935359f}, {0.9968411f, -1.9936716f, 0.9968411f, -1.9936716f, 0.9936823f}, {0.996956f, -1.9939014f, 0.996956f, -1.9939014f, 0.9939121f}, {0.9971036f, -1.9941965f, 0.9971036f, -1.9941965f, 0.9942071f}, {0.9972734f, -1.9945362f, 0.9972734f, -1.9945362f, 0.9945469f}, {0.9974558f, -1.994901f, 0.9974558f, -1.994901f, 0.9949116f}, {0.9976422f, -1.9952737f, 0.9976422f, -1.9952737f, 0.9952844f}, {0.997826f, -1.9956413f, 0.997826f, -1.9956413f, 0.9956519f}, {0.9980024f, -1.9959942f, 0.9980024f, -1.9959942f, 0.9960048f}, {0.9981686f, -1.9963265f, 0.9981686f, -1.9963265f, 0.9963371f}, {0.9983227f, -1.9966348f, 0.9983227f, -1.9966348f, 0.9966455f}, {0.9984643f, -1.996918f, 0.9984643f, -1.996918f, 0.9969287f}, {0.9985934f, -1.9971761f, 0.9985934f, -1.9971761f, 0.9971868f}, {0.9987105f, -1.9974102f, 0.9987105f, -1.9974102f, 0.9974209f}, {0.9988163f, -1.9976219f, 0.9988163f, -1.9976219f, 0.9976325f}, {0.9989117f, -1.9978128f, 0.9989117f, -1.9978128f, 0.9978234f}, {0.9989977f, -1.9979848f, 0.9989977f, -1.9979848f, 0.9979955f}, {0.9990753f, -1.9981399f, 0.9990753f, -1.9981399f, 0.9981505f}, {0.9991452f, -1.9982797f, 0.9991452f, -1.9982797f, 0.9982904f}, {0.9992083f, -1.9984059f, 0.9992083f, -1.9984059f, 0.9984165f}, {0.9992653f, -1.9985199f, 0.9992653f, -1.9985199f, 0.9985305f}, {0.9993169f, -1.998623f, 0.9993169f, -1.998623f, 0.9986337f}, {0.9993636f, -1.9987166f, 0.9993636f, -1.9987166f, 0.9987272f}, {0.9994061f, -1.9988015f, 0.9994061f, -1.9988015f, 0.9988121f}, {0.9994447f, -1.9988787f, 0.9994447f, -1.9988787f, 0.9988894f}, {0.9994799f, -1.9989491f, 0.9994799f, -1.9989491f, 0.9989598f}, {0.999512f, -1.9990134f, 0.999512f, -1.9990134f, 0.9990241f}, {0.9995415f, -1.9990722f, 0.9995415f, -1.9990722f, 0.9990829f}, {0.9995684f, -1.9991262f, 0.9995684f, -1.9991262f, 0.9991368f}, {0.9995932f, -1.9991757f, 0.9995932f, -1.9991757f, 0.9991864f}, {0.999616f, -1.9992212f, 0.999616f, -1.9992212f, 0.9992319f}, {0.999637f, -1.9992632f, 0.999637f, -1.9992632f, 0.9992739f}, {0.9996563f, -1.999302f, 0.9996563f, -1.999302f, 0.9993127f}, {0.9996743f, -1.9993378f, 0.9996743f, -1.9993378f, 0.9993485f}, {0.9996909f, -1.9993711f, 0.9996909f, -1.9993711f, 0.9993817f}, {0.9997063f, -1.9994019f, 0.9997063f, -1.9994019f, 0.9994126f}, {0.9997206f, -1.9994305f, 0.9997206f, -1.9994305f, 0.9994412f}, {0.9997339f, -1.9994572f, 0.9997339f, -1.9994572f, 0.9994678f}, {0.9997463f, -1.999482f, 0.9997463f, -1.999482f, 0.9994927f}, {0.9997579f, -1.9995052f, 0.9997579f, -1.9995052f, 0.9995159f}, {0.9997688f, -1.9995269f, 0.9997688f, -1.9995269f, 0.9995375f}, {0.9997789f, -1.9995472f, 0.9997789f, -1.9995472f, 0.9995578f}, {0.9997884f, -1.9995662f, 0.9997884f, -1.9995662f, 0.9995768f}, {0.9997973f, -1.999584f, 0.9997973f, -1.999584f, 0.9995947f}, {0.9998059f, -1.9996011f, 0.9998059f, -1.9996011f, 0.9996118f}, {0.9998144f, -1.9996182f, 0.9998144f, -1.9996182f, 0.9996289f}, {0.9998229f, -1.9996351f, 0.9998229f, -1.9996351f, 0.9996458f}, {0.9998312f, -1.9996518f, 0.9998312f, -1.9996518f, 0.9996625f}, {0.9998394f, -1.9996682f, 0.9998394f, -1.9996682f, 0.9996789f}, {0.9998475f, -1.9996843f, 0.9998475f, -1.9996843f, 0.999695f}, {0.9998554f, -1.9997001f, 0.9998554f, -1.9997001f, 0.9997108f}, {0.9998631f, -1.9997154f, 0.9998631f, -1.9997154f, 0.9997261f}, {0.9998705f, -1.9997303f, 0.9998705f, -1.9997303f, 0.999741f}, {0.9998777f, -1.9997447f, 0.9998777f, -1.9997447f, 0.9997553f}, {0.9998846f, -1.9997585f, 0.9998846f, -1.9997585f, 0.9997692f}, {0.9998912f, -1.9997718f, 0.9998912f, -1.9997718f, 0.9997825f}, {0.9998976f, -1.9997845f, 0.9998976f, -1.9997845f, 0.9997952f}, {0.9999036f, -1.9997966f, 0.9999036f, -1.9997966f, 0.9998073f}, {0.9999094f, -1.9998082f, 0.9999094f, -1.9998082f, 0.9998188f}, {0.9999149f, -1.9998191f, 0.9999149f, -1.9998191f, 0.9998298f}, {0.9999201f, -1.9998295f, 0.9999201f, -1.9998295f, 0.9998401f}, {0.999925f, -1.9998392f, 0.999925f, -1.9998392f, 0.9998499f}, {0.9999296f, -1.9998485f, 0.9999296f, -1.9998485f, 0.9998592f}},
-        {{0.9970836f, -1.9941587f, 0.9970836f, -1.9941587f, 0.9941672f}, {0.9971061f, -1.9942037f, 0.9971061f, -1.9942037f, 0.9942123f}, {0.9971717f, -1.9943349f, 0.9971717f, -1.9943349f, 0.9943434f}, {0.9972746f, -1.9945407f, 0.9972746f, -1.9945407f, 0.9945492f}, {0.9974067f, -1.9948049f, 0.9974067f, -1.9948049f, 0.9948134f}, {0.9975589f, -1.9951092f, 0.9975589f, -1.9951092f, 0.9951177f}, {0.9977222f, -1.9954359f, 0.9977222f, -1.9954359f, 0.9954444f}, {0.9978891f, -1.9957697f, 0.9978891f, -1.9957697f, 0.9957782f}, {0.9980537f, -1.9960988f, 0.9980537f, -1.9960988f, 0.9961073f}, {0.9982117f, -1.9964148f, 0.9982117f, -1.9964148f, 0.9964234f}, {0.9983604f, -1.9967123f, 0.9983604f, -1.9967123f, 0.9967209f}, {0.9984985f, -1.9969884f, 0.9984985f, -1.9969884f, 0.996997f}, {0.9986253f, -1.997242f, 0.9986253f, -1.997242f, 0.9972505f}, {0.9987408f, -1.9974731f, 0.9987408f, -1.9974731f, 0.9974817f}, {0.9988456f, -1.9976827f, 0.9988456f, -1.9976827f, 0.9976913f}, {0.9989404f, -1.9978722f, 0.9989404f, -1.9978722f, 0.9978807f}, {0.9990258f, -1.9980431f, 0.9990258f, -1.9980431f, 0.9980516f}, {0.9991028f, -1.9981971f, 0.9991028f, -1.9981971f, 0.9982057f}, {0.9991722f, -1.9983359f, 0.9991722f, -1.9983359f, 0.9983445f}, {0.9992348f, -1.9984611f, 0.9992348f, -1.9984611f, 0.9984696f}, {0.9992913f, -1.998574f, 0.9992913f, -1.998574f, 0.9985826f}, {0.9993423f, -1.9986761f, 0.9993423f, -1.9986761f, 0.9986846f}, {0.9993885f, -1.9987685f, 0.9993885f, -1.9987685f, 0.998777f}, {0.9994304f, -1.9988522f, 0.9994304f, -1.9988522f, 0.9988607f}, {0.9994684f, -1.9989282f, 0.9994684f, -1.9989282f, 0.9989367f}, {0.9995029f, -1.9989973f, 0.9995029f, -1.9989973f, 0.9990059f}, {0.9995345f, -1.9990604f, 0.9995345f, -1.9990604f, 0.9990689f}, {0.9995632f, -1.9991179f, 0.9995632f, -1.9991179f, 0.9991265f}, {0.9995896f, -1.9991706f, 0.9995896f, -1.9991706f, 0.9991791f}, {0.9996137f, -1.9992188f, 0.9996137f, -1.9992188f, 0.9992274f}, {0.9996359f, -1.9992632f, 0.9996359f, -1.9992632f, 0.9992717f}, {0.9996562f, -1.9993039f, 0.9996562f, -1.9993039f, 0.9993125f}, {0.999675f, -1.9993415f, 0.999675f, -1.9993415f, 0.9993501f}, {0.9996924f, -1.9993762f, 0.9996924f, -1.9993762f, 0.9993848f}, {0.9997084f, -1.9994083f, 0.9997084f, -1.9994083f, 0.9994169f}, {0.9997233f, -1.999438f, 0.9997233f, -1.999438f, 0.9994466f}, {0.9997371f, -1.9994656f, 0.9997371f, -1.9994656f, 0.9994742f}, {0.9997499f, -1.9994913f, 0.9997499f, -1.9994913f, 0.9994998f}, {0.9997618f, -1.9995151f, 0.9997618f, -1.9995151f, 0.9995237f}, {0.999773f, -1.9995374f, 0.999773f, -1.9995374f, 0.9995459f}, {0.9997833f, -1.9995581f, 0.9997833f, -1.9995581f, 0.9995667f}, {0.999793f, -1.9995775f, 0.999793f, -1.9995775f, 0.9995861f}, {0.9998021f, -1.9995957f, 0.9998021f, -1.9995957f, 0.9996042f}, {0.9998106f, -1.9996127f, 0.9998106f, -1.9996127f, 0.9996212f}, {0.9998186f, -1.9996286f, 0.9998186f, -1.9996286f, 0.9996372f}, {0.9998263f, -1.999644f, 0.9998263f, -1.999644f, 0.9996525f}, {0.9998339f, -1.9996593f, 0.9998339f, -1.9996593f, 0.9996678f}, {0.9998415f, -1.9996744f, 0.9998415f, -1.9996744f, 0.9996829f}, {0.9998489f, -1.9996893f, 0.9998489f, -1.9996893f, 0.9996979f}, {0.9998563f, -1.999704f, 0.9998563f, -1.999704f, 0.9997126f}, {0.9998635f, -1.9997185f, 0.9998635f, -1.9997185f, 0.999727f}, {0.9998706f, -1.9997326f, 0.9998706f, -1.9997326f, 0.9997411f}, {0.9998774f, -1.9997463f, 0.9998774f, -1.9997463f, 0.9997548f}, {0.9998841f, -1.9997596f, 0.9998841f, -1.9997596f, 0.9997682f}, {0.9998905f, -1.9997725f, 0.9998905f, -1.9997725f, 0.999781f}, {0.9998967f, -1.9997849f, 0.9998967f, -1.9997849f, 0.9997934f}, {0.9999026f, -1.9997967f, 0.9999026f, -1.9997967f, 0.9998053f}, {0.9999083f, -1.9998081f, 0.9999083f, -1.9998081f, 0.9998167f}, {0.9999138f, -1.999819f, 0.9999138f, -1.999819f, 0.9998275f}, {0.9999189f, -1.9998293f, 0.9999189f, -1.9998293f, 0.9998378f}, {0.9999238f, -1.9998391f, 0.9999238f, -1.9998391f, 0.9998476f}, {0.9999285f, -1.9998484f, 0.9999285f, -1.9998484f, 0.9998569f}, {0.9999328f, -1.9998571f, 0.9999328f, -1.9998571f, 0.9998657f}, {0.999937f, -1.9998654f, 0.999937f, -1.9998654f, 0.9998739f}},
-        {{0.9973888f, -1.9947709f, 0.9973888f, -1.9947709f, 0.9947777f}, {0.997409f, -1.9948112f, 0.997409f, -1.9948112f, 0.9948181f}, {0.9974678f, -1.9949287f, 0.9974678f, -1.9949287f, 0.9949355f}, {0.9975599f, -1.995113f, 0.9975599f, -1.995113f, 0.9951199f}, {0.9976782f, -1.9953496f, 0.9976782f, -1.9953496f, 0.9953565f}, {0.9978145f, -1.9956221f, 0.9978145f, -1.9956221f, 0.995629f}, {0.9979607f, -1.9959147f, 0.9979607f, -1.9959147f, 0.9959215f}, {0.9981102f, -1.9962136f, 0.9981102f, -1.9962136f, 0.9962204f}, {0.9982576f, -1.9965083f, 0.9982576f, -1.9965083f, 0.9965151f}, {0.9983991f, -1.9967913f, 0.9983991f, -1.9967913f, 0.9967981f}, {0.9985322f, -1.9970577f, 0.9985322f, -1.9970577f, 0.9970645f}, {0.9986559f, -1.9973049f, 0.9986559f, -1.9973049f, 0.9973117f}, {0.9987694f, -1.9975319f, 0.9987694f, -1.9975319f, 0.9975387f}, {0.9988728f, -1.9977388f, 0.9988728f, -1.9977388f, 0.9977456f}, {0.9989666f, -1.9979264f, 0.9989666f, -1.9979264f, 0.9979333f}, {0.9990514f, -1.9980961f, 0.9990514f, -1.9980961f, 0.9981029f}, {0.999128f, -1.9982491f, 0.999128f, -1.9982491f, 0.9982559f}, {0.9991969f, -1.998387f, 0.9991969f, -1.998387f, 0.9983938f}, {0.999259f, -1.9985112f, 0.999259f, -1.9985112f, 0.9985181f}, {0.9993151f, -1.9986233f, 0.9993151f, -1.9986233f, 0.9986301f}, {0.9993656f, -1.9987244f, 0.9993656f, -1.9987244f, 0.9987312f}, {0.9994113f, -1.9988157f, 0.9994113f, -1.9988157f, 0.9988226f}, {0.9994526f, -1.9988984f, 0.9994526f, -1.9988984f, 0.9989053f}, {0.9994901f, -1.9989734f, 0.9994901f, -1.9989734f, 0.9989802f}, {0.9995241f, -1.9990414f, 0.9995241f, -1.9990414f, 0.9990483f}, {0.9995551f, -1.9991033f, 0.9995551f, -1.9991033f, 0.9991102f}, {0.9995833f, -1.9991597f, 0.9995833f, -1.9991597f, 0.9991666f}, {0.9996091f, -1.9992113f, 0.9996091f, -1.9992113f, 0.9992181f}, {0.9996326f, -1.9992584f, 0.9996326f, -1.9992584f, 0.9992652f}, {0.9996542f, -1.9993016f, 0.9996542f, -1.9993016f, 0.9993084f}, {0.9996741f, -1.9993413f, 0.9996741f, -1.9993413f, 0.9993481f}, {0.9996923f, -1.9993778f, 0.9996923f, -1.9993778f, 0.9993846f}, {0.9997091f, -1.9994114f, 0.9997091f, -1.9994114f, 0.9994183f}, {0.9997247f, -1.9994425f, 0.9997247f, -1.9994425f, 0.9994493f}, {0.999739f, -1.9994712f, 0.999739f, -1.9994712f, 0.9994781f}, {0.9997523f, -1.9994978f, 0.9997523f, -1.9994978f, 0.9995047f}, {0.9997647f, -1.9995225f, 0.9997647f, -1.9995225f, 0.9995294f}, {0.9997761f, -1.9995454f, 0.9997761f, -1.9995454f, 0.9995523f}, {0.9997868f, -1.9995668f, 0.9997868f, -1.9995668f, 0.9995737f}, {0.9997968f, -1.9995867f, 0.9997968f, -1.9995867f, 0.9995936f}, {0.9998061f, -1.9996053f, 0.9998061f, -1.9996053f, 0.9996121f}, {0.9998147f, -1.9996226f, 0.9998147f, -1.9996226f, 0.9996295f}, {0.9998229f, -1.9996389f, 0.9998229f, -1.9996389f, 0.9996457f}, {0.9998305f, -1.9996541f, 0.9998305f, -1.9996541f, 0.999661f}, {0.9998376f, -1.9996684f, 0.9998376f, -1.9996684f, 0.9996753f}, {0.9998445f, -1.9996822f, 0.9998445f, -1.9996822f, 0.999689f}, {0.9998513f, -1.9996958f, 0.9998513f, -1.9996958f, 0.9997027f}, {0.9998581f, -1.9997093f, 0.9998581f, -1.9997093f, 0.9997162f}, {0.9998648f, -1.9997227f, 0.9998648f, -1.9997227f, 0.9997296f}, {0.9998714f, -1.9997359f, 0.9998714f, -1.9997359f, 0.9997427f}, {0.9998778f, -1.9997488f, 0.9998778f, -1.9997488f, 0.9997557f}, {0.9998841f, -1.9997614f, 0.9998841f, -1.9997614f, 0.9997683f}, {0.9998903f, -1.9997737f, 0.9998903f, -1.9997737f, 0.9997806f}, {0.9998962f, -1.9997856f, 0.9998962f, -1.9997856f, 0.9997925f}, {0.999902f, -1.9997971f, 0.999902f, -1.9997971f, 0.999804f}, {0.9999075f, -1.9998082f, 0.9999075f, -1.9998082f, 0.9998151f}, {0.9999129f, -1.9998189f, 0.9999129f, -1.9998189f, 0.9998257f}, {0.999918f, -1.9998291f, 0.999918f, -1.9998291f, 0.9998359f}, {0.9999228f, -1.9998388f, 0.9999228f, -1.9998388f, 0.9998456f}, {0.9999274f, -1.999848f, 0.9999274f, -1.999848f, 0.9998549f}, {0.9999318f, -1.9998568f, 0.9999318f, -1.9998568f, 0.9998636f}, {0.999936f, -1.9998651f, 0.999936f, -1.9998651f, 0.9998719f}, {0.9999399f, -1.9998729f, 0.9999399f, -1.9998729f, 0.9998798f}, {0.9999436f, -1.9998803f, 0.9999436f, -1.9998803f, 0.9998872f}}};
-
-}
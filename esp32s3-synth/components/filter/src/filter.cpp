@@ -1,10 +1,7 @@
 #include "filter.hpp"
 #include <cmath>
 #include <algorithm>
-#include "filter_table_lp12.hpp"
-#include "filter_table_hp12.hpp"
-#include "filter_table_bp12.hpp"
-#include "filter_table_notch.hpp"
+#include "fastmath.hpp"
 #include "esp_log.h"
 
 #define TAG "Filter"
@@ -13,77 +10,196 @@ using namespace protocol;
 
 using namespace sound_module;
 
+namespace
+{
+    constexpr float PI_F = 3.14159265358979f;
+
+    constexpr float CUTOFF_MIN_HZ = 20.0f;
+    constexpr float CUTOFF_MAX_RATIO = 0.45f; // of the sample rate
+    constexpr float Q_MIN = 0.1f;
+
+    /// Perceptual resonance curve: gentle at first, steeper above 70 %
+    inline float resonanceQ(float x)
+    {
+        float q = 1.0f + 31.0f * x * x;
+        if (x > 0.7f)
+            q *= 1.0f + 5.0f * (x - 0.7f) * (x - 0.7f);
+        return q * 0.5f;
+    }
+
+    /// The type's fixed mix of the SVF taps (see mixLow/mixBand/mixInput),
+    /// with the zero terms dropped and the rest in the same order
+    template <FilterType TYPE>
+    inline float tapMix(float input, float band, float low, float k)
+    {
+        if constexpr (TYPE == FilterType::LP12)
+            return low;
+        else if constexpr (TYPE == FilterType::HP12)
+            return -low - k * band + input;
+        else if constexpr (TYPE == FilterType::BP12)
+            return k * band;
+        else
+            return input - k * band;
+    }
+}
+
 Filter::Filter(uint32_t sampleRate, uint8_t init_bpm, uint8_t voiceIndex)
     : sample_rate(sampleRate),
       filterType(FilterType::LP12),
-      baseCutoff(MAX_CUTOFF_RAW / 2),       // midpoint default
-      baseResonance(MAX_RESONANCE_RAW / 2), // midpoint default
-      z1(0.0f),
-      z2(0.0f) // midpoint default
+      baseCutoff(MAX_CUTOFF_RAW / 2),      // midpoint default
+      baseResonance(MAX_RESONANCE_RAW / 2) // midpoint default
 {
     resetState();
+    updateTargets();
+    g = targetG;
+    k = targetK;
 }
 
 void Filter::resetState()
 {
-    z1 = 0.0f;
-    z2 = 0.0f;
+    ic1eq = 0.0f;
+    ic2eq = 0.0f;
+}
+
+bool Filter::updateTargets()
+{
+    if (!isActive())
+        return false;
+
+    if (!dirty)
+        return true;
+    dirty = false;
+
+    // Log-spaced cutoff between 20 Hz and 0.45 fs. Low-pass and notch run
+    // the scale downwards so raw 0 is always the "open" end of the knob.
+    const float fcMax = CUTOFF_MAX_RATIO * static_cast<float>(sample_rate);
+    const float t = static_cast<float>(baseCutoff) / MAX_CUTOFF_RAW;
+    const bool inverted = filterType == FilterType::LP12 || filterType == FilterType::Notch;
+    float fc = CUTOFF_MIN_HZ * fastmath::pow(fcMax / CUTOFF_MIN_HZ, inverted ? 1.0f - t : t);
+    fc = std::clamp(fc, CUTOFF_MIN_HZ, fcMax * 0.98f);
+
+    // Resonance is tamed towards the end of the range where each mode would
+    // otherwise ring hardest
+    const float fcNorm = fc / fcMax;
+    float q = resonanceQ(static_cast<float>(baseResonance) / MAX_RESONANCE_RAW);
+    switch (filterType)
+    {
+    case FilterType::LP12:
+        q *= 0.5f + 0.5f * fcNorm;
+        mixLow = 1.0f, mixBand = 0.0f, mixInput = 0.0f;
+        break;
+    case FilterType::HP12:
+        q *= 0.5f + 0.5f * (1.0f - fcNorm);
+        mixLow = -1.0f, mixBand = -1.0f, mixInput = 1.0f;
+        break;
+    case FilterType::BP12:
+        q *= 0.5f + 0.5f * (1.0f - std::fabs(0.5f - fcNorm) * 2.0f);
+        mixLow = 0.0f, mixBand = 1.0f, mixInput = 0.0f;
+        break;
+    case FilterType::Notch:
+        q *= 1.0f + 2.0f * fcNorm * fcNorm;
+        mixLow = 0.0f, mixBand = -1.0f, mixInput = 1.0f;
+        break;
+    default:
+        return false;
+    }
+
+    targetG = fastmath::tan(PI_F * fc / static_cast<float>(sample_rate));
+    targetK = 1.0f / std::max(q, Q_MIN);
+    return true;
 }
 
 float Filter::process(float input)
 {
-    if (baseCutoff == 0 && baseResonance)
+    if (!updateTargets())
         return input;
+    g = targetG;
+    k = targetK;
 
-    // Quantize and apply modulation (cutting down only)
-    // Convert to table indices
-    int cutoff_index = static_cast<int>((static_cast<float>(baseCutoff) / MAX_CUTOFF_RAW) * (CUTOFF_TABLE_SIZE - 1));
-    int resonance_index = static_cast<int>((static_cast<float>(baseResonance) / MAX_RESONANCE_RAW) * (RESONANCE_TABLE_SIZE - 1));
+    const float a1 = 1.0f / (1.0f + g * (g + k));
+    const float a2 = g * a1;
+    const float a3 = g * a2;
 
-    cutoff_index = std::clamp(cutoff_index, 0, CUTOFF_TABLE_SIZE - 1);
-    resonance_index = std::clamp(resonance_index, 0, RESONANCE_TABLE_SIZE - 1);
+    const float v3 = input - ic2eq;
+    const float v1 = a1 * ic1eq + a2 * v3;
+    const float v2 = ic2eq + a2 * ic1eq + a3 * v3;
+    ic1eq = 2.0f * v1 - ic1eq;
+    ic2eq = 2.0f * v2 - ic2eq;
 
-    // Update coefficients if filter state changed
-    if (cutoff_index != lastCutoffIndex ||
-        resonance_index != lastResonanceIndex ||
-        filterType != lastFilterType)
+    return mixLow * v2 + mixBand * k * v1 + mixInput * input;
+}
+
+IRAM_ATTR void Filter::processBlock(float *buffer, size_t n)
+{
+    if (!updateTargets() || n == 0)
+        return;
+    (this->*blockKernel)(buffer, n);
+}
+
+Filter::BlockKernel Filter::blockKernelFor(FilterType type)
+{
+    switch (type)
     {
-        const float (*table)[RESONANCE_TABLE_SIZE][5] = nullptr;
+    case FilterType::HP12:
+        return &Filter::processBlockAs<FilterType::HP12>;
+    case FilterType::BP12:
+        return &Filter::processBlockAs<FilterType::BP12>;
+    case FilterType::Notch:
+        return &Filter::processBlockAs<FilterType::Notch>;
+    default:
+        return &Filter::processBlockAs<FilterType::LP12>;
+    }
+}
+
+template <FilterType TYPE>
+IRAM_ATTR void Filter::processBlockAs(float *buffer, size_t n)
+{
+    // Keep state in registers for the whole block
+    float s1 = ic1eq, s2 = ic2eq;
 
-        switch (filterType)
+    if (g == targetG && k == targetK)
+    {
+        const float a1 = 1.0f / (1.0f + g * (g + k));
+        const float a2 = g * a1;
+        const float a3 = g * a2;
+        for (size_t i = 0; i < n; ++i)
         {
-        case FilterType::LP12:
-            table = filterTableLP12;
-            break;
-        case FilterType::HP12:
-            table = filterTableHP12;
-            break;
-        case FilterType::BP12:
-            table = filterTableBP12;
-            break;
-        case FilterType::Notch:
-            table = filterTableNotch;
-            break;
-        default:
-            return input;
+            const float x = buffer[i];
+            const float v3 = x - s2;
+            const float v1 = a1 * s1 + a2 * v3;
+            const float v2 = s2 + a2 * s1 + a3 * v3;
+            s1 = 2.0f * v1 - s1;
+            s2 = 2.0f * v2 - s2;
+            buffer[i] = tapMix<TYPE>(x, v1, v2, k);
         }
-
-        const float *coeffs = table[cutoff_index][resonance_index];
-        lastB0 = coeffs[0];
-        lastB1 = coeffs[1];
-        lastB2 = coeffs[2];
-        lastA1 = coeffs[3];
-        lastA2 = coeffs[4];
-
-        lastCutoffIndex = cutoff_index;
-        lastResonanceIndex = resonance_index;
-        lastFilterType = filterType;
     }
+    else
+    {
+        // Glide g and k to their targets across the block; the TPT structure
+        // stays stable under per-sample coefficient changes
+        const float inv = 1.0f / static_cast<float>(n);
+        const float dg = (targetG - g) * inv;
+        const float dk = (targetK - k) * inv;
+        float gi = g, ki = k;
+        for (size_t i = 0; i < n; ++i)
+        {
+            gi += dg;
+            ki += dk;
+            const float a1 = 1.0f / (1.0f + gi * (gi + ki));
+            const float a2 = gi * a1;
+            const float a3 = gi * a2;
 
-    // Transposed Direct Form II filter
-    float y = lastB0 * input + z1;
-    z1 = lastB1 * input + z2 - lastA1 * y;
-    z2 = lastB2 * input - lastA2 * y;
-
-    return y;
+            const float x = buffer[i];
+            const float v3 = x - s2;
+            const float v1 = a1 * s1 + a2 * v3;
+            const float v2 = s2 + a2 * s1 + a3 * v3;
+            s1 = 2.0f * v1 - s1;
+            s2 = 2.0f * v2 - s2;
+            buffer[i] = tapMix<TYPE>(x, v1, v2, ki);
+        }
+        g = targetG;
+        k = targetK;
+    }
+    ic1eq = s1;
+    ic2eq = s2;
 }
@@ -25,22 +25,27 @@ public:
 
     void setWaveform(LfoWaveform wf);
 
-    // Reset phase to start of cycle
+    // Reset phase to start of cycle at the next clock update
     void resetPhase();
 
+    // Move the phase to the given engine frame. The LFO only ever advances
+    // by whole samples, so the same event stream always yields the same
+    // modulation regardless of task scheduling.
+    void advanceTo(uint64_t frame);
+
     // Get the current LFO output, bipolar range: –depth … +depth
     float getValue();
 
-    void advancePhaseMicroseconds(uint32_t elapsed_us);
-
-    uint8_t getDepth();
+    uint8_t getDepth() const;
 
 private:
     const uint32_t sample_rate;                   // samples per second
     uint8_t depth = 0;                            // peak deviation, 0–127
     LfoSubdivision sub = LfoSubdivision::Quarter; // sync subdivision
     uint8_t bpm = 120;                            // beats per minute
-    float phase = 0.0f;                           // [0.0, 1.0) cycle phase
+    uint64_t phase = 0;                           // cycle phase, 2^64 per cycle
+    uint64_t phaseIncrement = 0;                  // phase advance per sample
+    uint64_t lastFrame = 0;                       // frame the phase belongs to
+    bool resetPending = true;                     // restart the cycle at the next advanceTo()
     LfoWaveform waveform;
-    float cyclesPerSecond = 0.0f;
 };
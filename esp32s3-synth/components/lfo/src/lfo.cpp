@@ -4,22 +4,20 @@
 #include "sine_table.hpp"
 #include "saw_tooth_table.hpp"
 #include "triangle_table.hpp"
-#include "square_table.hpp"
 #include "lookup.hpp"
 #include "esp_log.h"
-#include "esp_timer.h"
 #include "esp_attr.h"
 #define TAG "Lfo"
-static constexpr float MICROSECONDS_TO_SECONDS = 1.0f / 1'000'000.0f;
 
 using namespace sound_module;
 // Constructor: initialize sample rate, BPM, subdivision, depth defaults
 LFO::LFO(uint32_t sampleRate, uint8_t initialBpm, LfoSubdivision initialSub)
     : sample_rate(sampleRate),
       depth(0), sub(initialSub),
-      bpm(initialBpm), phase(0.0f),
+      bpm(initialBpm), phase(0),
       waveform(LfoWaveform::Sine)
 {
+    resetPhase();
 }
 
 // Set the tempo for sync (beats per minute)
@@ -53,8 +51,10 @@ void LFO::setDepth(uint8_t newDepth)
 // Reset phase to start of cycle
 void LFO::resetPhase()
 {
-    phase = 0.0f;
-    cyclesPerSecond = (static_cast<float>(bpm) / 60.0f) / beatsPerCycleMap[static_cast<int>(sub)];
+    resetPending = true;
+    double cyclesPerSecond = (static_cast<double>(bpm) / 60.0) / beatsPerCycleMap[static_cast<int>(sub)];
+    // 2^64 per cycle; unsigned wrap-around drops whole cycles exactly
+    phaseIncrement = static_cast<uint64_t>(cyclesPerSecond / sample_rate * 18446744073709551616.0);
 }
 
 // Get the current LFO output, bipolar range: –depth … +depth
@@ -63,20 +63,21 @@ IRAM_ATTR float LFO::getValue()
     if (depth == 0)
         return 0.0f;
 
+    const uint32_t cyclePhase = static_cast<uint32_t>(phase >> 32);
     float raw = 0.f;
     switch (waveform)
     {
     case LfoWaveform::Sine:
-        raw = interpolateLookup(phase, sineTable);
+        raw = interpolatePhase(cyclePhase, sineTable);
         break;
     case LfoWaveform::Triangle:
-        raw = interpolateLookup(phase, triangleTable);
+        raw = interpolatePhase(cyclePhase, triangleTable);
         break;
     case LfoWaveform::Sawtooth:
-        raw = interpolateLookup(phase, sawTable);
+        raw = interpolatePhase(cyclePhase, sawTable);
         break;
     case LfoWaveform::Pulse:
-        raw = (phase < 0.5f) ? 1.0f : -1.0f;
+        raw = (cyclePhase < 0x80000000u) ? 1.0f : -1.0f;
         break;
     default:
         raw = 0.0f;
@@ -85,16 +86,19 @@ IRAM_ATTR float LFO::getValue()
     return raw * float(depth);
 }
 
-uint8_t LFO::getDepth() { return depth; }
+uint8_t LFO::getDepth() const { return depth; }
 
-void LFO::advancePhaseMicroseconds(uint32_t elapsed_us)
+IRAM_ATTR void LFO::advanceTo(uint64_t frame)
 {
-    if (depth == 0)
-        return;
-    // Avoid recalculating BPM and beatsPerCycle each time
-    phase += cyclesPerSecond * elapsed_us * MICROSECONDS_TO_SECONDS;
-
-    // Faster wraparound using subtraction instead of floorf
-    if (phase >= 1.0f)
-        phase -= static_cast<int>(phase); // remove integer part
+    if (resetPending)
+    {
+        // Tempo-synced cycles start on the engine frame the change landed on
+        phase = 0;
+        resetPending = false;
+    }
+    else
+    {
+        phase += phaseIncrement * (frame - lastFrame);
+    }
+    lastFrame = frame;
 }
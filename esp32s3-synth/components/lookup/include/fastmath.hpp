@@ -0,0 +1,168 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+
+namespace sound_module::fastmath
+{
+    /**
+     * Float approximations of the libm functions the engine calls at
+     * control rate (pitch, gain, envelope times, filter coefficients).
+     *
+     * Each function documents its domain and its worst error against the
+     * exact result; the *_MAX_* constants are those bounds, and the host
+     * tool fastmath_check sweeps every domain and fails if one is exceeded.
+     * Nothing here touches errno or the rounding mode, and none of it calls
+     * into libm: a handful of multiply-adds on the ESP32-S3's single
+     * precision FPU instead of a general-purpose pow/exp routine.
+     */
+
+    namespace detail
+    {
+        inline float fromBits(uint32_t bits)
+        {
+            float f;
+            std::memcpy(&f, &bits, sizeof f);
+            return f;
+        }
+
+        inline uint32_t toBits(float f)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &f, sizeof bits);
+            return bits;
+        }
+
+        constexpr float LOG2_E = 1.44269504088896f;
+        constexpr float LOG2_10_OVER_20 = 0.166096404744368f; // dB -> log2 of gain
+        constexpr float QUARTER_PI = 0.78539816339745f;
+        constexpr float HALF_PI = 1.57079632679490f;
+    }
+
+    /// Largest relative error of exp2() (about 0.8 ulp)
+    constexpr float EXP2_MAX_REL_ERROR = 1.5e-7f;
+
+    /**
+     * 2^x. Inputs are clamped to [-126, 127], so the result is always a
+     * normal float; NaN reads as -126. Exact at integers. x is split into
+     * the nearest integer i and f in [-0.5, 0.5]; 2^f is a degree-6
+     * polynomial with its constant term pinned to 1 and 2^i goes straight
+     * into the exponent bits.
+     */
+    inline float exp2(float x)
+    {
+        x = x > -126.0f ? x : -126.0f;
+        x = x < 127.0f ? x : 127.0f;
+        const int i = static_cast<int>(x < 0.0f ? x - 0.5f : x + 0.5f);
+        const float f = x - static_cast<float>(i);
+
+        float p = 1.54531634e-4f;
+        p = p * f + 1.33908633e-3f;
+        p = p * f + 9.61808301e-3f;
+        p = p * f + 5.55035695e-2f;
+        p = p * f + 2.40226507e-1f;
+        p = p * f + 6.93147182e-1f;
+        p = p * f + 1.0f;
+        return p * detail::fromBits(static_cast<uint32_t>(i + 127) << 23);
+    }
+
+    /// Largest absolute error of log2(), on top of rounding the result
+    constexpr float LOG2_MAX_ABS_ERROR = 1.5e-7f;
+
+    /**
+     * log2(x) for positive normal x. The exponent is taken from the bits;
+     * the mantissa is moved into [sqrt(1/2), sqrt(2)] and its logarithm is
+     * the atanh series in s = (m - 1) / (m + 1) up to s^7. One division.
+     */
+    inline float log2(float x)
+    {
+        uint32_t bits = detail::toBits(x);
+        int e = static_cast<int>(bits >> 23) - 127;
+        bits = (bits & 0x007FFFFFu) | 0x3F800000u; // mantissa in [1, 2)
+        if (bits > 0x3FB504F3u)                    // above sqrt(2): halve it
+        {
+            bits -= 0x00800000u;
+            ++e;
+        }
+        const float m = detail::fromBits(bits);
+        const float s = (m - 1.0f) / (m + 1.0f);
+        const float s2 = s * s;
+
+        float p = 0.412198581f; // 2 / (7 ln 2)
+        p = p * s2 + 0.577078016f; // 2 / (5 ln 2)
+        p = p * s2 + 0.961796694f; // 2 / (3 ln 2)
+        p = p * s2 + 2.885390082f; // 2 / ln 2
+        return static_cast<float>(e) + s * p;
+    }
+
+    /// Largest relative error of dbToGain() over [-120, 24] dB, mostly from
+    /// rounding dB * log2(10) / 20 before the exp2()
+    constexpr float DB_TO_GAIN_MAX_REL_ERROR = 1e-6f;
+
+    /// 10^(dB / 20), the linear gain of a level in decibels
+    inline float dbToGain(float dB)
+    {
+        return exp2(dB * detail::LOG2_10_OVER_20);
+    }
+
+    /// Largest relative error of pow() while |x * log2(base)| <= 16
+    constexpr float POW_MAX_REL_ERROR = 4e-6f;
+
+    /**
+     * base^x for base > 0, as exp2(x * log2(base)). The error grows with
+     * the size of the exponent, since log2()'s absolute error is scaled by
+     * x; the bound holds while the result stays within 2^±16.
+     */
+    inline float pow(float base, float x)
+    {
+        return exp2(x * log2(base));
+    }
+
+    /// Largest absolute error of tanh()
+    constexpr float TANH_MAX_ABS_ERROR = 2e-7f;
+
+    /**
+     * tanh(x) for any finite x. Below |x| = 0.5 a [7/6] Padé approximant
+     * (exact to float precision there, and odd, so tiny inputs pass through
+     * unchanged); above it 1 - 2 / (e^2|x| + 1) with exp2(), which saturates
+     * to exactly ±1 for large |x|.
+     */
+    inline float tanh(float x)
+    {
+        const float a = x < 0.0f ? -x : x;
+        float t;
+        if (a < 0.5f)
+        {
+            const float a2 = a * a;
+            t = a * (135135.0f + a2 * (17325.0f + a2 * (378.0f + a2))) /
+                (135135.0f + a2 * (62370.0f + a2 * (3150.0f + 28.0f * a2)));
+        }
+        else
+        {
+            t = 1.0f - 2.0f / (exp2(2.0f * detail::LOG2_E * a) + 1.0f);
+        }
+        return x < 0.0f ? -t : t;
+    }
+
+    /// Largest relative error of tan() on [0, TAN_MAX_ARGUMENT]
+    constexpr float TAN_MAX_REL_ERROR = 1e-6f;
+    /// pi times 0.445: the prewarp of cutoffs up to 0.445 of the sample rate
+    constexpr float TAN_MAX_ARGUMENT = 1.398f;
+
+    /**
+     * tan(x) for x in [0, pi/2), e.g. the bilinear prewarp of a cutoff.
+     * A [5/4] Padé approximant is evaluated on [0, pi/4]; above that
+     * tan(x) = 1 / tan(pi/2 - x), which only swaps numerator and
+     * denominator, so the cost is one division either way. Close to pi/2
+     * the float pi/2 itself limits the relative error, hence the bound's
+     * narrower range.
+     */
+    inline float tan(float x)
+    {
+        const bool upper = x > detail::QUARTER_PI;
+        const float y = upper ? detail::HALF_PI - x : x;
+        const float y2 = y * y;
+        const float num = y * (945.0f - y2 * (105.0f - y2));
+        const float den = 945.0f - y2 * (420.0f - 15.0f * y2);
+        return upper ? den / num : num / den;
+    }
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include <array>
 #include <cstddef>
+#include <cstdint>
 
 namespace sound_module
 {
@@ -18,6 +19,33 @@ namespace sound_module
         return a + frac * (b - a); // linear interpolation
     }
 
+    /// One full cycle of a 32-bit phase accumulator
+    constexpr float PHASE_CYCLE = 4294967296.0f;
+
+    constexpr unsigned log2Size(size_t n)
+    {
+        return n <= 1 ? 0 : 1 + log2Size(n >> 1);
+    }
+
+    /// Linear interpolation driven by a 32-bit phase accumulator.
+    /// The top log2(N) bits are the table index, the rest the fraction,
+    /// so wrap-around is free and indexing is a shift.
+    template <size_t N>
+    inline float interpolatePhase(uint32_t phase, const std::array<float, N> &table)
+    {
+        static_assert((N & (N - 1)) == 0, "table size must be a power of two");
+        constexpr unsigned FRAC_BITS = 32 - log2Size(N);
+        constexpr float FRAC_SCALE = 1.0f / static_cast<float>(1u << FRAC_BITS);
+
+        uint32_t idx = phase >> FRAC_BITS;
+        float frac = static_cast<float>(phase & ((1u << FRAC_BITS) - 1)) * FRAC_SCALE;
+
+        float a = table[idx];
+        float b = table[(idx + 1) & (N - 1)];
+
+        return a + frac * (b - a);
+    }
+
     inline float poly_blep(float t, float dt)
     {
         if (t < dt)
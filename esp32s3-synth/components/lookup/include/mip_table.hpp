@@ -0,0 +1,88 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace sound_module
+{
+    // Per-octave band-limited wavetables.
+    // Level k holds MIP_BASE_HARMONICS >> k harmonics, so it stays alias-free
+    // up to a phase increment of 2^(31 - log2(harmonics)). Table sizes halve
+    // with the harmonic count down to MIP_MIN_SIZE.
+    constexpr size_t MIP_LEVELS = 9;
+    constexpr unsigned MIP_BASE_HARMONICS_BITS = 8; // 256 harmonics at level 0
+    constexpr size_t MIP_BASE_SIZE = 1024;
+    constexpr size_t MIP_MIN_SIZE = 128;
+
+    constexpr size_t mipLevelSize(size_t level)
+    {
+        return (MIP_BASE_SIZE >> level) > MIP_MIN_SIZE ? (MIP_BASE_SIZE >> level) : MIP_MIN_SIZE;
+    }
+
+    constexpr size_t mipStorageSize(size_t levels = MIP_LEVELS)
+    {
+        return levels == 0 ? 0 : mipLevelSize(levels - 1) + mipStorageSize(levels - 1);
+    }
+
+    /// One band-limited level, read with a 32-bit phase accumulator
+    struct MipLevel
+    {
+        const float *table;
+        uint32_t mask;   ///< size - 1
+        uint8_t shift;     ///< phase >> shift is the table index
+        uint32_t fracMask; ///< low bits of the phase below the index
+        float fracScale;   ///< 1 / 2^shift
+    };
+
+    /// Linear interpolation into one level; same cost as interpolatePhase()
+    inline float interpolateMip(const MipLevel &level, uint32_t phase)
+    {
+        uint32_t idx = phase >> level.shift;
+        float frac = static_cast<float>(phase & level.fracMask) * level.fracScale;
+
+        float a = level.table[idx];
+        float b = level.table[(idx + 1) & level.mask];
+
+        return a + frac * (b - a);
+    }
+
+    /// Band-limited pulse from two band-limited saws offset by the pulse
+    /// width: +1 while phase < width, -1 after, with the DC term `dc` put back
+    inline float interpolatePulse(const MipLevel &level, uint32_t phase, uint32_t width, float dc)
+    {
+        constexpr uint32_t HALF_CYCLE = 0x80000000u;
+        return dc + interpolateMip(level, phase - HALF_CYCLE - width) - interpolateMip(level, phase - HALF_CYCLE);
+    }
+
+    class MipTable
+    {
+    public:
+        /// Fourier series of one cycle: amplitudes of sin(2πkx) and cos(2πkx)
+        using Partial = void (*)(int k, float &sinAmp, float &cosAmp);
+
+        explicit MipTable(Partial partial);
+        MipTable(const MipTable &) = delete;
+        MipTable &operator=(const MipTable &) = delete;
+
+        /// Highest-harmonic level that does not alias at this phase increment
+        const MipLevel &forIncrement(uint32_t phaseIncrement) const
+        {
+            // Level k is valid while increment <= 2^(31 - BASE_BITS + k)
+            uint32_t bits = 32 - __builtin_clz((phaseIncrement - 1) | 1);
+            int level = static_cast<int>(bits) - (31 - static_cast<int>(MIP_BASE_HARMONICS_BITS));
+            level = level < 0 ? 0 : level;
+            level = level >= static_cast<int>(MIP_LEVELS) ? static_cast<int>(MIP_LEVELS) - 1 : level;
+            return levels[level];
+        }
+
+        const MipLevel &level(size_t index) const { return levels[index]; }
+
+    private:
+        std::array<float, mipStorageSize()> storage;
+        std::array<MipLevel, MIP_LEVELS> levels;
+    };
+
+    /// Band-limited versions of sawTable and triangleTable (same phase alignment)
+    extern const MipTable sawMipTable;
+    extern const MipTable triangleMipTable;
+}
@@ -17,7 +17,7 @@ namespace sound_module
         {
             float pan = (static_cast<float>(i) / (PAN_TABLE_SIZE - 1)) * 2.0f - 1.0f;
             float angle = (pan + 1.0f) * (static_cast<float>(M_PI) / 4.0f); // 0 to π/2
-            table[i] = Stereo{std::cosf(angle), std::sinf(angle)};
+            table[i] = Stereo{std::cos(angle), std::sin(angle)};
         }
         return table;
     }();
@@ -0,0 +1,22 @@
+#pragma once
+#include "fastmath.hpp"
+
+namespace sound_module
+{
+    /// Range of a pitch offset: ±8 octaves, well beyond transpose, fine
+    /// tune and pitch LFO together, with room left for a pitch bend
+    constexpr float PITCH_CENTS_MIN = -9600.0f;
+    constexpr float PITCH_CENTS_MAX = 9600.0f;
+
+    /// Frequency ratio of a pitch offset, 2^(cents / 1200), clamped to
+    /// [PITCH_CENTS_MIN, PITCH_CENTS_MAX]. Fractional cents are kept, so a
+    /// slow vibrato glides instead of stepping a cent at a time; whole
+    /// octaves are exact. A few multiply-adds and one division, so it is
+    /// evaluated per control block rather than read from a table.
+    inline float centsToPitchRatio(float cents)
+    {
+        cents = cents > PITCH_CENTS_MIN ? cents : PITCH_CENTS_MIN;
+        cents = cents < PITCH_CENTS_MAX ? cents : PITCH_CENTS_MAX;
+        return fastmath::exp2(cents / 1200.0f);
+    }
+}
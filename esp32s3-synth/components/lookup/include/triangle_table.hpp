@@ -14,7 +14,7 @@ namespace sound_module
         for (size_t i = 0; i < LOOKUP_TABLE_SIZE; ++i)
         {
             float phase = static_cast<float>(i) / static_cast<float>(LOOKUP_TABLE_SIZE);
-            table[i] = 2.0f * std::fabsf(2.0f * (phase - std::floor(phase + 0.5f))) - 1.0f;
+            table[i] = 2.0f * std::fabs(2.0f * (phase - std::floor(phase + 0.5f))) - 1.0f;
         }
         return table;
     }();
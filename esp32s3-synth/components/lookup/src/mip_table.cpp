@@ -0,0 +1,86 @@
+#include "mip_table.hpp"
+#include <cmath>
+
+using namespace sound_module;
+
+namespace
+{
+    constexpr int MAX_HARMONICS = 1 << MIP_BASE_HARMONICS_BITS;
+
+    /// Working space for building the tables (about 6 KB). The tables are
+    /// built during static init on the startup stack, so this is kept in
+    /// .bss rather than as locals; both tables share it, one after the other.
+    struct BuildScratch
+    {
+        std::array<float, MIP_BASE_SIZE> sine; ///< one exact cycle, built once
+        bool sineReady;
+        std::array<float, MAX_HARMONICS + 1> sinAmps;
+        std::array<float, MAX_HARMONICS + 1> cosAmps;
+    };
+
+    // Constant-initialised, so it is ready before any table's constructor runs
+    BuildScratch scratch;
+}
+
+MipTable::MipTable(Partial partial)
+{
+    // One exact sine cycle at the largest size; every level indexes into it
+    const auto &sine = scratch.sine;
+    if (!scratch.sineReady)
+    {
+        for (size_t i = 0; i < MIP_BASE_SIZE; ++i)
+            scratch.sine[i] = std::sin(2.0 * M_PI * static_cast<double>(i) / MIP_BASE_SIZE);
+        scratch.sineReady = true;
+    }
+
+    auto &sinAmps = scratch.sinAmps;
+    auto &cosAmps = scratch.cosAmps;
+    sinAmps[0] = cosAmps[0] = 0.0f;
+    for (int k = 1; k <= MAX_HARMONICS; ++k)
+        partial(k, sinAmps[k], cosAmps[k]);
+
+    size_t offset = 0;
+    for (size_t l = 0; l < MIP_LEVELS; ++l)
+    {
+        const size_t size = mipLevelSize(l);
+        const size_t stride = MIP_BASE_SIZE / size;
+        const int harmonics = static_cast<int>((1u << MIP_BASE_HARMONICS_BITS) >> l);
+        float *table = storage.data() + offset;
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            float value = 0.0f;
+            for (int k = 1; k <= harmonics; ++k)
+            {
+                size_t idx = (static_cast<size_t>(k) * i) & (size - 1);
+                size_t cosIdx = (idx + size / 4) & (size - 1);
+                value += sinAmps[k] * sine[idx * stride] + cosAmps[k] * sine[cosIdx * stride];
+            }
+            table[i] = value;
+        }
+
+        unsigned bits = 0;
+        while ((size_t(1) << bits) < size)
+            ++bits;
+        levels[l] = MipLevel{
+            table,
+            static_cast<uint32_t>(size - 1),
+            static_cast<uint8_t>(32 - bits),
+            (1u << (32 - bits)) - 1,
+            1.0f / static_cast<float>(1u << (32 - bits)),
+        };
+        offset += size;
+    }
+}
+
+// 2 * (phase - floor(phase + 0.5)): rises from 0, wraps at half cycle
+const MipTable sound_module::sawMipTable([](int k, float &sinAmp, float &cosAmp)
+                                         {
+    sinAmp = static_cast<float>((k % 2 ? 2.0 : -2.0) / (M_PI * k));
+    cosAmp = 0.0f; });
+
+// -1 at phase 0, +1 at half cycle: odd cosine harmonics falling with 1/k²
+const MipTable sound_module::triangleMipTable([](int k, float &sinAmp, float &cosAmp)
+                                              {
+    sinAmp = 0.0f;
+    cosAmp = (k % 2) ? static_cast<float>(-8.0 / (M_PI * M_PI * k * k)) : 0.0f; });
@@ -0,0 +1,33 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+namespace platform
+{
+    /// Sink for interleaved stereo int16 frames (I2S on target, WAV file on host)
+    class AudioOutput
+    {
+    public:
+        virtual ~AudioOutput() = default;
+
+        /// Prepare the sink for the given sample rate
+        virtual void init(uint32_t sampleRate) = 0;
+
+        /// Write `frames` interleaved L/R frames, blocking until accepted
+        virtual void write(const int16_t *interleaved, size_t frames) = 0;
+
+        /// Times the sink ran dry and played stale or silent data; safe from any task
+        virtual uint32_t underrunCount() const { return 0; }
+
+        /// DMA buffers handed to the hardware so far (0 if the sink has none)
+        virtual uint32_t sentBufferCount() const { return 0; }
+    };
+
+    /// Sink that discards everything, for callers that drive render() directly
+    class NullOutput : public AudioOutput
+    {
+    public:
+        void init(uint32_t) override {}
+        void write(const int16_t *, size_t) override {}
+    };
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <atomic>
+#include <driver/gpio.h>
+#include <driver/i2s_std.h>
+#include "audio_output.hpp"
+
+namespace platform
+{
+    // Configuration for I2S pins
+    struct I2SParams
+    {
+        gpio_num_t bclk_io;  // Bit clock
+        gpio_num_t lrclk_io; // Word select (left/right clock)
+        gpio_num_t data_io;  // Serial data out
+    };
+
+    /// 16-bit stereo Philips I2S master output
+    class I2SOutput : public AudioOutput
+    {
+    public:
+        explicit I2SOutput(const I2SParams &params) : params(params) {}
+
+        void init(uint32_t sampleRate) override;
+        void write(const int16_t *interleaved, size_t frames) override;
+
+        uint32_t underrunCount() const override { return underruns.load(std::memory_order_relaxed); }
+        uint32_t sentBufferCount() const override { return sentBuffers.load(std::memory_order_relaxed); }
+
+    private:
+        I2SParams params;
+        i2s_chan_handle_t txChan = nullptr;
+
+        // Written from the I2S ISR
+        std::atomic<uint32_t> underruns{0};
+        std::atomic<uint32_t> sentBuffers{0};
+
+        static bool onSent(i2s_chan_handle_t handle, i2s_event_data_t *event, void *ctx);
+        static bool onSendQueueOverflow(i2s_chan_handle_t handle, i2s_event_data_t *event, void *ctx);
+    };
+}
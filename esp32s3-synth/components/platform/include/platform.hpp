@@ -0,0 +1,31 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/// Thin platform layer for the DSP components.
+/// The ESP-IDF backend lives in src/esp, the Linux backend in src/host.
+namespace platform
+{
+    using TaskEntry = void (*)(void *arg);
+
+    /// Monotonic time in microseconds (esp_timer on target, steady_clock on host)
+    int64_t timeUs();
+
+    /// Free-running counter for profiling: CPU cycles on target, nanoseconds
+    /// on host. Wraps at 2^32; the difference of two reads stays valid.
+    uint32_t cycleCount();
+
+    /// Ticks per second of cycleCount()
+    uint32_t cycleFrequencyHz();
+
+    /// Start a long-running task. Core pinning and priority are ignored on host.
+    bool startTask(TaskEntry entry, const char *name, uint32_t stackSize, void *arg, uint8_t priority, int core);
+
+    /// Highest priority available to application tasks
+    uint8_t maxTaskPriority();
+
+    /// Memory for audio-rate state, 16-byte aligned: internal RAM on target
+    /// (PSRAM is too slow for the render loop). nullptr if it does not fit.
+    void *allocateAudioMemory(size_t bytes);
+    void freeAudioMemory(void *memory);
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include <cstdio>
+#include <string>
+#include "audio_output.hpp"
+
+namespace platform
+{
+    /// Host-only sink that writes 16-bit stereo PCM to a WAV file
+    class WavOutput : public AudioOutput
+    {
+    public:
+        explicit WavOutput(std::string path) : path(std::move(path)) {}
+        ~WavOutput() override;
+
+        void init(uint32_t sampleRate) override;
+        void write(const int16_t *interleaved, size_t frames) override;
+
+        /// Patch the RIFF sizes and close the file; called by the destructor
+        void close();
+        bool isOpen() const { return file != nullptr; }
+
+    private:
+        std::string path;
+        FILE *file = nullptr;
+        uint32_t dataBytes = 0;
+    };
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+
+namespace platform
+{
+    /**
+     * A helper task on another core that runs one job per run() call.
+     *
+     * run() and wait() form a two-party barrier around the job: the owner
+     * hands work over with run(), does its own share, then wait() blocks
+     * until the helper is done. Writes made before run() are visible to the
+     * job, and the job's writes are visible after wait(). One owner task
+     * only; run() must not be called again before wait() returns.
+     * FreeRTOS task notifications on target, a std::thread on host.
+     */
+    class Worker
+    {
+    public:
+        using Job = void (*)(void *arg);
+
+        Worker();
+        ~Worker();
+
+        Worker(const Worker &) = delete;
+        Worker &operator=(const Worker &) = delete;
+
+        /// Create the helper task; `core` and `priority` are ignored on host
+        bool start(const char *name, Job job, void *arg, uint32_t stackSize, uint8_t priority, int core);
+        bool isStarted() const;
+
+        /// Let the helper run the job once
+        void run();
+
+        /// Block until the job handed over by run() has returned
+        void wait();
+
+        /// Backend-specific (src/esp, src/host)
+        struct State;
+
+    private:
+        std::unique_ptr<State> state;
+    };
+}
@@ -0,0 +1,69 @@
+#include "i2s_output.hpp"
+#include <esp_log.h>
+#include <freertos/FreeRTOS.h>
+#include <esp_attr.h>
+
+#define TAG "I2SOutput"
+
+using namespace platform;
+
+void I2SOutput::init(uint32_t sampleRate)
+{
+    // Step 1: Create I2S TX channel
+    i2s_chan_config_t tx_chan_cfg = I2S_CHANNEL_DEFAULT_CONFIG(I2S_NUM_AUTO, I2S_ROLE_MASTER);
+    tx_chan_cfg.auto_clear = true; // an underrun plays silence instead of replaying the last buffer
+    ESP_ERROR_CHECK(i2s_new_channel(&tx_chan_cfg, &txChan, nullptr));
+
+    // Step 2: Configure TX for standard I2S mode
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+    i2s_std_config_t tx_std_cfg = {
+        .clk_cfg = I2S_STD_CLK_DEFAULT_CONFIG(sampleRate),
+        .slot_cfg = I2S_STD_PHILIPS_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_STEREO),
+        .gpio_cfg = {
+            .mclk = I2S_GPIO_UNUSED,
+            .bclk = params.bclk_io,
+            .ws = params.lrclk_io,
+            .dout = params.data_io,
+            .din = I2S_GPIO_UNUSED,
+            .invert_flags = {false, false, false},
+        },
+    };
+#pragma GCC diagnostic pop
+
+    ESP_ERROR_CHECK(i2s_channel_init_std_mode(txChan, &tx_std_cfg));
+
+    // Step 3: Count DMA buffers and underruns (callbacks must be set before enabling)
+    i2s_event_callbacks_t callbacks = {
+        .on_recv = nullptr,
+        .on_recv_q_ovf = nullptr,
+        .on_sent = onSent,
+        .on_send_q_ovf = onSendQueueOverflow,
+    };
+    ESP_ERROR_CHECK(i2s_channel_register_event_callback(txChan, &callbacks, this));
+
+    ESP_ERROR_CHECK(i2s_channel_enable(txChan));
+}
+
+IRAM_ATTR bool I2SOutput::onSent(i2s_chan_handle_t, i2s_event_data_t *, void *ctx)
+{
+    auto *self = static_cast<I2SOutput *>(ctx);
+    self->sentBuffers.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+/// The driver queues every finished DMA buffer for write() to refill. The
+/// queue overflowing means the DMA wrapped onto a buffer the audio task
+/// never refilled: the render fell behind and the listener heard a gap.
+IRAM_ATTR bool I2SOutput::onSendQueueOverflow(i2s_chan_handle_t, i2s_event_data_t *, void *ctx)
+{
+    auto *self = static_cast<I2SOutput *>(ctx);
+    self->underruns.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+void I2SOutput::write(const int16_t *interleaved, size_t frames)
+{
+    size_t bytes_written;
+    i2s_channel_write(txChan, interleaved, frames * 2 * sizeof(int16_t), &bytes_written, portMAX_DELAY);
+}
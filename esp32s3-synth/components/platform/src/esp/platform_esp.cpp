@@ -0,0 +1,42 @@
+#include "platform.hpp"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <esp_timer.h>
+#include <esp_cpu.h>
+#include <esp_heap_caps.h>
+#include "sdkconfig.h"
+
+int64_t platform::timeUs()
+{
+    return esp_timer_get_time();
+}
+
+uint32_t platform::cycleCount()
+{
+    return esp_cpu_get_cycle_count();
+}
+
+uint32_t platform::cycleFrequencyHz()
+{
+    return CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ * 1'000'000u;
+}
+
+bool platform::startTask(TaskEntry entry, const char *name, uint32_t stackSize, void *arg, uint8_t priority, int core)
+{
+    return xTaskCreatePinnedToCore(entry, name, stackSize, arg, priority, nullptr, core) == pdPASS;
+}
+
+uint8_t platform::maxTaskPriority()
+{
+    return configMAX_PRIORITIES - 1;
+}
+
+void *platform::allocateAudioMemory(size_t bytes)
+{
+    return heap_caps_aligned_alloc(16, bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+}
+
+void platform::freeAudioMemory(void *memory)
+{
+    heap_caps_free(memory);
+}
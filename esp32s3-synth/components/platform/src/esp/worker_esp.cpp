@@ -0,0 +1,58 @@
+#include "worker.hpp"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <esp_attr.h>
+
+using namespace platform;
+
+struct Worker::State
+{
+    Job job = nullptr;
+    void *arg = nullptr;
+    TaskHandle_t task = nullptr;
+    TaskHandle_t owner = nullptr; ///< task to notify when the job is done
+};
+
+static void workerEntry(void *param)
+{
+    auto *state = static_cast<Worker::State *>(param);
+    while (true)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        state->job(state->arg);
+        xTaskNotifyGive(state->owner);
+    }
+}
+
+Worker::Worker() : state(std::make_unique<State>()) {}
+
+Worker::~Worker()
+{
+    if (state->task)
+        vTaskDelete(state->task);
+}
+
+bool Worker::start(const char *name, Job job, void *arg, uint32_t stackSize, uint8_t priority, int core)
+{
+    if (state->task)
+        return true;
+    state->job = job;
+    state->arg = arg;
+    return xTaskCreatePinnedToCore(workerEntry, name, stackSize, state.get(), priority, &state->task, core) == pdPASS;
+}
+
+bool Worker::isStarted() const
+{
+    return state->task != nullptr;
+}
+
+IRAM_ATTR void Worker::run()
+{
+    state->owner = xTaskGetCurrentTaskHandle();
+    xTaskNotifyGive(state->task);
+}
+
+IRAM_ATTR void Worker::wait()
+{
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+}
@@ -0,0 +1,44 @@
+#include "platform.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+
+int64_t platform::timeUs()
+{
+    using namespace std::chrono;
+    static const auto start = steady_clock::now();
+    return duration_cast<microseconds>(steady_clock::now() - start).count();
+}
+
+uint32_t platform::cycleCount()
+{
+    using namespace std::chrono;
+    return static_cast<uint32_t>(duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+uint32_t platform::cycleFrequencyHz()
+{
+    return 1'000'000'000u;
+}
+
+bool platform::startTask(TaskEntry entry, const char * /*name*/, uint32_t /*stackSize*/, void *arg, uint8_t /*priority*/, int /*core*/)
+{
+    std::thread(entry, arg).detach();
+    return true;
+}
+
+uint8_t platform::maxTaskPriority()
+{
+    return 0;
+}
+
+void *platform::allocateAudioMemory(size_t bytes)
+{
+    // aligned_alloc wants the size to be a multiple of the alignment
+    return std::aligned_alloc(16, (bytes + 15) & ~size_t{15});
+}
+
+void platform::freeAudioMemory(void *memory)
+{
+    std::free(memory);
+}
@@ -0,0 +1,75 @@
+#include "wav_output.hpp"
+#include "esp_log.h"
+
+#define TAG "WavOutput"
+
+using namespace platform;
+
+namespace
+{
+    void putU16(FILE *f, uint16_t v)
+    {
+        uint8_t b[2] = {uint8_t(v), uint8_t(v >> 8)};
+        fwrite(b, 1, 2, f);
+    }
+
+    void putU32(FILE *f, uint32_t v)
+    {
+        uint8_t b[4] = {uint8_t(v), uint8_t(v >> 8), uint8_t(v >> 16), uint8_t(v >> 24)};
+        fwrite(b, 1, 4, f);
+    }
+}
+
+WavOutput::~WavOutput()
+{
+    close();
+}
+
+void WavOutput::init(uint32_t sampleRate)
+{
+    file = fopen(path.c_str(), "wb");
+    if (!file)
+    {
+        ESP_LOGE(TAG, "Cannot open %s", path.c_str());
+        return;
+    }
+    const uint16_t channels = 2;
+    const uint16_t bits = 16;
+
+    // RIFF sizes are patched in close() once the data length is known
+    fwrite("RIFF", 1, 4, file);
+    putU32(file, 0);
+    fwrite("WAVE", 1, 4, file);
+    fwrite("fmt ", 1, 4, file);
+    putU32(file, 16);
+    putU16(file, 1); // PCM
+    putU16(file, channels);
+    putU32(file, sampleRate);
+    putU32(file, sampleRate * channels * bits / 8);
+    putU16(file, channels * bits / 8);
+    putU16(file, bits);
+    fwrite("data", 1, 4, file);
+    putU32(file, 0);
+    dataBytes = 0;
+}
+
+void WavOutput::write(const int16_t *interleaved, size_t frames)
+{
+    if (!file)
+        return;
+    for (size_t i = 0; i < frames * 2; ++i)
+        putU16(file, static_cast<uint16_t>(interleaved[i]));
+    dataBytes += frames * 2 * sizeof(int16_t);
+}
+
+void WavOutput::close()
+{
+    if (!file)
+        return;
+    fseek(file, 4, SEEK_SET);
+    putU32(file, 36 + dataBytes);
+    fseek(file, 40, SEEK_SET);
+    putU32(file, dataBytes);
+    fclose(file);
+    file = nullptr;
+}
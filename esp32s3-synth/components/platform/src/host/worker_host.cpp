@@ -0,0 +1,76 @@
+#include "worker.hpp"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using namespace platform;
+
+struct Worker::State
+{
+    Job job = nullptr;
+    void *arg = nullptr;
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    uint64_t requested = 0; ///< run() calls so far
+    uint64_t finished = 0;  ///< jobs completed so far
+    bool stopping = false;
+};
+
+Worker::Worker() : state(std::make_unique<State>()) {}
+
+Worker::~Worker()
+{
+    if (!state->thread.joinable())
+        return;
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->stopping = true;
+    }
+    state->wake.notify_one();
+    state->thread.join();
+}
+
+bool Worker::start(const char * /*name*/, Job job, void *arg, uint32_t /*stackSize*/, uint8_t /*priority*/, int /*core*/)
+{
+    if (state->thread.joinable())
+        return true;
+    state->job = job;
+    state->arg = arg;
+    state->thread = std::thread([s = state.get()]
+                                {
+        std::unique_lock<std::mutex> lock(s->mutex);
+        while (true)
+        {
+            s->wake.wait(lock, [s] { return s->stopping || s->requested > s->finished; });
+            if (s->stopping)
+                return;
+            lock.unlock();
+            s->job(s->arg);
+            lock.lock();
+            ++s->finished;
+            s->done.notify_one();
+        } });
+    return true;
+}
+
+bool Worker::isStarted() const
+{
+    return state->thread.joinable();
+}
+
+void Worker::run()
+{
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        ++state->requested;
+    }
+    state->wake.notify_one();
+}
+
+void Worker::wait()
+{
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->done.wait(lock, [this] { return state->finished == state->requested; });
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace sound_module
+{
+    /// Contiguous run of arena-allocated objects, iterable like a container
+    template <typename T>
+    struct ArenaSlice
+    {
+        T *first = nullptr;
+        size_t count = 0;
+
+        T *begin() const { return first; }
+        T *end() const { return first + count; }
+        T &operator[](size_t i) const { return first[i]; }
+        size_t size() const { return count; }
+    };
+
+    /**
+     * One block of audio memory handed out front to back.
+     *
+     * The engine sizes it from its configuration, allocates it once at
+     * construction and carves voices, oscillators and buffers out of it;
+     * nothing is freed until the arena itself goes. allocate() returns
+     * uninitialised storage: the caller placement-news and destroys objects.
+     */
+    class Arena
+    {
+    public:
+        static constexpr size_t ALIGNMENT = 16;
+
+        /// Bytes taken by `count` objects of T, padding included
+        template <typename T>
+        static constexpr size_t footprint(size_t count)
+        {
+            static_assert(alignof(T) <= ALIGNMENT, "arena alignment too small");
+            return (sizeof(T) * count + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+        }
+
+        explicit Arena(size_t bytes);
+        ~Arena();
+
+        Arena(const Arena &) = delete;
+        Arena &operator=(const Arena &) = delete;
+
+        /// Storage for `count` objects of T; aborts when the arena is
+        /// exhausted, since the size is computed from the same config
+        template <typename T>
+        T *allocate(size_t count)
+        {
+            return static_cast<T *>(take(footprint<T>(count)));
+        }
+
+        size_t size() const { return capacity; }
+        size_t used() const { return offset; }
+
+    private:
+        uint8_t *memory = nullptr;
+        size_t capacity = 0;
+        size_t offset = 0;
+
+        void *take(size_t bytes);
+    };
+} // namespace sound_module
@@ -0,0 +1,40 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace sound_module
+{
+    /**
+     * MIDI channel -> set of voices listening on it, as one bit per voice.
+     * Updated by Voice::setMidiChannel() and Voice::setEnabled(), read by note dispatch; audio task only.
+     */
+    class ChannelMap
+    {
+    public:
+        static constexpr size_t CHANNELS = 16;
+        static constexpr size_t MAX_VOICES = 32;
+        using VoiceMask = uint32_t;
+
+        /// Move `voice` to `channel` (0–15), removing it from any other channel
+        void assign(uint8_t voice, uint8_t channel)
+        {
+            remove(voice);
+            voices[channel & (CHANNELS - 1)] |= VoiceMask{1} << voice;
+        }
+
+        /// Stop `voice` from receiving notes on any channel
+        void remove(uint8_t voice)
+        {
+            const VoiceMask bit = VoiceMask{1} << voice;
+            for (auto &mask : voices)
+                mask &= ~bit;
+        }
+
+        /// Voices listening on `channel`; bit i is voice i
+        VoiceMask voicesOn(uint8_t channel) const { return voices[channel & (CHANNELS - 1)]; }
+
+    private:
+        std::array<VoiceMask, CHANNELS> voices{};
+    };
+} // namespace sound_module
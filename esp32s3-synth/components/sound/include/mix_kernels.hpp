@@ -0,0 +1,50 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "smoothed_gain.hpp"
+
+// Four-lane GCC/Clang vector extensions where the target has float SIMD
+// (SSE2 on x86-64 hosts, NEON on ARM); the ESP32-S3 builds the scalar
+// versions.
+#if (defined(__SSE2__) || defined(__ARM_NEON)) && (defined(__clang__) || __GNUC__ >= 12)
+#define SOUND_MIX_SIMD 1
+#else
+#define SOUND_MIX_SIMD 0
+#endif
+
+namespace sound_module::mix
+{
+    /**
+     * Whole-block kernels of the voice and master buses.
+     *
+     * Buffers need no particular alignment. Every kernel does exactly the
+     * float operations of the per-sample loops it replaces, in the same
+     * order, so swapping them in does not change a single sample; the only
+     * intended difference is that convertInterleave() saturates at the int16
+     * range instead of wrapping around. accumulate() and mixMono() are plain
+     * loops that GCC vectorises by itself; the clamp, narrowing and
+     * interleave of convertInterleave() it does not, so that one is written
+     * with vector extensions.
+     */
+
+    /// dst[i] += src[i]
+    void accumulate(float *dst, const float *src, size_t n);
+
+    /// gains[i] = gain.next() * scale, stepping the smoother n times.
+    /// A settled smoother (next() no longer moves it) is filled in one go.
+    void rampGain(SmoothedGain &gain, float scale, float *gains, size_t n);
+
+    /// L[i] += src[i] * gains[i]; R[i] += src[i] * gains[i]
+    void mixMono(float *L, float *R, const float *src, const float *gains, size_t n);
+
+    /// out[2i] = sat16(L[i] * gains[i]), out[2i + 1] = sat16(R[i] * gains[i]),
+    /// truncating toward zero like static_cast<int16_t> inside the range
+    void convertInterleave(int16_t *out, const float *L, const float *R, const float *gains, size_t n);
+
+    /// The portable one-frame-at-a-time version, always built so the host
+    /// benchmark can compare it with the vector one
+    namespace scalar
+    {
+        void convertInterleave(int16_t *out, const float *L, const float *R, const float *gains, size_t n);
+    }
+}
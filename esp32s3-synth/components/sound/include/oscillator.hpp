@@ -1,7 +1,9 @@
 #pragma once
 #include <cstdint>
+#include <cstddef>
 #include "oscillator_settings.hpp" // for OscillatorShape, oscShapes, yesNo
 #include "envelope.hpp"
+#include "render_stats.hpp"
 #include <math.h>
 #include "esp_attr.h"
 
@@ -21,16 +23,60 @@ namespace sound_module
         /// Release the oscillator: mark inactive
         void noteOff();
 
+        /// Restart the held or releasing note with a new velocity, keeping
+        /// the phase and attacking from the current envelope level
+        void retrigger(uint8_t velocity_in);
+
+        /// Sound of a stolen note fading out under the new one
+        struct Tail
+        {
+            protocol::OscillatorShape shape = protocol::OscillatorShape::Sine;
+            uint32_t phase = 0;
+            uint32_t increment = 0;
+            uint32_t pulseWidth = 0;
+            float gain = 0.0f;      ///< envelope times velocity at the next sample
+            float step = 0.0f;      ///< per-sample gain change
+            uint32_t remaining = 0; ///< samples left, 0 when there is no tail
+        };
+
+        /// Hand the oscillator over to a new note. Returns the sound so far
+        /// as a tail that fades out linearly over `fadeSamples`, for the
+        /// voice that owned the note to keep mixing with renderTail()
+        Tail steal(size_t fadeSamples);
+
+        /// Accumulate the next `n` samples of `tail` into `out`
+        static void renderTail(Tail &tail, float *out, size_t n);
+
+        /// Current output level (envelope times velocity), 0–1
+        float currentLevel() const { return envelope.getLevel() * velNorm; }
+
         /// Update the oscillator’s phase increment to match a new frequency
         void setFrequency(float frequency);
 
-        /// Generate and return one sample at the current phase;
-        /// returns zero if inactive
-        float getSample();
+        /// Accumulate `n` velocity-scaled samples into `out`.
+        /// Shape dispatch happens once per block; frequency must be set beforehand.
+        /// Envelope time is added to `profile` when one is given.
+        void renderBlock(float *out, size_t n, BlockProfile *profile = nullptr);
+
+        /// renderBlock() with the kernel for SHAPE compiled in, for callers
+        /// that know the shape up front; any other shape takes renderBlock()
+        template <protocol::OscillatorShape SHAPE>
+        void renderBlockAs(float *out, size_t n, BlockProfile *profile = nullptr);
+
+        /// Span the envelope is rendered in ahead of the shape kernel
+        static constexpr size_t MAX_BLOCK = 128;
 
         /// Configuration setters
         void setShape(protocol::OscillatorShape newShape);
         void setPwm(uint8_t pwm); // 0–31
+
+        /// Continuous pulse width for the Square shape, as the fraction of the
+        /// cycle spent high. Changes ramp across the next block, so it can be
+        /// driven by a modulator without zipper noise.
+        void setPulseWidth(float width);
+
+        static constexpr float PWM_MIN = 0.05f;
+        static constexpr float PWM_MAX = 0.95f;
         void setBpm(uint16_t bpm);
 
         /// Configuration getters
@@ -46,13 +92,24 @@ namespace sound_module
         uint64_t getTimestamp();
 
     private:
+        friend class OscillatorPool;
+
         bool active = false;          ///< true if currently playing
         const uint32_t sample_rate;   ///< samples per second
-        float phase = 0.0f;           ///< oscillator phase [0,1)
-        float phase_increment = 0.0f; ///< increment per sample
+        const float phaseScale;       ///< 2^32 / sample_rate
+        uint32_t phase = 0;           ///< oscillator phase, 2^32 per cycle
+        uint32_t phase_increment = 0; ///< increment per sample
         uint64_t note_on_timestamp_us;
         // Oscillator settings
         protocol::OscillatorShape shape = protocol::OscillatorShape::Sine;
-        uint8_t pwm = 0;
+        uint32_t pulseWidth = 0;       ///< current width, 2^32 per cycle
+        uint32_t targetPulseWidth = 0; ///< reached at the end of the next block
+
+        // Intrusive free list, owned by OscillatorPool
+        Oscillator *nextFree = nullptr;
+        bool pooled = false;
+
+        template <protocol::OscillatorShape SHAPE>
+        void renderBlockKernel(float *out, size_t n, BlockProfile *profile);
     };
 } // namespace sound_module
@@ -0,0 +1,62 @@
+#pragma once
+#include <cstddef>
+#include "arena.hpp"
+
+namespace sound_module
+{
+    class Oscillator;
+
+    /**
+     * Unordered set of oscillator pointers with a capacity fixed at
+     * construction; the slots live in the engine arena. push() and
+     * removeAt() are O(1) and never allocate: removal moves the last entry
+     * into the freed slot, so iteration order is not preserved.
+     */
+    class OscillatorList
+    {
+    public:
+        OscillatorList(Arena &arena, size_t capacity)
+            : slots(arena.allocate<Oscillator *>(capacity)), capacity(capacity) {}
+
+        OscillatorList(const OscillatorList &) = delete;
+        OscillatorList &operator=(const OscillatorList &) = delete;
+
+        /// Append; returns false (and drops `osc`) when full
+        bool push(Oscillator *osc)
+        {
+            if (count == capacity)
+                return false;
+            slots[count++] = osc;
+            return true;
+        }
+
+        /// Swap-and-pop the entry at `i`
+        void removeAt(size_t i) { slots[i] = slots[--count]; }
+
+        /// Remove `osc` if present; returns false if it was not in the list
+        bool remove(Oscillator *osc)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (slots[i] == osc)
+                {
+                    removeAt(i);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        size_t size() const { return count; }
+        bool empty() const { return count == 0; }
+        Oscillator *operator[](size_t i) const { return slots[i]; }
+
+        Oscillator *const *begin() const { return slots; }
+        Oscillator *const *end() const { return slots + count; }
+
+    private:
+        Oscillator **slots;
+        size_t capacity;
+        size_t count = 0;
+    };
+} // namespace sound_module
@@ -0,0 +1,61 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "arena.hpp"
+#include "oscillator.hpp"
+
+namespace sound_module
+{
+    /// Which sounding oscillator gives way when a note finds the pool empty
+    enum class StealPolicy : uint8_t
+    {
+        None,     ///< drop the new note
+        Oldest,   ///< the note started longest ago
+        Quietest, ///< the lowest envelope level times velocity
+        SameNote, ///< a note with the same pitch if one sounds, else the oldest
+    };
+
+    /**
+     * Fixed set of oscillators with an intrusive free list.
+     *
+     * acquire() and release() are O(1) and never allocate; the storage is
+     * carved from the engine arena once at construction so oscillator
+     * pointers stay valid for the lifetime of the pool. At most limit()
+     * oscillators are handed out at a time; the limit can move anywhere up
+     * to the capacity while notes play. Audio task only.
+     */
+    class OscillatorPool
+    {
+    public:
+        OscillatorPool(Arena &arena, size_t capacity, uint32_t sampleRate, uint16_t initialBpm);
+        ~OscillatorPool();
+
+        OscillatorPool(const OscillatorPool &) = delete;
+        OscillatorPool &operator=(const OscillatorPool &) = delete;
+
+        /// Take a silent oscillator, or nullptr if limit() are in use
+        Oscillator *acquire();
+
+        /// Return an oscillator that has stopped playing
+        void release(Oscillator *osc);
+
+        /// Cap the oscillators in use (clamped to 1..capacity()). Lowering it
+        /// below inUse() lets the extra notes finish; new notes steal meanwhile.
+        void setLimit(size_t limit);
+        size_t limit() const { return maxInUse; }
+
+        size_t inUse() const { return storage.size() - freeCount; }
+        size_t available() const { return inUse() < maxInUse ? maxInUse - inUse() : 0; }
+        size_t capacity() const { return storage.size(); }
+
+        // Every oscillator, free or not (for settings that apply to all)
+        Oscillator *begin() const { return storage.begin(); }
+        Oscillator *end() const { return storage.end(); }
+
+    private:
+        ArenaSlice<Oscillator> storage;
+        Oscillator *freeHead = nullptr;
+        size_t freeCount = 0;
+        size_t maxInUse = 0;
+    };
+} // namespace sound_module
@@ -0,0 +1,133 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "platform.hpp"
+
+namespace sound_module
+{
+    /// Stages of one SoundModule::process() block, as seen by the audio task.
+    /// The first eight are disjoint; Render is the whole render() call
+    /// (everything but OutputWait). Work done by the render helper on the
+    /// other core only shows up as the audio task's HelperWait.
+    enum class Stage : uint8_t
+    {
+        EventDrain,  ///< draining queued notes/params
+        Oscillators, ///< oscillator kernels and pitch updates
+        Envelope,    ///< ADSR rendering
+        Filter,      ///< per-voice filters
+        Mix,         ///< modulators, voice gain and summing into the bus
+        Convert,     ///< master gain and float -> int16
+        HelperWait,  ///< waiting for the render helper at the barrier
+        OutputWait,  ///< AudioOutput::write(), i.e. waiting for I2S DMA space
+        Render,      ///< total render time of the block
+        _Count
+    };
+
+    constexpr size_t STAGE_COUNT = static_cast<size_t>(Stage::_Count);
+
+    const char *stageName(Stage stage);
+
+    /// Cycles spent per stage in the block being rendered. Audio task only.
+    struct BlockProfile
+    {
+        std::array<uint32_t, STAGE_COUNT> cycles{};
+
+        void add(Stage stage, uint32_t elapsed) { cycles[static_cast<size_t>(stage)] += elapsed; }
+        uint32_t get(Stage stage) const { return cycles[static_cast<size_t>(stage)]; }
+    };
+
+    /// Adds the cycles between construction and destruction to one stage
+    class StageTimer
+    {
+    public:
+        StageTimer(BlockProfile &profile, Stage stage)
+            : profile(profile), stage(stage), start(platform::cycleCount()) {}
+        ~StageTimer() { profile.add(stage, platform::cycleCount() - start); }
+
+    private:
+        BlockProfile &profile;
+        Stage stage;
+        uint32_t start;
+    };
+
+    /// Snapshot of one stage's distribution, in platform::cycleCount() ticks
+    struct StageSummary
+    {
+        uint32_t blocks = 0;
+        uint32_t min = 0;
+        uint32_t avg = 0;
+        uint32_t max = 0;
+        uint32_t p50 = 0;
+        uint32_t p90 = 0;
+        uint32_t p99 = 0;
+    };
+
+    /**
+     * Per-stage cycle histograms of the rendered blocks.
+     *
+     * The audio task is the only writer (commit()); every published field is
+     * a relaxed 32-bit atomic, so any task may read a summary at any time
+     * without locks. A summary read mid-commit can mix two adjacent blocks,
+     * which is irrelevant for profiling. Percentiles come from log-spaced
+     * buckets with four steps per octave, so they are exact to within 19 %.
+     */
+    class RenderStats
+    {
+    public:
+        /// Highest active-oscillator count tracked by renderAvgByOscillators()
+        static constexpr size_t MAX_TRACKED_OSCILLATORS = 32;
+
+        /// Audio task: fold one finished block into the histograms
+        void commit(const BlockProfile &profile, size_t activeOscillators);
+
+        /// Cycles available per block (buffer duration); set once at init
+        void setBudget(uint32_t cycles) { budget.store(cycles, std::memory_order_relaxed); }
+        uint32_t getBudget() const { return budget.load(std::memory_order_relaxed); }
+
+        /// Any task
+        StageSummary summary(Stage stage) const;
+
+        /// Average Render cycles of blocks rendered with `count` oscillators
+        /// playing (count is clamped to MAX_TRACKED_OSCILLATORS); 0 if none seen
+        uint32_t renderAvgByOscillators(size_t count) const;
+
+        /// Any task: clear all histograms before the next commit
+        void requestReset() { resetRequested.store(true, std::memory_order_relaxed); }
+
+        /// Log a per-stage table and the load per oscillator count with ESP_LOGI
+        void log(const char *tag) const;
+
+    private:
+        static constexpr size_t BUCKETS = 124; // 4 exact + 4 per octave up to 2^32
+
+        static size_t bucketOf(uint32_t cycles);
+        static uint32_t bucketUpperBound(size_t bucket);
+
+        struct Histogram
+        {
+            std::atomic<uint32_t> blocks{0};
+            std::atomic<uint32_t> min{UINT32_MAX};
+            std::atomic<uint32_t> max{0};
+            std::atomic<uint32_t> avg{0};
+            std::array<std::atomic<uint32_t>, BUCKETS> counts{};
+            uint64_t total = 0; ///< writer-private running sum
+
+            void record(uint32_t cycles);
+            void clear();
+        };
+
+        struct LoadAverage
+        {
+            std::atomic<uint32_t> avg{0};
+            uint64_t total = 0; ///< writer-private
+            uint32_t blocks = 0; ///< writer-private
+        };
+
+        std::array<Histogram, STAGE_COUNT> stages;
+        std::array<LoadAverage, MAX_TRACKED_OSCILLATORS + 1> loadByOscillators;
+        std::atomic<uint32_t> budget{0};
+        std::atomic<bool> resetRequested{false};
+    };
+} // namespace sound_module
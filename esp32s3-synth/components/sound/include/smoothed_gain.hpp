@@ -1,5 +1,6 @@
 #pragma once
 #include <cstdint>
+#include "fastmath.hpp"
 
 struct SmoothedGain
 {
@@ -19,6 +20,15 @@ struct SmoothedGain
         current += alpha * (target - current);
         return current;
     }
+
+    // True once next() can no longer move `current` (it stalls within an ulp
+    // of `target`), so a whole block can use `current` as a constant.
+    bool isSettled() const
+    {
+        float stepped = current;
+        stepped += alpha * (target - stepped);
+        return stepped == current;
+    }
 };
 
 struct VolumeSettings
@@ -41,7 +51,7 @@ inline void setSmoothedGain(VolumeSettings &volumeSettings, uint8_t newVolume, u
     float volume_dB = minDB + normalized * (maxDB - minDB);
 
     // 3) Convert dB → linear and feed into the smoother:
-    float linearGain = std::pow(10.0f, volume_dB * 0.05f);
+    float linearGain = sound_module::fastmath::dbToGain(volume_dB);
     // ESP_LOGD(TAG, "Linear gain %f Volume_db %f", linearGain, volume_dB);
     volumeSettings.gain_smoothed.setTarget(linearGain);
 }
@@ -3,27 +3,34 @@
 #include <cstdint>
 #include <vector>
 #include <functional>
-#include <freertos/FreeRTOS.h>
-#include <freertos/task.h>
-#include <driver/gpio.h>
-#include <driver/i2s_std.h>
 #include "voice.hpp"
 #include "menu_struct.hpp"
 #include "smoothed_gain.hpp"
 #include "oscillator.hpp"
-#include "cached_lfo.hpp"
-#include <mutex>      // add this at the top
+#include "oscillator_pool.hpp"
+#include "arena.hpp"
+#include <atomic>
+#include "spsc_queue.hpp"
+#include "synth_event.hpp"
 #include "esp_attr.h" // ✅ Add this line to use IRAM_ATTR
+#include "audio_output.hpp"
+#include "worker.hpp"
+#include "render_stats.hpp"
+#include "xrun_monitor.hpp"
 
 namespace sound_module
 {
 
-    // Configuration for I2S pins
-    struct I2SParams
+    /// How render() spreads the voices over the cores
+    enum class RenderMode : uint8_t
     {
-        gpio_num_t bclk_io;  // Bit clock
-        gpio_num_t lrclk_io; // Word select (left/right clock)
-        gpio_num_t data_io;  // Serial data out
+        SingleCore, ///< every voice on the audio task
+        VoiceSplit, ///< a helper task on core 0 renders about half the voices
+        Pipelined,  ///< the helper renders the oscillators of block N+1 while
+                    ///< the audio task filters and outputs block N; one block
+                    ///< more latency. A parameter change reaches the oscillators
+                    ///< at the first block start at or after its frame, and the
+                    ///< filter and voice gain one block before that
     };
 
     // Main sound engine configuration
@@ -33,9 +40,16 @@ namespace sound_module
         size_t tableSize;    // Wavetable resolution
         uint16_t amplitude;  // Peak amplitude for 16-bit audio
         size_t bufferSize;   // Samples per I2S buffer
-        size_t numVoices;
-        uint8_t maxPoliphony;
-        I2SParams i2s; // I2S pin configuration
+        size_t numVoices;    // Voices playing at start; setVoiceCount() changes it
+        uint8_t maxPoliphony; // Oscillators playing at start; setPolyphony() changes it
+        StealPolicy stealPolicy = StealPolicy::Oldest; // when all oscillators are busy
+        size_t voiceCapacity = 0;      // Voices the arena holds (0: numVoices)
+        uint8_t polyphonyCapacity = 0; // Oscillators the arena holds (0: maxPoliphony)
+        RenderMode renderMode = RenderMode::SingleCore;
+        /// Reserve the Pipelined mode's buffers (two blocks of source audio
+        /// per voice). Implied when renderMode is Pipelined; without it a
+        /// request for Pipelined renders as VoiceSplit instead.
+        bool allowPipelined = false;
     };
 
     struct GlobalState
@@ -47,35 +61,226 @@ namespace sound_module
         bool isSynced = false;
     };
 
+    /// Field updates in a full project load: every voice page for
+    /// MAX_VOICES voices, then the global pages
+    constexpr size_t projectFieldCount()
+    {
+        size_t count = 0;
+        for (size_t page = 0; page < protocol::PAGE_COUNT; ++page)
+            count += protocol::menuPages[page].fieldCount * (page < protocol::VOICE_PAGE_COUNT ? protocol::MAX_VOICES : 1);
+        return count;
+    }
+
     class SoundModule
     {
     public:
-        explicit SoundModule(const SoundConfig &config);
+        /// All engine memory comes from one arena allocated here, sized by
+        /// the config's capacities; nothing is allocated after this
+        SoundModule(const SoundConfig &config, platform::AudioOutput &output);
+        ~SoundModule();
+
+        /// Arena bytes the engine needs for `config`
+        static size_t arenaBytes(const SoundConfig &config);
+
         void init();
         void process();
 
-        // MIDI input handler
-        void handle_note(const midi_module::MidiNoteEvent &msg);
+        /// Render `frames` interleaved stereo frames without touching the output.
+        /// Stage timings go to the current block profile; process() commits it.
+        void render(int16_t *interleaved, size_t frames);
+
+        // MIDI input handler (receiver task): queued for the audio task
+        void handle_note(const midi_module::MidiNoteEvent &msg, uint64_t frame = SynthEvent::NOW);
+
+        /// Queue an event for the audio task; returns false if the queue is full.
+        /// Events stamped NOW get the frame matching their arrival time plus one
+        /// block of latency, so they land at the same offset inside the next block.
+        /// Single producer: only the receiver task may call this.
+        bool post(SynthEvent event);
+
+        /// Frame an event arriving now will be applied at
+        uint64_t stampFrame() const;
+
+        /// Frames rendered so far (audio task clock)
+        uint64_t getRenderedFrames() const { return renderedFrames; }
+
+        /// Called on the audio task for every drained non-note event
+        using EventHandler = std::function<void(const SynthEvent &)>;
+        void setEventHandler(EventHandler handler) { eventHandler = std::move(handler); }
+
+        /// Request a master volume change (0–255); safe from any task, latest value wins
+        void setMasterVolume(uint8_t volume) { pendingMasterVolume.store(volume, std::memory_order_relaxed); }
+
+        /// Per-stage timing of every process() block; readable from any task
+        const RenderStats &getStats() const { return stats; }
+        RenderStats &getStats() { return stats; }
+
+        /// Deadline slack, late blocks and output underruns; readable from any task
+        const XrunMonitor &getXruns() const { return xruns; }
+        XrunMonitor &getXruns() { return xruns; }
+
+        /// Choose what a note takes when the pool is empty; safe from any task
+        void setStealPolicy(StealPolicy policy) { stealPolicy.store(policy, std::memory_order_relaxed); }
+        StealPolicy getStealPolicy() const { return stealPolicy.load(std::memory_order_relaxed); }
+
+        /// Choose how voices are spread over the cores; safe from any task,
+        /// applied from the next block. The helper task starts on first use.
+        /// Entering Pipelined plays one block of silence to fill the pipeline;
+        /// leaving it plays out the block in flight, so nothing is lost.
+        /// In Pipelined mode render() must be called with equal-sized chunks.
+        /// Pipelined needs SoundConfig::allowPipelined; without it VoiceSplit
+        /// is used instead.
+        void setRenderMode(RenderMode mode) { renderMode.store(supportedMode(mode), std::memory_order_relaxed); }
+        RenderMode getRenderMode() const { return renderMode.load(std::memory_order_relaxed); }
+
+        /// Fade applied to the sound of a stolen oscillator
+        static constexpr float STEAL_FADE_SECONDS = 0.003f;
+
+        /// Oscillators currently sounding across all voices. Audio task only,
+        /// and only meaningful between blocks outside Pipelined mode.
+        size_t activeOscillatorCount() const;
 
-        // Access voices for advanced control
-        std::vector<Voice> &getVoices() { return voices; }
+        /// Audio task: play with the first `count` voices (clamped to
+        /// 1..getVoiceCapacity()). Voices past it stop taking notes and let
+        /// the ones they hold ring out.
+        void setVoiceCount(size_t count);
+        size_t getVoiceCount() const { return voiceCount; }
+        size_t getVoiceCapacity() const { return voices.size(); }
+
+        /// Audio task: cap the oscillators sounding at once (clamped to
+        /// 1..getPolyphonyCapacity()); notes beyond it steal
+        void setPolyphony(size_t count) { pool.setLimit(count); }
+        size_t getPolyphony() const { return pool.limit(); }
+        size_t getPolyphonyCapacity() const { return pool.capacity(); }
+
+        // Access voices for advanced control; every voice the arena holds,
+        // enabled or not, so settings stick while a voice is off
+        ArenaSlice<Voice> getVoices() { return voices; }
         GlobalState &getState() { return state; }
         void updateBpmSetting();
-        Voice &getVoice(uint8_t index) { return getVoices()[index]; }
+        Voice &getVoice(uint8_t index) { return voices[index]; }
 
     private:
         SoundConfig config;
-        i2s_chan_handle_t txChan;
-        std::vector<Voice> voices;
-        TaskHandle_t audioTask = nullptr;
+        platform::AudioOutput &output;
+        Arena arena;
+        ArenaSlice<Voice> voices;
+        size_t voiceCount = 0;
+        bool audioTaskStarted = false;
         GlobalState state;
-        std::vector<Oscillator> oscillatorPool;
+        OscillatorPool pool;
+        ChannelMap channels;
+        std::atomic<StealPolicy> stealPolicy;
+        size_t stealFadeSamples;
 
         // Internal audio task entry point
         static void audio_task_entry(void *arg);
-        Oscillator *allocateSound();
-        std::mutex activeOscillatorsMutex;
-        std::vector<int16_t> buffer; // Stereo output buffer (L, R)
+
+        /// Notes that may arrive while a project load is still queued
+        static constexpr size_t NOTE_HEADROOM = 128;
+
+        // A project load posts one event per field; post() drops what does
+        // not fit, and the Engine page comes last
+        static constexpr size_t EVENT_QUEUE_CAPACITY = 512;
+        static_assert(EVENT_QUEUE_CAPACITY - 1 >= projectFieldCount() + NOTE_HEADROOM,
+                      "event queue too small for a project load");
+        SpscQueue<SynthEvent, EVENT_QUEUE_CAPACITY> events;
+
+        /// What the helper task runs on the next worker.run()
+        enum class WorkerJob : uint8_t
+        {
+            SplitVoices,
+            Sources,
+        };
+
+        std::atomic<RenderMode> renderMode;
+        platform::Worker worker;
+        WorkerJob workerJob = WorkerJob::SplitVoices;
+        BlockProfile helperProfile; ///< helper's stage timings, not committed
+
+        // VoiceSplit: the helper renders splitVoices into splitLeft/Right
+        ArenaSlice<Voice *> ownVoices;   ///< audio task's share of the segment
+        ArenaSlice<Voice *> splitVoices; ///< helper's share of the segment
+        float *splitLeft = nullptr;
+        float *splitRight = nullptr;
+        size_t splitFrames = 0;
+        uint64_t splitFrame = 0;
+
+        // Pipelined: the helper renders every voice's sources of one block
+        // into pipe[pipeFill] while the audio task filters the other one.
+        // Only allocated when config.allowPipelined is set.
+        // A block is cut into segments at its note events, exactly as render()
+        // cuts it in the other modes.
+        struct PipeSegment
+        {
+            uint16_t offset;
+            uint16_t frames;
+        };
+        struct PipeBlock
+        {
+            float *source = nullptr;         ///< bufferSize frames per voice
+            uint8_t *active = nullptr;       ///< MAX_SEGMENTS flags per voice: source written
+            PipeSegment *segments = nullptr; ///< MAX_SEGMENTS
+            size_t segmentCount = 0;
+            size_t frames = 0;
+        };
+        /// Every note can start a segment
+        static constexpr size_t MAX_SEGMENTS = EVENT_QUEUE_CAPACITY + 1;
+        PipeBlock pipe[2];
+        size_t pipeFill = 0;
+        bool pipeBusy = false;           ///< a Sources job is in flight
+        ArenaSlice<SynthEvent> pipeNotes; ///< notes of the block being sourced
+        ArenaSlice<SynthEvent> pipeParams; ///< its parameter changes, applied next block
+        uint64_t pipeFrame = 0;
+
+        bool startWorker();
+        static void worker_entry(void *arg);
+        void renderSplitVoices();
+        void reapOscillators(BlockProfile &stageProfile);
+        void renderVoices(size_t pos, size_t n, RenderMode mode);
+        void renderSources();
+        void renderPipelined(int16_t *interleaved, size_t n, bool refill);
+        void convert(int16_t *interleaved, size_t n);
+        Oscillator *stealOscillator(uint8_t midi_note);
+        EventHandler eventHandler;
+        std::atomic<int16_t> pendingMasterVolume{-1};
+
+        BlockProfile profile;
+        RenderStats stats;
+        XrunMonitor xruns;
+
+        /// What was playing in the block being committed; measured while
+        /// the helper is idle
+        struct BlockLoad
+        {
+            uint8_t voices = 0;
+            uint8_t features = 0;
+            size_t oscillators = 0;
+        };
+        BlockLoad blockLoad;
+
+        void measureLoad();
+        void commitBlockStats();
+
+        uint64_t renderedFrames = 0;
+        /// platform::timeUs() at which frame 0 would have started rendering
+        std::atomic<int64_t> clockOriginUs{INT64_MIN};
+
+        uint64_t frameForTime(int64_t timeUs) const;
+        void drainEvents(uint64_t upToFrame);
+        void drainPipelineEvents(uint64_t upToFrame);
+        void applyPipelineParams();
+        void applyNote(const midi_module::MidiNoteEvent &msg);
+        int16_t *buffer; // Stereo output buffer (L, R)
+        float *mixLeft;  // Per-block voice mix
+        float *mixRight;
+        float *masterGains; // Master gain ramp times amplitude, per frame
+
+        static SoundConfig withCapacities(const SoundConfig &config);
+        RenderMode supportedMode(RenderMode mode) const
+        {
+            return mode == RenderMode::Pipelined && !config.allowPipelined ? RenderMode::VoiceSplit : mode;
+        }
     };
 
 } // namespace sound_module
@@ -0,0 +1,58 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace sound_module
+{
+    /**
+     * Fixed-capacity wait-free single-producer/single-consumer ring buffer.
+     * One task may push, one other task may pop/peek. Capacity must be a
+     * power of two; one slot is never used to tell full from empty apart.
+     */
+    template <typename T, size_t Capacity>
+    class SpscQueue
+    {
+        static_assert((Capacity & (Capacity - 1)) == 0, "capacity must be a power of two");
+
+    public:
+        /// Producer side: returns false (and drops the item) when full
+        bool push(const T &item)
+        {
+            size_t head = writeIndex.load(std::memory_order_relaxed);
+            size_t next = (head + 1) & (Capacity - 1);
+            if (next == readIndex.load(std::memory_order_acquire))
+                return false;
+            slots[head] = item;
+            writeIndex.store(next, std::memory_order_release);
+            return true;
+        }
+
+        /// Consumer side: oldest item, or nullptr when empty
+        const T *peek() const
+        {
+            size_t tail = readIndex.load(std::memory_order_relaxed);
+            if (tail == writeIndex.load(std::memory_order_acquire))
+                return nullptr;
+            return &slots[tail];
+        }
+
+        /// Consumer side: remove the oldest item; returns false when empty
+        bool pop(T &item)
+        {
+            const T *front = peek();
+            if (!front)
+                return false;
+            item = *front;
+            readIndex.store((readIndex.load(std::memory_order_relaxed) + 1) & (Capacity - 1), std::memory_order_release);
+            return true;
+        }
+
+        bool empty() const { return peek() == nullptr; }
+
+    private:
+        std::array<T, Capacity> slots{};
+        alignas(64) std::atomic<size_t> writeIndex{0};
+        alignas(64) std::atomic<size_t> readIndex{0};
+    };
+}
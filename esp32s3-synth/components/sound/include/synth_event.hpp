@@ -0,0 +1,28 @@
+#pragma once
+#include <cstdint>
+#include "protocol.hpp"
+
+namespace sound_module
+{
+    enum class SynthEventType : uint8_t
+    {
+        Note,      ///< `note` is valid
+        Field,     ///< `field` is valid (UI parameter update)
+        MidiBpm,   ///< `value` is the BPM reported by MIDI clock
+        Transport, ///< `transport` is valid (MIDI start/continue/stop)
+    };
+
+    /// Event handed from the receiver task to the audio task
+    struct SynthEvent
+    {
+        /// `frame` value asking SoundModule::post() to stamp the arrival time
+        static constexpr uint64_t NOW = UINT64_MAX;
+
+        SynthEventType type;
+        midi_module::MidiNoteEvent note;
+        protocol::FieldUpdate field;
+        midi_module::TransportCommand transport;
+        uint16_t value;
+        uint64_t frame = NOW; ///< absolute sample frame the event is applied at
+    };
+}
@@ -6,13 +6,15 @@
 #include <optional>
 #include "note_freq_table.hpp"
 #include "oscillator.hpp"
+#include "oscillator_pool.hpp"
+#include "oscillator_list.hpp"
+#include "channel_map.hpp"
 #include "menu_struct.hpp"
 #include "lfo.hpp"
-#include "cached_lfo.hpp"
 #include "filter.hpp"
 #include "protocol.hpp"
-#include "stereo.hpp"
 #include "smoothed_gain.hpp"
+#include "xrun_monitor.hpp"
 
 using namespace protocol;
 namespace sound_module
@@ -28,22 +30,82 @@ namespace sound_module
         /**
          * Construct a voice engine.
          * @param sample_rate Audio sample rate in Hz.
-         * @param max_polyphony Maximum simultaneous notes.
+         * @param pool Oscillators finished notes are returned to.
+         * @param channels Routing table kept in step with the voice's MIDI channel.
+         * @param arena Engine memory the oscillator list is carved from.
          */
-        Voice(uint8_t index, uint32_t sample_rate, uint8_t channel, uint16_t initial_bpm);
+        Voice(uint8_t index, uint32_t sample_rate, uint8_t channel, uint16_t initial_bpm,
+              OscillatorPool &pool, ChannelMap &channels, Arena &arena);
+
+        Voice(const Voice &) = delete;
+        Voice &operator=(const Voice &) = delete;
+
+        /// False while the voice is muted and should not take new notes
+        bool isAudible() const { return volumeSettings.volume > 0; }
+
+        /// Take the voice in or out of the engine's active voice count. A
+        /// disabled voice leaves the ChannelMap and releases its notes, which
+        /// still ring out; its settings are kept for when it comes back.
+        void setEnabled(bool enabled);
+        bool isEnabled() const { return enabled; }
+
+        /// Whether renderBlock() has anything to do for this voice
+        bool needsRender() const { return enabled || !activeOscillators.empty() || tailCount > 0; }
+
+        /// Restart `midi_note` in place if this voice still sounds it;
+        /// returns false when the note needs a new oscillator
+        bool retrigger(uint8_t midi_note, uint8_t velocity);
+
+        /**
+         * Start a note on an oscillator taken from the pool (or stolen).
+         * Note dispatch goes through the ChannelMap, so the caller only
+         * checks isAudible(); the voice owns `sound` until it falls silent
+         * and is released back to the pool.
+         */
+        void noteOn(Oscillator *sound, uint8_t midi_note, uint8_t velocity);
+        void noteOff(uint8_t midi_note);
+
+        /// Drop an oscillator that is being stolen by another note, without
+        /// returning it to the pool. Its sound fades out over `fadeSamples`
+        /// on this voice, through this voice's amp LFO, filter and gain.
+        void detach(Oscillator *sound, size_t fadeSamples);
 
         /**
-         * Note on/off handlers.
-         * velocity: normalized 0.0–1.0
+         * Accumulate the next n samples of this voice into L/R, starting at
+         * engine frame `frame`. LFOs and pitch ratio run once per control
+         * block of up to CONTROL_BLOCK samples. The LFOs are clocked by the
+         * frame count, not by wall time. Stage timings are added to `profile`.
+         * Touches only this voice and its oscillators, so different voices
+         * may render on different cores at once.
          */
-        void noteOn(Oscillator *sound, uint8_t channel, uint8_t midi_note, uint8_t velocity);
-        void noteOff(uint8_t channel, uint8_t midi_note);
+        void renderBlock(float *L, float *R, size_t n, uint64_t frame, BlockProfile &profile);
 
         /**
-         * Generate the next mixed sample for this voice.
-         * @return Sample amplitude in [-1.0, 1.0]
+         * The two halves of renderBlock(), for the pipelined render mode.
+         * renderSourceBlock() runs the LFOs, oscillators, envelopes and amp
+         * LFO into `out` and returns false if the voice was silent (then
+         * `out` is left unwritten). renderPostBlock() runs the filter and
+         * voice gain over such a buffer and adds it to L/R. The halves touch
+         * disjoint state, so they may run on different cores at once for
+         * different blocks; both split `n` into the same control blocks as
+         * renderBlock(), so the result is the same.
          */
-        Stereo getSample();
+        bool renderSourceBlock(float *out, size_t n, uint64_t frame, BlockProfile &profile);
+        void renderPostBlock(float *source, float *L, float *R, size_t n, BlockProfile &profile);
+
+        /// Release finished oscillators to the pool. The pool is shared, so
+        /// the engine calls this from the thread that applies notes, before
+        /// each segment's notes, rather than the voice doing it while rendering.
+        void garbageCollect();
+
+        /// Oscillators currently sounding on this voice
+        size_t activeOscillatorCount() const { return activeOscillators.size(); }
+        Oscillator *activeOscillator(size_t i) const { return activeOscillators[i]; }
+
+        /// Feature bits (xrun_monitor.hpp) this voice currently renders with
+        uint8_t activeFeatures() const;
+
+        static constexpr size_t CONTROL_BLOCK = 128;
 
         // Voice-level controls
         void setVolume(uint8_t volume);
@@ -60,20 +122,33 @@ namespace sound_module
         void setOscillatorPwm(uint8_t value);
         void updatePitchOffset();
 
-        const uint16_t sampleRate;
+        /// The voice's two LFOs, as addressed by the LFO setters
+        enum class LfoTarget : uint8_t
+        {
+            Pitch,
+            Amp,
+        };
 
-        LFO pitchLfo;
-        LFO ampLfo;
+        // LFO settings; the render kernel follows the depth and waveform
+        void setLfoWaveform(LfoTarget target, protocol::LfoWaveform waveform);
+        void setLfoSubdivision(LfoTarget target, protocol::LfoSubdivision subdivision);
+        void setLfoDepth(LfoTarget target, uint8_t depth);
 
-        CachedLFO pitchLfoC;
-        CachedLFO ampLfoC;
+        const uint16_t sampleRate;
 
         Filter filter;
         voice::PitchSettings pitchSettings;
 
     private:
+        LFO pitchLfo;
+        LFO ampLfo;
+        LFO &lfoFor(LfoTarget target) { return target == LfoTarget::Pitch ? pitchLfo : ampLfo; }
+
         uint8_t index;
-        size_t midi_channel = 0;
+        OscillatorPool *pool;
+        ChannelMap *channels;
+        uint8_t midi_channel = 0;
+        bool enabled = true;
         uint16_t bpm;
 
         float ampLfoSmoothed = 1.0f;
@@ -84,11 +159,38 @@ namespace sound_module
         voice::EnvelopeSettings envelopeSettings;
         voice::OscillatorSettings oscillatorSettings;
 
-        std::vector<Oscillator *> activeOscillators;
+        OscillatorList activeOscillators; ///< sized to the pool, so a push never fails
 
-        Oscillator *find_note_to_release(uint8_t midi_note); // can be a nullptr
-        
-        void garbageCollect();
+        /// Fades of notes stolen from this voice. A steal fade is a few
+        /// milliseconds, so more overlapping steals than this are rare; the
+        /// next one then replaces the quietest fade.
+        static constexpr size_t MAX_TAILS = 4;
+        std::array<Oscillator::Tail, MAX_TAILS> tails{};
+        size_t tailCount = 0;
+        void renderTails(float *mix, size_t n);
+
+        /// Oscillator sounding each MIDI note on this voice, or nullptr.
+        /// A note has at most one: a repeated note-on retriggers it.
+        std::array<Oscillator *, 128> noteSlots{};
+        Oscillator *&slotFor(uint8_t midi_note) { return noteSlots[midi_note & 0x7F]; }
+
+        void renderControlBlock(float *L, float *R, size_t n, uint64_t frame, BlockProfile &profile);
+        bool renderSource(float *mix, size_t n, uint64_t frame, BlockProfile &profile);
+
+        /**
+         * renderSource() bodies specialised per oscillator shape and per LFO
+         * on/off, so the block loops carry no dispatch: a silent LFO is not
+         * read, and without an amp LFO a settled smoother is a plain gain.
+         * The filter picks its own kernel per type the same way.
+         */
+        using SourceKernel = bool (Voice::*)(float *mix, size_t n, uint64_t frame, BlockProfile &profile);
+        template <protocol::OscillatorShape SHAPE, bool PITCH_LFO, bool AMP_LFO>
+        bool renderSourceAs(float *mix, size_t n, uint64_t frame, BlockProfile &profile);
+        static SourceKernel sourceKernelFor(protocol::OscillatorShape shape, bool pitchLfo, bool ampLfo);
+        SourceKernel sourceKernel = nullptr;
+        /// Re-pick sourceKernel after the oscillator shape or an LFO changed
+        void updateKernels();
+        void renderPost(float *mix, float *L, float *R, size_t n, BlockProfile &profile);
 
         void all_notes_off();
     };
@@ -0,0 +1,92 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace sound_module
+{
+    /// Voice features that change the render cost of a block (bit mask)
+    enum Feature : uint8_t
+    {
+        FEATURE_FILTER = 1 << 0,    ///< filter not bypassed
+        FEATURE_PITCH_LFO = 1 << 1, ///< pitch LFO depth > 0
+        FEATURE_AMP_LFO = 1 << 2,   ///< amp LFO depth > 0
+        FEATURE_PULSE = 1 << 3,     ///< square shape (PWM ramp)
+        FEATURE_NOISE = 1 << 4,     ///< noise shape
+    };
+
+    /// One block that missed its deadline or was followed by a DMA underrun
+    struct LateBlock
+    {
+        uint32_t block = 0;        ///< process() block index
+        uint32_t renderCycles = 0; ///< render time in platform::cycleCount() ticks
+        uint8_t voices = 0;        ///< voices with at least one oscillator playing
+        uint8_t oscillators = 0;   ///< oscillators playing
+        uint8_t features = 0;      ///< Feature bits of every sounding voice, OR-ed
+        bool underrun = false;     ///< the output reported an underrun during this block
+    };
+
+    /**
+     * Deadline and underrun telemetry of the audio task.
+     *
+     * Every block's render time is compared with its budget (the time the
+     * block takes to play). The audio task is the only writer; counters are
+     * relaxed atomics and the late-block history is guarded by a sequence
+     * counter, so any task can query without locking the audio path.
+     */
+    class XrunMonitor
+    {
+    public:
+        /// Late blocks kept by recentLateBlocks()
+        static constexpr size_t HISTORY = 16;
+
+        /// Audio task: account for one finished block. `underruns` is the
+        /// output's running underrun count (AudioOutput::underrunCount()).
+        void commit(uint32_t renderCycles, uint32_t budgetCycles, uint8_t voices, uint8_t oscillators,
+                    uint8_t features, uint32_t underruns);
+
+        uint32_t getBlocks() const { return blocks.load(std::memory_order_relaxed); }
+        uint32_t getLateBlocks() const { return lateBlocks.load(std::memory_order_relaxed); }
+        uint32_t getUnderruns() const { return underrunTotal.load(std::memory_order_relaxed); }
+
+        /// Budget minus render time of the last block and the smallest seen;
+        /// negative values are late blocks
+        int32_t getLastSlack() const { return lastSlack.load(std::memory_order_relaxed); }
+        int32_t getWorstSlack() const { return worstSlack.load(std::memory_order_relaxed); }
+
+        /// Copy up to `max` recorded late blocks into `out`, newest first;
+        /// returns the number copied
+        size_t recentLateBlocks(LateBlock *out, size_t max) const;
+
+        /// Any task: zero the counters and history before the next commit
+        void requestReset() { resetRequested.store(true, std::memory_order_relaxed); }
+
+        /// Log the counters and the recent late blocks with ESP_LOGI/ESP_LOGW
+        void log(const char *tag) const;
+
+    private:
+        struct Slot
+        {
+            std::atomic<uint32_t> block{0};
+            std::atomic<uint32_t> renderCycles{0};
+            std::atomic<uint32_t> packed{0}; ///< voices | oscillators << 8 | features << 16 | underrun << 24
+        };
+
+        std::atomic<uint32_t> blocks{0};
+        std::atomic<uint32_t> lateBlocks{0};
+        std::atomic<uint32_t> underrunTotal{0};
+        std::atomic<int32_t> lastSlack{0};
+        std::atomic<int32_t> worstSlack{INT32_MAX};
+
+        std::array<Slot, HISTORY> history;
+        std::atomic<uint32_t> recorded{0}; ///< late blocks ever recorded; next slot is recorded % HISTORY
+        std::atomic<uint32_t> sequence{0}; ///< odd while the writer updates the history
+
+        uint32_t lastUnderruns = 0;   ///< writer-private
+        bool underrunsSeeded = false; ///< writer-private
+        std::atomic<bool> resetRequested{false};
+
+        void record(const LateBlock &late);
+    };
+} // namespace sound_module
@@ -0,0 +1,37 @@
+#include "arena.hpp"
+#include <cstdlib>
+#include "esp_log.h"
+#include "platform.hpp"
+
+#define TAG "Arena"
+
+using namespace sound_module;
+
+Arena::Arena(size_t bytes)
+    : memory(static_cast<uint8_t *>(platform::allocateAudioMemory(bytes))), capacity(bytes)
+{
+    if (!memory && bytes)
+    {
+        ESP_LOGE(TAG, "Cannot allocate %u bytes of audio memory", static_cast<unsigned>(bytes));
+        std::abort();
+    }
+    ESP_LOGI(TAG, "Audio arena of %u bytes", static_cast<unsigned>(bytes));
+}
+
+Arena::~Arena()
+{
+    platform::freeAudioMemory(memory);
+}
+
+void *Arena::take(size_t bytes)
+{
+    if (bytes > capacity - offset)
+    {
+        ESP_LOGE(TAG, "Arena exhausted: %u of %u bytes used, %u more requested",
+                 static_cast<unsigned>(offset), static_cast<unsigned>(capacity), static_cast<unsigned>(bytes));
+        std::abort();
+    }
+    void *block = memory + offset;
+    offset += bytes;
+    return block;
+}
@@ -0,0 +1,108 @@
+#include "mix_kernels.hpp"
+#include <algorithm>
+#include <cstring>
+#include "esp_attr.h"
+
+using namespace sound_module;
+
+namespace
+{
+    constexpr float INT16_LOW = -32768.0f;
+    constexpr float INT16_HIGH = 32767.0f;
+
+    inline int16_t saturate(float x)
+    {
+        return static_cast<int16_t>(std::clamp(x, INT16_LOW, INT16_HIGH));
+    }
+
+#if SOUND_MIX_SIMD
+    typedef float f32x4 __attribute__((vector_size(16)));
+    typedef int32_t i32x4 __attribute__((vector_size(16)));
+    typedef int16_t i16x4 __attribute__((vector_size(8)));
+    typedef int16_t i16x8 __attribute__((vector_size(16)));
+
+    // memcpy loads and stores: unaligned-safe, and compiled to single moves
+    inline f32x4 load(const float *p)
+    {
+        f32x4 v;
+        std::memcpy(&v, p, sizeof v);
+        return v;
+    }
+
+    inline i32x4 saturate(f32x4 x)
+    {
+        const f32x4 low = {INT16_LOW, INT16_LOW, INT16_LOW, INT16_LOW};
+        const f32x4 high = {INT16_HIGH, INT16_HIGH, INT16_HIGH, INT16_HIGH};
+        x = x < low ? low : x;
+        x = x > high ? high : x;
+        return __builtin_convertvector(x, i32x4);
+    }
+#endif
+}
+
+IRAM_ATTR void mix::accumulate(float *dst, const float *src, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        dst[i] += src[i];
+}
+
+IRAM_ATTR void mix::mixMono(float *L, float *R, const float *src, const float *gains, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        float y = src[i] * gains[i];
+        L[i] += y;
+        R[i] += y;
+    }
+}
+
+IRAM_ATTR void mix::scalar::convertInterleave(int16_t *out, const float *L, const float *R, const float *gains, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        out[2 * i] = saturate(L[i] * gains[i]);
+        out[2 * i + 1] = saturate(R[i] * gains[i]);
+    }
+}
+
+IRAM_ATTR void mix::rampGain(SmoothedGain &gain, float scale, float *gains, size_t n)
+{
+    if (gain.isSettled())
+    {
+        std::fill_n(gains, n, gain.current * scale);
+        return;
+    }
+    // One-pole recursion: each step needs the last, so this stays scalar.
+    // A local copy keeps `current` in a register; `gains` could alias it.
+    SmoothedGain ramp = gain;
+    for (size_t i = 0; i < n; ++i)
+        gains[i] = ramp.next() * scale;
+    gain.current = ramp.current;
+}
+
+#if SOUND_MIX_SIMD
+
+IRAM_ATTR void mix::convertInterleave(int16_t *out, const float *L, const float *R, const float *gains, size_t n)
+{
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        f32x4 g = load(gains + i);
+        f32x4 left = load(L + i) * g;
+        f32x4 right = load(R + i) * g;
+        i32x4 first = saturate(__builtin_shufflevector(left, right, 0, 4, 1, 5));
+        i32x4 second = saturate(__builtin_shufflevector(left, right, 2, 6, 3, 7));
+        i16x8 frames = __builtin_convertvector(__builtin_shufflevector(first, second, 0, 1, 2, 3, 4, 5, 6, 7), i16x8);
+        std::memcpy(out + 2 * i, &frames, sizeof frames);
+    }
+    scalar::convertInterleave(out + 2 * i, L + i, R + i, gains + i, n - i);
+}
+
+#else
+
+IRAM_ATTR void mix::convertInterleave(int16_t *out, const float *L, const float *R, const float *gains, size_t n)
+{
+    scalar::convertInterleave(out, L, R, gains, n);
+}
+
+#endif
@@ -1,31 +1,49 @@
 #include "oscillator.hpp"
 #include "protocol.hpp"
 #include "sine_table.hpp"
-#include "saw_tooth_table.hpp"
 #include "noise_table.hpp"
-#include "triangle_table.hpp"
-#include "square_table.hpp"
 #include "lookup.hpp"
+#include "mip_table.hpp"
 #include <cmath>
 #include <cstdlib>   // for std::rand, RAND_MAX
 #include "esp_log.h" // for std::rand, RAND_MAX
 #include <algorithm>
-#include "esp_timer.h" // for esp_timer_get_time()
+#include "platform.hpp" // for platform::timeUs()
 
 using namespace sound_module;
 using namespace protocol;
 #define TAG "Sound"
 
 Oscillator::Oscillator(uint32_t sample_rate, uint16_t initial_bpm)
-    : envelope(sample_rate, initial_bpm), sample_rate(sample_rate) {}
+    : envelope(sample_rate, initial_bpm), sample_rate(sample_rate),
+      phaseScale(PHASE_CYCLE / static_cast<float>(sample_rate))
+{
+    setPulseWidth(PWM_MIN);
+    pulseWidth = targetPulseWidth;
+}
+
+namespace
+{
+    uint64_t lastNoteOnUs = 0;
+
+    /// Note-on time that is strictly increasing, so two notes started in
+    /// the same microsecond still have an age order for voice stealing
+    uint64_t stampNoteOn()
+    {
+        uint64_t now = static_cast<uint64_t>(platform::timeUs());
+        lastNoteOnUs = now > lastNoteOnUs ? now : lastNoteOnUs + 1;
+        return lastNoteOnUs;
+    }
+}
 
 void Oscillator::noteOn(float frequency, uint8_t velocity_in, uint8_t midi_note_in)
 {
-    note_on_timestamp_us = esp_timer_get_time();
+    note_on_timestamp_us = stampNoteOn();
 
     // ESP_LOGD(TAG, "Sound trigger freq %f velocity %u note %u", frequency, velocity_in, midi_note);
     setVelocity(velocity_in);
-    phase = 0.0f;
+    phase = 0;
+    pulseWidth = targetPulseWidth; // no ramp on a fresh note
     active = true;
     midi_note = midi_note_in;
     envelope.gateOn();
@@ -38,71 +56,229 @@ void Oscillator::noteOff()
     envelope.gateOff();
 }
 
-void Oscillator::setFrequency(float frequency)
+void Oscillator::retrigger(uint8_t velocity_in)
 {
-    auto p = frequency / sample_rate;
-    if (p != phase_increment)
+    note_on_timestamp_us = stampNoteOn();
+    setVelocity(velocity_in);
+    active = true;
+    envelope.retrigger();
+}
+
+Oscillator::Tail Oscillator::steal(size_t fadeSamples)
+{
+    const float gain = currentLevel();
+    Tail tail;
+    if (gain > 0.0f && fadeSamples > 0)
     {
-        phase_increment = frequency / sample_rate;
-        // ESP_LOGI(TAG, "Pahse inncdement changed freq %f phase_increment %f", frequency, phase_increment);
+        tail.shape = shape;
+        tail.phase = phase;
+        tail.increment = phase_increment;
+        tail.pulseWidth = pulseWidth;
+        tail.gain = gain;
+        tail.step = -gain / static_cast<float>(fadeSamples);
+        tail.remaining = static_cast<uint32_t>(fadeSamples);
     }
+    active = false;
+    envelope.setToIdle();
+    return tail;
 }
 
-IRAM_ATTR float Oscillator::getSample()
+void Oscillator::setFrequency(float frequency)
 {
-    phase += phase_increment;
-    if (phase >= 1.0f)
-        phase -= 1.0f;
+    // Clamp to Nyquist so the float -> uint32 conversion can never overflow
+    float increment = std::clamp(frequency * phaseScale, 0.0f, PHASE_CYCLE * 0.5f);
+    phase_increment = static_cast<uint32_t>(increment);
+}
 
-    if (!active && envelope.is_idle())
-        return 0.0f;
-    // Generate raw samples for current and next waveform for morphing
-    auto generate_wave = [&](protocol::OscillatorShape wf)
+namespace
+{
+    // Branch-free inner loops, one per table kind
+    template <size_t N>
+    inline void renderTable(const std::array<float, N> &table, uint32_t &phase, uint32_t increment,
+                            const float *env, float gain, float *out, size_t n)
     {
-        switch (wf)
+        for (size_t i = 0; i < n; ++i)
         {
-        case protocol::OscillatorShape::Sine:
-            return interpolateLookup(phase, sineTable);
-        case protocol::OscillatorShape::Saw:
-        {
-            return interpolateLookup(phase, sawTable);
+            phase += increment;
+            out[i] += interpolatePhase(phase, table) * env[i] * gain;
         }
-        case protocol::OscillatorShape::Square:
+    }
+
+    inline void renderMip(const MipLevel &level, uint32_t &phase, uint32_t increment,
+                          const float *env, float gain, float *out, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
         {
-            int pwmIndex = std::clamp(
-                static_cast<int>(pwm * PWM_STEPS / 128),
-                0,
-                static_cast<int>(PWM_STEPS - 1));
-            float value = interpolateLookup(phase, pwmSquareTables[pwmIndex]);
+            phase += increment;
+            out[i] += interpolateMip(level, phase) * env[i] * gain;
+        }
+    }
 
-            return value;
+    /// Pulse with the width ramped linearly from `width` to `target` over the block
+    inline void renderPulse(const MipLevel &level, uint32_t &width, uint32_t target, uint32_t &phase, uint32_t increment,
+                            const float *env, float gain, float *out, size_t n)
+    {
+        const int32_t widthStep = static_cast<int32_t>((static_cast<int64_t>(target) - width) / static_cast<int64_t>(n));
+        const float dcScale = 2.0f / PHASE_CYCLE;
+        float dc = static_cast<float>(width) * dcScale - 1.0f;
+        const float dcStep = static_cast<float>(widthStep) * dcScale;
+        uint32_t w = width;
+        for (size_t i = 0; i < n; ++i)
+        {
+            phase += increment;
+            out[i] += interpolatePulse(level, phase, w, dc) * env[i] * gain;
+            w += static_cast<uint32_t>(widthStep);
+            dc += dcStep;
         }
-        case protocol::OscillatorShape::Tri:
-            return interpolateLookup(phase, triangleTable);
-        case protocol::OscillatorShape::Noise:
-            return interpolateLookup(phase, noiseTable);
+        width = target;
+    }
+
+    /// One span of SHAPE into `out`; the mip level is picked once per span.
+    /// Any other SHAPE (e.g. _Count) is silent and only runs the phase.
+    template <protocol::OscillatorShape SHAPE>
+    inline void renderShapeAs(uint32_t &phase, uint32_t increment, uint32_t &width, uint32_t targetWidth,
+                              const float *env, float gain, float *out, size_t n)
+    {
+        using S = protocol::OscillatorShape;
+        if constexpr (SHAPE == S::Sine)
+            renderTable(sineTable, phase, increment, env, gain, out, n);
+        else if constexpr (SHAPE == S::Saw)
+            renderMip(sawMipTable.forIncrement(increment), phase, increment, env, gain, out, n);
+        else if constexpr (SHAPE == S::Square)
+            renderPulse(sawMipTable.forIncrement(increment), width, targetWidth, phase, increment, env, gain, out, n);
+        else if constexpr (SHAPE == S::Tri)
+            renderMip(triangleMipTable.forIncrement(increment), phase, increment, env, gain, out, n);
+        else if constexpr (SHAPE == S::Noise)
+            renderTable(noiseTable, phase, increment, env, gain, out, n);
+        else
+            phase += increment * static_cast<uint32_t>(n);
+    }
+
+    inline void renderShape(protocol::OscillatorShape shape, uint32_t &phase, uint32_t increment,
+                            uint32_t &width, uint32_t targetWidth, const float *env, float gain, float *out, size_t n)
+    {
+        using S = protocol::OscillatorShape;
+        switch (shape)
+        {
+        case S::Sine:
+            return renderShapeAs<S::Sine>(phase, increment, width, targetWidth, env, gain, out, n);
+        case S::Saw:
+            return renderShapeAs<S::Saw>(phase, increment, width, targetWidth, env, gain, out, n);
+        case S::Square:
+            return renderShapeAs<S::Square>(phase, increment, width, targetWidth, env, gain, out, n);
+        case S::Tri:
+            return renderShapeAs<S::Tri>(phase, increment, width, targetWidth, env, gain, out, n);
+        case S::Noise:
+            return renderShapeAs<S::Noise>(phase, increment, width, targetWidth, env, gain, out, n);
         default:
-            return 0.0f;
+            return renderShapeAs<S::_Count>(phase, increment, width, targetWidth, env, gain, out, n);
+        }
+    }
+}
+
+IRAM_ATTR void Oscillator::renderBlock(float *out, size_t n, BlockProfile *profile)
+{
+    using S = protocol::OscillatorShape;
+    switch (shape)
+    {
+    case S::Sine:
+        return renderBlockKernel<S::Sine>(out, n, profile);
+    case S::Saw:
+        return renderBlockKernel<S::Saw>(out, n, profile);
+    case S::Square:
+        return renderBlockKernel<S::Square>(out, n, profile);
+    case S::Tri:
+        return renderBlockKernel<S::Tri>(out, n, profile);
+    case S::Noise:
+        return renderBlockKernel<S::Noise>(out, n, profile);
+    default:
+        return renderBlockKernel<S::_Count>(out, n, profile);
+    }
+}
+
+template <protocol::OscillatorShape SHAPE>
+IRAM_ATTR void Oscillator::renderBlockAs(float *out, size_t n, BlockProfile *profile)
+{
+    if (shape == SHAPE)
+        renderBlockKernel<SHAPE>(out, n, profile);
+    else
+        renderBlock(out, n, profile);
+}
+
+template void Oscillator::renderBlockAs<protocol::OscillatorShape::Sine>(float *, size_t, BlockProfile *);
+template void Oscillator::renderBlockAs<protocol::OscillatorShape::Tri>(float *, size_t, BlockProfile *);
+template void Oscillator::renderBlockAs<protocol::OscillatorShape::Square>(float *, size_t, BlockProfile *);
+template void Oscillator::renderBlockAs<protocol::OscillatorShape::Saw>(float *, size_t, BlockProfile *);
+template void Oscillator::renderBlockAs<protocol::OscillatorShape::Noise>(float *, size_t, BlockProfile *);
+
+template <protocol::OscillatorShape SHAPE>
+IRAM_ATTR void Oscillator::renderBlockKernel(float *out, size_t n, BlockProfile *profile)
+{
+    if (!active && envelope.is_idle())
+    {
+        // Keep the phase running while silent, as if the note still played
+        phase += phase_increment * static_cast<uint32_t>(n);
+        return;
+    }
+
+    // Envelope levels are rendered span by span and folded in by the shape kernel
+    float env[MAX_BLOCK];
+    while (n > 0)
+    {
+        const size_t span = std::min(n, MAX_BLOCK);
+        if (profile)
+        {
+            StageTimer timer(*profile, Stage::Envelope);
+            envelope.renderBlock(env, span);
+        }
+        else
+        {
+            envelope.renderBlock(env, span);
         }
-        return 0.0f;
-    };
 
-    auto waveform = generate_wave(shape);
+        renderShapeAs<SHAPE>(phase, phase_increment, pulseWidth, targetPulseWidth, env, velNorm, out, span);
+        out += span;
+        n -= span;
+    }
+}
 
-    // return waveform;
-    return waveform * envelope.next();
+IRAM_ATTR void Oscillator::renderTail(Tail &tail, float *out, size_t n)
+{
+    n = std::min<size_t>(n, tail.remaining);
+    tail.remaining -= static_cast<uint32_t>(n);
+
+    float ramp[MAX_BLOCK];
+    while (n > 0)
+    {
+        const size_t span = std::min(n, MAX_BLOCK);
+        for (size_t i = 0; i < span; ++i)
+        {
+            ramp[i] = std::max(tail.gain, 0.0f);
+            tail.gain += tail.step;
+        }
+        renderShape(tail.shape, tail.phase, tail.increment, tail.pulseWidth, tail.pulseWidth, ramp, 1.0f, out, span);
+        out += span;
+        n -= span;
+    }
 }
 
 void Oscillator::setShape(protocol::OscillatorShape newShape)
 {
     shape = newShape;
     // restart waveform on shape change
-    phase = 0.0f;
+    phase = 0;
 }
 
 void Oscillator::setPwm(uint8_t newPwm)
 {
-    pwm = newPwm;
+    // Same 0–127 scale the stepped tables used, now without the 19-step snapping
+    setPulseWidth(PWM_MIN + (static_cast<float>(newPwm) / 127.0f) * (PWM_MAX - PWM_MIN));
+}
+
+void Oscillator::setPulseWidth(float width)
+{
+    width = std::clamp(width, PWM_MIN, PWM_MAX);
+    targetPulseWidth = static_cast<uint32_t>(width * PHASE_CYCLE);
 }
 
 void Oscillator::setVelocity(uint8_t velocity)
@@ -0,0 +1,61 @@
+#include "oscillator_pool.hpp"
+#include <algorithm>
+#include <new>
+#include "esp_attr.h"
+#include "esp_log.h"
+
+#define TAG "OscillatorPool"
+
+using namespace sound_module;
+
+OscillatorPool::OscillatorPool(Arena &arena, size_t capacity, uint32_t sampleRate, uint16_t initialBpm)
+    : storage{arena.allocate<Oscillator>(capacity), capacity}, maxInUse(capacity)
+{
+    for (auto &osc : storage)
+    {
+        new (&osc) Oscillator(sampleRate, initialBpm);
+    }
+    // Link back to front so the first oscillator is handed out first
+    for (size_t i = capacity; i-- > 0;)
+    {
+        release(&storage[i]);
+    }
+}
+
+OscillatorPool::~OscillatorPool()
+{
+    for (auto &osc : storage)
+    {
+        osc.~Oscillator();
+    }
+}
+
+void OscillatorPool::setLimit(size_t limit)
+{
+    maxInUse = std::clamp<size_t>(limit, 1, capacity());
+}
+
+IRAM_ATTR Oscillator *OscillatorPool::acquire()
+{
+    Oscillator *osc = freeHead;
+    if (!osc || inUse() >= maxInUse)
+        return nullptr;
+    freeHead = osc->nextFree;
+    osc->nextFree = nullptr;
+    osc->pooled = false;
+    --freeCount;
+    return osc;
+}
+
+IRAM_ATTR void OscillatorPool::release(Oscillator *osc)
+{
+    if (osc->pooled)
+    {
+        ESP_LOGE(TAG, "Oscillator released twice");
+        return;
+    }
+    osc->pooled = true;
+    osc->nextFree = freeHead;
+    freeHead = osc;
+    ++freeCount;
+}
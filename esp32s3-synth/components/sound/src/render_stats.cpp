@@ -0,0 +1,159 @@
+#include "render_stats.hpp"
+#include <algorithm>
+#include "esp_log.h"
+#include "esp_attr.h"
+
+using namespace sound_module;
+
+const char *sound_module::stageName(Stage stage)
+{
+    switch (stage)
+    {
+    case Stage::EventDrain:
+        return "events";
+    case Stage::Oscillators:
+        return "oscillators";
+    case Stage::Envelope:
+        return "envelope";
+    case Stage::Filter:
+        return "filter";
+    case Stage::Mix:
+        return "mix";
+    case Stage::Convert:
+        return "convert";
+    case Stage::HelperWait:
+        return "helper wait";
+    case Stage::OutputWait:
+        return "output wait";
+    case Stage::Render:
+        return "render";
+    default:
+        return "?";
+    }
+}
+
+size_t RenderStats::bucketOf(uint32_t cycles)
+{
+    if (cycles < 4)
+        return cycles;
+    // Octave from the top set bit, then the two bits below it pick the quarter
+    unsigned msb = 31 - __builtin_clz(cycles);
+    unsigned quarter = (cycles >> (msb - 2)) & 3u;
+    return (msb - 1) * 4 + quarter;
+}
+
+uint32_t RenderStats::bucketUpperBound(size_t bucket)
+{
+    if (bucket < 4)
+        return static_cast<uint32_t>(bucket);
+    unsigned msb = static_cast<unsigned>(bucket / 4) + 1;
+    uint64_t lower = static_cast<uint64_t>(4 + bucket % 4) << (msb - 2);
+    uint64_t upper = lower + (1ull << (msb - 2)) - 1;
+    return static_cast<uint32_t>(std::min<uint64_t>(upper, UINT32_MAX));
+}
+
+IRAM_ATTR void RenderStats::Histogram::record(uint32_t cycles)
+{
+    uint32_t n = blocks.load(std::memory_order_relaxed) + 1;
+    total += cycles;
+    counts[bucketOf(cycles)].fetch_add(1, std::memory_order_relaxed);
+    if (cycles < min.load(std::memory_order_relaxed))
+        min.store(cycles, std::memory_order_relaxed);
+    if (cycles > max.load(std::memory_order_relaxed))
+        max.store(cycles, std::memory_order_relaxed);
+    avg.store(static_cast<uint32_t>(total / n), std::memory_order_relaxed);
+    blocks.store(n, std::memory_order_relaxed);
+}
+
+void RenderStats::Histogram::clear()
+{
+    blocks.store(0, std::memory_order_relaxed);
+    min.store(UINT32_MAX, std::memory_order_relaxed);
+    max.store(0, std::memory_order_relaxed);
+    avg.store(0, std::memory_order_relaxed);
+    for (auto &count : counts)
+        count.store(0, std::memory_order_relaxed);
+    total = 0;
+}
+
+IRAM_ATTR void RenderStats::commit(const BlockProfile &profile, size_t activeOscillators)
+{
+    if (resetRequested.exchange(false, std::memory_order_relaxed))
+    {
+        for (auto &stage : stages)
+            stage.clear();
+        for (auto &load : loadByOscillators)
+        {
+            load.avg.store(0, std::memory_order_relaxed);
+            load.total = 0;
+            load.blocks = 0;
+        }
+    }
+
+    for (size_t i = 0; i < STAGE_COUNT; ++i)
+        stages[i].record(profile.cycles[i]);
+
+    auto &load = loadByOscillators[std::min(activeOscillators, MAX_TRACKED_OSCILLATORS)];
+    load.total += profile.get(Stage::Render);
+    ++load.blocks;
+    load.avg.store(static_cast<uint32_t>(load.total / load.blocks), std::memory_order_relaxed);
+}
+
+StageSummary RenderStats::summary(Stage stage) const
+{
+    const Histogram &h = stages[static_cast<size_t>(stage)];
+    StageSummary s;
+    s.blocks = h.blocks.load(std::memory_order_relaxed);
+    if (s.blocks == 0)
+        return s;
+    s.min = h.min.load(std::memory_order_relaxed);
+    s.max = h.max.load(std::memory_order_relaxed);
+    s.avg = h.avg.load(std::memory_order_relaxed);
+
+    std::array<uint32_t, BUCKETS> counts;
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKETS; ++i)
+    {
+        counts[i] = h.counts[i].load(std::memory_order_relaxed);
+        seen += counts[i];
+    }
+
+    // Walk the buckets once, filling each percentile as its rank is passed
+    const uint64_t ranks[] = {(seen * 50 + 99) / 100, (seen * 90 + 99) / 100, (seen * 99 + 99) / 100};
+    uint32_t *targets[] = {&s.p50, &s.p90, &s.p99};
+    uint64_t cumulative = 0;
+    size_t next = 0;
+    for (size_t i = 0; i < BUCKETS && next < 3; ++i)
+    {
+        cumulative += counts[i];
+        while (next < 3 && cumulative >= ranks[next] && cumulative > 0)
+            *targets[next++] = std::clamp(bucketUpperBound(i), s.min, s.max);
+    }
+    return s;
+}
+
+uint32_t RenderStats::renderAvgByOscillators(size_t count) const
+{
+    return loadByOscillators[std::min(count, MAX_TRACKED_OSCILLATORS)].avg.load(std::memory_order_relaxed);
+}
+
+void RenderStats::log(const char *tag) const
+{
+    const uint32_t budgetCycles = getBudget();
+    const double toUs = 1e6 / platform::cycleFrequencyHz();
+    for (size_t i = 0; i < STAGE_COUNT; ++i)
+    {
+        StageSummary s = summary(static_cast<Stage>(i));
+        if (s.blocks == 0)
+            continue;
+        ESP_LOGI(tag, "%-11s avg %7.1f us  p50 %7.1f  p90 %7.1f  p99 %7.1f  max %7.1f  (%4.1f%% of block)",
+                 stageName(static_cast<Stage>(i)), s.avg * toUs, s.p50 * toUs, s.p90 * toUs, s.p99 * toUs, s.max * toUs,
+                 budgetCycles ? 100.0 * s.avg / budgetCycles : 0.0);
+    }
+    for (size_t count = 0; count <= MAX_TRACKED_OSCILLATORS; ++count)
+    {
+        uint32_t avg = renderAvgByOscillators(count);
+        if (avg && budgetCycles)
+            ESP_LOGI(tag, "%2u oscillators: render %4.1f%% of block", static_cast<unsigned>(count), 100.0 * avg / budgetCycles);
+    }
+}
@@ -1,127 +1,578 @@
 // sound_module.cpp
 
 #include <esp_log.h>
-#include <driver/i2s_std.h>
-#include <freertos/FreeRTOS.h>
-#include <freertos/task.h>
-#include <esp_timer.h>
+#include <algorithm>
+#include <new>
 #include "sound_module.hpp"
+#include "platform.hpp"
+#include "mix_kernels.hpp"
 
 #define TAG "SOUND_MODULE"
 
 using namespace sound_module;
 using namespace midi_module;
 
-SoundModule::SoundModule(const SoundConfig &config)
-    : config(config), buffer(config.bufferSize * 2)
+SoundConfig SoundModule::withCapacities(const SoundConfig &config)
 {
+    SoundConfig sized = config;
+    // Note dispatch keeps one bit per voice
+    sized.voiceCapacity = std::clamp<size_t>(std::max(config.voiceCapacity, config.numVoices), 1, ChannelMap::MAX_VOICES);
+    sized.polyphonyCapacity = std::max<uint8_t>({config.polyphonyCapacity, config.maxPoliphony, 1});
+    sized.allowPipelined = config.allowPipelined || config.renderMode == RenderMode::Pipelined;
+    return sized;
+}
+
+size_t SoundModule::arenaBytes(const SoundConfig &config)
+{
+    const SoundConfig sized = withCapacities(config);
+    size_t bytes = Arena::footprint<Oscillator>(sized.polyphonyCapacity) +
+                   Arena::footprint<Voice>(sized.voiceCapacity) +
+                   sized.voiceCapacity * Arena::footprint<Oscillator *>(sized.polyphonyCapacity) +
+                   Arena::footprint<int16_t>(config.bufferSize * 2) +
+                   3 * Arena::footprint<float>(config.bufferSize) +
+                   2 * Arena::footprint<Voice *>(sized.voiceCapacity) +
+                   2 * Arena::footprint<float>(config.bufferSize);
+    if (sized.allowPipelined)
+    {
+        bytes += 2 * (Arena::footprint<float>(sized.voiceCapacity * config.bufferSize) +
+                      Arena::footprint<uint8_t>(sized.voiceCapacity * MAX_SEGMENTS) +
+                      Arena::footprint<PipeSegment>(MAX_SEGMENTS)) +
+                 2 * Arena::footprint<SynthEvent>(EVENT_QUEUE_CAPACITY);
+    }
+    return bytes;
+}
 
-    oscillatorPool.reserve(config.maxPoliphony);
-    for (size_t i = 0; i < config.maxPoliphony; ++i)
+SoundModule::SoundModule(const SoundConfig &config, platform::AudioOutput &output)
+    : config(withCapacities(config)), output(output),
+      arena(arenaBytes(config)),
+      pool(arena, this->config.polyphonyCapacity, config.sampleRate, state.settingsBpm),
+      stealPolicy(config.stealPolicy),
+      stealFadeSamples(static_cast<size_t>(STEAL_FADE_SECONDS * config.sampleRate)),
+      renderMode(config.renderMode),
+      buffer(arena.allocate<int16_t>(config.bufferSize * 2)),
+      mixLeft(arena.allocate<float>(config.bufferSize)),
+      mixRight(arena.allocate<float>(config.bufferSize)),
+      masterGains(arena.allocate<float>(config.bufferSize))
+{
+    const size_t capacity = this->config.voiceCapacity;
+    if (capacity < std::max(config.voiceCapacity, config.numVoices))
+        ESP_LOGE(TAG, "%u voices requested, limited to %u",
+                 static_cast<unsigned>(std::max(config.voiceCapacity, config.numVoices)), static_cast<unsigned>(capacity));
+
+    voices = {arena.allocate<Voice>(capacity), capacity};
+    for (size_t i = 0; i < capacity; ++i)
     {
-        oscillatorPool.emplace_back(config.sampleRate, state.settingsBpm); // ✅ safe and direct
+        new (&voices[i]) Voice(i, config.sampleRate, i, state.settingsBpm, pool, channels, arena);
     }
+    setVoiceCount(config.numVoices);
+    setPolyphony(config.maxPoliphony);
 
-    voices.reserve(config.numVoices);
+    ownVoices = {arena.allocate<Voice *>(capacity), 0};
+    splitVoices = {arena.allocate<Voice *>(capacity), 0};
+    splitLeft = arena.allocate<float>(config.bufferSize);
+    splitRight = arena.allocate<float>(config.bufferSize);
 
-    for (size_t i = 0; i < config.numVoices; ++i)
+    if (this->config.allowPipelined)
     {
-        voices.emplace_back(i, config.sampleRate, i, state.settingsBpm);
+        for (auto &block : pipe)
+        {
+            block.source = arena.allocate<float>(capacity * config.bufferSize);
+            block.active = arena.allocate<uint8_t>(capacity * MAX_SEGMENTS);
+            block.segments = arena.allocate<PipeSegment>(MAX_SEGMENTS);
+        }
+        pipeNotes = {arena.allocate<SynthEvent>(EVENT_QUEUE_CAPACITY), 0};
+        pipeParams = {arena.allocate<SynthEvent>(EVENT_QUEUE_CAPACITY), 0};
+    }
+
+    // One block's worth of cycles is the deadline every stage shares
+    stats.setBudget(static_cast<uint32_t>(static_cast<uint64_t>(config.bufferSize) * platform::cycleFrequencyHz() / config.sampleRate));
+}
+
+SoundModule::~SoundModule()
+{
+    // The helper may still be rendering sources into the voices
+    if (pipeBusy)
+        worker.wait();
+    for (auto &voice : voices)
+    {
+        voice.~Voice();
+    }
+}
+
+void SoundModule::setVoiceCount(size_t count)
+{
+    voiceCount = std::clamp<size_t>(count, 1, voices.size());
+    for (size_t i = 0; i < voices.size(); ++i)
+    {
+        voices[i].setEnabled(i < voiceCount);
     }
 }
 
 void SoundModule::init()
 {
-    // Step 1: Create I2S TX channel
-    i2s_chan_config_t tx_chan_cfg = I2S_CHANNEL_DEFAULT_CONFIG(I2S_NUM_AUTO, I2S_ROLE_MASTER);
-    ESP_ERROR_CHECK(i2s_new_channel(&tx_chan_cfg, &txChan, nullptr));
-
-    // Step 2: Configure TX for standard I2S mode
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
-    i2s_std_config_t tx_std_cfg = {
-        .clk_cfg = I2S_STD_CLK_DEFAULT_CONFIG(config.sampleRate),
-        .slot_cfg = I2S_STD_PHILIPS_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_STEREO),
-        .gpio_cfg = {
-            .mclk = I2S_GPIO_UNUSED,
-            .bclk = config.i2s.bclk_io,
-            .ws = config.i2s.lrclk_io,
-            .dout = config.i2s.data_io,
-            .din = I2S_GPIO_UNUSED,
-            .invert_flags = {false, false, false},
-        },
-    };
-#pragma GCC diagnostic pop
-
-    ESP_ERROR_CHECK(i2s_channel_init_std_mode(txChan, &tx_std_cfg));
-    ESP_ERROR_CHECK(i2s_channel_enable(txChan));
-
-    // Step 3: Launch audio task pinned to core 1
-    if (audioTask == nullptr)
-    {
-        xTaskCreatePinnedToCore(
+    // Step 1: Bring up the audio output (I2S on target)
+    output.init(config.sampleRate);
+
+    // Step 2: Launch audio task pinned to core 1
+    if (!audioTaskStarted)
+    {
+        audioTaskStarted = platform::startTask(
             audio_task_entry,
             "audio_task",
             8192 * 16,
             this,
-            configMAX_PRIORITIES - 1,
-            &audioTask,
+            platform::maxTaskPriority(),
             1 // core 1
         );
     }
 }
 
-void SoundModule::handle_note(const MidiNoteEvent &msg)
+void SoundModule::handle_note(const MidiNoteEvent &msg, uint64_t frame)
 {
-    std::lock_guard<std::mutex> lock(activeOscillatorsMutex); // 🔒 lock
+    SynthEvent event{};
+    event.type = SynthEventType::Note;
+    event.note = msg;
+    event.frame = frame;
+    post(event);
+}
 
-    for (auto &voice : voices)
+uint64_t SoundModule::frameForTime(int64_t timeUs) const
+{
+    int64_t origin = clockOriginUs.load(std::memory_order_relaxed);
+    if (origin == INT64_MIN || timeUs < origin)
+        return 0; // audio not running yet: apply as soon as possible
+    uint64_t frame = static_cast<uint64_t>(timeUs - origin) * config.sampleRate / 1'000'000;
+    return frame + config.bufferSize;
+}
+
+uint64_t SoundModule::stampFrame() const
+{
+    return frameForTime(platform::timeUs());
+}
+
+bool SoundModule::post(SynthEvent event)
+{
+    if (event.frame == SynthEvent::NOW)
+        event.frame = stampFrame();
+
+    if (events.push(event))
+        return true;
+    ESP_LOGW(TAG, "Event queue full, dropping event type %d", static_cast<int>(event.type));
+    return false;
+}
+
+IRAM_ATTR void SoundModule::drainEvents(uint64_t upToFrame)
+{
+    SynthEvent event;
+    for (auto *next = events.peek(); next && next->frame <= upToFrame; next = events.peek())
+    {
+        events.pop(event);
+        if (event.type == SynthEventType::Note)
+            applyNote(event.note);
+        else if (eventHandler)
+            eventHandler(event);
+    }
+}
+
+/// Pipelined, between blocks: parameters held back from the block sourced
+/// last time apply now, before that block is filtered
+IRAM_ATTR void SoundModule::applyPipelineParams()
+{
+    if (eventHandler)
+    {
+        for (const auto &event : pipeParams)
+            eventHandler(event);
+    }
+    pipeParams.count = 0;
+}
+
+/// Pipelined: notes up to `upToFrame` are kept for the helper so they still
+/// land on their exact frame. Parameters due by the start of the block being
+/// sourced apply now; later ones wait for applyPipelineParams(), so the
+/// block filtered meanwhile does not hear changes from the block after it.
+IRAM_ATTR void SoundModule::drainPipelineEvents(uint64_t upToFrame)
+{
+    pipeNotes.count = 0;
+    SynthEvent event;
+    for (auto *next = events.peek(); next && next->frame <= upToFrame; next = events.peek())
+    {
+        events.pop(event);
+        if (event.type == SynthEventType::Note)
+            pipeNotes.first[pipeNotes.count++] = event;
+        else if (event.frame > renderedFrames)
+            pipeParams.first[pipeParams.count++] = event;
+        else if (eventHandler)
+            eventHandler(event);
+    }
+}
+
+void SoundModule::applyNote(const MidiNoteEvent &msg)
+{
+    // Only the voices listening on the channel see the note
+    for (ChannelMap::VoiceMask mask = channels.voicesOn(msg.channel()); mask; mask &= mask - 1)
     {
+        Voice &voice = voices[__builtin_ctz(mask)];
         if (msg.isNoteOn())
         {
-            auto *activeSound = allocateSound();
-            if (activeSound)
+            if (!voice.isAudible() || voice.retrigger(msg.note, msg.velocity))
+                continue;
+
+            Oscillator *sound = pool.acquire();
+            if (!sound)
+                sound = stealOscillator(msg.note);
+            if (sound)
+                voice.noteOn(sound, msg.note, msg.velocity);
+        }
+        else if (msg.isNoteOff())
+            voice.noteOff(msg.note);
+    }
+}
+
+namespace
+{
+    /// Stealing order between two sounding oscillators under `policy`
+    bool isBetterVictim(StealPolicy policy, uint8_t midi_note, Oscillator *candidate, Oscillator *current)
+    {
+        if (policy == StealPolicy::SameNote)
+        {
+            bool candidateSame = candidate->midi_note == midi_note;
+            if (candidateSame != (current->midi_note == midi_note))
+                return candidateSame;
+        }
+        if (policy == StealPolicy::Quietest)
+            return candidate->currentLevel() < current->currentLevel();
+        return candidate->getTimestamp() < current->getTimestamp();
+    }
+}
+
+Oscillator *SoundModule::stealOscillator(uint8_t midi_note)
+{
+    const StealPolicy policy = stealPolicy.load(std::memory_order_relaxed);
+    if (policy == StealPolicy::None)
+        return nullptr;
+
+    Voice *owner = nullptr;
+    Oscillator *victim = nullptr;
+    for (auto &voice : voices)
+    {
+        for (size_t i = 0; i < voice.activeOscillatorCount(); ++i)
+        {
+            Oscillator *candidate = voice.activeOscillator(i);
+            if (!victim || isBetterVictim(policy, midi_note, candidate, victim))
             {
-                voice.noteOn(activeSound, msg.channel(), msg.note, msg.velocity);
+                owner = &voice;
+                victim = candidate;
             }
-           
         }
-        else if (msg.isNoteOff())
-            voice.noteOff(msg.channel(), msg.note);
     }
+    if (!victim)
+        return nullptr;
+
+    // The old sound fades out on its own voice instead of cutting off
+    owner->detach(victim, stealFadeSamples);
+    return victim;
 }
-IRAM_ATTR void SoundModule::process()
+
+IRAM_ATTR void SoundModule::render(int16_t *interleaved, size_t num_samples)
 {
-    size_t num_samples = config.bufferSize;
+    const uint32_t renderStart = platform::cycleCount();
+    profile = {};
 
+    // Publish where frame 0 sits on the platform clock for post()
+    int64_t originUs = platform::timeUs() - static_cast<int64_t>(renderedFrames * 1'000'000 / config.sampleRate);
+    clockOriginUs.store(originUs, std::memory_order_relaxed);
+
+    RenderMode mode = renderMode.load(std::memory_order_relaxed);
+    if (mode != RenderMode::SingleCore && !startWorker())
+        mode = RenderMode::SingleCore;
+
+    int16_t volume = pendingMasterVolume.exchange(-1, std::memory_order_relaxed);
+    if (volume >= 0)
+        setSmoothedGain(state.volumeSettings, static_cast<uint8_t>(volume), 255, MIN_DB);
+
+    for (size_t offset = 0; offset < num_samples; offset += config.bufferSize)
     {
-        std::lock_guard<std::mutex> lock(activeOscillatorsMutex); // 🔒 protect voices
-        for (size_t i = 0; i < num_samples; ++i)
+        size_t n = std::min(config.bufferSize, num_samples - offset);
+
+        // A block still in the pipeline plays out before another mode takes over
+        if (mode == RenderMode::Pipelined || pipeBusy)
         {
-            float volumeScale = state.volumeSettings.gain_smoothed.next();
+            renderPipelined(interleaved + 2 * offset, n, mode == RenderMode::Pipelined);
+            continue;
+        }
 
-            float mixLeft = 0.0f;
-            float mixRight = 0.0f;
+        std::fill_n(mixLeft, n, 0.0f);
+        std::fill_n(mixRight, n, 0.0f);
 
-            for (auto &voice : voices)
+        // Split the block at event boundaries; everything that touches
+        // voice state runs here, on the audio task
+        size_t pos = 0;
+        while (pos < n)
+        {
+            // Reap before the notes come in, so a note finds the oscillators
+            // that fell silent last segment in the pool instead of stealing
+            reapOscillators(profile);
             {
-                auto sample = voice.getSample(); // mono float
+                StageTimer timer(profile, Stage::EventDrain);
+                drainEvents(renderedFrames + pos);
+            }
+
+            size_t end = n;
+            if (auto *next = events.peek())
+                end = std::min<uint64_t>(n, next->frame - renderedFrames);
 
-                if (sample.left != 0.0f || sample.right != 0.0f)
+            renderVoices(pos, end - pos, mode);
+            pos = end;
+        }
+        renderedFrames += n;
+        measureLoad();
+        convert(interleaved + 2 * offset, n);
+    }
+    profile.add(Stage::Render, platform::cycleCount() - renderStart);
+}
+
+IRAM_ATTR void SoundModule::convert(int16_t *interleaved, size_t n)
+{
+    StageTimer timer(profile, Stage::Convert);
+    mix::rampGain(state.volumeSettings.gain_smoothed, config.amplitude, masterGains, n);
+    mix::convertInterleave(interleaved, mixLeft, mixRight, masterGains, n);
+}
+
+/**
+ * One Pipelined block: collect the sources the helper rendered last time,
+ * hand it the next block (unless `refill` is false, which drains the
+ * pipeline), then filter, mix and convert the collected one. Voice state is
+ * only touched here while the helper is idle; the filter and voice gain that
+ * the audio task runs afterwards are never touched by the helper.
+ */
+IRAM_ATTR void SoundModule::renderPipelined(int16_t *interleaved, size_t n, bool refill)
+{
+    PipeBlock *ready = nullptr;
+    if (pipeBusy)
+    {
+        StageTimer timer(profile, Stage::HelperWait);
+        worker.wait();
+        pipeBusy = false;
+        ready = &pipe[pipeFill];
+        pipeFill ^= 1;
+    }
+    measureLoad();
+
+    {
+        StageTimer timer(profile, Stage::EventDrain);
+        applyPipelineParams();
+        if (refill)
+            drainPipelineEvents(renderedFrames + n - 1);
+    }
+
+    if (refill)
+    {
+        pipeFrame = renderedFrames;
+        pipe[pipeFill].frames = n;
+        workerJob = WorkerJob::Sources;
+        worker.run();
+        pipeBusy = true;
+        renderedFrames += n;
+    }
+
+    // The block that fills the pipeline is silence; the master gain ramp is
+    // kept for the first block with sound
+    if (!ready)
+    {
+        std::fill_n(interleaved, 2 * n, int16_t{0});
+        return;
+    }
+
+    std::fill_n(mixLeft, n, 0.0f);
+    std::fill_n(mixRight, n, 0.0f);
+    {
+        const size_t frames = std::min(n, ready->frames);
+        for (size_t v = 0; v < voices.size(); ++v)
+        {
+            float *source = ready->source + v * config.bufferSize;
+            const uint8_t *active = ready->active + v * MAX_SEGMENTS;
+            for (size_t s = 0; s < ready->segmentCount; ++s)
+            {
+                const PipeSegment &segment = ready->segments[s];
+                if (active[s] && segment.offset < frames)
                 {
-                    mixLeft += sample.left;
-                    mixRight += sample.right;
+                    voices[v].renderPostBlock(source + segment.offset, mixLeft + segment.offset,
+                                              mixRight + segment.offset, std::min<size_t>(segment.frames, frames - segment.offset),
+                                              profile);
                 }
             }
-            int16_t intLeft = static_cast<int16_t>(mixLeft * config.amplitude * volumeScale);
-            int16_t intRight = static_cast<int16_t>(mixRight * config.amplitude * volumeScale);
+        }
+    }
+    convert(interleaved, n);
+}
 
-            buffer[2 * i] = intLeft;
-            buffer[2 * i + 1] = intRight;
+/// Helper task: notes, reaping and the source half of every voice for the
+/// block at pipeFrame, into pipe[pipeFill]
+IRAM_ATTR void SoundModule::renderSources()
+{
+    helperProfile = {};
+    PipeBlock &block = pipe[pipeFill];
+    block.segmentCount = 0;
+
+    size_t next = 0, pos = 0;
+    while (pos < block.frames)
+    {
+        reapOscillators(helperProfile);
+        {
+            StageTimer timer(helperProfile, Stage::EventDrain);
+            for (; next < pipeNotes.size() && pipeNotes[next].frame <= pipeFrame + pos; ++next)
+                applyNote(pipeNotes[next].note);
         }
+
+        size_t end = block.frames;
+        if (next < pipeNotes.size())
+            end = std::min<uint64_t>(end, pipeNotes[next].frame - pipeFrame);
+
+        const size_t s = block.segmentCount++;
+        block.segments[s] = {static_cast<uint16_t>(pos), static_cast<uint16_t>(end - pos)};
+        for (size_t v = 0; v < voices.size(); ++v)
+        {
+            Voice &voice = voices[v];
+            block.active[v * MAX_SEGMENTS + s] =
+                voice.needsRender() &&
+                voice.renderSourceBlock(block.source + v * config.bufferSize + pos, end - pos, pipeFrame + pos, helperProfile);
+        }
+        pos = end;
     }
-    size_t bytes_written;
-    i2s_channel_write(txChan, buffer.data(), buffer.size() * sizeof(int16_t), &bytes_written, portMAX_DELAY);
+}
+
+bool SoundModule::startWorker()
+{
+    if (worker.isStarted())
+        return true;
+    // Core 0 otherwise only runs the I2C receiver, which tolerates the delay
+    if (worker.start("voice_worker", worker_entry, this, 16384, platform::maxTaskPriority(), 0))
+    {
+        ESP_LOGI(TAG, "Render helper started on core 0");
+        return true;
+    }
+    ESP_LOGE(TAG, "Cannot start the render helper, rendering on one core");
+    renderMode.store(RenderMode::SingleCore, std::memory_order_relaxed);
+    return false;
+}
+
+void SoundModule::worker_entry(void *arg)
+{
+    auto *self = static_cast<SoundModule *>(arg);
+    if (self->workerJob == WorkerJob::Sources)
+        self->renderSources();
+    else
+        self->renderSplitVoices();
+}
+
+/// Helper task: render its share of the segment into the split buffers
+IRAM_ATTR void SoundModule::renderSplitVoices()
+{
+    helperProfile = {};
+    std::fill_n(splitLeft, splitFrames, 0.0f);
+    std::fill_n(splitRight, splitFrames, 0.0f);
+    for (Voice *voice : splitVoices)
+        voice->renderBlock(splitLeft, splitRight, splitFrames, splitFrame, helperProfile);
+}
+
+/// Return every voice's finished oscillators to the pool. Only the thread
+/// that applies notes calls this: the audio task, or the helper when pipelined.
+IRAM_ATTR void SoundModule::reapOscillators(BlockProfile &stageProfile)
+{
+    StageTimer timer(stageProfile, Stage::Mix);
+    for (auto &voice : voices)
+        voice.garbageCollect();
+}
+
+IRAM_ATTR void SoundModule::renderVoices(size_t pos, size_t n, RenderMode mode)
+{
+    const uint64_t frame = renderedFrames + pos;
+
+    if (mode == RenderMode::SingleCore)
+    {
+        for (auto &voice : voices)
+        {
+            if (voice.needsRender())
+                voice.renderBlock(mixLeft + pos, mixRight + pos, n, frame, profile);
+        }
+        return;
+    }
+
+    // Greedy split on oscillator count; a voice costs its LFOs and filter
+    // even when it holds few notes, hence the +1
+    ownVoices.count = 0;
+    splitVoices.count = 0;
+    size_t ownLoad = 0, splitLoad = 0;
+    for (auto &voice : voices)
+    {
+        if (!voice.needsRender())
+            continue;
+        const size_t load = 1 + voice.activeOscillatorCount();
+        if (ownLoad <= splitLoad)
+        {
+            ownVoices.first[ownVoices.count++] = &voice;
+            ownLoad += load;
+        }
+        else
+        {
+            splitVoices.first[splitVoices.count++] = &voice;
+            splitLoad += load;
+        }
+    }
+
+    if (splitVoices.size())
+    {
+        splitFrames = n;
+        splitFrame = frame;
+        workerJob = WorkerJob::SplitVoices;
+        worker.run();
+    }
+
+    for (Voice *voice : ownVoices)
+        voice->renderBlock(mixLeft + pos, mixRight + pos, n, frame, profile);
+
+    if (splitVoices.size())
+    {
+        {
+            StageTimer timer(profile, Stage::HelperWait);
+            worker.wait();
+        }
+        StageTimer timer(profile, Stage::Mix);
+        mix::accumulate(mixLeft + pos, splitLeft, n);
+        mix::accumulate(mixRight + pos, splitRight, n);
+    }
+}
+
+IRAM_ATTR void SoundModule::process()
+{
+    render(buffer, config.bufferSize);
+    {
+        StageTimer timer(profile, Stage::OutputWait);
+        output.write(buffer, config.bufferSize);
+    }
+    commitBlockStats();
+}
+
+IRAM_ATTR void SoundModule::measureLoad()
+{
+    blockLoad = {};
+    for (const auto &voice : voices)
+    {
+        size_t count = voice.activeOscillatorCount();
+        if (count == 0)
+            continue;
+        ++blockLoad.voices;
+        blockLoad.oscillators += count;
+        blockLoad.features |= voice.activeFeatures();
+    }
+}
+
+IRAM_ATTR void SoundModule::commitBlockStats()
+{
+    stats.commit(profile, blockLoad.oscillators);
+    xruns.commit(profile.get(Stage::Render), stats.getBudget(), blockLoad.voices,
+                 static_cast<uint8_t>(std::min<size_t>(blockLoad.oscillators, UINT8_MAX)), blockLoad.features,
+                 output.underrunCount());
 }
 
 void SoundModule::audio_task_entry(void *arg)
@@ -129,15 +580,20 @@ void SoundModule::audio_task_entry(void *arg)
     auto *self = static_cast<SoundModule *>(arg);
     while (true)
     {
-        // int64_t start = esp_timer_get_time();
         self->process();
-        // int64_t elapsed_us = esp_timer_get_time() - start;
-        // ESP_LOGI("AUDIO", "Process time: %lld us", elapsed_us);
         // esp_task_wdt_reset(); 👈 allows watchdog to breathe
         // taskYIELD(); // 👈 allows watchdog to breathe
     }
 }
 
+size_t SoundModule::activeOscillatorCount() const
+{
+    size_t count = 0;
+    for (const auto &voice : voices)
+        count += voice.activeOscillatorCount();
+    return count;
+}
+
 void SoundModule::updateBpmSetting()
 {
     uint16_t bpm = state.isSynced ? state.midiBpm : state.settingsBpm;
@@ -145,19 +601,8 @@ void SoundModule::updateBpmSetting()
     {
         voice.setBpm(bpm);
     }
-    for (auto &s : oscillatorPool)
+    for (auto &s : pool)
     {
         s.setBpm(bpm);
     }
 }
-
-Oscillator *SoundModule::allocateSound()
-{
-    for (auto &s : oscillatorPool)
-    {
-        if (!s.isPlaying())
-            return &s;
-    }
-    // No free sounds
-    return nullptr;
-}
@@ -1,7 +1,7 @@
 // voice.cpp
 #include "voice.hpp"
 #include "esp_log.h"
-#include "cent_pitch_table.hpp"
+#include "pitch_ratio.hpp"
 #include <cmath>
 
 #define TAG "Voice"
@@ -9,35 +9,59 @@
 using namespace sound_module;
 
 // Constructor: set sample rate, polyphony, initialize sounds and envelope
-Voice::Voice(uint8_t voiceIndex, uint32_t sample_rate, uint8_t channel, uint16_t initial_bpm)
+Voice::Voice(uint8_t voiceIndex, uint32_t sample_rate, uint8_t channel, uint16_t initial_bpm,
+             OscillatorPool &pool, ChannelMap &channels, Arena &arena)
     : sampleRate(sample_rate),
-      pitchLfo(sample_rate, initial_bpm),
-      ampLfo(sample_rate, initial_bpm),
-      pitchLfoC(pitchLfo, 512),
-      ampLfoC(ampLfo, 513),
       filter(sample_rate, initial_bpm, voiceIndex),
       pitchSettings(),
+      pitchLfo(sample_rate, initial_bpm),
+      ampLfo(sample_rate, initial_bpm),
       index(voiceIndex),
-      midi_channel(channel),
+      pool(&pool),
+      channels(&channels),
+      midi_channel(channel & (ChannelMap::CHANNELS - 1)),
       bpm(initial_bpm),
-      volumeSettings()
+      volumeSettings(),
+      envelopeSettings(),
+      oscillatorSettings(),
+      activeOscillators(arena, pool.capacity())
 {
+    channels.assign(index, midi_channel);
+    updateKernels();
 }
 
 void Voice::setBpm(uint16_t bpm)
 {
     // ESP_LOGI(TAG, "Voice set pbm %d", bpm);
-    bpm = bpm;
+    this->bpm = bpm;
     ampLfo.setBpm(bpm);
     pitchLfo.setBpm(bpm);
 }
 
 void Voice::setMidiChannel(uint8_t midiChannel)
 {
-    midi_channel = midiChannel;
+    midi_channel = midiChannel & (ChannelMap::CHANNELS - 1);
+    if (enabled)
+        channels->assign(index, midi_channel);
     all_notes_off();
 };
 
+void Voice::setEnabled(bool enable)
+{
+    if (enable == enabled)
+        return;
+    enabled = enable;
+    if (enabled)
+    {
+        channels->assign(index, midi_channel);
+    }
+    else
+    {
+        channels->remove(index);
+        all_notes_off();
+    }
+}
+
 void Voice::setAttack(uint8_t value)
 {
     envelopeSettings.attack = value;
@@ -88,6 +112,45 @@ void Voice::setOscillatorShape(protocol::OscillatorShape value)
     {
         o->setShape(value);
     }
+    updateKernels();
+}
+
+void Voice::setLfoWaveform(LfoTarget target, protocol::LfoWaveform waveform)
+{
+    lfoFor(target).setWaveform(waveform);
+    updateKernels();
+}
+
+void Voice::setLfoSubdivision(LfoTarget target, protocol::LfoSubdivision subdivision)
+{
+    lfoFor(target).setSubdivision(subdivision);
+}
+
+void Voice::setLfoDepth(LfoTarget target, uint8_t depth)
+{
+    lfoFor(target).setDepth(depth);
+    updateKernels();
+}
+
+void Voice::updateKernels()
+{
+    sourceKernel = sourceKernelFor(oscillatorSettings.shape, pitchLfo.getDepth() > 0, ampLfo.getDepth() > 0);
+}
+
+uint8_t Voice::activeFeatures() const
+{
+    uint8_t features = 0;
+    if (filter.isActive())
+        features |= FEATURE_FILTER;
+    if (pitchLfo.getDepth())
+        features |= FEATURE_PITCH_LFO;
+    if (ampLfo.getDepth())
+        features |= FEATURE_AMP_LFO;
+    if (oscillatorSettings.shape == protocol::OscillatorShape::Square)
+        features |= FEATURE_PULSE;
+    if (oscillatorSettings.shape == protocol::OscillatorShape::Noise)
+        features |= FEATURE_NOISE;
+    return features;
 }
 
 void Voice::updatePitchOffset()
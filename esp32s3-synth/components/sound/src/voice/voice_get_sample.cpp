@@ -2,47 +2,163 @@
 // voice.cpp
 #include "voice.hpp"
 #include <cmath>
+#include <algorithm>
 #include <esp_log.h>
 #include <channel_settings.hpp>
-#include "cent_pitch_table.hpp"
+#include "pitch_ratio.hpp"
 #include "pan_table.hpp"
 #include "esp_attr.h"
+#include "platform.hpp"
+#include "mix_kernels.hpp"
 
 using namespace sound_module;
 using namespace protocol;
 
 #define TAG = "Voice";
 
-Stereo Voice::getSample()
+IRAM_ATTR void Voice::renderBlock(float *L, float *R, size_t n, uint64_t frame, BlockProfile &profile)
 {
-    // 0) Always clean up first
-    garbageCollect();
+    for (size_t offset = 0; offset < n; offset += CONTROL_BLOCK)
+    {
+        renderControlBlock(L + offset, R + offset, std::min(CONTROL_BLOCK, n - offset), frame + offset, profile);
+    }
+}
+
+IRAM_ATTR bool Voice::renderSourceBlock(float *out, size_t n, uint64_t frame, BlockProfile &profile)
+{
+    bool active = false;
+    for (size_t offset = 0; offset < n; offset += CONTROL_BLOCK)
+    {
+        active |= renderSource(out + offset, std::min(CONTROL_BLOCK, n - offset), frame + offset, profile);
+    }
+    return active;
+}
+
+IRAM_ATTR void Voice::renderPostBlock(float *source, float *L, float *R, size_t n, BlockProfile &profile)
+{
+    for (size_t offset = 0; offset < n; offset += CONTROL_BLOCK)
+    {
+        renderPost(source + offset, L + offset, R + offset, std::min(CONTROL_BLOCK, n - offset), profile);
+    }
+}
+
+IRAM_ATTR void Voice::renderControlBlock(float *L, float *R, size_t n, uint64_t frame, BlockProfile &profile)
+{
+    float mix[CONTROL_BLOCK];
+    if (renderSource(mix, n, frame, profile))
+        renderPost(mix, L, R, n, profile);
+}
 
-    // 1) If nothing left, bail out immediately
-    if (activeOscillators.empty() || volumeSettings.volume == 0)
-        return {0.0f, 0.0f};
+IRAM_ATTR bool Voice::renderSource(float *mix, size_t n, uint64_t frame, BlockProfile &profile)
+{
+    return (this->*sourceKernel)(mix, n, frame, profile);
+}
 
-    // 2) Compute modulators
-    float sm_gain = volumeSettings.gain_smoothed.next();
-    float ampRaw = (ampLfoC.getValue() + 127.0f) / 254.0f;
-    ampLfoSmoothed = AMP_ALPHA * ampRaw + (1.0f - AMP_ALPHA) * ampLfoSmoothed;
-    float pitchRaw = pitchLfoC.getValue();
-    float pitchOffset = pitchRaw * (pitchLfoDepth / 127.0f);
-    float totalCents = pitchSettings.totalTransposeCents + pitchOffset;
+Voice::SourceKernel Voice::sourceKernelFor(protocol::OscillatorShape shape, bool pitchLfo, bool ampLfo)
+{
+    using S = protocol::OscillatorShape;
+    static constexpr SourceKernel KERNELS[S::_Count][2][2] = {
+        {{&Voice::renderSourceAs<S::Sine, false, false>, &Voice::renderSourceAs<S::Sine, false, true>},
+         {&Voice::renderSourceAs<S::Sine, true, false>, &Voice::renderSourceAs<S::Sine, true, true>}},
+        {{&Voice::renderSourceAs<S::Tri, false, false>, &Voice::renderSourceAs<S::Tri, false, true>},
+         {&Voice::renderSourceAs<S::Tri, true, false>, &Voice::renderSourceAs<S::Tri, true, true>}},
+        {{&Voice::renderSourceAs<S::Square, false, false>, &Voice::renderSourceAs<S::Square, false, true>},
+         {&Voice::renderSourceAs<S::Square, true, false>, &Voice::renderSourceAs<S::Square, true, true>}},
+        {{&Voice::renderSourceAs<S::Saw, false, false>, &Voice::renderSourceAs<S::Saw, false, true>},
+         {&Voice::renderSourceAs<S::Saw, true, false>, &Voice::renderSourceAs<S::Saw, true, true>}},
+        {{&Voice::renderSourceAs<S::Noise, false, false>, &Voice::renderSourceAs<S::Noise, false, true>},
+         {&Voice::renderSourceAs<S::Noise, true, false>, &Voice::renderSourceAs<S::Noise, true, true>}},
+    };
+    // An unknown shape renders nothing, which the Sine kernel's fallback
+    // path (Oscillator::renderBlock) already does for a mismatched shape
+    const size_t row = shape < S::_Count ? static_cast<size_t>(shape) : 0;
+    return KERNELS[row][pitchLfo][ampLfo];
+}
+
+template <protocol::OscillatorShape SHAPE, bool PITCH_LFO, bool AMP_LFO>
+IRAM_ATTR bool Voice::renderSourceAs(float *mix, size_t n, uint64_t frame, BlockProfile &profile)
+{
+    // Everything outside the oscillator pass is booked as Mix
+    const uint32_t start = platform::cycleCount();
+
+    // 0) The LFOs keep time even while silent
+    pitchLfo.advanceTo(frame);
+    ampLfo.advanceTo(frame);
+
+    // 1) If nothing left, bail out immediately; a muted voice drops its fades
+    if ((activeOscillators.empty() && tailCount == 0) || volumeSettings.volume == 0)
+    {
+        tailCount = 0;
+        profile.add(Stage::Mix, platform::cycleCount() - start);
+        return false;
+    }
+
+    // 2) Compute modulators once per block; a silent LFO reads as 0
+    float ampRaw = ((AMP_LFO ? ampLfo.getValue() : 0.0f) + 127.0f) / 254.0f;
+    float totalCents = pitchSettings.totalTransposeCents;
+    if constexpr (PITCH_LFO)
+        totalCents += pitchLfo.getValue() * (pitchLfoDepth / 127.0f);
     float pitchRatio = sound_module::centsToPitchRatio(totalCents);
 
-    // 3) Mix & step every remaining voice (all are playing)
-    float mix = 0.0f;
+    // 3) Sum every oscillator into the block buffer with the voice's shape
+    // kernel; one whose shape has not caught up yet dispatches on its own
+    const uint32_t oscStart = platform::cycleCount();
+    const uint32_t envelopeBefore = profile.get(Stage::Envelope);
+    std::fill_n(mix, n, 0.0f);
     for (auto *s : activeOscillators)
     {
         s->setFrequency(midi_note_freq[s->midi_note] * pitchRatio);
-        mix += s->getSample() * s->velNorm * ampLfoSmoothed;
+        s->renderBlockAs<SHAPE>(mix, n, &profile);
     }
+    renderTails(mix, n);
+    const uint32_t oscEnd = platform::cycleCount();
+    profile.add(Stage::Oscillators, (oscEnd - oscStart) - (profile.get(Stage::Envelope) - envelopeBefore));
 
-    // 4) Filter + master gain
-    mix = filter.process(mix) * sm_gain;
+    // 4) Amp LFO, smoothed per sample. Without one the smoother glides to a
+    // constant, and once a step no longer moves it the block is a plain gain.
+    float ampSmoothed = ampLfoSmoothed;
+    if (!AMP_LFO && AMP_ALPHA * ampRaw + (1.0f - AMP_ALPHA) * ampSmoothed == ampSmoothed)
+    {
+        for (size_t i = 0; i < n; ++i)
+            mix[i] *= ampSmoothed;
+    }
+    else
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            ampSmoothed = AMP_ALPHA * ampRaw + (1.0f - AMP_ALPHA) * ampSmoothed;
+            mix[i] *= ampSmoothed;
+        }
+        ampLfoSmoothed = ampSmoothed;
+    }
+    profile.add(Stage::Mix, (oscStart - start) + (platform::cycleCount() - oscEnd));
+    return true;
+}
+
+/// Mix the fades of stolen notes into `mix` and drop the finished ones
+IRAM_ATTR void Voice::renderTails(float *mix, size_t n)
+{
+    for (size_t i = 0; i < tailCount;)
+    {
+        Oscillator::renderTail(tails[i], mix, n);
+        if (tails[i].remaining)
+            ++i;
+        else
+            tails[i] = tails[--tailCount];
+    }
+}
+
+IRAM_ATTR void Voice::renderPost(float *mix, float *L, float *R, size_t n, BlockProfile &profile)
+{
+    const uint32_t filterStart = platform::cycleCount();
+    filter.processBlock(mix, n);
+    const uint32_t filterEnd = platform::cycleCount();
+    profile.add(Stage::Filter, filterEnd - filterStart);
 
-    return {mix, mix};
+    float gains[CONTROL_BLOCK];
+    mix::rampGain(volumeSettings.gain_smoothed, 1.0f, gains, n);
+    mix::mixMono(L, R, mix, gains, n);
+    profile.add(Stage::Mix, platform::cycleCount() - filterEnd);
 }
 
 void Voice::setVolume(uint8_t newVolume)
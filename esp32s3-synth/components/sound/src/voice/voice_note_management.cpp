@@ -1,43 +1,25 @@
 // voice.cpp
 #include "voice.hpp"
 #include <cmath>
+#include <algorithm>
 #include <esp_log.h>
 #define TAG "Voice"
 
 using namespace sound_module;
 
-// Find an active Sound by MIDI note
-Oscillator *Voice::find_note_to_release(uint8_t midi_note)
+// Same note again: restart its oscillator instead of stacking a second one
+bool Voice::retrigger(uint8_t midi_note, uint8_t velocity)
 {
-    for (auto *s : activeOscillators)
-    {
-        if (s->isNoteOn() && s->midi_note == midi_note)
-            return s;
-    }
-    return nullptr;
+    Oscillator *s = slotFor(midi_note);
+    if (!s || !s->isPlaying())
+        return false;
+    s->retrigger(velocity);
+    return true;
 }
 
-// Note on: trigger new sound, retrigger LFOs, and envelope
-void Voice::noteOn(Oscillator *sound, uint8_t ch, uint8_t midi_note, uint8_t velocity)
+// Note on: trigger new sound and envelope
+void Voice::noteOn(Oscillator *sound, uint8_t midi_note, uint8_t velocity)
 {
-    if (ch != midi_channel)
-    {
-        return;
-    }
-    bool wasReset = false;
-    // 1. Reset if this note is already active
-    for (auto *s : activeOscillators)
-    {
-        if (s->midi_note == midi_note && s->isNoteOn())
-        {
-            s->reset();
-            wasReset = true;
-            // ESP_LOGI(TAG, "Note is already playing – reset");
-        }
-    }
-    if (volumeSettings.volume == 0){
-        return;
-    }
     sound->setPwm(oscillatorSettings.pwm);
     sound->setShape(oscillatorSettings.shape);
     sound->envelope.setAttack(envelopeSettings.attack);
@@ -46,25 +28,40 @@ void Voice::noteOn(Oscillator *sound, uint8_t ch, uint8_t midi_note, uint8_t vel
     sound->envelope.setRelease(envelopeSettings.release);
     float base_freq = midi_note_freq[midi_note];
     sound->noteOn(base_freq, velocity, midi_note);
-    if (!wasReset)
-        activeOscillators.push_back(sound);
+    activeOscillators.push(sound);
+    slotFor(midi_note) = sound;
 
-    ESP_LOGI(TAG, "Sound added to voice, new count %d", activeOscillators.size());
+    ESP_LOGD(TAG, "Sound added to voice, new count %d", activeOscillators.size());
 }
 
 // Note off: release matching sound and envelope
-void Voice::noteOff(uint8_t ch, uint8_t midi_note)
+void Voice::noteOff(uint8_t midi_note)
 {
-    if (ch != midi_channel)
-        return;
-
-    Oscillator *match = find_note_to_release(midi_note);
-    if (match)
+    Oscillator *match = slotFor(midi_note);
+    if (match && match->isNoteOn())
     {
         match->noteOff();
     }
 }
 
+void Voice::detach(Oscillator *sound, size_t fadeSamples)
+{
+    if (activeOscillators.remove(sound) && slotFor(sound->midi_note) == sound)
+        slotFor(sound->midi_note) = nullptr;
+
+    Oscillator::Tail tail = sound->steal(fadeSamples);
+    if (!tail.remaining)
+        return;
+    if (tailCount < MAX_TAILS)
+    {
+        tails[tailCount++] = tail;
+        return;
+    }
+    auto quietest = std::min_element(tails.begin(), tails.end(), [](const auto &a, const auto &b)
+                                     { return a.gain < b.gain; });
+    *quietest = tail;
+}
+
 // Turn off all notes immediately
 void Voice::all_notes_off()
 {
@@ -77,16 +74,19 @@ void Voice::all_notes_off()
 
 void Voice::garbageCollect()
 {
-    for (auto it = activeOscillators.begin(); it != activeOscillators.end();)
+    for (size_t i = 0; i < activeOscillators.size();)
     {
-        Oscillator *sound = *it;
+        Oscillator *sound = activeOscillators[i];
         if (!sound->isPlaying())
         {
-            it = activeOscillators.erase(it);
+            activeOscillators.removeAt(i); // the last entry moves into i
+            if (slotFor(sound->midi_note) == sound)
+                slotFor(sound->midi_note) = nullptr;
+            pool->release(sound);
         }
         else
         {
-            ++it;
+            ++i;
         }
     }
 }
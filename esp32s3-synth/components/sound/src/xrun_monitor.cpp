@@ -0,0 +1,120 @@
+#include "xrun_monitor.hpp"
+#include <algorithm>
+#include "esp_log.h"
+#include "esp_attr.h"
+#include "platform.hpp"
+
+using namespace sound_module;
+
+IRAM_ATTR void XrunMonitor::commit(uint32_t renderCycles, uint32_t budgetCycles, uint8_t voices, uint8_t oscillators,
+                                   uint8_t features, uint32_t underruns)
+{
+    if (resetRequested.exchange(false, std::memory_order_relaxed))
+    {
+        blocks.store(0, std::memory_order_relaxed);
+        lateBlocks.store(0, std::memory_order_relaxed);
+        underrunTotal.store(0, std::memory_order_relaxed);
+        worstSlack.store(INT32_MAX, std::memory_order_relaxed);
+        recorded.store(0, std::memory_order_relaxed);
+        underrunsSeeded = false;
+    }
+
+    // Only count underruns seen since the monitor started or was reset
+    if (!underrunsSeeded)
+    {
+        lastUnderruns = underruns;
+        underrunsSeeded = true;
+    }
+    const uint32_t newUnderruns = underruns - lastUnderruns;
+    lastUnderruns = underruns;
+
+    const uint32_t block = blocks.load(std::memory_order_relaxed);
+    const int64_t slack64 = static_cast<int64_t>(budgetCycles) - static_cast<int64_t>(renderCycles);
+    const int32_t slack = static_cast<int32_t>(std::clamp<int64_t>(slack64, INT32_MIN, INT32_MAX));
+    lastSlack.store(slack, std::memory_order_relaxed);
+    if (slack < worstSlack.load(std::memory_order_relaxed))
+        worstSlack.store(slack, std::memory_order_relaxed);
+
+    if (newUnderruns)
+        underrunTotal.store(underrunTotal.load(std::memory_order_relaxed) + newUnderruns, std::memory_order_relaxed);
+    if (slack < 0)
+        lateBlocks.store(lateBlocks.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    if (slack < 0 || newUnderruns)
+    {
+        record(LateBlock{
+            .block = block,
+            .renderCycles = renderCycles,
+            .voices = voices,
+            .oscillators = oscillators,
+            .features = features,
+            .underrun = newUnderruns != 0,
+        });
+    }
+    blocks.store(block + 1, std::memory_order_relaxed);
+}
+
+IRAM_ATTR void XrunMonitor::record(const LateBlock &late)
+{
+    // Sequence lock: readers retry while the count is odd or has moved
+    const uint32_t seq = sequence.load(std::memory_order_relaxed);
+    sequence.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    const uint32_t n = recorded.load(std::memory_order_relaxed);
+    Slot &slot = history[n % HISTORY];
+    slot.block.store(late.block, std::memory_order_relaxed);
+    slot.renderCycles.store(late.renderCycles, std::memory_order_relaxed);
+    slot.packed.store(late.voices | late.oscillators << 8 | late.features << 16 | uint32_t(late.underrun) << 24,
+                      std::memory_order_relaxed);
+    recorded.store(n + 1, std::memory_order_relaxed);
+
+    sequence.store(seq + 2, std::memory_order_release);
+}
+
+size_t XrunMonitor::recentLateBlocks(LateBlock *out, size_t max) const
+{
+    while (true)
+    {
+        const uint32_t before = sequence.load(std::memory_order_acquire);
+        if (before & 1)
+            continue;
+
+        const uint32_t n = recorded.load(std::memory_order_relaxed);
+        const size_t count = std::min<size_t>({max, n, HISTORY});
+        for (size_t i = 0; i < count; ++i)
+        {
+            const Slot &slot = history[(n - 1 - i) % HISTORY];
+            const uint32_t packed = slot.packed.load(std::memory_order_relaxed);
+            out[i].block = slot.block.load(std::memory_order_relaxed);
+            out[i].renderCycles = slot.renderCycles.load(std::memory_order_relaxed);
+            out[i].voices = packed & 0xff;
+            out[i].oscillators = (packed >> 8) & 0xff;
+            out[i].features = (packed >> 16) & 0xff;
+            out[i].underrun = (packed >> 24) & 1;
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence.load(std::memory_order_relaxed) == before)
+            return count;
+    }
+}
+
+void XrunMonitor::log(const char *tag) const
+{
+    const double toUs = 1e6 / platform::cycleFrequencyHz();
+    const int32_t worst = getWorstSlack();
+    ESP_LOGI(tag, "blocks %u  late %u  underruns %u  slack last %.1f us  worst %.1f us",
+             static_cast<unsigned>(getBlocks()), static_cast<unsigned>(getLateBlocks()),
+             static_cast<unsigned>(getUnderruns()), getLastSlack() * toUs,
+             worst == INT32_MAX ? 0.0 : worst * toUs);
+
+    std::array<LateBlock, HISTORY> late;
+    size_t count = recentLateBlocks(late.data(), late.size());
+    for (size_t i = 0; i < count; ++i)
+    {
+        ESP_LOGW(tag, "  block %u: render %.1f us, %u voices, %u oscillators, features 0x%02x%s",
+                 static_cast<unsigned>(late[i].block), late[i].renderCycles * toUs,
+                 late[i].voices, late[i].oscillators, late[i].features, late[i].underrun ? ", underrun" : "");
+    }
+}
@@ -14,4 +14,5 @@ namespace settings
     void setPitchLfoPage(Voice &voice, uint8_t field, int16_t value);
     void setAmpLfoPage(Voice &voice, uint8_t field, int16_t value);
     void setGlobalPage(SoundModule &sound_module, uint8_t field, int16_t value);
+    void setEnginePage(SoundModule &sound_module, uint8_t field, int16_t value);
 }
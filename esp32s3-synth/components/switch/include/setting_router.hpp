@@ -16,14 +16,19 @@ namespace settings
     private:
         SoundModule &soundModule;
 
+        // Audio task side: applies drained events to the engine
+        void apply(const SynthEvent &event);
         void setUpdate(const FieldUpdate &update);
 
     public:
+        /// Registers itself as the SoundModule event handler.
+        /// The setters below only queue; each change lands on its stamped
+        /// frame inside the block being rendered (arrival time by default).
         SettingRouter(SoundModule &soundModule);
         void setMasterVolume(uint8_t volume);
-        void setBpmFromMidi(uint16_t bpm);
-        void setUpdateFromUi(const FieldUpdateList &update);
-        void setTransportState(const TransportCommand &setTransportState);
+        void setBpmFromMidi(uint16_t bpm, uint64_t frame = SynthEvent::NOW);
+        void setUpdateFromUi(const FieldUpdateList &update, uint64_t frame = SynthEvent::NOW);
+        void setTransportState(const TransportCommand &command, uint64_t frame = SynthEvent::NOW);
     };
 
 }
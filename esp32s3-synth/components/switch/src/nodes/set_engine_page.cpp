@@ -0,0 +1,27 @@
+#include "set_page.hpp"
+#include <algorithm>
+#include "esp_log.h"
+#define TAG "Engine Page"
+
+using namespace settings;
+using namespace protocol;
+
+void settings::setEnginePage(SoundModule &soundModule, uint8_t field, int16_t value)
+{
+    auto fieldType = static_cast<EngineField>(field);
+    switch (fieldType)
+    {
+    case EngineField::Voices:
+        soundModule.setVoiceCount(static_cast<size_t>(std::max<int16_t>(value, 1)));
+        ESP_LOGI(TAG, "%u of %u voices", static_cast<unsigned>(soundModule.getVoiceCount()),
+                 static_cast<unsigned>(soundModule.getVoiceCapacity()));
+        break;
+    case EngineField::Polyphony:
+        soundModule.setPolyphony(static_cast<size_t>(std::max<int16_t>(value, 1)));
+        ESP_LOGI(TAG, "%u of %u oscillators", static_cast<unsigned>(soundModule.getPolyphony()),
+                 static_cast<unsigned>(soundModule.getPolyphonyCapacity()));
+        break;
+    default:
+        break;
+    }
+};
@@ -3,7 +3,7 @@
 using namespace settings;
 using namespace protocol;
 
-void setLfo(LFO &lfo, uint8_t field, int16_t value)
+void setLfo(Voice &voice, Voice::LfoTarget target, uint8_t field, int16_t value)
 {
     auto fieldType = static_cast<protocol::LFOField>(field);
     switch (fieldType)
@@ -11,19 +11,19 @@ void setLfo(LFO &lfo, uint8_t field, int16_t value)
     case LFOField::Form:
     {
         auto castValue = static_cast<protocol::LfoWaveform>(value);
-        lfo.setWaveform(castValue);
+        voice.setLfoWaveform(target, castValue);
         break;
     }
     case LFOField::Subdiv:
     {
         auto castValue = static_cast<protocol::LfoSubdivision>(value);
-        lfo.setSubdivision(castValue);
+        voice.setLfoSubdivision(target, castValue);
         break;
     }
     case LFOField::Depth:
     {
         auto castValue = static_cast<uint8_t>(value);
-        lfo.setDepth(castValue);
+        voice.setLfoDepth(target, castValue);
         break;
     }
 
@@ -34,12 +34,12 @@ void setLfo(LFO &lfo, uint8_t field, int16_t value)
 
 void settings::setAmpLfoPage(Voice &voice, uint8_t field, int16_t value)
 {
-    setLfo(voice.ampLfo, field, value);
+    setLfo(voice, Voice::LfoTarget::Amp, field, value);
 };
 
 void settings::setPitchLfoPage(Voice &voice, uint8_t field, int16_t value)
 {
-    setLfo(voice.pitchLfo, field, value);
+    setLfo(voice, Voice::LfoTarget::Pitch, field, value);
 };
 
  
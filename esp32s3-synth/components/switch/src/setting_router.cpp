@@ -1,41 +1,87 @@
 #include "setting_router.hpp"
 #include "set_page.hpp"
-#include "smoothed_gain.hpp"
 #include "esp_log.h"
 #define TAG "Settings Router"
 
 using namespace settings;
 
-SettingRouter::SettingRouter(SoundModule &soundModule) : soundModule(soundModule) {};
+SettingRouter::SettingRouter(SoundModule &soundModule) : soundModule(soundModule)
+{
+    soundModule.setEventHandler([this](const SynthEvent &event)
+                                { apply(event); });
+};
 
-void SettingRouter::setMasterVolume(uint8_t volume) {
-    setSmoothedGain(soundModule.getState().volumeSettings, volume, 255, MIN_DB);
+void SettingRouter::setMasterVolume(uint8_t volume)
+{
+    soundModule.setMasterVolume(volume);
 };
 
-void SettingRouter::setBpmFromMidi(uint16_t bpm)
+void SettingRouter::setBpmFromMidi(uint16_t bpm, uint64_t frame)
 {
-    this->soundModule.getState().midiBpm = bpm;
-    this->soundModule.updateBpmSetting();
+    SynthEvent event{};
+    event.type = SynthEventType::MidiBpm;
+    event.value = bpm;
+    event.frame = frame;
+    soundModule.post(event);
 };
 
-void SettingRouter::setUpdateFromUi(const FieldUpdateList &update)
+void SettingRouter::setUpdateFromUi(const FieldUpdateList &update, uint64_t frame)
 {
+    if (frame == SynthEvent::NOW)
+        frame = soundModule.stampFrame();
+
+    // One stamp for the whole packet so its fields land on the same sample
     for (auto &u : update)
     {
-        setUpdate(u);
+        SynthEvent event{};
+        event.type = SynthEventType::Field;
+        event.field = u;
+        event.frame = frame;
+        soundModule.post(event);
     }
 };
 
-void SettingRouter::setTransportState(const TransportCommand &update)
+void SettingRouter::apply(const SynthEvent &event)
 {
-    this->soundModule.getState().transportState = update;
+    switch (event.type)
+    {
+    case SynthEventType::Field:
+        setUpdate(event.field);
+        break;
+    case SynthEventType::MidiBpm:
+        soundModule.getState().midiBpm = event.value;
+        soundModule.updateBpmSetting();
+        break;
+    case SynthEventType::Transport:
+        soundModule.getState().transportState = event.transport;
+        break;
+    default:
+        break;
+    }
+};
+
+void SettingRouter::setTransportState(const TransportCommand &command, uint64_t frame)
+{
+    SynthEvent event{};
+    event.type = SynthEventType::Transport;
+    event.transport = command;
+    event.frame = frame;
+    soundModule.post(event);
 };
 
 void SettingRouter::setUpdate(const FieldUpdate &update)
 {
     // Cast the raw byte to our Page enum
     Page page = static_cast<Page>(update.pageByte);
-    ESP_LOGI(TAG, "Update voice %d page %s fields %d value %d", update.voiceIndex, menuPages[update.pageByte].title, update.field, update.value);
+    ESP_LOGD(TAG, "Update voice %d page %s fields %d value %d", update.voiceIndex, menuPages[update.pageByte].title, update.field, update.value);
+
+    // Voice pages for a voice the engine has no room for are dropped; the
+    // UI may address more voices than this unit was built with
+    if (update.pageByte < VOICE_PAGE_COUNT && update.voiceIndex >= soundModule.getVoiceCapacity())
+    {
+        ESP_LOGD(TAG, "No voice %d, update dropped", update.voiceIndex);
+        return;
+    }
 
     // Dispatch to the right “setXPage” function based on which page it is:
 
@@ -94,6 +140,10 @@ void SettingRouter::setUpdate(const FieldUpdate &update)
         settings::setGlobalPage(soundModule, update.field, update.value);
         break;
 
+    case Page::Engine:
+        settings::setEnginePage(soundModule, update.field, update.value);
+        break;
+
     default:
         // Either log an error or ignore an out‐of‐range pageByte
         // (e.g. pageByte >= static_cast<uint8_t>(Page::_Count)).
@@ -0,0 +1,4 @@
+#pragma once
+// Host stand-in for ESP-IDF section attributes: everything lives in normal memory.
+#define IRAM_ATTR
+#define DRAM_ATTR
@@ -0,0 +1,20 @@
+#pragma once
+// Host stand-in for ESP-IDF logging: printf to stderr, filtered at compile time.
+#include <cstdio>
+
+#ifndef HOST_LOG_LEVEL
+#define HOST_LOG_LEVEL 2 // 1=E 2=W 3=I 4=D 5=V
+#endif
+
+#define HOST_LOG(level, letter, tag, format, ...)                               \
+    do                                                                          \
+    {                                                                           \
+        if ((level) <= HOST_LOG_LEVEL)                                          \
+            std::fprintf(stderr, letter " (%s) " format "\n", tag, ##__VA_ARGS__); \
+    } while (0)
+
+#define ESP_LOGE(tag, format, ...) HOST_LOG(1, "E", tag, format, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) HOST_LOG(2, "W", tag, format, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) HOST_LOG(3, "I", tag, format, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) HOST_LOG(4, "D", tag, format, ##__VA_ARGS__)
+#define ESP_LOGV(tag, format, ...) HOST_LOG(5, "V", tag, format, ##__VA_ARGS__)
@@ -0,0 +1,156 @@
+#include "event_script.hpp"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+using namespace host;
+
+bool host::loadScript(const std::string &path, uint32_t sampleRate, EventScript &script, std::string &error)
+{
+    std::ifstream in(path);
+    if (!in)
+    {
+        error = "cannot open " + path;
+        return false;
+    }
+    std::stringstream text;
+    text << in.rdbuf();
+    return parseScript(text.str(), sampleRate, script, error);
+}
+
+bool host::parseScript(const std::string &text, uint32_t sampleRate, EventScript &script, std::string &error)
+{
+    std::istringstream lines(text);
+    std::string line;
+    int lineNo = 0;
+    bool hasEnd = false;
+    script = {};
+
+    while (std::getline(lines, line))
+    {
+        ++lineNo;
+        auto hash = line.find('#');
+        if (hash != std::string::npos)
+            line.erase(hash);
+
+        std::istringstream words(line);
+        double ms;
+        std::string cmd;
+        if (!(words >> ms))
+            continue; // blank or comment-only line
+        if (!(words >> cmd))
+        {
+            error = "line " + std::to_string(lineNo) + ": missing command";
+            return false;
+        }
+
+        ScriptEvent e{};
+        e.frame = static_cast<uint64_t>(std::llround(std::max(0.0, ms) * sampleRate / 1000.0));
+        int a = 0, b = 0, c = 0, d = 0;
+        bool ok = true;
+
+        if (cmd == "on" || cmd == "off")
+        {
+            ok = static_cast<bool>(words >> a >> b);
+            if (cmd == "on")
+                ok = ok && static_cast<bool>(words >> c);
+            e.kind = ScriptEventKind::Note;
+            e.note.status = static_cast<uint8_t>((cmd == "on" ? 0x90 : 0x80) | (a & 0x0F));
+            e.note.note = static_cast<uint8_t>(b & 0x7F);
+            e.note.velocity = static_cast<uint8_t>(c & 0x7F);
+        }
+        else if (cmd == "param")
+        {
+            ok = static_cast<bool>(words >> a >> b >> c >> d);
+            e.kind = ScriptEventKind::Param;
+            e.field = {static_cast<uint8_t>(a), static_cast<uint8_t>(b), static_cast<uint8_t>(c), static_cast<int16_t>(d)};
+        }
+        else if (cmd == "master" || cmd == "bpm")
+        {
+            ok = static_cast<bool>(words >> a);
+            e.kind = cmd == "master" ? ScriptEventKind::Master : ScriptEventKind::Bpm;
+            e.value = static_cast<uint16_t>(a);
+        }
+        else if (cmd == "end")
+        {
+            e.kind = ScriptEventKind::End;
+            script.endFrame = e.frame;
+            hasEnd = true;
+        }
+        else
+        {
+            error = "line " + std::to_string(lineNo) + ": unknown command '" + cmd + "'";
+            return false;
+        }
+
+        if (!ok)
+        {
+            error = "line " + std::to_string(lineNo) + ": bad arguments for '" + cmd + "'";
+            return false;
+        }
+        if (e.kind != ScriptEventKind::End)
+            script.events.push_back(e);
+    }
+
+    std::stable_sort(script.events.begin(), script.events.end(),
+                     [](const ScriptEvent &l, const ScriptEvent &r)
+                     { return l.frame < r.frame; });
+
+    if (!hasEnd)
+        script.endFrame = (script.events.empty() ? 0 : script.events.back().frame) + 2 * sampleRate;
+    return true;
+}
+
+void host::applyEvent(const ScriptEvent &event, sound_module::SoundModule &sound, settings::SettingRouter &router)
+{
+    switch (event.kind)
+    {
+    case ScriptEventKind::Note:
+        sound.handle_note(event.note, event.frame);
+        break;
+    case ScriptEventKind::Param:
+        router.setUpdateFromUi({event.field}, event.frame);
+        break;
+    case ScriptEventKind::Master:
+        router.setMasterVolume(static_cast<uint8_t>(std::min<uint16_t>(event.value, 255)));
+        break;
+    case ScriptEventKind::Bpm:
+        router.setBpmFromMidi(event.value, event.frame);
+        break;
+    case ScriptEventKind::End:
+        break;
+    }
+}
+
+uint64_t host::renderScript(const EventScript &script, sound_module::SoundModule &sound,
+                            settings::SettingRouter &router, size_t bufferSize)
+{
+    // Queue each block's events ahead of rendering it; the engine splits the
+    // block at their frames so every event lands on its exact sample.
+    size_t next = 0;
+    uint64_t frame = 0;
+    while (frame < script.endFrame)
+    {
+        uint64_t blockEnd = frame + bufferSize;
+        while (next < script.events.size() && script.events[next].frame < blockEnd)
+            applyEvent(script.events[next++], sound, router);
+
+        sound.process();
+        frame = blockEnd;
+    }
+    return frame;
+}
+
+bool host::parseRenderMode(const std::string &name, sound_module::RenderMode &mode)
+{
+    if (name == "single")
+        mode = sound_module::RenderMode::SingleCore;
+    else if (name == "split")
+        mode = sound_module::RenderMode::VoiceSplit;
+    else if (name == "pipe")
+        mode = sound_module::RenderMode::Pipelined;
+    else
+        return false;
+    return true;
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "protocol.hpp"
+#include "sound_module.hpp"
+#include "setting_router.hpp"
+
+/// Plain-text note/param event scripts for the host tools.
+///
+/// One event per line, `#` starts a comment, times are in milliseconds:
+///
+///     <ms> on     <channel> <note> <velocity>
+///     <ms> off    <channel> <note>
+///     <ms> param  <voice> <page> <field> <value>   (page/field: protocol::Page / *Field indices)
+///     <ms> master <0-255>
+///     <ms> bpm    <midi bpm>
+///     <ms> end
+///
+/// Fractional milliseconds are allowed; times are rounded to the nearest frame.
+namespace host
+{
+    enum class ScriptEventKind : uint8_t
+    {
+        Note,
+        Param,
+        Master,
+        Bpm,
+        End,
+    };
+
+    struct ScriptEvent
+    {
+        uint64_t frame; ///< sample frame the event is due at
+        ScriptEventKind kind;
+        midi_module::MidiNoteEvent note{};
+        protocol::FieldUpdate field{};
+        uint16_t value = 0; ///< master volume or bpm
+    };
+
+    struct EventScript
+    {
+        std::vector<ScriptEvent> events; ///< sorted by frame
+        uint64_t endFrame = 0;           ///< `end` event, or last event + 2 s tail
+    };
+
+    /// Parse a script file; returns false and fills `error` on failure
+    bool loadScript(const std::string &path, uint32_t sampleRate, EventScript &script, std::string &error);
+
+    /// Parse script text (same format as loadScript)
+    bool parseScript(const std::string &text, uint32_t sampleRate, EventScript &script, std::string &error);
+
+    /// Queue one event on the engine at its script frame, the same way main.cpp
+    /// does on target. Notes, params and bpm are sample-accurate; master volume
+    /// is a latest-value control and lands at the next render() call.
+    void applyEvent(const ScriptEvent &event, sound_module::SoundModule &sound, settings::SettingRouter &router);
+
+    /// Render mode from its command-line name (`single`, `split`, `pipe`)
+    bool parseRenderMode(const std::string &name, sound_module::RenderMode &mode);
+
+    /// Render the script up to its end frame through SoundModule::process(),
+    /// queueing each block's events before the block is rendered. Returns the
+    /// number of frames rendered (endFrame rounded up to whole blocks).
+    uint64_t renderScript(const EventScript &script, sound_module::SoundModule &sound,
+                          settings::SettingRouter &router, size_t bufferSize);
+}
@@ -0,0 +1,130 @@
+// fastmath_check.cpp
+//
+// Verify the error bounds documented in fastmath.hpp.
+//
+//   fastmath_check
+//
+// Every approximation is swept over its documented domain (a dense grid,
+// plus every float bit pattern at a fixed stride where the domain spans
+// many octaves) and compared with the double-precision libm result. Prints
+// the worst error of each function next to its bound and exits non-zero if
+// any bound is exceeded, or if exp2() is not exact at an integer.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include "fastmath.hpp"
+
+using namespace sound_module;
+
+namespace
+{
+    struct Worst
+    {
+        double error = 0.0;
+        double at = 0.0;
+
+        void record(double error_, double at_)
+        {
+            if (error_ > error)
+            {
+                error = error_;
+                at = at_;
+            }
+        }
+    };
+
+    bool report(const char *name, const char *kind, const Worst &worst, float bound)
+    {
+        const bool ok = worst.error <= bound;
+        std::printf("%-4s %-9s %s error %.2e (bound %.1e) at %.9g\n",
+                    ok ? "ok" : "FAIL", name, kind, worst.error, static_cast<double>(bound), worst.at);
+        return ok;
+    }
+
+    /// n + 1 evenly spaced floats from lo to hi
+    template <typename Visit>
+    void grid(float lo, float hi, int n, Visit visit)
+    {
+        for (int i = 0; i <= n; ++i)
+            visit(static_cast<float>(lo + (static_cast<double>(hi) - lo) * i / n));
+    }
+
+    /// Every stride-th positive normal float from lo to hi
+    template <typename Visit>
+    void bitPatterns(float lo, float hi, uint32_t stride, Visit visit)
+    {
+        uint32_t first, last;
+        std::memcpy(&first, &lo, sizeof first);
+        std::memcpy(&last, &hi, sizeof last);
+        for (uint64_t bits = first; bits <= last; bits += stride)
+        {
+            uint32_t b = static_cast<uint32_t>(bits);
+            float x;
+            std::memcpy(&x, &b, sizeof x);
+            visit(x);
+        }
+    }
+
+    double relative(double approx, double exact) { return std::fabs(approx - exact) / std::fabs(exact); }
+}
+
+int main()
+{
+    bool ok = true;
+    constexpr int N = 2000000;
+
+    Worst exp2Worst;
+    grid(-126.0f, 127.0f, N, [&](float x)
+         { exp2Worst.record(relative(fastmath::exp2(x), std::exp2(static_cast<double>(x))), x); });
+    grid(-1.0f, 1.0f, N, [&](float x)
+         { exp2Worst.record(relative(fastmath::exp2(x), std::exp2(static_cast<double>(x))), x); });
+    ok &= report("exp2", "relative", exp2Worst, fastmath::EXP2_MAX_REL_ERROR);
+
+    int inexact = 0;
+    for (int i = -126; i <= 127; ++i)
+        inexact += fastmath::exp2(static_cast<float>(i)) != std::ldexp(1.0f, i);
+    std::printf("%-4s exp2      exact at %d of 254 integers\n", inexact ? "FAIL" : "ok", 254 - inexact);
+    ok &= inexact == 0;
+
+    // Absolute error on top of one rounding of the result
+    Worst log2Worst;
+    bitPatterns(1.17549435e-38f, 3.40282347e+38f, 97, [&](float x)
+                {
+        const double exact = std::log2(static_cast<double>(x));
+        const float approx = fastmath::log2(x);
+        const double rounding = std::fabs(std::nextafter(approx, 2.0f * approx + 1.0f) - approx);
+        log2Worst.record(std::max(0.0, std::fabs(approx - exact) - rounding), x); });
+    ok &= report("log2", "absolute", log2Worst, fastmath::LOG2_MAX_ABS_ERROR);
+
+    Worst dbWorst;
+    grid(-120.0f, 24.0f, N, [&](float dB)
+         { dbWorst.record(relative(fastmath::dbToGain(dB), std::pow(10.0, dB / 20.0)), dB); });
+    ok &= report("dbToGain", "relative", dbWorst, fastmath::DB_TO_GAIN_MAX_REL_ERROR);
+
+    Worst powWorst;
+    grid(0.01f, 100.0f, 2000, [&](float base)
+         {
+        const float limit = 16.0f / std::fabs(std::log2(base) + 1e-9f);
+        const float span = std::fmin(limit, 64.0f);
+        grid(-span, span, 2000, [&](float x)
+             { powWorst.record(relative(fastmath::pow(base, x), std::pow(static_cast<double>(base), static_cast<double>(x))), base); }); });
+    ok &= report("pow", "relative", powWorst, fastmath::POW_MAX_REL_ERROR);
+
+    Worst tanhWorst;
+    grid(-20.0f, 20.0f, N, [&](float x)
+         { tanhWorst.record(std::fabs(fastmath::tanh(x) - std::tanh(static_cast<double>(x))), x); });
+    grid(-1e-3f, 1e-3f, N / 10, [&](float x)
+         { tanhWorst.record(std::fabs(fastmath::tanh(x) - std::tanh(static_cast<double>(x))), x); });
+    ok &= report("tanh", "absolute", tanhWorst, fastmath::TANH_MAX_ABS_ERROR);
+
+    Worst tanWorst;
+    grid(1e-6f, fastmath::TAN_MAX_ARGUMENT, N, [&](float x)
+         { tanWorst.record(relative(fastmath::tan(x), std::tan(static_cast<double>(x))), x); });
+    ok &= report("tan", "relative", tanWorst, fastmath::TAN_MAX_REL_ERROR);
+
+    std::printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
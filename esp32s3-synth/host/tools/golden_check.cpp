@@ -0,0 +1,374 @@
+// golden_check.cpp
+//
+// Golden-audio regression check for the render pipeline.
+//
+//   golden_check [--update] [--only substr] [--dir golden_dir] [--mode single|split|pipe]
+//
+// Every scene listed in <golden_dir>/manifest.txt is rendered from
+// <golden_dir>/scenes/<scene>.txt and compared against the reference
+// <golden_dir>/ref/<scene>.wav using the scene's tolerances:
+//
+//   rms       RMS of the sample difference (float scale, int16 / 32768)
+//   peak      largest absolute sample difference
+//   spectral  worst per-frame RMS of the dB difference between the
+//             magnitude spectra, over bins audible in either signal
+//
+// Each scene prints one line with its measured errors against the limits.
+// Exits non-zero if any scene breaks a tolerance or has no reference.
+// --update re-renders the references instead of checking them; do that only
+// for an intended change in sound and review the diff by ear. --mode picks
+// the engine's RenderMode; references are rendered and kept in `single`, and
+// `split` must match them within the same tolerances. `pipe` plays one block
+// late, so its first block is dropped before comparing. It applies params,
+// bpm and master changes at block boundaries, so scenes that change them after
+// frame 0 sound different in that mode; those are checked against their own
+// reference, <golden_dir>/ref/pipe/<scene>.wav, latency included, which
+// `--update --mode pipe` re-renders (and only those).
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "event_script.hpp"
+#include "wav_output.hpp"
+
+using namespace sound_module;
+using namespace protocol;
+
+#ifndef GOLDEN_DIR
+#define GOLDEN_DIR "golden"
+#endif
+
+namespace
+{
+    constexpr size_t FFT_SIZE = 2048;
+    constexpr double AUDIBLE_DB = -80.0; // bins quieter than this in both signals are ignored
+    constexpr double FLOOR_DB = -120.0;
+
+    struct SceneSpec
+    {
+        std::string name;
+        double rms;
+        double peak;
+        double spectralDb;
+    };
+
+    struct Errors
+    {
+        double rms = 0.0;
+        double peak = 0.0;
+        double spectralDb = 0.0;
+    };
+
+    /// Collects everything the engine writes, interleaved stereo
+    class CaptureOutput : public platform::AudioOutput
+    {
+    public:
+        void init(uint32_t) override {}
+        void write(const int16_t *interleaved, size_t frames) override
+        {
+            samples.insert(samples.end(), interleaved, interleaved + 2 * frames);
+        }
+        std::vector<int16_t> samples;
+    };
+
+    std::vector<SceneSpec> loadManifest(const std::string &path)
+    {
+        std::vector<SceneSpec> specs;
+        std::ifstream in(path);
+        std::string line;
+        while (std::getline(in, line))
+        {
+            line = line.substr(0, line.find('#'));
+            std::istringstream fields(line);
+            SceneSpec spec;
+            if (fields >> spec.name >> spec.rms >> spec.peak >> spec.spectralDb)
+                specs.push_back(spec);
+        }
+        return specs;
+    }
+
+    /// True if the script changes a control after frame 0
+    bool hasLateControls(const host::EventScript &script)
+    {
+        return std::any_of(script.events.begin(), script.events.end(), [](const host::ScriptEvent &event)
+                           { return event.frame > 0 && event.kind != host::ScriptEventKind::Note &&
+                                    event.kind != host::ScriptEventKind::End; });
+    }
+
+    /// `pipeReference` is set when the scene has its own reference in this mode
+    bool renderScene(const std::string &scriptPath, RenderMode mode, std::vector<int16_t> &samples, std::string &error,
+                     bool &pipeReference)
+    {
+        SoundConfig config{
+            .sampleRate = SAMPLE_RATE,
+            .tableSize = LOOKUP_TABLE_SIZE,
+            .amplitude = AMPLITUDE,
+            .bufferSize = BUFFER_SIZE,
+            .numVoices = DEFAULT_VOICES,
+            .maxPoliphony = DEFAULT_POLYPHONY,
+            .voiceCapacity = MAX_VOICES,
+            .polyphonyCapacity = MAX_POLYPHONY,
+            .renderMode = mode,
+        };
+
+        host::EventScript script;
+        if (!host::loadScript(scriptPath, config.sampleRate, script, error))
+            return false;
+        pipeReference = mode == RenderMode::Pipelined && hasLateControls(script);
+
+        CaptureOutput output;
+        SoundModule sound(config, output);
+        settings::SettingRouter router(sound);
+        host::renderScript(script, sound, router, config.bufferSize);
+        samples = std::move(output.samples);
+        return true;
+    }
+
+    bool writeReference(const std::string &path, const std::vector<int16_t> &samples)
+    {
+        platform::WavOutput wav(path);
+        wav.init(SAMPLE_RATE);
+        if (!wav.isOpen())
+            return false;
+        wav.write(samples.data(), samples.size() / 2);
+        wav.close();
+        return true;
+    }
+
+    uint32_t readU32(const uint8_t *p) { return p[0] | (p[1] << 8) | (p[2] << 16) | (uint32_t(p[3]) << 24); }
+    uint16_t readU16(const uint8_t *p) { return static_cast<uint16_t>(p[0] | (p[1] << 8)); }
+
+    /// Read a 16-bit stereo WAV as written by platform::WavOutput
+    bool readReference(const std::string &path, std::vector<int16_t> &samples, std::string &error)
+    {
+        std::ifstream in(path, std::ios::binary);
+        if (!in)
+        {
+            error = "no reference " + path + " (run with --update)";
+            return false;
+        }
+        std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        if (bytes.size() < 12 || std::memcmp(bytes.data(), "RIFF", 4) || std::memcmp(bytes.data() + 8, "WAVE", 4))
+        {
+            error = path + " is not a WAV file";
+            return false;
+        }
+
+        bool formatOk = false;
+        for (size_t pos = 12; pos + 8 <= bytes.size();)
+        {
+            const uint8_t *chunk = bytes.data() + pos;
+            uint32_t size = readU32(chunk + 4);
+            if (pos + 8 + size > bytes.size())
+                break;
+            if (!std::memcmp(chunk, "fmt ", 4) && size >= 16)
+            {
+                formatOk = readU16(chunk + 8) == 1 && readU16(chunk + 10) == 2 &&
+                           readU32(chunk + 12) == SAMPLE_RATE && readU16(chunk + 22) == 16;
+            }
+            else if (!std::memcmp(chunk, "data", 4))
+            {
+                if (!formatOk)
+                    break;
+                samples.resize(size / 2);
+                for (size_t i = 0; i < samples.size(); ++i)
+                    samples[i] = static_cast<int16_t>(readU16(chunk + 8 + 2 * i));
+                return true;
+            }
+            pos += 8 + size + (size & 1);
+        }
+        error = path + " is not 16-bit stereo PCM at the engine sample rate";
+        return false;
+    }
+
+    void fft(std::vector<std::complex<double>> &a)
+    {
+        const size_t n = a.size();
+        for (size_t i = 1, j = 0; i < n; ++i)
+        {
+            size_t bit = n >> 1;
+            for (; j & bit; bit >>= 1)
+                j ^= bit;
+            j ^= bit;
+            if (i < j)
+                std::swap(a[i], a[j]);
+        }
+        for (size_t len = 2; len <= n; len <<= 1)
+        {
+            std::complex<double> step = std::polar(1.0, -2.0 * M_PI / static_cast<double>(len));
+            for (size_t i = 0; i < n; i += len)
+            {
+                std::complex<double> w = 1.0;
+                for (size_t k = 0; k < len / 2; ++k)
+                {
+                    std::complex<double> u = a[i + k], v = a[i + k + len / 2] * w;
+                    a[i + k] = u + v;
+                    a[i + k + len / 2] = u - v;
+                    w *= step;
+                }
+            }
+        }
+    }
+
+    /// Magnitude spectrum in dBFS of the mid signal of one frame
+    std::vector<double> spectrumDb(const std::vector<int16_t> &samples, size_t frame)
+    {
+        std::vector<std::complex<double>> bins(FFT_SIZE);
+        double windowSum = 0.0;
+        for (size_t i = 0; i < FFT_SIZE; ++i)
+        {
+            double window = 0.5 - 0.5 * std::cos(2.0 * M_PI * i / FFT_SIZE);
+            size_t at = 2 * (frame + i);
+            double mid = at + 1 < samples.size() ? (samples[at] + samples[at + 1]) / 65536.0 : 0.0;
+            bins[i] = mid * window;
+            windowSum += window;
+        }
+        fft(bins);
+
+        std::vector<double> db(FFT_SIZE / 2);
+        for (size_t k = 0; k < db.size(); ++k)
+        {
+            double magnitude = 2.0 * std::abs(bins[k]) / windowSum;
+            db[k] = std::max(FLOOR_DB, 20.0 * std::log10(magnitude + 1e-30));
+        }
+        return db;
+    }
+
+    Errors compare(const std::vector<int16_t> &ref, const std::vector<int16_t> &out)
+    {
+        Errors errors;
+        double sumSquares = 0.0;
+        for (size_t i = 0; i < ref.size(); ++i)
+        {
+            double diff = (out[i] - ref[i]) / 32768.0;
+            sumSquares += diff * diff;
+            errors.peak = std::max(errors.peak, std::fabs(diff));
+        }
+        errors.rms = ref.empty() ? 0.0 : std::sqrt(sumSquares / ref.size());
+
+        const size_t frames = ref.size() / 2;
+        for (size_t frame = 0; frame + FFT_SIZE <= frames; frame += FFT_SIZE / 2)
+        {
+            std::vector<double> a = spectrumDb(ref, frame), b = spectrumDb(out, frame);
+            double sum = 0.0;
+            size_t count = 0;
+            for (size_t k = 0; k < a.size(); ++k)
+            {
+                if (std::max(a[k], b[k]) < AUDIBLE_DB)
+                    continue;
+                sum += (a[k] - b[k]) * (a[k] - b[k]);
+                ++count;
+            }
+            if (count)
+                errors.spectralDb = std::max(errors.spectralDb, std::sqrt(sum / count));
+        }
+        return errors;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::string dir = GOLDEN_DIR, only;
+    bool update = false;
+    RenderMode mode = RenderMode::SingleCore;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!std::strcmp(argv[i], "--update"))
+            update = true;
+        else if (!std::strcmp(argv[i], "--only") && i + 1 < argc)
+            only = argv[++i];
+        else if (!std::strcmp(argv[i], "--dir") && i + 1 < argc)
+            dir = argv[++i];
+        else if (!std::strcmp(argv[i], "--mode") && i + 1 < argc && host::parseRenderMode(argv[i + 1], mode))
+            ++i;
+        else
+        {
+            std::fprintf(stderr, "usage: %s [--update] [--only substr] [--dir golden_dir] [--mode single|split|pipe]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::vector<SceneSpec> specs = loadManifest(dir + "/manifest.txt");
+    if (specs.empty())
+    {
+        std::fprintf(stderr, "no scenes in %s/manifest.txt\n", dir.c_str());
+        return EXIT_FAILURE;
+    }
+
+    int failures = 0, checked = 0, skips = 0;
+    for (const auto &spec : specs)
+    {
+        if (!only.empty() && spec.name.find(only) == std::string::npos)
+            continue;
+        ++checked;
+
+        std::vector<int16_t> out, ref;
+        std::string error;
+        bool pipeReference = false;
+        if (!renderScene(dir + "/scenes/" + spec.name + ".txt", mode, out, error, pipeReference))
+        {
+            std::printf("FAIL %-24s %s\n", spec.name.c_str(), error.c_str());
+            ++failures;
+            continue;
+        }
+
+        const std::string refPath = dir + (pipeReference ? "/ref/pipe/" : "/ref/") + spec.name + ".wav";
+        if (update && mode == RenderMode::Pipelined && !pipeReference)
+        {
+            // Checked against the single-core reference; update that one in `single`
+            std::printf("skip %-24s shares the single-core reference\n", spec.name.c_str());
+            ++skips;
+            continue;
+        }
+        if (update)
+        {
+            bool written = writeReference(refPath, out);
+            std::printf("%s %-24s %zu frames\n", written ? "wrote" : "FAIL ", spec.name.c_str(), out.size() / 2);
+            failures += written ? 0 : 1;
+            continue;
+        }
+
+        if (!readReference(refPath, ref, error))
+        {
+            std::printf("FAIL %-24s %s\n", spec.name.c_str(), error.c_str());
+            ++failures;
+            continue;
+        }
+        if (ref.size() != out.size())
+        {
+            std::printf("FAIL %-24s length %zu frames, reference %zu\n", spec.name.c_str(), out.size() / 2, ref.size() / 2);
+            ++failures;
+            continue;
+        }
+
+        if (mode == RenderMode::Pipelined && !pipeReference)
+        {
+            // Line the pipeline's output up with the reference
+            const size_t latency = std::min(ref.size(), 2 * static_cast<size_t>(BUFFER_SIZE));
+            out.erase(out.begin(), out.begin() + latency);
+            ref.resize(ref.size() - latency);
+        }
+
+        Errors errors = compare(ref, out);
+        bool ok = errors.rms <= spec.rms && errors.peak <= spec.peak && errors.spectralDb <= spec.spectralDb;
+        std::printf("%s %-24s rms %.2e/%.0e  peak %.2e/%.0e  spectral %5.3f/%.2f dB\n",
+                    ok ? "ok  " : "FAIL", spec.name.c_str(), errors.rms, spec.rms,
+                    errors.peak, spec.peak, errors.spectralDb, spec.spectralDb);
+        failures += ok ? 0 : 1;
+    }
+
+    if (failures)
+        std::printf("FAIL %d of %d scenes\n", failures, checked - skips);
+    else if (skips)
+        std::printf("PASS %d scenes, %d skipped\n", checked - skips, skips);
+    else
+        std::printf("PASS %d scenes\n", checked);
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,113 @@
+// offline_render.cpp
+//
+// Render an event script through the audio engine into a WAV file.
+//
+//   offline_render [--mode single|split|pipe] <script.txt> <out.wav>
+//
+// See event_script.hpp for the script format and ../scenes for examples.
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include "event_script.hpp"
+#include "wav_output.hpp"
+
+using namespace sound_module;
+using namespace protocol;
+
+namespace
+{
+    /// Per-stage timing from the host clock backend (1 tick = 1 ns)
+    void printStats(const RenderStats &stats)
+    {
+        const double budget = stats.getBudget();
+        std::printf("\n%-12s %9s %9s %9s %9s %9s %8s\n", "stage (us)", "min", "avg", "p90", "p99", "max", "% block");
+        for (size_t i = 0; i < STAGE_COUNT; ++i)
+        {
+            StageSummary s = stats.summary(static_cast<Stage>(i));
+            std::printf("%-12s %9.2f %9.2f %9.2f %9.2f %9.2f %7.2f%%\n", stageName(static_cast<Stage>(i)),
+                        s.min * 1e-3, s.avg * 1e-3, s.p90 * 1e-3, s.p99 * 1e-3, s.max * 1e-3,
+                        budget > 0.0 ? 100.0 * s.avg / budget : 0.0);
+        }
+
+        std::printf("\nrender load by oscillators playing:\n");
+        for (size_t count = 0; count <= RenderStats::MAX_TRACKED_OSCILLATORS; ++count)
+        {
+            uint32_t avg = stats.renderAvgByOscillators(count);
+            if (avg && budget > 0.0)
+                std::printf("  %2zu: %6.2f%% of block\n", count, 100.0 * avg / budget);
+        }
+    }
+
+    /// Deadline misses against the realtime budget of each block
+    void printXruns(const XrunMonitor &xruns)
+    {
+        std::printf("\nblocks %u, late %u, worst slack %.2f us\n", xruns.getBlocks(), xruns.getLateBlocks(),
+                    xruns.getWorstSlack() == INT32_MAX ? 0.0 : xruns.getWorstSlack() * 1e-3);
+        std::array<LateBlock, XrunMonitor::HISTORY> late;
+        size_t count = xruns.recentLateBlocks(late.data(), late.size());
+        for (size_t i = 0; i < count; ++i)
+            std::printf("  block %u: render %.2f us, %u voices, %u oscillators, features 0x%02x\n", late[i].block,
+                        late[i].renderCycles * 1e-3, late[i].voices, late[i].oscillators, late[i].features);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    RenderMode mode = RenderMode::SingleCore;
+    int arg = 1;
+    if (argc == 5 && !std::strcmp(argv[1], "--mode") && host::parseRenderMode(argv[2], mode))
+        arg = 3;
+    if (argc - arg != 2)
+    {
+        std::fprintf(stderr, "usage: %s [--mode single|split|pipe] <script.txt> <out.wav>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    const char *scriptPath = argv[arg];
+    const char *wavPath = argv[arg + 1];
+
+    SoundConfig config{
+        .sampleRate = SAMPLE_RATE,
+        .tableSize = LOOKUP_TABLE_SIZE,
+        .amplitude = AMPLITUDE,
+        .bufferSize = BUFFER_SIZE,
+        .numVoices = DEFAULT_VOICES,
+        .maxPoliphony = DEFAULT_POLYPHONY,
+        .voiceCapacity = MAX_VOICES,
+        .polyphonyCapacity = MAX_POLYPHONY,
+        .renderMode = mode,
+    };
+
+    host::EventScript script;
+    std::string error;
+    if (!host::loadScript(scriptPath, config.sampleRate, script, error))
+    {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return EXIT_FAILURE;
+    }
+
+    platform::WavOutput output(wavPath);
+    output.init(config.sampleRate);
+    if (!output.isOpen())
+        return EXIT_FAILURE;
+
+    SoundModule sound(config, output);
+    settings::SettingRouter router(sound);
+
+    auto start = std::chrono::steady_clock::now();
+    uint64_t frame = host::renderScript(script, sound, router, config.bufferSize);
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    output.close();
+
+    double seconds = static_cast<double>(frame) / config.sampleRate;
+    std::printf("rendered %.3f s (%llu frames) in %.3f s, %.1fx realtime\n",
+                seconds, static_cast<unsigned long long>(frame), elapsed,
+                elapsed > 0.0 ? seconds / elapsed : 0.0);
+    printStats(sound.getStats());
+    printXruns(sound.getXruns());
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,117 @@
+// onset_check.cpp
+//
+// Verify that note-on events land on their exact sample inside a block.
+//
+//   onset_check
+//
+// A reference note is rendered starting on a block boundary, then the same
+// note is rendered starting at a range of in-block offsets. The onset of each
+// render (first threshold crossing, linearly interpolated) is compared with
+// the reference shifted by the requested offset. Exits non-zero if any onset
+// is off by one sample or more.
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "sound_module.hpp"
+#include "setting_router.hpp"
+#include "audio_output.hpp"
+
+using namespace sound_module;
+using namespace protocol;
+
+namespace
+{
+    constexpr uint64_t PREROLL_FRAMES = 48000; // let the gain smoothers settle
+    constexpr size_t CAPTURE_FRAMES = 4096;
+    constexpr float THRESHOLD = 64.0f; // int16 units
+
+    SoundConfig makeConfig()
+    {
+        return SoundConfig{
+            .sampleRate = SAMPLE_RATE,
+            .tableSize = LOOKUP_TABLE_SIZE,
+            .amplitude = AMPLITUDE,
+            .bufferSize = BUFFER_SIZE,
+            .numVoices = DEFAULT_VOICES,
+            .maxPoliphony = DEFAULT_POLYPHONY,
+            .voiceCapacity = MAX_VOICES,
+            .polyphonyCapacity = MAX_POLYPHONY,
+        };
+    }
+
+    /// Render a single note starting `offset` frames after the pre-roll,
+    /// return the left channel from the pre-roll onwards
+    std::vector<float> renderNote(uint64_t offset)
+    {
+        platform::NullOutput output;
+        SoundConfig config = makeConfig();
+        SoundModule sound(config, output);
+        settings::SettingRouter router(sound);
+
+        router.setMasterVolume(255);
+        router.setUpdateFromUi({{0, uint8_t(Page::VolChan), uint8_t(ChannelField::Vol), voice::VOL_MAX},
+                                {0, uint8_t(Page::Envelope), uint8_t(EnvelopeField::S), envelope::MAX}},
+                               0);
+        midi_module::MidiNoteEvent note{0x90, 69, 127};
+        sound.handle_note(note, PREROLL_FRAMES + offset);
+
+        std::vector<int16_t> block(config.bufferSize * 2);
+        std::vector<float> left;
+        uint64_t total = PREROLL_FRAMES + offset + CAPTURE_FRAMES;
+        for (uint64_t frame = 0; frame < total; frame += config.bufferSize)
+        {
+            sound.render(block.data(), config.bufferSize);
+            for (size_t i = 0; i < config.bufferSize; ++i)
+            {
+                if (frame + i >= PREROLL_FRAMES)
+                    left.push_back(block[2 * i]);
+            }
+        }
+        return left;
+    }
+
+    /// Fractional index of the first |x| >= THRESHOLD crossing, or -1
+    double onset(const std::vector<float> &signal)
+    {
+        for (size_t i = 0; i < signal.size(); ++i)
+        {
+            float level = std::fabs(signal[i]);
+            if (level >= THRESHOLD)
+            {
+                if (i == 0)
+                    return 0.0;
+                float previous = std::fabs(signal[i - 1]);
+                return static_cast<double>(i - 1) + (THRESHOLD - previous) / (level - previous);
+            }
+        }
+        return -1.0;
+    }
+}
+
+int main()
+{
+    const double reference = onset(renderNote(0));
+    if (reference < 0.0)
+    {
+        std::printf("FAIL reference note produced no output\n");
+        return EXIT_FAILURE;
+    }
+
+    const uint64_t offsets[] = {1, 2, 7, 64, 127, 128, 255, 300, 511, 512, 513, 777, 1023, 1500};
+    double worst = 0.0;
+    bool ok = true;
+    for (uint64_t offset : offsets)
+    {
+        double measured = onset(renderNote(offset));
+        double error = measured - reference - static_cast<double>(offset);
+        worst = std::max(worst, std::fabs(error));
+        bool pass = measured >= 0.0 && std::fabs(error) < 1.0;
+        ok = ok && pass;
+        std::printf("%s offset %5llu onset %9.3f error %+.3f samples\n",
+                    pass ? "ok  " : "FAIL", static_cast<unsigned long long>(offset), measured, error);
+    }
+    std::printf("%s worst onset error %.3f samples (block size %d)\n", ok ? "PASS" : "FAIL", worst, BUFFER_SIZE);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,522 @@
+// synth_bench.cpp
+//
+// Microbenchmarks for the DSP kernels and the full render path.
+//
+//   synth_bench [--json out.json] [--baseline base.json] [--only substr]
+//
+// Every kernel is timed over repeated calls until a run lasts at least
+// RUN_MS; the fastest of RUNS runs is reported as ns/sample and samples/sec.
+// --json writes the results in a line-per-kernel JSON file; --baseline reads
+// such a file back and prints the relative change of every kernel found in
+// both, so an optimisation or regression shows up as a number.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "sound_module.hpp"
+#include "setting_router.hpp"
+#include "audio_output.hpp"
+#include "oscillator.hpp"
+#include "filter.hpp"
+#include "envelope.hpp"
+#include "lfo.hpp"
+#include "lookup.hpp"
+#include "fastmath.hpp"
+#include "mip_table.hpp"
+#include "sine_table.hpp"
+#include "pitch_ratio.hpp"
+#include "mix_kernels.hpp"
+
+using namespace sound_module;
+using namespace protocol;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr int RUNS = 5;
+    constexpr double RUN_MS = 20.0;
+    constexpr size_t BLOCK = Voice::CONTROL_BLOCK;
+    constexpr size_t OSC_COUNTS[] = {1, 2, 4, 8, 16, 32};
+    constexpr size_t VOICE_COUNTS[] = {2, 4, 8};
+    constexpr size_t NOTES_PER_VOICE = 4;
+    constexpr FilterType FILTER_TYPES[] = {FilterType::LP12, FilterType::HP12, FilterType::BP12, FilterType::Notch};
+    constexpr LfoWaveform LFO_FORMS[] = {LfoWaveform::Sine, LfoWaveform::Triangle, LfoWaveform::Sawtooth, LfoWaveform::Pulse};
+
+    /// Keeps results observable so the optimiser cannot drop the kernels
+    volatile float sink = 0.0f;
+
+    struct Result
+    {
+        std::string name;
+        double nsPerSample;
+    };
+
+    class Bench
+    {
+    public:
+        explicit Bench(std::string only) : only(std::move(only)) {}
+
+        /// Time `call`, which processes `samplesPerCall` samples per invocation
+        void run(const std::string &name, size_t samplesPerCall, const std::function<void()> &call)
+        {
+            if (!only.empty() && name.find(only) == std::string::npos)
+                return;
+
+            call(); // warm caches and lazily built tables
+
+            // Calibrate the number of calls so a run lasts about RUN_MS
+            size_t calls = 1;
+            while (true)
+            {
+                double ms = timeCalls(call, calls) * 1e-6;
+                if (ms >= RUN_MS)
+                    break;
+                calls *= ms > 0.0 ? std::max<size_t>(2, static_cast<size_t>(RUN_MS / ms) + 1) : 16;
+            }
+
+            double best = 1e300;
+            for (int r = 0; r < RUNS; ++r)
+                best = std::min(best, timeCalls(call, calls));
+
+            double ns = best / static_cast<double>(calls * samplesPerCall);
+            results.push_back({name, ns});
+            std::printf("%-40s %10.2f ns/sample %14.0f samples/s\n", name.c_str(), ns, 1e9 / ns);
+        }
+
+        const std::vector<Result> &all() const { return results; }
+
+    private:
+        std::string only;
+        std::vector<Result> results;
+
+        static double timeCalls(const std::function<void()> &call, size_t calls)
+        {
+            auto start = Clock::now();
+            for (size_t i = 0; i < calls; ++i)
+                call();
+            return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        }
+    };
+
+    SoundConfig makeConfig(uint8_t polyphony)
+    {
+        return SoundConfig{
+            .sampleRate = SAMPLE_RATE,
+            .tableSize = LOOKUP_TABLE_SIZE,
+            .amplitude = AMPLITUDE,
+            .bufferSize = BUFFER_SIZE,
+            .numVoices = 1,
+            .maxPoliphony = polyphony,
+        };
+    }
+
+    void benchLookup(Bench &bench)
+    {
+        bench.run("lookup/interpolateLookup", 1, [phase = 0.0f]() mutable
+                  {
+            phase += 0.0123f;
+            if (phase >= 1.0f)
+                phase -= 1.0f;
+            sink = sink + interpolateLookup(phase, sineTable); });
+
+        bench.run("lookup/interpolatePhase", 1, [phase = 0u]() mutable
+                  {
+            phase += 0x01234567u;
+            sink = sink + interpolatePhase(phase, sineTable); });
+
+        const MipLevel &level = sawMipTable.level(0);
+        bench.run("lookup/interpolateMip", 1, [&level, phase = 0u]() mutable
+                  {
+            phase += 0x01234567u;
+            sink = sink + interpolateMip(level, phase); });
+
+        bench.run("pitch/centsToPitchRatio", 1, [cents = -1200.0f]() mutable
+                  {
+            cents = cents > 1200.0f ? -1200.0f : cents + 0.7f;
+            sink = sink + centsToPitchRatio(cents); });
+    }
+
+    /// A fastmath function and the libm call it replaces, on the same inputs
+    template <typename Fast, typename Libm>
+    void benchMathPair(Bench &bench, const std::string &name, float lo, float hi, Fast fast, Libm libm)
+    {
+        const float step = (hi - lo) / 1021.0f;
+        bench.run("math/" + name + "/fast", 1, [=, x = lo]() mutable
+                  {
+            x = x > hi ? lo : x + step;
+            sink = sink + fast(x); });
+        bench.run("math/" + name + "/libm", 1, [=, x = lo]() mutable
+                  {
+            x = x > hi ? lo : x + step;
+            sink = sink + libm(x); });
+    }
+
+    void benchMath(Bench &bench)
+    {
+        benchMathPair(bench, "exp2", -10.0f, 10.0f,
+                      [](float x) { return fastmath::exp2(x); },
+                      [](float x) { return std::exp2(x); });
+        benchMathPair(bench, "log2", 0.001f, 1000.0f,
+                      [](float x) { return fastmath::log2(x); },
+                      [](float x) { return std::log2(x); });
+        benchMathPair(bench, "dbToGain", -60.0f, 0.0f,
+                      [](float dB) { return fastmath::dbToGain(dB); },
+                      [](float dB) { return std::pow(10.0f, dB * 0.05f); });
+        // Shaped like the filter's cutoff curve
+        benchMathPair(bench, "pow", 0.0f, 1.0f,
+                      [](float t) { return fastmath::pow(1102.5f, t); },
+                      [](float t) { return std::pow(1102.5f, t); });
+        benchMathPair(bench, "tanh", -4.0f, 4.0f,
+                      [](float x) { return fastmath::tanh(x); },
+                      [](float x) { return std::tanh(x); });
+        benchMathPair(bench, "tan", 0.0f, fastmath::TAN_MAX_ARGUMENT,
+                      [](float x) { return fastmath::tan(x); },
+                      [](float x) { return std::tan(x); });
+    }
+
+    void benchOscillator(Bench &bench)
+    {
+        for (int s = 0; s < OscillatorShape::_Count; ++s)
+        {
+            auto shape = static_cast<OscillatorShape>(s);
+            std::string label = oscShapes[s];
+
+            auto osc = std::make_shared<Oscillator>(SAMPLE_RATE, BPM_DEFAULT);
+            osc->setShape(shape);
+            osc->envelope.setSustain(envelope::MAX);
+            osc->noteOn(440.0f, 127, 69);
+            osc->setFrequency(440.0f);
+
+            bench.run("osc/renderBlock/" + label, BLOCK, [osc]()
+                      {
+                float out[BLOCK] = {};
+                osc->renderBlock(out, BLOCK);
+                sink = sink + out[BLOCK - 1]; });
+        }
+    }
+
+    void benchFilter(Bench &bench)
+    {
+        for (auto type : FILTER_TYPES)
+        {
+            std::string label = filtTypes[static_cast<int>(type)];
+            auto filter = std::make_shared<Filter>(SAMPLE_RATE, BPM_DEFAULT, 0);
+            filter->setType(type);
+            filter->setCutoff(MAX_CUTOFF_RAW / 2);
+            filter->setResonance(MAX_RESONANCE_RAW / 2);
+
+            bench.run("filter/process/" + label, 1, [filter, x = 0.0f]() mutable
+                      {
+                x = x > 1.0f ? -1.0f : x + 0.01f;
+                sink = sink + filter->process(x); });
+
+            bench.run("filter/processBlock/" + label, BLOCK, [filter]()
+                      {
+                float buf[BLOCK];
+                for (size_t i = 0; i < BLOCK; ++i)
+                    buf[i] = (i & 32) ? 0.5f : -0.5f;
+                filter->processBlock(buf, BLOCK);
+                sink = sink + buf[BLOCK - 1]; });
+
+            // Cutoff moves every block, so every block glides
+            bench.run("filter/processBlockSweep/" + label, BLOCK, [filter, cutoff = 0]() mutable
+                      {
+                cutoff = (cutoff + 1) % (MAX_CUTOFF_RAW + 1);
+                filter->setCutoff(static_cast<uint8_t>(cutoff));
+                float buf[BLOCK];
+                for (size_t i = 0; i < BLOCK; ++i)
+                    buf[i] = (i & 32) ? 0.5f : -0.5f;
+                filter->processBlock(buf, BLOCK);
+                sink = sink + buf[BLOCK - 1]; });
+        }
+    }
+
+    void benchEnvelope(Bench &bench)
+    {
+        // Long attack, retriggered per call, so every sample is inside a ramp
+        auto env = std::make_shared<Envelope>(SAMPLE_RATE, BPM_DEFAULT);
+        env->setAttack(envelope::MAX);
+        env->setSustain(envelope::MAX / 2);
+
+        bench.run("env/next", BLOCK, [env]()
+                  {
+            env->gateOn();
+            float acc = 0.0f;
+            for (size_t i = 0; i < BLOCK; ++i)
+                acc += env->next();
+            sink = sink + acc; });
+
+        bench.run("env/renderBlock", BLOCK, [env]()
+                  {
+            env->gateOn();
+            float out[BLOCK];
+            env->renderBlock(out, BLOCK);
+            sink = sink + out[BLOCK - 1]; });
+    }
+
+    void benchLfo(Bench &bench)
+    {
+        for (auto form : LFO_FORMS)
+        {
+            auto lfo = std::make_shared<LFO>(SAMPLE_RATE, BPM_DEFAULT);
+            lfo->setWaveform(form);
+            lfo->setDepth(127);
+            bench.run(std::string("lfo/getValue/") + protocol::form[static_cast<int>(form)], 1, [lfo, frame = uint64_t(0)]() mutable
+                      {
+                lfo->advanceTo(++frame);
+                sink = sink + lfo->getValue(); });
+        }
+    }
+
+    /// Bus kernels over one engine block, with the scalar convert and the
+    /// per-sample master loop they replaced for comparison
+    void benchMix(Bench &bench)
+    {
+        struct Buffers
+        {
+            std::vector<float> left, right, source, gains;
+            std::vector<int16_t> out;
+        };
+        auto buf = std::make_shared<Buffers>();
+        buf->left.resize(BUFFER_SIZE);
+        buf->right.resize(BUFFER_SIZE);
+        buf->source.resize(BUFFER_SIZE);
+        buf->gains.assign(BUFFER_SIZE, 0.9f);
+        buf->out.resize(2 * BUFFER_SIZE);
+        for (size_t i = 0; i < BUFFER_SIZE; ++i)
+        {
+            // Peaks past full scale, so the saturation is exercised
+            buf->source[i] = 1.5f * std::sin(0.05f * static_cast<float>(i));
+            buf->left[i] = buf->source[i];
+            buf->right[i] = -buf->source[i];
+        }
+        const float amplitude = static_cast<float>(AMPLITUDE);
+
+        bench.run("mix/accumulate", BUFFER_SIZE, [buf]()
+                  { mix::accumulate(buf->left.data(), buf->source.data(), BUFFER_SIZE); });
+        bench.run("mix/mixMono", BUFFER_SIZE, [buf]()
+                  { mix::mixMono(buf->left.data(), buf->right.data(), buf->source.data(), buf->gains.data(), BUFFER_SIZE); });
+
+        // Refill the bus: the accumulate runs above have grown it
+        for (size_t i = 0; i < BUFFER_SIZE; ++i)
+        {
+            buf->left[i] = buf->source[i];
+            buf->right[i] = -buf->source[i];
+        }
+        bench.run("mix/convertInterleave", BUFFER_SIZE, [buf]()
+                  {
+            mix::convertInterleave(buf->out.data(), buf->left.data(), buf->right.data(), buf->gains.data(), BUFFER_SIZE);
+            sink = sink + buf->out[7]; });
+        bench.run("mix/convertInterleave/scalar", BUFFER_SIZE, [buf]()
+                  {
+            mix::scalar::convertInterleave(buf->out.data(), buf->left.data(), buf->right.data(), buf->gains.data(), BUFFER_SIZE);
+            sink = sink + buf->out[7]; });
+
+        // The whole master stage: a moving gain ramp, then convert
+        bench.run("mix/master", BUFFER_SIZE, [buf, amplitude, gain = SmoothedGain{}, step = 0]() mutable
+                  {
+            gain.setTarget((++step & 1) ? 1.0f : 0.5f);
+            mix::rampGain(gain, amplitude, buf->gains.data(), BUFFER_SIZE);
+            mix::convertInterleave(buf->out.data(), buf->left.data(), buf->right.data(), buf->gains.data(), BUFFER_SIZE);
+            sink = sink + buf->out[7]; });
+        bench.run("mix/master/per-sample", BUFFER_SIZE, [buf, amplitude, gain = SmoothedGain{}, step = 0]() mutable
+                  {
+            gain.setTarget((++step & 1) ? 1.0f : 0.5f);
+            int16_t *out = buf->out.data();
+            for (size_t i = 0; i < BUFFER_SIZE; ++i)
+            {
+                float volumeScale = gain.next() * amplitude;
+                out[2 * i] = static_cast<int16_t>(buf->left[i] * volumeScale);
+                out[2 * i + 1] = static_cast<int16_t>(buf->right[i] * volumeScale);
+            }
+            sink = sink + buf->out[7]; });
+        bench.run("mix/master/settled", BUFFER_SIZE, [buf, amplitude, gain = SmoothedGain{1.0f, 1.0f}]() mutable
+                  {
+            mix::rampGain(gain, amplitude, buf->gains.data(), BUFFER_SIZE);
+            mix::convertInterleave(buf->out.data(), buf->left.data(), buf->right.data(), buf->gains.data(), BUFFER_SIZE);
+            sink = sink + buf->out[7]; });
+    }
+
+    /// Full SoundModule::process() with `count` sustained notes on one voice
+    void benchEngine(Bench &bench, const std::string &name, size_t count, OscillatorShape shape, FilterType type)
+    {
+        auto output = std::make_shared<platform::NullOutput>();
+        auto sound = std::make_shared<SoundModule>(makeConfig(static_cast<uint8_t>(count)), *output);
+        auto router = std::make_shared<settings::SettingRouter>(*sound);
+
+        router->setMasterVolume(255);
+        router->setUpdateFromUi({{0, uint8_t(Page::VolChan), uint8_t(ChannelField::Vol), voice::VOL_MAX},
+                                 {0, uint8_t(Page::Envelope), uint8_t(EnvelopeField::S), envelope::MAX},
+                                 {0, uint8_t(Page::Oscillator), uint8_t(OscillatorField::Shape), uint8_t(shape)},
+                                 {0, uint8_t(Page::Filter), uint8_t(FilterField::Type), uint8_t(type)},
+                                 {0, uint8_t(Page::Filter), uint8_t(FilterField::Cutoff), MAX_CUTOFF_RAW / 3}},
+                                0);
+        for (size_t i = 0; i < count; ++i)
+        {
+            midi_module::MidiNoteEvent note{0x90, static_cast<uint8_t>(36 + i * 2), 100};
+            sound->handle_note(note, 0);
+        }
+        for (int i = 0; i < 16; ++i) // apply events, settle smoothers
+            sound->process();
+
+        bench.run(name, BUFFER_SIZE, [sound, router, output]()
+                  { sound->process(); });
+    }
+
+    /// Full SoundModule::process() with `voiceCount` voices on their own
+    /// channels, each holding NOTES_PER_VOICE notes, in render mode `mode`
+    void benchVoices(Bench &bench, const std::string &name, size_t voiceCount, RenderMode mode)
+    {
+        SoundConfig config = makeConfig(static_cast<uint8_t>(voiceCount * NOTES_PER_VOICE));
+        config.numVoices = voiceCount;
+        config.renderMode = mode;
+        auto output = std::make_shared<platform::NullOutput>();
+        auto sound = std::make_shared<SoundModule>(config, *output);
+        auto router = std::make_shared<settings::SettingRouter>(*sound);
+
+        router->setMasterVolume(255);
+        for (size_t v = 0; v < voiceCount; ++v)
+        {
+            const auto vi = static_cast<uint8_t>(v);
+            router->setUpdateFromUi({{vi, uint8_t(Page::VolChan), uint8_t(ChannelField::Chan), int16_t(v)},
+                                     {vi, uint8_t(Page::VolChan), uint8_t(ChannelField::Vol), voice::VOL_MAX / 2},
+                                     {vi, uint8_t(Page::Envelope), uint8_t(EnvelopeField::S), envelope::MAX},
+                                     {vi, uint8_t(Page::Oscillator), uint8_t(OscillatorField::Shape), uint8_t(OscillatorShape::Saw)},
+                                     {vi, uint8_t(Page::Filter), uint8_t(FilterField::Type), uint8_t(FilterType::LP12)},
+                                     {vi, uint8_t(Page::Filter), uint8_t(FilterField::Cutoff), MAX_CUTOFF_RAW / 3}},
+                                    0);
+            for (size_t i = 0; i < NOTES_PER_VOICE; ++i)
+            {
+                midi_module::MidiNoteEvent note{static_cast<uint8_t>(0x90 | v), static_cast<uint8_t>(36 + v * 5 + i * 2), 100};
+                sound->handle_note(note, 0);
+            }
+        }
+        for (int i = 0; i < 16; ++i) // apply events, settle smoothers, start the helper
+            sound->process();
+
+        bench.run(name, BUFFER_SIZE, [sound, router, output]()
+                  { sound->process(); });
+    }
+
+    void benchEngines(Bench &bench)
+    {
+        for (size_t count : VOICE_COUNTS)
+        {
+            const std::string shape = std::to_string(count) + "x" + std::to_string(NOTES_PER_VOICE) + "osc";
+            benchVoices(bench, "engine/single/" + shape, count, RenderMode::SingleCore);
+            benchVoices(bench, "engine/split/" + shape, count, RenderMode::VoiceSplit);
+            benchVoices(bench, "engine/pipe/" + shape, count, RenderMode::Pipelined);
+        }
+
+        for (int s = 0; s < OscillatorShape::_Count; ++s)
+            for (size_t count : OSC_COUNTS)
+                benchEngine(bench, "engine/" + std::string(oscShapes[s]) + "/" + std::to_string(count) + "osc",
+                            count, static_cast<OscillatorShape>(s), FilterType::LP12);
+
+        for (auto type : FILTER_TYPES)
+            for (size_t count : OSC_COUNTS)
+                benchEngine(bench, "engine/" + std::string(filtTypes[static_cast<int>(type)]) + "/" + std::to_string(count) + "osc",
+                            count, OscillatorShape::Saw, type);
+    }
+
+    bool writeJson(const std::string &path, const std::vector<Result> &results)
+    {
+        FILE *file = std::fopen(path.c_str(), "w");
+        if (!file)
+            return false;
+        std::fprintf(file, "{\n  \"unit\": \"ns/sample\",\n  \"results\": [\n");
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            std::fprintf(file, "    {\"name\": \"%s\", \"ns_per_sample\": %.3f, \"samples_per_sec\": %.0f}%s\n",
+                         results[i].name.c_str(), results[i].nsPerSample, 1e9 / results[i].nsPerSample,
+                         i + 1 < results.size() ? "," : "");
+        }
+        std::fprintf(file, "  ]\n}\n");
+        std::fclose(file);
+        return true;
+    }
+
+    /// Read back a file written by writeJson(); one result per line
+    std::map<std::string, double> readJson(const std::string &path)
+    {
+        std::map<std::string, double> baseline;
+        std::ifstream in(path);
+        std::string line;
+        while (std::getline(in, line))
+        {
+            char name[128];
+            double ns = 0.0;
+            const char *entry = std::strstr(line.c_str(), "{\"name\"");
+            if (entry && std::sscanf(entry, "{\"name\": \"%127[^\"]\", \"ns_per_sample\": %lf", name, &ns) == 2)
+                baseline[name] = ns;
+        }
+        return baseline;
+    }
+
+    void compare(const std::vector<Result> &results, const std::map<std::string, double> &baseline)
+    {
+        std::printf("\n%-40s %10s %10s %8s\n", "kernel", "base ns", "now ns", "change");
+        for (const auto &r : results)
+        {
+            auto it = baseline.find(r.name);
+            if (it == baseline.end())
+                continue;
+            double change = (r.nsPerSample / it->second - 1.0) * 100.0;
+            std::printf("%-40s %10.2f %10.2f %+7.1f%%\n", r.name.c_str(), it->second, r.nsPerSample, change);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::string jsonPath, baselinePath, only;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!std::strcmp(argv[i], "--json") && i + 1 < argc)
+            jsonPath = argv[++i];
+        else if (!std::strcmp(argv[i], "--baseline") && i + 1 < argc)
+            baselinePath = argv[++i];
+        else if (!std::strcmp(argv[i], "--only") && i + 1 < argc)
+            only = argv[++i];
+        else
+        {
+            std::fprintf(stderr, "usage: %s [--json out.json] [--baseline base.json] [--only substr]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    Bench bench(only);
+    benchLookup(bench);
+    benchMath(bench);
+    benchOscillator(bench);
+    benchFilter(bench);
+    benchEnvelope(bench);
+    benchLfo(bench);
+    benchMix(bench);
+    benchEngines(bench);
+
+    if (!jsonPath.empty() && !writeJson(jsonPath, bench.all()))
+    {
+        std::fprintf(stderr, "cannot write %s\n", jsonPath.c_str());
+        return 1;
+    }
+    if (!baselinePath.empty())
+    {
+        auto baseline = readJson(baselinePath);
+        if (baseline.empty())
+        {
+            std::fprintf(stderr, "no results in %s\n", baselinePath.c_str());
+            return 1;
+        }
+        compare(bench.all(), baseline);
+    }
+    return 0;
+}
@@ -7,8 +7,8 @@
 #include "receiver.hpp"
 #include "knob.hpp"
 #include "setting_router.hpp"
-#include "cached_lfo.hpp"
 #include "synth_config.hpp"
+#include "platform.hpp"
 
 using namespace midi_module;
 using namespace sound_module;
@@ -16,7 +16,8 @@ using namespace protocol;
 using namespace ui;
 #define TAG "AudioMain"
 
-SoundModule soundModule(config);
+I2SOutput audioOutput(i2sParams);
+SoundModule soundModule(config, audioOutput);
 
 Receiver receiver(receiverConfig);
 settings::SettingRouter settingSwitch(soundModule);
@@ -54,9 +55,20 @@ auto updateCallback = [](const EventList &events)
     }
 };
 
+void statsTask(void *)
+{
+    while (true)
+    {
+        vTaskDelay(pdMS_TO_TICKS(STATS_LOG_INTERVAL_MS));
+        soundModule.getStats().log(TAG);
+        soundModule.getXruns().log(TAG);
+    }
+}
+
 extern "C" void app_main()
 {
     soundModule.init();
+    platform::startTask(statsTask, "render_stats", 4096, nullptr, 1, 0);
     ESP_ERROR_CHECK(receiver.init(updateCallback));
     masterKnob.init(masterKnobCallback);
 }
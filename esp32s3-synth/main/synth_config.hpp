@@ -3,11 +3,13 @@
 #include "receiver.hpp"
 #include "protocol.hpp"
 #include "knob.hpp"
+#include "i2s_output.hpp"
 
 using namespace midi_module;
 using namespace sound_module;
 using namespace protocol;
 using namespace ui;
+using namespace platform;
 
 // ESP32-S3 Pin Mapping for I2S
 #define I2S_BCK_IO GPIO_NUM_38      // changed to 40
@@ -20,19 +22,28 @@ using namespace ui;
 
 #define MASTER_KNOB_PIN GPIO_NUM_4
 
+// Render timing report from a low-priority task on core 0
+#define STATS_LOG_INTERVAL_MS 10000
+
 // Configure sound engine
 SoundConfig config{
     .sampleRate = SAMPLE_RATE,
     .tableSize = LOOKUP_TABLE_SIZE,
     .amplitude = AMPLITUDE,
     .bufferSize = BUFFER_SIZE,
-    .numVoices = NUM_VOICES,
-    .maxPoliphony = NUM_SOUNDS,
-    .i2s = {
-        .bclk_io = I2S_BCK_IO,
-        .lrclk_io = I2S_LRCK_IO,
-        .data_io = I2S_DO_IO},
+    .numVoices = DEFAULT_VOICES,
+    .maxPoliphony = DEFAULT_POLYPHONY,
+    .voiceCapacity = MAX_VOICES,
+    .polyphonyCapacity = MAX_POLYPHONY,
+    // VoiceSplit and Pipelined use a helper task on core 0; stay on one core
+    // until RenderStats on the S3 show either of them beating it
+    .renderMode = RenderMode::SingleCore,
+};
 
+I2SParams i2sParams{
+    .bclk_io = I2S_BCK_IO,
+    .lrclk_io = I2S_LRCK_IO,
+    .data_io = I2S_DO_IO,
 };
 
 ReceiverConfig receiverConfig = {